@@ -32,6 +32,10 @@ DriverConfig::DriverConfig(bslma::Allocator* basicAllocator)
 , d_maxEventsPerWait()
 , d_maxTimersPerWait()
 , d_maxCyclesPerWait()
+, d_busyPollDuration()
+, d_busyPollSockets()
+, d_deferInterestChanges()
+, d_devicePerWaiter()
 , d_metricCollection()
 , d_metricCollectionPerWaiter()
 , d_metricCollectionPerSocket()
@@ -48,6 +52,10 @@ DriverConfig::DriverConfig(const DriverConfig& original,
 , d_maxEventsPerWait(original.d_maxEventsPerWait)
 , d_maxTimersPerWait(original.d_maxTimersPerWait)
 , d_maxCyclesPerWait(original.d_maxCyclesPerWait)
+, d_busyPollDuration(original.d_busyPollDuration)
+, d_busyPollSockets(original.d_busyPollSockets)
+, d_deferInterestChanges(original.d_deferInterestChanges)
+, d_devicePerWaiter(original.d_devicePerWaiter)
 , d_metricCollection(original.d_metricCollection)
 , d_metricCollectionPerWaiter(original.d_metricCollectionPerWaiter)
 , d_metricCollectionPerSocket(original.d_metricCollectionPerSocket)
@@ -69,6 +77,10 @@ DriverConfig& DriverConfig::operator=(const DriverConfig& other)
         d_maxEventsPerWait          = other.d_maxEventsPerWait;
         d_maxTimersPerWait          = other.d_maxTimersPerWait;
         d_maxCyclesPerWait          = other.d_maxCyclesPerWait;
+        d_busyPollDuration          = other.d_busyPollDuration;
+        d_busyPollSockets           = other.d_busyPollSockets;
+        d_deferInterestChanges      = other.d_deferInterestChanges;
+        d_devicePerWaiter           = other.d_devicePerWaiter;
         d_metricCollection          = other.d_metricCollection;
         d_metricCollectionPerWaiter = other.d_metricCollectionPerWaiter;
         d_metricCollectionPerSocket = other.d_metricCollectionPerSocket;
@@ -87,6 +99,10 @@ void DriverConfig::reset()
     d_maxEventsPerWait.reset();
     d_maxTimersPerWait.reset();
     d_maxCyclesPerWait.reset();
+    d_busyPollDuration.reset();
+    d_busyPollSockets.reset();
+    d_deferInterestChanges.reset();
+    d_devicePerWaiter.reset();
     d_metricCollection.reset();
     d_metricCollectionPerWaiter.reset();
     d_metricCollectionPerSocket.reset();
@@ -132,6 +148,26 @@ void DriverConfig::setMaxCyclesPerWait(bsl::size_t value)
     d_maxCyclesPerWait = value;
 }
 
+void DriverConfig::setBusyPollDuration(const bsls::TimeInterval& value)
+{
+    d_busyPollDuration = value;
+}
+
+void DriverConfig::setBusyPollSockets(bool value)
+{
+    d_busyPollSockets = value;
+}
+
+void DriverConfig::setDeferInterestChanges(bool value)
+{
+    d_deferInterestChanges = value;
+}
+
+void DriverConfig::setDevicePerWaiter(bool value)
+{
+    d_devicePerWaiter = value;
+}
+
 void DriverConfig::setMetricCollection(bool value)
 {
     d_metricCollection = value;
@@ -188,6 +224,27 @@ const bdlb::NullableValue<bsl::size_t>& DriverConfig::maxCyclesPerWait() const
     return d_maxCyclesPerWait;
 }
 
+const bdlb::NullableValue<bsls::TimeInterval>& DriverConfig::busyPollDuration()
+    const
+{
+    return d_busyPollDuration;
+}
+
+const bdlb::NullableValue<bool>& DriverConfig::busyPollSockets() const
+{
+    return d_busyPollSockets;
+}
+
+const bdlb::NullableValue<bool>& DriverConfig::deferInterestChanges() const
+{
+    return d_deferInterestChanges;
+}
+
+const bdlb::NullableValue<bool>& DriverConfig::devicePerWaiter() const
+{
+    return d_devicePerWaiter;
+}
+
 const bdlb::NullableValue<bool>& DriverConfig::metricCollection() const
 {
     return d_metricCollection;
@@ -215,6 +272,10 @@ bool DriverConfig::equals(const DriverConfig& other) const
            d_maxEventsPerWait == other.d_maxEventsPerWait &&
            d_maxTimersPerWait == other.d_maxTimersPerWait &&
            d_maxCyclesPerWait == other.d_maxCyclesPerWait &&
+           d_busyPollDuration == other.d_busyPollDuration &&
+           d_busyPollSockets == other.d_busyPollSockets &&
+           d_deferInterestChanges == other.d_deferInterestChanges &&
+           d_devicePerWaiter == other.d_devicePerWaiter &&
            d_metricCollection == other.d_metricCollection &&
            d_metricCollectionPerWaiter == other.d_metricCollectionPerWaiter &&
            d_metricCollectionPerSocket == other.d_metricCollectionPerSocket;
@@ -286,6 +347,38 @@ bool DriverConfig::less(const DriverConfig& other) const
         return false;
     }
 
+    if (d_busyPollDuration < other.d_busyPollDuration) {
+        return true;
+    }
+
+    if (other.d_busyPollDuration < d_busyPollDuration) {
+        return false;
+    }
+
+    if (d_busyPollSockets < other.d_busyPollSockets) {
+        return true;
+    }
+
+    if (other.d_busyPollSockets < d_busyPollSockets) {
+        return false;
+    }
+
+    if (d_deferInterestChanges < other.d_deferInterestChanges) {
+        return true;
+    }
+
+    if (other.d_deferInterestChanges < d_deferInterestChanges) {
+        return false;
+    }
+
+    if (d_devicePerWaiter < other.d_devicePerWaiter) {
+        return true;
+    }
+
+    if (other.d_devicePerWaiter < d_devicePerWaiter) {
+        return false;
+    }
+
     if (d_metricCollection < other.d_metricCollection) {
         return true;
     }
@@ -319,6 +412,10 @@ bsl::ostream& DriverConfig::print(bsl::ostream& stream,
     printer.printAttribute("maxEventsPerWait", d_maxEventsPerWait);
     printer.printAttribute("maxTimersPerWait", d_maxTimersPerWait);
     printer.printAttribute("maxCyclesPerWait", d_maxCyclesPerWait);
+    printer.printAttribute("busyPollDuration", d_busyPollDuration);
+    printer.printAttribute("busyPollSockets", d_busyPollSockets);
+    printer.printAttribute("deferInterestChanges", d_deferInterestChanges);
+    printer.printAttribute("devicePerWaiter", d_devicePerWaiter);
     printer.printAttribute("metricCollection", d_metricCollection);
     printer.printAttribute("metricCollectionPerWaiter",
                            d_metricCollectionPerWaiter);
@@ -35,6 +35,10 @@ InterfaceConfig::InterfaceConfig(bslma::Allocator* basicAllocator)
 , d_maxEventsPerWait()
 , d_maxTimersPerWait()
 , d_maxCyclesPerWait()
+, d_busyPollDuration()
+, d_busyPollSockets()
+, d_deferInterestChanges()
+, d_devicePerWaiter()
 , d_maxConnections()
 , d_backlog()
 , d_acceptQueueLowWatermark()
@@ -48,6 +52,9 @@ InterfaceConfig::InterfaceConfig(bslma::Allocator* basicAllocator)
 , d_acceptGreedily()
 , d_sendGreedily()
 , d_receiveGreedily()
+, d_sendBudget()
+, d_receiveBudget()
+, d_receiveCopyThreshold()
 , d_sendBufferSize()
 , d_receiveBufferSize()
 , d_sendBufferLowWatermark()
@@ -92,6 +99,10 @@ InterfaceConfig::InterfaceConfig(const InterfaceConfig& other,
 , d_maxEventsPerWait(other.d_maxEventsPerWait)
 , d_maxTimersPerWait(other.d_maxTimersPerWait)
 , d_maxCyclesPerWait(other.d_maxCyclesPerWait)
+, d_busyPollDuration(other.d_busyPollDuration)
+, d_busyPollSockets(other.d_busyPollSockets)
+, d_deferInterestChanges(other.d_deferInterestChanges)
+, d_devicePerWaiter(other.d_devicePerWaiter)
 , d_maxConnections(other.d_maxConnections)
 , d_backlog(other.d_backlog)
 , d_acceptQueueLowWatermark(other.d_acceptQueueLowWatermark)
@@ -105,6 +116,9 @@ InterfaceConfig::InterfaceConfig(const InterfaceConfig& other,
 , d_acceptGreedily(other.d_acceptGreedily)
 , d_sendGreedily(other.d_sendGreedily)
 , d_receiveGreedily(other.d_receiveGreedily)
+, d_sendBudget(other.d_sendBudget)
+, d_receiveBudget(other.d_receiveBudget)
+, d_receiveCopyThreshold(other.d_receiveCopyThreshold)
 , d_sendBufferSize(other.d_sendBufferSize)
 , d_receiveBufferSize(other.d_receiveBufferSize)
 , d_sendBufferLowWatermark(other.d_sendBufferLowWatermark)
@@ -154,6 +168,10 @@ InterfaceConfig& InterfaceConfig::operator=(const InterfaceConfig& other)
         d_maxEventsPerWait         = other.d_maxEventsPerWait;
         d_maxTimersPerWait         = other.d_maxTimersPerWait;
         d_maxCyclesPerWait         = other.d_maxCyclesPerWait;
+        d_busyPollDuration         = other.d_busyPollDuration;
+        d_busyPollSockets          = other.d_busyPollSockets;
+        d_deferInterestChanges     = other.d_deferInterestChanges;
+        d_devicePerWaiter          = other.d_devicePerWaiter;
         d_maxConnections           = other.d_maxConnections;
         d_backlog                  = other.d_backlog;
         d_acceptQueueLowWatermark  = other.d_acceptQueueLowWatermark;
@@ -169,6 +187,9 @@ InterfaceConfig& InterfaceConfig::operator=(const InterfaceConfig& other)
         d_acceptGreedily            = other.d_acceptGreedily;
         d_sendGreedily              = other.d_sendGreedily;
         d_receiveGreedily           = other.d_receiveGreedily;
+        d_sendBudget                = other.d_sendBudget;
+        d_receiveBudget             = other.d_receiveBudget;
+        d_receiveCopyThreshold      = other.d_receiveCopyThreshold;
         d_sendBufferSize            = other.d_sendBufferSize;
         d_receiveBufferSize         = other.d_receiveBufferSize;
         d_sendBufferLowWatermark    = other.d_sendBufferLowWatermark;
@@ -253,6 +274,26 @@ void InterfaceConfig::setMaxCyclesPerWait(bsl::size_t value)
     d_maxCyclesPerWait = value;
 }
 
+void InterfaceConfig::setBusyPollDuration(const bsls::TimeInterval& value)
+{
+    d_busyPollDuration = value;
+}
+
+void InterfaceConfig::setBusyPollSockets(bool value)
+{
+    d_busyPollSockets = value;
+}
+
+void InterfaceConfig::setDeferInterestChanges(bool value)
+{
+    d_deferInterestChanges = value;
+}
+
+void InterfaceConfig::setDevicePerWaiter(bool value)
+{
+    d_devicePerWaiter = value;
+}
+
 void InterfaceConfig::setMaxConnections(bsl::size_t value)
 {
     d_maxConnections = value;
@@ -318,6 +359,21 @@ void InterfaceConfig::setReceiveGreedily(bool value)
     d_receiveGreedily = value;
 }
 
+void InterfaceConfig::setSendBudget(bsl::size_t value)
+{
+    d_sendBudget = value;
+}
+
+void InterfaceConfig::setReceiveBudget(bsl::size_t value)
+{
+    d_receiveBudget = value;
+}
+
+void InterfaceConfig::setReceiveCopyThreshold(bsl::size_t value)
+{
+    d_receiveCopyThreshold = value;
+}
+
 void InterfaceConfig::setSendBufferSize(bsl::size_t value)
 {
     d_sendBufferSize = value;
@@ -516,6 +572,27 @@ const bdlb::NullableValue<bsl::size_t>& InterfaceConfig::maxCyclesPerWait()
     return d_maxCyclesPerWait;
 }
 
+const bdlb::NullableValue<bsls::TimeInterval>&
+InterfaceConfig::busyPollDuration() const
+{
+    return d_busyPollDuration;
+}
+
+const bdlb::NullableValue<bool>& InterfaceConfig::busyPollSockets() const
+{
+    return d_busyPollSockets;
+}
+
+const bdlb::NullableValue<bool>& InterfaceConfig::deferInterestChanges() const
+{
+    return d_deferInterestChanges;
+}
+
+const bdlb::NullableValue<bool>& InterfaceConfig::devicePerWaiter() const
+{
+    return d_devicePerWaiter;
+}
+
 const bdlb::NullableValue<bsl::size_t>& InterfaceConfig::maxConnections() const
 {
     return d_maxConnections;
@@ -589,6 +666,22 @@ const bdlb::NullableValue<bool>& InterfaceConfig::receiveGreedily() const
     return d_receiveGreedily;
 }
 
+const bdlb::NullableValue<bsl::size_t>& InterfaceConfig::sendBudget() const
+{
+    return d_sendBudget;
+}
+
+const bdlb::NullableValue<bsl::size_t>& InterfaceConfig::receiveBudget() const
+{
+    return d_receiveBudget;
+}
+
+const bdlb::NullableValue<bsl::size_t>& InterfaceConfig::receiveCopyThreshold()
+    const
+{
+    return d_receiveCopyThreshold;
+}
+
 const bdlb::NullableValue<bsl::size_t>& InterfaceConfig::sendBufferSize() const
 {
     return d_sendBufferSize;
@@ -783,6 +876,22 @@ bsl::ostream& InterfaceConfig::print(bsl::ostream& stream,
         printer.printAttribute("maxCyclesPerWait", d_maxCyclesPerWait);
     }
 
+    if (!d_busyPollDuration.isNull()) {
+        printer.printAttribute("busyPollDuration", d_busyPollDuration);
+    }
+
+    if (!d_busyPollSockets.isNull()) {
+        printer.printAttribute("busyPollSockets", d_busyPollSockets);
+    }
+
+    if (!d_deferInterestChanges.isNull()) {
+        printer.printAttribute("deferInterestChanges", d_deferInterestChanges);
+    }
+
+    if (!d_devicePerWaiter.isNull()) {
+        printer.printAttribute("devicePerWaiter", d_devicePerWaiter);
+    }
+
     if (!d_maxConnections.isNull()) {
         printer.printAttribute("maxConnections", d_maxConnections);
     }
@@ -845,6 +954,18 @@ bsl::ostream& InterfaceConfig::print(bsl::ostream& stream,
         printer.printAttribute("receiveGreedily", d_receiveGreedily);
     }
 
+    if (!d_sendBudget.isNull()) {
+        printer.printAttribute("sendBudget", d_sendBudget);
+    }
+
+    if (!d_receiveBudget.isNull()) {
+        printer.printAttribute("receiveBudget", d_receiveBudget);
+    }
+
+    if (!d_receiveCopyThreshold.isNull()) {
+        printer.printAttribute("receiveCopyThreshold", d_receiveCopyThreshold);
+    }
+
     if (!d_sendBufferSize.isNull()) {
         printer.printAttribute("sendBufferSize", d_sendBufferSize);
     }
@@ -95,6 +95,43 @@ namespace ntca {
 /// from being able to process socket events that actually have occurred. The
 /// default value is null, indicating that only one cycle is performed.
 ///
+/// @li @b busyPollDuration:
+/// The maximum duration for which a thread waiting for events repeatedly
+/// polls for events without blocking before falling back to blocking until
+/// events occur. The effective duration adapts between zero and this maximum
+/// according to whether events recently arrived while polling. Polling trades
+/// processor time for lower latency, as an event that arrives while polling
+/// does not incur the cost of waking up a blocked thread. The default value
+/// is null, indicating that threads immediately block when no events are
+/// pending.
+///
+/// @li @b busyPollSockets:
+/// The flag that indicates each socket should also be configured to allow
+/// the kernel to busy poll the network device queue when the socket has no
+/// data available, for the busy poll duration. This option is only
+/// effective for reactors on Linux when a busy poll duration is defined. The
+/// default value is null, indicating sockets are not configured to allow busy
+/// polling by the kernel.
+///
+/// @li @b deferInterestChanges:
+/// The flag that indicates changes to the interest in the events of a socket
+/// made by the thread waiting on a reactor are accumulated and applied to the
+/// device once per wait, so that several changes to the interest in the same
+/// socket cost at most one system call. Changes made by other threads are
+/// always applied immediately. This option is only effective for reactors
+/// driven by a single thread. The default value is null, indicating changes
+/// are applied immediately.
+///
+/// @li @b devicePerWaiter:
+/// The flag that indicates each thread waiting on a reactor polls its own
+/// device, each socket is bound to the device of one thread, and only
+/// listening sockets are registered with every device, such that only one
+/// thread is woken up per incoming connection. Since the events of each
+/// socket are only polled by one thread, one-shot mode is no longer required
+/// to prevent the concurrent processing of those events. This option is only
+/// effective for reactors driven by multiple threads. The default value is
+/// null, indicating all threads waiting on a reactor poll the same device.
+///
 /// @li @b maxConnections:
 /// The maximum number of supported simultaneous connections.
 ///
@@ -170,6 +207,37 @@ namespace ntca {
 /// throughput and latency over all connections, and the expense of higher
 /// average latency and lower average throughput.
 ///
+/// @li @b sendBudget:
+/// The maximum number of bytes copied from the write queue to the socket send
+/// buffer each time the operating system indicates the send buffer has
+/// capacity available, when sending greedily. Once the budget is exhausted,
+/// the socket yields to the other sockets driven by the same reactor and the
+/// remainder is sent after the reactor processes the rest of the events
+/// detected in its current wait cycle, without waiting for the operating
+/// system to indicate the socket is writable again. The default value is
+/// null, indicating the amount of data sent greedily is unlimited.
+///
+/// @li @b receiveBudget:
+/// The maximum number of bytes copied from the socket receive buffer to the
+/// read queue each time the operating system indicates the receive buffer is
+/// non-empty, when receiving greedily. Once the budget is exhausted, the
+/// socket yields to the other sockets driven by the same reactor and the
+/// remainder is received after the reactor processes the rest of the events
+/// detected in its current wait cycle, without waiting for the operating
+/// system to indicate the socket is readable again. The default value is
+/// null, indicating the amount of data received greedily is unlimited.
+///
+/// @li @b receiveCopyThreshold:
+/// The maximum number of bytes suggested to be copied from the socket receive
+/// buffer, as adapted to the amount of data actually received, at or below
+/// which data is first copied from the socket receive buffer into a buffer
+/// shared by all sockets driven by the same thread, then only the number of
+/// bytes actually received is copied into the read queue. This avoids
+/// reserving read queue capacity before each receive, which otherwise remains
+/// allocated while a connection is mostly idle, at the cost of an additional
+/// copy of small amounts of data. The default value is null, indicating data
+/// is always copied directly into the read queue.
+///
 /// @li @b sendBufferSize:
 /// The maximum size of each socket send buffer. On some platforms, this
 /// options may serve simply as a hint.
@@ -314,6 +382,11 @@ class InterfaceConfig
     bdlb::NullableValue<bsl::size_t> d_maxTimersPerWait;
     bdlb::NullableValue<bsl::size_t> d_maxCyclesPerWait;
 
+    bdlb::NullableValue<bsls::TimeInterval> d_busyPollDuration;
+    bdlb::NullableValue<bool> d_busyPollSockets;
+    bdlb::NullableValue<bool> d_deferInterestChanges;
+    bdlb::NullableValue<bool> d_devicePerWaiter;
+
     bdlb::NullableValue<bsl::size_t> d_maxConnections;
 
     bdlb::NullableValue<bsl::size_t> d_backlog;
@@ -330,6 +403,9 @@ class InterfaceConfig
     bdlb::NullableValue<bool> d_acceptGreedily;
     bdlb::NullableValue<bool> d_sendGreedily;
     bdlb::NullableValue<bool> d_receiveGreedily;
+    bdlb::NullableValue<bsl::size_t> d_sendBudget;
+    bdlb::NullableValue<bsl::size_t> d_receiveBudget;
+    bdlb::NullableValue<bsl::size_t> d_receiveCopyThreshold;
 
     bdlb::NullableValue<bsl::size_t> d_sendBufferSize;
     bdlb::NullableValue<bsl::size_t> d_receiveBufferSize;
@@ -426,6 +502,24 @@ class InterfaceConfig
     /// 'value'.
     void setMaxCyclesPerWait(bsl::size_t value);
 
+    /// Set the maximum duration for which a thread waiting for events polls
+    /// for events without blocking to the specified 'value'.
+    void setBusyPollDuration(const bsls::TimeInterval& value);
+
+    /// Set the flag that indicates each socket should be configured to allow
+    /// the kernel to busy poll the network device queue to the specified
+    /// 'value'.
+    void setBusyPollSockets(bool value);
+
+    /// Set the flag that indicates changes to the interest in the events of
+    /// a socket made by the thread waiting on a reactor are deferred and
+    /// applied once per wait to the specified 'value'.
+    void setDeferInterestChanges(bool value);
+
+    /// Set the flag that indicates each thread waiting on a reactor polls
+    /// its own device to the specified 'value'.
+    void setDevicePerWaiter(bool value);
+
     /// Set the maximum number of concurrently supported connections to
     /// the specified 'value'.
     void setMaxConnections(bsl::size_t value);
@@ -468,6 +562,20 @@ class InterfaceConfig
     /// Set the flag that controls greedy receives to the specified 'value'.
     void setReceiveGreedily(bool value);
 
+    /// Set the maximum number of bytes sent greedily each time the socket
+    /// is writable to the specified 'value'.
+    void setSendBudget(bsl::size_t value);
+
+    /// Set the maximum number of bytes received greedily each time the
+    /// socket is readable to the specified 'value'.
+    void setReceiveBudget(bsl::size_t value);
+
+    /// Set the maximum number of bytes suggested to be copied from the
+    /// receive buffer at or below which data is received through a buffer
+    /// shared by all sockets driven by the same thread to the specified
+    /// 'value'.
+    void setReceiveCopyThreshold(bsl::size_t value);
+
     /// Set the maximum size of the send buffer to the specified 'value'.
     void setSendBufferSize(bsl::size_t value);
 
@@ -618,6 +726,24 @@ class InterfaceConfig
     /// null, only one cycle is performed.
     const bdlb::NullableValue<bsl::size_t>& maxCyclesPerWait() const;
 
+    /// Return the maximum duration for which a thread waiting for events
+    /// polls for events without blocking. If the value is null, threads
+    /// immediately block when no events are pending.
+    const bdlb::NullableValue<bsls::TimeInterval>& busyPollDuration() const;
+
+    /// Return the flag that indicates each socket should be configured to
+    /// allow the kernel to busy poll the network device queue.
+    const bdlb::NullableValue<bool>& busyPollSockets() const;
+
+    /// Return the flag that indicates changes to the interest in the events
+    /// of a socket made by the thread waiting on a reactor are deferred and
+    /// applied once per wait.
+    const bdlb::NullableValue<bool>& deferInterestChanges() const;
+
+    /// Return the flag that indicates each thread waiting on a reactor
+    /// polls its own device.
+    const bdlb::NullableValue<bool>& devicePerWaiter() const;
+
     /// Return the maximum number of concurrently supported connections.
     const bdlb::NullableValue<bsl::size_t>& maxConnections() const;
 
@@ -661,6 +787,19 @@ class InterfaceConfig
     /// Return the flag that controls greedy receives.
     const bdlb::NullableValue<bool>& receiveGreedily() const;
 
+    /// Return the maximum number of bytes sent greedily each time the socket
+    /// is writable.
+    const bdlb::NullableValue<bsl::size_t>& sendBudget() const;
+
+    /// Return the maximum number of bytes received greedily each time the
+    /// socket is readable.
+    const bdlb::NullableValue<bsl::size_t>& receiveBudget() const;
+
+    /// Return the maximum number of bytes suggested to be copied from the
+    /// receive buffer at or below which data is received through a buffer
+    /// shared by all sockets driven by the same thread.
+    const bdlb::NullableValue<bsl::size_t>& receiveCopyThreshold() const;
+
     /// Return the maximum size of the send buffer.
     const bdlb::NullableValue<bsl::size_t>& sendBufferSize() const;
 
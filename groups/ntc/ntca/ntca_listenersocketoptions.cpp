@@ -45,6 +45,10 @@ ListenerSocketOptions::ListenerSocketOptions()
 , d_acceptGreedily()
 , d_sendGreedily()
 , d_receiveGreedily()
+, d_sendBudget()
+, d_receiveBudget()
+, d_receiveCopyThreshold()
+, d_receiveForeignHandles()
 , d_sendBufferSize()
 , d_receiveBufferSize()
 , d_sendBufferLowWatermark()
@@ -85,6 +89,10 @@ ListenerSocketOptions::ListenerSocketOptions(
 , d_acceptGreedily(other.d_acceptGreedily)
 , d_sendGreedily(other.d_sendGreedily)
 , d_receiveGreedily(other.d_receiveGreedily)
+, d_sendBudget(other.d_sendBudget)
+, d_receiveBudget(other.d_receiveBudget)
+, d_receiveCopyThreshold(other.d_receiveCopyThreshold)
+, d_receiveForeignHandles(other.d_receiveForeignHandles)
 , d_sendBufferSize(other.d_sendBufferSize)
 , d_receiveBufferSize(other.d_receiveBufferSize)
 , d_sendBufferLowWatermark(other.d_sendBufferLowWatermark)
@@ -133,6 +141,10 @@ ListenerSocketOptions& ListenerSocketOptions::operator=(
         d_acceptGreedily            = other.d_acceptGreedily;
         d_sendGreedily              = other.d_sendGreedily;
         d_receiveGreedily           = other.d_receiveGreedily;
+        d_sendBudget                = other.d_sendBudget;
+        d_receiveBudget             = other.d_receiveBudget;
+        d_receiveCopyThreshold      = other.d_receiveCopyThreshold;
+        d_receiveForeignHandles     = other.d_receiveForeignHandles;
         d_sendBufferSize            = other.d_sendBufferSize;
         d_receiveBufferSize         = other.d_receiveBufferSize;
         d_sendBufferLowWatermark    = other.d_sendBufferLowWatermark;
@@ -236,6 +248,26 @@ void ListenerSocketOptions::setReceiveGreedily(bool value)
     d_receiveGreedily = value;
 }
 
+void ListenerSocketOptions::setSendBudget(bsl::size_t value)
+{
+    d_sendBudget = value;
+}
+
+void ListenerSocketOptions::setReceiveBudget(bsl::size_t value)
+{
+    d_receiveBudget = value;
+}
+
+void ListenerSocketOptions::setReceiveCopyThreshold(bsl::size_t value)
+{
+    d_receiveCopyThreshold = value;
+}
+
+void ListenerSocketOptions::setReceiveForeignHandles(bool value)
+{
+    d_receiveForeignHandles = value;
+}
+
 void ListenerSocketOptions::setSendBufferSize(bsl::size_t value)
 {
     d_sendBufferSize = value;
@@ -421,6 +453,30 @@ const bdlb::NullableValue<bool>& ListenerSocketOptions::receiveGreedily() const
     return d_receiveGreedily;
 }
 
+const bdlb::NullableValue<bsl::size_t>& ListenerSocketOptions::sendBudget()
+    const
+{
+    return d_sendBudget;
+}
+
+const bdlb::NullableValue<bsl::size_t>& ListenerSocketOptions::receiveBudget()
+    const
+{
+    return d_receiveBudget;
+}
+
+const bdlb::NullableValue<bsl::size_t>& ListenerSocketOptions::
+    receiveCopyThreshold() const
+{
+    return d_receiveCopyThreshold;
+}
+
+const bdlb::NullableValue<bool>& ListenerSocketOptions::
+    receiveForeignHandles() const
+{
+    return d_receiveForeignHandles;
+}
+
 const bdlb::NullableValue<bsl::size_t>& ListenerSocketOptions::sendBufferSize()
     const
 {
@@ -557,6 +613,10 @@ bsl::ostream& ListenerSocketOptions::print(bsl::ostream& stream,
     printer.printAttribute("acceptGreedily", d_acceptGreedily);
     printer.printAttribute("sendGreedily", d_sendGreedily);
     printer.printAttribute("receiveGreedily", d_receiveGreedily);
+    printer.printAttribute("sendBudget", d_sendBudget);
+    printer.printAttribute("receiveBudget", d_receiveBudget);
+    printer.printAttribute("receiveCopyThreshold", d_receiveCopyThreshold);
+    printer.printAttribute("receiveForeignHandles", d_receiveForeignHandles);
     printer.printAttribute("sendBufferSize", d_sendBufferSize);
     printer.printAttribute("receiveBufferSize", d_receiveBufferSize);
     printer.printAttribute("sendBufferLowWatermark", d_sendBufferLowWatermark);
@@ -599,6 +659,10 @@ bool operator==(const ListenerSocketOptions& lhs,
            lhs.acceptGreedily() == rhs.acceptGreedily() &&
            lhs.sendGreedily() == rhs.sendGreedily() &&
            lhs.receiveGreedily() == rhs.receiveGreedily() &&
+           lhs.sendBudget() == rhs.sendBudget() &&
+           lhs.receiveBudget() == rhs.receiveBudget() &&
+           lhs.receiveCopyThreshold() == rhs.receiveCopyThreshold() &&
+           lhs.receiveForeignHandles() == rhs.receiveForeignHandles() &&
            lhs.sendBufferSize() == rhs.sendBufferSize() &&
            lhs.receiveBufferSize() == rhs.receiveBufferSize() &&
            lhs.sendBufferLowWatermark() == rhs.sendBufferLowWatermark() &&
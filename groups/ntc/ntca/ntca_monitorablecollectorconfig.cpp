@@ -27,6 +27,9 @@ MonitorableCollectorConfig::MonitorableCollectorConfig(
     bslma::Allocator* basicAllocator)
 : d_threadName(basicAllocator)
 , d_period()
+, d_maxObjects()
+, d_rankingField(basicAllocator)
+, d_suppressInactive()
 {
 }
 
@@ -35,6 +38,9 @@ MonitorableCollectorConfig::MonitorableCollectorConfig(
     bslma::Allocator*                 basicAllocator)
 : d_threadName(original.d_threadName, basicAllocator)
 , d_period(original.d_period)
+, d_maxObjects(original.d_maxObjects)
+, d_rankingField(original.d_rankingField, basicAllocator)
+, d_suppressInactive(original.d_suppressInactive)
 {
 }
 
@@ -46,8 +52,11 @@ MonitorableCollectorConfig& MonitorableCollectorConfig::operator=(
     const MonitorableCollectorConfig& other)
 {
     if (this != &other) {
-        d_threadName = other.d_threadName;
-        d_period     = other.d_period;
+        d_threadName       = other.d_threadName;
+        d_period           = other.d_period;
+        d_maxObjects       = other.d_maxObjects;
+        d_rankingField     = other.d_rankingField;
+        d_suppressInactive = other.d_suppressInactive;
     }
 
     return *this;
@@ -57,6 +66,9 @@ void MonitorableCollectorConfig::reset()
 {
     d_threadName.reset();
     d_period.reset();
+    d_maxObjects.reset();
+    d_rankingField.reset();
+    d_suppressInactive.reset();
 }
 
 void MonitorableCollectorConfig::setThreadName(const bsl::string& value)
@@ -69,6 +81,21 @@ void MonitorableCollectorConfig::setPeriod(bsl::size_t value)
     d_period = value;
 }
 
+void MonitorableCollectorConfig::setMaxObjects(bsl::size_t value)
+{
+    d_maxObjects = value;
+}
+
+void MonitorableCollectorConfig::setRankingField(const bsl::string& value)
+{
+    d_rankingField = value;
+}
+
+void MonitorableCollectorConfig::setSuppressInactive(bool value)
+{
+    d_suppressInactive = value;
+}
+
 const bdlb::NullableValue<bsl::string>& MonitorableCollectorConfig::
     threadName() const
 {
@@ -81,10 +108,31 @@ const bdlb::NullableValue<bsl::size_t>& MonitorableCollectorConfig::period()
     return d_period;
 }
 
+const bdlb::NullableValue<bsl::size_t>& MonitorableCollectorConfig::
+    maxObjects() const
+{
+    return d_maxObjects;
+}
+
+const bdlb::NullableValue<bsl::string>& MonitorableCollectorConfig::
+    rankingField() const
+{
+    return d_rankingField;
+}
+
+const bdlb::NullableValue<bool>& MonitorableCollectorConfig::
+    suppressInactive() const
+{
+    return d_suppressInactive;
+}
+
 bool MonitorableCollectorConfig::equals(
     const MonitorableCollectorConfig& other) const
 {
-    return d_threadName == other.d_threadName && d_period == other.d_period;
+    return d_threadName == other.d_threadName && d_period == other.d_period &&
+           d_maxObjects == other.d_maxObjects &&
+           d_rankingField == other.d_rankingField &&
+           d_suppressInactive == other.d_suppressInactive;
 }
 
 bsl::ostream& MonitorableCollectorConfig::print(bsl::ostream& stream,
@@ -95,6 +143,9 @@ bsl::ostream& MonitorableCollectorConfig::print(bsl::ostream& stream,
     printer.start();
     printer.printAttribute("threadName", d_threadName);
     printer.printAttribute("period", d_period);
+    printer.printAttribute("maxObjects", d_maxObjects);
+    printer.printAttribute("rankingField", d_rankingField);
+    printer.printAttribute("suppressInactive", d_suppressInactive);
     printer.end();
     return stream;
 }
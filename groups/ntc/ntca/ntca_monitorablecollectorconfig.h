@@ -40,6 +40,31 @@ namespace ntca {
 /// indicating that monitorable objects are never automatically and
 /// periodically collected; collection must be performed explicitly.
 ///
+/// @li @b maxObjects:
+/// The maximum number of monitorable objects whose statistics are published
+/// during each collection. When more monitorable objects are registered, only
+/// a subset of them is published: either those ranked highest by the
+/// 'rankingField', if defined, or otherwise a window of objects that advances
+/// at each collection so that each object is eventually published. The
+/// default value is null, indicating the statistics of all monitorable objects
+/// are published during each collection.
+///
+/// @li @b rankingField:
+/// The name of the field by which monitorable objects are ranked when the
+/// number of registered monitorable objects exceeds the 'maxObjects'. Only
+/// the objects having the largest values of this field are published. Note
+/// that the statistics of each object must be collected to be ranked, so the
+/// cost of the collection remains proportional to the number of objects, but
+/// the memory required remains proportional to the 'maxObjects'. The default
+/// value is null, indicating that the published objects are sampled instead.
+///
+/// @li @b suppressInactive:
+/// The flag that indicates the statistics of monitorable objects that have
+/// measured no activity since the previous collection are not published. An
+/// object has measured no activity if each of its statistics is either null or
+/// a sum of zero. The default value is null, indicating the statistics of
+/// inactive objects are published.
+///
 /// @par Thread Safety
 /// This class is not thread safe.
 ///
@@ -48,6 +73,9 @@ class MonitorableCollectorConfig
 {
     bdlb::NullableValue<bsl::string> d_threadName;
     bdlb::NullableValue<bsl::size_t> d_period;
+    bdlb::NullableValue<bsl::size_t> d_maxObjects;
+    bdlb::NullableValue<bsl::string> d_rankingField;
+    bdlb::NullableValue<bool>        d_suppressInactive;
 
   public:
     /// Create a new monitorable object collector configuration. Optionally
@@ -84,6 +112,20 @@ class MonitorableCollectorConfig
     /// and periodically collected to the specified 'value', in seconds.
     void setPeriod(bsl::size_t value);
 
+    /// Set the maximum number of monitorable objects whose statistics are
+    /// published during each collection to the specified 'value'.
+    void setMaxObjects(bsl::size_t value);
+
+    /// Set the name of the field by which monitorable objects are ranked
+    /// when more than the maximum number of monitorable objects are
+    /// registered to the specified 'value'.
+    void setRankingField(const bsl::string& value);
+
+    /// Set the flag that indicates the statistics of monitorable objects
+    /// that have measured no activity since the previous collection are not
+    /// published to the specified 'value'.
+    void setSuppressInactive(bool value);
+
     /// Return the name of the thread that automatically and periodically
     /// collects monitorable objects.
     const bdlb::NullableValue<bsl::string>& threadName() const;
@@ -92,6 +134,20 @@ class MonitorableCollectorConfig
     /// and periodically collected, in seconds.
     const bdlb::NullableValue<bsl::size_t>& period() const;
 
+    /// Return the maximum number of monitorable objects whose statistics
+    /// are published during each collection.
+    const bdlb::NullableValue<bsl::size_t>& maxObjects() const;
+
+    /// Return the name of the field by which monitorable objects are ranked
+    /// when more than the maximum number of monitorable objects are
+    /// registered.
+    const bdlb::NullableValue<bsl::string>& rankingField() const;
+
+    /// Return the flag that indicates the statistics of monitorable objects
+    /// that have measured no activity since the previous collection are not
+    /// published.
+    const bdlb::NullableValue<bool>& suppressInactive() const;
+
     /// Return true if this object has the same value as the specified
     /// 'other' object, otherwise return false.
     bool equals(const MonitorableCollectorConfig& other) const;
@@ -32,6 +32,8 @@ ProactorConfig::ProactorConfig(bslma::Allocator* basicAllocator)
 , d_maxEventsPerWait()
 , d_maxTimersPerWait()
 , d_maxCyclesPerWait()
+, d_busyPollDuration()
+, d_busyPollSockets()
 , d_metricCollection()
 , d_metricCollectionPerWaiter()
 , d_metricCollectionPerSocket()
@@ -48,6 +50,8 @@ ProactorConfig::ProactorConfig(const ProactorConfig& original,
 , d_maxEventsPerWait(original.d_maxEventsPerWait)
 , d_maxTimersPerWait(original.d_maxTimersPerWait)
 , d_maxCyclesPerWait(original.d_maxCyclesPerWait)
+, d_busyPollDuration(original.d_busyPollDuration)
+, d_busyPollSockets(original.d_busyPollSockets)
 , d_metricCollection(original.d_metricCollection)
 , d_metricCollectionPerWaiter(original.d_metricCollectionPerWaiter)
 , d_metricCollectionPerSocket(original.d_metricCollectionPerSocket)
@@ -69,6 +73,8 @@ ProactorConfig& ProactorConfig::operator=(const ProactorConfig& other)
         d_maxEventsPerWait          = other.d_maxEventsPerWait;
         d_maxTimersPerWait          = other.d_maxTimersPerWait;
         d_maxCyclesPerWait          = other.d_maxCyclesPerWait;
+        d_busyPollDuration          = other.d_busyPollDuration;
+        d_busyPollSockets           = other.d_busyPollSockets;
         d_metricCollection          = other.d_metricCollection;
         d_metricCollectionPerWaiter = other.d_metricCollectionPerWaiter;
         d_metricCollectionPerSocket = other.d_metricCollectionPerSocket;
@@ -87,6 +93,8 @@ void ProactorConfig::reset()
     d_maxEventsPerWait.reset();
     d_maxTimersPerWait.reset();
     d_maxCyclesPerWait.reset();
+    d_busyPollDuration.reset();
+    d_busyPollSockets.reset();
     d_metricCollection.reset();
     d_metricCollectionPerWaiter.reset();
     d_metricCollectionPerSocket.reset();
@@ -132,6 +140,16 @@ void ProactorConfig::setMaxCyclesPerWait(bsl::size_t value)
     d_maxCyclesPerWait = value;
 }
 
+void ProactorConfig::setBusyPollDuration(const bsls::TimeInterval& value)
+{
+    d_busyPollDuration = value;
+}
+
+void ProactorConfig::setBusyPollSockets(bool value)
+{
+    d_busyPollSockets = value;
+}
+
 void ProactorConfig::setMetricCollection(bool value)
 {
     d_metricCollection = value;
@@ -191,6 +209,17 @@ const bdlb::NullableValue<bsl::size_t>& ProactorConfig::maxCyclesPerWait()
     return d_maxCyclesPerWait;
 }
 
+const bdlb::NullableValue<bsls::TimeInterval>&
+ProactorConfig::busyPollDuration() const
+{
+    return d_busyPollDuration;
+}
+
+const bdlb::NullableValue<bool>& ProactorConfig::busyPollSockets() const
+{
+    return d_busyPollSockets;
+}
+
 const bdlb::NullableValue<bool>& ProactorConfig::metricCollection() const
 {
     return d_metricCollection;
@@ -218,6 +247,8 @@ bool ProactorConfig::equals(const ProactorConfig& other) const
            d_maxEventsPerWait == other.d_maxEventsPerWait &&
            d_maxTimersPerWait == other.d_maxTimersPerWait &&
            d_maxCyclesPerWait == other.d_maxCyclesPerWait &&
+           d_busyPollDuration == other.d_busyPollDuration &&
+           d_busyPollSockets == other.d_busyPollSockets &&
            d_metricCollection == other.d_metricCollection &&
            d_metricCollectionPerWaiter == other.d_metricCollectionPerWaiter &&
            d_metricCollectionPerSocket == other.d_metricCollectionPerSocket;
@@ -281,6 +312,22 @@ bool ProactorConfig::less(const ProactorConfig& other) const
         return false;
     }
 
+    if (d_busyPollDuration < other.d_busyPollDuration) {
+        return true;
+    }
+
+    if (other.d_busyPollDuration < d_busyPollDuration) {
+        return false;
+    }
+
+    if (d_busyPollSockets < other.d_busyPollSockets) {
+        return true;
+    }
+
+    if (other.d_busyPollSockets < d_busyPollSockets) {
+        return false;
+    }
+
     if (d_metricCollection < other.d_metricCollection) {
         return true;
     }
@@ -314,6 +361,8 @@ bsl::ostream& ProactorConfig::print(bsl::ostream& stream,
     printer.printAttribute("maxEventsPerWait", d_maxEventsPerWait);
     printer.printAttribute("maxTimersPerWait", d_maxTimersPerWait);
     printer.printAttribute("maxCyclesPerWait", d_maxCyclesPerWait);
+    printer.printAttribute("busyPollDuration", d_busyPollDuration);
+    printer.printAttribute("busyPollSockets", d_busyPollSockets);
     printer.printAttribute("metricCollection", d_metricCollection);
     printer.printAttribute("metricCollectionPerWaiter",
                            d_metricCollectionPerWaiter);
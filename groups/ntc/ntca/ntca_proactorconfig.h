@@ -24,6 +24,7 @@ BSLS_IDENT("$Id: $")
 #include <ntcscm_version.h>
 #include <bdlb_nullablevalue.h>
 #include <bslh_hash.h>
+#include <bsls_timeinterval.h>
 #include <bsl_iosfwd.h>
 #include <bsl_string.h>
 
@@ -67,6 +68,24 @@ namespace ntca {
 /// from being able to process socket events that actually have occurred. The
 /// default value is null, indicating that only one cycle is performed.
 ///
+/// @li @b busyPollDuration:
+/// The maximum duration for which a thread waiting for events repeatedly
+/// polls for events without blocking before falling back to blocking until
+/// events occur. The effective duration adapts between zero and this maximum
+/// according to whether events recently arrived while polling. Polling trades
+/// processor time for lower latency, as an event that arrives while polling
+/// does not incur the cost of waking up a blocked thread. The default value
+/// is null, indicating that threads immediately block when no events are
+/// pending.
+///
+/// @li @b busyPollSockets:
+/// The flag that indicates each socket should also be configured to allow
+/// the kernel to busy poll the network device queue when the socket has no
+/// data available, for the busy poll duration. This option is only
+/// effective for reactors on Linux when a busy poll duration is defined. The
+/// default value is null, indicating sockets are not configured to allow busy
+/// polling by the kernel.
+///
 /// @li @b metricCollection:
 /// The flag that indicates the collection of metrics is enabled or disabled.
 ///
@@ -92,6 +111,8 @@ class ProactorConfig
     bdlb::NullableValue<bsl::size_t>           d_maxEventsPerWait;
     bdlb::NullableValue<bsl::size_t>           d_maxTimersPerWait;
     bdlb::NullableValue<bsl::size_t>           d_maxCyclesPerWait;
+    bdlb::NullableValue<bsls::TimeInterval>    d_busyPollDuration;
+    bdlb::NullableValue<bool>                  d_busyPollSockets;
     bdlb::NullableValue<bool>                  d_metricCollection;
     bdlb::NullableValue<bool>                  d_metricCollectionPerWaiter;
     bdlb::NullableValue<bool>                  d_metricCollectionPerSocket;
@@ -163,6 +184,15 @@ class ProactorConfig
     /// 'value'.
     void setMaxCyclesPerWait(bsl::size_t value);
 
+    /// Set the maximum duration for which a thread waiting for events polls
+    /// for events without blocking to the specified 'value'.
+    void setBusyPollDuration(const bsls::TimeInterval& value);
+
+    /// Set the flag that indicates each socket should be configured to allow
+    /// the kernel to busy poll the network device queue to the specified
+    /// 'value'.
+    void setBusyPollSockets(bool value);
+
     /// Set the collection of metrics to be enabled or disabled according
     /// to the specified 'value'.
     void setMetricCollection(bool value);
@@ -209,6 +239,15 @@ class ProactorConfig
     /// null, only one cycle is performed.
     const bdlb::NullableValue<bsl::size_t>& maxCyclesPerWait() const;
 
+    /// Return the maximum duration for which a thread waiting for events
+    /// polls for events without blocking. If the value is null, threads
+    /// immediately block when no events are pending.
+    const bdlb::NullableValue<bsls::TimeInterval>& busyPollDuration() const;
+
+    /// Return the flag that indicates each socket should be configured to
+    /// allow the kernel to busy poll the network device queue.
+    const bdlb::NullableValue<bool>& busyPollSockets() const;
+
     /// Return the flag that indicates the collection of metrics is enabled
     /// or disabled.
     const bdlb::NullableValue<bool>& metricCollection() const;
@@ -293,6 +332,8 @@ void hashAppend(HASH_ALGORITHM& algorithm, const ProactorConfig& value)
     hashAppend(algorithm, value.maxEventsPerWait());
     hashAppend(algorithm, value.maxTimersPerWait());
     hashAppend(algorithm, value.maxCyclesPerWait());
+    hashAppend(algorithm, value.busyPollDuration());
+    hashAppend(algorithm, value.busyPollSockets());
     hashAppend(algorithm, value.metricCollection());
     hashAppend(algorithm, value.metricCollectionPerWaiter());
     hashAppend(algorithm, value.metricCollectionPerSocket());
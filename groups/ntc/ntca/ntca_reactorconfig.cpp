@@ -32,6 +32,10 @@ ReactorConfig::ReactorConfig(bslma::Allocator* basicAllocator)
 , d_maxEventsPerWait()
 , d_maxTimersPerWait()
 , d_maxCyclesPerWait()
+, d_busyPollDuration()
+, d_busyPollSockets()
+, d_deferInterestChanges()
+, d_devicePerWaiter()
 , d_metricCollection()
 , d_metricCollectionPerWaiter()
 , d_metricCollectionPerSocket()
@@ -52,6 +56,10 @@ ReactorConfig::ReactorConfig(const ReactorConfig& original,
 , d_maxEventsPerWait(original.d_maxEventsPerWait)
 , d_maxTimersPerWait(original.d_maxTimersPerWait)
 , d_maxCyclesPerWait(original.d_maxCyclesPerWait)
+, d_busyPollDuration(original.d_busyPollDuration)
+, d_busyPollSockets(original.d_busyPollSockets)
+, d_deferInterestChanges(original.d_deferInterestChanges)
+, d_devicePerWaiter(original.d_devicePerWaiter)
 , d_metricCollection(original.d_metricCollection)
 , d_metricCollectionPerWaiter(original.d_metricCollectionPerWaiter)
 , d_metricCollectionPerSocket(original.d_metricCollectionPerSocket)
@@ -77,6 +85,10 @@ ReactorConfig& ReactorConfig::operator=(const ReactorConfig& other)
         d_maxEventsPerWait          = other.d_maxEventsPerWait;
         d_maxTimersPerWait          = other.d_maxTimersPerWait;
         d_maxCyclesPerWait          = other.d_maxCyclesPerWait;
+        d_busyPollDuration          = other.d_busyPollDuration;
+        d_busyPollSockets           = other.d_busyPollSockets;
+        d_deferInterestChanges      = other.d_deferInterestChanges;
+        d_devicePerWaiter           = other.d_devicePerWaiter;
         d_metricCollection          = other.d_metricCollection;
         d_metricCollectionPerWaiter = other.d_metricCollectionPerWaiter;
         d_metricCollectionPerSocket = other.d_metricCollectionPerSocket;
@@ -99,6 +111,10 @@ void ReactorConfig::reset()
     d_maxEventsPerWait.reset();
     d_maxTimersPerWait.reset();
     d_maxCyclesPerWait.reset();
+    d_busyPollDuration.reset();
+    d_busyPollSockets.reset();
+    d_deferInterestChanges.reset();
+    d_devicePerWaiter.reset();
     d_metricCollection.reset();
     d_metricCollectionPerWaiter.reset();
     d_metricCollectionPerSocket.reset();
@@ -148,6 +164,26 @@ void ReactorConfig::setMaxCyclesPerWait(bsl::size_t value)
     d_maxCyclesPerWait = value;
 }
 
+void ReactorConfig::setBusyPollDuration(const bsls::TimeInterval& value)
+{
+    d_busyPollDuration = value;
+}
+
+void ReactorConfig::setBusyPollSockets(bool value)
+{
+    d_busyPollSockets = value;
+}
+
+void ReactorConfig::setDeferInterestChanges(bool value)
+{
+    d_deferInterestChanges = value;
+}
+
+void ReactorConfig::setDevicePerWaiter(bool value)
+{
+    d_devicePerWaiter = value;
+}
+
 void ReactorConfig::setMetricCollection(bool value)
 {
     d_metricCollection = value;
@@ -224,6 +260,27 @@ const bdlb::NullableValue<bsl::size_t>& ReactorConfig::maxCyclesPerWait() const
     return d_maxCyclesPerWait;
 }
 
+const bdlb::NullableValue<bsls::TimeInterval>&
+ReactorConfig::busyPollDuration() const
+{
+    return d_busyPollDuration;
+}
+
+const bdlb::NullableValue<bool>& ReactorConfig::busyPollSockets() const
+{
+    return d_busyPollSockets;
+}
+
+const bdlb::NullableValue<bool>& ReactorConfig::deferInterestChanges() const
+{
+    return d_deferInterestChanges;
+}
+
+const bdlb::NullableValue<bool>& ReactorConfig::devicePerWaiter() const
+{
+    return d_devicePerWaiter;
+}
+
 const bdlb::NullableValue<bool>& ReactorConfig::metricCollection() const
 {
     return d_metricCollection;
@@ -272,6 +329,10 @@ bool ReactorConfig::equals(const ReactorConfig& other) const
            d_maxEventsPerWait == other.d_maxEventsPerWait &&
            d_maxTimersPerWait == other.d_maxTimersPerWait &&
            d_maxCyclesPerWait == other.d_maxCyclesPerWait &&
+           d_busyPollDuration == other.d_busyPollDuration &&
+           d_busyPollSockets == other.d_busyPollSockets &&
+           d_deferInterestChanges == other.d_deferInterestChanges &&
+           d_devicePerWaiter == other.d_devicePerWaiter &&
            d_metricCollection == other.d_metricCollection &&
            d_metricCollectionPerWaiter == other.d_metricCollectionPerWaiter &&
            d_metricCollectionPerSocket == other.d_metricCollectionPerSocket &&
@@ -346,6 +407,38 @@ bool ReactorConfig::less(const ReactorConfig& other) const
         return false;
     }
 
+    if (d_busyPollDuration < other.d_busyPollDuration) {
+        return true;
+    }
+
+    if (other.d_busyPollDuration < d_busyPollDuration) {
+        return false;
+    }
+
+    if (d_busyPollSockets < other.d_busyPollSockets) {
+        return true;
+    }
+
+    if (other.d_busyPollSockets < d_busyPollSockets) {
+        return false;
+    }
+
+    if (d_deferInterestChanges < other.d_deferInterestChanges) {
+        return true;
+    }
+
+    if (other.d_deferInterestChanges < d_deferInterestChanges) {
+        return false;
+    }
+
+    if (d_devicePerWaiter < other.d_devicePerWaiter) {
+        return true;
+    }
+
+    if (other.d_devicePerWaiter < d_devicePerWaiter) {
+        return false;
+    }
+
     if (d_metricCollection < other.d_metricCollection) {
         return true;
     }
@@ -411,6 +504,10 @@ bsl::ostream& ReactorConfig::print(bsl::ostream& stream,
     printer.printAttribute("maxEventsPerWait", d_maxEventsPerWait);
     printer.printAttribute("maxTimersPerWait", d_maxTimersPerWait);
     printer.printAttribute("maxCyclesPerWait", d_maxCyclesPerWait);
+    printer.printAttribute("busyPollDuration", d_busyPollDuration);
+    printer.printAttribute("busyPollSockets", d_busyPollSockets);
+    printer.printAttribute("deferInterestChanges", d_deferInterestChanges);
+    printer.printAttribute("devicePerWaiter", d_devicePerWaiter);
     printer.printAttribute("metricCollection", d_metricCollection);
     printer.printAttribute("metricCollectionPerWaiter",
                            d_metricCollectionPerWaiter);
@@ -26,7 +26,9 @@ namespace ntca {
 bool ReceiveContext::equals(const ReceiveContext& other) const
 {
     return (d_endpoint == other.d_endpoint &&
-            d_transport == other.d_transport && d_error == other.d_error);
+            d_transport == other.d_transport &&
+            d_foreignHandleList == other.d_foreignHandleList &&
+            d_error == other.d_error);
 }
 
 bool ReceiveContext::less(const ReceiveContext& other) const
@@ -47,6 +49,14 @@ bool ReceiveContext::less(const ReceiveContext& other) const
         return false;
     }
 
+    if (d_foreignHandleList < other.d_foreignHandleList) {
+        return true;
+    }
+
+    if (other.d_foreignHandleList < d_foreignHandleList) {
+        return false;
+    }
+
     return d_error < other.d_error;
 }
 
@@ -62,6 +72,11 @@ bsl::ostream& ReceiveContext::print(bsl::ostream& stream,
     }
 
     printer.printAttribute("transport", d_transport);
+
+    if (!d_foreignHandleList.empty()) {
+        printer.printAttribute("foreignHandleList", d_foreignHandleList);
+    }
+
     printer.printAttribute("error", d_error);
     printer.end();
     return stream;
@@ -22,11 +22,13 @@ BSLS_IDENT("$Id: $")
 #include <ntccfg_platform.h>
 #include <ntcscm_version.h>
 #include <ntsa_endpoint.h>
+#include <ntsa_handle.h>
 #include <ntsa_error.h>
 #include <ntsa_transport.h>
 #include <bdlb_nullablevalue.h>
 #include <bslh_hash.h>
 #include <bsl_iosfwd.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace ntca {
@@ -43,6 +45,13 @@ namespace ntca {
 /// @li @b transport:
 /// The transport the receiver.
 ///
+/// @li @b foreignHandleList:
+/// The handles passed by the peer along with the data, in the order of the
+/// bytes of the data with which each handle was sent, supported only by
+/// stream sockets in the local (a.k.a. Unix) domain whose receipt of foreign
+/// handles is enabled. Each handle is owned by the receiver, which is
+/// responsible for closing it.
+///
 /// @li @b error:
 /// The error detected when performing the operation.
 ///
@@ -54,6 +63,7 @@ class ReceiveContext
 {
     bdlb::NullableValue<ntsa::Endpoint> d_endpoint;
     ntsa::Transport::Value              d_transport;
+    bsl::vector<ntsa::Handle>           d_foreignHandleList;
     ntsa::Error                         d_error;
 
   public:
@@ -82,6 +92,10 @@ class ReceiveContext
     /// Set the transport of the receiver to the specified 'value'.
     void setTransport(ntsa::Transport::Value value);
 
+    /// Append the specified 'value' to the list of handles passed by the
+    /// peer along with the data.
+    void addForeignHandle(ntsa::Handle value);
+
     /// Set the error detected when performing the operation to the
     /// specified 'value'.
     void setError(const ntsa::Error& value);
@@ -108,6 +122,10 @@ class ReceiveContext
     /// the transport of the receiver.
     ntsa::TransportProtocol::Value transportProtocol() const;
 
+    /// Return the handles passed by the peer along with the data, in the
+    /// order of the bytes of the data with which each handle was sent.
+    const bsl::vector<ntsa::Handle>& foreignHandleList() const;
+
     /// Return the error detected when performing the operation.
     const ntsa::Error& error() const;
 
@@ -175,6 +193,7 @@ NTCCFG_INLINE
 ReceiveContext::ReceiveContext()
 : d_endpoint()
 , d_transport(ntsa::Transport::e_UNDEFINED)
+, d_foreignHandleList()
 , d_error()
 {
 }
@@ -183,6 +202,7 @@ NTCCFG_INLINE
 ReceiveContext::ReceiveContext(const ReceiveContext& original)
 : d_endpoint(original.d_endpoint)
 , d_transport(original.d_transport)
+, d_foreignHandleList(original.d_foreignHandleList)
 , d_error(original.d_error)
 {
 }
@@ -195,9 +215,10 @@ ReceiveContext::~ReceiveContext()
 NTCCFG_INLINE
 ReceiveContext& ReceiveContext::operator=(const ReceiveContext& other)
 {
-    d_endpoint  = other.d_endpoint;
-    d_transport = other.d_transport;
-    d_error     = other.d_error;
+    d_endpoint          = other.d_endpoint;
+    d_transport         = other.d_transport;
+    d_foreignHandleList = other.d_foreignHandleList;
+    d_error             = other.d_error;
     return *this;
 }
 
@@ -206,7 +227,8 @@ void ReceiveContext::reset()
 {
     d_endpoint.reset();
     d_transport = ntsa::Transport::e_UNDEFINED;
-    d_error     = ntsa::Error();
+    d_foreignHandleList.clear();
+    d_error = ntsa::Error();
 }
 
 NTCCFG_INLINE
@@ -221,6 +243,12 @@ void ReceiveContext::setTransport(ntsa::Transport::Value value)
     d_transport = value;
 }
 
+NTCCFG_INLINE
+void ReceiveContext::addForeignHandle(ntsa::Handle value)
+{
+    d_foreignHandleList.push_back(value);
+}
+
 NTCCFG_INLINE
 void ReceiveContext::setError(const ntsa::Error& value)
 {
@@ -257,6 +285,12 @@ ntsa::TransportProtocol::Value ReceiveContext::transportProtocol() const
     return ntsa::Transport::getProtocol(d_transport);
 }
 
+NTCCFG_INLINE
+const bsl::vector<ntsa::Handle>& ReceiveContext::foreignHandleList() const
+{
+    return d_foreignHandleList;
+}
+
 NTCCFG_INLINE
 const ntsa::Error& ReceiveContext::error() const
 {
@@ -294,6 +328,7 @@ void hashAppend(HASH_ALGORITHM& algorithm, const ReceiveContext& value)
 
     hashAppend(algorithm, value.endpoint());
     hashAppend(algorithm, value.transport());
+    hashAppend(algorithm, value.foreignHandleList());
     hashAppend(algorithm, value.error());
 }
 
@@ -25,11 +25,29 @@ namespace ntca {
 
 bool SendContext::equals(const SendContext& other) const
 {
-    return (d_error == other.d_error);
+    return (d_bytesSent == other.d_bytesSent &&
+            d_bytesRemaining == other.d_bytesRemaining &&
+            d_error == other.d_error);
 }
 
 bool SendContext::less(const SendContext& other) const
 {
+    if (d_bytesSent < other.d_bytesSent) {
+        return true;
+    }
+
+    if (other.d_bytesSent < d_bytesSent) {
+        return false;
+    }
+
+    if (d_bytesRemaining < other.d_bytesRemaining) {
+        return true;
+    }
+
+    if (other.d_bytesRemaining < d_bytesRemaining) {
+        return false;
+    }
+
     return d_error < other.d_error;
 }
 
@@ -39,6 +57,8 @@ bsl::ostream& SendContext::print(bsl::ostream& stream,
 {
     bslim::Printer printer(&stream, level, spacesPerLevel);
     printer.start();
+    printer.printAttribute("bytesSent", d_bytesSent);
+    printer.printAttribute("bytesRemaining", d_bytesRemaining);
     printer.printAttribute("error", d_error);
     printer.end();
     return stream;
@@ -23,6 +23,7 @@ BSLS_IDENT("$Id: $")
 #include <ntcscm_version.h>
 #include <ntsa_error.h>
 #include <bslh_hash.h>
+#include <bsl_cstddef.h>
 #include <bsl_iosfwd.h>
 
 namespace BloombergLP {
@@ -33,6 +34,13 @@ namespace ntca {
 /// @par Attributes
 /// This class is composed of the following attributes.
 ///
+/// @li @b bytesSent:
+/// The number of bytes of the data copied to the send buffer so far.
+///
+/// @li @b bytesRemaining:
+/// The number of bytes of the data that remain to be copied to the send
+/// buffer.
+///
 /// @li @b error:
 /// The error detected when performing the operation.
 ///
@@ -42,6 +50,8 @@ namespace ntca {
 /// @ingroup module_ntci_operation_send
 class SendContext
 {
+    bsl::size_t d_bytesSent;
+    bsl::size_t d_bytesRemaining;
     ntsa::Error d_error;
 
   public:
@@ -63,10 +73,26 @@ class SendContext
     /// construction.
     void reset();
 
+    /// Set the number of bytes of the data copied to the send buffer so far
+    /// to the specified 'value'.
+    void setBytesSent(bsl::size_t value);
+
+    /// Set the number of bytes of the data that remain to be copied to the
+    /// send buffer to the specified 'value'.
+    void setBytesRemaining(bsl::size_t value);
+
     /// Set the error detected when performing the operation to the
     /// specified 'value'.
     void setError(const ntsa::Error& value);
 
+    /// Return the number of bytes of the data copied to the send buffer so
+    /// far.
+    bsl::size_t bytesSent() const;
+
+    /// Return the number of bytes of the data that remain to be copied to
+    /// the send buffer.
+    bsl::size_t bytesRemaining() const;
+
     /// Return the error detected when performing the operation.
     const ntsa::Error& error() const;
 
@@ -132,13 +158,17 @@ void hashAppend(HASH_ALGORITHM& algorithm, const SendContext& value);
 
 NTCCFG_INLINE
 SendContext::SendContext()
-: d_error()
+: d_bytesSent(0)
+, d_bytesRemaining(0)
+, d_error()
 {
 }
 
 NTCCFG_INLINE
 SendContext::SendContext(const SendContext& original)
-: d_error(original.d_error)
+: d_bytesSent(original.d_bytesSent)
+, d_bytesRemaining(original.d_bytesRemaining)
+, d_error(original.d_error)
 {
 }
 
@@ -150,14 +180,30 @@ SendContext::~SendContext()
 NTCCFG_INLINE
 SendContext& SendContext::operator=(const SendContext& other)
 {
-    d_error = other.d_error;
+    d_bytesSent      = other.d_bytesSent;
+    d_bytesRemaining = other.d_bytesRemaining;
+    d_error          = other.d_error;
     return *this;
 }
 
 NTCCFG_INLINE
 void SendContext::reset()
 {
-    d_error = ntsa::Error();
+    d_bytesSent      = 0;
+    d_bytesRemaining = 0;
+    d_error          = ntsa::Error();
+}
+
+NTCCFG_INLINE
+void SendContext::setBytesSent(bsl::size_t value)
+{
+    d_bytesSent = value;
+}
+
+NTCCFG_INLINE
+void SendContext::setBytesRemaining(bsl::size_t value)
+{
+    d_bytesRemaining = value;
 }
 
 NTCCFG_INLINE
@@ -166,6 +212,18 @@ void SendContext::setError(const ntsa::Error& value)
     d_error = value;
 }
 
+NTCCFG_INLINE
+bsl::size_t SendContext::bytesSent() const
+{
+    return d_bytesSent;
+}
+
+NTCCFG_INLINE
+bsl::size_t SendContext::bytesRemaining() const
+{
+    return d_bytesRemaining;
+}
+
 NTCCFG_INLINE
 const ntsa::Error& SendContext::error() const
 {
@@ -201,6 +259,8 @@ void hashAppend(HASH_ALGORITHM& algorithm, const SendContext& value)
 {
     using bslh::hashAppend;
 
+    hashAppend(algorithm, value.bytesSent());
+    hashAppend(algorithm, value.bytesRemaining());
     hashAppend(algorithm, value.error());
 }
 
@@ -30,6 +30,7 @@ int SendEventType::fromInt(SendEventType::Value* result, int number)
     switch (number) {
     case SendEventType::e_COMPLETE:
     case SendEventType::e_ERROR:
+    case SendEventType::e_PROGRESS:
         *result = static_cast<SendEventType::Value>(number);
         return 0;
     default:
@@ -48,6 +49,10 @@ int SendEventType::fromString(SendEventType::Value*    result,
         *result = e_ERROR;
         return 0;
     }
+    if (bdlb::String::areEqualCaseless(string, "PROGRESS")) {
+        *result = e_PROGRESS;
+        return 0;
+    }
 
     return -1;
 }
@@ -61,6 +66,9 @@ const char* SendEventType::toString(SendEventType::Value value)
     case e_ERROR: {
         return "ERROR";
     } break;
+    case e_PROGRESS: {
+        return "PROGRESS";
+    } break;
     }
 
     BSLS_ASSERT(!"invalid enumerator");
@@ -39,7 +39,13 @@ struct SendEventType {
         e_COMPLETE = 0,
 
         /// An error has been detected during the send operation.
-        e_ERROR = 1
+        e_ERROR = 1,
+
+        /// A portion, but not all, of the data has been copied to the send
+        /// buffer. This event is only announced when requested by the send
+        /// options, and is always followed by another event announcing the
+        /// completion or failure of the send operation.
+        e_PROGRESS = 2
     };
 
     /// Return the string representation exactly matching the enumerator
@@ -28,7 +28,9 @@ bool SendOptions::equals(const SendOptions& other) const
     return (d_token == other.d_token && d_endpoint == other.d_endpoint &&
             d_priority == other.d_priority &&
             d_highWatermark == other.d_highWatermark &&
-            d_deadline == other.d_deadline && d_recurse == other.d_recurse);
+            d_deadline == other.d_deadline &&
+            d_foreignHandle == other.d_foreignHandle &&
+            d_progress == other.d_progress && d_recurse == other.d_recurse);
 }
 
 bool SendOptions::less(const SendOptions& other) const
@@ -73,6 +75,22 @@ bool SendOptions::less(const SendOptions& other) const
         return false;
     }
 
+    if (d_foreignHandle < other.d_foreignHandle) {
+        return true;
+    }
+
+    if (other.d_foreignHandle < d_foreignHandle) {
+        return false;
+    }
+
+    if (d_progress < other.d_progress) {
+        return true;
+    }
+
+    if (other.d_progress < d_progress) {
+        return false;
+    }
+
     return d_recurse < other.d_recurse;
 }
 
@@ -103,6 +121,11 @@ bsl::ostream& SendOptions::print(bsl::ostream& stream,
         printer.printAttribute("deadline", d_deadline);
     }
 
+    if (!d_foreignHandle.isNull()) {
+        printer.printAttribute("foreignHandle", d_foreignHandle);
+    }
+
+    printer.printAttribute("progress", d_progress);
     printer.printAttribute("recurse", d_recurse);
     printer.end();
     return stream;
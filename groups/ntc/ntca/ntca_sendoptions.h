@@ -23,6 +23,7 @@ BSLS_IDENT("$Id: $")
 #include <ntccfg_platform.h>
 #include <ntcscm_version.h>
 #include <ntsa_endpoint.h>
+#include <ntsa_handle.h>
 #include <bdlb_nullablevalue.h>
 #include <bslh_hash.h>
 #include <bsls_timeinterval.h>
@@ -53,6 +54,20 @@ namespace ntca {
 /// The deadline within which the message must be sent, in absolute time since
 /// the Unix epoch.
 ///
+/// @li @b foreignHandle:
+/// The handle to pass to the peer along with the data, supported only by
+/// stream sockets in the local (a.k.a. Unix) domain. The handle is passed
+/// with the first byte of the data. The handle remains owned by the caller:
+/// if the handle cannot be passed immediately, a duplicate of the handle is
+/// queued with the data and closed once passed, or once the data is
+/// discarded.
+///
+/// @li @b progress:
+/// The flag that indicates the callback should also be invoked with an event
+/// of type 'ntca::SendEventType::e_PROGRESS' each time a portion, but not
+/// all, of the data is copied to the send buffer after the data has been
+/// queued. This is useful to observe the transmission of large files.
+///
 /// @li @b recurse:
 /// Allow callbacks to be invoked immediately and recursively if their
 /// constraints are already satisified at the time the asynchronous operation
@@ -69,6 +84,8 @@ class SendOptions
     bdlb::NullableValue<bsl::size_t>        d_priority;
     bdlb::NullableValue<bsl::size_t>        d_highWatermark;
     bdlb::NullableValue<bsls::TimeInterval> d_deadline;
+    bdlb::NullableValue<ntsa::Handle>       d_foreignHandle;
+    bool                                    d_progress;
     bool                                    d_recurse;
 
   public:
@@ -109,6 +126,15 @@ class SendOptions
     /// specified 'value'.
     void setDeadline(const bsls::TimeInterval& value);
 
+    /// Set the handle to pass to the peer along with the data to the
+    /// specified 'value'.
+    void setForeignHandle(ntsa::Handle value);
+
+    /// Set the flag that indicates the callback should also be invoked each
+    /// time a portion, but not all, of the data is copied to the send buffer
+    /// to the specified 'value'.
+    void setProgress(bool value);
+
     /// Set the flag that allows callbacks to be invoked immediately and
     /// recursively if their constraints are already satisified at the time
     /// the asynchronous operation is initiated.
@@ -130,6 +156,14 @@ class SendOptions
     /// Return the deadline within which the data must be sent.
     const bdlb::NullableValue<bsls::TimeInterval>& deadline() const;
 
+    /// Return the handle to pass to the peer along with the data.
+    const bdlb::NullableValue<ntsa::Handle>& foreignHandle() const;
+
+    /// Return the flag that indicates the callback should also be invoked
+    /// each time a portion, but not all, of the data is copied to the send
+    /// buffer.
+    bool progress() const;
+
     /// Return true if callbacks are allowed to be invoked immediately and
     /// recursively if their constraints are already satisified at the time
     /// the asynchronous operation is initiated, otherwise return false.
@@ -202,6 +236,8 @@ SendOptions::SendOptions()
 , d_priority()
 , d_highWatermark()
 , d_deadline()
+, d_foreignHandle()
+, d_progress(false)
 , d_recurse(false)
 {
 }
@@ -213,6 +249,8 @@ SendOptions::SendOptions(const SendOptions& original)
 , d_priority(original.d_priority)
 , d_highWatermark(original.d_highWatermark)
 , d_deadline(original.d_deadline)
+, d_foreignHandle(original.d_foreignHandle)
+, d_progress(original.d_progress)
 , d_recurse(original.d_recurse)
 {
 }
@@ -230,6 +268,8 @@ SendOptions& SendOptions::operator=(const SendOptions& other)
     d_priority      = other.d_priority;
     d_highWatermark = other.d_highWatermark;
     d_deadline      = other.d_deadline;
+    d_foreignHandle = other.d_foreignHandle;
+    d_progress      = other.d_progress;
     d_recurse       = other.d_recurse;
     return *this;
 }
@@ -242,7 +282,9 @@ void SendOptions::reset()
     d_priority.reset();
     d_highWatermark.reset();
     d_deadline.reset();
-    d_recurse = false;
+    d_foreignHandle.reset();
+    d_progress = false;
+    d_recurse  = false;
 }
 
 NTCCFG_INLINE
@@ -275,6 +317,18 @@ void SendOptions::setDeadline(const bsls::TimeInterval& value)
     d_deadline = value;
 }
 
+NTCCFG_INLINE
+void SendOptions::setForeignHandle(ntsa::Handle value)
+{
+    d_foreignHandle = value;
+}
+
+NTCCFG_INLINE
+void SendOptions::setProgress(bool value)
+{
+    d_progress = value;
+}
+
 NTCCFG_INLINE
 void SendOptions::setRecurse(bool value)
 {
@@ -311,6 +365,18 @@ const bdlb::NullableValue<bsls::TimeInterval>& SendOptions::deadline() const
     return d_deadline;
 }
 
+NTCCFG_INLINE
+const bdlb::NullableValue<ntsa::Handle>& SendOptions::foreignHandle() const
+{
+    return d_foreignHandle;
+}
+
+NTCCFG_INLINE
+bool SendOptions::progress() const
+{
+    return d_progress;
+}
+
 NTCCFG_INLINE
 bool SendOptions::recurse() const
 {
@@ -351,6 +417,8 @@ void hashAppend(HASH_ALGORITHM& algorithm, const SendOptions& value)
     hashAppend(algorithm, value.priority());
     hashAppend(algorithm, value.highWatermark());
     hashAppend(algorithm, value.deadline());
+    hashAppend(algorithm, value.foreignHandle());
+    hashAppend(algorithm, value.progress());
     hashAppend(algorithm, value.recurse());
 }
 
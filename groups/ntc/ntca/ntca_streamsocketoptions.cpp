@@ -35,6 +35,10 @@ StreamSocketOptions::StreamSocketOptions()
 , d_maxIncomingStreamTransferSize()
 , d_sendGreedily()
 , d_receiveGreedily()
+, d_sendBudget()
+, d_receiveBudget()
+, d_receiveCopyThreshold()
+, d_receiveForeignHandles()
 , d_sendBufferSize()
 , d_receiveBufferSize()
 , d_sendBufferLowWatermark()
@@ -70,6 +74,10 @@ StreamSocketOptions::StreamSocketOptions(const StreamSocketOptions& other)
 , d_maxIncomingStreamTransferSize(other.d_maxIncomingStreamTransferSize)
 , d_sendGreedily(other.d_sendGreedily)
 , d_receiveGreedily(other.d_receiveGreedily)
+, d_sendBudget(other.d_sendBudget)
+, d_receiveBudget(other.d_receiveBudget)
+, d_receiveCopyThreshold(other.d_receiveCopyThreshold)
+, d_receiveForeignHandles(other.d_receiveForeignHandles)
 , d_sendBufferSize(other.d_sendBufferSize)
 , d_receiveBufferSize(other.d_receiveBufferSize)
 , d_sendBufferLowWatermark(other.d_sendBufferLowWatermark)
@@ -114,6 +122,10 @@ StreamSocketOptions& StreamSocketOptions::operator=(
             other.d_maxIncomingStreamTransferSize;
         d_sendGreedily              = other.d_sendGreedily;
         d_receiveGreedily           = other.d_receiveGreedily;
+        d_sendBudget                = other.d_sendBudget;
+        d_receiveBudget             = other.d_receiveBudget;
+        d_receiveCopyThreshold      = other.d_receiveCopyThreshold;
+        d_receiveForeignHandles     = other.d_receiveForeignHandles;
         d_sendBufferSize            = other.d_sendBufferSize;
         d_receiveBufferSize         = other.d_receiveBufferSize;
         d_sendBufferLowWatermark    = other.d_sendBufferLowWatermark;
@@ -197,6 +209,26 @@ void StreamSocketOptions::setReceiveGreedily(bool value)
     d_receiveGreedily = value;
 }
 
+void StreamSocketOptions::setSendBudget(bsl::size_t value)
+{
+    d_sendBudget = value;
+}
+
+void StreamSocketOptions::setReceiveBudget(bsl::size_t value)
+{
+    d_receiveBudget = value;
+}
+
+void StreamSocketOptions::setReceiveCopyThreshold(bsl::size_t value)
+{
+    d_receiveCopyThreshold = value;
+}
+
+void StreamSocketOptions::setReceiveForeignHandles(bool value)
+{
+    d_receiveForeignHandles = value;
+}
+
 void StreamSocketOptions::setSendBufferSize(bsl::size_t value)
 {
     d_sendBufferSize = value;
@@ -360,6 +392,29 @@ const bdlb::NullableValue<bool>& StreamSocketOptions::receiveGreedily() const
     return d_receiveGreedily;
 }
 
+const bdlb::NullableValue<bsl::size_t>& StreamSocketOptions::sendBudget() const
+{
+    return d_sendBudget;
+}
+
+const bdlb::NullableValue<bsl::size_t>& StreamSocketOptions::receiveBudget()
+    const
+{
+    return d_receiveBudget;
+}
+
+const bdlb::NullableValue<bsl::size_t>& StreamSocketOptions::
+    receiveCopyThreshold() const
+{
+    return d_receiveCopyThreshold;
+}
+
+const bdlb::NullableValue<bool>& StreamSocketOptions::
+    receiveForeignHandles() const
+{
+    return d_receiveForeignHandles;
+}
+
 const bdlb::NullableValue<bsl::size_t>& StreamSocketOptions::sendBufferSize()
     const
 {
@@ -495,6 +550,10 @@ bsl::ostream& StreamSocketOptions::print(bsl::ostream& stream,
                            d_writeQueueHighWatermark);
     printer.printAttribute("sendGreedily", d_sendGreedily);
     printer.printAttribute("receiveGreedily", d_receiveGreedily);
+    printer.printAttribute("sendBudget", d_sendBudget);
+    printer.printAttribute("receiveBudget", d_receiveBudget);
+    printer.printAttribute("receiveCopyThreshold", d_receiveCopyThreshold);
+    printer.printAttribute("receiveForeignHandles", d_receiveForeignHandles);
     printer.printAttribute("sendBufferSize", d_sendBufferSize);
     printer.printAttribute("receiveBufferSize", d_receiveBufferSize);
     printer.printAttribute("sendBufferLowWatermark", d_sendBufferLowWatermark);
@@ -532,6 +591,10 @@ bool operator==(const StreamSocketOptions& lhs, const StreamSocketOptions& rhs)
            lhs.writeQueueHighWatermark() == rhs.writeQueueHighWatermark() &&
            lhs.sendGreedily() == rhs.sendGreedily() &&
            lhs.receiveGreedily() == rhs.receiveGreedily() &&
+           lhs.sendBudget() == rhs.sendBudget() &&
+           lhs.receiveBudget() == rhs.receiveBudget() &&
+           lhs.receiveCopyThreshold() == rhs.receiveCopyThreshold() &&
+           lhs.receiveForeignHandles() == rhs.receiveForeignHandles() &&
            lhs.sendBufferSize() == rhs.sendBufferSize() &&
            lhs.receiveBufferSize() == rhs.receiveBufferSize() &&
            lhs.sendBufferLowWatermark() == rhs.sendBufferLowWatermark() &&
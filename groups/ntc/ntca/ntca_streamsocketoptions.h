@@ -100,6 +100,44 @@ namespace ntca {
 /// throughput and latency over all connections, and the expense of higher
 /// average latency and lower average throughput.
 ///
+/// @li @b sendBudget:
+/// The maximum number of bytes copied from the write queue to the socket send
+/// buffer each time the operating system indicates the send buffer has
+/// capacity available, when sending greedily. Once the budget is exhausted,
+/// the socket yields to the other sockets driven by the same reactor and the
+/// remainder is sent after the reactor processes the rest of the events
+/// detected in its current wait cycle, without waiting for the operating
+/// system to indicate the socket is writable again. The default value is
+/// null, indicating the amount of data sent greedily is unlimited.
+///
+/// @li @b receiveBudget:
+/// The maximum number of bytes copied from the socket receive buffer to the
+/// read queue each time the operating system indicates the receive buffer is
+/// non-empty, when receiving greedily. Once the budget is exhausted, the
+/// socket yields to the other sockets driven by the same reactor and the
+/// remainder is received after the reactor processes the rest of the events
+/// detected in its current wait cycle, without waiting for the operating
+/// system to indicate the socket is readable again. The default value is
+/// null, indicating the amount of data received greedily is unlimited.
+///
+/// @li @b receiveCopyThreshold:
+/// The maximum number of bytes suggested to be copied from the socket receive
+/// buffer, as adapted to the amount of data actually received, at or below
+/// which data is first copied from the socket receive buffer into a buffer
+/// shared by all sockets driven by the same thread, then only the number of
+/// bytes actually received is copied into the read queue. This avoids
+/// reserving read queue capacity before each receive, which otherwise remains
+/// allocated while a connection is mostly idle, at the cost of an additional
+/// copy of small amounts of data. The default value is null, indicating data
+/// is always copied directly into the read queue.
+///
+/// @li @b receiveForeignHandles:
+/// The flag that indicates handles passed by the peer along with the data are
+/// accepted and announced through the receive context. This option is only
+/// supported by stream sockets in the local (a.k.a. Unix) domain. The default
+/// value is null, indicating handles passed by the peer are closed upon
+/// receipt.
+///
 /// @li @b sendBufferSize:
 /// The maximum size of each socket send buffer. On some platforms, this
 /// options may serve simply as a hint.
@@ -206,6 +244,10 @@ class StreamSocketOptions
     bdlb::NullableValue<bsl::size_t>    d_maxIncomingStreamTransferSize;
     bdlb::NullableValue<bool>           d_sendGreedily;
     bdlb::NullableValue<bool>           d_receiveGreedily;
+    bdlb::NullableValue<bsl::size_t>    d_sendBudget;
+    bdlb::NullableValue<bsl::size_t>    d_receiveBudget;
+    bdlb::NullableValue<bsl::size_t>    d_receiveCopyThreshold;
+    bdlb::NullableValue<bool>           d_receiveForeignHandles;
     bdlb::NullableValue<bsl::size_t>    d_sendBufferSize;
     bdlb::NullableValue<bsl::size_t>    d_receiveBufferSize;
     bdlb::NullableValue<bsl::size_t>    d_sendBufferLowWatermark;
@@ -293,6 +335,24 @@ class StreamSocketOptions
     /// Set the flag that controls greedy receives to the specified 'value'.
     void setReceiveGreedily(bool value);
 
+    /// Set the maximum number of bytes sent greedily each time the socket
+    /// is writable to the specified 'value'.
+    void setSendBudget(bsl::size_t value);
+
+    /// Set the maximum number of bytes received greedily each time the
+    /// socket is readable to the specified 'value'.
+    void setReceiveBudget(bsl::size_t value);
+
+    /// Set the maximum number of bytes suggested to be copied from the
+    /// receive buffer at or below which data is received through a buffer
+    /// shared by all sockets driven by the same thread to the specified
+    /// 'value'.
+    void setReceiveCopyThreshold(bsl::size_t value);
+
+    /// Set the flag that indicates handles passed by the peer along with the
+    /// data are accepted to the specified 'value'.
+    void setReceiveForeignHandles(bool value);
+
     /// Set the send timeout to the specified 'value'.
     void setSendTimeout(bsl::size_t value);
 
@@ -387,6 +447,23 @@ class StreamSocketOptions
     /// Return the flag that controls greedy receives.
     const bdlb::NullableValue<bool>& receiveGreedily() const;
 
+    /// Return the maximum number of bytes sent greedily each time the socket
+    /// is writable.
+    const bdlb::NullableValue<bsl::size_t>& sendBudget() const;
+
+    /// Return the maximum number of bytes received greedily each time the
+    /// socket is readable.
+    const bdlb::NullableValue<bsl::size_t>& receiveBudget() const;
+
+    /// Return the maximum number of bytes suggested to be copied from the
+    /// receive buffer at or below which data is received through a buffer
+    /// shared by all sockets driven by the same thread.
+    const bdlb::NullableValue<bsl::size_t>& receiveCopyThreshold() const;
+
+    /// Return the flag that indicates handles passed by the peer along with
+    /// the data are accepted.
+    const bdlb::NullableValue<bool>& receiveForeignHandles() const;
+
     /// Return the maximum size of the send buffer.
     const bdlb::NullableValue<bsl::size_t>& sendBufferSize() const;
 
@@ -30,9 +30,14 @@ ThreadConfig::ThreadConfig(bslma::Allocator* basicAllocator)
 , d_maxEventsPerWait()
 , d_maxTimersPerWait()
 , d_maxCyclesPerWait()
+, d_busyPollDuration()
+, d_busyPollSockets()
+, d_deferInterestChanges()
+, d_devicePerWaiter()
 , d_metricCollection()
 , d_metricCollectionPerWaiter()
 , d_metricCollectionPerSocket()
+, d_stallThreshold()
 , d_resolverEnabled()
 , d_resolverConfig(basicAllocator)
 {
@@ -46,10 +51,15 @@ ThreadConfig::ThreadConfig(const ThreadConfig& original,
 , d_maxEventsPerWait(original.d_maxEventsPerWait)
 , d_maxTimersPerWait(original.d_maxTimersPerWait)
 , d_maxCyclesPerWait(original.d_maxCyclesPerWait)
+, d_busyPollDuration(original.d_busyPollDuration)
+, d_busyPollSockets(original.d_busyPollSockets)
+, d_deferInterestChanges(original.d_deferInterestChanges)
+, d_devicePerWaiter(original.d_devicePerWaiter)
 , d_metricCollection(original.d_metricCollection)
 , d_metricCollectionPerWaiter(original.d_metricCollectionPerWaiter)
 , d_metricCollectionPerSocket(original.d_metricCollectionPerSocket)
-, d_resolverEnabled()
+, d_stallThreshold(original.d_stallThreshold)
+, d_resolverEnabled(original.d_resolverEnabled)
 , d_resolverConfig(original.d_resolverConfig, basicAllocator)
 {
 }
@@ -67,9 +77,14 @@ ThreadConfig& ThreadConfig::operator=(const ThreadConfig& other)
         d_maxEventsPerWait          = other.d_maxEventsPerWait;
         d_maxTimersPerWait          = other.d_maxTimersPerWait;
         d_maxCyclesPerWait          = other.d_maxCyclesPerWait;
+        d_busyPollDuration          = other.d_busyPollDuration;
+        d_busyPollSockets           = other.d_busyPollSockets;
+        d_deferInterestChanges      = other.d_deferInterestChanges;
+        d_devicePerWaiter           = other.d_devicePerWaiter;
         d_metricCollection          = other.d_metricCollection;
         d_metricCollectionPerWaiter = other.d_metricCollectionPerWaiter;
         d_metricCollectionPerSocket = other.d_metricCollectionPerSocket;
+        d_stallThreshold            = other.d_stallThreshold;
         d_resolverEnabled           = other.d_resolverEnabled;
         d_resolverConfig            = other.d_resolverConfig;
     }
@@ -85,9 +100,14 @@ void ThreadConfig::reset()
     d_maxEventsPerWait.reset();
     d_maxTimersPerWait.reset();
     d_maxCyclesPerWait.reset();
+    d_busyPollDuration.reset();
+    d_busyPollSockets.reset();
+    d_deferInterestChanges.reset();
+    d_devicePerWaiter.reset();
     d_metricCollection.reset();
     d_metricCollectionPerWaiter.reset();
     d_metricCollectionPerSocket.reset();
+    d_stallThreshold.reset();
     d_resolverEnabled.reset();
     d_resolverConfig.reset();
 }
@@ -122,6 +142,26 @@ void ThreadConfig::setMaxCyclesPerWait(bsl::size_t value)
     d_maxCyclesPerWait = value;
 }
 
+void ThreadConfig::setBusyPollDuration(const bsls::TimeInterval& value)
+{
+    d_busyPollDuration = value;
+}
+
+void ThreadConfig::setBusyPollSockets(bool value)
+{
+    d_busyPollSockets = value;
+}
+
+void ThreadConfig::setDeferInterestChanges(bool value)
+{
+    d_deferInterestChanges = value;
+}
+
+void ThreadConfig::setDevicePerWaiter(bool value)
+{
+    d_devicePerWaiter = value;
+}
+
 void ThreadConfig::setMetricCollection(bool value)
 {
     d_metricCollection = value;
@@ -137,6 +177,11 @@ void ThreadConfig::setMetricCollectionPerSocket(bool value)
     d_metricCollectionPerSocket = value;
 }
 
+void ThreadConfig::setStallThreshold(const bsls::TimeInterval& value)
+{
+    d_stallThreshold = value;
+}
+
 void ThreadConfig::setResolverEnabled(bool value)
 {
     d_resolverEnabled = value;
@@ -177,6 +222,27 @@ const bdlb::NullableValue<bsl::size_t>& ThreadConfig::maxCyclesPerWait() const
     return d_maxCyclesPerWait;
 }
 
+const bdlb::NullableValue<bsls::TimeInterval>& ThreadConfig::busyPollDuration()
+    const
+{
+    return d_busyPollDuration;
+}
+
+const bdlb::NullableValue<bool>& ThreadConfig::busyPollSockets() const
+{
+    return d_busyPollSockets;
+}
+
+const bdlb::NullableValue<bool>& ThreadConfig::deferInterestChanges() const
+{
+    return d_deferInterestChanges;
+}
+
+const bdlb::NullableValue<bool>& ThreadConfig::devicePerWaiter() const
+{
+    return d_devicePerWaiter;
+}
+
 const bdlb::NullableValue<bool>& ThreadConfig::metricCollection() const
 {
     return d_metricCollection;
@@ -194,6 +260,12 @@ const bdlb::NullableValue<bool>& ThreadConfig::metricCollectionPerSocket()
     return d_metricCollectionPerSocket;
 }
 
+const bdlb::NullableValue<bsls::TimeInterval>& ThreadConfig::stallThreshold()
+    const
+{
+    return d_stallThreshold;
+}
+
 const bdlb::NullableValue<bool>& ThreadConfig::resolverEnabled() const
 {
     return d_resolverEnabled;
@@ -213,9 +285,14 @@ bool ThreadConfig::equals(const ThreadConfig& other) const
            d_maxEventsPerWait == other.d_maxEventsPerWait &&
            d_maxTimersPerWait == other.d_maxTimersPerWait &&
            d_maxCyclesPerWait == other.d_maxCyclesPerWait &&
+           d_busyPollDuration == other.d_busyPollDuration &&
+           d_busyPollSockets == other.d_busyPollSockets &&
+           d_deferInterestChanges == other.d_deferInterestChanges &&
+           d_devicePerWaiter == other.d_devicePerWaiter &&
            d_metricCollection == other.d_metricCollection &&
            d_metricCollectionPerWaiter == other.d_metricCollectionPerWaiter &&
            d_metricCollectionPerSocket == other.d_metricCollectionPerSocket &&
+           d_stallThreshold == other.d_stallThreshold &&
            d_resolverEnabled == other.d_resolverEnabled &&
            d_resolverConfig == other.d_resolverConfig;
 }
@@ -232,11 +309,16 @@ bsl::ostream& ThreadConfig::print(bsl::ostream& stream,
     printer.printAttribute("maxEventsPerWait", d_maxEventsPerWait);
     printer.printAttribute("maxTimersPerWait", d_maxTimersPerWait);
     printer.printAttribute("maxCyclesPerWait", d_maxCyclesPerWait);
+    printer.printAttribute("busyPollDuration", d_busyPollDuration);
+    printer.printAttribute("busyPollSockets", d_busyPollSockets);
+    printer.printAttribute("deferInterestChanges", d_deferInterestChanges);
+    printer.printAttribute("devicePerWaiter", d_devicePerWaiter);
     printer.printAttribute("metricCollection", d_metricCollection);
     printer.printAttribute("metricCollectionPerWaiter",
                            d_metricCollectionPerWaiter);
     printer.printAttribute("metricCollectionPerSocket",
                            d_metricCollectionPerSocket);
+    printer.printAttribute("stallThreshold", d_stallThreshold);
     printer.printAttribute("resolverEnabled", d_resolverEnabled);
     printer.printAttribute("resolverConfig", d_resolverConfig);
     printer.end();
@@ -24,6 +24,7 @@ BSLS_IDENT("$Id: $")
 #include <ntccfg_platform.h>
 #include <ntcscm_version.h>
 #include <bdlb_nullablevalue.h>
+#include <bsls_timeinterval.h>
 #include <bsl_iosfwd.h>
 #include <bsl_string.h>
 
@@ -69,6 +70,43 @@ namespace ntca {
 /// from being able to process socket events that actually have occurred. The
 /// default value is null, indicating that only one cycle is performed.
 ///
+/// @li @b busyPollDuration:
+/// The maximum duration for which a thread waiting for events repeatedly
+/// polls for events without blocking before falling back to blocking until
+/// events occur. The effective duration adapts between zero and this maximum
+/// according to whether events recently arrived while polling. Polling trades
+/// processor time for lower latency, as an event that arrives while polling
+/// does not incur the cost of waking up a blocked thread. The default value
+/// is null, indicating that threads immediately block when no events are
+/// pending.
+///
+/// @li @b busyPollSockets:
+/// The flag that indicates each socket should also be configured to allow
+/// the kernel to busy poll the network device queue when the socket has no
+/// data available, for the busy poll duration. This option is only
+/// effective for reactors on Linux when a busy poll duration is defined. The
+/// default value is null, indicating sockets are not configured to allow busy
+/// polling by the kernel.
+///
+/// @li @b deferInterestChanges:
+/// The flag that indicates changes to the interest in the events of a socket
+/// made by the thread waiting on a reactor are accumulated and applied to the
+/// device once per wait, so that several changes to the interest in the same
+/// socket cost at most one system call. Changes made by other threads are
+/// always applied immediately. This option is only effective for reactors
+/// driven by a single thread. The default value is null, indicating changes
+/// are applied immediately.
+///
+/// @li @b devicePerWaiter:
+/// The flag that indicates each thread waiting on a reactor polls its own
+/// device, each socket is bound to the device of one thread, and only
+/// listening sockets are registered with every device, such that only one
+/// thread is woken up per incoming connection. Since the events of each
+/// socket are only polled by one thread, one-shot mode is no longer required
+/// to prevent the concurrent processing of those events. This option is only
+/// effective for reactors driven by multiple threads. The default value is
+/// null, indicating all threads waiting on a reactor poll the same device.
+///
 /// @li @b metricCollection:
 /// The flag that indicates the collection of metrics is enabled or disabled.
 ///
@@ -80,6 +118,12 @@ namespace ntca {
 /// The flag that indicates the collection of metrics per socket is enabled or
 /// disabled.
 ///
+/// @li @b stallThreshold:
+/// The duration after which a callback invoked by the thread, or the
+/// processing performed by the thread during a single cycle of its wait loop,
+/// is reported as stalling the thread. The default value is null, indicating
+/// stalls are not detected.
+///
 /// @li @b resolverEnabled:
 /// The flag that indicates this interface should run an asynchronous resolver.
 /// The default value is null, indicating that a default resolver is *not* run.
@@ -101,9 +145,14 @@ class ThreadConfig
     bdlb::NullableValue<bsl::size_t>          d_maxEventsPerWait;
     bdlb::NullableValue<bsl::size_t>          d_maxTimersPerWait;
     bdlb::NullableValue<bsl::size_t>          d_maxCyclesPerWait;
+    bdlb::NullableValue<bsls::TimeInterval>   d_busyPollDuration;
+    bdlb::NullableValue<bool>                 d_busyPollSockets;
+    bdlb::NullableValue<bool>                 d_deferInterestChanges;
+    bdlb::NullableValue<bool>                 d_devicePerWaiter;
     bdlb::NullableValue<bool>                 d_metricCollection;
     bdlb::NullableValue<bool>                 d_metricCollectionPerWaiter;
     bdlb::NullableValue<bool>                 d_metricCollectionPerSocket;
+    bdlb::NullableValue<bsls::TimeInterval>   d_stallThreshold;
     bdlb::NullableValue<bool>                 d_resolverEnabled;
     bdlb::NullableValue<ntca::ResolverConfig> d_resolverConfig;
 
@@ -163,6 +212,24 @@ class ThreadConfig
     /// 'value'.
     void setMaxCyclesPerWait(bsl::size_t value);
 
+    /// Set the maximum duration for which a thread waiting for events polls
+    /// for events without blocking to the specified 'value'.
+    void setBusyPollDuration(const bsls::TimeInterval& value);
+
+    /// Set the flag that indicates each socket should be configured to allow
+    /// the kernel to busy poll the network device queue to the specified
+    /// 'value'.
+    void setBusyPollSockets(bool value);
+
+    /// Set the flag that indicates changes to the interest in the events of
+    /// a socket made by the thread waiting on a reactor are deferred and
+    /// applied once per wait to the specified 'value'.
+    void setDeferInterestChanges(bool value);
+
+    /// Set the flag that indicates each thread waiting on a reactor polls
+    /// its own device to the specified 'value'.
+    void setDevicePerWaiter(bool value);
+
     /// Set the collection of metrics to be enabled or disabled according
     /// to the specified 'value'.
     void setMetricCollection(bool value);
@@ -175,6 +242,13 @@ class ThreadConfig
     /// according to the specified 'value'.
     void setMetricCollectionPerSocket(bool value);
 
+    /// Set the duration after which a callback invoked by the thread, or
+    /// the processing performed by the thread during a single cycle of its
+    /// wait loop, is reported as stalling the thread to the specified
+    /// 'value'. The default value is null, indicating stalls are not
+    /// detected.
+    void setStallThreshold(const bsls::TimeInterval& value);
+
     /// Set the flag that indicates this interface should run an
     /// asynchronous resolver to the specified 'value'. The default value is
     /// null, indicating that a default resolver is *not* run.
@@ -214,6 +288,24 @@ class ThreadConfig
     /// null, only one cycle is performed.
     const bdlb::NullableValue<bsl::size_t>& maxCyclesPerWait() const;
 
+    /// Return the maximum duration for which a thread waiting for events
+    /// polls for events without blocking. If the value is null, threads
+    /// immediately block when no events are pending.
+    const bdlb::NullableValue<bsls::TimeInterval>& busyPollDuration() const;
+
+    /// Return the flag that indicates each socket should be configured to
+    /// allow the kernel to busy poll the network device queue.
+    const bdlb::NullableValue<bool>& busyPollSockets() const;
+
+    /// Return the flag that indicates changes to the interest in the events
+    /// of a socket made by the thread waiting on a reactor are deferred and
+    /// applied once per wait.
+    const bdlb::NullableValue<bool>& deferInterestChanges() const;
+
+    /// Return the flag that indicates each thread waiting on a reactor
+    /// polls its own device.
+    const bdlb::NullableValue<bool>& devicePerWaiter() const;
+
     /// Return the flag that indicates the collection of metrics is enabled
     /// or disabled.
     const bdlb::NullableValue<bool>& metricCollection() const;
@@ -226,6 +318,12 @@ class ThreadConfig
     /// is enabled or disabled.
     const bdlb::NullableValue<bool>& metricCollectionPerSocket() const;
 
+    /// Return the duration after which a callback invoked by the thread, or
+    /// the processing performed by the thread during a single cycle of its
+    /// wait loop, is reported as stalling the thread. If the value is null,
+    /// stalls are not detected.
+    const bdlb::NullableValue<bsls::TimeInterval>& stallThreshold() const;
+
     /// Return the flag that indicates this interface should run an
     /// asynchronous resolver. The default value is null, indicating that a
     /// default resolver is *not* run.
@@ -22,11 +22,13 @@ BSLS_IDENT_RCSID(ntcd_machine_cpp, "$Id$ $CSID$")
 #include <bdlb_string.h>
 #include <bdlbb_blob.h>
 #include <bdlbb_blobutil.h>
+#include <bdlt_currenttime.h>
 #include <bslim_printer.h>
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bslmt_lockguard.h>
 #include <bsls_assert.h>
+#include <bsl_limits.h>
 #include <bsl_ostream.h>
 
 #define NTCD_SESSION_LOG_OUTGOING_PACKET_QUEUE_ENQUEUE_ERROR(machine,         \
@@ -383,6 +385,10 @@ const bsl::size_t k_DEFAULT_HIGH_WATERMARK = 1024 * 256;
 
 const int k_DEFAULT_BLOB_BUFFER_SIZE = 4096;
 
+// The maximum number of microseconds, in real time, the simulation blocks
+// before re-evaluating whether virtual time may be advanced.
+const bsl::int64_t k_VIRTUAL_TIME_POLL_INTERVAL_IN_MICROSECONDS = 1000;
+
 const bsl::size_t k_MTU = 64 * 1024;
 
 bsls::SpinLock       s_defaultMachineLock  = BSLS_SPINLOCK_UNLOCKED;
@@ -4218,6 +4224,37 @@ void Monitor::removeQueueEntry(const bsl::shared_ptr<Entry>& entry)
     }
 }
 
+bool Monitor::waitVirtual(const bsl::int64_t* deadline)
+{
+    if (deadline != 0 &&
+        d_machine_sp->currentTime().totalMicroseconds() >= *deadline)
+    {
+        return false;
+    }
+
+    DeadlineSet::iterator it = d_deadlineSet.end();
+    if (deadline != 0) {
+        it = d_deadlineSet.insert(*deadline);
+    }
+
+    d_blocked += 1;
+
+    d_machine_sp->notifyBlocked();
+    d_condition.wait(&d_mutex);
+
+    d_blocked -= 1;
+
+    if (deadline != 0) {
+        d_deadlineSet.erase(it);
+
+        if (d_machine_sp->currentTime().totalMicroseconds() >= *deadline) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 Monitor::Monitor(const bsl::shared_ptr<ntcd::Machine>& machine,
                  bslma::Allocator*                     basicAllocator)
 : d_mutex()
@@ -4225,6 +4262,8 @@ Monitor::Monitor(const bsl::shared_ptr<ntcd::Machine>& machine,
 , d_run(true)
 , d_interrupt(0)
 , d_waiters(0)
+, d_blocked(0)
+, d_deadlineSet(basicAllocator)
 , d_map(basicAllocator)
 , d_queue(basicAllocator)
 , d_machine_sp(machine)
@@ -5018,6 +5057,11 @@ ntsa::Error Monitor::dequeue(bsl::vector<ntca::ReactorEvent>* result)
 
     while (d_run && d_queue.empty() && d_interrupt == 0) {
         NTCD_MONITOR_LOG_WAITING(d_machine_sp, this);
+        if (d_machine_sp->isVirtualTime()) {
+            this->waitVirtual(0);
+            continue;
+        }
+
         int waitResult = d_condition.wait(&d_mutex);
         if (waitResult == 0) {
             break;
@@ -5065,6 +5109,16 @@ ntsa::Error Monitor::dequeue(bsl::vector<ntca::ReactorEvent>* result,
 
     while (d_run && d_queue.empty() && d_interrupt == 0) {
         NTCD_MONITOR_LOG_WAITING(d_machine_sp, this);
+        if (d_machine_sp->isVirtualTime()) {
+            const bsl::int64_t deadline = timeout.totalMicroseconds();
+            if (!this->waitVirtual(&deadline) && d_queue.empty() &&
+                d_interrupt == 0)
+            {
+                return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+            }
+            continue;
+        }
+
         int waitResult = d_condition.timedWait(&d_mutex, timeout);
         if (waitResult == 0) {
             break;
@@ -5133,6 +5187,19 @@ void Monitor::interruptAll()
     }
 }
 
+void Monitor::advance()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (!d_deadlineSet.empty()) {
+        const bsl::int64_t now =
+            d_machine_sp->currentTime().totalMicroseconds();
+        if (*d_deadlineSet.begin() <= now) {
+            d_condition.broadcast();
+        }
+    }
+}
+
 void Monitor::stop()
 {
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
@@ -5173,6 +5240,27 @@ bool Monitor::supportsTrigger(ntca::ReactorEventTrigger::Value trigger) const
     }
 }
 
+bool Monitor::isIdle(bsl::int64_t* earliestDeadline)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    *earliestDeadline = bsl::numeric_limits<bsl::int64_t>::max();
+
+    if (!d_run || !d_queue.empty() || d_interrupt != 0) {
+        return false;
+    }
+
+    if (d_blocked < d_waiters) {
+        return false;
+    }
+
+    if (!d_deadlineSet.empty()) {
+        *earliestDeadline = *d_deadlineSet.begin();
+    }
+
+    return true;
+}
+
 Machine::Machine(bslma::Allocator* basicAllocator)
 : d_mutex()
 , d_condition()
@@ -5188,9 +5276,12 @@ Machine::Machine(bslma::Allocator* basicAllocator)
 , d_sessionByTcpBindingMap(basicAllocator)
 , d_sessionByUdpBindingMap(basicAllocator)
 , d_sessionByLocalBindingMap(basicAllocator)
+, d_monitorVector(basicAllocator)
 , d_threadGroup(basicAllocator)
 , d_stop(false)
 , d_update(false)
+, d_virtualTime(false)
+, d_virtualTimeInMicroseconds(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     d_ipAddressList.push_back(ntsa::IpAddress::loopbackIpv4());
@@ -5201,6 +5292,47 @@ Machine::~Machine()
 {
 }
 
+bool Machine::privateAdvanceIdle(
+    bsl::vector<bsl::shared_ptr<ntcd::Monitor> >* result)
+{
+    result->clear();
+
+    bsl::int64_t earliestDeadline = bsl::numeric_limits<bsl::int64_t>::max();
+
+    MonitorVector::iterator it = d_monitorVector.begin();
+    while (it != d_monitorVector.end()) {
+        bsl::shared_ptr<ntcd::Monitor> monitor = it->lock();
+        if (!monitor) {
+            it = d_monitorVector.erase(it);
+            continue;
+        }
+
+        bsl::int64_t monitorDeadline;
+        if (!monitor->isIdle(&monitorDeadline)) {
+            result->clear();
+            return false;
+        }
+
+        if (monitorDeadline < earliestDeadline) {
+            earliestDeadline = monitorDeadline;
+        }
+
+        result->push_back(monitor);
+        ++it;
+    }
+
+    if (earliestDeadline == bsl::numeric_limits<bsl::int64_t>::max() ||
+        earliestDeadline <= d_virtualTimeInMicroseconds.load())
+    {
+        result->clear();
+        return false;
+    }
+
+    d_virtualTimeInMicroseconds = earliestDeadline;
+
+    return true;
+}
+
 ntsa::Error Machine::acquireHandle(
     ntsa::Handle*                         result,
     ntsa::Transport::Value                transport,
@@ -5369,11 +5501,9 @@ ntsa::Error Machine::acquireSourceEndpoint(
         ntsa::Endpoint effectiveSourceEndpoint =
             ntsa::Endpoint(ntsa::IpEndpoint(ipAddress, port));
 
-        if (!d_sessionByTcpEndpointMap
-                 .insert(SessionByEndpointMap::value_type(
-                     effectiveSourceEndpoint,
-                     bsl::weak_ptr<ntcd::Session>(session)))
-                 .second)
+        if (!d_sessionByTcpEndpointMap.add(
+                effectiveSourceEndpoint,
+                bsl::weak_ptr<ntcd::Session>(session)))
         {
             d_tcpPortMap.release(port);
             return ntsa::Error(ntsa::Error::e_INVALID);
@@ -5409,11 +5539,9 @@ ntsa::Error Machine::acquireSourceEndpoint(
         ntsa::Endpoint effectiveSourceEndpoint =
             ntsa::Endpoint(ntsa::IpEndpoint(ipAddress, port));
 
-        if (!d_sessionByUdpEndpointMap
-                 .insert(SessionByEndpointMap::value_type(
-                     effectiveSourceEndpoint,
-                     bsl::weak_ptr<ntcd::Session>(session)))
-                 .second)
+        if (!d_sessionByUdpEndpointMap.add(
+                effectiveSourceEndpoint,
+                bsl::weak_ptr<ntcd::Session>(session)))
         {
             d_udpPortMap.release(port);
             return ntsa::Error(ntsa::Error::e_INVALID);
@@ -5430,11 +5558,9 @@ ntsa::Error Machine::acquireSourceEndpoint(
             return ntsa::Error(ntsa::Error::e_INVALID);
         }
 
-        if (!d_sessionByLocalEndpointMap
-                 .insert(SessionByEndpointMap::value_type(
-                     sourceEndpoint,
-                     bsl::weak_ptr<ntcd::Session>(session)))
-                 .second)
+        if (!d_sessionByLocalEndpointMap.add(
+                sourceEndpoint,
+                bsl::weak_ptr<ntcd::Session>(session)))
         {
             return ntsa::Error(ntsa::Error::e_INVALID);
         }
@@ -5460,14 +5586,12 @@ ntsa::Error Machine::releaseSourceEndpoint(
         ntsa::Transport::getProtocol(transport);
 
     if (!error && !sourceEndpoint.isUndefined()) {
-        bsl::size_t n;
         if (protocol == ntsa::TransportProtocol::e_TCP) {
             if (!sourceEndpoint.isIp()) {
                 return ntsa::Error(ntsa::Error::e_INVALID);
             }
 
-            n = d_sessionByTcpEndpointMap.erase(sourceEndpoint);
-            if (n != 1) {
+            if (!d_sessionByTcpEndpointMap.remove(sourceEndpoint)) {
                 return ntsa::Error(ntsa::Error::e_INVALID);
             }
 
@@ -5478,8 +5602,7 @@ ntsa::Error Machine::releaseSourceEndpoint(
                 return ntsa::Error(ntsa::Error::e_INVALID);
             }
 
-            n = d_sessionByUdpEndpointMap.erase(sourceEndpoint);
-            if (n != 1) {
+            if (!d_sessionByUdpEndpointMap.remove(sourceEndpoint)) {
                 return ntsa::Error(ntsa::Error::e_INVALID);
             }
 
@@ -5490,8 +5613,7 @@ ntsa::Error Machine::releaseSourceEndpoint(
                 return ntsa::Error(ntsa::Error::e_INVALID);
             }
 
-            n = d_sessionByLocalEndpointMap.erase(sourceEndpoint);
-            if (n != 1) {
+            if (!d_sessionByLocalEndpointMap.remove(sourceEndpoint)) {
                 return ntsa::Error(ntsa::Error::e_INVALID);
             }
         }
@@ -5719,6 +5841,11 @@ bsl::shared_ptr<ntcd::Monitor> Machine::createMonitor(
     bsl::shared_ptr<ntcd::Monitor> monitor;
     monitor.createInplace(allocator, this->getSelf(this), allocator);
 
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        d_monitorVector.push_back(monitor);
+    }
+
     return monitor;
 }
 
@@ -5755,6 +5882,89 @@ void Machine::updateNoLock(const bsl::shared_ptr<ntcd::Session>& session)
     }
 }
 
+void Machine::notifyBlocked()
+{
+    // Note that the mutex is intentionally not acquired: this function is
+    // called while the monitor's mutex is locked, and the monitor's mutex
+    // is acquired while this object's mutex is locked when evaluating
+    // whether virtual time may be advanced. A notification lost to this race
+    // is recovered by the bounded wait in 'step'.
+
+    d_condition.broadcast();
+}
+
+void Machine::enableVirtualTime(const bsls::TimeInterval& currentTime)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    d_virtualTimeInMicroseconds = currentTime.totalMicroseconds();
+    d_virtualTime               = true;
+
+    d_condition.broadcast();
+}
+
+void Machine::disableVirtualTime()
+{
+    typedef bsl::vector<bsl::shared_ptr<ntcd::Monitor> > MonitorList;
+
+    MonitorList monitors;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        d_virtualTime = false;
+
+        for (MonitorVector::iterator it = d_monitorVector.begin();
+             it != d_monitorVector.end();
+             ++it)
+        {
+            bsl::shared_ptr<ntcd::Monitor> monitor = it->lock();
+            if (monitor) {
+                monitors.push_back(monitor);
+            }
+        }
+    }
+
+    for (MonitorList::iterator it = monitors.begin(); it != monitors.end();
+         ++it)
+    {
+        (*it)->interruptAll();
+    }
+}
+
+ntsa::Error Machine::advanceTime(const bsls::TimeInterval& duration)
+{
+    typedef bsl::vector<bsl::shared_ptr<ntcd::Monitor> > MonitorList;
+
+    MonitorList monitors;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (!d_virtualTime) {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+
+        d_virtualTimeInMicroseconds += duration.totalMicroseconds();
+
+        for (MonitorVector::iterator it = d_monitorVector.begin();
+             it != d_monitorVector.end();
+             ++it)
+        {
+            bsl::shared_ptr<ntcd::Monitor> monitor = it->lock();
+            if (monitor) {
+                monitors.push_back(monitor);
+            }
+        }
+    }
+
+    for (MonitorList::iterator it = monitors.begin(); it != monitors.end();
+         ++it)
+    {
+        (*it)->advance();
+    }
+
+    return ntsa::Error();
+}
+
 ntsa::Error Machine::run()
 {
     bslmt::ThreadAttributes threadAttributes;
@@ -5788,7 +5998,10 @@ ntsa::Error Machine::step(bool block)
 
     typedef bsl::vector<SessionByHandleMap::value_type> SessionVector;
 
+    typedef bsl::vector<bsl::shared_ptr<ntcd::Monitor> > MonitorList;
+
     SessionVector sessions;
+    MonitorList   monitors;
     {
         bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
@@ -5798,8 +6011,20 @@ ntsa::Error Machine::step(bool block)
                 break;
             }
 
+            if (d_virtualTime && this->privateAdvanceIdle(&monitors)) {
+                break;
+            }
+
             if (block) {
-                d_condition.wait(&d_mutex);
+                if (d_virtualTime) {
+                    bsls::TimeInterval timeout = bdlt::CurrentTime::now();
+                    timeout.addMicroseconds(
+                        k_VIRTUAL_TIME_POLL_INTERVAL_IN_MICROSECONDS);
+                    d_condition.timedWait(&d_mutex, timeout);
+                }
+                else {
+                    d_condition.wait(&d_mutex);
+                }
             }
             else {
                 return ntsa::Error();
@@ -5833,6 +6058,12 @@ ntsa::Error Machine::step(bool block)
         }
     }
 
+    for (MonitorList::iterator it = monitors.begin(); it != monitors.end();
+         ++it)
+    {
+        (*it)->advance();
+    }
+
     NTCD_MACHINE_LOG_STEP_COMPLETE();
 
     return ntsa::Error();
@@ -5873,34 +6104,34 @@ ntsa::Error Machine::lookupSession(bsl::weak_ptr<ntcd::Session>* result,
         ntsa::Transport::getProtocol(transport);
 
     if (protocol == ntsa::TransportProtocol::e_TCP) {
-        SessionByEndpointMap::const_iterator it =
+        const bsl::weak_ptr<ntcd::Session>* session =
             d_sessionByTcpEndpointMap.find(sourceEndpoint);
 
-        if (it == d_sessionByTcpEndpointMap.end()) {
+        if (session == 0) {
             return ntsa::Error(ntsa::Error::e_INVALID);
         }
 
-        *result = it->second;
+        *result = *session;
     }
     else if (protocol == ntsa::TransportProtocol::e_UDP) {
-        SessionByEndpointMap::const_iterator it =
+        const bsl::weak_ptr<ntcd::Session>* session =
             d_sessionByUdpEndpointMap.find(sourceEndpoint);
 
-        if (it == d_sessionByUdpEndpointMap.end()) {
+        if (session == 0) {
             return ntsa::Error(ntsa::Error::e_INVALID);
         }
 
-        *result = it->second;
+        *result = *session;
     }
     else if (protocol == ntsa::TransportProtocol::e_LOCAL) {
-        SessionByEndpointMap::const_iterator it =
+        const bsl::weak_ptr<ntcd::Session>* session =
             d_sessionByLocalEndpointMap.find(sourceEndpoint);
 
-        if (it == d_sessionByLocalEndpointMap.end()) {
+        if (session == 0) {
             return ntsa::Error(ntsa::Error::e_INVALID);
         }
 
-        *result = it->second;
+        *result = *session;
     }
     else {
         return ntsa::Error(ntsa::Error::e_INVALID);
@@ -6155,6 +6386,22 @@ bsl::shared_ptr<ntci::Resolver> Machine::resolver() const
     return bsl::shared_ptr<ntci::Resolver>();
 }
 
+bool Machine::isVirtualTime() const
+{
+    return d_virtualTime;
+}
+
+bsls::TimeInterval Machine::currentTime() const
+{
+    if (d_virtualTime) {
+        bsls::TimeInterval result;
+        result.setTotalMicroseconds(d_virtualTimeInMicroseconds.load());
+        return result;
+    }
+
+    return bdlt::CurrentTime::now();
+}
+
 bsl::shared_ptr<ntcd::Machine> Machine::initialize()
 {
     bsls::SpinLockGuard lock(&s_defaultMachineLock);
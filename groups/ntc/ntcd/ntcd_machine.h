@@ -25,6 +25,7 @@ BSLS_IDENT("$Id: $")
 #include <ntcs_interest.h>
 #include <ntcscm_version.h>
 #include <ntsa_adapter.h>
+#include <ntsa_addressmap.h>
 #include <ntsa_endpoint.h>
 #include <ntsa_error.h>
 #include <ntsa_handle.h>
@@ -47,6 +48,7 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_threadgroup.h>
 #include <bslmt_threadutil.h>
 #include <bsls_atomic.h>
+#include <bsls_timeinterval.h>
 #include <bsl_bitset.h>
 #include <bsl_iosfwd.h>
 #include <bsl_list.h>
@@ -1012,11 +1014,18 @@ class Monitor : public ntccfg::Shared<Monitor>
     /// readiness of events for the sessions identified by those handles.
     typedef bsl::unordered_map<ntsa::Handle, bsl::shared_ptr<Entry> > EntryMap;
 
+    /// Define a type alias for a set of deadlines, in microseconds since
+    /// the Unix epoch, at which waiters blocked on 'dequeue' should be
+    /// unblocked when the machine operates in virtual time.
+    typedef bsl::multiset<bsl::int64_t> DeadlineSet;
+
     bslmt::Mutex                     d_mutex;
     bslmt::Condition                 d_condition;
     bsls::AtomicBool                 d_run;
     bsls::AtomicUint64               d_interrupt;
     bsls::AtomicUint64               d_waiters;
+    bsls::AtomicUint64               d_blocked;
+    DeadlineSet                      d_deadlineSet;
     EntryMap                         d_map;
     EntryQueue                       d_queue;
     bsl::shared_ptr<ntcd::Machine>   d_machine_sp;
@@ -1042,6 +1051,14 @@ class Monitor : public ntccfg::Shared<Monitor>
     /// queue and there is no interest in any event and no event is enabled.
     void removeQueueEntry(const bsl::shared_ptr<Entry>& entry);
 
+    /// Block the calling thread until signaled, while the machine operates
+    /// in virtual time, until the specified 'deadline', if any, expressed
+    /// as the number of microseconds since the Unix epoch in the virtual
+    /// time of the machine. Return true if the wait was satisfied by a
+    /// signal and false if the deadline has been reached. The behavior is
+    /// undefined unless 'd_mutex' is locked.
+    bool waitVirtual(const bsl::int64_t* deadline);
+
   public:
     /// Create a new monitor for the specified 'machine'. Optionally specify
     /// a 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
@@ -1150,6 +1167,11 @@ class Monitor : public ntccfg::Shared<Monitor>
     /// Unblock all waiters blocked on 'dequeue'.
     void interruptAll();
 
+    /// Unblock each waiter blocked on 'dequeue' until a deadline in virtual
+    /// time that is earlier than or equal to the current virtual time of
+    /// the machine.
+    void advance();
+
     /// Stop the monitor.
     void stop();
 
@@ -1163,6 +1185,15 @@ class Monitor : public ntccfg::Shared<Monitor>
     /// Return true if the implementation supports registering events having
     /// the specified 'trigger', otherwise return false.
     bool supportsTrigger(ntca::ReactorEventTrigger::Value trigger) const;
+
+    /// Return true if each waiter registered with this monitor is blocked
+    /// on 'dequeue' while the machine operates in virtual time and no event
+    /// or interruption is pending, otherwise return false. Load into the
+    /// specified 'earliestDeadline' the earliest deadline, in microseconds
+    /// since the Unix epoch in the virtual time of the machine, until which
+    /// any waiter is blocked, or the maximum 64-bit signed integer value if
+    /// no waiter is blocked until a deadline.
+    bool isIdle(bsl::int64_t* earliestDeadline);
 };
 
 /// @internal @brief
@@ -1180,7 +1211,7 @@ class Machine : public ntccfg::Shared<Machine>
 
     /// Define a type alias for a map of sessions indexed by
     /// endpoint.
-    typedef bsl::unordered_map<ntsa::Endpoint, bsl::weak_ptr<ntcd::Session> >
+    typedef ntsa::AddressMap<ntsa::Endpoint, bsl::weak_ptr<ntcd::Session> >
         SessionByEndpointMap;
 
     /// Define a type alias for a map of sessions indexed by
@@ -1188,6 +1219,9 @@ class Machine : public ntccfg::Shared<Machine>
     typedef bsl::map<ntcd::Binding, bsl::weak_ptr<ntcd::Session> >
         SessionByBindingMap;
 
+    /// Define a type alias for a list of monitors.
+    typedef bsl::vector<bsl::weak_ptr<ntcd::Monitor> > MonitorVector;
+
     mutable bslmt::Mutex           d_mutex;
     mutable bslmt::Condition       d_condition;
     bsl::string                    d_name;
@@ -1202,15 +1236,28 @@ class Machine : public ntccfg::Shared<Machine>
     SessionByBindingMap            d_sessionByTcpBindingMap;
     SessionByBindingMap            d_sessionByUdpBindingMap;
     SessionByBindingMap            d_sessionByLocalBindingMap;
+    MonitorVector                  d_monitorVector;
     bslmt::ThreadGroup             d_threadGroup;
     bsls::AtomicBool               d_stop;
     bsls::AtomicBool               d_update;
+    bsls::AtomicBool               d_virtualTime;
+    bsls::AtomicInt64              d_virtualTimeInMicroseconds;
     bslma::Allocator*              d_allocator_p;
 
   private:
     Machine(const Machine&) BSLS_KEYWORD_DELETED;
     Machine& operator=(const Machine&) BSLS_KEYWORD_DELETED;
 
+  private:
+    /// Advance the virtual time to the earliest deadline until which any
+    /// waiter on any monitor is blocked, if each waiter on each monitor is
+    /// blocked, and load into the specified 'result' the monitors whose
+    /// waiters should be unblocked. Return true if the virtual time has
+    /// been advanced, and false otherwise. The behavior is undefined
+    /// unless 'd_mutex' is locked.
+    bool privateAdvanceIdle(bsl::vector<bsl::shared_ptr<ntcd::Monitor> >*
+                                result);
+
   public:
     /// Create a new object. Optionally specify a 'basicAllocator' used to
     /// supply memory. If 'basicAllocator' is 0, the currently installed
@@ -1300,6 +1347,28 @@ class Machine : public ntccfg::Shared<Machine>
     /// not acquire a lock on the internal mutex.
     void updateNoLock(const bsl::shared_ptr<ntcd::Session>& session);
 
+    /// Notify the simulation that a waiter on a monitor has blocked, so
+    /// that the next call to step the simulation re-evaluates whether the
+    /// virtual time may be advanced.
+    void notifyBlocked();
+
+    /// Operate the machine in virtual time starting at the specified
+    /// 'currentTime'. The virtual time only advances when explicitly
+    /// advanced or when stepping the simulation while each waiter on each
+    /// monitor is blocked, in which case the virtual time advances
+    /// instantly to the earliest deadline until which any waiter is
+    /// blocked.
+    void enableVirtualTime(const bsls::TimeInterval& currentTime);
+
+    /// Operate the machine in real time.
+    void disableVirtualTime();
+
+    /// Advance the virtual time by the specified 'duration' and unblock
+    /// each waiter blocked until a deadline that has been reached. Return
+    /// the error, notably 'ntsa::Error::e_INVALID' if the machine does not
+    /// operate in virtual time.
+    ntsa::Error advanceTime(const bsls::TimeInterval& duration);
+
     /// Start a background thread and continuously step the simulation
     /// of each session on this machine, as necessary, until the machine
     /// is stopped.
@@ -1310,7 +1379,11 @@ class Machine : public ntccfg::Shared<Machine>
 
     /// Step the simulation of each session on this machine, as necessary.
     /// If the specified 'block' flag is true, block until each packet queue
-    /// is available to dequeue and enqueue. Return the error.
+    /// is available to dequeue and enqueue. If the machine operates in
+    /// virtual time and no session requires an update while each waiter on
+    /// each monitor is blocked, instead advance the virtual time to the
+    /// earliest deadline until which any waiter is blocked. Return the
+    /// error.
     ntsa::Error step(bool block);
 
     /// Stop stepping the simulation and join the background thread.
@@ -1374,6 +1447,15 @@ class Machine : public ntccfg::Shared<Machine>
     /// Return the resolver for this machine.
     bsl::shared_ptr<ntci::Resolver> resolver() const;
 
+    /// Return true if the machine operates in virtual time, otherwise
+    /// return false.
+    bool isVirtualTime() const;
+
+    /// Return the current elapsed time since the Unix epoch, in virtual
+    /// time if the machine operates in virtual time, and according to the
+    /// system clock otherwise.
+    bsls::TimeInterval currentTime() const;
+
     /// Initialize the default machine, if necessary. Return the current
     /// default machine.
     static bsl::shared_ptr<ntcd::Machine> initialize();
@@ -18,6 +18,7 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(ntcd_reactor_cpp, "$Id$ $CSID$")
 
+#include <ntccfg_bind.h>
 #include <ntccfg_limits.h>
 #include <ntci_log.h>
 #include <ntcm_monitorableutil.h>
@@ -234,6 +235,9 @@ void Reactor::initialize()
                                       d_allocator_p),
         d_allocator_p);
 
+    d_chronology_sp->setCurrentTimeFunction(
+        NTCCFG_BIND(&ntcd::Machine::currentTime, d_machine_sp));
+
 #if NTCCFG_PLATFORM_COMPILER_SUPPORTS_LAMDAS
     d_detachFunctor_sp.createInplace(d_allocator_p, [this](const auto& entry) {
         return this->removeDetached(entry);
@@ -1662,7 +1666,7 @@ const bsl::shared_ptr<ntci::Strand>& Reactor::strand() const
 
 bsls::TimeInterval Reactor::currentTime() const
 {
-    return bdlt::CurrentTime::now();
+    return d_machine_sp->currentTime();
 }
 
 const bsl::shared_ptr<bdlbb::BlobBufferFactory>& Reactor::
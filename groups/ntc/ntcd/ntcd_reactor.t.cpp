@@ -1221,10 +1221,145 @@ NTCCFG_TEST_CASE(3)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+namespace test {
+namespace case4 {
+
+void processTimer(bslmt::Latch*                       latch,
+                  const bsl::shared_ptr<ntci::Timer>& timer,
+                  const ntca::TimerEvent&             event)
+{
+    NTCCFG_WARNING_UNUSED(timer);
+
+    NTCI_LOG_CONTEXT();
+    NTCI_LOG_DEBUG("Timer event %s",
+                   ntca::TimerEventType::toString(event.type()));
+
+    if (event.type() == ntca::TimerEventType::e_DEADLINE) {
+        latch->arrive();
+    }
+}
+
+void execute(bslma::Allocator* allocator)
+{
+    ntsa::Error error;
+
+    // Create the simulation operating in virtual time.
+
+    bsl::shared_ptr<ntcd::Simulation> simulation;
+    simulation.createInplace(allocator, allocator);
+
+    simulation->enableVirtualTime(bdlt::CurrentTime::now());
+    NTCCFG_TEST_TRUE(simulation->isVirtualTime());
+
+    error = simulation->run();
+    NTCCFG_TEST_OK(error);
+
+    // Create the user.
+
+    bsl::shared_ptr<ntci::User> user;
+
+    // Create the reactor.
+
+    ntca::ReactorConfig reactorConfig;
+
+    reactorConfig.setMetricName("test");
+    reactorConfig.setMinThreads(1);
+    reactorConfig.setMaxThreads(1);
+
+    bsl::shared_ptr<ntcd::Reactor> reactor =
+        simulation->createReactor(reactorConfig, user, allocator);
+
+    // Register this thread as a thread that will wait on the reactor.
+
+    ntci::Waiter waiter = reactor->registerWaiter(ntca::WaiterOptions());
+
+    // Schedule a timer to fire one hour from now, in virtual time.
+
+    ntca::TimerOptions timerOptions;
+    timerOptions.setOneShot(false);
+    timerOptions.showEvent(ntca::TimerEventType::e_DEADLINE);
+    timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
+    timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
+
+    bslmt::Latch latch(1);
+
+    ntci::TimerCallback timerCallback(NTCCFG_BIND(&processTimer,
+                                                  &latch,
+                                                  NTCCFG_BIND_PLACEHOLDER_1,
+                                                  NTCCFG_BIND_PLACEHOLDER_2),
+                                      allocator);
+
+    bsl::shared_ptr<ntci::Timer> timer =
+        reactor->createTimer(timerOptions, timerCallback, allocator);
+
+    const bsls::TimeInterval deadline =
+        reactor->currentTime() + bsls::TimeInterval(60 * 60);
+
+    error = timer->schedule(deadline);
+    NTCCFG_TEST_OK(error);
+
+    // Wait for the timer to fire and ensure the virtual time has advanced to
+    // the deadline almost instantly in real time.
+
+    bsls::Stopwatch stopwatch;
+    stopwatch.start();
+
+    while (!latch.tryWait()) {
+        reactor->poll(waiter);
+    }
+
+    stopwatch.stop();
+
+    NTCCFG_TEST_GE(reactor->currentTime(), deadline);
+    NTCCFG_TEST_GE(simulation->currentTime(), deadline);
+    NTCCFG_TEST_LT(stopwatch.elapsedTime(), 60.0);
+
+    // Advance the virtual time explicitly.
+
+    const bsls::TimeInterval before = simulation->currentTime();
+
+    error = simulation->advanceTime(bsls::TimeInterval(10));
+    NTCCFG_TEST_OK(error);
+
+    NTCCFG_TEST_EQ(simulation->currentTime(),
+                   before + bsls::TimeInterval(10));
+
+    // Close the timer.
+
+    timer->close();
+
+    // Deregister the waiter.
+
+    reactor->deregisterWaiter(waiter);
+
+    // Stop the simulation.
+
+    simulation->stop();
+}
+
+}  // close namespace case4
+}  // close namespace test
+
+NTCCFG_TEST_CASE(4)
+{
+    // Concern: Timers scheduled far into the future fire without delay in
+    // real time when the simulation operates in virtual time.
+
+    NTCI_LOG_CONTEXT();
+    NTCI_LOG_CONTEXT_GUARD_OWNER("test");
+
+    ntccfg::TestAllocator ta;
+    {
+        test::case4::execute(&ta);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
     NTCCFG_TEST_REGISTER(2);
     NTCCFG_TEST_REGISTER(3);
+    NTCCFG_TEST_REGISTER(4);
 }
 NTCCFG_TEST_DRIVER_END;
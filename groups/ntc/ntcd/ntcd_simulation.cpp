@@ -113,6 +113,21 @@ ntsa::Error Simulation::step(bool block)
     return d_machine_sp->step(block);
 }
 
+void Simulation::enableVirtualTime(const bsls::TimeInterval& currentTime)
+{
+    d_machine_sp->enableVirtualTime(currentTime);
+}
+
+void Simulation::disableVirtualTime()
+{
+    d_machine_sp->disableVirtualTime();
+}
+
+ntsa::Error Simulation::advanceTime(const bsls::TimeInterval& duration)
+{
+    return d_machine_sp->advanceTime(duration);
+}
+
 void Simulation::stop()
 {
     return d_machine_sp->stop();
@@ -124,6 +139,16 @@ ntsa::Error Simulation::lookupSession(bsl::weak_ptr<ntcd::Session>* result,
     return d_machine_sp->lookupSession(result, handle);
 }
 
+bool Simulation::isVirtualTime() const
+{
+    return d_machine_sp->isVirtualTime();
+}
+
+bsls::TimeInterval Simulation::currentTime() const
+{
+    return d_machine_sp->currentTime();
+}
+
 ntsa::Error Simulation::createStreamSocketPair(
     bsl::shared_ptr<ntcd::StreamSocket>* client,
     bsl::shared_ptr<ntcd::StreamSocket>* server,
@@ -27,6 +27,7 @@ BSLS_IDENT("$Id: $")
 #include <ntcd_reactor.h>
 #include <ntcd_streamsocket.h>
 #include <ntcscm_version.h>
+#include <bsls_timeinterval.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
 #include <bsl_vector.h>
@@ -113,9 +114,28 @@ class Simulation
 
     /// Step the simulation of each session on each machine, as necessary.
     /// If the specified 'block' flag is true, block until each packet queue
-    /// is available to dequeue and enqueue. Return the error.
+    /// is available to dequeue and enqueue. If the simulation operates in
+    /// virtual time and no session requires an update while each reactor
+    /// and proactor thread is blocked, instead advance the virtual time
+    /// instantly to the earliest timer deadline. Return the error.
     ntsa::Error step(bool block);
 
+    /// Operate the simulation in virtual time starting at the specified
+    /// 'currentTime'. While operating in virtual time, the current time of
+    /// each reactor and proactor, and the deadlines of their timers, are
+    /// measured by a clock that only advances when explicitly advanced or
+    /// when the simulation is stepped while each reactor and proactor
+    /// thread is blocked waiting for the next timer deadline.
+    void enableVirtualTime(const bsls::TimeInterval& currentTime);
+
+    /// Operate the simulation in real time.
+    void disableVirtualTime();
+
+    /// Advance the virtual time by the specified 'duration'. Return the
+    /// error, notably 'ntsa::Error::e_INVALID' if the simulation does not
+    /// operate in virtual time.
+    ntsa::Error advanceTime(const bsls::TimeInterval& duration);
+
     /// Stop stepping the simulation and join the background thread for each
     /// machine.
     void stop();
@@ -125,6 +145,15 @@ class Simulation
     ntsa::Error lookupSession(bsl::weak_ptr<ntcd::Session>* result,
                               ntsa::Handle                  handle) const;
 
+    /// Return true if the simulation operates in virtual time, otherwise
+    /// return false.
+    bool isVirtualTime() const;
+
+    /// Return the current elapsed time since the Unix epoch, in virtual
+    /// time if the simulation operates in virtual time, and according to
+    /// the system clock otherwise.
+    bsls::TimeInterval currentTime() const;
+
     /// Load into the specified 'client' and 'server' a connected pair of
     /// stream sockets of the specified 'type'. Optionally specify a
     /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
@@ -23,7 +23,9 @@
 #include <bslim_printer.h>
 #include <bslma_allocator.h>
 #include <bslma_default.h>
-#include <bslmt_lockguard.h>
+#include <bslh_hash.h>
+#include <bslmt_readlockguard.h>
+#include <bslmt_writelockguard.h>
 #include <bsls_assert.h>
 
 namespace BloombergLP {
@@ -39,6 +41,9 @@ const bool        k_DEFAULT_NEGATIVE_CACHE_ENABLED          = true;
 const bsl::size_t k_DEFAULT_NEGATIVE_CACHE_MIN_TIME_TO_LIVE = 0;
 const bsl::size_t k_DEFAULT_NEGATIVE_CACHE_MAX_TIME_TO_LIVE =
     (bsl::size_t)(-1);
+const bool        k_DEFAULT_REFRESH_AHEAD_ENABLED  = true;
+const bsl::size_t k_DEFAULT_REFRESH_AHEAD_MIN_HITS = 2;
+const bsl::size_t k_DEFAULT_REFRESH_AHEAD_WINDOW   = 10;
 
 }  // close unnamed namespace
 
@@ -49,8 +54,8 @@ CacheHostEntry::CacheHostEntry(bslma::Allocator* basicAllocator)
 , d_timeToLive(0)
 , d_lastUpdate()
 , d_expiration()
-, d_iteratorByDomainName()
-, d_iteratorByIpAddress()
+, d_hits(0)
+, d_refreshing(false)
 {
 }
 
@@ -88,16 +93,14 @@ void CacheHostEntry::setExpiration(const bsls::TimeInterval& value)
     d_expiration = value;
 }
 
-void CacheHostEntry::setIteratorByDomainName(
-    ntcdns::CacheHostEntryByDomainNameIterator value)
+bsl::uint64_t CacheHostEntry::recordHit() const
 {
-    d_iteratorByDomainName = value;
+    return ++d_hits;
 }
 
-void CacheHostEntry::setIteratorByIpAddress(
-    ntcdns::CacheHostEntryByIpAddressIterator value)
+bool CacheHostEntry::acquireRefresh() const
 {
-    d_iteratorByIpAddress = value;
+    return !d_refreshing.testAndSwap(false, true);
 }
 
 const bsl::string& CacheHostEntry::domainName() const
@@ -130,18 +133,6 @@ const bsls::TimeInterval& CacheHostEntry::expiration() const
     return d_expiration;
 }
 
-ntcdns::CacheHostEntryByDomainNameIterator CacheHostEntry::
-    iteratorByDomainName() const
-{
-    return d_iteratorByDomainName;
-}
-
-ntcdns::CacheHostEntryByIpAddressIterator CacheHostEntry::iteratorByIpAddress()
-    const
-{
-    return d_iteratorByIpAddress;
-}
-
 bsl::ostream& CacheHostEntry::print(bsl::ostream& stream,
                                     int           level,
                                     int           spacesPerLevel) const
@@ -163,35 +154,163 @@ bsl::ostream& operator<<(bsl::ostream& stream, const CacheHostEntry& object)
     return object.print(stream, 0, -1);
 }
 
-void Cache::privateRemove(
-    const bsl::shared_ptr<ntcdns::CacheHostEntry>& cacheEntry)
+Cache::DomainNameShard::DomainNameShard(bslma::Allocator* basicAllocator)
+: d_lock()
+, d_map(basicAllocator)
+{
+}
+
+Cache::IpAddressShard::IpAddressShard(bslma::Allocator* basicAllocator)
+: d_lock()
+, d_map(basicAllocator)
+{
+}
+
+Cache::ServiceEntry::ServiceEntry(bslma::Allocator* basicAllocator)
+: d_serverList(basicAllocator)
+, d_nameServer()
+, d_expiration()
+{
+}
+
+Cache::ServiceEntry::ServiceEntry(const ServiceEntry& original,
+                                  bslma::Allocator*   basicAllocator)
+: d_serverList(original.d_serverList, basicAllocator)
+, d_nameServer(original.d_nameServer)
+, d_expiration(original.d_expiration)
+{
+}
+
+Cache::DomainNameShard* Cache::lookupShard(
+    const bslstl::StringRef& domainName) const
+{
+    bsl::size_t index = bslh::Hash<>()(domainName) % k_NUM_SHARDS;
+    return d_domainNameShards[index].get();
+}
+
+Cache::IpAddressShard* Cache::lookupShard(
+    const ntsa::IpAddress& ipAddress) const
+{
+    // Select the shard from bits of the hash that do not select the slot
+    // of the IP address in the table of the shard.
+
+    const bsl::uint64_t hash = ntsa::AddressHashUtil::hash(ipAddress);
+
+    bsl::size_t index = static_cast<bsl::size_t>(hash >> 48) % k_NUM_SHARDS;
+    return d_ipAddressShards[index].get();
+}
+
+void Cache::privateExpire(DomainNameShard*          shard,
+                          const bsl::string&        domainName,
+                          const bsls::TimeInterval& now) const
+{
+    NTCI_LOG_CONTEXT();
+
+    bslmt::WriteLockGuard<bslmt::ReadWriteLock> lock(&shard->d_lock);
+
+    ntcdns::CacheHostEntryByDomainNameIteratorPair range =
+        shard->d_map.equal_range(domainName);
+
+    ntcdns::CacheHostEntryByDomainNameIterator it = range.first;
+    ntcdns::CacheHostEntryByDomainNameIterator et = range.second;
+
+    while (it != et) {
+        if (now >= it->second->expiration()) {
+            bsl::shared_ptr<ntcdns::CacheHostEntry> cacheEntry = it->second;
+
+            it = shard->d_map.erase(it);
+            --d_cacheEntryCount;
+
+            NTCI_LOG_STREAM_TRACE
+                << "DNS cache removed host entry " << *cacheEntry
+                << ": expiration at " << cacheEntry->expiration()
+                << " is greater than or equal to now at " << now
+                << NTCI_LOG_STREAM_END;
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+void Cache::privateExpire(IpAddressShard*           shard,
+                          const ntsa::IpAddress&    ipAddress,
+                          const bsls::TimeInterval& now) const
 {
-    BSLS_ASSERT_OPT(cacheEntry->iteratorByDomainName() !=
-                    d_cacheEntryByDomainName.end());
+    NTCI_LOG_CONTEXT();
 
-    BSLS_ASSERT_OPT(cacheEntry->iteratorByIpAddress() !=
-                    d_cacheEntryByIpAddress.end());
+    bslmt::WriteLockGuard<bslmt::ReadWriteLock> lock(&shard->d_lock);
 
-    d_cacheEntryByDomainName.erase(cacheEntry->iteratorByDomainName());
+    const bsl::shared_ptr<ntcdns::CacheHostEntry>* existing =
+        shard->d_map.find(ipAddress);
 
-    d_cacheEntryByIpAddress.erase(cacheEntry->iteratorByIpAddress());
+    if (existing != 0 && now >= (*existing)->expiration()) {
+        bsl::shared_ptr<ntcdns::CacheHostEntry> cacheEntry;
+        shard->d_map.remove(&cacheEntry, ipAddress);
 
-    --d_cacheEntryCount;
+        NTCI_LOG_STREAM_TRACE << "DNS cache removed host entry " << *cacheEntry
+                              << ": expiration at " << cacheEntry->expiration()
+                              << " is greater than or equal to now at " << now
+                              << NTCI_LOG_STREAM_END;
+    }
+}
+
+bool Cache::isRefreshRequired(
+    const bsl::shared_ptr<ntcdns::CacheHostEntry>& cacheEntry,
+    bsl::uint64_t                                  hits,
+    const bsls::TimeInterval&                      now) const
+{
+    if (!d_refreshAheadEnabled) {
+        return false;
+    }
+
+    if (hits < d_refreshAheadMinHits) {
+        return false;
+    }
+
+    // The window is expressed as a percentage of the time-to-live, in
+    // seconds, so each percent is ten milliseconds per second.
+
+    bsls::TimeInterval window;
+    window.setTotalMilliseconds(static_cast<bsls::Types::Int64>(
+        cacheEntry->timeToLive() * 10 * d_refreshAheadWindow));
+
+    if (cacheEntry->expiration() - now > window) {
+        return false;
+    }
+
+    return cacheEntry->acquireRefresh();
 }
 
 Cache::Cache(bslma::Allocator* basicAllocator)
-: d_mutex()
-, d_cacheEntryByDomainName(basicAllocator)
-, d_cacheEntryByIpAddress(basicAllocator)
+: d_domainNameShards(basicAllocator)
+, d_ipAddressShards(basicAllocator)
 , d_cacheEntryCount(0)
+, d_serviceLock()
+, d_serviceEntryMap(basicAllocator)
 , d_positiveCacheEnabled(k_DEFAULT_POSITIVE_CACHE_ENABLED)
 , d_positiveCacheMinTimeToLive(k_DEFAULT_POSITIVE_CACHE_MIN_TIME_TO_LIVE)
 , d_positiveCacheMaxTimeToLive(k_DEFAULT_POSITIVE_CACHE_MAX_TIME_TO_LIVE)
 , d_negativeCacheEnabled(k_DEFAULT_NEGATIVE_CACHE_ENABLED)
 , d_negativeCacheMinTimeToLive(k_DEFAULT_NEGATIVE_CACHE_MIN_TIME_TO_LIVE)
 , d_negativeCacheMaxTimeToLive(k_DEFAULT_NEGATIVE_CACHE_MAX_TIME_TO_LIVE)
+, d_refreshAheadEnabled(k_DEFAULT_REFRESH_AHEAD_ENABLED)
+, d_refreshAheadMinHits(k_DEFAULT_REFRESH_AHEAD_MIN_HITS)
+, d_refreshAheadWindow(k_DEFAULT_REFRESH_AHEAD_WINDOW)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
+    d_domainNameShards.reserve(k_NUM_SHARDS);
+    d_ipAddressShards.reserve(k_NUM_SHARDS);
+
+    for (bsl::size_t i = 0; i < k_NUM_SHARDS; ++i) {
+        bsl::shared_ptr<DomainNameShard> domainNameShard;
+        domainNameShard.createInplace(d_allocator_p, d_allocator_p);
+        d_domainNameShards.push_back(domainNameShard);
+
+        bsl::shared_ptr<IpAddressShard> ipAddressShard;
+        ipAddressShard.createInplace(d_allocator_p, d_allocator_p);
+        d_ipAddressShards.push_back(ipAddressShard);
+    }
 }
 
 Cache::~Cache()
@@ -228,158 +347,98 @@ void Cache::setNegativeCacheMaxTimeToLive(bsl::size_t value)
     d_negativeCacheMaxTimeToLive = value;
 }
 
-void Cache::clear()
+void Cache::setRefreshAheadEnabled(bool value)
 {
-    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-
-    d_cacheEntryByDomainName.clear();
-    d_cacheEntryByIpAddress.clear();
-    d_cacheEntryCount = 0;
+    d_refreshAheadEnabled = value;
 }
 
-void Cache::updateHost(const bsl::string&        domainName,
-                       const ntsa::IpAddress&    ipAddress,
-                       const ntsa::Endpoint&     nameServer,
-                       bsl::size_t               timeToLive,
-                       const bsls::TimeInterval& now)
+void Cache::setRefreshAheadMinHits(bsl::size_t value)
 {
-    NTCI_LOG_CONTEXT();
-
-    bsl::shared_ptr<ntcdns::CacheHostEntry> newCacheEntry;
-    bool                                    oldCacheEntryUpdated = false;
-
-    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-
-    {
-        bool mustInsert = true;
-
-        ntcdns::CacheHostEntryByDomainNameIteratorPair range =
-            d_cacheEntryByDomainName.equal_range(domainName);
-
-        if (range.first != d_cacheEntryByDomainName.end()) {
-            ntcdns::CacheHostEntryByDomainNameIterator it = range.first;
-            ntcdns::CacheHostEntryByDomainNameIterator et = range.second;
+    d_refreshAheadMinHits = value;
+}
 
-            while (true) {
-                if (it == et) {
-                    break;
-                }
+void Cache::setRefreshAheadWindow(bsl::size_t value)
+{
+    d_refreshAheadWindow = value;
+}
 
-                const bsl::shared_ptr<ntcdns::CacheHostEntry>& cacheEntry =
-                    it->second;
+void Cache::clear()
+{
+    for (bsl::size_t i = 0; i < k_NUM_SHARDS; ++i) {
+        DomainNameShard* shard = d_domainNameShards[i].get();
 
-                if (cacheEntry->ipAddress() == ipAddress) {
-                    if (!oldCacheEntryUpdated) {
-                        cacheEntry->setNameServer(nameServer);
-                        cacheEntry->setTimeToLive(timeToLive);
-                        cacheEntry->setLastUpdate(now);
-                        cacheEntry->setExpiration(
-                            now + bsls::TimeInterval(timeToLive, 0));
-
-                        NTCI_LOG_STREAM_TRACE
-                            << "DNS cache updated host entry " << *cacheEntry
-                            << NTCI_LOG_STREAM_END;
-
-                        oldCacheEntryUpdated = true;
-                    }
-
-                    mustInsert = false;
-                    ++it;
-                }
-                else if (now >= cacheEntry->expiration()) {
-                    ntcdns::CacheHostEntryByDomainNameIterator jt = it;
-
-                    bsl::shared_ptr<ntcdns::CacheHostEntry> cacheEntry =
-                        jt->second;
-
-                    ++it;
-
-                    BSLS_ASSERT_OPT(jt == cacheEntry->iteratorByDomainName());
-
-                    this->privateRemove(cacheEntry);
-
-                    NTCI_LOG_STREAM_TRACE
-                        << "DNS cache removed host entry " << *cacheEntry
-                        << ": expiration at " << cacheEntry->expiration()
-                        << " is greater than or equal to now at " << now
-                        << NTCI_LOG_STREAM_END;
-                }
-                else {
-                    ++it;
-                }
-            }
-        }
+        bslmt::WriteLockGuard<bslmt::ReadWriteLock> lock(&shard->d_lock);
 
-        if (mustInsert) {
-            if (!newCacheEntry) {
-                newCacheEntry.createInplace(d_allocator_p, d_allocator_p);
+        d_cacheEntryCount.subtract(shard->d_map.size());
+        shard->d_map.clear();
+    }
 
-                newCacheEntry->setDomainName(domainName);
-                newCacheEntry->setIpAddress(ipAddress);
-                newCacheEntry->setNameServer(nameServer);
-                newCacheEntry->setTimeToLive(timeToLive);
-                newCacheEntry->setLastUpdate(now);
-                newCacheEntry->setExpiration(
-                    now + bsls::TimeInterval(timeToLive, 0));
+    for (bsl::size_t i = 0; i < k_NUM_SHARDS; ++i) {
+        IpAddressShard* shard = d_ipAddressShards[i].get();
 
-                newCacheEntry->setIteratorByDomainName(
-                    d_cacheEntryByDomainName.end());
+        bslmt::WriteLockGuard<bslmt::ReadWriteLock> lock(&shard->d_lock);
+        shard->d_map.clear();
+    }
 
-                newCacheEntry->setIteratorByIpAddress(
-                    d_cacheEntryByIpAddress.end());
+    {
+        bslmt::WriteLockGuard<bslmt::ReadWriteLock> lock(&d_serviceLock);
+        d_serviceEntryMap.clear();
+    }
+}
 
-                ++d_cacheEntryCount;
-            }
+void Cache::updateHost(const bsl::string&        domainName,
+                       const ntsa::IpAddress&    ipAddress,
+                       const ntsa::Endpoint&     nameServer,
+                       bsl::size_t               timeToLive,
+                       const bsls::TimeInterval& now)
+{
+    NTCI_LOG_CONTEXT();
 
-            ntcdns::CacheHostEntryByDomainNameIterator
-                newCacheEntryIteratorByDomainName =
-                    d_cacheEntryByDomainName.insert(
-                        ntcdns::CacheHostEntryByDomainName::value_type(
-                            domainName,
-                            newCacheEntry));
+    // Host entries are never modified once they are visible to lookups, so
+    // that lookups may read them while holding only a read lock on a single
+    // shard. Instead, create a new host entry and replace any existing host
+    // entry for the same association in each index, locking each shard in
+    // turn.
 
-            newCacheEntry->setIteratorByDomainName(
-                newCacheEntryIteratorByDomainName);
+    bsl::shared_ptr<ntcdns::CacheHostEntry> newCacheEntry;
+    newCacheEntry.createInplace(d_allocator_p, d_allocator_p);
 
-            NTCI_LOG_STREAM_TRACE << "DNS cache inserted host entry "
-                                  << *newCacheEntry << NTCI_LOG_STREAM_END;
-        }
-    }
+    newCacheEntry->setDomainName(domainName);
+    newCacheEntry->setIpAddress(ipAddress);
+    newCacheEntry->setNameServer(nameServer);
+    newCacheEntry->setTimeToLive(timeToLive);
+    newCacheEntry->setLastUpdate(now);
+    newCacheEntry->setExpiration(now + bsls::TimeInterval(timeToLive, 0));
 
     {
-        bool mustInsert = true;
+        DomainNameShard* shard = this->lookupShard(domainName);
 
-        ntcdns::CacheHostEntryByIpAddressIterator it =
-            d_cacheEntryByIpAddress.find(ipAddress);
+        bslmt::WriteLockGuard<bslmt::ReadWriteLock> lock(&shard->d_lock);
 
-        if (it != d_cacheEntryByIpAddress.end()) {
-            const bsl::shared_ptr<ntcdns::CacheHostEntry>& cacheEntry =
-                it->second;
+        bool replaced = false;
 
-            if (cacheEntry->ipAddress() == ipAddress) {
-                if (!oldCacheEntryUpdated) {
-                    cacheEntry->setNameServer(nameServer);
-                    cacheEntry->setTimeToLive(timeToLive);
-                    cacheEntry->setLastUpdate(now);
-                    cacheEntry->setExpiration(
-                        now + bsls::TimeInterval(timeToLive, 0));
+        ntcdns::CacheHostEntryByDomainNameIteratorPair range =
+            shard->d_map.equal_range(domainName);
 
-                    NTCI_LOG_STREAM_TRACE << "DNS cache updated host entry "
-                                          << *cacheEntry
-                                          << NTCI_LOG_STREAM_END;
+        ntcdns::CacheHostEntryByDomainNameIterator it = range.first;
+        ntcdns::CacheHostEntryByDomainNameIterator et = range.second;
 
-                    oldCacheEntryUpdated = true;
-                }
+        while (it != et) {
+            if (it->second->ipAddress() == ipAddress) {
+                it->second = newCacheEntry;
+                replaced   = true;
 
-                mustInsert = false;
+                NTCI_LOG_STREAM_TRACE << "DNS cache updated host entry "
+                                      << *newCacheEntry
+                                      << NTCI_LOG_STREAM_END;
+                ++it;
             }
-            else if (now >= cacheEntry->expiration()) {
+            else if (now >= it->second->expiration()) {
                 bsl::shared_ptr<ntcdns::CacheHostEntry> cacheEntry =
                     it->second;
 
-                BSLS_ASSERT_OPT(it == cacheEntry->iteratorByIpAddress());
-
-                this->privateRemove(cacheEntry);
+                it = shard->d_map.erase(it);
+                --d_cacheEntryCount;
 
                 NTCI_LOG_STREAM_TRACE
                     << "DNS cache removed host entry " << *cacheEntry
@@ -387,57 +446,38 @@ void Cache::updateHost(const bsl::string&        domainName,
                     << " is greater than or equal to now at " << now
                     << NTCI_LOG_STREAM_END;
             }
-        }
-
-        if (mustInsert) {
-            if (!newCacheEntry) {
-                // MRM: Logically, the new cache entry must have been created.
-                BSLS_ASSERT_OPT(newCacheEntry);
-
-                newCacheEntry.createInplace(d_allocator_p, d_allocator_p);
-
-                newCacheEntry->setDomainName(domainName);
-                newCacheEntry->setIpAddress(ipAddress);
-                newCacheEntry->setNameServer(nameServer);
-                newCacheEntry->setTimeToLive(timeToLive);
-                newCacheEntry->setLastUpdate(now);
-                newCacheEntry->setExpiration(
-                    now + bsls::TimeInterval(timeToLive, 0));
-
-                newCacheEntry->setIteratorByDomainName(
-                    d_cacheEntryByDomainName.end());
-
-                newCacheEntry->setIteratorByIpAddress(
-                    d_cacheEntryByIpAddress.end());
-
-                ++d_cacheEntryCount;
+            else {
+                ++it;
             }
+        }
 
-            bsl::pair<ntcdns::CacheHostEntryByIpAddressIterator, bool>
-                insertResult = d_cacheEntryByIpAddress.insert(
-                    ntcdns::CacheHostEntryByIpAddress::value_type(
-                        ipAddress,
-                        newCacheEntry));
-
-            BSLS_ASSERT_OPT(insertResult.second);
-
-            ntcdns::CacheHostEntryByIpAddressIterator
-                newCacheEntryIteratorByIpAddress = insertResult.first;
-
-            newCacheEntry->setIteratorByIpAddress(
-                newCacheEntryIteratorByIpAddress);
+        if (!replaced) {
+            shard->d_map.insert(
+                ntcdns::CacheHostEntryByDomainName::value_type(
+                    domainName,
+                    newCacheEntry));
+            ++d_cacheEntryCount;
 
             NTCI_LOG_STREAM_TRACE << "DNS cache inserted host entry "
                                   << *newCacheEntry << NTCI_LOG_STREAM_END;
         }
     }
+
+    {
+        IpAddressShard* shard = this->lookupShard(ipAddress);
+
+        bslmt::WriteLockGuard<bslmt::ReadWriteLock> lock(&shard->d_lock);
+
+        shard->d_map.set(ipAddress, newCacheEntry);
+    }
 }
 
 ntsa::Error Cache::getIpAddress(ntca::GetIpAddressContext*       context,
                                 bsl::vector<ntsa::IpAddress>*    result,
                                 const bslstl::StringRef&         domainName,
                                 const ntca::GetIpAddressOptions& options,
-                                const bsls::TimeInterval&        now) const
+                                const bsls::TimeInterval&        now,
+                                bool*                            refresh) const
 {
     // Some versions of GCC erroneously warn when 'timeToLive.value()' is
     // called even when protected by a check of '!timeToLive.isNull()'.
@@ -450,6 +490,10 @@ ntsa::Error Cache::getIpAddress(ntca::GetIpAddressContext*       context,
 
     ntsa::Error error;
 
+    if (refresh) {
+        *refresh = false;
+    }
+
     NTCI_LOG_STREAM_TRACE
         << "DNS cache looking up host entry for domain name '" << domainName
         << "' at time " << now << NTCI_LOG_STREAM_END;
@@ -457,6 +501,8 @@ ntsa::Error Cache::getIpAddress(ntca::GetIpAddressContext*       context,
     bsl::vector<ntsa::IpAddress>            ipAddressList;
     bdlb::NullableValue<ntsa::Endpoint>     nameServer;
     bdlb::NullableValue<bsls::TimeInterval> timeToLive;
+    bool                                    expired       = false;
+    bool                                    refreshNeeded = false;
 
     bdlb::NullableValue<ntsa::IpAddressType::Value> ipAddressType;
     error = ntcdns::Compat::convert(&ipAddressType, options);
@@ -464,84 +510,83 @@ ntsa::Error Cache::getIpAddress(ntca::GetIpAddressContext*       context,
         return error;
     }
 
-    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-
     bsl::string key = domainName;
 
-    ntcdns::CacheHostEntryByDomainNameIteratorPair range =
-        d_cacheEntryByDomainName.equal_range(key);
+    DomainNameShard* shard = this->lookupShard(key);
 
-    if (range.first == d_cacheEntryByDomainName.end()) {
-        NTCI_LOG_STREAM_TRACE
-            << "DNS cache found no host entry for domain name '" << domainName
-            << "'" << NTCI_LOG_STREAM_END;
-        return ntsa::Error(ntsa::Error::e_EOF);
-    }
+    {
+        bslmt::ReadLockGuard<bslmt::ReadWriteLock> lock(&shard->d_lock);
 
-    ntcdns::CacheHostEntryByDomainNameIterator it = range.first;
-    ntcdns::CacheHostEntryByDomainNameIterator et = range.second;
+        ntcdns::CacheHostEntryByDomainNameIteratorPair range =
+            shard->d_map.equal_range(key);
 
-    while (true) {
-        if (it == et) {
-            break;
+        if (range.first == range.second) {
+            NTCI_LOG_STREAM_TRACE
+                << "DNS cache found no host entry for domain name '"
+                << domainName << "'" << NTCI_LOG_STREAM_END;
+            return ntsa::Error(ntsa::Error::e_EOF);
         }
 
-        const bsl::shared_ptr<ntcdns::CacheHostEntry>& cacheEntry = it->second;
+        ntcdns::CacheHostEntryByDomainNameIterator it = range.first;
+        ntcdns::CacheHostEntryByDomainNameIterator et = range.second;
 
-        if (now >= cacheEntry->expiration()) {
-            ntcdns::CacheHostEntryByDomainNameIterator jt = it;
+        for (; it != et; ++it) {
+            const bsl::shared_ptr<ntcdns::CacheHostEntry>& cacheEntry =
+                it->second;
 
-            bsl::shared_ptr<ntcdns::CacheHostEntry> cacheEntry = jt->second;
+            if (now >= cacheEntry->expiration()) {
+                expired = true;
+                continue;
+            }
 
-            ++it;
+            if (!ipAddressType.isNull() &&
+                cacheEntry->ipAddress().type() != ipAddressType.value())
+            {
+                continue;
+            }
 
-            BSLS_ASSERT_OPT(jt == cacheEntry->iteratorByDomainName());
+            if (bsl::find(ipAddressList.begin(),
+                          ipAddressList.end(),
+                          cacheEntry->ipAddress()) != ipAddressList.end())
+            {
+                continue;
+            }
 
-            const_cast<Cache*>(this)->privateRemove(cacheEntry);
+            NTCI_LOG_STREAM_TRACE << "DNS cache found host entry "
+                                  << *cacheEntry << " for domain name '"
+                                  << domainName << "'" << NTCI_LOG_STREAM_END;
 
-            NTCI_LOG_STREAM_TRACE
-                << "DNS cache removed host entry " << *cacheEntry
-                << ": expiration at " << cacheEntry->expiration()
-                << " is greater than or equal to now at " << now
-                << NTCI_LOG_STREAM_END;
-        }
-        else {
-            if (ipAddressType.isNull() ||
-                cacheEntry->ipAddress().type() == ipAddressType.value())
-            {
-                if (bsl::find(ipAddressList.begin(),
-                              ipAddressList.end(),
-                              cacheEntry->ipAddress()) == ipAddressList.end())
-                {
-                    NTCI_LOG_STREAM_TRACE
-                        << "DNS cache found host entry " << *cacheEntry
-                        << " for domain name '" << domainName << "'"
-                        << NTCI_LOG_STREAM_END;
-                    ipAddressList.push_back(cacheEntry->ipAddress());
-
-                    if (nameServer.isNull()) {
-                        nameServer.makeValue(cacheEntry->nameServer());
-                    }
-                    else if (nameServer.value() != cacheEntry->nameServer()) {
-                        // MRM: Warn
-                    }
-
-                    bsls::TimeInterval newTimeToLive =
-                        cacheEntry->expiration() - now;
-
-                    if (timeToLive.isNull()) {
-                        timeToLive.makeValue(newTimeToLive);
-                    }
-                    else if (timeToLive.value() > newTimeToLive) {
-                        // MRM: Warn
-                        timeToLive.makeValue(newTimeToLive);
-                    }
-                }
+            ipAddressList.push_back(cacheEntry->ipAddress());
+
+            if (nameServer.isNull()) {
+                nameServer.makeValue(cacheEntry->nameServer());
+            }
+            else if (nameServer.value() != cacheEntry->nameServer()) {
+                // MRM: Warn
+            }
+
+            bsls::TimeInterval newTimeToLive = cacheEntry->expiration() - now;
+
+            if (timeToLive.isNull()) {
+                timeToLive.makeValue(newTimeToLive);
+            }
+            else if (timeToLive.value() > newTimeToLive) {
+                // MRM: Warn
+                timeToLive.makeValue(newTimeToLive);
+            }
+
+            const bsl::uint64_t hits = cacheEntry->recordHit();
+
+            if (!refreshNeeded) {
+                refreshNeeded = this->isRefreshRequired(cacheEntry, hits, now);
             }
-            ++it;
         }
     }
 
+    if (expired) {
+        this->privateExpire(shard, key, now);
+    }
+
     if (ipAddressType.isNull()) {
         ntsu::ResolverUtil::sortIpAddressList(&ipAddressList);
     }
@@ -571,6 +616,10 @@ ntsa::Error Cache::getIpAddress(ntca::GetIpAddressContext*       context,
                                         ipAddressList.size()]);
     }
 
+    if (refresh) {
+        *refresh = refreshNeeded;
+    }
+
     return ntsa::Error();
 
 #if defined(BSLS_PLATFORM_CMP_GNU)
@@ -578,103 +627,147 @@ ntsa::Error Cache::getIpAddress(ntca::GetIpAddressContext*       context,
 #endif
 }
 
-ntsa::Error Cache::getDomainName(ntca::GetDomainNameContext*       context,
-                                 bsl::string*                      result,
-                                 const ntsa::IpAddress&            ipAddress,
-                                 const ntca::GetDomainNameOptions& options,
-                                 const bsls::TimeInterval&         now) const
+void Cache::updateService(
+    const bsl::string&                                name,
+    const bsl::vector<ntcdns::ResourceRecordDataSvr>& serverList,
+    const ntsa::Endpoint&                             nameServer,
+    bsl::size_t                                       timeToLive,
+    const bsls::TimeInterval&                         now)
 {
-    // Some versions of GCC erroneously warn when 'timeToLive.value()' is
-    // called even when protected by a check of '!timeToLive.isNull()'.
-#if defined(BSLS_PLATFORM_CMP_GNU)
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
-#endif
+    NTCI_LOG_CONTEXT();
 
-    NTCCFG_WARNING_UNUSED(options);
+    bslmt::WriteLockGuard<bslmt::ReadWriteLock> lock(&d_serviceLock);
 
-    NTCI_LOG_CONTEXT();
+    ServiceEntry& serviceEntry = d_serviceEntryMap[name];
 
-    ntsa::Error error;
+    serviceEntry.d_serverList = serverList;
+    serviceEntry.d_nameServer = nameServer;
+    serviceEntry.d_expiration = now + bsls::TimeInterval(timeToLive, 0);
 
-    NTCI_LOG_STREAM_TRACE << "DNS cache looking up host entry for IP address '"
-                          << ipAddress << "' at time " << now
+    NTCI_LOG_STREAM_TRACE << "DNS cache updated " << serverList.size()
+                          << " server(s) for service name '" << name
+                          << "' expiring at " << serviceEntry.d_expiration
                           << NTCI_LOG_STREAM_END;
+}
 
-    bsl::string                             domainName;
-    bdlb::NullableValue<ntsa::Endpoint>     nameServer;
-    bdlb::NullableValue<bsls::TimeInterval> timeToLive;
+ntsa::Error Cache::getServerList(
+    ntca::GetServiceEndpointsContext*           context,
+    bsl::vector<ntcdns::ResourceRecordDataSvr>* result,
+    const bslstl::StringRef&                    name,
+    const bsls::TimeInterval&                   now) const
+{
+    NTCI_LOG_CONTEXT();
 
-    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    bsl::string key = name;
 
-    ntcdns::CacheHostEntryByIpAddressIterator it =
-        d_cacheEntryByIpAddress.find(ipAddress);
+    bool expired = false;
 
-    if (it == d_cacheEntryByIpAddress.end()) {
-        return ntsa::Error(ntsa::Error::e_EOF);
+    {
+        bslmt::ReadLockGuard<bslmt::ReadWriteLock> lock(&d_serviceLock);
+
+        ServiceEntryMap::const_iterator it = d_serviceEntryMap.find(key);
+        if (it == d_serviceEntryMap.end()) {
+            NTCI_LOG_STREAM_TRACE
+                << "DNS cache found no servers for service name '" << name
+                << "'" << NTCI_LOG_STREAM_END;
+            return ntsa::Error(ntsa::Error::e_EOF);
+        }
+
+        const ServiceEntry& serviceEntry = it->second;
+
+        if (now >= serviceEntry.d_expiration) {
+            expired = true;
+        }
+        else {
+            *result = serviceEntry.d_serverList;
+
+            context->setName(key);
+            context->setSource(ntca::ResolverSource::e_CACHE);
+            context->setNameServer(serviceEntry.d_nameServer);
+            context->setTimeToLive(NTCCFG_WARNING_NARROW(
+                bsl::size_t,
+                (serviceEntry.d_expiration - now).totalSeconds()));
+        }
     }
 
-    bsl::shared_ptr<ntcdns::CacheHostEntry> cacheEntry = it->second;
+    if (expired) {
+        bslmt::WriteLockGuard<bslmt::ReadWriteLock> lock(&d_serviceLock);
 
-    if (now >= cacheEntry->expiration()) {
-        BSLS_ASSERT_OPT(it == cacheEntry->iteratorByIpAddress());
+        ServiceEntryMap::iterator it = d_serviceEntryMap.find(key);
+        if (it != d_serviceEntryMap.end() && now >= it->second.d_expiration)
+        {
+            d_serviceEntryMap.erase(it);
 
-        const_cast<Cache*>(this)->privateRemove(cacheEntry);
+            NTCI_LOG_STREAM_TRACE << "DNS cache removed servers for service "
+                                  << "name '" << name << "': expired"
+                                  << NTCI_LOG_STREAM_END;
+        }
 
-        NTCI_LOG_STREAM_TRACE << "DNS cache removed host entry " << *cacheEntry
-                              << ": expiration at " << cacheEntry->expiration()
-                              << " is greater than or equal to now at " << now
-                              << NTCI_LOG_STREAM_END;
+        return ntsa::Error(ntsa::Error::e_EOF);
     }
-    else {
-        NTCI_LOG_STREAM_TRACE << "DNS cache found host entry " << *cacheEntry
-                              << " for IP address " << ipAddress
-                              << NTCI_LOG_STREAM_END;
 
-        domainName = cacheEntry->domainName();
+    return ntsa::Error();
+}
 
-        if (nameServer.isNull()) {
-            nameServer.makeValue(cacheEntry->nameServer());
-        }
-        else if (nameServer.value() != cacheEntry->nameServer()) {
-            // MRM: Warn
-        }
+ntsa::Error Cache::getDomainName(ntca::GetDomainNameContext*       context,
+                                 bsl::string*                      result,
+                                 const ntsa::IpAddress&            ipAddress,
+                                 const ntca::GetDomainNameOptions& options,
+                                 const bsls::TimeInterval&         now) const
+{
+    NTCCFG_WARNING_UNUSED(options);
 
-        bsls::TimeInterval newTimeToLive = cacheEntry->expiration() - now;
+    NTCI_LOG_CONTEXT();
 
-        if (timeToLive.isNull()) {
-            timeToLive.makeValue(newTimeToLive);
-        }
-        else if (timeToLive.value() > newTimeToLive) {
-            // MRM: Warn
-            timeToLive.makeValue(newTimeToLive);
+    NTCI_LOG_STREAM_TRACE << "DNS cache looking up host entry for IP address '"
+                          << ipAddress << "' at time " << now
+                          << NTCI_LOG_STREAM_END;
+
+    bsl::shared_ptr<ntcdns::CacheHostEntry> cacheEntry;
+
+    IpAddressShard* shard = this->lookupShard(ipAddress);
+
+    {
+        bslmt::ReadLockGuard<bslmt::ReadWriteLock> lock(&shard->d_lock);
+
+        const bsl::shared_ptr<ntcdns::CacheHostEntry>* existing =
+            shard->d_map.find(ipAddress);
+
+        if (existing == 0) {
+            return ntsa::Error(ntsa::Error::e_EOF);
         }
+
+        cacheEntry = *existing;
     }
 
-    if (domainName.empty()) {
+    // The host entry is never modified once inserted, so it may be inspected
+    // without holding the lock.
+
+    if (now >= cacheEntry->expiration()) {
+        this->privateExpire(shard, ipAddress, now);
         return ntsa::Error(ntsa::Error::e_EOF);
     }
 
-    context->setIpAddress(ipAddress);
-    context->setSource(ntca::ResolverSource::e_CACHE);
+    NTCI_LOG_STREAM_TRACE << "DNS cache found host entry " << *cacheEntry
+                          << " for IP address " << ipAddress
+                          << NTCI_LOG_STREAM_END;
 
-    if (!nameServer.isNull()) {
-        context->setNameServer(nameServer.value());
+    if (cacheEntry->domainName().empty()) {
+        return ntsa::Error(ntsa::Error::e_EOF);
     }
 
-    if (!timeToLive.isNull()) {
-        context->setTimeToLive(
-            NTCCFG_WARNING_NARROW(bsl::size_t,
-                                  timeToLive.value().totalSeconds()));
-    }
+    cacheEntry->recordHit();
+
+    context->setIpAddress(ipAddress);
+    context->setSource(ntca::ResolverSource::e_CACHE);
+    context->setNameServer(cacheEntry->nameServer());
+    context->setTimeToLive(NTCCFG_WARNING_NARROW(
+        bsl::size_t,
+        (cacheEntry->expiration() - now).totalSeconds()));
 
-    *result = domainName;
+    *result = cacheEntry->domainName();
 
     return ntsa::Error();
-
-#if defined(BSLS_PLATFORM_CMP_GNU)
-#pragma GCC diagnostic pop
-#endif
 }
 
 ntsa::Error Cache::getPort(ntca::GetPortContext*       context,
@@ -717,5 +810,11 @@ bsl::size_t Cache::numPortEntries() const
     return 0;
 }
 
+bsl::size_t Cache::numServiceEntries() const
+{
+    bslmt::ReadLockGuard<bslmt::ReadWriteLock> lock(&d_serviceLock);
+    return d_serviceEntryMap.size();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -21,15 +21,21 @@
 #include <ntcdns_vocabulary.h>
 #include <ntcscm_version.h>
 
+#include <ntca_getserviceendpointscontext.h>
+#include <ntccfg_platform.h>
+
 #include <ntsa_domainname.h>
 #include <ntsa_endpoint.h>
 #include <ntsa_error.h>
+#include <ntsa_addressmap.h>
 #include <ntsa_ipaddress.h>
 #include <ntsa_port.h>
 
-#include <bslmt_mutex.h>
+#include <bslmt_readwritelock.h>
+#include <bsls_atomic.h>
 #include <bsls_timeinterval.h>
 
+#include <bsl_cstdint.h>
 #include <bsl_map.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
@@ -71,41 +77,34 @@ typedef bsl::pair<CacheHostEntryByDomainName::iterator,
     CacheHostEntryByDomainNameIteratorPair;
 
 /// @internal @brief
-/// Define a type alias for a multi-valued association
-/// between an IP address and the cached entries that describe the
-/// association between the IP address and the last known domain name to
-/// which it has been assigned.
+/// Define a type alias for an association between an IP address and the
+/// cached entry that describes the association between the IP address and
+/// the last known domain name to which it has been assigned.
 ///
 /// @ingroup module_ntcdns
-typedef bsl::unordered_map<ntsa::IpAddress,
-                           bsl::shared_ptr<ntcdns::CacheHostEntry> >
+typedef ntsa::AddressMap<ntsa::IpAddress,
+                         bsl::shared_ptr<ntcdns::CacheHostEntry> >
     CacheHostEntryByIpAddress;
 
-/// @internal @brief
-/// Define a type alias to a key-value pair in a host
-/// entry cache keyed by domain names.
-///
-/// @ingroup module_ntcdns
-typedef CacheHostEntryByIpAddress::iterator CacheHostEntryByIpAddressIterator;
-
 /// @internal @brief
 /// Describe a cached association between a domain name and an IP address.
 ///
 /// @par Thread Safety
-/// This class is not thread safe.
+/// This class is not thread safe, except that 'recordHit' and
+/// 'acquireRefresh' may be called concurrently with each other and with any
+/// accessor.
 ///
 /// @ingroup module_ntcdns
 class CacheHostEntry
 {
-    bsl::string        d_domainName;
-    ntsa::IpAddress    d_ipAddress;
-    ntsa::Endpoint     d_nameServer;
-    bsl::size_t        d_timeToLive;
-    bsls::TimeInterval d_lastUpdate;
-    bsls::TimeInterval d_expiration;
-
-    ntcdns::CacheHostEntryByDomainNameIterator d_iteratorByDomainName;
-    ntcdns::CacheHostEntryByIpAddressIterator  d_iteratorByIpAddress;
+    bsl::string                d_domainName;
+    ntsa::IpAddress            d_ipAddress;
+    ntsa::Endpoint             d_nameServer;
+    bsl::size_t                d_timeToLive;
+    bsls::TimeInterval         d_lastUpdate;
+    bsls::TimeInterval         d_expiration;
+    mutable bsls::AtomicUint64 d_hits;
+    mutable bsls::AtomicBool   d_refreshing;
 
   private:
     CacheHostEntry(const CacheHostEntry&) BSLS_KEYWORD_DELETED;
@@ -140,15 +139,13 @@ class CacheHostEntry
     /// validity expires to the specified 'value'.
     void setExpiration(const bsls::TimeInterval& value);
 
-    /// Set the iterator to the entry in the map keyed by domain name to the
-    /// specified 'value'.
-    void setIteratorByDomainName(
-        ntcdns::CacheHostEntryByDomainNameIterator value);
+    /// Increment the number of lookups that have found this entry and
+    /// return the new number.
+    bsl::uint64_t recordHit() const;
 
-    /// Set the iterator to the entry in the map keyed by IP address to the
-    /// specified 'value'.
-    void setIteratorByIpAddress(
-        ntcdns::CacheHostEntryByIpAddressIterator value);
+    /// Mark this entry as being refreshed. Return true if this entry was not
+    /// previously marked as being refreshed, otherwise return false.
+    bool acquireRefresh() const;
 
     /// Return the domain name.
     const bsl::string& domainName() const;
@@ -170,12 +167,6 @@ class CacheHostEntry
     /// validity expires.
     const bsls::TimeInterval& expiration() const;
 
-    /// Return the iterator to the entry in the map keyed by domain name.
-    ntcdns::CacheHostEntryByDomainNameIterator iteratorByDomainName() const;
-
-    /// Return the iterator to the entry in the map keyed by IP address.
-    ntcdns::CacheHostEntryByIpAddressIterator iteratorByIpAddress() const;
-
     /// Format this object to the specified output 'stream' at the
     /// optionally specified indentation 'level' and return a reference to
     /// the modifiable 'stream'.  If 'level' is specified, optionally
@@ -201,32 +192,140 @@ bsl::ostream& operator<<(bsl::ostream& stream, const CacheHostEntry& object);
 /// @internal @brief
 /// Provide a cache of names, addresses, and ports.
 ///
+/// @details
+/// The host entries are indexed both by domain name and by IP address. Each
+/// index is divided into a fixed number of shards, each guarded by its own
+/// read-write lock, so that lookups take only a shared lock on one shard and
+/// neither contend with each other nor with updates to other shards. Host
+/// entries are never modified once inserted: an update replaces the entry in
+/// each index.
+///
+/// When refresh-ahead is enabled, a lookup that finds a popular host entry
+/// close to its expiration indicates to the caller that the entry should be
+/// refreshed, once per entry, so that the caller may re-resolve the domain
+/// name asynchronously while continuing to use the cached result.
+///
+/// The SRV records of service names are cached separately, keyed by service
+/// name, in their original order. The IP addresses of the targets of those
+/// records are cached as host entries.
+///
 /// @par Thread Safety
 /// This class is thread safe.
 ///
 /// @ingroup module_ntcdns
 class Cache
 {
-    mutable bslmt::Mutex                       d_mutex;
-    mutable ntcdns::CacheHostEntryByDomainName d_cacheEntryByDomainName;
-    mutable ntcdns::CacheHostEntryByIpAddress  d_cacheEntryByIpAddress;
-    mutable bsl::size_t                        d_cacheEntryCount;
-    bool                                       d_positiveCacheEnabled;
-    bsl::size_t                                d_positiveCacheMinTimeToLive;
-    bsl::size_t                                d_positiveCacheMaxTimeToLive;
-    bool                                       d_negativeCacheEnabled;
-    bsl::size_t                                d_negativeCacheMinTimeToLive;
-    bsl::size_t                                d_negativeCacheMaxTimeToLive;
-    bslma::Allocator*                          d_allocator_p;
+    /// Describe a shard of the index of host entries by domain name.
+    struct DomainNameShard {
+        mutable bslmt::ReadWriteLock       d_lock;
+        ntcdns::CacheHostEntryByDomainName d_map;
+
+        /// Create a new shard. Optionally specify a 'basicAllocator' used
+        /// to supply memory. If 'basicAllocator' is 0, the currently
+        /// installed default allocator is used.
+        explicit DomainNameShard(bslma::Allocator* basicAllocator = 0);
+    };
+
+    /// Describe a shard of the index of host entries by IP address.
+    struct IpAddressShard {
+        mutable bslmt::ReadWriteLock      d_lock;
+        ntcdns::CacheHostEntryByIpAddress d_map;
+
+        /// Create a new shard. Optionally specify a 'basicAllocator' used
+        /// to supply memory. If 'basicAllocator' is 0, the currently
+        /// installed default allocator is used.
+        explicit IpAddressShard(bslma::Allocator* basicAllocator = 0);
+    };
+
+    /// Describe the cached SRV records of a service name.
+    struct ServiceEntry {
+        bsl::vector<ntcdns::ResourceRecordDataSvr> d_serverList;
+        ntsa::Endpoint                             d_nameServer;
+        bsls::TimeInterval                         d_expiration;
+
+        /// Create a new service entry. Optionally specify a
+        /// 'basicAllocator' used to supply memory. If 'basicAllocator' is
+        /// 0, the currently installed default allocator is used.
+        explicit ServiceEntry(bslma::Allocator* basicAllocator = 0);
+
+        /// Create a new service entry having the same value as the
+        /// specified 'original' object. Optionally specify a
+        /// 'basicAllocator' used to supply memory. If 'basicAllocator' is
+        /// 0, the currently installed default allocator is used.
+        ServiceEntry(const ServiceEntry& original,
+                     bslma::Allocator*   basicAllocator = 0);
+
+        /// Defines the traits of this type.
+        NTCCFG_DECLARE_NESTED_USES_ALLOCATOR_TRAITS(ServiceEntry);
+    };
+
+    /// Define a type alias for a map of service names to the cached SRV
+    /// records of each service name.
+    typedef bsl::unordered_map<bsl::string, ServiceEntry> ServiceEntryMap;
+
+    /// Define a type alias for a vector of shards of the index of host
+    /// entries by domain name.
+    typedef bsl::vector<bsl::shared_ptr<DomainNameShard> >
+        DomainNameShardVector;
+
+    /// Define a type alias for a vector of shards of the index of host
+    /// entries by IP address.
+    typedef bsl::vector<bsl::shared_ptr<IpAddressShard> > IpAddressShardVector;
+
+    enum {
+        /// The number of shards of each index.
+        k_NUM_SHARDS = 16
+    };
+
+    DomainNameShardVector        d_domainNameShards;
+    IpAddressShardVector         d_ipAddressShards;
+    mutable bsls::AtomicUint64   d_cacheEntryCount;
+    mutable bslmt::ReadWriteLock d_serviceLock;
+    mutable ServiceEntryMap      d_serviceEntryMap;
+    bool                         d_positiveCacheEnabled;
+    bsl::size_t                  d_positiveCacheMinTimeToLive;
+    bsl::size_t                  d_positiveCacheMaxTimeToLive;
+    bool                         d_negativeCacheEnabled;
+    bsl::size_t                  d_negativeCacheMinTimeToLive;
+    bsl::size_t                  d_negativeCacheMaxTimeToLive;
+    bool                         d_refreshAheadEnabled;
+    bsl::size_t                  d_refreshAheadMinHits;
+    bsl::size_t                  d_refreshAheadWindow;
+    bslma::Allocator*            d_allocator_p;
 
   private:
     Cache(const Cache&) BSLS_KEYWORD_DELETED;
     Cache& operator=(const Cache&) BSLS_KEYWORD_DELETED;
 
   private:
-    /// Remove the specified 'cacheEntry'.
-    void privateRemove(
-        const bsl::shared_ptr<ntcdns::CacheHostEntry>& cacheEntry);
+    /// Return the shard of the index by domain name that contains the
+    /// specified 'domainName'.
+    DomainNameShard* lookupShard(const bslstl::StringRef& domainName) const;
+
+    /// Return the shard of the index by IP address that contains the
+    /// specified 'ipAddress'.
+    IpAddressShard* lookupShard(const ntsa::IpAddress& ipAddress) const;
+
+    /// Remove each host entry for the specified 'domainName' from the
+    /// specified 'shard' that has expired at the specified 'now'.
+    void privateExpire(DomainNameShard*          shard,
+                       const bsl::string&        domainName,
+                       const bsls::TimeInterval& now) const;
+
+    /// Remove the host entry for the specified 'ipAddress' from the
+    /// specified 'shard' if it has expired at the specified 'now'.
+    void privateExpire(IpAddressShard*           shard,
+                       const ntsa::IpAddress&    ipAddress,
+                       const bsls::TimeInterval& now) const;
+
+    /// Return true if the specified 'cacheEntry', found by the specified
+    /// number of 'hits' lookups, the latest at the specified 'now', should
+    /// be refreshed by the caller of that latest lookup, otherwise return
+    /// false.
+    bool isRefreshRequired(
+        const bsl::shared_ptr<ntcdns::CacheHostEntry>& cacheEntry,
+        bsl::uint64_t                                  hits,
+        const bsls::TimeInterval&                      now) const;
 
   public:
     /// Create a new object. Optionally specify a 'basicAllocator' used to
@@ -272,6 +371,22 @@ class Cache
     /// indicating no maximum time-to-live is enforced.
     void setNegativeCacheMaxTimeToLive(bsl::size_t value);
 
+    /// Set the flag indicating popular host entries close to their
+    /// expiration should be refreshed ahead of their expiration to the
+    /// specified 'value'. The default value is true.
+    void setRefreshAheadEnabled(bool value);
+
+    /// Set the minimum number of lookups that must have found a host entry
+    /// for it to be refreshed ahead of its expiration to the specified
+    /// 'value'. The default value is 2.
+    void setRefreshAheadMinHits(bsl::size_t value);
+
+    /// Set the final portion of the time-to-live of a host entry, as a
+    /// percentage, during which a lookup that finds the host entry
+    /// indicates it should be refreshed to the specified 'value'. The
+    /// default value is 10.
+    void setRefreshAheadWindow(bsl::size_t value);
+
     /// Insert or update the host entry for the specified 'domainName' to be
     /// associated with the specified 'ipAddress' starting from the
     /// specified 'now' for the specified 'timeToLive'.
@@ -283,13 +398,37 @@ class Cache
 
     /// Load into the specified 'result' the IP address list assigned to the
     /// specified 'domainName' according to the specified 'options' and
-    /// load into the specified 'context' the context of resolution. Return
-    /// the error.
-    ntsa::Error getIpAddress(ntca::GetIpAddressContext*       context,
-                             bsl::vector<ntsa::IpAddress>*    result,
-                             const bslstl::StringRef&         domainName,
-                             const ntca::GetIpAddressOptions& options,
-                             const bsls::TimeInterval&        now) const;
+    /// load into the specified 'context' the context of resolution.
+    /// Optionally specify 'refresh', into which is loaded true if the
+    /// caller should re-resolve the 'domainName' ahead of the expiration of
+    /// the result, and false otherwise. Return the error.
+    ntsa::Error getIpAddress(
+        ntca::GetIpAddressContext*       context,
+        bsl::vector<ntsa::IpAddress>*    result,
+        const bslstl::StringRef&         domainName,
+        const ntca::GetIpAddressOptions& options,
+        const bsls::TimeInterval&        now,
+        bool*                            refresh = 0) const;
+
+    /// Insert or replace the SRV records of the specified service 'name'
+    /// with the specified 'serverList', received from the specified
+    /// 'nameServer', starting from the specified 'now' for the specified
+    /// 'timeToLive'.
+    void updateService(
+        const bsl::string&                                name,
+        const bsl::vector<ntcdns::ResourceRecordDataSvr>& serverList,
+        const ntsa::Endpoint&                             nameServer,
+        bsl::size_t                                       timeToLive,
+        const bsls::TimeInterval&                         now);
+
+    /// Load into the specified 'result' the SRV records of the specified
+    /// service 'name', in the order they were received, and load into the
+    /// specified 'context' the context of resolution. Return the error.
+    ntsa::Error getServerList(
+        ntca::GetServiceEndpointsContext*           context,
+        bsl::vector<ntcdns::ResourceRecordDataSvr>* result,
+        const bslstl::StringRef&                    name,
+        const bsls::TimeInterval&                   now) const;
 
     /// Load into the specified 'result' the domain name to which the
     /// specified 'ipAddress' is assigned according to the specified
@@ -326,6 +465,9 @@ class Cache
 
     /// Return the number of cached service name to port associations.
     bsl::size_t numPortEntries() const;
+
+    /// Return the number of cached service names having SRV records.
+    bsl::size_t numServiceEntries() const;
 };
 
 }  // close package namespace
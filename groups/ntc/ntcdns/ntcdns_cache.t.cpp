@@ -681,11 +681,272 @@ NTCCFG_TEST_CASE(4)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+NTCCFG_TEST_CASE(5)
+{
+    // Concern: Test 'getIpAddress' indicates a popular host entry should be
+    // refreshed once it is close to its expiration, once per host entry.
+    // Plan:
+
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    ntccfg::TestAllocator ta;
+    {
+        // Create a cache that indicates a host entry found by at least two
+        // lookups should be refreshed during the final 10% of its TTL.
+
+        ntcdns::Cache cache(&ta);
+
+        cache.setRefreshAheadEnabled(true);
+        cache.setRefreshAheadMinHits(2);
+        cache.setRefreshAheadWindow(10);
+
+        // Define a test domain name assigned to an IP address from a
+        // name server with a TTL of 10.
+
+        const bsl::string     DOMAIN_NAME("test.example.com");
+        const ntsa::Endpoint  NAME_SERVER("127.0.0.1:53");
+        const ntsa::IpAddress IP_ADDRESS("192.168.0.101");
+        const bsl::size_t     TTL = 10;
+
+        // Define the sequence of lookups, and whether each lookup should
+        // indicate a refresh.
+
+        struct Data {
+            bsls::TimeInterval d_now;
+            bool               d_refresh;
+        };
+
+        const Data DATA[] = {
+            // The host entry has been found once.
+            {bsls::TimeInterval(100, 0), false},
+
+            // The host entry is popular but not close to its expiration.
+            {bsls::TimeInterval(105, 0), false},
+
+            // The host entry is popular and close to its expiration.
+            {bsls::TimeInterval(109, 0), true},
+
+            // The host entry is already being refreshed.
+            {bsls::TimeInterval(109, 500000000), false}
+        };
+
+        // Insert the host entry at T 100 with a TTL of 10.
+
+        cache.updateHost(DOMAIN_NAME,
+                         IP_ADDRESS,
+                         NAME_SERVER,
+                         TTL,
+                         bsls::TimeInterval(100, 0));
+
+        for (bsl::size_t i = 0; i < sizeof DATA / sizeof DATA[0]; ++i) {
+            ntca::GetIpAddressContext    context;
+            ntca::GetIpAddressOptions    options;
+            bsl::vector<ntsa::IpAddress> ipAddressList;
+            bool                         refresh = !DATA[i].d_refresh;
+
+            error = cache.getIpAddress(&context,
+                                       &ipAddressList,
+                                       DOMAIN_NAME,
+                                       options,
+                                       DATA[i].d_now,
+                                       &refresh);
+            NTCCFG_TEST_OK(error);
+
+            NTCCFG_TEST_EQ(ipAddressList.size(), 1);
+            NTCCFG_TEST_EQ(ipAddressList[0], IP_ADDRESS);
+            NTCCFG_TEST_EQ(refresh, DATA[i].d_refresh);
+        }
+
+        // Update the host entry at T 109.5, as if refreshed, with a TTL of
+        // 10.
+
+        cache.updateHost(DOMAIN_NAME,
+                         IP_ADDRESS,
+                         NAME_SERVER,
+                         TTL,
+                         bsls::TimeInterval(109, 500000000));
+
+        NTCCFG_TEST_EQ(cache.numHostEntries(), 1);
+
+        // Ensure the updated host entry is not indicated to be refreshed
+        // until it is again popular and close to its expiration.
+
+        {
+            ntca::GetIpAddressContext    context;
+            ntca::GetIpAddressOptions    options;
+            bsl::vector<ntsa::IpAddress> ipAddressList;
+            bool                         refresh = true;
+
+            error = cache.getIpAddress(&context,
+                                       &ipAddressList,
+                                       DOMAIN_NAME,
+                                       options,
+                                       bsls::TimeInterval(119, 0),
+                                       &refresh);
+            NTCCFG_TEST_OK(error);
+            NTCCFG_TEST_FALSE(refresh);
+
+            error = cache.getIpAddress(&context,
+                                       &ipAddressList,
+                                       DOMAIN_NAME,
+                                       options,
+                                       bsls::TimeInterval(119, 0),
+                                       &refresh);
+            NTCCFG_TEST_OK(error);
+            NTCCFG_TEST_TRUE(refresh);
+        }
+
+        // Ensure a host entry is never indicated to be refreshed when
+        // refresh-ahead is disabled.
+
+        cache.setRefreshAheadEnabled(false);
+
+        cache.updateHost(DOMAIN_NAME,
+                         IP_ADDRESS,
+                         NAME_SERVER,
+                         TTL,
+                         bsls::TimeInterval(119, 0));
+
+        for (bsl::size_t i = 0; i < 3; ++i) {
+            ntca::GetIpAddressContext    context;
+            ntca::GetIpAddressOptions    options;
+            bsl::vector<ntsa::IpAddress> ipAddressList;
+            bool                         refresh = true;
+
+            error = cache.getIpAddress(&context,
+                                       &ipAddressList,
+                                       DOMAIN_NAME,
+                                       options,
+                                       bsls::TimeInterval(128, 500000000),
+                                       &refresh);
+            NTCCFG_TEST_OK(error);
+            NTCCFG_TEST_FALSE(refresh);
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(6)
+{
+    // Concern: Test 'getServerList' finds the SRV records of a service name
+    // until they expire, and 'updateService' replaces them.
+    // Plan:
+
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    ntccfg::TestAllocator ta;
+    {
+        ntcdns::Cache cache(&ta);
+
+        const bsl::string    SERVICE_NAME("_test._tcp.example.com");
+        const ntsa::Endpoint NAME_SERVER("127.0.0.1:53");
+        const bsl::size_t    TTL = 10;
+
+        bsl::vector<ntcdns::ResourceRecordDataSvr> serverList(&ta);
+
+        serverList.resize(2);
+
+        serverList[0].target()   = "a.example.com";
+        serverList[0].priority() = 10;
+        serverList[0].weight()   = 60;
+        serverList[0].port()     = 1000;
+
+        serverList[1].target()   = "b.example.com";
+        serverList[1].priority() = 10;
+        serverList[1].weight()   = 40;
+        serverList[1].port()     = 2000;
+
+        {
+            ntca::GetServiceEndpointsContext           context(&ta);
+            bsl::vector<ntcdns::ResourceRecordDataSvr> result(&ta);
+
+            error = cache.getServerList(&context,
+                                        &result,
+                                        SERVICE_NAME,
+                                        bsls::TimeInterval(100, 0));
+            NTCCFG_TEST_ERROR(error, ntsa::Error::e_EOF);
+        }
+
+        cache.updateService(SERVICE_NAME,
+                            serverList,
+                            NAME_SERVER,
+                            TTL,
+                            bsls::TimeInterval(100, 0));
+
+        NTCCFG_TEST_EQ(cache.numServiceEntries(), 1);
+
+        {
+            ntca::GetServiceEndpointsContext           context(&ta);
+            bsl::vector<ntcdns::ResourceRecordDataSvr> result(&ta);
+
+            error = cache.getServerList(&context,
+                                        &result,
+                                        SERVICE_NAME,
+                                        bsls::TimeInterval(104, 0));
+            NTCCFG_TEST_OK(error);
+
+            NTCCFG_TEST_EQ(result.size(), 2);
+            NTCCFG_TEST_EQ(result[0], serverList[0]);
+            NTCCFG_TEST_EQ(result[1], serverList[1]);
+
+            NTCCFG_TEST_EQ(context.name(), SERVICE_NAME);
+            NTCCFG_TEST_EQ(context.source(), ntca::ResolverSource::e_CACHE);
+            NTCCFG_TEST_FALSE(context.nameServer().isNull());
+            NTCCFG_TEST_EQ(context.nameServer().value(), NAME_SERVER);
+            NTCCFG_TEST_FALSE(context.timeToLive().isNull());
+            NTCCFG_TEST_EQ(context.timeToLive().value(), 6);
+        }
+
+        serverList.resize(1);
+
+        cache.updateService(SERVICE_NAME,
+                            serverList,
+                            NAME_SERVER,
+                            TTL,
+                            bsls::TimeInterval(105, 0));
+
+        NTCCFG_TEST_EQ(cache.numServiceEntries(), 1);
+
+        {
+            ntca::GetServiceEndpointsContext           context(&ta);
+            bsl::vector<ntcdns::ResourceRecordDataSvr> result(&ta);
+
+            error = cache.getServerList(&context,
+                                        &result,
+                                        SERVICE_NAME,
+                                        bsls::TimeInterval(110, 0));
+            NTCCFG_TEST_OK(error);
+            NTCCFG_TEST_EQ(result.size(), 1);
+        }
+
+        {
+            ntca::GetServiceEndpointsContext           context(&ta);
+            bsl::vector<ntcdns::ResourceRecordDataSvr> result(&ta);
+
+            error = cache.getServerList(&context,
+                                        &result,
+                                        SERVICE_NAME,
+                                        bsls::TimeInterval(115, 0));
+            NTCCFG_TEST_ERROR(error, ntsa::Error::e_EOF);
+            NTCCFG_TEST_TRUE(result.empty());
+        }
+
+        NTCCFG_TEST_EQ(cache.numServiceEntries(), 0);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
     NTCCFG_TEST_REGISTER(2);
     NTCCFG_TEST_REGISTER(3);
     NTCCFG_TEST_REGISTER(4);
+    NTCCFG_TEST_REGISTER(5);
+    NTCCFG_TEST_REGISTER(6);
 }
 NTCCFG_TEST_DRIVER_END;
@@ -18,11 +18,13 @@
 #include <ntcdns_compat.h>
 
 #include <ntci_log.h>
+#include <ntci_resolver.h>
 #include <ntcs_blobutil.h>
 #include <ntsa_domainname.h>
 #include <ntsa_endpoint.h>
 #include <ntsu_resolverutil.h>
 
+#include <bdlb_randomdevice.h>
 #include <bdlbb_blob.h>
 #include <bdlbb_blobstreambuf.h>
 #include <bdlbb_blobutil.h>
@@ -36,6 +38,7 @@
 #include <bsls_atomic.h>
 #include <bsls_platform.h>
 
+#include <bsl_cstdio.h>
 #include <bsl_ostream.h>
 
 #define NTCDNS_CLIENT_LOG_STARTING(configuration)                             \
@@ -93,9 +96,8 @@
 
 #define NTCDNS_CLIENT_OPERATION_LOG_SEND_FAILURE(request, error)              \
     do {                                                                      \
-        NTCI_LOG_STREAM_DEBUG << "Failed to send " << (request)               \
-                              << " to datagram socket: " << (error)           \
-                              << NTCI_LOG_STREAM_END;                         \
+        NTCI_LOG_STREAM_DEBUG << "Failed to send " << (request) << ": "       \
+                              << (error) << NTCI_LOG_STREAM_END;              \
     } while (false)
 
 #define NTCDNS_CLIENT_OPERATION_LOG_STALE_RESPONSE(response,                  \
@@ -198,9 +200,28 @@ const bsl::size_t k_DNS_MAX_PAYLOAD_SIZE = 512;
 // The default DNS port.
 const ntsa::Port k_DNS_PORT = 53;
 
+// The size of the length prefix of each DNS message sent over a stream.
+const bsl::size_t k_TCP_LENGTH_PREFIX_SIZE = 2;
+
+// The number of seconds a stream connection to a name server remains open
+// while no requests sent over the connection are outstanding.
+const bsl::size_t k_TCP_IDLE_TIMEOUT = 10;
+
+// The default number of connected datagram sockets through which requests
+// are sent to each name server.
+const bsl::size_t k_UDP_CHANNEL_COUNT = 4;
+
+// The first port in the range from which the source port of each datagram
+// socket is randomly chosen: the dynamic port range assigned by IANA.
+const ntsa::Port k_UDP_SOURCE_PORT_MIN = 49152;
+
+// The number of randomly chosen source ports to try to bind before
+// deferring the choice of source port to the operating system.
+const bsl::size_t k_UDP_SOURCE_PORT_ATTEMPTS = 3;
+
 bsls::AtomicUint s_generation;
 
-bsl::uint16_t generateTransactionId()
+bsl::uint16_t generateSequentialTransactionId()
 {
     bsl::uint16_t result = 0;
 
@@ -225,6 +246,132 @@ bsl::uint16_t generateTransactionId()
     return result;
 }
 
+bsl::uint16_t generateTransactionId()
+{
+    // Return a non-zero transaction ID read from the random device of the
+    // operating system, so that responses are harder to forge. Fall back
+    // to the next sequential transaction ID if the random device is not
+    // available.
+
+    bsl::uint16_t result = 0;
+
+    while (result == 0) {
+        const int rc = bdlb::RandomDevice::getRandomBytesNonBlocking(
+            reinterpret_cast<unsigned char*>(&result),
+            sizeof result);
+        if (rc != 0) {
+            return generateSequentialTransactionId();
+        }
+    }
+
+    return result;
+}
+
+ntsa::Port generateSourcePort()
+{
+    // Return a source port in the dynamic port range chosen by the random
+    // device of the operating system, or zero to defer the choice of source
+    // port to the operating system if the random device is not available.
+
+    bsl::uint16_t random = 0;
+
+    const int rc = bdlb::RandomDevice::getRandomBytesNonBlocking(
+        reinterpret_cast<unsigned char*>(&random),
+        sizeof random);
+    if (rc != 0) {
+        return 0;
+    }
+
+    return NTCCFG_WARNING_NARROW(ntsa::Port,
+                                 k_UDP_SOURCE_PORT_MIN + (random & 0x3fff));
+}
+
+void formatOperationKey(
+    bsl::string*                                           result,
+    const bsl::string&                                     name,
+    const bdlb::NullableValue<ntsa::IpAddressType::Value>& ipAddressType,
+    const ntca::GetIpAddressOptions&                       options)
+{
+    // Load into the specified 'result' the key that identifies the
+    // operation to get the IP addresses assigned to the specified 'name' of
+    // the specified 'ipAddressType' according to the specified 'options'.
+
+    result->assign(name);
+
+    if (ipAddressType.isNull()) {
+        result->append(":*");
+    }
+    else if (ipAddressType.value() == ntsa::IpAddressType::e_V4) {
+        result->append(":4");
+    }
+    else {
+        result->append(":6");
+    }
+
+    char buffer[64];
+
+    if (!options.transport().isNull()) {
+        bsl::snprintf(buffer,
+                      sizeof buffer,
+                      ":t%d",
+                      static_cast<int>(options.transport().value()));
+        result->append(buffer);
+    }
+}
+
+ntsa::Error sendStreamRequest(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    const ntcdns::Message&                     request,
+    const ntsa::Endpoint&                      endpoint)
+{
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    // Each message sent over a stream is prefixed by its length, encoded as
+    // a 16-bit unsigned integer in network byte order.
+
+    bsl::uint8_t buffer[k_TCP_LENGTH_PREFIX_SIZE + k_DNS_MAX_PAYLOAD_SIZE];
+
+    ntcdns::MemoryEncoder encoder(buffer + k_TCP_LENGTH_PREFIX_SIZE,
+                                  k_DNS_MAX_PAYLOAD_SIZE);
+
+    bsl::size_t p0 = encoder.position();
+
+    error = request.encode(&encoder);
+    if (error) {
+        NTCDNS_CLIENT_OPERATION_LOG_ENCODE_FAILURE(request, error);
+        return error;
+    }
+
+    bsl::size_t p1          = encoder.position();
+    bsl::size_t requestSize = p1 - p0;
+
+    buffer[0] = static_cast<bsl::uint8_t>((requestSize >> 8) & 0xFF);
+    buffer[1] = static_cast<bsl::uint8_t>(requestSize & 0xFF);
+
+    bsl::shared_ptr<bdlbb::Blob> requestBlob =
+        streamSocket->createOutgoingBlob();
+
+    bdlbb::BlobUtil::append(
+        requestBlob.get(),
+        reinterpret_cast<const char*>(buffer),
+        NTCCFG_WARNING_NARROW(int, k_TCP_LENGTH_PREFIX_SIZE + requestSize));
+
+    NTCDNS_CLIENT_OPERATION_LOG_SEND_OBJECT(request, endpoint);
+    NTCDNS_CLIENT_OPERATION_LOG_SEND_BYTES(requestBlob, endpoint);
+
+    ntca::SendOptions sendOptions;
+
+    error = streamSocket->send(*requestBlob, sendOptions);
+    if (error) {
+        NTCDNS_CLIENT_OPERATION_LOG_SEND_FAILURE(request, error);
+        return error;
+    }
+
+    return ntsa::Error();
+}
+
 }  // close unnamed namespace
 
 ClientOperation::~ClientOperation()
@@ -232,24 +379,24 @@ ClientOperation::~ClientOperation()
 }
 
 ClientGetIpAddressOperation::ClientGetIpAddressOperation(
-    const bsl::shared_ptr<ntci::Resolver>& resolver,
-    const bsl::string&                     name,
-    const ServerList&                      serverList,
-    const SearchList&                      searchList,
-    const ntca::GetIpAddressOptions&       options,
-    const ntci::GetIpAddressCallback&      callback,
-    const bsl::shared_ptr<ntcdns::Cache>&  cache,
-    bslma::Allocator*                      basicAllocator)
+    const bsl::string&                    name,
+    const ServerList&                     serverList,
+    const SearchList&                     searchList,
+    const ntca::GetIpAddressOptions&      options,
+    const bsl::shared_ptr<ntcdns::Cache>& cache,
+    bslma::Allocator*                     basicAllocator)
 : d_object("ntcdns::ClientGetIpAddressOperation")
 , d_mutex()
-, d_resolver_sp(resolver)
 , d_name(name, basicAllocator)
 , d_serverList(serverList, basicAllocator)
 , d_serverIndex(0)
 , d_searchList(searchList, basicAllocator)
 , d_searchIndex(0)
 , d_options(options)
-, d_callback(callback, basicAllocator)
+, d_subscriberList(basicAllocator)
+, d_subscriberId(0)
+, d_client_wp()
+, d_key(basicAllocator)
 , d_timer_sp()
 , d_cache_sp(cache)
 , d_pending(true)
@@ -261,25 +408,150 @@ ClientGetIpAddressOperation::~ClientGetIpAddressOperation()
 {
 }
 
-ntsa::Error ClientGetIpAddressOperation::sendRequest(
-    const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
-    const ntsa::Endpoint&                        endpoint,
-    bsl::uint16_t                                transactionId)
+void ClientGetIpAddressOperation::complete(
+    const bsl::vector<ntsa::IpAddress>& ipAddressList,
+    const ntca::GetIpAddressEvent&      event)
 {
-    NTCI_LOG_CONTEXT();
+    BSLS_ASSERT(!d_pending);
+
+    SubscriberList subscriberList(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        subscriberList.swap(d_subscriberList);
+    }
+
+    for (SubscriberList::const_iterator it = subscriberList.begin();
+         it != subscriberList.end();
+         ++it)
+    {
+        if (it->d_timer_sp) {
+            it->d_timer_sp->close();
+        }
+
+        ClientGetIpAddressOperation::announce(it->d_resolver_sp,
+                                              it->d_options,
+                                              it->d_callback,
+                                              ipAddressList,
+                                              event);
+    }
+
+    d_serverList.clear();
+
+    bsl::shared_ptr<ntcdns::Client> client = d_client_wp.lock();
+    if (client) {
+        client->retire(d_key, this);
+    }
+}
+
+void ClientGetIpAddressOperation::processDeadline(
+    bsl::size_t                         subscriberId,
+    const bsl::shared_ptr<ntci::Timer>& timer,
+    const ntca::TimerEvent&             event)
+{
+    if (event.type() != ntca::TimerEventType::e_DEADLINE) {
+        return;
+    }
+
+    // The subscriber is removed under the same lock from which the
+    // subscriber list is taken when the operation completes, so the
+    // subscriber is notified exactly once.
+
+    Subscriber subscriber;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        SubscriberList::iterator it = d_subscriberList.begin();
+        while (it != d_subscriberList.end() && it->d_id != subscriberId) {
+            ++it;
+        }
+
+        if (it == d_subscriberList.end()) {
+            return;
+        }
+
+        subscriber = *it;
+        d_subscriberList.erase(it);
+    }
+
+    timer->close();
+
+    bsl::vector<ntsa::IpAddress> ipAddressList;
+
+    ntca::GetIpAddressContext context;
+    context.setDomainName(d_name);
+    context.setError(ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+    ntca::GetIpAddressEvent getIpAddressEvent;
+    getIpAddressEvent.setType(ntca::GetIpAddressEventType::e_ERROR);
+    getIpAddressEvent.setContext(context);
+
+    ClientGetIpAddressOperation::announce(subscriber.d_resolver_sp,
+                                          subscriber.d_options,
+                                          subscriber.d_callback,
+                                          ipAddressList,
+                                          getIpAddressEvent);
+}
+
+void ClientGetIpAddressOperation::announce(
+    const bsl::shared_ptr<ntci::Resolver>& resolver,
+    const ntca::GetIpAddressOptions&       options,
+    const ntci::GetIpAddressCallback&      callback,
+    const bsl::vector<ntsa::IpAddress>&    ipAddressList,
+    const ntca::GetIpAddressEvent&         event)
+{
+    if (event.type() == ntca::GetIpAddressEventType::e_COMPLETE &&
+        !ipAddressList.empty() && !options.ipAddressSelector().isNull())
+    {
+        bsl::vector<ntsa::IpAddress> selection(
+            1,
+            ipAddressList[options.ipAddressSelector().value() %
+                          ipAddressList.size()]);
+
+        callback(resolver, selection, event, ntci::Strand::unknown());
+    }
+    else {
+        callback(resolver, ipAddressList, event, ntci::Strand::unknown());
+    }
+}
 
+ntsa::Error ClientGetIpAddressOperation::createQuestionType(
+    ntcdns::Type::Value* result) const
+{
     ntsa::Error error;
 
-    if (d_searchIndex >= d_searchList.size()) {
+    bdlb::NullableValue<ntsa::IpAddressType::Value> ipAddressType;
+    error = ntcdns::Compat::convert(&ipAddressType, d_options);
+    if (error) {
+        return error;
+    }
+
+    if (ipAddressType.isNull()) {
+        *result = ntcdns::Type::e_A;
+    }
+    else if (ipAddressType.value() == ntsa::IpAddressType::e_V4) {
+        *result = ntcdns::Type::e_A;
+    }
+    else if (ipAddressType.value() == ntsa::IpAddressType::e_V6) {
+        *result = ntcdns::Type::e_AAAA;
+    }
+    else {
         return ntsa::Error(ntsa::Error::e_INVALID);
     }
 
-    if (!d_pending) {
-        NTCDNS_CLIENT_OPERATION_LOG_SEND_REFUSAL();
-        return ntsa::Error(ntsa::Error::e_CANCELLED);
+    return ntsa::Error();
+}
+
+ntsa::Error ClientGetIpAddressOperation::createRequest(
+    ntcdns::Message* result,
+    bsl::uint16_t    transactionId) const
+{
+    ntsa::Error error;
+
+    if (d_searchIndex >= d_searchList.size()) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
     }
 
-    ntcdns::Message request;
+    ntcdns::Message& request = *result;
 
     request.setId(transactionId);
     request.setDirection(ntcdns::Direction::e_REQUEST);
@@ -292,32 +564,58 @@ ntsa::Error ClientGetIpAddressOperation::sendRequest(
     request.setRd(true);
     request.setTc(false);
 
+    ntcdns::Type::Value type;
+    error = this->createQuestionType(&type);
+    if (error) {
+        return error;
+    }
+
     ntcdns::Question& question = request.addQd();
 
     question.setName(d_searchList[d_searchIndex]);
+    question.setType(type);
+    question.setClassification(ntcdns::Classification::e_INTERNET);
 
-    bdlb::NullableValue<ntsa::IpAddressType::Value> ipAddressType;
-    error = ntcdns::Compat::convert(&ipAddressType, d_options);
+    return ntsa::Error();
+}
+
+ntsa::Error ClientGetIpAddressOperation::encodeRequest(
+    ntcdns::MemoryEncoder* encoder,
+    bsl::uint16_t          transactionId) const
+{
+    ntsa::Error error;
+
+    if (d_searchIndex >= d_searchList.size()) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    ntcdns::Type::Value type;
+    error = this->createQuestionType(&type);
     if (error) {
         return error;
     }
 
-    if (ipAddressType.isNull()) {
-        question.setType(ntcdns::Type::e_A);
-    }
-    else {
-        if (ipAddressType.value() == ntsa::IpAddressType::e_V4) {
-            question.setType(ntcdns::Type::e_A);
-        }
-        else if (ipAddressType.value() == ntsa::IpAddressType::e_V6) {
-            question.setType(ntcdns::Type::e_AAAA);
-        }
-        else {
-            return ntsa::Error(ntsa::Error::e_INVALID);
-        }
-    }
+    return ntcdns::MessageUtil::encodeQuery(
+        encoder,
+        transactionId,
+        d_searchList[d_searchIndex],
+        type,
+        ntcdns::Classification::e_INTERNET);
+}
 
-    question.setClassification(ntcdns::Classification::e_INTERNET);
+ntsa::Error ClientGetIpAddressOperation::sendRequest(
+    const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
+    const ntsa::Endpoint&                        endpoint,
+    bsl::uint16_t                                transactionId)
+{
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    if (!d_pending) {
+        NTCDNS_CLIENT_OPERATION_LOG_SEND_REFUSAL();
+        return ntsa::Error(ntsa::Error::e_CANCELLED);
+    }
 
     bsl::shared_ptr<bdlbb::Blob> requestBlob =
         datagramSocket->createOutgoingBlob();
@@ -333,15 +631,18 @@ ntsa::Error ClientGetIpAddressOperation::sendRequest(
 
     bsl::size_t p0 = encoder.position();
 
-    error = request.encode(&encoder);
+    error = this->encodeRequest(&encoder, transactionId);
     if (error) {
-        NTCDNS_CLIENT_OPERATION_LOG_ENCODE_FAILURE(request, error);
+        NTCDNS_CLIENT_OPERATION_LOG_ENCODE_FAILURE(d_name, error);
         return error;
     }
 
     bsl::size_t p1          = encoder.position();
     bsl::size_t requestSize = p1 - p0;
 
+    ntcdns::MessageView request;
+    request.decode(encoder.begin() + p0, requestSize);
+
     ntcs::BlobUtil::resize(requestBlob, requestSize);
 
     BSLS_ASSERT_OPT(requestBlob->numDataBuffers() == 1);
@@ -367,18 +668,30 @@ ntsa::Error ClientGetIpAddressOperation::sendRequest(
     const ntsa::Endpoint&                      endpoint,
     bsl::uint16_t                              transactionId)
 {
-    NTCCFG_WARNING_UNUSED(streamSocket);
-    NTCCFG_WARNING_UNUSED(endpoint);
-    NTCCFG_WARNING_UNUSED(transactionId);
+    NTCI_LOG_CONTEXT();
 
-    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+    ntsa::Error error;
+
+    if (!d_pending) {
+        NTCDNS_CLIENT_OPERATION_LOG_SEND_REFUSAL();
+        return ntsa::Error(ntsa::Error::e_CANCELLED);
+    }
+
+    ntcdns::Message request;
+
+    error = this->createRequest(&request, transactionId);
+    if (error) {
+        return error;
+    }
+
+    return sendStreamRequest(streamSocket, request, endpoint);
 }
 
 void ClientGetIpAddressOperation::processResponse(
-    const ntcdns::Message&    response,
-    const ntsa::Endpoint&     endpoint,
-    bsl::size_t               serverIndex,
-    const bsls::TimeInterval& now)
+    const ntcdns::MessageView& response,
+    const ntsa::Endpoint&      endpoint,
+    bsl::size_t                serverIndex,
+    const bsls::TimeInterval&  now)
 {
     NTCI_LOG_CONTEXT();
 
@@ -406,9 +719,19 @@ void ClientGetIpAddressOperation::processResponse(
     context.setSource(ntca::ResolverSource::e_SERVER);
     context.setNameServer(endpoint);
 
+    // Decode the answers directly from the response, copying only the
+    // question name and the IP addresses.
+
     if (response.qdcount() > 0) {
-        const ntcdns::Question& question = response.qd(0);
-        context.setDomainName(question.name());
+        ntcdns::QuestionView question;
+        error = response.qd(&question, 0);
+        if (!error) {
+            bsl::string domainName;
+            error = question.name().load(&domainName);
+            if (!error) {
+                context.setDomainName(domainName);
+            }
+        }
     }
 
     bdlb::NullableValue<ntsa::IpAddressType::Value> ipAddressType;
@@ -416,106 +739,59 @@ void ClientGetIpAddressOperation::processResponse(
 
     bdlb::NullableValue<bsl::size_t> timeToLive;
 
-    if (response.ancount() > 0) {
-        for (bsl::size_t i = 0; i < response.ancount(); ++i) {
-            const ntcdns::ResourceRecord& answer = response.an(i);
-
-            if (answer.rdata().isIpv4Value()) {
-                BSLMF_ASSERT(sizeof answer.rdata().ipv4() == 4);
-                ntsa::Ipv4Address ipv4Address;
-                ipv4Address.copyFrom(&answer.rdata().ipv4(),
-                                     sizeof answer.rdata().ipv4());
+    for (bsl::size_t i = 0; i < response.ancount(); ++i) {
+        ntcdns::ResourceRecordView answer;
+        error = response.an(&answer, i);
+        if (error) {
+            break;
+        }
 
-                ntsa::IpAddress ipAddress(ipv4Address);
+        ntsa::IpAddress ipAddress;
+        error = answer.loadIpAddress(&ipAddress);
+        if (error) {
+            continue;
+        }
 
-                if (ipAddressType.isNull() ||
-                    ipAddressType.value() == ntsa::IpAddressType::e_V4)
-                {
-                    ipAddressList.push_back(ipAddress);
+        if (ipAddressType.isNull() ||
+            ipAddressType.value() == ipAddress.type())
+        {
+            ipAddressList.push_back(ipAddress);
 
-                    if (timeToLive.isNull()) {
-                        timeToLive.makeValue(answer.ttl());
-                    }
-                    else {
-                        bsl::size_t timeToLiveValue = timeToLive.value();
-                        if (timeToLiveValue != answer.ttl()) {
-                            NTCDNS_CLIENT_OPERATION_LOG_TTL_MISMATCH(
-                                answer.ttl(),
-                                timeToLiveValue);
-                            if (answer.ttl() < timeToLiveValue) {
-                                timeToLive = answer.ttl();
-                            }
-                        }
+            if (timeToLive.isNull()) {
+                timeToLive.makeValue(answer.ttl());
+            }
+            else {
+                bsl::size_t timeToLiveValue = timeToLive.value();
+                if (timeToLiveValue != answer.ttl()) {
+                    NTCDNS_CLIENT_OPERATION_LOG_TTL_MISMATCH(answer.ttl(),
+                                                             timeToLiveValue);
+                    if (answer.ttl() < timeToLiveValue) {
+                        timeToLive = answer.ttl();
                     }
                 }
+            }
+        }
 
-                if (d_cache_sp) {
-                    d_cache_sp->updateHost(context.domainName(),
-                                           ipAddress,
-                                           endpoint,
-                                           answer.ttl(),
-                                           now);
-
-                    if (d_name != context.domainName()) {
-                        d_cache_sp->updateHost(d_name,
-                                               ipAddress,
-                                               endpoint,
-                                               answer.ttl(),
-                                               now);
-                    }
-                }
+        if (d_cache_sp) {
+            d_cache_sp->updateHost(context.domainName(),
+                                   ipAddress,
+                                   endpoint,
+                                   answer.ttl(),
+                                   now);
+
+            if (d_name != context.domainName()) {
+                d_cache_sp->updateHost(d_name,
+                                       ipAddress,
+                                       endpoint,
+                                       answer.ttl(),
+                                       now);
             }
-            else if (answer.rdata().isIpv6Value()) {
-                BSLMF_ASSERT(sizeof answer.rdata().ipv6() == 16);
-                ntsa::Ipv6Address ipv6Address;
-                ipv6Address.copyFrom(&answer.rdata().ipv6(),
-                                     sizeof answer.rdata().ipv6());
+        }
+    }
 
-                ntsa::IpAddress ipAddress(ipv6Address);
-
-                if (ipAddressType.isNull() ||
-                    ipAddressType.value() == ntsa::IpAddressType::e_V6)
-                {
-                    ipAddressList.push_back(ipAddress);
-
-                    if (timeToLive.isNull()) {
-                        timeToLive.makeValue(answer.ttl());
-                    }
-                    else {
-                        bsl::size_t timeToLiveValue = timeToLive.value();
-                        if (timeToLiveValue != answer.ttl()) {
-                            NTCDNS_CLIENT_OPERATION_LOG_TTL_MISMATCH(
-                                answer.ttl(),
-                                timeToLiveValue);
-                            if (answer.ttl() < timeToLiveValue) {
-                                timeToLive = answer.ttl();
-                            }
-                        }
-                    }
-                }
-
-                if (d_cache_sp) {
-                    d_cache_sp->updateHost(context.domainName(),
-                                           ipAddress,
-                                           endpoint,
-                                           answer.ttl(),
-                                           now);
-
-                    if (d_name != context.domainName()) {
-                        d_cache_sp->updateHost(d_name,
-                                               ipAddress,
-                                               endpoint,
-                                               answer.ttl(),
-                                               now);
-                    }
-                }
-            }
-        }
-    }
-
-    if (ipAddressType.isNull()) {
-        ntsu::ResolverUtil::sortIpAddressList(&ipAddressList);
-    }
+    if (ipAddressType.isNull()) {
+        ntsu::ResolverUtil::sortIpAddressList(&ipAddressList);
+    }
 
     ntca::GetIpAddressEvent event;
 
@@ -529,23 +805,11 @@ void ClientGetIpAddressOperation::processResponse(
         if (!timeToLive.isNull()) {
             context.setTimeToLive(timeToLive.value());
         }
-
-        if (!d_options.ipAddressSelector().isNull()) {
-            ntsa::IpAddress ipAddress =
-                ipAddressList[d_options.ipAddressSelector().value() %
-                              ipAddressList.size()];
-            ipAddressList.clear();
-            ipAddressList.push_back(ipAddress);
-        }
     }
 
     event.setContext(context);
 
-    d_callback(d_resolver_sp, ipAddressList, event, ntci::Strand::unknown());
-    d_callback.reset();
-
-    d_resolver_sp.reset();
-    d_serverList.clear();
+    this->complete(ipAddressList, event);
 }
 
 void ClientGetIpAddressOperation::processError(const ntsa::Error& error)
@@ -568,11 +832,7 @@ void ClientGetIpAddressOperation::processError(const ntsa::Error& error)
     event.setType(ntca::GetIpAddressEventType::e_ERROR);
     event.setContext(context);
 
-    d_callback(d_resolver_sp, ipAddressList, event, ntci::Strand::unknown());
-    d_callback.reset();
-
-    d_resolver_sp.reset();
-    d_serverList.clear();
+    this->complete(ipAddressList, event);
 }
 
 bsl::shared_ptr<ntcdns::ClientNameServer> ClientGetIpAddressOperation::
@@ -603,6 +863,106 @@ bool ClientGetIpAddressOperation::tryNextSearch()
     return false;
 }
 
+void ClientGetIpAddressOperation::coalesce(
+    const bsl::shared_ptr<ntcdns::Client>& client,
+    const bsl::string&                     key)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    d_client_wp = client;
+    d_key       = key;
+}
+
+bool ClientGetIpAddressOperation::subscribe(
+    const bsl::shared_ptr<ntci::Resolver>& resolver,
+    const ntca::GetIpAddressOptions&       options,
+    const ntci::GetIpAddressCallback&      callback)
+{
+    bsl::shared_ptr<ntci::Timer> timer;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        // The subscriber list is taken under the same lock after the
+        // operation is no longer pending, so a subscriber added while the
+        // operation is observed to be pending is guaranteed to be notified.
+
+        if (!d_pending) {
+            return false;
+        }
+
+        d_subscriberList.resize(d_subscriberList.size() + 1);
+
+        Subscriber& subscriber   = d_subscriberList.back();
+        subscriber.d_resolver_sp = resolver;
+        subscriber.d_options     = options;
+        subscriber.d_callback    = callback;
+        subscriber.d_id          = d_subscriberId++;
+
+        // Apply the deadline of this subscriber to this subscriber alone:
+        // the operation continues for the other subscribers when it
+        // elapses.
+
+        if (resolver && !options.deadline().isNull()) {
+            ntca::TimerOptions timerOptions;
+            timerOptions.setOneShot(true);
+            timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
+            timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
+
+            ntci::TimerCallback timerCallback(
+                bdlf::BindUtil::bind(
+                    &ClientGetIpAddressOperation::processDeadline,
+                    this->getSelf(this),
+                    subscriber.d_id,
+                    bdlf::PlaceHolders::_1,
+                    bdlf::PlaceHolders::_2),
+                d_allocator_p);
+
+            timer = resolver->createTimer(timerOptions,
+                                          timerCallback,
+                                          d_allocator_p);
+
+            subscriber.d_timer_sp = timer;
+        }
+    }
+
+    // Schedule the timer outside the lock, which its callback acquires. If
+    // the operation completes first, the timer is already closed and the
+    // schedule has no effect.
+
+    if (timer) {
+        timer->schedule(options.deadline().value());
+    }
+
+    return true;
+}
+
+void ClientGetIpAddressOperation::abandon()
+{
+    d_pending = false;
+
+    SubscriberList subscriberList(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        subscriberList.swap(d_subscriberList);
+    }
+
+    for (SubscriberList::const_iterator it = subscriberList.begin();
+         it != subscriberList.end();
+         ++it)
+    {
+        if (it->d_timer_sp) {
+            it->d_timer_sp->close();
+        }
+    }
+
+    d_serverList.clear();
+}
+
+bool ClientGetIpAddressOperation::isPending() const
+{
+    return d_pending;
+}
+
 const bsl::string& ClientGetIpAddressOperation::name() const
 {
     return d_name;
@@ -652,21 +1012,11 @@ ClientGetDomainNameOperation::~ClientGetDomainNameOperation()
 {
 }
 
-ntsa::Error ClientGetDomainNameOperation::sendRequest(
-    const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
-    const ntsa::Endpoint&                        endpoint,
-    bsl::uint16_t                                transactionId)
+ntsa::Error ClientGetDomainNameOperation::createRequest(
+    ntcdns::Message* result,
+    bsl::uint16_t    transactionId) const
 {
-    NTCI_LOG_CONTEXT();
-
-    ntsa::Error error;
-
-    if (!d_pending) {
-        NTCDNS_CLIENT_OPERATION_LOG_SEND_REFUSAL();
-        return ntsa::Error(ntsa::Error::e_CANCELLED);
-    }
-
-    ntcdns::Message request;
+    ntcdns::Message& request = *result;
 
     request.setId(transactionId);
     request.setDirection(ntcdns::Direction::e_REQUEST);
@@ -711,6 +1061,30 @@ ntsa::Error ClientGetDomainNameOperation::sendRequest(
         return ntsa::Error(ntsa::Error::e_INVALID);
     }
 
+    return ntsa::Error();
+}
+
+ntsa::Error ClientGetDomainNameOperation::sendRequest(
+    const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
+    const ntsa::Endpoint&                        endpoint,
+    bsl::uint16_t                                transactionId)
+{
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    if (!d_pending) {
+        NTCDNS_CLIENT_OPERATION_LOG_SEND_REFUSAL();
+        return ntsa::Error(ntsa::Error::e_CANCELLED);
+    }
+
+    ntcdns::Message request;
+
+    error = this->createRequest(&request, transactionId);
+    if (error) {
+        return error;
+    }
+
     bsl::shared_ptr<bdlbb::Blob> requestBlob =
         datagramSocket->createOutgoingBlob();
 
@@ -759,23 +1133,48 @@ ntsa::Error ClientGetDomainNameOperation::sendRequest(
     const ntsa::Endpoint&                      endpoint,
     bsl::uint16_t                              transactionId)
 {
-    NTCCFG_WARNING_UNUSED(streamSocket);
-    NTCCFG_WARNING_UNUSED(endpoint);
-    NTCCFG_WARNING_UNUSED(transactionId);
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    if (!d_pending) {
+        NTCDNS_CLIENT_OPERATION_LOG_SEND_REFUSAL();
+        return ntsa::Error(ntsa::Error::e_CANCELLED);
+    }
+
+    ntcdns::Message request;
 
-    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+    error = this->createRequest(&request, transactionId);
+    if (error) {
+        return error;
+    }
+
+    return sendStreamRequest(streamSocket, request, endpoint);
 }
 
 void ClientGetDomainNameOperation::processResponse(
-    const ntcdns::Message&    response,
-    const ntsa::Endpoint&     endpoint,
-    bsl::size_t               serverIndex,
-    const bsls::TimeInterval& now)
+    const ntcdns::MessageView& responseView,
+    const ntsa::Endpoint&      endpoint,
+    bsl::size_t                serverIndex,
+    const bsls::TimeInterval&  now)
 {
     NTCCFG_WARNING_UNUSED(now);
 
     NTCI_LOG_CONTEXT();
 
+    // Fully decode the response: these operations are comparatively rare,
+    // so they are not worth decoding directly from the view. Ignore a
+    // response that cannot be decoded, as if it was never received, and let
+    // the operation time out.
+
+    ntcdns::Message response(d_allocator_p);
+
+    ntsa::Error decodeError = responseView.load(&response);
+    if (decodeError) {
+        NTCDNS_CLIENT_OPERATION_LOG_DECODE_FAILURE(decodeError);
+        return;
+    }
+
     if (serverIndex != d_serverIndex) {
         NTCDNS_CLIENT_OPERATION_LOG_STALE_RESPONSE(response,
                                                    d_serverIndex,
@@ -908,227 +1307,857 @@ bsl::size_t ClientGetDomainNameOperation::searchIndex() const
     return 0;
 }
 
-void ClientNameServer::processReadQueueLowWatermark(
-    const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
-    const ntca::ReadQueueEvent&                  event)
+ClientGetServerListOperation::ClientGetServerListOperation(
+    const bsl::string&                      name,
+    const ServerList&                       serverList,
+    const ntca::GetServiceEndpointsOptions& options,
+    const Callback&                         callback,
+    const bsl::shared_ptr<ntcdns::Cache>&   cache,
+    bslma::Allocator*                       basicAllocator)
+: d_object("ntcdns::ClientGetServerListOperation")
+, d_mutex()
+, d_name(name, basicAllocator)
+, d_serverList(serverList, basicAllocator)
+, d_serverIndex(0)
+, d_options(options)
+, d_callback(bsl::allocator_arg, basicAllocator, callback)
+, d_timer_sp()
+, d_cache_sp(cache)
+, d_pending(true)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
-    NTCCFG_WARNING_UNUSED(event);
+}
+
+ClientGetServerListOperation::~ClientGetServerListOperation()
+{
+}
+
+ntsa::Error ClientGetServerListOperation::createRequest(
+    ntcdns::Message* result,
+    bsl::uint16_t    transactionId) const
+{
+    ntcdns::Message& request = *result;
+
+    request.setId(transactionId);
+    request.setDirection(ntcdns::Direction::e_REQUEST);
+    request.setOperation(ntcdns::Operation::e_STANDARD);
+
+    request.setAa(false);
+    request.setAd(false);
+    request.setCd(false);
+    request.setRa(false);
+    request.setRd(true);
+    request.setTc(false);
 
+    ntcdns::Question& question = request.addQd();
+
+    question.setName(d_name);
+    question.setType(ntcdns::Type::e_SVR);
+    question.setClassification(ntcdns::Classification::e_INTERNET);
+
+    return ntsa::Error();
+}
+
+ntsa::Error ClientGetServerListOperation::sendRequest(
+    const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
+    const ntsa::Endpoint&                        endpoint,
+    bsl::uint16_t                                transactionId)
+{
     NTCI_LOG_CONTEXT();
 
     ntsa::Error error;
 
-    ntsa::Endpoint               endpoint;
-    bsl::shared_ptr<bdlbb::Blob> responseBlob =
-        datagramSocket->createIncomingBlob();
-
-    {
-        ntca::ReceiveContext receiveContext;
-        ntca::ReceiveOptions receiveOptions;
+    if (!d_pending) {
+        NTCDNS_CLIENT_OPERATION_LOG_SEND_REFUSAL();
+        return ntsa::Error(ntsa::Error::e_CANCELLED);
+    }
 
-        error = datagramSocket->receive(&receiveContext,
-                                        responseBlob.get(),
-                                        receiveOptions);
-        if (error) {
-            if (error != ntsa::Error(ntsa::Error::e_EOF)) {
-                NTCDNS_CLIENT_SERVER_LOG_RECEIVE_FAILURE(error);
-            }
-            return;
-        }
+    ntcdns::Message request;
 
-        if (!receiveContext.endpoint().isNull()) {
-            endpoint = receiveContext.endpoint().value();
-        }
+    error = this->createRequest(&request, transactionId);
+    if (error) {
+        return error;
     }
 
-    BSLS_ASSERT_OPT(responseBlob->numDataBuffers() == 1);
-    BSLS_ASSERT_OPT(responseBlob->numBuffers() == 1);
+    bsl::shared_ptr<bdlbb::Blob> requestBlob =
+        datagramSocket->createOutgoingBlob();
 
-    NTCDNS_CLIENT_SERVER_LOG_RECEIVE_BYTES(responseBlob, endpoint);
+    requestBlob->setLength(k_DNS_MAX_PAYLOAD_SIZE);
 
-    ntcdns::Message response(d_allocator_p);
+    BSLS_ASSERT_OPT(requestBlob->numDataBuffers() == 1);
+    BSLS_ASSERT_OPT(requestBlob->numBuffers() == 1);
+
+    ntcdns::MemoryEncoder encoder(
+        reinterpret_cast<bsl::uint8_t*>(requestBlob->buffer(0).data()),
+        requestBlob->buffer(0).size());
 
-    ntcdns::MemoryDecoder decoder(
-        reinterpret_cast<bsl::uint8_t*>(responseBlob->buffer(0).data()),
-        responseBlob->length());
+    bsl::size_t p0 = encoder.position();
 
-    error = response.decode(&decoder);
+    error = request.encode(&encoder);
     if (error) {
-        NTCDNS_CLIENT_OPERATION_LOG_DECODE_FAILURE(error);
-        return;
+        NTCDNS_CLIENT_OPERATION_LOG_ENCODE_FAILURE(request, error);
+        return error;
     }
 
-    NTCDNS_CLIENT_OPERATION_LOG_RECEIVE_OBJECT(response, endpoint);
+    bsl::size_t p1          = encoder.position();
+    bsl::size_t requestSize = p1 - p0;
 
-    bsl::shared_ptr<ntcdns::ClientOperation> operation;
-    if (!d_operationMap.remove(&operation, response.id())) {
-        NTCDNS_CLIENT_OPERATION_LOG_UNEXPECTED_RESPONSE(response, endpoint);
-        return;
+    ntcs::BlobUtil::resize(requestBlob, requestSize);
+
+    BSLS_ASSERT_OPT(requestBlob->numDataBuffers() == 1);
+    BSLS_ASSERT_OPT(requestBlob->numBuffers() == 1);
+
+    NTCDNS_CLIENT_OPERATION_LOG_SEND_OBJECT(request, endpoint);
+    NTCDNS_CLIENT_OPERATION_LOG_SEND_BYTES(requestBlob, endpoint);
+
+    ntca::SendOptions sendOptions;
+    sendOptions.setEndpoint(endpoint);
+
+    error = datagramSocket->send(*requestBlob, sendOptions);
+    if (error) {
+        NTCDNS_CLIENT_OPERATION_LOG_SEND_FAILURE(request, error);
+        return error;
     }
 
-    bool tryNextServer = false;
+    return ntsa::Error();
+}
+
+ntsa::Error ClientGetServerListOperation::sendRequest(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    const ntsa::Endpoint&                      endpoint,
+    bsl::uint16_t                              transactionId)
+{
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
 
-    if (response.error() == ntcdns::Error::e_OK) {
-        operation->processResponse(response,
-                                   d_endpoint,
-                                   d_index,
-                                   datagramSocket->currentTime());
+    if (!d_pending) {
+        NTCDNS_CLIENT_OPERATION_LOG_SEND_REFUSAL();
+        return ntsa::Error(ntsa::Error::e_CANCELLED);
     }
-    else if (response.tc()) {
-        // MRM: If truncated, try on TCP socket.
+
+    ntcdns::Message request;
+
+    error = this->createRequest(&request, transactionId);
+    if (error) {
+        return error;
     }
-    else {
-        if (response.error() == ntcdns::Error::e_NAME_ERROR) {
-            // MRM: Name was not found on this name server. Try again with a
-            // different name prefixed with the next scope.
 
-            if (operation->tryNextSearch()) {
-                bsl::uint16_t transactionId = generateTransactionId();
+    return sendStreamRequest(streamSocket, request, endpoint);
+}
 
-                if (!d_operationMap.add(transactionId, operation)) {
-                    operation->processError(
-                        ntsa::Error(ntsa::Error::e_INVALID));
-                    return;
-                }
+void ClientGetServerListOperation::processResponse(
+    const ntcdns::MessageView& responseView,
+    const ntsa::Endpoint&      endpoint,
+    bsl::size_t                serverIndex,
+    const bsls::TimeInterval&  now)
+{
+    NTCI_LOG_CONTEXT();
 
-                error = operation->sendRequest(datagramSocket,
-                                               d_endpoint,
-                                               transactionId);
-                if (error) {
-                    d_operationMap.remove(transactionId);
-                    tryNextServer = true;
-                }
-            }
-            else {
-                tryNextServer = true;
-            }
-        }
-        else if (response.error() == ntcdns::Error::e_REFUSED ||
-                 response.error() == ntcdns::Error::e_SERVER_FAILURE ||
-                 response.error() == ntcdns::Error::e_NOT_IMPLEMENTED)
-        {
-            tryNextServer = true;
+    // Fully decode the response: these operations are comparatively rare,
+    // so they are not worth decoding directly from the view. Ignore a
+    // response that cannot be decoded, as if it was never received, and let
+    // the operation time out.
+
+    ntcdns::Message response(d_allocator_p);
+
+    ntsa::Error decodeError = responseView.load(&response);
+    if (decodeError) {
+        NTCDNS_CLIENT_OPERATION_LOG_DECODE_FAILURE(decodeError);
+        return;
+    }
+
+    if (serverIndex != d_serverIndex) {
+        NTCDNS_CLIENT_OPERATION_LOG_STALE_RESPONSE(response,
+                                                   d_serverIndex,
+                                                   serverIndex);
+        return;
+    }
+
+    if (d_pending.swap(false) == false) {
+        NTCDNS_CLIENT_OPERATION_LOG_REDUNDANT_RESPONSE(response);
+        return;
+    }
+
+    if (d_timer_sp) {
+        d_timer_sp->close();
+    }
+
+    RecordList                       recordList;
+    ntca::GetServiceEndpointsContext context;
+
+    context.setName(d_name);
+    context.setSource(ntca::ResolverSource::e_SERVER);
+    context.setNameServer(endpoint);
+
+    bdlb::NullableValue<bsl::size_t> timeToLive;
+
+    for (bsl::size_t i = 0; i < response.ancount(); ++i) {
+        const ntcdns::ResourceRecord& answer = response.an(i);
+
+        if (!answer.rdata().isServerValue()) {
+            continue;
         }
-        else if (response.error() == ntcdns::Error::e_FORMAT_ERROR) {
-            operation->processError(ntsa::Error(ntsa::Error::e_INVALID));
+
+        recordList.push_back(answer.rdata().server());
+
+        if (timeToLive.isNull()) {
+            timeToLive.makeValue(answer.ttl());
         }
         else {
-            operation->processError(ntsa::Error(ntsa::Error::e_INVALID));
+            bsl::size_t timeToLiveValue = timeToLive.value();
+            if (timeToLiveValue != answer.ttl()) {
+                NTCDNS_CLIENT_OPERATION_LOG_TTL_MISMATCH(answer.ttl(),
+                                                         timeToLiveValue);
+                if (answer.ttl() < timeToLiveValue) {
+                    timeToLive = answer.ttl();
+                }
+            }
         }
     }
 
-    if (tryNextServer) {
-        while (true) {
-            bsl::shared_ptr<ntcdns::ClientNameServer> nameServer =
-                operation->tryNextServer();
+    // Name servers typically include the IP addresses of the targets in the
+    // additional section of the response. Cache them so that resolving the
+    // targets does not require another round-trip to the name server.
 
-            if (nameServer) {
-                error = nameServer->initiate(operation);
-                if (error) {
-                    continue;
-                }
-                else {
-                    break;
-                }
+    if (d_cache_sp) {
+        for (bsl::size_t i = 0; i < response.arcount(); ++i) {
+            const ntcdns::ResourceRecord& additional = response.ar(i);
+
+            if (additional.rdata().isIpv4Value()) {
+                BSLMF_ASSERT(sizeof additional.rdata().ipv4() == 4);
+                ntsa::Ipv4Address ipv4Address;
+                ipv4Address.copyFrom(&additional.rdata().ipv4(),
+                                     sizeof additional.rdata().ipv4());
+
+                d_cache_sp->updateHost(additional.name(),
+                                       ntsa::IpAddress(ipv4Address),
+                                       endpoint,
+                                       additional.ttl(),
+                                       now);
             }
-            else {
-                operation->processError(ntsa::Error(ntsa::Error::e_EOF));
-                break;
+            else if (additional.rdata().isIpv6Value()) {
+                BSLMF_ASSERT(sizeof additional.rdata().ipv6() == 16);
+                ntsa::Ipv6Address ipv6Address;
+                ipv6Address.copyFrom(&additional.rdata().ipv6(),
+                                     sizeof additional.rdata().ipv6());
+
+                d_cache_sp->updateHost(additional.name(),
+                                       ntsa::IpAddress(ipv6Address),
+                                       endpoint,
+                                       additional.ttl(),
+                                       now);
+            }
+        }
+    }
+
+    if (recordList.empty()) {
+        context.setError(ntsa::Error(ntsa::Error::e_EOF));
+    }
+    else {
+        if (!timeToLive.isNull()) {
+            context.setTimeToLive(timeToLive.value());
+
+            if (d_cache_sp) {
+                d_cache_sp->updateService(d_name,
+                                          recordList,
+                                          endpoint,
+                                          timeToLive.value(),
+                                          now);
             }
         }
     }
+
+    d_callback(recordList, context);
+    d_callback = Callback();
+
+    d_serverList.clear();
 }
 
-void ClientNameServer::processReadQueueHighWatermark(
+void ClientGetServerListOperation::processError(const ntsa::Error& error)
+{
+    if (d_pending.swap(false) == false) {
+        return;
+    }
+
+    if (d_timer_sp) {
+        d_timer_sp->close();
+    }
+
+    RecordList recordList;
+
+    ntca::GetServiceEndpointsContext context;
+    context.setName(d_name);
+    context.setError(error);
+
+    d_callback(recordList, context);
+    d_callback = Callback();
+
+    d_serverList.clear();
+}
+
+bsl::shared_ptr<ntcdns::ClientNameServer> ClientGetServerListOperation::
+    tryNextServer()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    bsl::shared_ptr<ntcdns::ClientNameServer> result;
+
+    if (d_serverIndex < d_serverList.size() - 1) {
+        ++d_serverIndex;
+        result = d_serverList[d_serverIndex];
+    }
+
+    return result;
+}
+
+bool ClientGetServerListOperation::tryNextSearch()
+{
+    return false;
+}
+
+const bsl::string& ClientGetServerListOperation::name() const
+{
+    return d_name;
+}
+
+const ntca::GetServiceEndpointsOptions& ClientGetServerListOperation::
+    options() const
+{
+    return d_options;
+}
+
+bsl::size_t ClientGetServerListOperation::serverIndex() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_serverIndex;
+}
+
+void ClientDatagramChannel::processReadQueueLowWatermark(
     const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
     const ntca::ReadQueueEvent&                  event)
 {
-    NTCCFG_WARNING_UNUSED(datagramSocket);
     NTCCFG_WARNING_UNUSED(event);
+
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    ntsa::Endpoint               endpoint;
+    bsl::shared_ptr<bdlbb::Blob> responseBlob =
+        datagramSocket->createIncomingBlob();
+
+    {
+        ntca::ReceiveContext receiveContext;
+        ntca::ReceiveOptions receiveOptions;
+
+        error = datagramSocket->receive(&receiveContext,
+                                        responseBlob.get(),
+                                        receiveOptions);
+        if (error) {
+            if (error != ntsa::Error(ntsa::Error::e_EOF)) {
+                NTCDNS_CLIENT_SERVER_LOG_RECEIVE_FAILURE(error);
+            }
+            return;
+        }
+
+        if (!receiveContext.endpoint().isNull()) {
+            endpoint = receiveContext.endpoint().value();
+        }
+    }
+
+    BSLS_ASSERT_OPT(responseBlob->numBuffers() == 1);
+
+    NTCDNS_CLIENT_SERVER_LOG_RECEIVE_BYTES(responseBlob, endpoint);
+
+    ntcdns::MessageView response;
+
+    error = response.decode(
+        reinterpret_cast<const bsl::uint8_t*>(responseBlob->buffer(0).data()),
+        static_cast<bsl::size_t>(responseBlob->length()));
+    if (error) {
+        NTCDNS_CLIENT_OPERATION_LOG_DECODE_FAILURE(error);
+        return;
+    }
+
+    NTCDNS_CLIENT_OPERATION_LOG_RECEIVE_OBJECT(response, endpoint);
+
+    // The datagram socket is connected to the name server, so the kernel
+    // has already discarded any datagram from any other source, and the
+    // response need only be matched against the requests sent through this
+    // socket.
+
+    bsl::shared_ptr<ntcdns::ClientOperation> operation;
+    if (!d_operationMap.remove(&operation, response.id())) {
+        NTCDNS_CLIENT_OPERATION_LOG_UNEXPECTED_RESPONSE(response, d_endpoint);
+        return;
+    }
+
+    bsl::shared_ptr<ntcdns::ClientNameServer> nameServer =
+        d_nameServer_wp.lock();
+    if (!nameServer) {
+        return;
+    }
+
+    nameServer->processResponse(operation,
+                                response,
+                                datagramSocket->currentTime(),
+                                false);
 }
 
-void ClientNameServer::processWriteQueueLowWatermark(
+void ClientDatagramChannel::processWriteQueueLowWatermark(
     const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
     const ntca::WriteQueueEvent&                 event)
 {
-    NTCCFG_WARNING_UNUSED(datagramSocket);
     NTCCFG_WARNING_UNUSED(event);
 
-    this->flush();
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (datagramSocket == d_datagramSocket_sp && !d_connecting) {
+        this->privateFlush();
+    }
 }
 
-void ClientNameServer::processWriteQueueHighWatermark(
+void ClientDatagramChannel::processShutdownComplete(
     const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
-    const ntca::WriteQueueEvent&                 event)
+    const ntca::ShutdownEvent&                   event)
 {
-    NTCCFG_WARNING_UNUSED(datagramSocket);
     NTCCFG_WARNING_UNUSED(event);
+
+    OperationVector operationVector(d_allocator_p);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (datagramSocket != d_datagramSocket_sp) {
+            return;
+        }
+
+        d_datagramSocket_sp->registerSession(
+            bsl::shared_ptr<ntci::DatagramSocketSession>());
+        d_datagramSocket_sp.reset();
+        d_connecting = false;
+
+        this->removeAll(&operationVector);
+    }
+
+    // Retry each operation outstanding on the socket on the next name
+    // server. When the name server is stopping, its operations have already
+    // been cancelled.
+
+    for (OperationVector::iterator it = operationVector.begin();
+         it != operationVector.end();
+         ++it)
+    {
+        ClientNameServer::retry(*it);
+    }
+
+    bsl::shared_ptr<ntcdns::ClientNameServer> nameServer =
+        d_nameServer_wp.lock();
+    if (nameServer) {
+        nameServer->processChannelClosed();
+    }
 }
 
-void ClientNameServer::processShutdownInitiated(
+void ClientDatagramChannel::processConnected(
     const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
-    const ntca::ShutdownEvent&                   event)
+    const bsl::shared_ptr<ntci::Connector>&      connector,
+    const ntca::ConnectEvent&                    event)
 {
-    NTCCFG_WARNING_UNUSED(datagramSocket);
-    NTCCFG_WARNING_UNUSED(event);
+    NTCCFG_WARNING_UNUSED(connector);
+
+    ntsa::Error error;
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (datagramSocket != d_datagramSocket_sp) {
+        return;
+    }
+
+    error = event.context().error();
+
+    if (!error) {
+        error = d_datagramSocket_sp->relaxFlowControl(
+            ntca::FlowControlType::e_RECEIVE);
+    }
+
+    if (error) {
+        // The socket is closed asynchronously, after which each operation
+        // queued to be sent through it is retried on the next name server.
+
+        d_datagramSocket_sp->close();
+        return;
+    }
+
+    d_connecting = false;
+
+    this->privateFlush();
+}
+
+ntsa::Error ClientDatagramChannel::privateOpen()
+{
+    ntsa::Error error;
+
+    bsl::shared_ptr<ClientDatagramChannel> self = this->getSelf(this);
+
+    ntca::DatagramSocketOptions datagramSocketOptions;
+    datagramSocketOptions.setMaxDatagramSize(k_UDP_MAX_PAYLOAD_SIZE);
+
+    bsl::shared_ptr<ntci::DatagramSocket> datagramSocket;
+
+    // Bind the socket to a randomly chosen source port, so that responses
+    // are harder to forge, trying a few ports before deferring the choice
+    // of source port to the operating system.
+
+    for (bsl::size_t attempt = 0; attempt <= k_UDP_SOURCE_PORT_ATTEMPTS;
+         ++attempt)
+    {
+        const ntsa::Port sourcePort = attempt < k_UDP_SOURCE_PORT_ATTEMPTS
+                                          ? generateSourcePort()
+                                          : 0;
+
+        if (d_endpoint.isIp()) {
+            if (d_endpoint.ip().host().isV4()) {
+                datagramSocketOptions.setSourceEndpoint(
+                    ntsa::Endpoint(ntsa::IpEndpoint(ntsa::Ipv4Address::any(),
+                                                    sourcePort)));
+            }
+            else if (d_endpoint.ip().host().isV6()) {
+                datagramSocketOptions.setSourceEndpoint(
+                    ntsa::Endpoint(ntsa::IpEndpoint(ntsa::Ipv6Address::any(),
+                                                    sourcePort)));
+            }
+            else {
+                return ntsa::Error(ntsa::Error::e_INVALID);
+            }
+        }
+        else if (d_endpoint.isLocal()) {
+            ntsa::LocalName localName;
+            error = ntsa::LocalName::generateUnique(&localName);
+            if (error) {
+                return error;
+            }
+            datagramSocketOptions.setSourceEndpoint(ntsa::Endpoint(localName));
+        }
+        else {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+
+        datagramSocket = d_datagramSocketFactory_sp->createDatagramSocket(
+            datagramSocketOptions,
+            d_allocator_p);
+
+        error = datagramSocket->registerSession(self);
+        if (error) {
+            datagramSocket->close();
+            return error;
+        }
+
+        error = datagramSocket->open();
+        if (!error) {
+            break;
+        }
+
+        datagramSocket->close();
+
+        if (d_endpoint.isLocal() || sourcePort == 0) {
+            return error;
+        }
+    }
+
+    ntca::ConnectOptions connectOptions;
+
+    ntci::ConnectCallback connectCallback =
+        datagramSocket->createConnectCallback(
+            bdlf::BindUtil::bind(&ClientDatagramChannel::processConnected,
+                                 self,
+                                 datagramSocket,
+                                 bdlf::PlaceHolders::_1,
+                                 bdlf::PlaceHolders::_2),
+            d_allocator_p);
+
+    error =
+        datagramSocket->connect(d_endpoint, connectOptions, connectCallback);
+    if (error) {
+        datagramSocket->close();
+        return error;
+    }
+
+    d_datagramSocket_sp = datagramSocket;
+    d_connecting        = true;
+
+    return ntsa::Error();
+}
+
+void ClientDatagramChannel::privateFlush()
+{
+    ntsa::Error error;
+
+    bsl::shared_ptr<ntcdns::ClientOperation> operation;
+    while (d_operationQueue.pop(&operation)) {
+        bsl::uint16_t transactionId = generateTransactionId();
+
+        if (!d_operationMap.add(transactionId, operation)) {
+            ClientNameServer::retry(operation);
+            continue;
+        }
+
+        error = operation->sendRequest(d_datagramSocket_sp,
+                                       d_endpoint,
+                                       transactionId);
+        if (error) {
+            d_operationMap.remove(transactionId);
+            ClientNameServer::retry(operation);
+        }
+    }
+}
+
+ClientDatagramChannel::ClientDatagramChannel(
+    const bsl::shared_ptr<ntcdns::ClientNameServer>&    nameServer,
+    const bsl::shared_ptr<ntci::DatagramSocketFactory>& datagramSocketFactory,
+    const ntsa::Endpoint&                               endpoint,
+    bsl::size_t                                         index,
+    bslma::Allocator*                                   basicAllocator)
+: d_object("ntcdns::ClientDatagramChannel")
+, d_operationQueue(basicAllocator)
+, d_operationMap(basicAllocator)
+, d_mutex()
+, d_datagramSocket_sp()
+, d_datagramSocketFactory_sp(datagramSocketFactory)
+, d_connecting(false)
+, d_closed(false)
+, d_nameServer_wp(nameServer)
+, d_endpoint(endpoint)
+, d_index(index)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_OPT(d_datagramSocketFactory_sp);
+    BSLS_ASSERT_OPT(!d_endpoint.isUndefined());
+}
+
+ClientDatagramChannel::~ClientDatagramChannel()
+{
+}
+
+ntsa::Error ClientDatagramChannel::initiate(
+    const bsl::shared_ptr<ntcdns::ClientOperation>& operation)
+{
+    ntsa::Error error;
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (d_closed) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    d_operationQueue.push(operation);
+
+    if (!d_datagramSocket_sp) {
+        error = this->privateOpen();
+        if (error) {
+            d_operationQueue.remove(operation);
+            return error;
+        }
+    }
+    else if (!d_connecting) {
+        this->privateFlush();
+    }
+
+    return ntsa::Error();
+}
+
+bool ClientDatagramChannel::remove(
+    const bsl::shared_ptr<ntcdns::ClientOperation>& operation)
+{
+    if (d_operationMap.removeValue(operation) != 0) {
+        return true;
+    }
+
+    return d_operationQueue.remove(operation) != 0;
+}
+
+void ClientDatagramChannel::removeAll(
+    bsl::vector<bsl::shared_ptr<ntcdns::ClientOperation> >* result)
+{
+    {
+        OperationMap operationMap(d_allocator_p);
+        operationMap.swap(&d_operationMap);
+
+        operationMap.values(result);
+    }
+
+    {
+        OperationQueue operationQueue(d_allocator_p);
+        operationQueue.swap(&d_operationQueue);
+
+        operationQueue.load(result);
+    }
+}
+
+void ClientDatagramChannel::close()
+{
+    bsl::shared_ptr<ntci::DatagramSocket> datagramSocket;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        d_closed       = true;
+        datagramSocket = d_datagramSocket_sp;
+    }
+
+    if (datagramSocket) {
+        datagramSocket->shutdown(ntsa::ShutdownType::e_BOTH,
+                                 ntsa::ShutdownMode::e_IMMEDIATE);
+        datagramSocket->close();
+    }
 }
 
-void ClientNameServer::processShutdownReceive(
-    const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
-    const ntca::ShutdownEvent&                   event)
+bool ClientDatagramChannel::isClosed() const
 {
-    NTCCFG_WARNING_UNUSED(datagramSocket);
-    NTCCFG_WARNING_UNUSED(event);
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return !d_datagramSocket_sp;
 }
 
-void ClientNameServer::processShutdownSend(
-    const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
-    const ntca::ShutdownEvent&                   event)
+bsl::size_t ClientDatagramChannel::index() const
 {
-    NTCCFG_WARNING_UNUSED(datagramSocket);
-    NTCCFG_WARNING_UNUSED(event);
+    return d_index;
 }
 
-void ClientNameServer::processShutdownComplete(
-    const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
-    const ntca::ShutdownEvent&                   event)
+void ClientNameServer::processReadQueueLowWatermark(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    const ntca::ReadQueueEvent&                event)
 {
     NTCCFG_WARNING_UNUSED(event);
 
-    bslmt::LockGuard<bslmt::Mutex> stateSocketLock(&d_stateMutex);
+    NTCI_LOG_CONTEXT();
 
-    bslmt::LockGuard<bslmt::Mutex> datagramSocketLock(&d_datagramSocketMutex);
+    ntsa::Error error;
 
-    bslmt::LockGuard<bslmt::Mutex> streamSocketLock(&d_streamSocketMutex);
+    // Each message received over the stream is prefixed by its length,
+    // encoded as a 16-bit unsigned integer in network byte order. Receive
+    // as many complete messages as are available, and when the next prefix
+    // or message is incomplete, wait until the read queue has grown to its
+    // size.
 
-    if (datagramSocket == d_datagramSocket_sp) {
-        d_datagramSocket_sp->registerSession(
-            bsl::shared_ptr<ntci::DatagramSocketSession>());
-        d_datagramSocket_sp.reset();
+    while (true) {
+        if (d_streamResponseSize == 0) {
+            bsl::shared_ptr<bdlbb::Blob> prefixBlob =
+                streamSocket->createIncomingBlob();
 
-        if (!d_datagramSocket_sp && !d_streamSocket_sp) {
-            if (d_state == e_STATE_STOPPING) {
-                d_state = e_STATE_STOPPED;
-                d_stateCondition.signal();
+            ntca::ReceiveContext receiveContext;
+            ntca::ReceiveOptions receiveOptions;
+
+            receiveOptions.setMinSize(k_TCP_LENGTH_PREFIX_SIZE);
+            receiveOptions.setMaxSize(k_TCP_LENGTH_PREFIX_SIZE);
+
+            error = streamSocket->receive(&receiveContext,
+                                          prefixBlob.get(),
+                                          receiveOptions);
+            if (error) {
+                if (error == ntsa::Error(ntsa::Error::e_WOULD_BLOCK)) {
+                    streamSocket->setReadQueueLowWatermark(
+                        k_TCP_LENGTH_PREFIX_SIZE);
+                }
+                else if (error != ntsa::Error(ntsa::Error::e_EOF)) {
+                    NTCDNS_CLIENT_SERVER_LOG_RECEIVE_FAILURE(error);
+                }
+                return;
+            }
+
+            bsl::uint8_t prefix[k_TCP_LENGTH_PREFIX_SIZE];
+            bdlbb::BlobUtil::copy(reinterpret_cast<char*>(prefix),
+                                  *prefixBlob,
+                                  0,
+                                  sizeof prefix);
+
+            d_streamResponseSize =
+                (static_cast<bsl::size_t>(prefix[0]) << 8) |
+                static_cast<bsl::size_t>(prefix[1]);
+
+            if (d_streamResponseSize == 0) {
+                NTCDNS_CLIENT_SERVER_LOG_RECEIVE_FAILURE(
+                    ntsa::Error(ntsa::Error::e_INVALID));
+                this->closeStream(streamSocket);
+                return;
             }
         }
-    }
-}
 
-void ClientNameServer::processError(
-    const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
-    const ntca::ErrorEvent&                      event)
-{
-    NTCCFG_WARNING_UNUSED(datagramSocket);
-    NTCCFG_WARNING_UNUSED(event);
-}
+        bsl::shared_ptr<bdlbb::Blob> responseBlob =
+            streamSocket->createIncomingBlob();
 
-void ClientNameServer::processReadQueueLowWatermark(
-    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
-    const ntca::ReadQueueEvent&                event)
-{
-    NTCCFG_WARNING_UNUSED(streamSocket);
-    NTCCFG_WARNING_UNUSED(event);
+        {
+            ntca::ReceiveContext receiveContext;
+            ntca::ReceiveOptions receiveOptions;
+
+            receiveOptions.setMinSize(d_streamResponseSize);
+            receiveOptions.setMaxSize(d_streamResponseSize);
+
+            error = streamSocket->receive(&receiveContext,
+                                          responseBlob.get(),
+                                          receiveOptions);
+            if (error) {
+                if (error == ntsa::Error(ntsa::Error::e_WOULD_BLOCK)) {
+                    streamSocket->setReadQueueLowWatermark(
+                        d_streamResponseSize);
+                }
+                else if (error != ntsa::Error(ntsa::Error::e_EOF)) {
+                    NTCDNS_CLIENT_SERVER_LOG_RECEIVE_FAILURE(error);
+                }
+                return;
+            }
+        }
+
+        d_streamResponseSize = 0;
+
+        NTCDNS_CLIENT_SERVER_LOG_RECEIVE_BYTES(responseBlob, d_endpoint);
+
+        bsl::vector<char> responseData(d_allocator_p);
+        responseData.resize(
+            static_cast<bsl::size_t>(responseBlob->length()));
+
+        bdlbb::BlobUtil::copy(responseData.data(),
+                              *responseBlob,
+                              0,
+                              responseBlob->length());
+
+        ntcdns::MessageView response;
+
+        error = response.decode(
+            reinterpret_cast<const bsl::uint8_t*>(responseData.data()),
+            responseData.size());
+        if (error) {
+            NTCDNS_CLIENT_OPERATION_LOG_DECODE_FAILURE(error);
+            continue;
+        }
+
+        NTCDNS_CLIENT_OPERATION_LOG_RECEIVE_OBJECT(response, d_endpoint);
+
+        bsl::shared_ptr<ntcdns::ClientOperation> operation;
+        if (d_streamOperationMap.remove(&operation, response.id())) {
+            this->processResponse(operation,
+                                  response,
+                                  streamSocket->currentTime(),
+                                  true);
+        }
+        else {
+            NTCDNS_CLIENT_OPERATION_LOG_UNEXPECTED_RESPONSE(response,
+                                                            d_endpoint);
+        }
+
+        // Close the connection if it remains idle, with no requests
+        // outstanding, for the idle timeout.
+
+        bslmt::LockGuard<bslmt::Mutex> streamSocketLock(&d_streamSocketMutex);
+
+        if (streamSocket == d_streamSocket_sp && d_streamIdleTimer_sp &&
+            d_streamOperationMap.empty() && d_streamOperationQueue.empty())
+        {
+            d_streamIdleTimer_sp->schedule(
+                d_streamIdleTimer_sp->currentTime() +
+                bsls::TimeInterval(
+                    static_cast<bsls::Types::Int64>(k_TCP_IDLE_TIMEOUT),
+                    0));
+        }
+    }
 }
 
 void ClientNameServer::processReadQueueHighWatermark(
@@ -1145,8 +2174,6 @@ void ClientNameServer::processWriteQueueLowWatermark(
 {
     NTCCFG_WARNING_UNUSED(streamSocket);
     NTCCFG_WARNING_UNUSED(event);
-
-    this->flush();
 }
 
 void ClientNameServer::processWriteQueueHighWatermark(
@@ -1169,8 +2196,9 @@ void ClientNameServer::processShutdownReceive(
     const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
     const ntca::ShutdownEvent&                 event)
 {
-    NTCCFG_WARNING_UNUSED(streamSocket);
     NTCCFG_WARNING_UNUSED(event);
+
+    this->closeStream(streamSocket);
 }
 
 void ClientNameServer::processShutdownSend(
@@ -1189,8 +2217,6 @@ void ClientNameServer::processShutdownComplete(
 
     bslmt::LockGuard<bslmt::Mutex> stateSocketLock(&d_stateMutex);
 
-    bslmt::LockGuard<bslmt::Mutex> datagramSocketLock(&d_datagramSocketMutex);
-
     bslmt::LockGuard<bslmt::Mutex> streamSocketLock(&d_streamSocketMutex);
 
     if (streamSocket == d_streamSocket_sp) {
@@ -1198,7 +2224,7 @@ void ClientNameServer::processShutdownComplete(
             bsl::shared_ptr<ntci::StreamSocketSession>());
         d_streamSocket_sp.reset();
 
-        if (!d_datagramSocket_sp && !d_streamSocket_sp) {
+        if (this->privateIsClosed()) {
             if (d_state == e_STATE_STOPPING) {
                 d_state = e_STATE_STOPPED;
                 d_stateCondition.signal();
@@ -1211,29 +2237,30 @@ void ClientNameServer::processError(
     const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
     const ntca::ErrorEvent&                    event)
 {
-    NTCCFG_WARNING_UNUSED(streamSocket);
     NTCCFG_WARNING_UNUSED(event);
+
+    this->closeStream(streamSocket);
 }
 
-ntsa::Error ClientNameServer::createDatagramSocket()
+ntsa::Error ClientNameServer::createStreamSocket()
 {
     ntsa::Error error;
 
     bsl::shared_ptr<ClientNameServer> self = this->getSelf(this);
 
-    if (d_datagramSocket_sp) {
+    if (d_streamSocket_sp) {
         return ntsa::Error(ntsa::Error::e_INVALID);
     }
 
-    ntca::DatagramSocketOptions datagramSocketOptions;
+    ntca::StreamSocketOptions streamSocketOptions;
 
     if (d_endpoint.isIp()) {
         if (d_endpoint.ip().host().isV4()) {
-            datagramSocketOptions.setSourceEndpoint(
+            streamSocketOptions.setSourceEndpoint(
                 ntsa::Endpoint(ntsa::IpEndpoint(ntsa::Ipv4Address::any(), 0)));
         }
         else if (d_endpoint.ip().host().isV6()) {
-            datagramSocketOptions.setSourceEndpoint(
+            streamSocketOptions.setSourceEndpoint(
                 ntsa::Endpoint(ntsa::IpEndpoint(ntsa::Ipv6Address::any(), 0)));
         }
         else {
@@ -1246,222 +2273,384 @@ ntsa::Error ClientNameServer::createDatagramSocket()
         if (error) {
             return error;
         }
-        datagramSocketOptions.setSourceEndpoint(ntsa::Endpoint(localName));
+        streamSocketOptions.setSourceEndpoint(ntsa::Endpoint(localName));
     }
     else {
         return ntsa::Error(ntsa::Error::e_INVALID);
     }
 
-    datagramSocketOptions.setMaxDatagramSize(k_UDP_MAX_PAYLOAD_SIZE);
+    if (d_endpoint.isIp() && d_endpoint.ip().host().isV6()) {
+        streamSocketOptions.setTransport(ntsa::Transport::e_TCP_IPV6_STREAM);
+    }
+    else if (d_endpoint.isLocal()) {
+        streamSocketOptions.setTransport(ntsa::Transport::e_LOCAL_STREAM);
+    }
+    else {
+        streamSocketOptions.setTransport(ntsa::Transport::e_TCP_IPV4_STREAM);
+    }
 
-    bsl::shared_ptr<ntci::DatagramSocket> datagramSocket =
-        d_datagramSocketFactory_sp->createDatagramSocket(datagramSocketOptions,
-                                                         d_allocator_p);
+    bsl::shared_ptr<ntci::StreamSocket> streamSocket =
+        d_streamSocketFactory_sp->createStreamSocket(streamSocketOptions,
+                                                     d_allocator_p);
 
-    error = datagramSocket->registerSession(self);
+    error = streamSocket->registerSession(self);
     if (error) {
-        d_datagramSocket_sp->close();
         return error;
     }
 
-    error = datagramSocket->open();
+    error = streamSocket->open();
     if (error) {
-        datagramSocket->close();
         return error;
     }
 
     ntca::ConnectOptions connectOptions;
 
     ntci::ConnectCallback connectCallback =
-        datagramSocket->createConnectCallback(bdlf::BindUtil::bind(
-            &ClientNameServer::processDatagramSocketConnected,
-            self,
-            datagramSocket,
-            bdlf::PlaceHolders::_1,
-            bdlf::PlaceHolders::_2));
+        streamSocket->createConnectCallback(
+            bdlf::BindUtil::bind(
+                &ClientNameServer::processStreamSocketConnected,
+                self,
+                streamSocket,
+                bdlf::PlaceHolders::_1,
+                bdlf::PlaceHolders::_2),
+            d_allocator_p);
 
-    error =
-        datagramSocket->connect(d_endpoint, connectOptions, connectCallback);
+    error = streamSocket->connect(d_endpoint, connectOptions, connectCallback);
     if (error) {
-        datagramSocket->close();
         return error;
     }
 
     return ntsa::Error();
 }
 
-ntsa::Error ClientNameServer::createStreamSocket()
+void ClientNameServer::processStreamSocketConnected(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    const bsl::shared_ptr<ntci::Connector>&    connector,
+    const ntca::ConnectEvent&                  event)
 {
+    NTCCFG_WARNING_UNUSED(connector);
+
     ntsa::Error error;
 
     bsl::shared_ptr<ClientNameServer> self = this->getSelf(this);
 
-    if (d_streamSocket_sp) {
-        return ntsa::Error(ntsa::Error::e_INVALID);
-    }
+    OperationVector operationVector(d_allocator_p);
 
-    ntca::StreamSocketOptions streamSocketOptions;
+    {
+        bslmt::LockGuard<bslmt::Mutex> stateLock(&d_stateMutex);
 
-    if (d_endpoint.isIp()) {
-        if (d_endpoint.ip().host().isV4()) {
-            streamSocketOptions.setSourceEndpoint(
-                ntsa::Endpoint(ntsa::IpEndpoint(ntsa::Ipv4Address::any(), 0)));
+        bslmt::LockGuard<bslmt::Mutex> streamSocketLock(
+            &d_streamSocketMutex);
+
+        d_streamSocketConnecting = false;
+
+        error = event.context().error();
+
+        if (!error && d_state != e_STATE_STARTED) {
+            error = ntsa::Error(ntsa::Error::e_CANCELLED);
         }
-        else if (d_endpoint.ip().host().isV6()) {
-            streamSocketOptions.setSourceEndpoint(
-                ntsa::Endpoint(ntsa::IpEndpoint(ntsa::Ipv6Address::any(), 0)));
+
+        if (!error) {
+            error = streamSocket->relaxFlowControl(
+                ntca::FlowControlType::e_RECEIVE);
         }
-        else {
-            return ntsa::Error(ntsa::Error::e_INVALID);
+
+        if (!error) {
+            error = streamSocket->setReadQueueLowWatermark(
+                k_TCP_LENGTH_PREFIX_SIZE);
+        }
+
+        if (!error) {
+            ntca::TimerOptions timerOptions;
+            timerOptions.setOneShot(true);
+            timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
+            timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
+
+            ntci::TimerCallback timerCallback =
+                streamSocket->createTimerCallback(
+                    bdlf::BindUtil::bind(
+                        &ClientNameServer::processStreamSocketIdle,
+                        self,
+                        streamSocket,
+                        bdlf::PlaceHolders::_1,
+                        bdlf::PlaceHolders::_2),
+                    d_allocator_p);
+
+            d_streamIdleTimer_sp = streamSocket->createTimer(timerOptions,
+                                                             timerCallback,
+                                                             d_allocator_p);
+
+            d_streamSocket_sp    = streamSocket;
+            d_streamResponseSize = 0;
+
+            this->flushStream();
+            return;
         }
+
+        OperationQueue operationQueue(d_allocator_p);
+        operationQueue.swap(&d_streamOperationQueue);
+
+        operationQueue.load(&operationVector);
     }
-    else if (d_endpoint.isLocal()) {
-        ntsa::LocalName   localName;
-        const ntsa::Error error = ntsa::LocalName::generateUnique(&localName);
+
+    streamSocket->close();
+
+    for (OperationVector::iterator it = operationVector.begin();
+         it != operationVector.end();
+         ++it)
+    {
+        ClientNameServer::retry(*it);
+    }
+}
+
+void ClientNameServer::processStreamSocketIdle(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    const bsl::shared_ptr<ntci::Timer>&        timer,
+    const ntca::TimerEvent&                    event)
+{
+    NTCCFG_WARNING_UNUSED(timer);
+
+    if (event.type() != ntca::TimerEventType::e_DEADLINE) {
+        return;
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> streamSocketLock(
+            &d_streamSocketMutex);
+
+        if (streamSocket != d_streamSocket_sp) {
+            return;
+        }
+
+        if (!d_streamOperationMap.empty() || !d_streamOperationQueue.empty())
+        {
+            return;
+        }
+    }
+
+    this->closeStream(streamSocket);
+}
+
+void ClientNameServer::processResponse(
+    const bsl::shared_ptr<ntcdns::ClientOperation>& operation,
+    const ntcdns::MessageView&                      response,
+    const bsls::TimeInterval&                       now,
+    bool                                            stream)
+{
+    ntsa::Error error;
+
+    bool tryNextServer = false;
+
+    if (response.tc() && !stream) {
+        // The response does not fit in a datagram. Send the request again to
+        // the same name server over the stream socket.
+
+        error = this->initiateStream(operation);
         if (error) {
-            return error;
+            tryNextServer = true;
         }
-        streamSocketOptions.setSourceEndpoint(ntsa::Endpoint(localName));
+    }
+    else if (response.error() == ntcdns::Error::e_OK) {
+        operation->processResponse(response, d_endpoint, d_index, now);
     }
     else {
-        return ntsa::Error(ntsa::Error::e_INVALID);
+        if (response.error() == ntcdns::Error::e_NAME_ERROR) {
+            // MRM: Name was not found on this name server. Try again with a
+            // different name prefixed with the next scope.
+
+            if (operation->tryNextSearch()) {
+                if (stream) {
+                    error = this->initiateStream(operation);
+                }
+                else {
+                    error = this->initiate(operation);
+                }
+
+                if (error) {
+                    tryNextServer = true;
+                }
+            }
+            else {
+                tryNextServer = true;
+            }
+        }
+        else if (response.error() == ntcdns::Error::e_REFUSED ||
+                 response.error() == ntcdns::Error::e_SERVER_FAILURE ||
+                 response.error() == ntcdns::Error::e_NOT_IMPLEMENTED)
+        {
+            tryNextServer = true;
+        }
+        else if (response.error() == ntcdns::Error::e_FORMAT_ERROR) {
+            operation->processError(ntsa::Error(ntsa::Error::e_INVALID));
+        }
+        else {
+            operation->processError(ntsa::Error(ntsa::Error::e_INVALID));
+        }
     }
 
-    streamSocketOptions.setTransport(ntsa::Transport::e_TCP_IPV4_STREAM);
+    if (tryNextServer) {
+        ClientNameServer::retry(operation);
+    }
+}
 
-    bsl::shared_ptr<ntci::StreamSocket> streamSocket =
-        d_streamSocketFactory_sp->createStreamSocket(streamSocketOptions,
-                                                     d_allocator_p);
+void ClientNameServer::processChannelClosed()
+{
+    bslmt::LockGuard<bslmt::Mutex> stateLock(&d_stateMutex);
 
-    error = streamSocket->registerSession(self);
-    if (error) {
-        return error;
+    bslmt::LockGuard<bslmt::Mutex> streamSocketLock(&d_streamSocketMutex);
+
+    if (d_state == e_STATE_STOPPING && this->privateIsClosed()) {
+        d_state = e_STATE_STOPPED;
+        d_stateCondition.signal();
+    }
+}
+
+bool ClientNameServer::privateIsClosed() const
+{
+    if (d_streamSocket_sp) {
+        return false;
+    }
+
+    for (ChannelVector::const_iterator it = d_channels.begin();
+         it != d_channels.end();
+         ++it)
+    {
+        if (!(*it)->isClosed()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void ClientNameServer::flushStream()
+{
+    ntsa::Error error;
+
+    bsl::shared_ptr<ntcdns::ClientOperation> operation;
+    while (d_streamOperationQueue.pop(&operation)) {
+        bsl::uint16_t transactionId = generateTransactionId();
+
+        if (!d_streamOperationMap.add(transactionId, operation)) {
+            ClientNameServer::retry(operation);
+            continue;
+        }
+
+        error = operation->sendRequest(d_streamSocket_sp,
+                                       d_endpoint,
+                                       transactionId);
+        if (error) {
+            d_streamOperationMap.remove(transactionId);
+            ClientNameServer::retry(operation);
+        }
     }
+}
 
-    error = streamSocket->open();
-    if (error) {
-        return error;
-    }
+ntsa::Error ClientNameServer::initiateStream(
+    const bsl::shared_ptr<ntcdns::ClientOperation>& operation)
+{
+    ntsa::Error error;
 
-    ntca::ConnectOptions connectOptions;
+    bslmt::LockGuard<bslmt::Mutex> streamSocketLock(&d_streamSocketMutex);
 
-    ntci::ConnectCallback connectCallback =
-        streamSocket->createConnectCallback(
-            bdlf::BindUtil::bind(
-                &ClientNameServer::processStreamSocketConnected,
-                self,
-                streamSocket,
-                bdlf::PlaceHolders::_1,
-                bdlf::PlaceHolders::_2),
-            d_allocator_p);
+    d_streamOperationQueue.push(operation);
 
-    error = streamSocket->connect(d_endpoint, connectOptions, connectCallback);
-    if (error) {
-        return error;
+    if (d_streamSocket_sp) {
+        this->flushStream();
+    }
+    else if (!d_streamSocketConnecting) {
+        error = this->createStreamSocket();
+        if (error) {
+            d_streamOperationQueue.remove(operation);
+            return error;
+        }
+
+        d_streamSocketConnecting = true;
     }
 
     return ntsa::Error();
 }
 
-void ClientNameServer::processDatagramSocketConnected(
-    const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
-    const bsl::shared_ptr<ntci::Connector>&      connector,
-    const ntca::ConnectEvent&                    event)
+void ClientNameServer::closeStream(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket)
 {
-    NTCCFG_WARNING_UNUSED(connector);
+    OperationVector operationVector(d_allocator_p);
 
-    ntsa::Error error;
+    {
+        bslmt::LockGuard<bslmt::Mutex> stateLock(&d_stateMutex);
 
-    bsl::shared_ptr<ClientNameServer> self = this->getSelf(this);
+        bslmt::LockGuard<bslmt::Mutex> streamSocketLock(
+            &d_streamSocketMutex);
 
-    if (event.context().error()) {
-        // MRM
-        return;
-    }
+        if (streamSocket != d_streamSocket_sp) {
+            return;
+        }
 
-    bslmt::LockGuard<bslmt::Mutex> datagramSocketLock(&d_datagramSocketMutex);
+        d_streamSocket_sp->registerSession(
+            bsl::shared_ptr<ntci::StreamSocketSession>());
+        d_streamSocket_sp.reset();
 
-    d_datagramSocket_sp = datagramSocket;
+        if (d_streamIdleTimer_sp) {
+            d_streamIdleTimer_sp->close();
+            d_streamIdleTimer_sp.reset();
+        }
 
-    error = d_datagramSocket_sp->relaxFlowControl(
-        ntca::FlowControlType::e_RECEIVE);
-    if (error) {
-        d_datagramSocket_sp->close();
-        d_datagramSocket_sp.reset();
-        return;
-    }
+        d_streamResponseSize = 0;
 
-    this->flush();
-}
+        {
+            OperationMap operationMap(d_allocator_p);
+            operationMap.swap(&d_streamOperationMap);
 
-void ClientNameServer::processStreamSocketConnected(
-    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
-    const bsl::shared_ptr<ntci::Connector>&    connector,
-    const ntca::ConnectEvent&                  event)
-{
-    NTCCFG_WARNING_UNUSED(connector);
+            operationMap.values(&operationVector);
+        }
 
-    ntsa::Error error;
+        {
+            OperationQueue operationQueue(d_allocator_p);
+            operationQueue.swap(&d_streamOperationQueue);
 
-    bsl::shared_ptr<ClientNameServer> self = this->getSelf(this);
+            operationQueue.load(&operationVector);
+        }
 
-    if (event.context().error()) {
-        // MRM
-        return;
+        if (this->privateIsClosed()) {
+            if (d_state == e_STATE_STOPPING) {
+                d_state = e_STATE_STOPPED;
+                d_stateCondition.signal();
+            }
+        }
     }
 
-    bslmt::LockGuard<bslmt::Mutex> streamSocketLock(&d_streamSocketMutex);
-
-    d_streamSocket_sp = streamSocket;
+    streamSocket->close();
 
-    error =
-        d_streamSocket_sp->relaxFlowControl(ntca::FlowControlType::e_RECEIVE);
-    if (error) {
-        d_streamSocket_sp->close();
-        d_streamSocket_sp.reset();
-        return;
+    for (OperationVector::iterator it = operationVector.begin();
+         it != operationVector.end();
+         ++it)
+    {
+        ClientNameServer::retry(*it);
     }
-
-    this->flush();
 }
 
-void ClientNameServer::flush()
+void ClientNameServer::retry(
+    const bsl::shared_ptr<ntcdns::ClientOperation>& operation)
 {
     ntsa::Error error;
 
-    bsl::shared_ptr<ntcdns::ClientOperation> operation;
-    while (d_operationQueue.pop(&operation)) {
-        bsl::uint16_t transactionId = generateTransactionId();
-
-        if (!d_operationMap.add(transactionId, operation)) {
-            return;  // MRM: transaction ID collision
-        }
-
-        error = operation->sendRequest(d_datagramSocket_sp,
-                                       d_endpoint,
-                                       transactionId);
-        if (error) {
-            d_operationMap.remove(transactionId);
-
-            while (true) {
-                bsl::shared_ptr<ntcdns::ClientNameServer> nameServer =
-                    operation->tryNextServer();
+    while (true) {
+        bsl::shared_ptr<ntcdns::ClientNameServer> nameServer =
+            operation->tryNextServer();
 
-                if (nameServer) {
-                    error = nameServer->initiate(operation);
-                    if (error) {
-                        continue;
-                    }
-                    else {
-                        break;
-                    }
-                }
-                else {
-                    operation->processError(ntsa::Error(ntsa::Error::e_EOF));
-                    break;
-                }
+        if (nameServer) {
+            error = nameServer->initiate(operation);
+            if (error) {
+                continue;
+            }
+            else {
+                break;
             }
         }
+        else {
+            operation->processError(ntsa::Error(ntsa::Error::e_EOF));
+            break;
+        }
     }
 }
 
@@ -1470,28 +2659,34 @@ ClientNameServer::ClientNameServer(
     const bsl::shared_ptr<ntci::StreamSocketFactory>&   streamSocketFactory,
     const ntsa::Endpoint&                               endpoint,
     bsl::size_t                                         index,
+    bsl::size_t                                         numChannels,
     const ntcdns::ClientConfig&                         configuration,
     bslma::Allocator*                                   basicAllocator)
 : d_object("ntcdns::ClientNameServer")
-, d_operationQueue(basicAllocator)
-, d_operationMap(basicAllocator)
-, d_datagramSocketMutex()
-, d_datagramSocket_sp()
+, d_channels(basicAllocator)
+, d_channelGeneration(0)
+, d_streamOperationQueue(basicAllocator)
+, d_streamOperationMap(basicAllocator)
 , d_datagramSocketFactory_sp(datagramSocketFactory)
 , d_streamSocketMutex()
 , d_streamSocket_sp()
 , d_streamSocketFactory_sp(streamSocketFactory)
+, d_streamSocketConnecting(false)
+, d_streamIdleTimer_sp()
+, d_streamResponseSize(0)
 , d_stateMutex()
 , d_stateCondition()
 , d_state(e_STATE_STOPPED)
 , d_endpoint(endpoint)
 , d_index(index)
+, d_numChannels(numChannels)
 , d_config(configuration, basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     BSLS_ASSERT_OPT(d_datagramSocketFactory_sp);
     BSLS_ASSERT_OPT(d_streamSocketFactory_sp);
     BSLS_ASSERT_OPT(!d_endpoint.isUndefined());
+    BSLS_ASSERT_OPT(d_numChannels > 0);
 }
 
 ClientNameServer::~ClientNameServer()
@@ -1519,6 +2714,23 @@ ntsa::Error ClientNameServer::start()
 
     NTCDNS_CLIENT_SERVER_LOG_STARTING(d_index, d_endpoint);
 
+    d_channels.clear();
+    d_channels.reserve(d_numChannels);
+
+    for (bsl::size_t channelIndex = 0; channelIndex < d_numChannels;
+         ++channelIndex)
+    {
+        bsl::shared_ptr<ntcdns::ClientDatagramChannel> channel;
+        channel.createInplace(d_allocator_p,
+                              self,
+                              d_datagramSocketFactory_sp,
+                              d_endpoint,
+                              channelIndex,
+                              d_allocator_p);
+
+        d_channels.push_back(channel);
+    }
+
     d_state = e_STATE_STARTED;
 
     return ntsa::Error();
@@ -1529,33 +2741,23 @@ ntsa::Error ClientNameServer::initiate(
 {
     ntsa::Error error;
 
-    bslmt::LockGuard<bslmt::Mutex> stateLock(&d_stateMutex);
-
-    if (d_state != e_STATE_STARTED) {
-        return ntsa::Error(ntsa::Error::e_INVALID);
-    }
-
-    bool flushFlag = false;
-
-    d_operationQueue.push(operation);
-
+    bsl::shared_ptr<ntcdns::ClientDatagramChannel> channel;
     {
-        bslmt::LockGuard<bslmt::Mutex> datagramSocketLock(
-            &d_datagramSocketMutex);
+        bslmt::LockGuard<bslmt::Mutex> stateLock(&d_stateMutex);
 
-        if (!d_datagramSocket_sp) {
-            error = this->createDatagramSocket();
-            if (error) {
-                return error;
-            }
-        }
-        else {
-            flushFlag = true;
+        if (d_state != e_STATE_STARTED) {
+            return ntsa::Error(ntsa::Error::e_INVALID);
         }
+
+        const bsl::size_t channelIndex =
+            d_channelGeneration.addRelaxed(1) % d_channels.size();
+
+        channel = d_channels[channelIndex];
     }
 
-    if (flushFlag) {
-        this->flush();
+    error = channel->initiate(operation);
+    if (error) {
+        return error;
     }
 
     return ntsa::Error();
@@ -1564,8 +2766,17 @@ ntsa::Error ClientNameServer::initiate(
 void ClientNameServer::cancel(
     const bsl::shared_ptr<ntcdns::ClientOperation>& operation)
 {
-    if (!d_operationMap.removeValue(operation)) {
-        d_operationQueue.remove(operation);
+    for (ChannelVector::iterator it = d_channels.begin();
+         it != d_channels.end();
+         ++it)
+    {
+        if ((*it)->remove(operation)) {
+            break;
+        }
+    }
+
+    if (!d_streamOperationMap.removeValue(operation)) {
+        d_streamOperationQueue.remove(operation);
     }
 
     operation->processError(ntsa::Error(ntsa::Error::e_CANCELLED));
@@ -1575,16 +2786,23 @@ void ClientNameServer::cancelAll()
 {
     OperationVector operationVector(d_allocator_p);
 
+    for (ChannelVector::iterator it = d_channels.begin();
+         it != d_channels.end();
+         ++it)
+    {
+        (*it)->removeAll(&operationVector);
+    }
+
     {
         OperationMap operationMap(d_allocator_p);
-        operationMap.swap(&d_operationMap);
+        operationMap.swap(&d_streamOperationMap);
 
         operationMap.values(&operationVector);
     }
 
     {
         OperationQueue operationQueue(d_allocator_p);
-        operationQueue.swap(&d_operationQueue);
+        operationQueue.swap(&d_streamOperationQueue);
 
         operationQueue.load(&operationVector);
     }
@@ -1601,15 +2819,33 @@ void ClientNameServer::cancelAll()
 void ClientNameServer::abandon(
     const bsl::shared_ptr<ntcdns::ClientOperation>& operation)
 {
-    if (!d_operationMap.removeValue(operation)) {
-        d_operationQueue.remove(operation);
+    for (ChannelVector::iterator it = d_channels.begin();
+         it != d_channels.end();
+         ++it)
+    {
+        if ((*it)->remove(operation)) {
+            break;
+        }
+    }
+
+    if (!d_streamOperationMap.removeValue(operation)) {
+        d_streamOperationQueue.remove(operation);
     }
 }
 
 void ClientNameServer::abandonAll()
 {
-    d_operationMap.clear();
-    d_operationQueue.clear();
+    OperationVector operationVector(d_allocator_p);
+
+    for (ChannelVector::iterator it = d_channels.begin();
+         it != d_channels.end();
+         ++it)
+    {
+        (*it)->removeAll(&operationVector);
+    }
+
+    d_streamOperationMap.clear();
+    d_streamOperationQueue.clear();
 }
 
 void ClientNameServer::shutdown()
@@ -1628,22 +2864,26 @@ void ClientNameServer::shutdown()
 
     this->cancelAll();
 
-    bslmt::LockGuard<bslmt::Mutex> datagramSocketLock(&d_datagramSocketMutex);
+    for (ChannelVector::iterator it = d_channels.begin();
+         it != d_channels.end();
+         ++it)
+    {
+        (*it)->close();
+    }
 
     bslmt::LockGuard<bslmt::Mutex> streamSocketLock(&d_streamSocketMutex);
 
-    if (!d_datagramSocket_sp && !d_streamSocket_sp) {
+    if (this->privateIsClosed()) {
         d_state = e_STATE_STOPPED;
         d_stateCondition.signal();
     }
     else {
-        if (d_datagramSocket_sp) {
-            d_datagramSocket_sp->shutdown(ntsa::ShutdownType::e_BOTH,
-                                          ntsa::ShutdownMode::e_IMMEDIATE);
-            d_datagramSocket_sp->close();
-        }
-
         if (d_streamSocket_sp) {
+            if (d_streamIdleTimer_sp) {
+                d_streamIdleTimer_sp->close();
+                d_streamIdleTimer_sp.reset();
+            }
+
             d_streamSocket_sp->shutdown(ntsa::ShutdownType::e_BOTH,
                                         ntsa::ShutdownMode::e_IMMEDIATE);
             d_streamSocket_sp->close();
@@ -1661,11 +2901,11 @@ void ClientNameServer::linger()
         d_stateCondition.wait(&d_stateMutex);
     }
 
-    d_operationMap.clear();
-    d_operationQueue.clear();
+    d_streamOperationMap.clear();
+    d_streamOperationQueue.clear();
 
-    d_datagramSocket_sp.reset();
     d_streamSocket_sp.reset();
+    d_streamIdleTimer_sp.reset();
 
     // MRM: d_datagramSocketFactory_sp.reset();
     // MRM: d_streamSocketFactory_sp.reset();
@@ -1732,6 +2972,7 @@ ntsa::Error Client::initialize()
                              d_streamSocketFactory_sp,
                              nameServerEndpoint,
                              nameServerIndex,
+                             d_numDatagramChannels,
                              d_config,
                              d_allocator_p);
 
@@ -1749,6 +2990,17 @@ ntsa::Error Client::initialize()
     return ntsa::Error();
 }
 
+void Client::retire(const bsl::string&                        key,
+                    const ntcdns::ClientGetIpAddressOperation* operation)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_operationMapMutex);
+
+    OperationMap::iterator it = d_operationMap.find(key);
+    if (it != d_operationMap.end() && it->second.get() == operation) {
+        d_operationMap.erase(it);
+    }
+}
+
 Client::Client(
     const ntcdns::ClientConfig&                         configuration,
     const bsl::shared_ptr<ntcdns::Cache>&               cache,
@@ -1761,8 +3013,11 @@ Client::Client(
 , d_streamSocketFactory_sp(streamSocketFactory)
 , d_cache_sp(cache)
 , d_serverList(basicAllocator)
+, d_operationMapMutex()
+, d_operationMap(basicAllocator)
 , d_state(e_STATE_STOPPED)
 , d_initialized(false)
+, d_numDatagramChannels(k_UDP_CHANNEL_COUNT)
 , d_config(configuration, basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
@@ -1808,6 +3063,19 @@ ntsa::Error Client::start()
     return ntsa::Error();
 }
 
+ntsa::Error Client::setDatagramChannelCount(bsl::size_t value)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (value == 0 || d_state != e_STATE_STOPPED || d_initialized) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    d_numDatagramChannels = value;
+
+    return ntsa::Error();
+}
+
 void Client::shutdown()
 {
     NTCI_LOG_CONTEXT();
@@ -1856,6 +3124,11 @@ void Client::linger()
     d_serverList.clear();
     d_initialized = false;
 
+    {
+        bslmt::LockGuard<bslmt::Mutex> operationMapLock(&d_operationMapMutex);
+        d_operationMap.clear();
+    }
+
     // MRM: d_datagramSocketFactory_sp.reset();
     // MRM: d_streamSocketFactory_sp.reset();
 
@@ -1893,6 +3166,33 @@ ntsa::Error Client::getIpAddress(
         return ntsa::Error(ntsa::Error::e_INVALID);
     }
 
+    // Requests for the same name whose options result in the same question
+    // sent over the same transport share the result of the operation
+    // in-flight, if any. Note that the IP address selector and the deadline
+    // are applied separately for each initiator.
+
+    bdlb::NullableValue<ntsa::IpAddressType::Value> ipAddressType;
+    error = ntcdns::Compat::convert(&ipAddressType, options);
+    if (error) {
+        return error;
+    }
+
+    bsl::string key(d_allocator_p);
+    formatOperationKey(&key, name, ipAddressType, options);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> operationMapLock(&d_operationMapMutex);
+
+        OperationMap::iterator it = d_operationMap.find(key);
+        if (it != d_operationMap.end()) {
+            if (it->second->subscribe(resolver, options, callback)) {
+                return ntsa::Error();
+            }
+
+            d_operationMap.erase(it);
+        }
+    }
+
     SearchList searchList;
 
     if (domainName.isAbsolute()) {
@@ -1924,15 +3224,16 @@ ntsa::Error Client::getIpAddress(
 
     bsl::shared_ptr<ntcdns::ClientGetIpAddressOperation> operation;
     operation.createInplace(d_allocator_p,
-                            resolver,
                             name,
                             d_serverList,
                             searchList,
                             options,
-                            callback,
                             d_cache_sp,
                             d_allocator_p);
 
+    operation->coalesce(this->getSelf(this), key);
+    operation->subscribe(resolver, options, callback);
+
     bsl::shared_ptr<ntcdns::ClientNameServer> server = d_serverList.front();
 
     error = server->initiate(operation);
@@ -1951,11 +3252,27 @@ ntsa::Error Client::getIpAddress(
                 }
             }
             else {
+                operation->abandon();
                 return ntsa::Error(ntsa::Error::e_EOF);
             }
         }
     }
 
+    // Publish the operation only once it has been initiated, so that no
+    // request subscribes to an operation that fails to initiate. If the
+    // operation has already completed it has already retired itself, so
+    // immediately remove it.
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> operationMapLock(&d_operationMapMutex);
+
+        d_operationMap[key] = operation;
+
+        if (!operation->isPending()) {
+            d_operationMap.erase(key);
+        }
+    }
+
     return ntsa::Error();
 }
 
@@ -2016,5 +3333,60 @@ ntsa::Error Client::getDomainName(
     return ntsa::Error();
 }
 
+ntsa::Error Client::getServerList(
+    const bsl::string&                                    name,
+    const ntca::GetServiceEndpointsOptions&               options,
+    const ntcdns::ClientGetServerListOperation::Callback& callback)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    ntsa::Error error;
+
+    if (!d_initialized) {
+        error = this->initialize();
+        if (error) {
+            return error;
+        }
+    }
+
+    if (d_serverList.empty()) {
+        return ntsa::Error(ntsa::Error::e_EOF);
+    }
+
+    bsl::shared_ptr<ntcdns::ClientGetServerListOperation> operation;
+    operation.createInplace(d_allocator_p,
+                            name,
+                            d_serverList,
+                            options,
+                            callback,
+                            d_cache_sp,
+                            d_allocator_p);
+
+    bsl::shared_ptr<ntcdns::ClientNameServer> server = d_serverList.front();
+
+    error = server->initiate(operation);
+    if (error) {
+        while (true) {
+            bsl::shared_ptr<ntcdns::ClientNameServer> nameServer =
+                operation->tryNextServer();
+
+            if (nameServer) {
+                error = nameServer->initiate(operation);
+                if (error) {
+                    continue;
+                }
+                else {
+                    break;
+                }
+            }
+            else {
+                return ntsa::Error(ntsa::Error::e_EOF);
+            }
+        }
+    }
+
+    return ntsa::Error();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -27,6 +27,8 @@
 #include <ntca_getdomainnameoptions.h>
 #include <ntca_getipaddresscontext.h>
 #include <ntca_getipaddressoptions.h>
+#include <ntca_getserviceendpointscontext.h>
+#include <ntca_getserviceendpointsoptions.h>
 #include <ntci_callback.h>
 #include <ntci_datagramsocket.h>
 #include <ntci_datagramsocketfactory.h>
@@ -35,6 +37,7 @@
 #include <ntci_interface.h>
 #include <ntci_streamsocket.h>
 #include <ntci_streamsocketfactory.h>
+#include <ntci_timer.h>
 #include <ntsa_error.h>
 #include <ntsf_system.h>
 #include <ntsi_resolver.h>
@@ -69,6 +72,9 @@ namespace ntcdns {
 class ClientNameServer;
 }
 namespace ntcdns {
+class ClientDatagramChannel;
+}
+namespace ntcdns {
 
 /// @internal @brief
 /// Provide an interface for any operation performed by the client.
@@ -104,10 +110,10 @@ class ClientOperation
     /// Invoke the response callback with the contents of the specified
     /// 'response' received from the specified 'endpoint' at the specified
     /// 'serverIndex'.
-    virtual void processResponse(const ntcdns::Message&    response,
-                                 const ntsa::Endpoint&     endpoint,
-                                 bsl::size_t               serverIndex,
-                                 const bsls::TimeInterval& now) = 0;
+    virtual void processResponse(const ntcdns::MessageView& response,
+                                 const ntsa::Endpoint&      endpoint,
+                                 bsl::size_t                serverIndex,
+                                 const bsls::TimeInterval&  now) = 0;
 
     /// Invoke the response callback with the specified 'error'.
     virtual void processError(const ntsa::Error& error) = 0;
@@ -143,16 +149,31 @@ class ClientGetIpAddressOperation
     typedef bsl::vector<bsl::shared_ptr<ntcdns::ClientNameServer> > ServerList;
 
   private:
+    /// Describe an initiator of a request that shares the result of this
+    /// operation, subject to its own deadline, if any.
+    struct Subscriber {
+        bsl::shared_ptr<ntci::Resolver> d_resolver_sp;
+        ntca::GetIpAddressOptions       d_options;
+        ntci::GetIpAddressCallback      d_callback;
+        bsl::shared_ptr<ntci::Timer>    d_timer_sp;
+        bsl::size_t                     d_id;
+    };
+
+    /// Define a type alias for a list of subscribers.
+    typedef bsl::vector<Subscriber> SubscriberList;
+
     ntccfg::Object                  d_object;
     mutable bslmt::Mutex            d_mutex;
-    bsl::shared_ptr<ntci::Resolver> d_resolver_sp;
     const bsl::string               d_name;
     ServerList                      d_serverList;
     bsl::size_t                     d_serverIndex;
     const SearchList                d_searchList;
     bsl::size_t                     d_searchIndex;
     const ntca::GetIpAddressOptions d_options;
-    ntci::GetIpAddressCallback      d_callback;
+    SubscriberList                  d_subscriberList;
+    bsl::size_t                     d_subscriberId;
+    bsl::weak_ptr<ntcdns::Client>   d_client_wp;
+    bsl::string                     d_key;
     bsl::shared_ptr<ntci::Timer>    d_timer_sp;
     bsl::shared_ptr<ntcdns::Cache>  d_cache_sp;
     bsls::AtomicBool                d_pending;
@@ -164,25 +185,67 @@ class ClientGetIpAddressOperation
     ClientGetIpAddressOperation& operator=(const ClientGetIpAddressOperation&)
         BSLS_KEYWORD_DELETED;
 
+  private:
+    /// Load into the specified 'result' the type of the question asked to
+    /// perform this operation. Return the error.
+    ntsa::Error createQuestionType(ntcdns::Type::Value* result) const;
+
+    /// Load into the specified 'result' the request to perform this
+    /// operation identified by the specified 'transactionId'. Return the
+    /// error.
+    ntsa::Error createRequest(ntcdns::Message* result,
+                              bsl::uint16_t    transactionId) const;
+
+    /// Encode to the specified 'encoder' the request to perform this
+    /// operation identified by the specified 'transactionId', without
+    /// building an intermediate message. Return the error.
+    ntsa::Error encodeRequest(ntcdns::MemoryEncoder* encoder,
+                              bsl::uint16_t          transactionId) const;
+
+    /// Invoke the callback of each subscriber whose deadline has not
+    /// elapsed with the specified 'ipAddressList' according to the
+    /// specified 'event', then retire this operation from its client. The
+    /// behavior is undefined unless this operation is no longer pending.
+    void complete(const bsl::vector<ntsa::IpAddress>& ipAddressList,
+                  const ntca::GetIpAddressEvent&      event);
+
+    /// Process the specified 'event' of the specified 'timer' that
+    /// implements the deadline of the subscriber identified by the
+    /// specified 'subscriberId'. Invoke the callback of that subscriber, if
+    /// it has not yet been notified, with an error, without affecting this
+    /// operation or any other subscriber.
+    void processDeadline(bsl::size_t                         subscriberId,
+                         const bsl::shared_ptr<ntci::Timer>& timer,
+                         const ntca::TimerEvent&             event);
+
+    /// Invoke the specified 'callback' of an initiator having the specified
+    /// 'resolver' and 'options' with the specified 'ipAddressList', reduced
+    /// to the IP address chosen by the IP address selector in the 'options'
+    /// if defined, according to the specified 'event'.
+    static void announce(const bsl::shared_ptr<ntci::Resolver>& resolver,
+                         const ntca::GetIpAddressOptions&       options,
+                         const ntci::GetIpAddressCallback&      callback,
+                         const bsl::vector<ntsa::IpAddress>&    ipAddressList,
+                         const ntca::GetIpAddressEvent&         event);
+
   public:
     /// Defines a type alias for a vector of endpoints.
     typedef bsl::vector<ntsa::Endpoint> EndpointList;
 
     /// Create a new get IP address operation to get the IP addresses
     /// assigned to the specified 'name' according to the specified
-    /// 'options' and invoke the specified 'callback' when the operation
-    /// completes or fails. Optionally specify a 'basicAllocator' used to
-    /// supply memory. If 'basicAllocator' is 0, the currently installed
-    /// default allocator is used.
+    /// 'options'. Each initiator, including the first, is notified when
+    /// the operation completes or fails by calling 'subscribe'. Optionally
+    /// specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
     ClientGetIpAddressOperation(
-        const bsl::shared_ptr<ntci::Resolver>& resolver,
-        const bsl::string&                     name,
-        const ServerList&                      serverList,
-        const SearchList&                      searchList,
-        const ntca::GetIpAddressOptions&       options,
-        const ntci::GetIpAddressCallback&      callback,
-        const bsl::shared_ptr<ntcdns::Cache>&  cache,
-        bslma::Allocator*                      basicAllocator = 0);
+        const bsl::string&                    name,
+        const ServerList&                     serverList,
+        const SearchList&                     searchList,
+        const ntca::GetIpAddressOptions&      options,
+        const bsl::shared_ptr<ntcdns::Cache>& cache,
+        bslma::Allocator*                     basicAllocator = 0);
 
     /// Destroy this object.
     ~ClientGetIpAddressOperation() BSLS_KEYWORD_OVERRIDE;
@@ -208,10 +271,11 @@ class ClientGetIpAddressOperation
     /// Invoke the response callback with the contents of the specified
     /// 'response' received from the specified 'endpoint' at the specified
     /// 'serverIndex'.
-    void processResponse(const ntcdns::Message&    response,
-                         const ntsa::Endpoint&     endpoint,
-                         bsl::size_t               serverIndex,
-                         const bsls::TimeInterval& now) BSLS_KEYWORD_OVERRIDE;
+    void processResponse(const ntcdns::MessageView& response,
+                         const ntsa::Endpoint&      endpoint,
+                         bsl::size_t                serverIndex,
+                         const bsls::TimeInterval&  now)
+        BSLS_KEYWORD_OVERRIDE;
 
     /// Invoke the response callback with the specified 'error'.
     void processError(const ntsa::Error& error) BSLS_KEYWORD_OVERRIDE;
@@ -225,6 +289,30 @@ class ClientGetIpAddressOperation
     /// Return true if such a name exists, and false otherwise.
     bool tryNextSearch() BSLS_KEYWORD_OVERRIDE;
 
+    /// Register this operation as the operation in-flight for the specified
+    /// 'key' in the specified 'client', from which this operation retires
+    /// itself when it completes.
+    void coalesce(const bsl::shared_ptr<ntcdns::Client>& client,
+                  const bsl::string&                     key);
+
+    /// Share the result of this operation with an initiator of a request
+    /// having the specified 'resolver' and 'options' by invoking the
+    /// specified 'callback' when this operation completes or fails, or
+    /// with an error when the deadline in the 'options', if any, elapses
+    /// first. Return true if this operation is still pending and the
+    /// 'callback' will be invoked, otherwise return false.
+    bool subscribe(const bsl::shared_ptr<ntci::Resolver>& resolver,
+                   const ntca::GetIpAddressOptions&       options,
+                   const ntci::GetIpAddressCallback&      callback);
+
+    /// Abandon this operation after it fails to initiate, without invoking
+    /// the callback of any subscriber.
+    void abandon();
+
+    /// Return true if this operation is still pending, otherwise return
+    /// false.
+    bool isPending() const;
+
     /// Return the name to resolve.
     const bsl::string& name() const;
 
@@ -275,6 +363,13 @@ class ClientGetDomainNameOperation
     ClientGetDomainNameOperation& operator=(
         const ClientGetDomainNameOperation&) BSLS_KEYWORD_DELETED;
 
+  private:
+    /// Load into the specified 'result' the request to perform this
+    /// operation identified by the specified 'transactionId'. Return the
+    /// error.
+    ntsa::Error createRequest(ntcdns::Message* result,
+                              bsl::uint16_t    transactionId) const;
+
   public:
     /// Defines a type alias for a vector of endpoints.
     typedef bsl::vector<ntsa::Endpoint> EndpointList;
@@ -318,10 +413,11 @@ class ClientGetDomainNameOperation
     /// Invoke the response callback with the contents of the specified
     /// 'response' received from the specified 'endpoint' at the specified
     /// 'serverIndex'.
-    void processResponse(const ntcdns::Message&    response,
-                         const ntsa::Endpoint&     endpoint,
-                         bsl::size_t               serverIndex,
-                         const bsls::TimeInterval& now) BSLS_KEYWORD_OVERRIDE;
+    void processResponse(const ntcdns::MessageView& response,
+                         const ntsa::Endpoint&      endpoint,
+                         bsl::size_t                serverIndex,
+                         const bsls::TimeInterval&  now)
+        BSLS_KEYWORD_OVERRIDE;
 
     /// Invoke the response callback with the specified 'error'.
     void processError(const ntsa::Error& error) BSLS_KEYWORD_OVERRIDE;
@@ -349,15 +445,153 @@ class ClientGetDomainNameOperation
 };
 
 /// @internal @brief
-/// Provide a name server to which to a client sends requests.
+/// Provide a mechanism to perform an operation to get the SRV records of a
+/// service name.
+///
+/// @details
+/// The IP addresses of the targets of the SRV records that are included in
+/// the additional section of the response are inserted into the cache, so
+/// that the subsequent resolution of the targets is typically satisfied by
+/// the cache.
 ///
 /// @par Thread Safety
 /// This class is thread safe.
 ///
 /// @ingroup module_ntcdns
-class ClientNameServer : public ntci::DatagramSocketSession,
-                         public ntci::StreamSocketSession,
-                         public ntccfg::Shared<ClientNameServer>
+class ClientGetServerListOperation
+: public ClientOperation,
+  public ntccfg::Shared<ClientGetServerListOperation>
+{
+  public:
+    /// Define a type alias for a list of name servers to
+    /// try when performing the operation.
+    typedef bsl::vector<bsl::shared_ptr<ntcdns::ClientNameServer> > ServerList;
+
+    /// Define a type alias for a list of SRV records.
+    typedef bsl::vector<ntcdns::ResourceRecordDataSvr> RecordList;
+
+    /// Define a type alias for a function invoked with the SRV records of
+    /// a service name, in the order they were received, and the context of
+    /// the operation when the operation completes or fails.
+    typedef bsl::function<void(
+        const RecordList&                       recordList,
+        const ntca::GetServiceEndpointsContext& context)>
+        Callback;
+
+  private:
+    ntccfg::Object                         d_object;
+    mutable bslmt::Mutex                   d_mutex;
+    const bsl::string                      d_name;
+    ServerList                             d_serverList;
+    bsl::size_t                            d_serverIndex;
+    const ntca::GetServiceEndpointsOptions d_options;
+    Callback                               d_callback;
+    bsl::shared_ptr<ntci::Timer>           d_timer_sp;
+    bsl::shared_ptr<ntcdns::Cache>         d_cache_sp;
+    bsls::AtomicBool                       d_pending;
+    bslma::Allocator*                      d_allocator_p;
+
+  private:
+    ClientGetServerListOperation(ClientGetServerListOperation&)
+        BSLS_KEYWORD_DELETED;
+    ClientGetServerListOperation& operator=(
+        const ClientGetServerListOperation&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Load into the specified 'result' the request to perform this
+    /// operation identified by the specified 'transactionId'. Return the
+    /// error.
+    ntsa::Error createRequest(ntcdns::Message* result,
+                              bsl::uint16_t    transactionId) const;
+
+  public:
+    /// Create a new get server list operation to get the SRV records of the
+    /// specified service 'name' according to the specified 'options' and
+    /// invoke the specified 'callback' when the operation completes or
+    /// fails. Optionally specify a 'basicAllocator' used to supply memory.
+    /// If 'basicAllocator' is 0, the currently installed default allocator
+    /// is used.
+    ClientGetServerListOperation(
+        const bsl::string&                      name,
+        const ServerList&                       serverList,
+        const ntca::GetServiceEndpointsOptions& options,
+        const Callback&                         callback,
+        const bsl::shared_ptr<ntcdns::Cache>&   cache,
+        bslma::Allocator*                       basicAllocator = 0);
+
+    /// Destroy this object.
+    ~ClientGetServerListOperation() BSLS_KEYWORD_OVERRIDE;
+
+    /// Send a request to perform this operation through the specified
+    /// 'datagramSocket' to the name server at the specified 'endpoint'.
+    /// Identify the request using the specified 'transactionId'. Return the
+    /// error.
+    ntsa::Error sendRequest(
+        const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
+        const ntsa::Endpoint&                        endpoint,
+        bsl::uint16_t transactionId) BSLS_KEYWORD_OVERRIDE;
+
+    /// Send a request to perform this operation through the specified
+    /// 'streamSocket' to the name server at the specified 'endpoint'.
+    /// Identify the request using the specified 'transactionId'. Return the
+    /// error.
+    ntsa::Error sendRequest(
+        const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+        const ntsa::Endpoint&                      endpoint,
+        bsl::uint16_t transactionId) BSLS_KEYWORD_OVERRIDE;
+
+    /// Invoke the response callback with the contents of the specified
+    /// 'response' received from the specified 'endpoint' at the specified
+    /// 'serverIndex'.
+    void processResponse(const ntcdns::MessageView& response,
+                         const ntsa::Endpoint&      endpoint,
+                         bsl::size_t                serverIndex,
+                         const bsls::TimeInterval&  now)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Invoke the response callback with the specified 'error'.
+    void processError(const ntsa::Error& error) BSLS_KEYWORD_OVERRIDE;
+
+    /// Prepare the operation to target the next name server and return that
+    /// name server, or null if all name servers have been tried.
+    bsl::shared_ptr<ntcdns::ClientNameServer> tryNextServer()
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Prepare the operation to target the next name in the search list.
+    /// Return true if such a name exists, and false otherwise.
+    bool tryNextSearch() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the service name to resolve.
+    const bsl::string& name() const;
+
+    /// The options that control the behavior of the operation.
+    const ntca::GetServiceEndpointsOptions& options() const;
+
+    /// Return the index of the current name server being tried.
+    bsl::size_t serverIndex() const;
+};
+
+/// @internal @brief
+/// Provide a connected datagram socket through which requests are sent to a
+/// name server.
+///
+/// @details
+/// Each name server sends its requests over UDP through a pool of channels.
+/// Each channel opens its own datagram socket, bound to a randomly chosen
+/// source port, and connects it to the name server, so that the kernel
+/// delivers each response only to the socket through which its request was
+/// sent and discards datagrams from any other source. The requests
+/// outstanding on each channel are tracked by that channel alone, so
+/// requests distributed across the pool do not contend for the same locks,
+/// and a response is matched only against the requests sent through the
+/// socket on which it arrived.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntcdns
+class ClientDatagramChannel : public ntci::DatagramSocketSession,
+                              public ntccfg::Shared<ClientDatagramChannel>
 {
     /// This typedef defines a vector of operations.
     typedef bsl::vector<bsl::shared_ptr<ntcdns::ClientOperation> >
@@ -372,34 +606,23 @@ class ClientNameServer : public ntci::DatagramSocketSession,
                         bsl::shared_ptr<ntcdns::ClientOperation> >
         OperationMap;
 
-    enum State {
-        // This enumeration enumerates the states of operation.
-
-        e_STATE_STARTED,
-        e_STATE_STOPPING,
-        e_STATE_STOPPED
-    };
-
     ntccfg::Object                               d_object;
     OperationQueue                               d_operationQueue;
     OperationMap                                 d_operationMap;
-    bslmt::Mutex                                 d_datagramSocketMutex;
+    mutable bslmt::Mutex                         d_mutex;
     bsl::shared_ptr<ntci::DatagramSocket>        d_datagramSocket_sp;
     bsl::shared_ptr<ntci::DatagramSocketFactory> d_datagramSocketFactory_sp;
-    bslmt::Mutex                                 d_streamSocketMutex;
-    bsl::shared_ptr<ntci::StreamSocket>          d_streamSocket_sp;
-    bsl::shared_ptr<ntci::StreamSocketFactory>   d_streamSocketFactory_sp;
-    bslmt::Mutex                                 d_stateMutex;
-    bslmt::Condition                             d_stateCondition;
-    State                                        d_state;
+    bool                                         d_connecting;
+    bool                                         d_closed;
+    bsl::weak_ptr<ntcdns::ClientNameServer>      d_nameServer_wp;
     const ntsa::Endpoint                         d_endpoint;
     const bsl::size_t                            d_index;
-    const ntcdns::ClientConfig                   d_config;
     bslma::Allocator*                            d_allocator_p;
 
   private:
-    ClientNameServer(ClientNameServer&) BSLS_KEYWORD_DELETED;
-    ClientNameServer& operator=(const ClientNameServer&) BSLS_KEYWORD_DELETED;
+    ClientDatagramChannel(const ClientDatagramChannel&) BSLS_KEYWORD_DELETED;
+    ClientDatagramChannel& operator=(const ClientDatagramChannel&)
+        BSLS_KEYWORD_DELETED;
 
   private:
     /// Process the condition that the size of the read queue is greater
@@ -408,57 +631,151 @@ class ClientNameServer : public ntci::DatagramSocketSession,
         const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
         const ntca::ReadQueueEvent& event) BSLS_KEYWORD_OVERRIDE;
 
-    /// Process the condition that the size of the read queue is greater
-    /// than the read queue high watermark.
-    void processReadQueueHighWatermark(
-        const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
-        const ntca::ReadQueueEvent& event) BSLS_KEYWORD_OVERRIDE;
-
     /// Process the condition that the size of the write queue has been
     /// drained down to less than or equal to the write queue low watermark.
-    /// This condition will not occur until the write queue high watermark
-    /// condition occurs. The write queue low watermark conditions and the
-    /// high watermark conditions are guaranteed to occur serially.
     void processWriteQueueLowWatermark(
         const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
         const ntca::WriteQueueEvent& event) BSLS_KEYWORD_OVERRIDE;
 
-    /// Process the condition that the size of the write queue is greater
-    /// than the write queue high watermark. This condition will occur the
-    /// first time the write queue high watermark has been reached but
-    /// then will not subsequently ooccur until the write queue low
-    /// watermark. The write queue low watermark conditions and the
-    /// high watermark conditions are guaranteed to occur serially.
-    void processWriteQueueHighWatermark(
-        const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
-        const ntca::WriteQueueEvent& event) BSLS_KEYWORD_OVERRIDE;
-
-    /// Process the initiation of the shutdown sequence from the specified
-    /// 'origin'.
-    void processShutdownInitiated(
+    /// Process the completion of the shutdown sequence.
+    void processShutdownComplete(
         const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
         const ntca::ShutdownEvent& event) BSLS_KEYWORD_OVERRIDE;
 
-    /// Process the socket being shut down for reading.
-    void processShutdownReceive(
+    /// Process the connection of the specified 'datagramSocket' according
+    /// to the specified 'event'.
+    void processConnected(
         const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
-        const ntca::ShutdownEvent& event) BSLS_KEYWORD_OVERRIDE;
+        const bsl::shared_ptr<ntci::Connector>&      connector,
+        const ntca::ConnectEvent&                    event);
 
-    /// Process the socket being shut down for writing.
-    void processShutdownSend(
-        const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
-        const ntca::ShutdownEvent& event) BSLS_KEYWORD_OVERRIDE;
+    /// Create, open, and begin connecting the datagram socket. Return the
+    /// error. The behavior is undefined unless 'd_mutex' is locked.
+    ntsa::Error privateOpen();
 
-    /// Process the completion of the shutdown sequence.
-    void processShutdownComplete(
-        const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
-        const ntca::ShutdownEvent& event) BSLS_KEYWORD_OVERRIDE;
+    /// Send each queued operation. The behavior is undefined unless
+    /// 'd_mutex' is locked and the datagram socket is connected.
+    void privateFlush();
 
-    /// Process an error.
-    void processError(
-        const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
-        const ntca::ErrorEvent& event) BSLS_KEYWORD_OVERRIDE;
+  public:
+    /// Create a new channel at the specified 'index' in the pool of the
+    /// specified 'nameServer', which sends requests to the specified
+    /// 'endpoint' through a datagram socket created by the specified
+    /// 'datagramSocketFactory'. Optionally specify a 'basicAllocator' used
+    /// to supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    ClientDatagramChannel(
+        const bsl::shared_ptr<ntcdns::ClientNameServer>& nameServer,
+        const bsl::shared_ptr<ntci::DatagramSocketFactory>&
+                              datagramSocketFactory,
+        const ntsa::Endpoint& endpoint,
+        bsl::size_t           index,
+        bslma::Allocator*     basicAllocator = 0);
+
+    /// Destroy this object.
+    ~ClientDatagramChannel() BSLS_KEYWORD_OVERRIDE;
+
+    /// Send the specified 'operation' through this channel, opening and
+    /// connecting the datagram socket if necessary. Return the error.
+    ntsa::Error initiate(
+        const bsl::shared_ptr<ntcdns::ClientOperation>& operation);
+
+    /// Remove the specified 'operation' if it is queued or outstanding on
+    /// this channel. Return true if the operation was removed, and false
+    /// otherwise.
+    bool remove(const bsl::shared_ptr<ntcdns::ClientOperation>& operation);
+
+    /// Remove every operation queued or outstanding on this channel and
+    /// append them to the specified 'result'.
+    void removeAll(
+        bsl::vector<bsl::shared_ptr<ntcdns::ClientOperation> >* result);
+
+    /// Shut down and close the datagram socket, if any, and reject any
+    /// operation subsequently initiated. The closure of the datagram socket
+    /// completes asynchronously.
+    void close();
+
+    /// Return true if the datagram socket is closed, otherwise return false.
+    bool isClosed() const;
+
+    /// Return the index of this channel in the pool of its name server.
+    bsl::size_t index() const;
+};
+
+/// @internal @brief
+/// Provide a name server to which to a client sends requests.
+///
+/// @details
+/// Requests are sent to the name server over UDP, distributed in round-robin
+/// order across a pool of channels, each of which sends its requests through
+/// its own connected datagram socket bound to a random source port. When a
+/// response received over UDP is truncated, the request is sent again over
+/// a TCP connection to the same name server. The TCP connection is
+/// established on demand and persists while requests sent over it are
+/// outstanding: each request sent over the connection is pipelined behind
+/// any other outstanding request, and responses are matched to requests by
+/// their transaction ID, in any order. The connection is closed once it has
+/// been idle for a period of time. Requests outstanding when the connection
+/// is lost are retried on the next name server.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntcdns
+class ClientNameServer : public ntci::StreamSocketSession,
+                         public ntccfg::Shared<ClientNameServer>
+{
+    /// This typedef defines a vector of datagram channels.
+    typedef bsl::vector<bsl::shared_ptr<ntcdns::ClientDatagramChannel> >
+        ChannelVector;
 
+    /// This typedef defines a vector of operations.
+    typedef bsl::vector<bsl::shared_ptr<ntcdns::ClientOperation> >
+        OperationVector;
+
+    /// This typedef defines a queue of operations.
+    typedef ntcdns::Queue<bsl::shared_ptr<ntcdns::ClientOperation> >
+        OperationQueue;
+
+    /// This typedef defines a map of transaction IDs to operations.
+    typedef ntcdns::Map<bsl::uint16_t,
+                        bsl::shared_ptr<ntcdns::ClientOperation> >
+        OperationMap;
+
+    enum State {
+        // This enumeration enumerates the states of operation.
+
+        e_STATE_STARTED,
+        e_STATE_STOPPING,
+        e_STATE_STOPPED
+    };
+
+    ntccfg::Object                               d_object;
+    ChannelVector                                d_channels;
+    bsls::AtomicUint                             d_channelGeneration;
+    OperationQueue                               d_streamOperationQueue;
+    OperationMap                                 d_streamOperationMap;
+    bsl::shared_ptr<ntci::DatagramSocketFactory> d_datagramSocketFactory_sp;
+    bslmt::Mutex                                 d_streamSocketMutex;
+    bsl::shared_ptr<ntci::StreamSocket>          d_streamSocket_sp;
+    bsl::shared_ptr<ntci::StreamSocketFactory>   d_streamSocketFactory_sp;
+    bool                                         d_streamSocketConnecting;
+    bsl::shared_ptr<ntci::Timer>                 d_streamIdleTimer_sp;
+    bsl::size_t                                  d_streamResponseSize;
+    bslmt::Mutex                                 d_stateMutex;
+    bslmt::Condition                             d_stateCondition;
+    State                                        d_state;
+    const ntsa::Endpoint                         d_endpoint;
+    const bsl::size_t                            d_index;
+    const bsl::size_t                            d_numChannels;
+    const ntcdns::ClientConfig                   d_config;
+    bslma::Allocator*                            d_allocator_p;
+
+  private:
+    ClientNameServer(ClientNameServer&) BSLS_KEYWORD_DELETED;
+    ClientNameServer& operator=(const ClientNameServer&) BSLS_KEYWORD_DELETED;
+
+  private:
     /// Process the condition that the size of the read queue is greater
     /// than or equal to the read queue low watermark.
     void processReadQueueLowWatermark(
@@ -515,19 +832,9 @@ class ClientNameServer : public ntci::DatagramSocketSession,
     void processError(const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
                       const ntca::ErrorEvent& event) BSLS_KEYWORD_OVERRIDE;
 
-    /// Create the internal datagram socket.
-    ntsa::Error createDatagramSocket();
-
     /// Create the internal stream socket.
     ntsa::Error createStreamSocket();
 
-    /// Process the connection of the specified 'datagramSocket' according
-    /// to the specified 'event'.
-    void processDatagramSocketConnected(
-        const bsl::shared_ptr<ntci::DatagramSocket>& datagramSocket,
-        const bsl::shared_ptr<ntci::Connector>&      connector,
-        const ntca::ConnectEvent&                    event);
-
     /// Process the connection of the specified 'streamSocket' according to
     /// the specified 'event'.
     void processStreamSocketConnected(
@@ -535,21 +842,67 @@ class ClientNameServer : public ntci::DatagramSocketSession,
         const bsl::shared_ptr<ntci::Connector>&    connector,
         const ntca::ConnectEvent&                  event);
 
-    /// Flush queued operations.
-    void flush();
+    /// Process the expiration of the specified 'timer' that closes the
+    /// specified idle 'streamSocket' according to the specified 'event'.
+    void processStreamSocketIdle(
+        const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+        const bsl::shared_ptr<ntci::Timer>&        timer,
+        const ntca::TimerEvent&                    event);
+
+    /// Process the specified 'response' to the specified 'operation'
+    /// received from the name server at the specified 'now' over the stream
+    /// socket, if the specified 'stream' flag is true, or over a datagram
+    /// socket, otherwise.
+    void processResponse(
+        const bsl::shared_ptr<ntcdns::ClientOperation>& operation,
+        const ntcdns::MessageView&                      response,
+        const bsls::TimeInterval&                       now,
+        bool                                            stream);
+
+    /// Process the closure of the datagram socket of a channel.
+    void processChannelClosed();
+
+    /// Return true if the stream socket and the datagram socket of each
+    /// channel are closed, otherwise return false. The behavior is undefined
+    /// unless 'd_streamSocketMutex' is locked.
+    bool privateIsClosed() const;
+
+    /// Flush operations queued to be sent over the stream socket. The
+    /// behavior is undefined unless 'd_streamSocketMutex' is locked.
+    void flushStream();
+
+    /// Enqueue the specified 'operation' to be sent over the stream socket,
+    /// connecting the stream socket if necessary. Return the error.
+    ntsa::Error initiateStream(
+        const bsl::shared_ptr<ntcdns::ClientOperation>& operation);
+
+    /// Close the specified 'streamSocket', if it is the current stream
+    /// socket, and retry each operation sent or queued to be sent over it
+    /// on the next name server.
+    void closeStream(const bsl::shared_ptr<ntci::StreamSocket>& streamSocket);
+
+    /// Retry the specified 'operation' on the next name server, or fail
+    /// the operation if all name servers have been tried.
+    static void retry(
+        const bsl::shared_ptr<ntcdns::ClientOperation>& operation);
+
+    friend class ClientDatagramChannel;
 
   public:
     /// Create a new client name server for a client having the specified
     /// 'configuration' representing a name server at the specified 'index'
     /// in that configuration that sends requests to the specified
     /// 'endpoint' using sockets created by the specified
-    /// 'datagramSocketFactory' and 'streamSocketFactory'.
+    /// 'datagramSocketFactory' and 'streamSocketFactory', distributing
+    /// requests sent over UDP across a pool of the specified 'numChannels'
+    /// channels. The behavior is undefined unless 'numChannels > 0'.
     explicit ClientNameServer(
         const bsl::shared_ptr<ntci::DatagramSocketFactory>&
             datagramSocketFactory,
         const bsl::shared_ptr<ntci::StreamSocketFactory>& streamSocketFactory,
         const ntsa::Endpoint&                             endpoint,
         bsl::size_t                                       index,
+        bsl::size_t                                       numChannels,
         const ntcdns::ClientConfig&                       configuration,
         bslma::Allocator*                                 basicAllocator = 0);
 
@@ -591,6 +944,15 @@ class ClientNameServer : public ntci::DatagramSocketSession,
 /// @internal @brief
 /// Provide a DNS client.
 ///
+/// @details
+/// Concurrent requests to get the IP addresses assigned to the same name
+/// with options that result in the same question over the same transport
+/// are coalesced: while a request is in-flight, each identical request
+/// subscribes to its result rather than sending another query to the name
+/// servers, so that a burst of identical requests results in only one
+/// query. The deadline of each request is applied to that request alone,
+/// so no request is bound by the deadline of another.
+///
 /// @par Thread Safety
 /// This class is thread safe.
 ///
@@ -605,6 +967,14 @@ class Client : public ntccfg::Shared<Client>
     /// try when performing the operation.
     typedef bsl::vector<bsl::shared_ptr<ntcdns::ClientNameServer> > ServerList;
 
+    /// Define a type alias for a map of the keys of requests to get the IP
+    /// addresses assigned to a name to the operation in-flight for those
+    /// requests.
+    typedef bsl::unordered_map<
+        bsl::string,
+        bsl::shared_ptr<ntcdns::ClientGetIpAddressOperation> >
+        OperationMap;
+
     enum State {
         // This enumeraiton enumerates the states of operation.
 
@@ -619,8 +989,11 @@ class Client : public ntccfg::Shared<Client>
     bsl::shared_ptr<ntci::StreamSocketFactory>   d_streamSocketFactory_sp;
     bsl::shared_ptr<ntcdns::Cache>               d_cache_sp;
     ServerList                                   d_serverList;
+    bslmt::Mutex                                 d_operationMapMutex;
+    OperationMap                                 d_operationMap;
     State                                        d_state;
     bool                                         d_initialized;
+    bsl::size_t                                  d_numDatagramChannels;
     ntcdns::ClientConfig                         d_config;
     bslma::Allocator*                            d_allocator_p;
 
@@ -632,6 +1005,13 @@ class Client : public ntccfg::Shared<Client>
     /// Initialize the mechanisms used by this object, if necessary.
     ntsa::Error initialize();
 
+    /// Remove the specified 'operation' as the operation in-flight for the
+    /// specified 'key', if it is still registered for that 'key'.
+    void retire(const bsl::string&                        key,
+                const ntcdns::ClientGetIpAddressOperation* operation);
+
+    friend class ClientGetIpAddressOperation;
+
   public:
     /// Create a new client having the specified 'configuration'. Optionally
     /// specify a 'basicAllocator' used to supply memory. If
@@ -651,6 +1031,13 @@ class Client : public ntccfg::Shared<Client>
     /// Start the client. Return the error.
     ntsa::Error start();
 
+    /// Set the number of channels, each with its own datagram socket,
+    /// across which requests sent over UDP to each name server are
+    /// distributed to the specified 'value'. Return the error, notably
+    /// 'ntsa::Error::e_INVALID' if 'value' is zero or the client has
+    /// already been started.
+    ntsa::Error setDatagramChannelCount(bsl::size_t value);
+
     /// Begin stopping the client.
     void shutdown();
 
@@ -672,6 +1059,14 @@ class Client : public ntccfg::Shared<Client>
                               const ntsa::IpAddress&                 ipAddress,
                               const ntca::GetDomainNameOptions&      options,
                               const ntci::GetDomainNameCallback&     callback);
+
+    /// Get the SRV records of the specified service 'name' and invoke the
+    /// specified 'callback' when resolution completes or an error occurs.
+    /// Return the error.
+    ntsa::Error getServerList(
+        const bsl::string&                                    name,
+        const ntca::GetServiceEndpointsOptions&               options,
+        const ntcdns::ClientGetServerListOperation::Callback& callback);
 };
 
 }  // close package namespace
@@ -15,17 +15,41 @@
 
 #include <ntcdns_client.h>
 
+#include <ntca_timercontext.h>
+#include <ntca_timerevent.h>
+#include <ntca_timeroptions.h>
 #include <ntccfg_test.h>
 #include <ntcdns_cache.h>
 #include <ntcdns_database.h>
+#include <ntcdns_protocol.h>
 #include <ntcdns_utility.h>
+#include <ntci_datagramsocket.h>
+#include <ntci_datagramsocketfactory.h>
+#include <ntci_datagramsocketsession.h>
 #include <ntci_log.h>
+#include <ntci_resolver.h>
+#include <ntci_streamsocket.h>
+#include <ntci_streamsocketfactory.h>
+#include <ntci_streamsocketsession.h>
+#include <ntci_timer.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+#include <bdlt_currenttime.h>
 #include <bslma_allocator.h>
 #include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
 #include <bslmt_semaphore.h>
 #include <bsls_assert.h>
+#include <bsl_deque.h>
 #include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 
@@ -34,12 +58,21 @@ using namespace BloombergLP;
 //-----------------------------------------------------------------------------
 //                                 Overview
 //                                 --------
-//
+// The client is tested against a stub name server that implements the
+// datagram and stream socket factories through which the client creates its
+// sockets. The sockets announce their events only when the test drains the
+// name server, so each test controls exactly when queries are answered.
 //-----------------------------------------------------------------------------
 
 // [ 1]
+// [ 2] Concurrent identical requests result in one query
+// [ 3] Truncated responses are retried over a reused stream socket
+// [ 4] Requests are distributed across the datagram socket pool
 //-----------------------------------------------------------------------------
 // [ 1]
+// [ 2]
+// [ 3]
+// [ 4]
 //-----------------------------------------------------------------------------
 
 // MRM: This test implementation is disable because of the difficulty
@@ -151,22 +184,3466 @@ NTCCFG_TEST_CASE(1)
 #endif
 }
 
-NTCCFG_TEST_DRIVER
+#else
+
+NTCCFG_TEST_CASE(1)
 {
-    NTCCFG_TEST_REGISTER(1);
 }
-NTCCFG_TEST_DRIVER_END;
 
-#else
+#endif
 
-NTCCFG_TEST_CASE(1)
+namespace test {
+
+class NameServer;
+
+/// This class mocks the ntci::DatagramSocket interface: each datagram sent
+/// through the socket is delivered to a stub name server, and each response
+/// of the name server is enqueued to the read queue of the socket.
+class DatagramSocket : public ntci::DatagramSocket,
+                       public ntccfg::Shared<DatagramSocket>
+{
+    mutable bslmt::Mutex                         d_mutex;
+    test::NameServer*                            d_nameServer_p;
+    ntsa::Handle                                 d_handle;
+    ntsa::Endpoint                               d_remoteEndpoint;
+    bsl::shared_ptr<ntci::DatagramSocketSession> d_session_sp;
+    bsl::deque<bsl::shared_ptr<bdlbb::Blob> >    d_readQueue;
+    bsl::shared_ptr<bdlbb::BlobBufferFactory>    d_blobBufferFactory_sp;
+    bsl::shared_ptr<ntci::Strand>                d_strand_sp;
+    bool                                         d_closed;
+    bslma::Allocator*                            d_allocator_p;
+
+  private:
+    DatagramSocket(const DatagramSocket&) BSLS_KEYWORD_DELETED;
+    DatagramSocket& operator=(const DatagramSocket&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new datagram socket identified by the specified 'handle'
+    /// whose datagrams are delivered to the specified 'nameServer'.
+    /// Optionally specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    DatagramSocket(test::NameServer* nameServer,
+                   ntsa::Handle      handle,
+                   bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~DatagramSocket() BSLS_KEYWORD_OVERRIDE;
+
+    /// Enqueue the specified 'response' to the read queue and announce the
+    /// read queue low watermark to the session.
+    void deliver(const bdlbb::Blob& response);
+
+    /// Announce the completion of the shutdown sequence to the session.
+    void complete();
+
+    /// Open the socket. Return the error.
+    ntsa::Error open() BSLS_KEYWORD_OVERRIDE;
+
+    /// Connect to the specified 'endpoint' and invoke the specified
+    /// 'callback' when the name server is next drained. Return the error.
+    ntsa::Error connect(const ntsa::Endpoint&        endpoint,
+                        const ntca::ConnectOptions&  options,
+                        const ntci::ConnectCallback& callback)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Deliver the specified 'data' to the name server. Return the error.
+    ntsa::Error send(const bdlbb::Blob&       data,
+                     const ntca::SendOptions& options) BSLS_KEYWORD_OVERRIDE;
+
+    /// Dequeue the next datagram from the read queue into the specified
+    /// 'data' and load its source into the specified 'context'. Return the
+    /// error, notably 'ntsa::Error::e_WOULD_BLOCK' if the read queue is
+    /// empty.
+    ntsa::Error receive(ntca::ReceiveContext*       context,
+                        bdlbb::Blob*                data,
+                        const ntca::ReceiveOptions& options)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Register the specified 'session'. Return the error.
+    ntsa::Error registerSession(
+        const bsl::shared_ptr<ntci::DatagramSocketSession>& session)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Deregister the session. Return the error.
+    ntsa::Error deregisterSession() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return success.
+    ntsa::Error relaxFlowControl(ntca::FlowControlType::Value direction)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return success.
+    ntsa::Error shutdown(ntsa::ShutdownType::Value direction,
+                         ntsa::ShutdownMode::Value mode)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Close the socket and announce the completion of the shutdown
+    /// sequence when the name server is next drained.
+    void close() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the handle that identifies this socket.
+    ntsa::Handle handle() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the endpoint to which this socket is connected.
+    ntsa::Endpoint remoteEndpoint() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the null strand.
+    const bsl::shared_ptr<ntci::Strand>& strand() const
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the current elapsed time since the Unix epoch.
+    bsls::TimeInterval currentTime() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return a new blob.
+    bsl::shared_ptr<bdlbb::Blob> createIncomingBlob() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return a new blob.
+    bsl::shared_ptr<bdlbb::Blob> createOutgoingBlob() BSLS_KEYWORD_OVERRIDE;
+
+    /// Load into the specified 'blobBuffer' a new blob buffer.
+    void createIncomingBlobBuffer(bdlbb::BlobBuffer* blobBuffer)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Load into the specified 'blobBuffer' a new blob buffer.
+    void createOutgoingBlobBuffer(bdlbb::BlobBuffer* blobBuffer)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the blob buffer factory.
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&
+    incomingBlobBufferFactory() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the blob buffer factory.
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&
+    outgoingBlobBufferFactory() const BSLS_KEYWORD_OVERRIDE;
+
+    // The following functions are assumed to be never called.
+
+    void execute(const Functor&) BSLS_KEYWORD_OVERRIDE;
+    void moveAndExecute(FunctorSequence*,
+                        const Functor&) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Strand> createStrand(
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&,
+        const bsl::shared_ptr<ntci::TimerSession>&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&,
+        const ntci::TimerCallback&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    void close(const ntci::CloseFunction&) BSLS_KEYWORD_OVERRIDE;
+    void close(const ntci::CloseCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const ntsa::Endpoint&,
+                     const ntca::BindOptions&,
+                     const ntci::BindFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const ntsa::Endpoint&,
+                     const ntca::BindOptions&,
+                     const ntci::BindCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const bsl::string&,
+                     const ntca::BindOptions&,
+                     const ntci::BindFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const bsl::string&,
+                     const ntca::BindOptions&,
+                     const ntci::BindCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::BindToken&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error connect(const ntsa::Endpoint&,
+                        const ntca::ConnectOptions&,
+                        const ntci::ConnectFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error connect(const bsl::string&,
+                        const ntca::ConnectOptions&,
+                        const ntci::ConnectFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error connect(const bsl::string&,
+                        const ntca::ConnectOptions&,
+                        const ntci::ConnectCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::ConnectToken&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const ntsa::Data&,
+                     const ntca::SendOptions&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const bdlbb::Blob&,
+                     const ntca::SendOptions&,
+                     const ntci::SendFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const bdlbb::Blob&,
+                     const ntca::SendOptions&,
+                     const ntci::SendCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const ntsa::Data&,
+                     const ntca::SendOptions&,
+                     const ntci::SendFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const ntsa::Data&,
+                     const ntca::SendOptions&,
+                     const ntci::SendCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::SendToken&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error receive(const ntca::ReceiveOptions&,
+                        const ntci::ReceiveFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error receive(const ntca::ReceiveOptions&,
+                        const ntci::ReceiveCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::ReceiveToken&) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntsa::Data> createIncomingData() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntsa::Data> createOutgoingData() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(ntsa::Transport::Value) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(ntsa::Transport::Value,
+                     ntsa::Handle) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(
+        ntsa::Transport::Value,
+        const bsl::shared_ptr<ntsi::DatagramSocket>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerResolver(
+        const bsl::shared_ptr<ntci::Resolver>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error deregisterResolver() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerManager(
+        const bsl::shared_ptr<ntci::DatagramSocketManager>&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error deregisterManager() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerSessionCallback(
+        const ntci::DatagramSocket::SessionCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerSessionCallback(
+        const ntci::DatagramSocket::SessionCallback&,
+        const bsl::shared_ptr<ntci::Strand>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setWriteRateLimiter(
+        const bsl::shared_ptr<ntci::RateLimiter>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setWriteQueueLowWatermark(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setWriteQueueHighWatermark(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setWriteQueueWatermarks(bsl::size_t,
+                                        bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setReadRateLimiter(
+        const bsl::shared_ptr<ntci::RateLimiter>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setReadQueueLowWatermark(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setReadQueueHighWatermark(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setReadQueueWatermarks(bsl::size_t,
+                                       bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setMulticastLoopback(bool) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setMulticastTimeToLive(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setMulticastInterface(
+        const ntsa::IpAddress&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error joinMulticastGroup(
+        const ntsa::IpAddress&,
+        const ntsa::IpAddress&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error leaveMulticastGroup(
+        const ntsa::IpAddress&,
+        const ntsa::IpAddress&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error applyFlowControl(
+        ntca::FlowControlType::Value,
+        ntca::FlowControlMode::Value) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Transport::Value transport() const BSLS_KEYWORD_OVERRIDE;
+    ntsa::Endpoint sourceEndpoint() const BSLS_KEYWORD_OVERRIDE;
+    bslmt::ThreadUtil::Handle threadHandle() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t threadIndex() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t readQueueSize() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t readQueueLowWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t readQueueHighWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t writeQueueSize() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t writeQueueLowWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t writeQueueHighWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t totalBytesSent() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t totalBytesReceived() const BSLS_KEYWORD_OVERRIDE;
+};
+
+/// This class mocks the ntci::StreamSocket interface: each message sent
+/// through the socket is delivered to a stub name server, and each response
+/// of the name server is appended to the read queue of the socket.
+class StreamSocket : public ntci::StreamSocket,
+                     public ntccfg::Shared<StreamSocket>
+{
+    mutable bslmt::Mutex                       d_mutex;
+    test::NameServer*                          d_nameServer_p;
+    ntsa::Handle                               d_handle;
+    ntsa::Endpoint                             d_remoteEndpoint;
+    bsl::shared_ptr<ntci::StreamSocketSession> d_session_sp;
+    bsl::shared_ptr<bdlbb::BlobBufferFactory>  d_blobBufferFactory_sp;
+    bdlbb::Blob                                d_readQueue;
+    bsl::size_t                                d_readQueueLowWatermark;
+    bsl::shared_ptr<ntci::Strand>              d_strand_sp;
+    bool                                       d_closed;
+    bslma::Allocator*                          d_allocator_p;
+
+  private:
+    StreamSocket(const StreamSocket&) BSLS_KEYWORD_DELETED;
+    StreamSocket& operator=(const StreamSocket&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new stream socket identified by the specified 'handle'
+    /// whose data is delivered to the specified 'nameServer'. Optionally
+    /// specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    StreamSocket(test::NameServer* nameServer,
+                 ntsa::Handle      handle,
+                 bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~StreamSocket() BSLS_KEYWORD_OVERRIDE;
+
+    /// Append the specified 'response' to the read queue and announce the
+    /// read queue low watermark to the session if the read queue has grown
+    /// to it.
+    void deliver(const bdlbb::Blob& response);
+
+    /// Announce the completion of the shutdown sequence to the session.
+    void complete();
+
+    /// Open the socket. Return the error.
+    ntsa::Error open() BSLS_KEYWORD_OVERRIDE;
+
+    /// Connect to the specified 'endpoint' and invoke the specified
+    /// 'callback' when the name server is next drained. Return the error.
+    ntsa::Error connect(const ntsa::Endpoint&        endpoint,
+                        const ntca::ConnectOptions&  options,
+                        const ntci::ConnectCallback& callback)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Deliver the specified 'data' to the name server. Return the error.
+    ntsa::Error send(const bdlbb::Blob&       data,
+                     const ntca::SendOptions& options) BSLS_KEYWORD_OVERRIDE;
+
+    /// Dequeue from the read queue into the specified 'data' at least the
+    /// minimum and at most the maximum size in the specified 'options'.
+    /// Return the error, notably 'ntsa::Error::e_WOULD_BLOCK' if the read
+    /// queue is smaller than the minimum size.
+    ntsa::Error receive(ntca::ReceiveContext*       context,
+                        bdlbb::Blob*                data,
+                        const ntca::ReceiveOptions& options)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Register the specified 'session'. Return the error.
+    ntsa::Error registerSession(
+        const bsl::shared_ptr<ntci::StreamSocketSession>& session)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Deregister the session. Return the error.
+    ntsa::Error deregisterSession() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return success.
+    ntsa::Error relaxFlowControl(ntca::FlowControlType::Value direction)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Set the read queue low watermark to the specified 'lowWatermark'.
+    /// Return the error.
+    ntsa::Error setReadQueueLowWatermark(bsl::size_t lowWatermark)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return success.
+    ntsa::Error shutdown(ntsa::ShutdownType::Value direction,
+                         ntsa::ShutdownMode::Value mode)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Close the socket and announce the completion of the shutdown
+    /// sequence when the name server is next drained.
+    void close() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return a null timer: the stub name server never closes idle
+    /// connections.
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&  options,
+        const ntci::TimerCallback& callback,
+        bslma::Allocator*          basicAllocator = 0) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the handle that identifies this socket.
+    ntsa::Handle handle() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the endpoint to which this socket is connected.
+    ntsa::Endpoint remoteEndpoint() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the null strand.
+    const bsl::shared_ptr<ntci::Strand>& strand() const
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the current elapsed time since the Unix epoch.
+    bsls::TimeInterval currentTime() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return a new blob.
+    bsl::shared_ptr<bdlbb::Blob> createIncomingBlob() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return a new blob.
+    bsl::shared_ptr<bdlbb::Blob> createOutgoingBlob() BSLS_KEYWORD_OVERRIDE;
+
+    /// Load into the specified 'blobBuffer' a new blob buffer.
+    void createIncomingBlobBuffer(bdlbb::BlobBuffer* blobBuffer)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Load into the specified 'blobBuffer' a new blob buffer.
+    void createOutgoingBlobBuffer(bdlbb::BlobBuffer* blobBuffer)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the blob buffer factory.
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&
+    incomingBlobBufferFactory() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the blob buffer factory.
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&
+    outgoingBlobBufferFactory() const BSLS_KEYWORD_OVERRIDE;
+
+    // The following functions are assumed to be never called.
+
+    void execute(const Functor&) BSLS_KEYWORD_OVERRIDE;
+    void moveAndExecute(FunctorSequence*,
+                        const Functor&) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Strand> createStrand(
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&,
+        const bsl::shared_ptr<ntci::TimerSession>&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    void close(const ntci::CloseFunction&) BSLS_KEYWORD_OVERRIDE;
+    void close(const ntci::CloseCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const ntsa::Endpoint&,
+                     const ntca::BindOptions&,
+                     const ntci::BindFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const ntsa::Endpoint&,
+                     const ntca::BindOptions&,
+                     const ntci::BindCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const bsl::string&,
+                     const ntca::BindOptions&,
+                     const ntci::BindFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const bsl::string&,
+                     const ntca::BindOptions&,
+                     const ntci::BindCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::BindToken&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error connect(const ntsa::Endpoint&,
+                        const ntca::ConnectOptions&,
+                        const ntci::ConnectFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error connect(const bsl::string&,
+                        const ntca::ConnectOptions&,
+                        const ntci::ConnectFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error connect(const bsl::string&,
+                        const ntca::ConnectOptions&,
+                        const ntci::ConnectCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::ConnectToken&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::Encryption>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::Encryption>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::EncryptionClient>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::EncryptionClient>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::EncryptionServer>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::EncryptionServer>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::UpgradeToken&) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::EncryptionCertificate> sourceCertificate() const
+        BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::EncryptionCertificate> remoteCertificate() const
+        BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::EncryptionKey> privateKey() const
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const ntsa::Data&,
+                     const ntca::SendOptions&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const bdlbb::Blob&,
+                     const ntca::SendOptions&,
+                     const ntci::SendFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const bdlbb::Blob&,
+                     const ntca::SendOptions&,
+                     const ntci::SendCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const ntsa::Data&,
+                     const ntca::SendOptions&,
+                     const ntci::SendFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const ntsa::Data&,
+                     const ntca::SendOptions&,
+                     const ntci::SendCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::SendToken&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error receive(const ntca::ReceiveOptions&,
+                        const ntci::ReceiveFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error receive(const ntca::ReceiveOptions&,
+                        const ntci::ReceiveCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::ReceiveToken&) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntsa::Data> createIncomingData() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntsa::Data> createOutgoingData() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(ntsa::Transport::Value) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(ntsa::Transport::Value,
+                     ntsa::Handle) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(
+        ntsa::Transport::Value,
+        const bsl::shared_ptr<ntsi::StreamSocket>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(
+        ntsa::Transport::Value,
+        ntsa::Handle,
+        const bsl::shared_ptr<ntci::ListenerSocket>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(
+        ntsa::Transport::Value,
+        const bsl::shared_ptr<ntsi::StreamSocket>&,
+        const bsl::shared_ptr<ntci::ListenerSocket>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerResolver(
+        const bsl::shared_ptr<ntci::Resolver>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error deregisterResolver() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerManager(
+        const bsl::shared_ptr<ntci::StreamSocketManager>&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error deregisterManager() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerSessionCallback(
+        const ntci::StreamSocket::SessionCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerSessionCallback(
+        const ntci::StreamSocket::SessionCallback&,
+        const bsl::shared_ptr<ntci::Strand>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setWriteRateLimiter(
+        const bsl::shared_ptr<ntci::RateLimiter>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setWriteQueueLowWatermark(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setWriteQueueHighWatermark(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setWriteQueueWatermarks(bsl::size_t,
+                                        bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setReadRateLimiter(
+        const bsl::shared_ptr<ntci::RateLimiter>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setReadQueueHighWatermark(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setReadQueueWatermarks(bsl::size_t,
+                                       bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error applyFlowControl(
+        ntca::FlowControlType::Value,
+        ntca::FlowControlMode::Value) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error downgrade() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Transport::Value transport() const BSLS_KEYWORD_OVERRIDE;
+    ntsa::Endpoint sourceEndpoint() const BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::ListenerSocket> acceptor() const
+        BSLS_KEYWORD_OVERRIDE;
+    bslmt::ThreadUtil::Handle threadHandle() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t threadIndex() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t readQueueSize() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t readQueueLowWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t readQueueHighWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t writeQueueSize() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t writeQueueLowWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t writeQueueHighWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t totalBytesSent() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t totalBytesReceived() const BSLS_KEYWORD_OVERRIDE;
+};
+
+/// This class implements a stub name server, and the socket factories
+/// through which a client creates the sockets to communicate with it. Each
+/// query is recorded but not answered until the test responds to it. All
+/// events announced by the sockets are deferred until the test drains the
+/// name server, so that no session is invoked while the client holds its
+/// locks.
+class NameServer : public ntci::DatagramSocketFactory,
+                   public ntci::StreamSocketFactory,
+                   public ntccfg::Shared<NameServer>
+{
+  public:
+    /// Describe a query received by the name server.
+    struct Query {
+        /// The datagram socket through which the query was received, if
+        /// any.
+        bsl::shared_ptr<test::DatagramSocket> d_datagramSocket_sp;
+
+        /// The stream socket through which the query was received, if any.
+        bsl::shared_ptr<test::StreamSocket> d_streamSocket_sp;
+
+        /// The transaction identifier.
+        bsl::uint16_t d_id;
+
+        /// The name in the question.
+        bsl::string d_name;
+
+        /// The type of the question.
+        ntcdns::Type::Value d_type;
+    };
+
+  private:
+    typedef bsl::vector<ntci::Executor::Functor> FunctorQueue;
+    typedef bsl::vector<Query>                   QueryList;
+    typedef bsl::map<bsl::string, ntsa::IpAddress> HostMap;
+
+    mutable bslmt::Mutex d_mutex;
+    FunctorQueue         d_functorQueue;
+    QueryList            d_queryList;
+    HostMap              d_hostMap;
+    bsl::size_t          d_numDatagramSockets;
+    bsl::size_t          d_numStreamSockets;
+    bool                 d_truncated;
+    bslma::Allocator*    d_allocator_p;
+
+  private:
+    NameServer(const NameServer&) BSLS_KEYWORD_DELETED;
+    NameServer& operator=(const NameServer&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Load into the specified 'result' the encoding of a response to the
+    /// specified 'query' that assigns the specified 'ipAddress' to the name
+    /// in its question. If the specified 'truncated' flag is true, encode
+    /// a response that is truncated and has no answers instead.
+    void encodeResponse(bdlbb::Blob*           result,
+                        const Query&           query,
+                        const ntsa::IpAddress& ipAddress,
+                        bool                   truncated);
+
+    /// Decode the query in the specified 'data' of the specified 'size' into
+    /// the specified 'query'.
+    void decodeQuery(Query* query, const bsl::uint8_t* data, bsl::size_t size);
+
+  public:
+    /// Create a new name server. Optionally specify a 'basicAllocator' used
+    /// to supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    explicit NameServer(bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~NameServer() BSLS_KEYWORD_OVERRIDE;
+
+    /// Assign the specified 'ipAddress' to the specified 'name'.
+    void setHost(const bsl::string& name, const ntsa::IpAddress& ipAddress);
+
+    /// Set the flag that indicates each response to a query received over
+    /// a datagram socket is truncated to the specified 'value'.
+    void setTruncated(bool value);
+
+    /// Defer the specified 'functor' until the name server is next drained.
+    void execute(const ntci::Executor::Functor& functor);
+
+    /// Execute each deferred function, including those deferred while
+    /// draining, until no function is deferred.
+    void drain();
+
+    /// Record the query encoded in the specified 'data' received through
+    /// the specified 'datagramSocket'.
+    void processDatagram(
+        const bsl::shared_ptr<test::DatagramSocket>& datagramSocket,
+        const bdlbb::Blob&                           data);
+
+    /// Record each query encoded in the specified 'data' received through
+    /// the specified 'streamSocket'.
+    void processStream(const bsl::shared_ptr<test::StreamSocket>& streamSocket,
+                       const bdlbb::Blob&                         data);
+
+    /// Answer the query at the specified 'index' through the socket that
+    /// received it.
+    void respond(bsl::size_t index);
+
+    /// Answer the query at the specified 'index' through the specified
+    /// 'datagramSocket', assigning the specified 'ipAddress' to the name in
+    /// its question.
+    void respond(bsl::size_t                                  index,
+                 const bsl::shared_ptr<test::DatagramSocket>& datagramSocket,
+                 const ntsa::IpAddress&                       ipAddress);
+
+    /// Answer each query received so far through the socket that received
+    /// it.
+    void respondAll();
+
+    /// Release every query and socket.
+    void clear();
+
+    /// Create a new datagram socket with the specified 'options'.
+    /// Optionally specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    bsl::shared_ptr<ntci::DatagramSocket> createDatagramSocket(
+        const ntca::DatagramSocketOptions& options,
+        bslma::Allocator* basicAllocator = 0) BSLS_KEYWORD_OVERRIDE;
+
+    /// Create a new stream socket with the specified 'options'. Optionally
+    /// specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    bsl::shared_ptr<ntci::StreamSocket> createStreamSocket(
+        const ntca::StreamSocketOptions& options,
+        bslma::Allocator* basicAllocator = 0) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the number of queries received.
+    bsl::size_t numQueries() const;
+
+    /// Return the query at the specified 'index'.
+    Query query(bsl::size_t index) const;
+
+    /// Return the number of datagram sockets created.
+    bsl::size_t numDatagramSockets() const;
+
+    /// Return the number of stream sockets created.
+    bsl::size_t numStreamSockets() const;
+};
+
+/// This class mocks the ntci::Timer interface: the timer is never driven by
+/// a clock, but the arrival of its deadline is announced when the test
+/// expires it.
+class Timer : public ntci::Timer, public ntccfg::Shared<Timer>
+{
+    mutable bslmt::Mutex          d_mutex;
+    ntci::TimerCallback           d_callback;
+    bsl::shared_ptr<ntci::Strand> d_strand_sp;
+    bool                          d_scheduled;
+    bool                          d_closed;
+
+  private:
+    Timer(const Timer&) BSLS_KEYWORD_DELETED;
+    Timer& operator=(const Timer&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new timer that invokes the specified 'callback' when it
+    /// expires. Optionally specify a 'basicAllocator' used to supply
+    /// memory. If 'basicAllocator' is 0, the currently installed default
+    /// allocator is used.
+    explicit Timer(const ntci::TimerCallback& callback,
+                   bslma::Allocator*          basicAllocator = 0);
+
+    /// Destroy this object.
+    ~Timer() BSLS_KEYWORD_OVERRIDE;
+
+    /// Announce the arrival of the deadline of this timer to its callback,
+    /// if the timer is scheduled and not closed.
+    void expire();
+
+    /// Schedule the timer. Return the error.
+    ntsa::Error schedule(const bsls::TimeInterval& deadline,
+                         const bsls::TimeInterval& period)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Cancel the timer. Return the error.
+    ntsa::Error cancel() BSLS_KEYWORD_OVERRIDE;
+
+    /// Close the timer and release its callback. Return the error.
+    ntsa::Error close() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return true if the timer is closed, otherwise return false.
+    bool isClosed() const;
+
+    /// Return the null strand.
+    const bsl::shared_ptr<ntci::Strand>& strand() const
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the current elapsed time since the Unix epoch.
+    bsls::TimeInterval currentTime() const BSLS_KEYWORD_OVERRIDE;
+
+    // The following functions are assumed to be never called.
+
+    void arrive(const bsl::shared_ptr<ntci::Timer>&,
+                const bsls::TimeInterval&,
+                const bsls::TimeInterval&) BSLS_KEYWORD_OVERRIDE;
+    void* handle() const BSLS_KEYWORD_OVERRIDE;
+    int   id() const BSLS_KEYWORD_OVERRIDE;
+    bool  oneShot() const BSLS_KEYWORD_OVERRIDE;
+    bslmt::ThreadUtil::Handle threadHandle() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t               threadIndex() const BSLS_KEYWORD_OVERRIDE;
+};
+
+/// This class mocks the ntci::Resolver interface as required by the
+/// initiators of requests to a client: it creates the timers that implement
+/// the deadline of each request, which the test expires explicitly.
+class Resolver : public ntci::Resolver, public ntccfg::Shared<Resolver>
+{
+    typedef bsl::vector<bsl::shared_ptr<test::Timer> > TimerList;
+
+    mutable bslmt::Mutex          d_mutex;
+    TimerList                     d_timerList;
+    bsl::shared_ptr<ntci::Strand> d_strand_sp;
+    bslma::Allocator*             d_allocator_p;
+
+  private:
+    Resolver(const Resolver&) BSLS_KEYWORD_DELETED;
+    Resolver& operator=(const Resolver&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new resolver. Optionally specify a 'basicAllocator' used
+    /// to supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    explicit Resolver(bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~Resolver() BSLS_KEYWORD_OVERRIDE;
+
+    /// Create a new timer that invokes the specified 'callback' when it
+    /// expires. Optionally specify a 'basicAllocator' used to supply
+    /// memory. If 'basicAllocator' is 0, the currently installed default
+    /// allocator is used.
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&  options,
+        const ntci::TimerCallback& callback,
+        bslma::Allocator*          basicAllocator = 0) BSLS_KEYWORD_OVERRIDE;
+
+    /// Expire the timer created at the specified 'index'.
+    void expire(bsl::size_t index);
+
+    /// Return the number of timers created.
+    bsl::size_t numTimers() const;
+
+    /// Return the timer created at the specified 'index'.
+    bsl::shared_ptr<test::Timer> timer(bsl::size_t index) const;
+
+    /// Return the null strand.
+    const bsl::shared_ptr<ntci::Strand>& strand() const
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the current elapsed time since the Unix epoch.
+    bsls::TimeInterval currentTime() const BSLS_KEYWORD_OVERRIDE;
+
+    // The following functions are assumed to be never called.
+
+    ntsa::Error start() BSLS_KEYWORD_OVERRIDE;
+    void        shutdown() BSLS_KEYWORD_OVERRIDE;
+    void        linger() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setIpAddress(const bslstl::StringRef&,
+                             const bsl::vector<ntsa::IpAddress>&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error addIpAddress(const bslstl::StringRef&,
+                             const bsl::vector<ntsa::IpAddress>&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error addIpAddress(const bslstl::StringRef&,
+                             const ntsa::IpAddress&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setPort(const bslstl::StringRef&,
+                        const bsl::vector<ntsa::Port>&,
+                        ntsa::Transport::Value) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error addPort(const bslstl::StringRef&,
+                        const bsl::vector<ntsa::Port>&,
+                        ntsa::Transport::Value) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error addPort(const bslstl::StringRef&,
+                        ntsa::Port,
+                        ntsa::Transport::Value) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setLocalIpAddress(const bsl::vector<ntsa::IpAddress>&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setHostname(const bsl::string&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setHostnameFullyQualified(const bsl::string&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error getIpAddress(const bslstl::StringRef&,
+                             const ntca::GetIpAddressOptions&,
+                             const ntci::GetIpAddressCallback&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error getDomainName(const ntsa::IpAddress&,
+                              const ntca::GetDomainNameOptions&,
+                              const ntci::GetDomainNameCallback&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error getPort(const bslstl::StringRef&,
+                        const ntca::GetPortOptions&,
+                        const ntci::GetPortCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error getServiceName(ntsa::Port,
+                               const ntca::GetServiceNameOptions&,
+                               const ntci::GetServiceNameCallback&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error getEndpoint(const bslstl::StringRef&,
+                            const ntca::GetEndpointOptions&,
+                            const ntci::GetEndpointCallback&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error getServiceEndpoints(const bslstl::StringRef&,
+                                    const ntca::GetServiceEndpointsOptions&,
+                                    const ntci::GetServiceEndpointsCallback&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error getLocalIpAddress(bsl::vector<ntsa::IpAddress>*,
+                                  const ntsa::IpAddressOptions&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error getHostname(bsl::string*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error getHostnameFullyQualified(bsl::string*)
+        BSLS_KEYWORD_OVERRIDE;
+    void        execute(const Functor&) BSLS_KEYWORD_OVERRIDE;
+    void        moveAndExecute(FunctorSequence*,
+                               const Functor&) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Strand> createStrand(bslma::Allocator*)
+        BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&,
+        const bsl::shared_ptr<ntci::TimerSession>&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+};
+
+/// Describe the results of a request to get the IP addresses assigned to a
+/// name.
+struct GetIpAddressResult {
+    /// Create a new result.
+    GetIpAddressResult();
+
+    /// The number of times the callback has been invoked.
+    bsl::size_t d_numCallbacks;
+
+    /// The type of the last event.
+    ntca::GetIpAddressEventType::Value d_eventType;
+
+    /// The IP addresses announced by the last event.
+    bsl::vector<ntsa::IpAddress> d_ipAddressList;
+
+    /// The error announced by the last event.
+    ntsa::Error d_error;
+};
+
+/// Process the specified 'event' of a request to get the specified
+/// 'ipAddressList' by recording it in the specified 'result'.
+void processGetIpAddress(const bsl::shared_ptr<ntci::Resolver>& resolver,
+                         const bsl::vector<ntsa::IpAddress>&    ipAddressList,
+                         const ntca::GetIpAddressEvent&         event,
+                         test::GetIpAddressResult*              result);
+
+/// Invoke the specified 'callback' with the specified 'connector' and
+/// 'event'.
+void processConnect(const ntci::ConnectCallback&            callback,
+                    const bsl::shared_ptr<ntci::Connector>& connector,
+                    const ntca::ConnectEvent&               event);
+
+/// Return a new client configuration that sends queries to a single name
+/// server.
+ntcdns::ClientConfig createClientConfig();
+
+DatagramSocket::DatagramSocket(test::NameServer* nameServer,
+                               ntsa::Handle      handle,
+                               bslma::Allocator* basicAllocator)
+: d_mutex()
+, d_nameServer_p(nameServer)
+, d_handle(handle)
+, d_remoteEndpoint()
+, d_session_sp()
+, d_readQueue(basicAllocator)
+, d_blobBufferFactory_sp()
+, d_strand_sp()
+, d_closed(false)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
+    bsl::shared_ptr<bdlbb::SimpleBlobBufferFactory> blobBufferFactory;
+    blobBufferFactory.createInplace(d_allocator_p, 4096, d_allocator_p);
+
+    d_blobBufferFactory_sp = blobBufferFactory;
 }
 
-NTCCFG_TEST_DRIVER
+DatagramSocket::~DatagramSocket()
 {
-    NTCCFG_TEST_REGISTER(1);
 }
-NTCCFG_TEST_DRIVER_END;
 
-#endif
+void DatagramSocket::deliver(const bdlbb::Blob& response)
+{
+    bsl::shared_ptr<ntci::DatagramSocketSession> session;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (d_closed) {
+            return;
+        }
+
+        bsl::shared_ptr<bdlbb::Blob> blob = this->createIncomingBlob();
+        bdlbb::BlobUtil::append(blob.get(), response);
+
+        d_readQueue.push_back(blob);
+        session = d_session_sp;
+    }
+
+    if (session) {
+        session->processReadQueueLowWatermark(this->getSelf(this),
+                                              ntca::ReadQueueEvent());
+    }
+}
+
+void DatagramSocket::complete()
+{
+    bsl::shared_ptr<ntci::DatagramSocketSession> session;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        session = d_session_sp;
+    }
+
+    if (session) {
+        session->processShutdownComplete(this->getSelf(this),
+                                         ntca::ShutdownEvent());
+    }
+}
+
+ntsa::Error DatagramSocket::open()
+{
+    return ntsa::Error();
+}
+
+ntsa::Error DatagramSocket::connect(const ntsa::Endpoint&        endpoint,
+                                    const ntca::ConnectOptions&  options,
+                                    const ntci::ConnectCallback& callback)
+{
+    NTCCFG_WARNING_UNUSED(options);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        d_remoteEndpoint = endpoint;
+    }
+
+    bsl::shared_ptr<ntci::Connector> connector = this->getSelf(this);
+
+    ntca::ConnectEvent event;
+    event.setType(ntca::ConnectEventType::e_COMPLETE);
+
+    d_nameServer_p->execute(bdlf::BindUtil::bind(&test::processConnect,
+                                                 callback,
+                                                 connector,
+                                                 event));
+
+    return ntsa::Error();
+}
+
+ntsa::Error DatagramSocket::send(const bdlbb::Blob&       data,
+                                 const ntca::SendOptions& options)
+{
+    NTCCFG_WARNING_UNUSED(options);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (d_closed) {
+            return ntsa::Error(ntsa::Error::e_CONNECTION_DEAD);
+        }
+    }
+
+    d_nameServer_p->processDatagram(this->getSelf(this), data);
+    return ntsa::Error();
+}
+
+ntsa::Error DatagramSocket::receive(ntca::ReceiveContext*       context,
+                                    bdlbb::Blob*                data,
+                                    const ntca::ReceiveOptions& options)
+{
+    NTCCFG_WARNING_UNUSED(options);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (d_readQueue.empty()) {
+        return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+    }
+
+    bdlbb::BlobUtil::append(data, *d_readQueue.front());
+    d_readQueue.pop_front();
+
+    context->setEndpoint(d_remoteEndpoint);
+
+    return ntsa::Error();
+}
+
+ntsa::Error DatagramSocket::registerSession(
+    const bsl::shared_ptr<ntci::DatagramSocketSession>& session)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_session_sp = session;
+    return ntsa::Error();
+}
+
+ntsa::Error DatagramSocket::deregisterSession()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_session_sp.reset();
+    return ntsa::Error();
+}
+
+ntsa::Error DatagramSocket::relaxFlowControl(
+    ntca::FlowControlType::Value direction)
+{
+    NTCCFG_WARNING_UNUSED(direction);
+    return ntsa::Error();
+}
+
+ntsa::Error DatagramSocket::shutdown(ntsa::ShutdownType::Value direction,
+                                     ntsa::ShutdownMode::Value mode)
+{
+    NTCCFG_WARNING_UNUSED(direction);
+    NTCCFG_WARNING_UNUSED(mode);
+    return ntsa::Error();
+}
+
+void DatagramSocket::close()
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (d_closed) {
+            return;
+        }
+
+        d_closed = true;
+        d_readQueue.clear();
+    }
+
+    d_nameServer_p->execute(
+        bdlf::BindUtil::bind(&DatagramSocket::complete, this->getSelf(this)));
+}
+
+ntsa::Handle DatagramSocket::handle() const
+{
+    return d_handle;
+}
+
+ntsa::Endpoint DatagramSocket::remoteEndpoint() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_remoteEndpoint;
+}
+
+const bsl::shared_ptr<ntci::Strand>& DatagramSocket::strand() const
+{
+    return d_strand_sp;
+}
+
+bsls::TimeInterval DatagramSocket::currentTime() const
+{
+    return bdlt::CurrentTime::now();
+}
+
+bsl::shared_ptr<bdlbb::Blob> DatagramSocket::createIncomingBlob()
+{
+    bsl::shared_ptr<bdlbb::Blob> blob;
+    blob.createInplace(d_allocator_p,
+                       d_blobBufferFactory_sp.get(),
+                       d_allocator_p);
+    return blob;
+}
+
+bsl::shared_ptr<bdlbb::Blob> DatagramSocket::createOutgoingBlob()
+{
+    return this->createIncomingBlob();
+}
+
+void DatagramSocket::createIncomingBlobBuffer(bdlbb::BlobBuffer* blobBuffer)
+{
+    d_blobBufferFactory_sp->allocate(blobBuffer);
+}
+
+void DatagramSocket::createOutgoingBlobBuffer(bdlbb::BlobBuffer* blobBuffer)
+{
+    d_blobBufferFactory_sp->allocate(blobBuffer);
+}
+
+const bsl::shared_ptr<bdlbb::BlobBufferFactory>& DatagramSocket::
+    incomingBlobBufferFactory() const
+{
+    return d_blobBufferFactory_sp;
+}
+
+const bsl::shared_ptr<bdlbb::BlobBufferFactory>& DatagramSocket::
+    outgoingBlobBufferFactory() const
+{
+    return d_blobBufferFactory_sp;
+}
+
+void DatagramSocket::execute(const Functor&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void DatagramSocket::moveAndExecute(FunctorSequence*, const Functor&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+bsl::shared_ptr<ntci::Strand> DatagramSocket::createStrand(bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Strand>();
+}
+
+bsl::shared_ptr<ntci::Timer> DatagramSocket::createTimer(
+    const ntca::TimerOptions&,
+    const bsl::shared_ptr<ntci::TimerSession>&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Timer>();
+}
+
+bsl::shared_ptr<ntci::Timer> DatagramSocket::createTimer(
+    const ntca::TimerOptions&,
+    const ntci::TimerCallback&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Timer>();
+}
+
+void DatagramSocket::close(const ntci::CloseFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void DatagramSocket::close(const ntci::CloseCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+ntsa::Error DatagramSocket::bind(const ntsa::Endpoint&,
+                                 const ntca::BindOptions&,
+                                 const ntci::BindFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::bind(const ntsa::Endpoint&,
+                                 const ntca::BindOptions&,
+                                 const ntci::BindCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::bind(const bsl::string&,
+                                 const ntca::BindOptions&,
+                                 const ntci::BindFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::bind(const bsl::string&,
+                                 const ntca::BindOptions&,
+                                 const ntci::BindCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::cancel(const ntca::BindToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::connect(const ntsa::Endpoint&,
+                                    const ntca::ConnectOptions&,
+                                    const ntci::ConnectFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::connect(const bsl::string&,
+                                    const ntca::ConnectOptions&,
+                                    const ntci::ConnectFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::connect(const bsl::string&,
+                                    const ntca::ConnectOptions&,
+                                    const ntci::ConnectCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::cancel(const ntca::ConnectToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::send(const ntsa::Data&, const ntca::SendOptions&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::send(const bdlbb::Blob&,
+                                 const ntca::SendOptions&,
+                                 const ntci::SendFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::send(const bdlbb::Blob&,
+                                 const ntca::SendOptions&,
+                                 const ntci::SendCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::send(const ntsa::Data&,
+                                 const ntca::SendOptions&,
+                                 const ntci::SendFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::send(const ntsa::Data&,
+                                 const ntca::SendOptions&,
+                                 const ntci::SendCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::cancel(const ntca::SendToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::receive(const ntca::ReceiveOptions&,
+                                    const ntci::ReceiveFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::receive(const ntca::ReceiveOptions&,
+                                    const ntci::ReceiveCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::cancel(const ntca::ReceiveToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+bsl::shared_ptr<ntsa::Data> DatagramSocket::createIncomingData()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntsa::Data>();
+}
+
+bsl::shared_ptr<ntsa::Data> DatagramSocket::createOutgoingData()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntsa::Data>();
+}
+
+ntsa::Error DatagramSocket::open(ntsa::Transport::Value)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::open(ntsa::Transport::Value, ntsa::Handle)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::open(ntsa::Transport::Value,
+                                 const bsl::shared_ptr<ntsi::DatagramSocket>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::registerResolver(
+    const bsl::shared_ptr<ntci::Resolver>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::deregisterResolver()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::registerManager(
+    const bsl::shared_ptr<ntci::DatagramSocketManager>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::deregisterManager()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::registerSessionCallback(
+    const ntci::DatagramSocket::SessionCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::registerSessionCallback(
+    const ntci::DatagramSocket::SessionCallback&,
+    const bsl::shared_ptr<ntci::Strand>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::setWriteRateLimiter(
+    const bsl::shared_ptr<ntci::RateLimiter>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::setWriteQueueLowWatermark(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::setWriteQueueHighWatermark(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::setWriteQueueWatermarks(bsl::size_t, bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::setReadRateLimiter(
+    const bsl::shared_ptr<ntci::RateLimiter>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::setReadQueueLowWatermark(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::setReadQueueHighWatermark(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::setReadQueueWatermarks(bsl::size_t, bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::setMulticastLoopback(bool)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::setMulticastTimeToLive(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::setMulticastInterface(const ntsa::IpAddress&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::joinMulticastGroup(const ntsa::IpAddress&,
+                                               const ntsa::IpAddress&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::leaveMulticastGroup(const ntsa::IpAddress&,
+                                                const ntsa::IpAddress&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error DatagramSocket::applyFlowControl(ntca::FlowControlType::Value,
+                                             ntca::FlowControlMode::Value)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Transport::Value DatagramSocket::transport() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Transport::e_UNDEFINED;
+}
+
+ntsa::Endpoint DatagramSocket::sourceEndpoint() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Endpoint();
+}
+
+bslmt::ThreadUtil::Handle DatagramSocket::threadHandle() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bslmt::ThreadUtil::invalidHandle();
+}
+
+bsl::size_t DatagramSocket::threadIndex() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t DatagramSocket::readQueueSize() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t DatagramSocket::readQueueLowWatermark() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t DatagramSocket::readQueueHighWatermark() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t DatagramSocket::writeQueueSize() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t DatagramSocket::writeQueueLowWatermark() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t DatagramSocket::writeQueueHighWatermark() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t DatagramSocket::totalBytesSent() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t DatagramSocket::totalBytesReceived() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+StreamSocket::StreamSocket(test::NameServer* nameServer,
+                           ntsa::Handle      handle,
+                           bslma::Allocator* basicAllocator)
+: d_mutex()
+, d_nameServer_p(nameServer)
+, d_handle(handle)
+, d_remoteEndpoint()
+, d_session_sp()
+, d_blobBufferFactory_sp()
+, d_readQueue(basicAllocator)
+, d_readQueueLowWatermark(1)
+, d_strand_sp()
+, d_closed(false)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    bsl::shared_ptr<bdlbb::SimpleBlobBufferFactory> blobBufferFactory;
+    blobBufferFactory.createInplace(d_allocator_p, 4096, d_allocator_p);
+
+    d_blobBufferFactory_sp = blobBufferFactory;
+}
+
+StreamSocket::~StreamSocket()
+{
+}
+
+void StreamSocket::deliver(const bdlbb::Blob& response)
+{
+    bsl::shared_ptr<ntci::StreamSocketSession> session;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (d_closed) {
+            return;
+        }
+
+        bdlbb::BlobUtil::append(&d_readQueue, response);
+
+        if (static_cast<bsl::size_t>(d_readQueue.length()) >=
+            d_readQueueLowWatermark)
+        {
+            session = d_session_sp;
+        }
+    }
+
+    if (session) {
+        session->processReadQueueLowWatermark(this->getSelf(this),
+                                              ntca::ReadQueueEvent());
+    }
+}
+
+void StreamSocket::complete()
+{
+    bsl::shared_ptr<ntci::StreamSocketSession> session;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        session = d_session_sp;
+    }
+
+    if (session) {
+        session->processShutdownComplete(this->getSelf(this),
+                                         ntca::ShutdownEvent());
+    }
+}
+
+ntsa::Error StreamSocket::open()
+{
+    return ntsa::Error();
+}
+
+ntsa::Error StreamSocket::connect(const ntsa::Endpoint&        endpoint,
+                                  const ntca::ConnectOptions&  options,
+                                  const ntci::ConnectCallback& callback)
+{
+    NTCCFG_WARNING_UNUSED(options);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        d_remoteEndpoint = endpoint;
+    }
+
+    bsl::shared_ptr<ntci::Connector> connector = this->getSelf(this);
+
+    ntca::ConnectEvent event;
+    event.setType(ntca::ConnectEventType::e_COMPLETE);
+
+    d_nameServer_p->execute(bdlf::BindUtil::bind(&test::processConnect,
+                                                 callback,
+                                                 connector,
+                                                 event));
+
+    return ntsa::Error();
+}
+
+ntsa::Error StreamSocket::send(const bdlbb::Blob&       data,
+                               const ntca::SendOptions& options)
+{
+    NTCCFG_WARNING_UNUSED(options);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (d_closed) {
+            return ntsa::Error(ntsa::Error::e_CONNECTION_DEAD);
+        }
+    }
+
+    d_nameServer_p->processStream(this->getSelf(this), data);
+    return ntsa::Error();
+}
+
+ntsa::Error StreamSocket::receive(ntca::ReceiveContext*       context,
+                                  bdlbb::Blob*                data,
+                                  const ntca::ReceiveOptions& options)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    const bsl::size_t size = static_cast<bsl::size_t>(d_readQueue.length());
+
+    if (size == 0 || size < options.minSize()) {
+        return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+    }
+
+    const int numBytes =
+        static_cast<int>(bsl::min(size, options.maxSize()));
+
+    bdlbb::BlobUtil::append(data, d_readQueue, 0, numBytes);
+    bdlbb::BlobUtil::erase(&d_readQueue, 0, numBytes);
+
+    context->setEndpoint(d_remoteEndpoint);
+
+    return ntsa::Error();
+}
+
+ntsa::Error StreamSocket::registerSession(
+    const bsl::shared_ptr<ntci::StreamSocketSession>& session)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_session_sp = session;
+    return ntsa::Error();
+}
+
+ntsa::Error StreamSocket::deregisterSession()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_session_sp.reset();
+    return ntsa::Error();
+}
+
+ntsa::Error StreamSocket::relaxFlowControl(
+    ntca::FlowControlType::Value direction)
+{
+    NTCCFG_WARNING_UNUSED(direction);
+    return ntsa::Error();
+}
+
+ntsa::Error StreamSocket::setReadQueueLowWatermark(bsl::size_t lowWatermark)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_readQueueLowWatermark = lowWatermark;
+    return ntsa::Error();
+}
+
+ntsa::Error StreamSocket::shutdown(ntsa::ShutdownType::Value direction,
+                                   ntsa::ShutdownMode::Value mode)
+{
+    NTCCFG_WARNING_UNUSED(direction);
+    NTCCFG_WARNING_UNUSED(mode);
+    return ntsa::Error();
+}
+
+void StreamSocket::close()
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (d_closed) {
+            return;
+        }
+
+        d_closed = true;
+        d_readQueue.removeAll();
+    }
+
+    d_nameServer_p->execute(
+        bdlf::BindUtil::bind(&StreamSocket::complete, this->getSelf(this)));
+}
+
+bsl::shared_ptr<ntci::Timer> StreamSocket::createTimer(
+    const ntca::TimerOptions&  options,
+    const ntci::TimerCallback& callback,
+    bslma::Allocator*          basicAllocator)
+{
+    NTCCFG_WARNING_UNUSED(options);
+    NTCCFG_WARNING_UNUSED(callback);
+    NTCCFG_WARNING_UNUSED(basicAllocator);
+
+    return bsl::shared_ptr<ntci::Timer>();
+}
+
+ntsa::Handle StreamSocket::handle() const
+{
+    return d_handle;
+}
+
+ntsa::Endpoint StreamSocket::remoteEndpoint() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_remoteEndpoint;
+}
+
+const bsl::shared_ptr<ntci::Strand>& StreamSocket::strand() const
+{
+    return d_strand_sp;
+}
+
+bsls::TimeInterval StreamSocket::currentTime() const
+{
+    return bdlt::CurrentTime::now();
+}
+
+bsl::shared_ptr<bdlbb::Blob> StreamSocket::createIncomingBlob()
+{
+    bsl::shared_ptr<bdlbb::Blob> blob;
+    blob.createInplace(d_allocator_p,
+                       d_blobBufferFactory_sp.get(),
+                       d_allocator_p);
+    return blob;
+}
+
+bsl::shared_ptr<bdlbb::Blob> StreamSocket::createOutgoingBlob()
+{
+    return this->createIncomingBlob();
+}
+
+void StreamSocket::createIncomingBlobBuffer(bdlbb::BlobBuffer* blobBuffer)
+{
+    d_blobBufferFactory_sp->allocate(blobBuffer);
+}
+
+void StreamSocket::createOutgoingBlobBuffer(bdlbb::BlobBuffer* blobBuffer)
+{
+    d_blobBufferFactory_sp->allocate(blobBuffer);
+}
+
+const bsl::shared_ptr<bdlbb::BlobBufferFactory>& StreamSocket::
+    incomingBlobBufferFactory() const
+{
+    return d_blobBufferFactory_sp;
+}
+
+const bsl::shared_ptr<bdlbb::BlobBufferFactory>& StreamSocket::
+    outgoingBlobBufferFactory() const
+{
+    return d_blobBufferFactory_sp;
+}
+
+void StreamSocket::execute(const Functor&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void StreamSocket::moveAndExecute(FunctorSequence*, const Functor&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+bsl::shared_ptr<ntci::Strand> StreamSocket::createStrand(bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Strand>();
+}
+
+bsl::shared_ptr<ntci::Timer> StreamSocket::createTimer(
+    const ntca::TimerOptions&,
+    const bsl::shared_ptr<ntci::TimerSession>&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Timer>();
+}
+
+void StreamSocket::close(const ntci::CloseFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void StreamSocket::close(const ntci::CloseCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+ntsa::Error StreamSocket::bind(const ntsa::Endpoint&,
+                               const ntca::BindOptions&,
+                               const ntci::BindFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::bind(const ntsa::Endpoint&,
+                               const ntca::BindOptions&,
+                               const ntci::BindCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::bind(const bsl::string&,
+                               const ntca::BindOptions&,
+                               const ntci::BindFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::bind(const bsl::string&,
+                               const ntca::BindOptions&,
+                               const ntci::BindCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::cancel(const ntca::BindToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::connect(const ntsa::Endpoint&,
+                                  const ntca::ConnectOptions&,
+                                  const ntci::ConnectFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::connect(const bsl::string&,
+                                  const ntca::ConnectOptions&,
+                                  const ntci::ConnectFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::connect(const bsl::string&,
+                                  const ntca::ConnectOptions&,
+                                  const ntci::ConnectCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::cancel(const ntca::ConnectToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(const bsl::shared_ptr<ntci::Encryption>&,
+                                  const ntca::UpgradeOptions&,
+                                  const ntci::UpgradeFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(const bsl::shared_ptr<ntci::Encryption>&,
+                                  const ntca::UpgradeOptions&,
+                                  const ntci::UpgradeCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(
+    const bsl::shared_ptr<ntci::EncryptionClient>&,
+    const ntca::UpgradeOptions&,
+    const ntci::UpgradeFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(
+    const bsl::shared_ptr<ntci::EncryptionClient>&,
+    const ntca::UpgradeOptions&,
+    const ntci::UpgradeCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(
+    const bsl::shared_ptr<ntci::EncryptionServer>&,
+    const ntca::UpgradeOptions&,
+    const ntci::UpgradeFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(
+    const bsl::shared_ptr<ntci::EncryptionServer>&,
+    const ntca::UpgradeOptions&,
+    const ntci::UpgradeCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::cancel(const ntca::UpgradeToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+bsl::shared_ptr<ntci::EncryptionCertificate> StreamSocket::
+    sourceCertificate() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::EncryptionCertificate>();
+}
+
+bsl::shared_ptr<ntci::EncryptionCertificate> StreamSocket::
+    remoteCertificate() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::EncryptionCertificate>();
+}
+
+bsl::shared_ptr<ntci::EncryptionKey> StreamSocket::privateKey() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::EncryptionKey>();
+}
+
+ntsa::Error StreamSocket::send(const ntsa::Data&, const ntca::SendOptions&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::send(const bdlbb::Blob&,
+                               const ntca::SendOptions&,
+                               const ntci::SendFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::send(const bdlbb::Blob&,
+                               const ntca::SendOptions&,
+                               const ntci::SendCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::send(const ntsa::Data&,
+                               const ntca::SendOptions&,
+                               const ntci::SendFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::send(const ntsa::Data&,
+                               const ntca::SendOptions&,
+                               const ntci::SendCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::cancel(const ntca::SendToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::receive(const ntca::ReceiveOptions&,
+                                  const ntci::ReceiveFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::receive(const ntca::ReceiveOptions&,
+                                  const ntci::ReceiveCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::cancel(const ntca::ReceiveToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+bsl::shared_ptr<ntsa::Data> StreamSocket::createIncomingData()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntsa::Data>();
+}
+
+bsl::shared_ptr<ntsa::Data> StreamSocket::createOutgoingData()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntsa::Data>();
+}
+
+ntsa::Error StreamSocket::open(ntsa::Transport::Value)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::open(ntsa::Transport::Value, ntsa::Handle)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::open(ntsa::Transport::Value,
+                               const bsl::shared_ptr<ntsi::StreamSocket>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::open(ntsa::Transport::Value,
+                               ntsa::Handle,
+                               const bsl::shared_ptr<ntci::ListenerSocket>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::open(ntsa::Transport::Value,
+                               const bsl::shared_ptr<ntsi::StreamSocket>&,
+                               const bsl::shared_ptr<ntci::ListenerSocket>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::registerResolver(
+    const bsl::shared_ptr<ntci::Resolver>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::deregisterResolver()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::registerManager(
+    const bsl::shared_ptr<ntci::StreamSocketManager>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::deregisterManager()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::registerSessionCallback(
+    const ntci::StreamSocket::SessionCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::registerSessionCallback(
+    const ntci::StreamSocket::SessionCallback&,
+    const bsl::shared_ptr<ntci::Strand>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setWriteRateLimiter(
+    const bsl::shared_ptr<ntci::RateLimiter>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setWriteQueueLowWatermark(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setWriteQueueHighWatermark(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setWriteQueueWatermarks(bsl::size_t, bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setReadRateLimiter(
+    const bsl::shared_ptr<ntci::RateLimiter>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setReadQueueHighWatermark(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setReadQueueWatermarks(bsl::size_t, bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::applyFlowControl(ntca::FlowControlType::Value,
+                                           ntca::FlowControlMode::Value)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::downgrade()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Transport::Value StreamSocket::transport() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Transport::e_UNDEFINED;
+}
+
+ntsa::Endpoint StreamSocket::sourceEndpoint() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Endpoint();
+}
+
+bsl::shared_ptr<ntci::ListenerSocket> StreamSocket::acceptor() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::ListenerSocket>();
+}
+
+bslmt::ThreadUtil::Handle StreamSocket::threadHandle() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bslmt::ThreadUtil::invalidHandle();
+}
+
+bsl::size_t StreamSocket::threadIndex() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::readQueueSize() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::readQueueLowWatermark() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::readQueueHighWatermark() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::writeQueueSize() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::writeQueueLowWatermark() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::writeQueueHighWatermark() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::totalBytesSent() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::totalBytesReceived() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+void NameServer::encodeResponse(bdlbb::Blob*           result,
+                                const Query&           query,
+                                const ntsa::IpAddress& ipAddress,
+                                bool                   truncated)
+{
+    ntsa::Error error;
+
+    ntcdns::Message response(d_allocator_p);
+
+    response.setId(query.d_id);
+    response.setDirection(ntcdns::Direction::e_RESPONSE);
+    response.setOperation(ntcdns::Operation::e_STANDARD);
+    response.setError(ntcdns::Error::e_OK);
+    response.setRd(true);
+    response.setRa(true);
+    response.setTc(truncated);
+
+    ntcdns::Question& question = response.addQd();
+    question.setName(query.d_name);
+    question.setType(query.d_type);
+    question.setClassification(ntcdns::Classification::e_INTERNET);
+
+    if (!truncated && ipAddress.isV4()) {
+        ntcdns::ResourceRecordData rdata(d_allocator_p);
+        ntcdns::ResourceRecordDataA& a = rdata.makeIpv4();
+        ipAddress.v4().copyTo(&a, sizeof a);
+
+        ntcdns::ResourceRecord& answer = response.addAn();
+        answer.setName(query.d_name);
+        answer.setType(ntcdns::Type::e_A);
+        answer.setClassification(ntcdns::Classification::e_INTERNET);
+        answer.setTtl(60);
+        answer.setRdata(rdata);
+    }
+
+    bsl::vector<bsl::uint8_t> buffer(512, d_allocator_p);
+
+    ntcdns::MemoryEncoder encoder(&buffer[0], buffer.size());
+
+    error = response.encode(&encoder);
+    NTCCFG_TEST_OK(error);
+
+    bdlbb::BlobUtil::append(result,
+                            reinterpret_cast<const char*>(&buffer[0]),
+                            static_cast<int>(encoder.position()));
+}
+
+NameServer::NameServer(bslma::Allocator* basicAllocator)
+: d_mutex()
+, d_functorQueue(basicAllocator)
+, d_queryList(basicAllocator)
+, d_hostMap(basicAllocator)
+, d_numDatagramSockets(0)
+, d_numStreamSockets(0)
+, d_truncated(false)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+NameServer::~NameServer()
+{
+}
+
+void NameServer::setHost(const bsl::string&     name,
+                         const ntsa::IpAddress& ipAddress)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_hostMap[name] = ipAddress;
+}
+
+void NameServer::setTruncated(bool value)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_truncated = value;
+}
+
+void NameServer::execute(const ntci::Executor::Functor& functor)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_functorQueue.push_back(functor);
+}
+
+void NameServer::drain()
+{
+    while (true) {
+        FunctorQueue functorQueue(d_allocator_p);
+        {
+            bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+            functorQueue.swap(d_functorQueue);
+        }
+
+        if (functorQueue.empty()) {
+            break;
+        }
+
+        for (FunctorQueue::iterator it = functorQueue.begin();
+             it != functorQueue.end();
+             ++it)
+        {
+            (*it)();
+        }
+    }
+}
+
+void NameServer::decodeQuery(Query*              query,
+                             const bsl::uint8_t* data,
+                             bsl::size_t         size)
+{
+    ntsa::Error error;
+
+    ntcdns::Message request(d_allocator_p);
+
+    ntcdns::MemoryDecoder decoder(data, size);
+    error = request.decode(&decoder);
+    NTCCFG_TEST_OK(error);
+
+    NTCCFG_TEST_EQ(request.direction(), ntcdns::Direction::e_REQUEST);
+    NTCCFG_TEST_EQ(request.qdcount(), 1);
+
+    query->d_id   = request.id();
+    query->d_name = request.qd(0).name();
+    query->d_type = request.qd(0).type();
+}
+
+void NameServer::processDatagram(
+    const bsl::shared_ptr<test::DatagramSocket>& datagramSocket,
+    const bdlbb::Blob&                           data)
+{
+    bsl::vector<bsl::uint8_t> buffer(d_allocator_p);
+    buffer.resize(static_cast<bsl::size_t>(data.length()));
+    bdlbb::BlobUtil::copy(reinterpret_cast<char*>(&buffer[0]),
+                          data,
+                          0,
+                          data.length());
+
+    Query query;
+    query.d_datagramSocket_sp = datagramSocket;
+
+    this->decodeQuery(&query, &buffer[0], buffer.size());
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_queryList.push_back(query);
+}
+
+void NameServer::processStream(
+    const bsl::shared_ptr<test::StreamSocket>& streamSocket,
+    const bdlbb::Blob&                         data)
+{
+    bsl::vector<bsl::uint8_t> buffer(d_allocator_p);
+    buffer.resize(static_cast<bsl::size_t>(data.length()));
+    bdlbb::BlobUtil::copy(reinterpret_cast<char*>(&buffer[0]),
+                          data,
+                          0,
+                          data.length());
+
+    // Each query is prefixed by its length, encoded as a 16-bit unsigned
+    // integer in network byte order.
+
+    bsl::size_t offset = 0;
+    while (offset < buffer.size()) {
+        NTCCFG_TEST_LE(offset + 2, buffer.size());
+
+        const bsl::size_t size =
+            (static_cast<bsl::size_t>(buffer[offset]) << 8) |
+            static_cast<bsl::size_t>(buffer[offset + 1]);
+
+        offset += 2;
+
+        NTCCFG_TEST_LE(offset + size, buffer.size());
+
+        Query query;
+        query.d_streamSocket_sp = streamSocket;
+
+        this->decodeQuery(&query, &buffer[offset], size);
+
+        offset += size;
+
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        d_queryList.push_back(query);
+    }
+}
+
+void NameServer::respond(bsl::size_t index)
+{
+    Query           query;
+    ntsa::IpAddress ipAddress;
+    bool            truncated;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        NTCCFG_TEST_LT(index, d_queryList.size());
+        query = d_queryList[index];
+
+        HostMap::const_iterator it = d_hostMap.find(query.d_name);
+        NTCCFG_TEST_TRUE(it != d_hostMap.end());
+        ipAddress = it->second;
+
+        truncated = d_truncated;
+    }
+
+    if (query.d_datagramSocket_sp) {
+        bsl::shared_ptr<bdlbb::Blob> response =
+            query.d_datagramSocket_sp->createOutgoingBlob();
+
+        this->encodeResponse(response.get(), query, ipAddress, truncated);
+
+        this->execute(bdlf::BindUtil::bind(&test::DatagramSocket::deliver,
+                                           query.d_datagramSocket_sp,
+                                           *response));
+    }
+    else {
+        NTCCFG_TEST_TRUE(query.d_streamSocket_sp);
+
+        bsl::shared_ptr<bdlbb::Blob> message =
+            query.d_streamSocket_sp->createOutgoingBlob();
+
+        this->encodeResponse(message.get(), query, ipAddress, false);
+
+        const char prefix[2] = {
+            static_cast<char>((message->length() >> 8) & 0xFF),
+            static_cast<char>(message->length() & 0xFF)};
+
+        bsl::shared_ptr<bdlbb::Blob> response =
+            query.d_streamSocket_sp->createOutgoingBlob();
+
+        bdlbb::BlobUtil::append(response.get(), prefix, 2);
+        bdlbb::BlobUtil::append(response.get(), *message);
+
+        this->execute(bdlf::BindUtil::bind(&test::StreamSocket::deliver,
+                                           query.d_streamSocket_sp,
+                                           *response));
+    }
+}
+
+void NameServer::respond(
+    bsl::size_t                                  index,
+    const bsl::shared_ptr<test::DatagramSocket>& datagramSocket,
+    const ntsa::IpAddress&                       ipAddress)
+{
+    Query query;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        NTCCFG_TEST_LT(index, d_queryList.size());
+        query = d_queryList[index];
+    }
+
+    bsl::shared_ptr<bdlbb::Blob> response =
+        datagramSocket->createOutgoingBlob();
+
+    this->encodeResponse(response.get(), query, ipAddress, false);
+
+    this->execute(bdlf::BindUtil::bind(&test::DatagramSocket::deliver,
+                                       datagramSocket,
+                                       *response));
+}
+
+void NameServer::respondAll()
+{
+    const bsl::size_t numQueries = this->numQueries();
+
+    for (bsl::size_t i = 0; i < numQueries; ++i) {
+        this->respond(i);
+    }
+}
+
+void NameServer::clear()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    d_functorQueue.clear();
+    d_queryList.clear();
+}
+
+bsl::shared_ptr<ntci::DatagramSocket> NameServer::createDatagramSocket(
+    const ntca::DatagramSocketOptions& options,
+    bslma::Allocator*                  basicAllocator)
+{
+    NTCCFG_WARNING_UNUSED(options);
+
+    bslma::Allocator* allocator = bslma::Default::allocator(basicAllocator);
+
+    ntsa::Handle handle;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        handle = static_cast<ntsa::Handle>(++d_numDatagramSockets);
+    }
+
+    bsl::shared_ptr<test::DatagramSocket> datagramSocket;
+    datagramSocket.createInplace(allocator, this, handle, allocator);
+
+    return datagramSocket;
+}
+
+bsl::shared_ptr<ntci::StreamSocket> NameServer::createStreamSocket(
+    const ntca::StreamSocketOptions& options,
+    bslma::Allocator*                basicAllocator)
+{
+    NTCCFG_WARNING_UNUSED(options);
+
+    bslma::Allocator* allocator = bslma::Default::allocator(basicAllocator);
+
+    ntsa::Handle handle;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        handle = static_cast<ntsa::Handle>(1000 + ++d_numStreamSockets);
+    }
+
+    bsl::shared_ptr<test::StreamSocket> streamSocket;
+    streamSocket.createInplace(allocator, this, handle, allocator);
+
+    return streamSocket;
+}
+
+bsl::size_t NameServer::numQueries() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_queryList.size();
+}
+
+NameServer::Query NameServer::query(bsl::size_t index) const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    NTCCFG_TEST_LT(index, d_queryList.size());
+    return d_queryList[index];
+}
+
+bsl::size_t NameServer::numDatagramSockets() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_numDatagramSockets;
+}
+
+bsl::size_t NameServer::numStreamSockets() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_numStreamSockets;
+}
+
+Timer::Timer(const ntci::TimerCallback& callback,
+             bslma::Allocator*          basicAllocator)
+: d_mutex()
+, d_callback(callback, basicAllocator)
+, d_strand_sp()
+, d_scheduled(false)
+, d_closed(false)
+{
+}
+
+Timer::~Timer()
+{
+}
+
+void Timer::expire()
+{
+    ntci::TimerCallback callback;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (!d_scheduled || d_closed) {
+            return;
+        }
+
+        d_scheduled = false;
+        callback    = d_callback;
+    }
+
+    ntca::TimerContext context;
+    context.setNow(bdlt::CurrentTime::now());
+
+    ntca::TimerEvent event;
+    event.setType(ntca::TimerEventType::e_DEADLINE);
+    event.setContext(context);
+
+    bsl::shared_ptr<ntci::Timer> self = this->getSelf(this);
+    callback(self, event, ntci::Strand::unknown());
+}
+
+ntsa::Error Timer::schedule(const bsls::TimeInterval& deadline,
+                            const bsls::TimeInterval& period)
+{
+    NTCCFG_WARNING_UNUSED(deadline);
+    NTCCFG_WARNING_UNUSED(period);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (d_closed) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    d_scheduled = true;
+    return ntsa::Error();
+}
+
+ntsa::Error Timer::cancel()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    d_scheduled = false;
+    return ntsa::Error();
+}
+
+ntsa::Error Timer::close()
+{
+    ntci::TimerCallback callback;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        d_scheduled = false;
+        d_closed    = true;
+
+        callback.swap(d_callback);
+    }
+
+    return ntsa::Error();
+}
+
+bool Timer::isClosed() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_closed;
+}
+
+const bsl::shared_ptr<ntci::Strand>& Timer::strand() const
+{
+    return d_strand_sp;
+}
+
+bsls::TimeInterval Timer::currentTime() const
+{
+    return bdlt::CurrentTime::now();
+}
+
+void Timer::arrive(const bsl::shared_ptr<ntci::Timer>&,
+                   const bsls::TimeInterval&,
+                   const bsls::TimeInterval&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void* Timer::handle() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+int Timer::id() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bool Timer::oneShot() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return true;
+}
+
+bslmt::ThreadUtil::Handle Timer::threadHandle() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bslmt::ThreadUtil::invalidHandle();
+}
+
+bsl::size_t Timer::threadIndex() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+Resolver::Resolver(bslma::Allocator* basicAllocator)
+: d_mutex()
+, d_timerList(basicAllocator)
+, d_strand_sp()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+Resolver::~Resolver()
+{
+}
+
+bsl::shared_ptr<ntci::Timer> Resolver::createTimer(
+    const ntca::TimerOptions&  options,
+    const ntci::TimerCallback& callback,
+    bslma::Allocator*          basicAllocator)
+{
+    NTCCFG_TEST_TRUE(options.oneShot());
+
+    bslma::Allocator* allocator = bslma::Default::allocator(basicAllocator);
+
+    bsl::shared_ptr<test::Timer> timer;
+    timer.createInplace(allocator, callback, allocator);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_timerList.push_back(timer);
+
+    return timer;
+}
+
+void Resolver::expire(bsl::size_t index)
+{
+    this->timer(index)->expire();
+}
+
+bsl::size_t Resolver::numTimers() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_timerList.size();
+}
+
+bsl::shared_ptr<test::Timer> Resolver::timer(bsl::size_t index) const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    BSLS_ASSERT_OPT(index < d_timerList.size());
+    return d_timerList[index];
+}
+
+const bsl::shared_ptr<ntci::Strand>& Resolver::strand() const
+{
+    return d_strand_sp;
+}
+
+bsls::TimeInterval Resolver::currentTime() const
+{
+    return bdlt::CurrentTime::now();
+}
+
+ntsa::Error Resolver::start()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+void Resolver::shutdown()
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void Resolver::linger()
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+ntsa::Error Resolver::setIpAddress(const bslstl::StringRef&,
+                                   const bsl::vector<ntsa::IpAddress>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Resolver::addIpAddress(const bslstl::StringRef&,
+                                   const bsl::vector<ntsa::IpAddress>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Resolver::addIpAddress(const bslstl::StringRef&,
+                                   const ntsa::IpAddress&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Resolver::setPort(const bslstl::StringRef&,
+                              const bsl::vector<ntsa::Port>&,
+                              ntsa::Transport::Value)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Resolver::addPort(const bslstl::StringRef&,
+                              const bsl::vector<ntsa::Port>&,
+                              ntsa::Transport::Value)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Resolver::addPort(const bslstl::StringRef&,
+                              ntsa::Port,
+                              ntsa::Transport::Value)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Resolver::setLocalIpAddress(const bsl::vector<ntsa::IpAddress>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Resolver::setHostname(const bsl::string&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Resolver::setHostnameFullyQualified(const bsl::string&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Resolver::getIpAddress(const bslstl::StringRef&,
+                                   const ntca::GetIpAddressOptions&,
+                                   const ntci::GetIpAddressCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Resolver::getDomainName(const ntsa::IpAddress&,
+                                    const ntca::GetDomainNameOptions&,
+                                    const ntci::GetDomainNameCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Resolver::getPort(const bslstl::StringRef&,
+                              const ntca::GetPortOptions&,
+                              const ntci::GetPortCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Resolver::getServiceName(ntsa::Port,
+                                     const ntca::GetServiceNameOptions&,
+                                     const ntci::GetServiceNameCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Resolver::getEndpoint(const bslstl::StringRef&,
+                                  const ntca::GetEndpointOptions&,
+                                  const ntci::GetEndpointCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Resolver::getServiceEndpoints(
+    const bslstl::StringRef&,
+    const ntca::GetServiceEndpointsOptions&,
+    const ntci::GetServiceEndpointsCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Resolver::getLocalIpAddress(bsl::vector<ntsa::IpAddress>*,
+                                        const ntsa::IpAddressOptions&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Resolver::getHostname(bsl::string*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Resolver::getHostnameFullyQualified(bsl::string*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+void Resolver::execute(const Functor&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void Resolver::moveAndExecute(FunctorSequence*, const Functor&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+bsl::shared_ptr<ntci::Strand> Resolver::createStrand(bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Strand>();
+}
+
+bsl::shared_ptr<ntci::Timer> Resolver::createTimer(
+    const ntca::TimerOptions&,
+    const bsl::shared_ptr<ntci::TimerSession>&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Timer>();
+}
+
+GetIpAddressResult::GetIpAddressResult()
+: d_numCallbacks(0)
+, d_eventType(ntca::GetIpAddressEventType::e_ERROR)
+, d_ipAddressList()
+, d_error()
+{
+}
+
+void processGetIpAddress(const bsl::shared_ptr<ntci::Resolver>& resolver,
+                         const bsl::vector<ntsa::IpAddress>&    ipAddressList,
+                         const ntca::GetIpAddressEvent&         event,
+                         test::GetIpAddressResult*              result)
+{
+    NTCCFG_WARNING_UNUSED(resolver);
+
+    ++result->d_numCallbacks;
+    result->d_eventType     = event.type();
+    result->d_ipAddressList = ipAddressList;
+    result->d_error         = event.context().error();
+}
+
+void processConnect(const ntci::ConnectCallback&            callback,
+                    const bsl::shared_ptr<ntci::Connector>& connector,
+                    const ntca::ConnectEvent&               event)
+{
+    callback(connector, event, ntci::Strand::unknown());
+}
+
+ntcdns::ClientConfig createClientConfig()
+{
+    ntcdns::ClientConfig clientConfig;
+
+    ntcdns::NameServerConfig nameServerConfig;
+    nameServerConfig.address().host() = "10.0.0.53";
+    nameServerConfig.address().port().makeValue(53);
+
+    clientConfig.nameServer().push_back(nameServerConfig);
+    clientConfig.search().push_back("example.net");
+
+    return clientConfig;
+}
+
+}  // close namespace test
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: Concurrent requests to get the IP addresses assigned to the
+    // same name with the same options result in exactly one query, and
+    // every request completes with its result.
+    //
+    // Plan: Issue several requests for the same name before the stub name
+    // server answers. Ensure exactly one query is received, then answer it
+    // and ensure every callback is invoked exactly once with the result.
+    // Then issue a request for the same name with no deadline and two
+    // requests with a deadline, and ensure all three are coalesced into one
+    // query. Expire the deadline of the first bounded request and ensure
+    // only that request fails, then answer the query and ensure the other
+    // two complete.
+
+    const bsl::size_t k_NUM_REQUESTS = 8;
+
+    ntsa::Error error;
+
+    ntccfg::TestAllocator ta;
+    {
+        bsl::shared_ptr<test::NameServer> nameServer;
+        nameServer.createInplace(&ta, &ta);
+
+        nameServer->setHost("test.example.net",
+                            ntsa::IpAddress("192.168.0.100"));
+
+        bsl::shared_ptr<ntcdns::Client> client;
+        client.createInplace(&ta,
+                             test::createClientConfig(),
+                             bsl::shared_ptr<ntcdns::Cache>(),
+                             nameServer,
+                             nameServer,
+                             &ta);
+
+        error = client->start();
+        NTCCFG_TEST_OK(error);
+
+        ntca::GetIpAddressOptions options;
+        options.setIpAddressType(ntsa::IpAddressType::e_V4);
+
+        bsl::vector<test::GetIpAddressResult> resultList(k_NUM_REQUESTS,
+                                                         &ta);
+
+        for (bsl::size_t i = 0; i < k_NUM_REQUESTS; ++i) {
+            ntci::GetIpAddressCallback callback(
+                bdlf::BindUtil::bind(&test::processGetIpAddress,
+                                     bdlf::PlaceHolders::_1,
+                                     bdlf::PlaceHolders::_2,
+                                     bdlf::PlaceHolders::_3,
+                                     &resultList[i]),
+                &ta);
+
+            error = client->getIpAddress(bsl::shared_ptr<ntci::Resolver>(),
+                                         "test.example.net",
+                                         options,
+                                         callback);
+            NTCCFG_TEST_OK(error);
+        }
+
+        nameServer->drain();
+
+        NTCCFG_TEST_EQ(nameServer->numQueries(), 1);
+        NTCCFG_TEST_EQ(nameServer->query(0).d_name, "test.example.net");
+        NTCCFG_TEST_EQ(nameServer->query(0).d_type, ntcdns::Type::e_A);
+
+        for (bsl::size_t i = 0; i < k_NUM_REQUESTS; ++i) {
+            NTCCFG_TEST_EQ(resultList[i].d_numCallbacks, 0);
+        }
+
+        nameServer->respondAll();
+        nameServer->drain();
+
+        for (bsl::size_t i = 0; i < k_NUM_REQUESTS; ++i) {
+            NTCCFG_TEST_EQ(resultList[i].d_numCallbacks, 1);
+            NTCCFG_TEST_EQ(resultList[i].d_eventType,
+                           ntca::GetIpAddressEventType::e_COMPLETE);
+            NTCCFG_TEST_EQ(resultList[i].d_ipAddressList.size(), 1);
+            NTCCFG_TEST_EQ(resultList[i].d_ipAddressList[0],
+                           ntsa::IpAddress("192.168.0.100"));
+        }
+
+        // Requests subject to different deadlines are coalesced, and the
+        // deadline of each request fails only that request.
+
+        bsl::shared_ptr<test::Resolver> resolver;
+        resolver.createInplace(&ta, &ta);
+
+        ntca::GetIpAddressOptions boundedOptions = options;
+        boundedOptions.setDeadline(bdlt::CurrentTime::now() +
+                                   bsls::TimeInterval(60, 0));
+
+        test::GetIpAddressResult unboundedResult;
+        test::GetIpAddressResult firstBoundedResult;
+        test::GetIpAddressResult secondBoundedResult;
+
+        test::GetIpAddressResult* k_RESULTS[3] = {&unboundedResult,
+                                                  &firstBoundedResult,
+                                                  &secondBoundedResult};
+
+        for (bsl::size_t i = 0; i < 3; ++i) {
+            ntci::GetIpAddressCallback callback(
+                bdlf::BindUtil::bind(&test::processGetIpAddress,
+                                     bdlf::PlaceHolders::_1,
+                                     bdlf::PlaceHolders::_2,
+                                     bdlf::PlaceHolders::_3,
+                                     k_RESULTS[i]),
+                &ta);
+
+            error = client->getIpAddress(resolver,
+                                         "test.example.net",
+                                         i == 0 ? options : boundedOptions,
+                                         callback);
+            NTCCFG_TEST_OK(error);
+        }
+
+        nameServer->drain();
+
+        NTCCFG_TEST_EQ(nameServer->numQueries(), 2);
+        NTCCFG_TEST_EQ(resolver->numTimers(), 2);
+
+        // The first deadline fails only the first bounded request.
+
+        resolver->expire(0);
+
+        NTCCFG_TEST_EQ(unboundedResult.d_numCallbacks, 0);
+        NTCCFG_TEST_EQ(secondBoundedResult.d_numCallbacks, 0);
+
+        NTCCFG_TEST_EQ(firstBoundedResult.d_numCallbacks, 1);
+        NTCCFG_TEST_EQ(firstBoundedResult.d_eventType,
+                       ntca::GetIpAddressEventType::e_ERROR);
+        NTCCFG_TEST_EQ(firstBoundedResult.d_error,
+                       ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+        // The response completes the remaining requests.
+
+        nameServer->respond(1);
+        nameServer->drain();
+
+        NTCCFG_TEST_EQ(unboundedResult.d_numCallbacks, 1);
+        NTCCFG_TEST_EQ(unboundedResult.d_eventType,
+                       ntca::GetIpAddressEventType::e_COMPLETE);
+
+        NTCCFG_TEST_EQ(secondBoundedResult.d_numCallbacks, 1);
+        NTCCFG_TEST_EQ(secondBoundedResult.d_eventType,
+                       ntca::GetIpAddressEventType::e_COMPLETE);
+
+        NTCCFG_TEST_EQ(firstBoundedResult.d_numCallbacks, 1);
+
+        // The deadline of a completed request is closed and has no effect.
+
+        NTCCFG_TEST_TRUE(resolver->timer(1)->isClosed());
+
+        resolver->expire(1);
+
+        NTCCFG_TEST_EQ(secondBoundedResult.d_numCallbacks, 1);
+
+        // Stop the client.
+
+        client->shutdown();
+        nameServer->drain();
+        client->linger();
+
+        client.reset();
+
+        nameServer->clear();
+
+        resolver.reset();
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(3)
+{
+    // Concern: A response truncated over a datagram socket is retried over
+    // a stream socket, and that stream socket is reused for subsequent
+    // queries.
+    //
+    // Plan: Configure the stub name server to truncate each response to a
+    // query received over a datagram socket. Get the IP addresses assigned
+    // to a name, and ensure the query is sent again over a newly-connected
+    // stream socket, whose answer completes the request. Then get the IP
+    // addresses assigned to a different name, and ensure that query is
+    // retried over the same stream socket.
+
+    ntsa::Error error;
+
+    ntccfg::TestAllocator ta;
+    {
+        bsl::shared_ptr<test::NameServer> nameServer;
+        nameServer.createInplace(&ta, &ta);
+
+        nameServer->setHost("first.example.net",
+                            ntsa::IpAddress("192.168.0.101"));
+        nameServer->setHost("second.example.net",
+                            ntsa::IpAddress("192.168.0.102"));
+
+        nameServer->setTruncated(true);
+
+        bsl::shared_ptr<ntcdns::Client> client;
+        client.createInplace(&ta,
+                             test::createClientConfig(),
+                             bsl::shared_ptr<ntcdns::Cache>(),
+                             nameServer,
+                             nameServer,
+                             &ta);
+
+        error = client->start();
+        NTCCFG_TEST_OK(error);
+
+        ntca::GetIpAddressOptions options;
+        options.setIpAddressType(ntsa::IpAddressType::e_V4);
+
+        const char* k_NAMES[2] = {"first.example.net", "second.example.net"};
+
+        const char* k_ADDRESSES[2] = {"192.168.0.101", "192.168.0.102"};
+
+        for (bsl::size_t i = 0; i < 2; ++i) {
+            test::GetIpAddressResult result;
+
+            ntci::GetIpAddressCallback callback(
+                bdlf::BindUtil::bind(&test::processGetIpAddress,
+                                     bdlf::PlaceHolders::_1,
+                                     bdlf::PlaceHolders::_2,
+                                     bdlf::PlaceHolders::_3,
+                                     &result),
+                &ta);
+
+            error = client->getIpAddress(bsl::shared_ptr<ntci::Resolver>(),
+                                         k_NAMES[i],
+                                         options,
+                                         callback);
+            NTCCFG_TEST_OK(error);
+
+            nameServer->drain();
+
+            // The query is first received over a datagram socket.
+
+            const bsl::size_t datagramIndex = 2 * i;
+
+            NTCCFG_TEST_EQ(nameServer->numQueries(), datagramIndex + 1);
+            NTCCFG_TEST_TRUE(
+                nameServer->query(datagramIndex).d_datagramSocket_sp);
+            NTCCFG_TEST_EQ(nameServer->query(datagramIndex).d_name,
+                           k_NAMES[i]);
+
+            nameServer->respond(datagramIndex);
+            nameServer->drain();
+
+            // The truncated response causes the query to be sent again over
+            // the stream socket, which is connected only once.
+
+            const bsl::size_t streamIndex = 2 * i + 1;
+
+            NTCCFG_TEST_EQ(nameServer->numQueries(), streamIndex + 1);
+            NTCCFG_TEST_TRUE(nameServer->query(streamIndex).d_streamSocket_sp);
+            NTCCFG_TEST_EQ(nameServer->query(streamIndex).d_name, k_NAMES[i]);
+            NTCCFG_TEST_EQ(nameServer->numStreamSockets(), 1);
+
+            if (i > 0) {
+                NTCCFG_TEST_EQ(
+                    nameServer->query(streamIndex).d_streamSocket_sp,
+                    nameServer->query(1).d_streamSocket_sp);
+            }
+
+            NTCCFG_TEST_EQ(result.d_numCallbacks, 0);
+
+            nameServer->respond(streamIndex);
+            nameServer->drain();
+
+            NTCCFG_TEST_EQ(result.d_numCallbacks, 1);
+            NTCCFG_TEST_EQ(result.d_eventType,
+                           ntca::GetIpAddressEventType::e_COMPLETE);
+            NTCCFG_TEST_EQ(result.d_ipAddressList.size(), 1);
+            NTCCFG_TEST_EQ(result.d_ipAddressList[0],
+                           ntsa::IpAddress(k_ADDRESSES[i]));
+        }
+
+        NTCCFG_TEST_EQ(nameServer->numStreamSockets(), 1);
+
+        // Stop the client.
+
+        client->shutdown();
+        nameServer->drain();
+        client->linger();
+
+        client.reset();
+
+        nameServer->clear();
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(4)
+{
+    // Concern: Requests sent over UDP are distributed across the configured
+    // number of datagram sockets, and each response is matched only against
+    // the requests sent through the socket on which it arrives.
+    //
+    // Plan: Configure the client to send requests through a pool of three
+    // datagram sockets, and get the IP addresses assigned to six different
+    // names. Ensure three sockets are created and each receives two
+    // queries. Forge a response to each query on a socket other than the
+    // one through which it was sent, and ensure it is ignored. Then answer
+    // each query through the socket that received it, and ensure each
+    // request completes with its own result.
+
+    const bsl::size_t k_NUM_CHANNELS = 3;
+    const bsl::size_t k_NUM_REQUESTS = 6;
+
+    ntsa::Error error;
+
+    ntccfg::TestAllocator ta;
+    {
+        bsl::shared_ptr<test::NameServer> nameServer;
+        nameServer.createInplace(&ta, &ta);
+
+        bsl::vector<bsl::string>     nameList(&ta);
+        bsl::vector<ntsa::IpAddress> ipAddressList(&ta);
+
+        for (bsl::size_t i = 0; i < k_NUM_REQUESTS; ++i) {
+            bsl::stringstream ss;
+            ss << "host" << i << ".example.net";
+
+            bsl::stringstream ipss;
+            ipss << "192.168.1." << (100 + i);
+
+            nameList.push_back(ss.str());
+            ipAddressList.push_back(ntsa::IpAddress(ipss.str()));
+
+            nameServer->setHost(nameList.back(), ipAddressList.back());
+        }
+
+        bsl::shared_ptr<ntcdns::Client> client;
+        client.createInplace(&ta,
+                             test::createClientConfig(),
+                             bsl::shared_ptr<ntcdns::Cache>(),
+                             nameServer,
+                             nameServer,
+                             &ta);
+
+        error = client->setDatagramChannelCount(0);
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_INVALID));
+
+        error = client->setDatagramChannelCount(k_NUM_CHANNELS);
+        NTCCFG_TEST_OK(error);
+
+        error = client->start();
+        NTCCFG_TEST_OK(error);
+
+        error = client->setDatagramChannelCount(k_NUM_CHANNELS + 1);
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_INVALID));
+
+        ntca::GetIpAddressOptions options;
+        options.setIpAddressType(ntsa::IpAddressType::e_V4);
+
+        bsl::vector<test::GetIpAddressResult> resultList(k_NUM_REQUESTS,
+                                                         &ta);
+
+        for (bsl::size_t i = 0; i < k_NUM_REQUESTS; ++i) {
+            ntci::GetIpAddressCallback callback(
+                bdlf::BindUtil::bind(&test::processGetIpAddress,
+                                     bdlf::PlaceHolders::_1,
+                                     bdlf::PlaceHolders::_2,
+                                     bdlf::PlaceHolders::_3,
+                                     &resultList[i]),
+                &ta);
+
+            error = client->getIpAddress(bsl::shared_ptr<ntci::Resolver>(),
+                                         nameList[i],
+                                         options,
+                                         callback);
+            NTCCFG_TEST_OK(error);
+        }
+
+        nameServer->drain();
+
+        NTCCFG_TEST_EQ(nameServer->numQueries(), k_NUM_REQUESTS);
+        NTCCFG_TEST_EQ(nameServer->numDatagramSockets(), k_NUM_CHANNELS);
+
+        // Each socket in the pool receives an equal share of the queries.
+
+        bsl::map<ntsa::Handle, bsl::size_t> queryCountMap(&ta);
+        bsl::map<bsl::string, bsl::size_t>  queryIndexMap(&ta);
+
+        for (bsl::size_t i = 0; i < k_NUM_REQUESTS; ++i) {
+            test::NameServer::Query query = nameServer->query(i);
+            NTCCFG_TEST_TRUE(query.d_datagramSocket_sp);
+
+            ++queryCountMap[query.d_datagramSocket_sp->handle()];
+            queryIndexMap[query.d_name] = i;
+        }
+
+        NTCCFG_TEST_EQ(queryCountMap.size(), k_NUM_CHANNELS);
+        NTCCFG_TEST_EQ(queryIndexMap.size(), k_NUM_REQUESTS);
+
+        for (bsl::map<ntsa::Handle, bsl::size_t>::const_iterator it =
+                 queryCountMap.begin();
+             it != queryCountMap.end();
+             ++it)
+        {
+            NTCCFG_TEST_EQ(it->second, k_NUM_REQUESTS / k_NUM_CHANNELS);
+        }
+
+        // A response arriving on a socket other than the one through which
+        // its query was sent is ignored, even though its transaction ID
+        // matches an outstanding request.
+
+        for (bsl::size_t i = 0; i < k_NUM_REQUESTS; ++i) {
+            test::NameServer::Query query = nameServer->query(i);
+
+            bsl::shared_ptr<test::DatagramSocket> otherSocket;
+            for (bsl::size_t j = 0; j < k_NUM_REQUESTS; ++j) {
+                test::NameServer::Query other = nameServer->query(j);
+                if (other.d_datagramSocket_sp != query.d_datagramSocket_sp) {
+                    otherSocket = other.d_datagramSocket_sp;
+                    break;
+                }
+            }
+
+            NTCCFG_TEST_TRUE(otherSocket);
+
+            nameServer->respond(i,
+                                otherSocket,
+                                ntsa::IpAddress("10.0.0.1"));
+        }
+
+        nameServer->drain();
+
+        for (bsl::size_t i = 0; i < k_NUM_REQUESTS; ++i) {
+            NTCCFG_TEST_EQ(resultList[i].d_numCallbacks, 0);
+        }
+
+        // A response arriving on the socket through which its query was sent
+        // completes the request.
+
+        nameServer->respondAll();
+        nameServer->drain();
+
+        for (bsl::size_t i = 0; i < k_NUM_REQUESTS; ++i) {
+            NTCCFG_TEST_EQ(resultList[i].d_numCallbacks, 1);
+            NTCCFG_TEST_EQ(resultList[i].d_eventType,
+                           ntca::GetIpAddressEventType::e_COMPLETE);
+            NTCCFG_TEST_EQ(resultList[i].d_ipAddressList.size(), 1);
+            NTCCFG_TEST_EQ(resultList[i].d_ipAddressList[0],
+                           ipAddressList[i]);
+        }
+
+        // Stop the client.
+
+        client->shutdown();
+        nameServer->drain();
+        client->linger();
+
+        client.reset();
+
+        nameServer->clear();
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+    NTCCFG_TEST_REGISTER(3);
+    NTCCFG_TEST_REGISTER(4);
+}
+NTCCFG_TEST_DRIVER_END;
@@ -17,16 +17,22 @@
 
 #include <ntcdns_compat.h>
 #include <ntcdns_utility.h>
+#include <ntccfg_limits.h>
 #include <ntci_log.h>
+#include <ntcs_threadutil.h>
 #include <ntsa_host.h>
 #include <ntsu_resolverutil.h>
 #include <bdlb_chartype.h>
+#include <bdlf_bind.h>
+#include <bdlt_currenttime.h>
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bslmt_lockguard.h>
+#include <bslmt_threadattributes.h>
 #include <bsls_assert.h>
 #include <bsls_stopwatch.h>
 #include <bsls_timeinterval.h>
+#include <bsl_algorithm.h>
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 
@@ -482,6 +488,63 @@ bool Scanner::isSlash(char current) const
     return current == '/';
 }
 
+/// Sort the specified 'entries' by key according to the specified 'less'
+/// functor, then remove each entry having the same key as a preceding entry,
+/// so that only the first entry for each key, in original order, remains.
+template <typename ENTRY, typename LESS>
+void indexFirstByKey(bsl::vector<ENTRY>* entries, LESS less)
+{
+    bsl::stable_sort(entries->begin(), entries->end(), less);
+
+    bsl::size_t numUnique = 0;
+    for (bsl::size_t i = 0; i < entries->size(); ++i) {
+        const ENTRY entry = (*entries)[i];
+        if (numUnique == 0 || less((*entries)[numUnique - 1], entry)) {
+            (*entries)[numUnique++] = entry;
+        }
+    }
+
+    entries->resize(numUnique);
+}
+
+/// Sort the specified 'entries' by key according to the specified 'less'
+/// functor, preserving the original order of the entries having the same
+/// key, then remove each entry having the same key and the same value,
+/// according to the specified 'valueLess' functor, as a preceding entry.
+template <typename ENTRY, typename LESS, typename VALUE_LESS>
+void indexAllByKey(bsl::vector<ENTRY>* entries,
+                   LESS                less,
+                   VALUE_LESS          valueLess)
+{
+    bsl::stable_sort(entries->begin(), entries->end(), less);
+
+    bsl::size_t numUnique = 0;
+    bsl::size_t group     = 0;
+    for (bsl::size_t i = 0; i < entries->size(); ++i) {
+        const ENTRY entry = (*entries)[i];
+
+        if (numUnique == 0 || less((*entries)[group], entry)) {
+            group = numUnique;
+        }
+
+        bool duplicate = false;
+        for (bsl::size_t j = group; j < numUnique; ++j) {
+            if (!valueLess((*entries)[j], entry) &&
+                !valueLess(entry, (*entries)[j]))
+            {
+                duplicate = true;
+                break;
+            }
+        }
+
+        if (!duplicate) {
+            (*entries)[numUnique++] = entry;
+        }
+    }
+
+    entries->resize(numUnique);
+}
+
 }  // close unnamed namespace
 
 bsl::size_t HostDatabaseUtil::hashIpv6(const ntsa::Ipv6Address& ipv6Address)
@@ -498,20 +561,167 @@ bsl::size_t HostDatabaseUtil::hashIpv6(const ntsa::Ipv6Address& ipv6Address)
     return result;
 }
 
-ntsa::Error HostDatabase::load(const bsl::shared_ptr<ntcdns::File>& file)
+void* DatabaseReloader::run(DatabaseReloader* reloader)
+{
+    bslmt::ThreadUtil::setThreadName(reloader->d_threadName);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&reloader->d_mutex);
+
+    while (!reloader->d_stop) {
+        const bsls::TimeInterval deadline =
+            bdlt::CurrentTime::now() + reloader->d_interval;
+
+        while (!reloader->d_stop && bdlt::CurrentTime::now() < deadline) {
+            reloader->d_condition.timedWait(&reloader->d_mutex, deadline);
+        }
+
+        if (reloader->d_stop) {
+            break;
+        }
+
+        {
+            bslmt::LockGuardUnlock<bslmt::Mutex> unlock(&reloader->d_mutex);
+            reloader->d_function();
+        }
+    }
+
+    return 0;
+}
+
+void DatabaseReloader::stop()
+{
+    bslmt::ThreadUtil::Handle threadHandle;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (!d_running) {
+            return;
+        }
+
+        d_stop         = true;
+        d_running      = false;
+        threadHandle   = d_threadHandle;
+        d_threadHandle = bslmt::ThreadUtil::invalidHandle();
+
+        d_condition.signal();
+    }
+
+    ntcs::ThreadUtil::join(threadHandle);
+}
+
+DatabaseReloader::DatabaseReloader(const bslstl::StringRef& threadName,
+                                   const Function&          function,
+                                   bslma::Allocator*        basicAllocator)
+: d_controlMutex()
+, d_mutex()
+, d_condition()
+, d_threadHandle(bslmt::ThreadUtil::invalidHandle())
+, d_threadName(threadName, basicAllocator)
+, d_function(bsl::allocator_arg, basicAllocator, function)
+, d_interval()
+, d_running(false)
+, d_stop(false)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+DatabaseReloader::~DatabaseReloader()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_controlMutex);
+    this->stop();
+}
+
+void DatabaseReloader::setInterval(const bsls::TimeInterval& value)
+{
+    NTCI_LOG_CONTEXT();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_controlMutex);
+
+    this->stop();
+
+    if (value <= bsls::TimeInterval()) {
+        return;
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    d_interval = value;
+    d_stop     = false;
+
+    bslmt::ThreadAttributes threadAttributes;
+    threadAttributes.setThreadName(d_threadName);
+    threadAttributes.setDetachedState(
+        bslmt::ThreadAttributes::e_CREATE_JOINABLE);
+    threadAttributes.setStackSize(NTCCFG_DEFAULT_STACK_SIZE);
+
+    bslmt::ThreadUtil::ThreadFunction threadFunction =
+        (bslmt::ThreadUtil::ThreadFunction)(&DatabaseReloader::run);
+    void* threadUserData = this;
+
+    ntsa::Error error = ntcs::ThreadUtil::create(&d_threadHandle,
+                                                 threadAttributes,
+                                                 threadFunction,
+                                                 threadUserData);
+    if (error) {
+        NTCI_LOG_STREAM_ERROR << "Failed to create database reloader thread: "
+                              << error << NTCI_LOG_STREAM_END;
+        return;
+    }
+
+    d_running = true;
+}
+
+struct HostDatabase::EntryByDomainName {
+    bool operator()(const Entry& lhs, const Entry& rhs) const
+    {
+        return lhs.d_domainName < rhs.d_domainName;
+    }
+
+    bool operator()(const Entry& lhs, const bslstl::StringRef& rhs) const
+    {
+        return lhs.d_domainName < rhs;
+    }
+
+    bool operator()(const bslstl::StringRef& lhs, const Entry& rhs) const
+    {
+        return lhs < rhs.d_domainName;
+    }
+};
+
+struct HostDatabase::EntryByIpAddress {
+    bool operator()(const Entry& lhs, const Entry& rhs) const
+    {
+        return lhs.d_ipAddress < rhs.d_ipAddress;
+    }
+};
+
+HostDatabase::Index::Index(bslma::Allocator* basicAllocator)
+: d_file_sp()
+, d_fileStamp()
+, d_entryByDomainName(basicAllocator)
+, d_domainNameByIpAddress(basicAllocator)
+{
+}
+
+ntsa::Error HostDatabase::load(const bsl::shared_ptr<ntcdns::File>& file,
+                               const ntcdns::FileStamp&             fileStamp)
+    const
 {
     bsls::Stopwatch stopwatch;
     stopwatch.start();
 
     Scanner scanner(file->data(), file->size());
 
-    IpAddressByDomainName ipAddressByDomainName(d_allocator_p);
-    DomainNameByIpAddress domainNameByIpAddress(d_allocator_p);
+    bsl::shared_ptr<Index> index;
+    index.createInplace(d_allocator_p, d_allocator_p);
 
-    if (file->size() > 1024 * 1024) {
-        ipAddressByDomainName.reserve(1024 * 1024);
-        domainNameByIpAddress.reserve(1024 * 1024);
-    }
+    index->d_file_sp   = file;
+    index->d_fileStamp = fileStamp;
+
+    EntryVector&           entryByDomainName = index->d_entryByDomainName;
+    DomainNameByIpAddress& domainNameByIpAddress =
+        index->d_domainNameByIpAddress;
 
     char        current = 0;
     bsl::size_t lines   = 0;
@@ -581,24 +791,32 @@ ntsa::Error HostDatabase::load(const bsl::shared_ptr<ntcdns::File>& file)
             bslstl::StringRef domainNameStringRef(domainNameBegin,
                                                   domainNameEnd);
 
-            IpAddressArray& ipAddressArray =
-                ipAddressByDomainName[domainNameStringRef];
-            if (bsl::find(ipAddressArray.begin(),
-                          ipAddressArray.end(),
-                          ipAddress) == ipAddressArray.end())
-            {
-                ipAddressArray.push_back(ipAddress);
-            }
+            Entry entry;
+            entry.d_domainName = domainNameStringRef;
+            entry.d_ipAddress  = ipAddress;
 
-            bslstl::StringRef& domainName = domainNameByIpAddress[ipAddress];
-            if (domainName.empty()) {
-                domainName = domainNameStringRef;
-            }
+            entryByDomainName.push_back(entry);
         }
 
         ++lines;
     }
 
+    // Index the domain name of each IP address, which is the first domain
+    // name to which the IP address is assigned in the file, and the IP
+    // addresses of each domain name, in the order they are assigned in the
+    // file.
+
+    domainNameByIpAddress.reserve(entryByDomainName.size());
+
+    for (EntryVector::const_iterator it = entryByDomainName.begin();
+         it != entryByDomainName.end();
+         ++it)
+    {
+        domainNameByIpAddress.add(it->d_ipAddress, it->d_domainName);
+    }
+
+    indexAllByKey(&entryByDomainName, EntryByDomainName(), EntryByIpAddress());
+
     stopwatch.stop();
 
 #if NTCDNS_DATABASE_DEBUG_COUT
@@ -610,38 +828,103 @@ ntsa::Error HostDatabase::load(const bsl::shared_ptr<ntcdns::File>& file)
         << " milliseconds" << bsl::endl;
 #endif
 
+    // Replace the current index. The previous index, if any, is destroyed
+    // after the mutex is released, once each lookup still using it
+    // completes.
+
+    bsl::shared_ptr<const Index> previous = index;
+
     {
         bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        d_index_sp.swap(previous);
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error HostDatabase::privateReload(
+    const bsl::shared_ptr<const Index>& index) const
+{
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    if (!index || index->d_file_sp->path().empty()) {
+        return ntsa::Error();
+    }
+
+    const bsl::string path = index->d_file_sp->path();
+
+    ntcdns::FileStamp fileStamp;
+    error = fileStamp.load(path);
+    if (error) {
+        return error;
+    }
 
-        d_ipAddressByDomainName.swap(ipAddressByDomainName);
-        d_domainNameByIpAddress.swap(domainNameByIpAddress);
-        d_file_sp = file;
+    if (fileStamp == index->d_fileStamp) {
+        return ntsa::Error();
     }
 
+    bsl::shared_ptr<ntcdns::File> file;
+    file.createInplace(d_allocator_p, d_allocator_p);
+
+    error = file->load(path);
+    if (error) {
+        NTCI_LOG_STREAM_ERROR << "Failed to reload host database '" << path
+                              << "': " << error << NTCI_LOG_STREAM_END;
+        return error;
+    }
+
+    error = this->load(file, fileStamp);
+    if (error) {
+        NTCI_LOG_STREAM_ERROR << "Failed to parse host database '" << path
+                              << "': " << error << NTCI_LOG_STREAM_END;
+        return error;
+    }
+
+    NTCI_LOG_STREAM_DEBUG << "Reloaded modified host database '" << path
+                          << "'" << NTCI_LOG_STREAM_END;
+
     return ntsa::Error();
 }
 
+void HostDatabase::privateReloadInterval()
+{
+    this->reload();
+}
+
+bsl::shared_ptr<const HostDatabase::Index> HostDatabase::privateAcquire()
+    const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_index_sp;
+}
+
 HostDatabase::HostDatabase(bslma::Allocator* basicAllocator)
 : d_mutex()
-, d_pool(8, basicAllocator)
-, d_ipAddressByDomainName(&d_pool)
-, d_domainNameByIpAddress(&d_pool)
-, d_file_sp()
-, d_allocator_p(&d_pool)
+, d_index_sp()
+, d_reloadMutex()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_reloader("ntcdns-hosts",
+             bdlf::BindUtil::bind(&HostDatabase::privateReloadInterval,
+                                  this),
+             basicAllocator)
 {
 }
 
 HostDatabase::~HostDatabase()
 {
+    d_reloader.setInterval(bsls::TimeInterval());
 }
 
 void HostDatabase::clear()
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    bsl::shared_ptr<const Index> previous;
 
-    d_ipAddressByDomainName.clear();
-    d_domainNameByIpAddress.clear();
-    d_file_sp.reset();
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_index_sp.swap(previous);
+    }
 }
 
 ntsa::Error HostDatabase::load()
@@ -665,6 +948,12 @@ ntsa::Error HostDatabase::loadPath(const bslstl::StringRef& path)
 
     ntsa::Error error;
 
+    ntcdns::FileStamp fileStamp;
+    error = fileStamp.load(path);
+    if (error) {
+        fileStamp.reset();
+    }
+
     bsl::shared_ptr<ntcdns::File> file;
     file.createInplace(d_allocator_p, d_allocator_p);
 
@@ -675,7 +964,7 @@ ntsa::Error HostDatabase::loadPath(const bslstl::StringRef& path)
         return error;
     }
 
-    error = this->load(file);
+    error = this->load(file, fileStamp);
     if (error) {
         NTCI_LOG_STREAM_ERROR << "Failed to parse host database '" << path
                               << "': " << error << NTCI_LOG_STREAM_END;
@@ -701,7 +990,7 @@ ntsa::Error HostDatabase::loadText(const char* data, bsl::size_t size)
         return error;
     }
 
-    error = this->load(file);
+    error = this->load(file, ntcdns::FileStamp());
     if (error) {
         NTCI_LOG_STREAM_ERROR << "Failed to parse host database: " << error
                               << NTCI_LOG_STREAM_END;
@@ -711,6 +1000,21 @@ ntsa::Error HostDatabase::loadText(const char* data, bsl::size_t size)
     return ntsa::Error();
 }
 
+ntsa::Error HostDatabase::reload()
+{
+    // Serialize reloads so that a reload never replaces the index with one
+    // built from an older version of the file.
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_reloadMutex);
+
+    return this->privateReload(this->privateAcquire());
+}
+
+void HostDatabase::setReloadInterval(const bsls::TimeInterval& value)
+{
+    d_reloader.setInterval(value);
+}
+
 ntsa::Error HostDatabase::getIpAddress(
     ntca::GetIpAddressContext*       context,
     bsl::vector<ntsa::IpAddress>*    result,
@@ -727,29 +1031,30 @@ ntsa::Error HostDatabase::getIpAddress(
     }
 
     {
-        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-
-        IpAddressByDomainName::const_iterator it =
-            d_ipAddressByDomainName.find(domainName);
-
-        if (it == d_ipAddressByDomainName.end()) {
+        bsl::shared_ptr<const Index> index = this->privateAcquire();
+        if (!index) {
             return ntsa::Error(ntsa::Error::e_EOF);
         }
 
-        if (ipAddressType.isNull()) {
-            ipAddressList.assign(it->second.begin(), it->second.end());
+        bsl::pair<EntryVector::const_iterator, EntryVector::const_iterator>
+            range = bsl::equal_range(index->d_entryByDomainName.begin(),
+                                     index->d_entryByDomainName.end(),
+                                     domainName,
+                                     EntryByDomainName());
+
+        if (range.first == range.second) {
+            return ntsa::Error(ntsa::Error::e_EOF);
         }
-        else {
-            const IpAddressArray& target = it->second;
 
-            for (IpAddressArray::const_iterator jt = target.begin();
-                 jt != target.end();
-                 ++jt)
+        for (EntryVector::const_iterator it = range.first;
+             it != range.second;
+             ++it)
+        {
+            const ntsa::IpAddress& ipAddress = it->d_ipAddress;
+            if (ipAddressType.isNull() ||
+                ipAddress.type() == ipAddressType.value())
             {
-                const ntsa::IpAddress& ipAddress = *jt;
-                if (ipAddress.type() == ipAddressType.value()) {
-                    ipAddressList.push_back(ipAddress);
-                }
+                ipAddressList.push_back(ipAddress);
             }
         }
     }
@@ -784,17 +1089,20 @@ ntsa::Error HostDatabase::getDomainName(
 {
     NTCCFG_WARNING_UNUSED(options);
 
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    bsl::shared_ptr<const Index> index = this->privateAcquire();
+    if (!index) {
+        return ntsa::Error(ntsa::Error::e_EOF);
+    }
 
-    DomainNameByIpAddress::const_iterator it =
-        d_domainNameByIpAddress.find(ipAddress);
+    const bslstl::StringRef* domainName =
+        index->d_domainNameByIpAddress.find(ipAddress);
 
-    if (it == d_domainNameByIpAddress.end()) {
+    if (domainName == 0) {
         return ntsa::Error(ntsa::Error::e_EOF);
     }
 
-    if (!it->second.empty()) {
-        *result = it->second;
+    if (!domainName->empty()) {
+        *result = *domainName;
     }
     else {
         return ntsa::Error(ntsa::Error::e_EOF);
@@ -806,27 +1114,69 @@ ntsa::Error HostDatabase::getDomainName(
     return ntsa::Error();
 }
 
-ntsa::Error PortDatabase::load(const bsl::shared_ptr<ntcdns::File>& file)
+struct PortDatabase::EntryByServiceName {
+    bool operator()(const Entry& lhs, const Entry& rhs) const
+    {
+        return lhs.d_serviceName < rhs.d_serviceName;
+    }
+
+    bool operator()(const Entry& lhs, const bslstl::StringRef& rhs) const
+    {
+        return lhs.d_serviceName < rhs;
+    }
+
+    bool operator()(const bslstl::StringRef& lhs, const Entry& rhs) const
+    {
+        return lhs < rhs.d_serviceName;
+    }
+};
+
+struct PortDatabase::EntryByPort {
+    bool operator()(const Entry& lhs, const Entry& rhs) const
+    {
+        return lhs.d_port < rhs.d_port;
+    }
+
+    bool operator()(const Entry& lhs, ntsa::Port rhs) const
+    {
+        return lhs.d_port < rhs;
+    }
+
+    bool operator()(ntsa::Port lhs, const Entry& rhs) const
+    {
+        return lhs < rhs.d_port;
+    }
+};
+
+PortDatabase::Index::Index(bslma::Allocator* basicAllocator)
+: d_file_sp()
+, d_fileStamp()
+, d_tcpEntryByServiceName(basicAllocator)
+, d_tcpEntryByPort(basicAllocator)
+, d_udpEntryByServiceName(basicAllocator)
+, d_udpEntryByPort(basicAllocator)
 {
-    ntsa::Error error;
+}
 
+ntsa::Error PortDatabase::load(const bsl::shared_ptr<ntcdns::File>& file,
+                               const ntcdns::FileStamp&             fileStamp)
+    const
+{
     bsls::Stopwatch stopwatch;
     stopwatch.start();
 
     Scanner scanner(file->data(), file->size());
 
-    PortByServiceName tcpPortByServiceName(d_allocator_p);
-    ServiceNameByPort tcpServiceNameByPort(d_allocator_p);
-    PortByServiceName udpPortByServiceName(d_allocator_p);
-    ServiceNameByPort udpServiceNameByPort(d_allocator_p);
+    bsl::shared_ptr<Index> index;
+    index.createInplace(d_allocator_p, d_allocator_p);
 
-    if (file->size() >= 1024 * 1024) {
-        tcpPortByServiceName.reserve(1024);
-        tcpServiceNameByPort.reserve(1024);
+    index->d_file_sp   = file;
+    index->d_fileStamp = fileStamp;
 
-        udpPortByServiceName.reserve(1024);
-        udpServiceNameByPort.reserve(1024);
-    }
+    EntryVector& tcpEntryByServiceName = index->d_tcpEntryByServiceName;
+    EntryVector& tcpEntryByPort        = index->d_tcpEntryByPort;
+    EntryVector& udpEntryByServiceName = index->d_udpEntryByServiceName;
+    EntryVector& udpEntryByPort        = index->d_udpEntryByPort;
 
     char        current = 0;
     bsl::size_t lines   = 0;
@@ -969,54 +1319,15 @@ ntsa::Error PortDatabase::load(const bsl::shared_ptr<ntcdns::File>& file)
             continue;
         }
 
-        if (protocolType == e_TCP) {
-            PortArray& portArray = tcpPortByServiceName[serviceNameStringRef];
-            if (bsl::find(portArray.begin(), portArray.end(), port) ==
-                portArray.end())
-            {
-#if NTCDNS_DATABASE_FIXED_CAPACITY_ARRAYS
-                error = portArray.push_back(port);
-                if (error) {
-#if NTCDNS_DATABASE_DEBUG_COUT
-                    bsl::cout << "Unable to associate service name '"
-                              << serviceNameStringRef << "' with TCP port "
-                              << port << ": max capacity" << bsl::endl;
-#endif
-                }
-#else
-                portArray.push_back(port);
-#endif
-            }
+        EntryVector& entryByServiceName = (protocolType == e_TCP)
+                                              ? tcpEntryByServiceName
+                                              : udpEntryByServiceName;
 
-            bslstl::StringRef& serviceName = tcpServiceNameByPort[port];
-            if (serviceName.empty()) {
-                serviceName = serviceNameStringRef;
-            }
-        }
-        else if (protocolType == e_UDP) {
-            PortArray& portArray = udpPortByServiceName[serviceNameStringRef];
-            if (bsl::find(portArray.begin(), portArray.end(), port) ==
-                portArray.end())
-            {
-#if NTCDNS_DATABASE_FIXED_CAPACITY_ARRAYS
-                error = portArray.push_back(port);
-                if (error) {
-#if NTCDNS_DATABASE_DEBUG_COUT
-                    bsl::cout << "Unable to associate service name '"
-                              << serviceNameStringRef << "' with UDP port "
-                              << port << ": max capacity" << bsl::endl;
-#endif
-                }
-#else
-                portArray.push_back(port);
-#endif
-            }
+        Entry entry;
+        entry.d_serviceName = serviceNameStringRef;
+        entry.d_port        = port;
 
-            bslstl::StringRef& serviceName = udpServiceNameByPort[port];
-            if (serviceName.empty()) {
-                serviceName = serviceNameStringRef;
-            }
-        }
+        entryByServiceName.push_back(entry);
 
         // Scan <service-name-alias>.
 
@@ -1048,113 +1359,170 @@ ntsa::Error PortDatabase::load(const bsl::shared_ptr<ntcdns::File>& file)
             bslstl::StringRef serviceNameAliasStringRef(serviceNameAliasBegin,
                                                         serviceNameAliasEnd);
 
-            if (protocolType == e_TCP) {
-                PortArray& portArray =
-                    tcpPortByServiceName[serviceNameAliasStringRef];
-                if (bsl::find(portArray.begin(), portArray.end(), port) ==
-                    portArray.end())
-                {
-#if NTCDNS_DATABASE_FIXED_CAPACITY_ARRAYS
-                    error = portArray.push_back(port);
-                    if (error) {
-#if NTCDNS_DATABASE_DEBUG_COUT
-                        bsl::cout << "Unable to associate service name alias '"
-                                  << serviceNameAliasStringRef
-                                  << "' with TCP port " << port
-                                  << ": max capacity" << bsl::endl;
-#endif
-                    }
-#else
-                    portArray.push_back(port);
-#endif
-                }
-
-                bslstl::StringRef& serviceName = tcpServiceNameByPort[port];
-                if (serviceName.empty()) {
-                    serviceName = serviceNameAliasStringRef;
-                }
-            }
-            else if (protocolType == e_UDP) {
-                PortArray& portArray =
-                    udpPortByServiceName[serviceNameAliasStringRef];
-                if (bsl::find(portArray.begin(), portArray.end(), port) ==
-                    portArray.end())
-                {
-#if NTCDNS_DATABASE_FIXED_CAPACITY_ARRAYS
-                    error = portArray.push_back(port);
-                    if (error) {
-#if NTCDNS_DATABASE_DEBUG_COUT
-                        bsl::cout << "Unable to associate service name alias '"
-                                  << serviceNameAliasStringRef
-                                  << "' with UDP port " << port
-                                  << ": max capacity" << bsl::endl;
-#endif
-                    }
-#else
-                    portArray.push_back(port);
-#endif
-                }
-
-                bslstl::StringRef& serviceName = udpServiceNameByPort[port];
-                if (serviceName.empty()) {
-                    serviceName = serviceNameAliasStringRef;
-                }
-            }
+            entry.d_serviceName = serviceNameAliasStringRef;
+            entryByServiceName.push_back(entry);
         }
 
         ++lines;
     }
 
+    // Index the service name of each port, which is the first service name
+    // to which the port is assigned in the file, and the ports of each
+    // service name, in the order they are assigned in the file.
+
+    tcpEntryByPort = tcpEntryByServiceName;
+    udpEntryByPort = udpEntryByServiceName;
+
+    indexFirstByKey(&tcpEntryByPort, EntryByPort());
+    indexFirstByKey(&udpEntryByPort, EntryByPort());
+
+    indexAllByKey(&tcpEntryByServiceName, EntryByServiceName(), EntryByPort());
+    indexAllByKey(&udpEntryByServiceName, EntryByServiceName(), EntryByPort());
+
     stopwatch.stop();
 
 #if NTCDNS_DATABASE_DEBUG_COUT
     bsl::cout
         << "Scanned " << file->size() << " bytes (" << lines << " lines, "
-        << tcpPortByServiceName.size() << " IP addresses) from '"
-        << file->path() << "' in "
+        << tcpEntryByPort.size() << " TCP ports, " << udpEntryByPort.size()
+        << " UDP ports) from '" << file->path() << "' in "
         << bsls::TimeInterval(stopwatch.elapsedTime()).totalMilliseconds()
         << " milliseconds" << bsl::endl;
 #endif
 
+    // Replace the current index. The previous index, if any, is destroyed
+    // after the mutex is released.
+
+    bsl::shared_ptr<const Index> previous = index;
+
     {
         bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        d_index_sp.swap(previous);
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error PortDatabase::privateReload(
+    const bsl::shared_ptr<const Index>& index) const
+{
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    if (!index || index->d_file_sp->path().empty()) {
+        return ntsa::Error();
+    }
 
-        d_tcpPortByServiceName.swap(tcpPortByServiceName);
-        d_tcpServiceNameByPort.swap(tcpServiceNameByPort);
+    const bsl::string path = index->d_file_sp->path();
 
-        d_udpPortByServiceName.swap(udpPortByServiceName);
-        d_udpServiceNameByPort.swap(udpServiceNameByPort);
+    ntcdns::FileStamp fileStamp;
+    error = fileStamp.load(path);
+    if (error) {
+        return error;
+    }
 
-        d_file_sp = file;
+    if (fileStamp == index->d_fileStamp) {
+        return ntsa::Error();
     }
 
+    bsl::shared_ptr<ntcdns::File> file;
+    file.createInplace(d_allocator_p, d_allocator_p);
+
+    error = file->load(path);
+    if (error) {
+        NTCI_LOG_STREAM_ERROR << "Failed to reload port database '" << path
+                              << "': " << error << NTCI_LOG_STREAM_END;
+        return error;
+    }
+
+    error = this->load(file, fileStamp);
+    if (error) {
+        NTCI_LOG_STREAM_ERROR << "Failed to parse port database '" << path
+                              << "': " << error << NTCI_LOG_STREAM_END;
+        return error;
+    }
+
+    NTCI_LOG_STREAM_DEBUG << "Reloaded modified port database '" << path
+                          << "'" << NTCI_LOG_STREAM_END;
+
     return ntsa::Error();
 }
 
+void PortDatabase::privateReloadInterval()
+{
+    this->reload();
+}
+
+bsl::shared_ptr<const PortDatabase::Index> PortDatabase::privateAcquire()
+    const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_index_sp;
+}
+
+void PortDatabase::findPort(bsl::vector<ntsa::Port>* result,
+                            const EntryVector&       entryByServiceName,
+                            const bslstl::StringRef& serviceName)
+{
+    bsl::pair<EntryVector::const_iterator, EntryVector::const_iterator>
+        range = bsl::equal_range(entryByServiceName.begin(),
+                                 entryByServiceName.end(),
+                                 serviceName,
+                                 EntryByServiceName());
+
+    for (EntryVector::const_iterator it = range.first; it != range.second;
+         ++it)
+    {
+        if (bsl::find(result->begin(), result->end(), it->d_port) ==
+            result->end())
+        {
+            result->push_back(it->d_port);
+        }
+    }
+}
+
+bslstl::StringRef PortDatabase::findServiceName(
+    const EntryVector& entryByPort,
+    ntsa::Port         port)
+{
+    EntryVector::const_iterator it = bsl::lower_bound(entryByPort.begin(),
+                                                      entryByPort.end(),
+                                                      port,
+                                                      EntryByPort());
+
+    if (it == entryByPort.end() || it->d_port != port) {
+        return bslstl::StringRef();
+    }
+
+    return it->d_serviceName;
+}
+
 PortDatabase::PortDatabase(bslma::Allocator* basicAllocator)
 : d_mutex()
-, d_tcpPortByServiceName(basicAllocator)
-, d_tcpServiceNameByPort(basicAllocator)
-, d_udpPortByServiceName(basicAllocator)
-, d_udpServiceNameByPort(basicAllocator)
+, d_index_sp()
+, d_reloadMutex()
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_reloader("ntcdns-services",
+             bdlf::BindUtil::bind(&PortDatabase::privateReloadInterval,
+                                  this),
+             basicAllocator)
 {
 }
 
 PortDatabase::~PortDatabase()
 {
+    d_reloader.setInterval(bsls::TimeInterval());
 }
 
 void PortDatabase::clear()
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    bsl::shared_ptr<const Index> previous;
 
-    d_tcpPortByServiceName.clear();
-    d_tcpServiceNameByPort.clear();
-    d_udpPortByServiceName.clear();
-    d_udpServiceNameByPort.clear();
-
-    d_file_sp.reset();
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_index_sp.swap(previous);
+    }
 }
 
 ntsa::Error PortDatabase::load()
@@ -1178,6 +1546,12 @@ ntsa::Error PortDatabase::loadPath(const bslstl::StringRef& path)
 
     ntsa::Error error;
 
+    ntcdns::FileStamp fileStamp;
+    error = fileStamp.load(path);
+    if (error) {
+        fileStamp.reset();
+    }
+
     bsl::shared_ptr<ntcdns::File> file;
     file.createInplace(d_allocator_p, d_allocator_p);
 
@@ -1188,7 +1562,7 @@ ntsa::Error PortDatabase::loadPath(const bslstl::StringRef& path)
         return error;
     }
 
-    error = this->load(file);
+    error = this->load(file, fileStamp);
     if (error) {
         NTCI_LOG_STREAM_ERROR << "Failed to parse port database '" << path
                               << "': " << error << NTCI_LOG_STREAM_END;
@@ -1214,7 +1588,7 @@ ntsa::Error PortDatabase::loadText(const char* data, bsl::size_t size)
         return error;
     }
 
-    error = this->load(file);
+    error = this->load(file, ntcdns::FileStamp());
     if (error) {
         NTCI_LOG_STREAM_ERROR << "Failed to parse port database: " << error
                               << NTCI_LOG_STREAM_END;
@@ -1224,6 +1598,21 @@ ntsa::Error PortDatabase::loadText(const char* data, bsl::size_t size)
     return ntsa::Error();
 }
 
+ntsa::Error PortDatabase::reload()
+{
+    // Serialize reloads so that a reload never replaces the index with one
+    // built from an older version of the file.
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_reloadMutex);
+
+    return this->privateReload(this->privateAcquire());
+}
+
+void PortDatabase::setReloadInterval(const bsls::TimeInterval& value)
+{
+    d_reloader.setInterval(value);
+}
+
 ntsa::Error PortDatabase::getPort(ntca::GetPortContext*       context,
                                   bsl::vector<ntsa::Port>*    result,
                                   const bslstl::StringRef&    serviceName,
@@ -1260,62 +1649,17 @@ ntsa::Error PortDatabase::getPort(ntca::GetPortContext*       context,
     }
 
     {
-        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        bsl::shared_ptr<const Index> index = this->privateAcquire();
+        if (!index) {
+            return ntsa::Error(ntsa::Error::e_EOF);
+        }
 
         if (examineTcpPortList) {
-            PortByServiceName::const_iterator it =
-                d_tcpPortByServiceName.find(serviceName);
-
-            if (it != d_tcpPortByServiceName.end()) {
-                if (!examineUdpPortList) {
-                    portList.insert(portList.end(),
-                                    it->second.begin(),
-                                    it->second.end());
-                }
-                else {
-                    const PortArray& source = it->second;
-                    for (PortArray::const_iterator jt = source.begin();
-                         jt != source.end();
-                         ++jt)
-                    {
-                        ntsa::Port port = *jt;
-                        if (bsl::find(portList.begin(),
-                                      portList.end(),
-                                      port) == portList.end())
-                        {
-                            portList.push_back(port);
-                        }
-                    }
-                }
-            }
+            findPort(&portList, index->d_tcpEntryByServiceName, serviceName);
         }
 
         if (examineUdpPortList) {
-            PortByServiceName::const_iterator it =
-                d_udpPortByServiceName.find(serviceName);
-
-            if (it != d_udpPortByServiceName.end()) {
-                if (!examineTcpPortList) {
-                    portList.insert(portList.end(),
-                                    it->second.begin(),
-                                    it->second.end());
-                }
-                else {
-                    const PortArray& source = it->second;
-                    for (PortArray::const_iterator jt = source.begin();
-                         jt != source.end();
-                         ++jt)
-                    {
-                        ntsa::Port port = *jt;
-                        if (bsl::find(portList.begin(),
-                                      portList.end(),
-                                      port) == portList.end())
-                        {
-                            portList.push_back(port);
-                        }
-                    }
-                }
-            }
+            findPort(&portList, index->d_udpEntryByServiceName, serviceName);
         }
     }
 
@@ -1343,78 +1687,44 @@ ntsa::Error PortDatabase::getServiceName(
     const ntsa::Port&                  port,
     const ntca::GetServiceNameOptions& options) const
 {
-    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    bsl::shared_ptr<const Index> index = this->privateAcquire();
+    if (!index) {
+        return ntsa::Error(ntsa::Error::e_EOF);
+    }
 
-    bool found = false;
+    bslstl::StringRef serviceName;
 
     if (!options.transport().isNull()) {
         if (options.transport().value() ==
                 ntsa::Transport::e_TCP_IPV4_STREAM ||
             options.transport().value() == ntsa::Transport::e_TCP_IPV6_STREAM)
         {
-            ServiceNameByPort::const_iterator it =
-                d_tcpServiceNameByPort.find(port);
-
-            if (it == d_tcpServiceNameByPort.end()) {
-                return ntsa::Error(ntsa::Error::e_EOF);
-            }
-
-            if (!it->second.empty()) {
-                *result = it->second;
-                found   = true;
-            }
+            serviceName = findServiceName(index->d_tcpEntryByPort, port);
         }
         else if (options.transport().value() ==
                      ntsa::Transport::e_UDP_IPV4_DATAGRAM ||
                  options.transport().value() ==
                      ntsa::Transport::e_UDP_IPV6_DATAGRAM)
         {
-            ServiceNameByPort::const_iterator it =
-                d_udpServiceNameByPort.find(port);
-
-            if (it == d_udpServiceNameByPort.end()) {
-                return ntsa::Error(ntsa::Error::e_EOF);
-            }
-
-            if (!it->second.empty()) {
-                *result = it->second;
-                found   = true;
-            }
+            serviceName = findServiceName(index->d_udpEntryByPort, port);
         }
         else {
             return ntsa::Error(ntsa::Error::e_INVALID);
         }
     }
     else {
-        if (!found) {
-            ServiceNameByPort::const_iterator it =
-                d_tcpServiceNameByPort.find(port);
-
-            if (it != d_tcpServiceNameByPort.end()) {
-                if (!it->second.empty()) {
-                    *result = it->second;
-                    found   = true;
-                }
-            }
-        }
-
-        if (!found) {
-            ServiceNameByPort::const_iterator it =
-                d_udpServiceNameByPort.find(port);
-
-            if (it != d_udpServiceNameByPort.end()) {
-                if (!it->second.empty()) {
-                    *result = it->second;
-                    found   = true;
-                }
-            }
+        serviceName = findServiceName(index->d_tcpEntryByPort, port);
+        if (serviceName.empty()) {
+            serviceName = findServiceName(index->d_udpEntryByPort, port);
         }
     }
 
-    if (!found) {
+    if (serviceName.empty()) {
         return ntsa::Error(ntsa::Error::e_EOF);
     }
 
+    *result = serviceName;
+
     context->setPort(port);
     context->setSource(ntca::ResolverSource::e_DATABASE);
 
@@ -1425,37 +1735,36 @@ void PortDatabase::dump(bsl::vector<ntcdns::PortEntry>* result) const
 {
     result->clear();
 
-    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    bsl::shared_ptr<const Index> index = this->privateAcquire();
+    if (!index) {
+        return;
+    }
 
-    result->reserve(d_tcpServiceNameByPort.size() +
-                    d_udpServiceNameByPort.size());
+    result->reserve(index->d_tcpEntryByPort.size() +
+                    index->d_udpEntryByPort.size());
 
-    if (!d_tcpServiceNameByPort.empty()) {
-        for (ServiceNameByPort::const_iterator it =
-            d_tcpServiceNameByPort.begin();
-            it != d_tcpServiceNameByPort.end(); ++it)
-        {
-            ntcdns::PortEntry portEntry;
-            portEntry.service() = it->second;
-            portEntry.port() = it->first;
-            portEntry.protocol() = "tcp";
+    for (EntryVector::const_iterator it = index->d_tcpEntryByPort.begin();
+         it != index->d_tcpEntryByPort.end();
+         ++it)
+    {
+        ntcdns::PortEntry portEntry;
+        portEntry.service()  = it->d_serviceName;
+        portEntry.port()     = it->d_port;
+        portEntry.protocol() = "tcp";
 
-            result->push_back(portEntry);
-        }
+        result->push_back(portEntry);
     }
 
-    if (!d_udpServiceNameByPort.empty()) {
-        for (ServiceNameByPort::const_iterator it =
-            d_udpServiceNameByPort.begin();
-            it != d_udpServiceNameByPort.end(); ++it)
-        {
-            ntcdns::PortEntry portEntry;
-            portEntry.service() = it->second;
-            portEntry.port() = it->first;
-            portEntry.protocol() = "udp";
+    for (EntryVector::const_iterator it = index->d_udpEntryByPort.begin();
+         it != index->d_udpEntryByPort.end();
+         ++it)
+    {
+        ntcdns::PortEntry portEntry;
+        portEntry.service()  = it->d_serviceName;
+        portEntry.port()     = it->d_port;
+        portEntry.protocol() = "udp";
 
-            result->push_back(portEntry);
-        }
+        result->push_back(portEntry);
     }
 
     bsl::sort(result->begin(), result->end(), PortEntrySorter());
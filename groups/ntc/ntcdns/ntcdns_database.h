@@ -27,21 +27,20 @@
 #include <ntcdns_utility.h>
 #include <ntcdns_vocabulary.h>
 #include <ntcscm_version.h>
+#include <ntsa_addressmap.h>
 #include <ntsa_domainname.h>
 #include <ntsa_error.h>
 #include <ntsa_ipaddress.h>
 #include <ntsa_port.h>
-#include <bdlma_multipoolallocator.h>
+#include <bslmt_condition.h>
 #include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+#include <bsls_timeinterval.h>
+#include <bsl_functional.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
-#include <bsl_unordered_map.h>
 #include <bsl_vector.h>
 
-// Uncomment or set to 0 to use variable-capacity vectors instead of
-// fixed-capacity arrays.
-// #define NTCDNS_DATABASE_FIXED_CAPACITY_ARRAYS 1
-
 namespace BloombergLP {
 namespace ntcdns {
 
@@ -57,87 +56,153 @@ struct HostDatabaseUtil {
     static bsl::size_t hashIpv6(const ntsa::Ipv6Address& ipv6Address);
 };
 
+/// @internal @brief
+/// Provide a background thread that periodically reloads a database.
+///
+/// @details
+/// While a nonzero reload interval is set, a dedicated thread invokes a
+/// function each time the reload interval elapses. The thread is stopped
+/// and joined when the reload interval is reset to zero or this object is
+/// destroyed.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntcdns
+class DatabaseReloader
+{
+  public:
+    /// Define a type alias for the function invoked each time the reload
+    /// interval elapses.
+    typedef bsl::function<void()> Function;
+
+  private:
+    bslmt::Mutex              d_controlMutex;
+    bslmt::Mutex              d_mutex;
+    bslmt::Condition          d_condition;
+    bslmt::ThreadUtil::Handle d_threadHandle;
+    bsl::string               d_threadName;
+    Function                  d_function;
+    bsls::TimeInterval        d_interval;
+    bool                      d_running;
+    bool                      d_stop;
+    bslma::Allocator*         d_allocator_p;
+
+  private:
+    DatabaseReloader(const DatabaseReloader&) BSLS_KEYWORD_DELETED;
+    DatabaseReloader& operator=(const DatabaseReloader&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Invoke the function of the specified 'reloader' each time its reload
+    /// interval elapses until it is stopped. Return 0.
+    static void* run(DatabaseReloader* reloader);
+
+    /// Stop the thread, if running, and block until it has completed.
+    void stop();
+
+  public:
+    /// Create a new database reloader that invokes the specified 'function'
+    /// on a thread having the specified 'threadName'. Optionally specify a
+    /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
+    /// the currently installed default allocator is used.
+    DatabaseReloader(const bslstl::StringRef& threadName,
+                     const Function&          function,
+                     bslma::Allocator*        basicAllocator = 0);
+
+    /// Destroy this object.
+    ~DatabaseReloader();
+
+    /// Set the reload interval to the specified 'value'. If 'value' is
+    /// zero, stop the thread and block until it has completed.
+    void setInterval(const bsls::TimeInterval& value);
+};
+
 /// @internal @brief
 /// Provide a database of domain names and addresses.
 ///
+/// @details
+/// The database is loaded from a file in the format of "/etc/hosts", which
+/// is memory-mapped when loaded from a path. Loading the file builds an
+/// immutable index of the entries of the file, sorted for binary search,
+/// that refers to the domain names directly in the contents of the file.
+/// Each lookup acquires a reference to the current index and searches it
+/// without holding any lock, so lookups proceed concurrently with each other
+/// and with a reload of the database, which atomically replaces the index
+/// only once the new index is completely built.
+///
+/// When a reload interval is set and the database was loaded from a path,
+/// a background thread checks whether the file has been modified each time
+/// the reload interval elapses, and if so, reloads the database. Lookups
+/// never perform a reload themselves: they continue to use the previous
+/// index until the new index is built and swapped in.
+///
 /// @par Thread Safety
 /// This class is thread safe.
 ///
 /// @ingroup module_ntcdns
 class HostDatabase
 {
-    /// Provide a hash functor for string references.
-    struct DomainNameHash {
-        NTCCFG_INLINE
-        bsl::size_t operator()(bslstl::StringRef domainName) const
-        {
-            bsl::size_t result = 0;
-
-            const char* current = domainName.data();
-            const char* end     = current + domainName.size();
-
-            while (current != end) {
-                result = ((result << 5) + result) ^ (bsl::size_t)(*current++);
-            }
-
-            return result;
-        }
+    /// Describe the assignment of an IP address to a domain name.
+    struct Entry {
+        bslstl::StringRef d_domainName;
+        ntsa::IpAddress   d_ipAddress;
     };
 
-    /// Provide a hash functor for string references.
-    struct IpAddressHash {
-        NTCCFG_INLINE
-        bsl::size_t operator()(const ntsa::IpAddress& ipAddress) const
-        {
-            if (NTCCFG_LIKELY(ipAddress.isV4())) {
-                return ipAddress.v4().value();
-            }
-            else if (ipAddress.isV6()) {
-                return ntcdns::HostDatabaseUtil::hashIpv6(ipAddress.v6());
-            }
-            else {
-                return 0;
-            }
-        }
-    };
+    /// Provide a functor to order entries by domain name.
+    struct EntryByDomainName;
 
-#if NTCDNS_DATABASE_FIXED_CAPACITY_ARRAYS
-    typedef ntcdns::IpAddressArray IpAddressArray;
-    // Define a type alias for a fixed-capacity array of
-    // IP addresses.
-#else
-    /// Define a type alias for a variable-length array of
-    /// IP addresses.
-    typedef bsl::vector<ntsa::IpAddress> IpAddressArray;
-#endif
+    /// Provide a functor to order entries by IP address.
+    struct EntryByIpAddress;
+
+    /// Define a type alias for a vector of entries.
+    typedef bsl::vector<Entry> EntryVector;
 
-    /// Define a type alias for a map of domain names to an
-    /// associated array of IP addresses.
-    typedef bsl::
-        unordered_map<bslstl::StringRef, IpAddressArray, DomainNameHash>
-            IpAddressByDomainName;
-
-    /// Define a type alias for a map of IP addresses to
-    /// domain names.
-    typedef bsl::
-        unordered_map<ntsa::IpAddress, bslstl::StringRef, IpAddressHash>
-            DomainNameByIpAddress;
-
-    mutable bslmt::Mutex          d_mutex;
-    bdlma::MultipoolAllocator     d_pool;
-    IpAddressByDomainName         d_ipAddressByDomainName;
-    DomainNameByIpAddress         d_domainNameByIpAddress;
-    bsl::shared_ptr<ntcdns::File> d_file_sp;
-    bslma::Allocator*             d_allocator_p;
+    /// Define a type alias for a map of IP addresses to the first domain
+    /// name to which each IP address is assigned.
+    typedef ntsa::AddressMap<ntsa::IpAddress, bslstl::StringRef>
+        DomainNameByIpAddress;
+
+    /// Provide an immutable index of the entries of a host database.
+    struct Index {
+        /// Create a new, empty index. Optionally specify a
+        /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
+        /// the currently installed default allocator is used.
+        explicit Index(bslma::Allocator* basicAllocator = 0);
+
+        bsl::shared_ptr<ntcdns::File> d_file_sp;
+        ntcdns::FileStamp             d_fileStamp;
+        EntryVector                   d_entryByDomainName;
+        DomainNameByIpAddress         d_domainNameByIpAddress;
+    };
+
+    mutable bslmt::Mutex                 d_mutex;
+    mutable bsl::shared_ptr<const Index> d_index_sp;
+    bslmt::Mutex                         d_reloadMutex;
+    bslma::Allocator*                    d_allocator_p;
+    ntcdns::DatabaseReloader             d_reloader;
 
   private:
     HostDatabase(const HostDatabase&) BSLS_KEYWORD_DELETED;
     HostDatabase& operator=(const HostDatabase&) BSLS_KEYWORD_DELETED;
 
   private:
-    /// Load the DNS host database from the specified 'file'. Return the
-    /// error.
-    ntsa::Error load(const bsl::shared_ptr<ntcdns::File>& file);
+    /// Load the DNS host database from the specified 'file' having the
+    /// specified 'fileStamp'. Return the error.
+    ntsa::Error load(const bsl::shared_ptr<ntcdns::File>& file,
+                     const ntcdns::FileStamp&             fileStamp) const;
+
+    /// Reload the DNS host database from the path of the specified 'index'
+    /// if the file at that path has been modified since 'index' was built.
+    /// Return the error.
+    ntsa::Error privateReload(const bsl::shared_ptr<const Index>& index) const;
+
+    /// Reload the database if the file from which the database was loaded
+    /// has been modified. This function is invoked by the reloader each
+    /// time the reload interval elapses.
+    void privateReloadInterval();
+
+    /// Return the current index.
+    bsl::shared_ptr<const Index> privateAcquire() const;
 
   public:
     /// Create a new host database. Optionally specify a 'basicAllocator'
@@ -163,6 +228,17 @@ class HostDatabase
     /// the specified 'size'. Return the error.
     ntsa::Error loadText(const char* data, bsl::size_t size);
 
+    /// Reload the DNS host database from the file at the path from which it
+    /// was loaded, if that file has been modified. Return the error.
+    ntsa::Error reload();
+
+    /// Set the interval between checks, performed by a background thread,
+    /// of whether the file from which the database was loaded has been
+    /// modified to the specified 'value'. If 'value' is zero, the file is
+    /// only checked when 'reload()' is called explicitly. The default value
+    /// is zero.
+    void setReloadInterval(const bsls::TimeInterval& value);
+
     /// Load into the specified 'result' the IP address list assigned to the
     /// specified 'domainName' according to the specified 'options' and
     /// load into the specified 'context' the context of resolution. Return
@@ -185,65 +261,90 @@ class HostDatabase
 /// @internal @brief
 /// Provide a database of service names and ports.
 ///
+/// @details
+/// The database is loaded from a file in the format of "/etc/services",
+/// which is memory-mapped when loaded from a path. Loading the file builds
+/// an immutable index of the entries of the file, sorted for binary search,
+/// that refers to the service names directly in the contents of the file.
+/// Lookups and reloads do not block each other; see 'ntcdns::HostDatabase'.
+///
 /// @par Thread Safety
 /// This class is thread safe.
 ///
 /// @ingroup module_ntcdns
 class PortDatabase
 {
-    /// Provide a hash functor for string references.
-    struct HashFunction {
-        bsl::size_t operator()(bslstl::StringRef value) const
-        {
-            bsl::size_t result = 0;
-
-            const char* current = value.data();
-            const char* end     = current + value.size();
+    /// Describe the assignment of a port to a service name.
+    struct Entry {
+        bslstl::StringRef d_serviceName;
+        ntsa::Port        d_port;
+    };
 
-            while (current != end) {
-                result = ((result << 5) + result) ^ (bsl::size_t)(*current++);
-            }
+    /// Provide a functor to order entries by service name.
+    struct EntryByServiceName;
 
-            return result;
-        }
-    };
+    /// Provide a functor to order entries by port.
+    struct EntryByPort;
 
-#if NTCDNS_DATABASE_FIXED_CAPACITY_ARRAYS
-    typedef ntcdns::PortArray PortArray;
-    // Define a type alias for a fixed-capacity array of
-    // ports.
-#else
-    /// Define a type alias for a variable-length array of
-    /// ports.
-    typedef bsl::vector<ntsa::Port> PortArray;
-#endif
+    /// Define a type alias for a vector of entries.
+    typedef bsl::vector<Entry> EntryVector;
 
-    /// Define a type alias for a map of service names to
-    /// an associated vector of ports.
-    typedef bsl::unordered_map<bslstl::StringRef, PortArray, HashFunction>
-        PortByServiceName;
+    /// Provide an immutable index of the entries of a port database.
+    struct Index {
+        /// Create a new, empty index. Optionally specify a
+        /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
+        /// the currently installed default allocator is used.
+        explicit Index(bslma::Allocator* basicAllocator = 0);
 
-    /// Define a type alias for a map of ports to
-    /// service names.
-    typedef bsl::unordered_map<ntsa::Port, bslstl::StringRef>
-        ServiceNameByPort;
+        bsl::shared_ptr<ntcdns::File> d_file_sp;
+        ntcdns::FileStamp             d_fileStamp;
+        EntryVector                   d_tcpEntryByServiceName;
+        EntryVector                   d_tcpEntryByPort;
+        EntryVector                   d_udpEntryByServiceName;
+        EntryVector                   d_udpEntryByPort;
+    };
 
-    mutable bslmt::Mutex          d_mutex;
-    PortByServiceName             d_tcpPortByServiceName;
-    ServiceNameByPort             d_tcpServiceNameByPort;
-    PortByServiceName             d_udpPortByServiceName;
-    ServiceNameByPort             d_udpServiceNameByPort;
-    bsl::shared_ptr<ntcdns::File> d_file_sp;
-    bslma::Allocator*             d_allocator_p;
+    mutable bslmt::Mutex                 d_mutex;
+    mutable bsl::shared_ptr<const Index> d_index_sp;
+    bslmt::Mutex                         d_reloadMutex;
+    bslma::Allocator*                    d_allocator_p;
+    ntcdns::DatabaseReloader             d_reloader;
 
   private:
     PortDatabase(const PortDatabase&) BSLS_KEYWORD_DELETED;
     PortDatabase& operator=(const PortDatabase&) BSLS_KEYWORD_DELETED;
 
   private:
-    /// Load the DNS port database from the specified 'file'. Return the
-    /// error.
-    ntsa::Error load(const bsl::shared_ptr<ntcdns::File>& file);
+    /// Load the DNS port database from the specified 'file' having the
+    /// specified 'fileStamp'. Return the error.
+    ntsa::Error load(const bsl::shared_ptr<ntcdns::File>& file,
+                     const ntcdns::FileStamp&             fileStamp) const;
+
+    /// Reload the DNS port database from the path of the specified 'index'
+    /// if the file at that path has been modified since 'index' was built.
+    /// Return the error.
+    ntsa::Error privateReload(const bsl::shared_ptr<const Index>& index) const;
+
+    /// Reload the database if the file from which the database was loaded
+    /// has been modified. This function is invoked by the reloader each
+    /// time the reload interval elapses.
+    void privateReloadInterval();
+
+    /// Return the current index.
+    bsl::shared_ptr<const Index> privateAcquire() const;
+
+    /// Append to the specified 'result' each port assigned to the specified
+    /// 'serviceName' in the specified 'entryByServiceName' that is not
+    /// already in the 'result'.
+    static void findPort(bsl::vector<ntsa::Port>* result,
+                         const EntryVector&       entryByServiceName,
+                         const bslstl::StringRef& serviceName);
+
+    /// Return the service name to which the specified 'port' is assigned
+    /// in the specified 'entryByPort', or the empty string if no such
+    /// service name exists.
+    static bslstl::StringRef findServiceName(const EntryVector& entryByPort,
+                                             ntsa::Port         port);
 
   public:
     /// Create a new port database. Optionally specify a 'basicAllocator'
@@ -269,6 +370,17 @@ class PortDatabase
     /// the specified 'size'. Return the error.
     ntsa::Error loadText(const char* data, bsl::size_t size);
 
+    /// Reload the DNS port database from the file at the path from which it
+    /// was loaded, if that file has been modified. Return the error.
+    ntsa::Error reload();
+
+    /// Set the interval between checks, performed by a background thread,
+    /// of whether the file from which the database was loaded has been
+    /// modified to the specified 'value'. If 'value' is zero, the file is
+    /// only checked when 'reload()' is called explicitly. The default value
+    /// is zero.
+    void setReloadInterval(const bsls::TimeInterval& value);
+
     /// Load into the specified 'result' the port list assigned to the
     /// specified 'serviceName' according to the specified 'options' and
     /// load into the specified 'context' the context of resolution. Return
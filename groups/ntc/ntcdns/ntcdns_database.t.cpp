@@ -20,6 +20,7 @@
 #include <ntcdns_utility.h>
 #include <ntci_log.h>
 #include <ntsa_host.h>
+#include <ntsa_temporary.h>
 
 #include <bdlb_chartype.h>
 #include <bdlma_bufferedsequentialallocator.h>
@@ -27,6 +28,7 @@
 #include <bslma_allocator.h>
 #include <bslma_default.h>
 #include <bslmt_lockguard.h>
+#include <bslmt_threadutil.h>
 #include <bsls_alignedbuffer.h>
 #include <bsls_assert.h>
 #include <bsls_stopwatch.h>
@@ -2196,11 +2198,167 @@ NTCCFG_TEST_CASE(4)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+NTCCFG_TEST_CASE(5)
+{
+    // Concern: Host database is reloaded when its file is modified.
+    // Plan:
+
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::TemporaryFile tempFile(&ta);
+
+        error = tempFile.write("192.168.1.101 test-reload\n");
+        NTCCFG_TEST_OK(error);
+
+        ntcdns::HostDatabase hostDatabase(&ta);
+
+        error = hostDatabase.loadPath(tempFile.path());
+        NTCCFG_TEST_OK(error);
+
+        {
+            ntca::GetIpAddressContext    context;
+            ntca::GetIpAddressOptions    options;
+            bsl::vector<ntsa::IpAddress> ipAddressList(&ta);
+
+            error = hostDatabase.getIpAddress(&context,
+                                              &ipAddressList,
+                                              "test-reload",
+                                              options);
+            NTCCFG_TEST_OK(error);
+
+            NTCCFG_TEST_EQ(ipAddressList.size(), 1);
+            NTCCFG_TEST_EQ(ipAddressList[0],
+                           ntsa::IpAddress("192.168.1.101"));
+        }
+
+        error = hostDatabase.reload();
+        NTCCFG_TEST_OK(error);
+
+        error = tempFile.write("192.168.1.102 test-reload\n"
+                               "192.168.1.103 test-reload\n");
+        NTCCFG_TEST_OK(error);
+
+        error = hostDatabase.reload();
+        NTCCFG_TEST_OK(error);
+
+        {
+            ntca::GetIpAddressContext    context;
+            ntca::GetIpAddressOptions    options;
+            bsl::vector<ntsa::IpAddress> ipAddressList(&ta);
+
+            error = hostDatabase.getIpAddress(&context,
+                                              &ipAddressList,
+                                              "test-reload",
+                                              options);
+            NTCCFG_TEST_OK(error);
+
+            NTCCFG_TEST_EQ(ipAddressList.size(), 2);
+            NTCCFG_TEST_EQ(ipAddressList[0],
+                           ntsa::IpAddress("192.168.1.102"));
+            NTCCFG_TEST_EQ(ipAddressList[1],
+                           ntsa::IpAddress("192.168.1.103"));
+        }
+
+        {
+            ntca::GetDomainNameContext context;
+            ntca::GetDomainNameOptions options;
+            bsl::string                domainName(&ta);
+
+            error = hostDatabase.getDomainName(
+                &context,
+                &domainName,
+                ntsa::IpAddress("192.168.1.101"),
+                options);
+            NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_EOF));
+
+            error = hostDatabase.getDomainName(
+                &context,
+                &domainName,
+                ntsa::IpAddress("192.168.1.103"),
+                options);
+            NTCCFG_TEST_OK(error);
+            NTCCFG_TEST_EQ(domainName, "test-reload");
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(6)
+{
+    // Concern: Host database is reloaded in the background when its file
+    // is modified, while lookups continue to be served from the current
+    // index.
+    // Plan:
+
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::TemporaryFile tempFile(&ta);
+
+        error = tempFile.write("192.168.1.101 test-reload\n");
+        NTCCFG_TEST_OK(error);
+
+        ntcdns::HostDatabase hostDatabase(&ta);
+
+        error = hostDatabase.loadPath(tempFile.path());
+        NTCCFG_TEST_OK(error);
+
+        hostDatabase.setReloadInterval(bsls::TimeInterval(0, 10000000));
+
+        error = tempFile.write("192.168.1.102 test-reload\n"
+                               "192.168.1.103 test-reload\n");
+        NTCCFG_TEST_OK(error);
+
+        bsl::size_t numIpAddresses = 0;
+
+        for (bsl::size_t i = 0; i < 500; ++i) {
+            ntca::GetIpAddressContext    context;
+            ntca::GetIpAddressOptions    options;
+            bsl::vector<ntsa::IpAddress> ipAddressList(&ta);
+
+            error = hostDatabase.getIpAddress(&context,
+                                              &ipAddressList,
+                                              "test-reload",
+                                              options);
+            NTCCFG_TEST_OK(error);
+
+            numIpAddresses = ipAddressList.size();
+            if (numIpAddresses == 2) {
+                NTCCFG_TEST_EQ(ipAddressList[0],
+                               ntsa::IpAddress("192.168.1.102"));
+                NTCCFG_TEST_EQ(ipAddressList[1],
+                               ntsa::IpAddress("192.168.1.103"));
+                break;
+            }
+
+            NTCCFG_TEST_EQ(numIpAddresses, 1);
+            NTCCFG_TEST_EQ(ipAddressList[0],
+                           ntsa::IpAddress("192.168.1.101"));
+
+            bslmt::ThreadUtil::microSleep(10000);
+        }
+
+        NTCCFG_TEST_EQ(numIpAddresses, 2);
+
+        hostDatabase.setReloadInterval(bsls::TimeInterval());
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
     NTCCFG_TEST_REGISTER(2);
     NTCCFG_TEST_REGISTER(3);
     NTCCFG_TEST_REGISTER(4);
+    NTCCFG_TEST_REGISTER(5);
+    NTCCFG_TEST_REGISTER(6);
 }
 NTCCFG_TEST_DRIVER_END;
@@ -90,7 +90,8 @@ ntsa::Error checkUnderflow(bsl::size_t numBytesRemaining,
     return ntsa::Error();
 }
 
-ntsa::Error checkToken(const bsl::string& name, const bslstl::StringRef& token)
+ntsa::Error checkToken(const bslstl::StringRef& name,
+                       const bslstl::StringRef& token)
 {
     // Verify the specified 'token' in the specified 'name'. Return the error.
 
@@ -181,6 +182,104 @@ ntsa::Error checkCoherentRdataLength(bsl::size_t expected, bsl::size_t found)
     return ntsa::Error();
 }
 
+ntsa::Error nextLabel(const bsl::uint8_t** label,
+                      bsl::size_t*         labelSize,
+                      bsl::size_t*         position,
+                      bsl::size_t*         numJumps,
+                      const bsl::uint8_t*  message,
+                      bsl::size_t          messageSize)
+{
+    // Load into the specified 'label' and 'labelSize' the label of a domain
+    // name encoded at the specified 'position' in the specified 'message'
+    // having the specified 'messageSize', following any label compression
+    // pointer, and advance the 'position' past the label. Increment the
+    // specified 'numJumps' for each label compression pointer followed.
+    // Load a 'labelSize' of zero when the end of the domain name is reached.
+    // Return the error.
+
+    while (true) {
+        if (*position >= messageSize) {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+
+        const bsl::uint8_t length = message[*position];
+
+        if (length == 0) {
+            *label     = 0;
+            *labelSize = 0;
+            return ntsa::Error();
+        }
+
+        if (length <= k_MAX_LABEL_LENGTH) {
+            if (messageSize - *position - 1 < length) {
+                return ntsa::Error(ntsa::Error::e_INVALID);
+            }
+
+            *label     = message + *position + 1;
+            *labelSize = length;
+            *position  += 1 + length;
+
+            return ntsa::Error();
+        }
+
+        if ((length & 0xC0) != 0xC0) {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+
+        if (*position + 1 >= messageSize) {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+
+        if (++(*numJumps) > k_MAX_LABEL_RESOLUTION_RECURSION_DEPTH) {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+
+        *position = (static_cast<bsl::size_t>(length & 0x3F) << 8) |
+                    static_cast<bsl::size_t>(message[*position + 1]);
+    }
+}
+
+ntsa::Error skipQuestion(MemoryDecoder* decoder)
+{
+    // Advance the specified 'decoder' past the question encoded at its
+    // current position. Return the error.
+
+    ntsa::Error error;
+
+    error = ntcdns::DomainNameView::skip(decoder);
+    if (error) {
+        return error;
+    }
+
+    return decoder->advance(4);
+}
+
+ntsa::Error skipResourceRecord(MemoryDecoder* decoder)
+{
+    // Advance the specified 'decoder' past the resource record encoded at
+    // its current position. Return the error.
+
+    ntsa::Error error;
+
+    error = ntcdns::DomainNameView::skip(decoder);
+    if (error) {
+        return error;
+    }
+
+    error = decoder->advance(8);
+    if (error) {
+        return error;
+    }
+
+    bsl::uint16_t rdataLength;
+    error = decoder->decodeUint16(&rdataLength);
+    if (error) {
+        return error;
+    }
+
+    return decoder->advance(rdataLength);
+}
+
 }  // close unnamed namespace
 
 MemoryEncoder::MemoryEncoder(uint8_t* data, bsl::size_t size)
@@ -245,7 +344,7 @@ ntsa::Error MemoryEncoder::encodeUint32(const bdlb::BigEndianUint32& value)
     return ntsa::Error();
 }
 
-ntsa::Error MemoryEncoder::encodeDomainName(const bsl::string& value)
+ntsa::Error MemoryEncoder::encodeDomainName(const bslstl::StringRef& value)
 {
     ntsa::Error error;
 
@@ -1751,7 +1850,31 @@ ntsa::Error ResourceRecord::decode(MemoryDecoder* decoder)
             }
         }
         else if (d_type == ntcdns::Type::e_SVR) {
-            return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+            ntcdns::ResourceRecordDataSvr& rdata = d_rdata.makeServer();
+
+            rdata.name()           = d_name;
+            rdata.ttl()            = d_ttl;
+            rdata.classification() = static_cast<unsigned short>(d_class);
+
+            error = decoder->decodeUint16(&rdata.priority());
+            if (error) {
+                return error;
+            }
+
+            error = decoder->decodeUint16(&rdata.weight());
+            if (error) {
+                return error;
+            }
+
+            error = decoder->decodeUint16(&rdata.port());
+            if (error) {
+                return error;
+            }
+
+            error = decoder->decodeDomainName(&rdata.target());
+            if (error) {
+                return error;
+            }
         }
         else if (d_type == ntcdns::Type::e_OPT) {
             // Parse options as raw records until the format is supported.
@@ -2021,7 +2144,25 @@ ntsa::Error ResourceRecord::encode(MemoryEncoder* encoder) const
         }
     }
     else if (d_rdata.isServerValue()) {
-        return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+        error = encoder->encodeUint16(d_rdata.server().priority());
+        if (error) {
+            return error;
+        }
+
+        error = encoder->encodeUint16(d_rdata.server().weight());
+        if (error) {
+            return error;
+        }
+
+        error = encoder->encodeUint16(d_rdata.server().port());
+        if (error) {
+            return error;
+        }
+
+        error = encoder->encodeDomainName(d_rdata.server().target());
+        if (error) {
+            return error;
+        }
     }
     else if (d_rdata.isRawValue()) {
         error = encoder->encodeRaw(&d_rdata.raw().data()[0],
@@ -2536,5 +2677,793 @@ bool operator!=(const Message& lhs, const Message& rhs)
     return !operator==(lhs, rhs);
 }
 
+DomainNameView::DomainNameView()
+: d_message(0)
+, d_messageSize(0)
+, d_offset(0)
+{
+}
+
+DomainNameView::DomainNameView(const bsl::uint8_t* message,
+                               bsl::size_t         messageSize,
+                               bsl::size_t         offset)
+: d_message(message)
+, d_messageSize(messageSize)
+, d_offset(offset)
+{
+}
+
+void DomainNameView::reset()
+{
+    d_message     = 0;
+    d_messageSize = 0;
+    d_offset      = 0;
+}
+
+ntsa::Error DomainNameView::load(bsl::string* result) const
+{
+    ntsa::Error error;
+
+    result->clear();
+
+    if (d_message == 0) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    bsl::size_t position = d_offset;
+    bsl::size_t numJumps = 0;
+
+    while (true) {
+        const bsl::uint8_t* label     = 0;
+        bsl::size_t         labelSize = 0;
+
+        error = nextLabel(&label,
+                          &labelSize,
+                          &position,
+                          &numJumps,
+                          d_message,
+                          d_messageSize);
+        if (error) {
+            return error;
+        }
+
+        if (labelSize == 0) {
+            break;
+        }
+
+        if (!result->empty()) {
+            result->append(1, '.');
+        }
+
+        result->append(reinterpret_cast<const char*>(label), labelSize);
+    }
+
+    return ntsa::Error();
+}
+
+bool DomainNameView::equals(const bslstl::StringRef& name) const
+{
+    ntsa::Error error;
+
+    if (d_message == 0) {
+        return false;
+    }
+
+    bsl::size_t nameSize = name.size();
+    if (nameSize > 0 && name[nameSize - 1] == '.') {
+        --nameSize;
+    }
+
+    bsl::size_t namePosition = 0;
+    bsl::size_t position     = d_offset;
+    bsl::size_t numJumps     = 0;
+
+    while (true) {
+        const bsl::uint8_t* label     = 0;
+        bsl::size_t         labelSize = 0;
+
+        error = nextLabel(&label,
+                          &labelSize,
+                          &position,
+                          &numJumps,
+                          d_message,
+                          d_messageSize);
+        if (error) {
+            return false;
+        }
+
+        if (labelSize == 0) {
+            return namePosition == nameSize;
+        }
+
+        if (namePosition != 0) {
+            if (namePosition >= nameSize || name[namePosition] != '.') {
+                return false;
+            }
+
+            ++namePosition;
+        }
+
+        if (nameSize - namePosition < labelSize) {
+            return false;
+        }
+
+        for (bsl::size_t i = 0; i < labelSize; ++i) {
+            if (bdlb::CharType::toLower(static_cast<char>(label[i])) !=
+                bdlb::CharType::toLower(name[namePosition + i]))
+            {
+                return false;
+            }
+        }
+
+        namePosition += labelSize;
+    }
+}
+
+bsl::size_t DomainNameView::offset() const
+{
+    return d_offset;
+}
+
+bool DomainNameView::isNull() const
+{
+    return d_message == 0;
+}
+
+ntsa::Error DomainNameView::skip(MemoryDecoder* decoder)
+{
+    ntsa::Error error;
+
+    while (true) {
+        bsl::uint8_t length = 0;
+        error               = decoder->decodeUint8(&length);
+        if (error) {
+            return error;
+        }
+
+        if (length == 0) {
+            break;
+        }
+
+        if (length <= k_MAX_LABEL_LENGTH) {
+            error = decoder->advance(length);
+            if (error) {
+                return error;
+            }
+        }
+        else if ((length & 0xC0) == 0xC0) {
+            error = decoder->advance(1);
+            if (error) {
+                return error;
+            }
+
+            break;
+        }
+        else {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+    }
+
+    return ntsa::Error();
+}
+
+bsl::ostream& operator<<(bsl::ostream&                 stream,
+                         const ntcdns::DomainNameView& object)
+{
+    bsl::string name;
+    if (!object.load(&name)) {
+        stream << name;
+    }
+
+    return stream;
+}
+
+QuestionView::QuestionView()
+: d_name()
+, d_type(ntcdns::Type::e_A)
+, d_classification(ntcdns::Classification::e_INTERNET)
+{
+}
+
+void QuestionView::reset()
+{
+    d_name.reset();
+    d_type           = ntcdns::Type::e_A;
+    d_classification = ntcdns::Classification::e_INTERNET;
+}
+
+ntsa::Error QuestionView::decode(MemoryDecoder* decoder)
+{
+    ntsa::Error error;
+
+    const bsl::size_t offset = decoder->position();
+
+    error = DomainNameView::skip(decoder);
+    if (error) {
+        return error;
+    }
+
+    d_name = DomainNameView(decoder->begin(), decoder->capacity(), offset);
+
+    {
+        bsl::uint16_t qtypeValue;
+        error = decoder->decodeUint16(&qtypeValue);
+        if (error) {
+            return error;
+        }
+
+        if (0 != ntcdns::Type::fromInt(&d_type, qtypeValue)) {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+    }
+
+    {
+        bsl::uint16_t qclassValue;
+        error = decoder->decodeUint16(&qclassValue);
+        if (error) {
+            return error;
+        }
+
+        if (0 !=
+            ntcdns::Classification::fromInt(&d_classification, qclassValue))
+        {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error QuestionView::load(ntcdns::Question* result) const
+{
+    ntsa::Error error;
+
+    result->reset();
+
+    bsl::string name;
+    error = d_name.load(&name);
+    if (error) {
+        return error;
+    }
+
+    result->setName(name);
+    result->setType(d_type);
+    result->setClassification(d_classification);
+
+    return ntsa::Error();
+}
+
+const ntcdns::DomainNameView& QuestionView::name() const
+{
+    return d_name;
+}
+
+ntcdns::Type::Value QuestionView::type() const
+{
+    return d_type;
+}
+
+ntcdns::Classification::Value QuestionView::classification() const
+{
+    return d_classification;
+}
+
+ResourceRecordView::ResourceRecordView()
+: d_message(0)
+, d_messageSize(0)
+, d_offset(0)
+, d_name()
+, d_type(ntcdns::Type::e_A)
+, d_classification(ntcdns::Classification::e_INTERNET)
+, d_ttl(0)
+, d_rdataOffset(0)
+, d_rdataSize(0)
+{
+}
+
+void ResourceRecordView::reset()
+{
+    d_message     = 0;
+    d_messageSize = 0;
+    d_offset      = 0;
+    d_name.reset();
+    d_type           = ntcdns::Type::e_A;
+    d_classification = ntcdns::Classification::e_INTERNET;
+    d_ttl            = 0;
+    d_rdataOffset    = 0;
+    d_rdataSize      = 0;
+}
+
+ntsa::Error ResourceRecordView::decode(MemoryDecoder* decoder)
+{
+    ntsa::Error error;
+
+    d_message     = decoder->begin();
+    d_messageSize = decoder->capacity();
+    d_offset      = decoder->position();
+
+    error = DomainNameView::skip(decoder);
+    if (error) {
+        return error;
+    }
+
+    d_name = DomainNameView(d_message, d_messageSize, d_offset);
+
+    {
+        bsl::uint16_t typeValue;
+        error = decoder->decodeUint16(&typeValue);
+        if (error) {
+            return error;
+        }
+
+        if (0 != ntcdns::Type::fromInt(&d_type, static_cast<int>(typeValue))) {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+    }
+
+    {
+        bsl::uint16_t classificationValue;
+        error = decoder->decodeUint16(&classificationValue);
+        if (error) {
+            return error;
+        }
+
+        if (d_type != ntcdns::Type::e_OPT) {
+            if (0 != ntcdns::Classification::fromInt(
+                         &d_classification,
+                         static_cast<int>(classificationValue)))
+            {
+                return ntsa::Error(ntsa::Error::e_INVALID);
+            }
+        }
+        else {
+            d_classification = ntcdns::Classification::e_INTERNET;
+        }
+    }
+
+    error = decoder->decodeUint32(&d_ttl);
+    if (error) {
+        return error;
+    }
+
+    bsl::uint16_t rdataLength;
+    error = decoder->decodeUint16(&rdataLength);
+    if (error) {
+        return error;
+    }
+
+    d_rdataOffset = decoder->position();
+    d_rdataSize   = rdataLength;
+
+    error = decoder->advance(rdataLength);
+    if (error) {
+        return error;
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error ResourceRecordView::loadIpAddress(ntsa::IpAddress* result) const
+{
+    if (d_type == ntcdns::Type::e_A) {
+        ntsa::Ipv4Address ipv4Address;
+        if (d_rdataSize != 4 ||
+            ipv4Address.copyFrom(d_message + d_rdataOffset, d_rdataSize) !=
+                d_rdataSize)
+        {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+
+        *result = ntsa::IpAddress(ipv4Address);
+        return ntsa::Error();
+    }
+    else if (d_type == ntcdns::Type::e_AAAA) {
+        ntsa::Ipv6Address ipv6Address;
+        if (d_rdataSize != 16 ||
+            ipv6Address.copyFrom(d_message + d_rdataOffset, d_rdataSize) !=
+                d_rdataSize)
+        {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+
+        *result = ntsa::IpAddress(ipv6Address);
+        return ntsa::Error();
+    }
+
+    return ntsa::Error(ntsa::Error::e_INVALID);
+}
+
+ntsa::Error ResourceRecordView::loadDomainName(
+    ntcdns::DomainNameView* result) const
+{
+    if (d_type != ntcdns::Type::e_CNAME && d_type != ntcdns::Type::e_NS &&
+        d_type != ntcdns::Type::e_PTR)
+    {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    if (d_rdataSize == 0) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    *result = DomainNameView(d_message, d_messageSize, d_rdataOffset);
+    return ntsa::Error();
+}
+
+ntsa::Error ResourceRecordView::load(ntcdns::ResourceRecord* result) const
+{
+    ntsa::Error error;
+
+    result->reset();
+
+    if (d_message == 0) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    MemoryDecoder decoder(d_message, d_messageSize);
+
+    error = decoder.seek(d_offset);
+    if (error) {
+        return error;
+    }
+
+    return result->decode(&decoder);
+}
+
+const ntcdns::DomainNameView& ResourceRecordView::name() const
+{
+    return d_name;
+}
+
+ntcdns::Type::Value ResourceRecordView::type() const
+{
+    return d_type;
+}
+
+ntcdns::Classification::Value ResourceRecordView::classification() const
+{
+    return d_classification;
+}
+
+bsl::uint32_t ResourceRecordView::ttl() const
+{
+    return d_ttl;
+}
+
+const bsl::uint8_t* ResourceRecordView::rdata() const
+{
+    return d_message + d_rdataOffset;
+}
+
+bsl::size_t ResourceRecordView::rdataSize() const
+{
+    return d_rdataSize;
+}
+
+ntsa::Error MessageView::locate(bsl::size_t* result,
+                                Section      section,
+                                bsl::size_t  index) const
+{
+    ntsa::Error error;
+
+    bsl::size_t position = d_sectionOffset[section];
+    bsl::size_t current  = 0;
+
+    if (d_cursorSection == static_cast<bsl::size_t>(section) &&
+        d_cursorIndex <= index)
+    {
+        position = d_cursorOffset;
+        current  = d_cursorIndex;
+    }
+
+    if (current < index) {
+        MemoryDecoder decoder(d_data, d_size);
+
+        error = decoder.seek(position);
+        if (error) {
+            return error;
+        }
+
+        while (current < index) {
+            if (section == e_QD) {
+                error = skipQuestion(&decoder);
+            }
+            else {
+                error = skipResourceRecord(&decoder);
+            }
+
+            if (error) {
+                return error;
+            }
+
+            ++current;
+        }
+
+        position = decoder.position();
+    }
+
+    d_cursorSection = section;
+    d_cursorIndex   = index;
+    d_cursorOffset  = position;
+
+    *result = position;
+    return ntsa::Error();
+}
+
+ntsa::Error MessageView::record(ntcdns::ResourceRecordView* result,
+                                Section                     section,
+                                bsl::size_t                 index) const
+{
+    ntsa::Error error;
+
+    bsl::size_t position = 0;
+    error                = this->locate(&position, section, index);
+    if (error) {
+        return error;
+    }
+
+    MemoryDecoder decoder(d_data, d_size);
+
+    error = decoder.seek(position);
+    if (error) {
+        return error;
+    }
+
+    return result->decode(&decoder);
+}
+
+MessageView::MessageView()
+: d_data(0)
+, d_size(0)
+, d_header()
+, d_cursorSection(e_QD)
+, d_cursorIndex(0)
+, d_cursorOffset(0)
+{
+    for (bsl::size_t i = 0; i <= e_END; ++i) {
+        d_sectionOffset[i] = 0;
+    }
+}
+
+MessageView::~MessageView()
+{
+}
+
+void MessageView::reset()
+{
+    d_data = 0;
+    d_size = 0;
+    d_header.reset();
+
+    for (bsl::size_t i = 0; i <= e_END; ++i) {
+        d_sectionOffset[i] = 0;
+    }
+
+    d_cursorSection = e_QD;
+    d_cursorIndex   = 0;
+    d_cursorOffset  = 0;
+}
+
+ntsa::Error MessageView::decode(const bsl::uint8_t* data, bsl::size_t size)
+{
+    ntsa::Error error;
+
+    this->reset();
+
+    MemoryDecoder decoder(data, size);
+
+    error = d_header.decode(&decoder);
+    if (error) {
+        return error;
+    }
+
+    d_sectionOffset[e_QD] = decoder.position();
+
+    for (bsl::size_t i = 0; i < d_header.qdcount(); ++i) {
+        error = skipQuestion(&decoder);
+        if (error) {
+            return error;
+        }
+    }
+
+    d_sectionOffset[e_AN] = decoder.position();
+
+    for (bsl::size_t i = 0; i < d_header.ancount(); ++i) {
+        error = skipResourceRecord(&decoder);
+        if (error) {
+            return error;
+        }
+    }
+
+    d_sectionOffset[e_NS] = decoder.position();
+
+    for (bsl::size_t i = 0; i < d_header.nscount(); ++i) {
+        error = skipResourceRecord(&decoder);
+        if (error) {
+            return error;
+        }
+    }
+
+    d_sectionOffset[e_AR] = decoder.position();
+
+    for (bsl::size_t i = 0; i < d_header.arcount(); ++i) {
+        error = skipResourceRecord(&decoder);
+        if (error) {
+            return error;
+        }
+    }
+
+    d_sectionOffset[e_END] = decoder.position();
+
+    d_data = data;
+    d_size = size;
+
+    d_cursorSection = e_QD;
+    d_cursorIndex   = 0;
+    d_cursorOffset  = d_sectionOffset[e_QD];
+
+    return ntsa::Error();
+}
+
+ntsa::Error MessageView::qd(ntcdns::QuestionView* result,
+                            bsl::size_t           index) const
+{
+    BSLS_ASSERT(index < d_header.qdcount());
+
+    ntsa::Error error;
+
+    bsl::size_t position = 0;
+    error                = this->locate(&position, e_QD, index);
+    if (error) {
+        return error;
+    }
+
+    MemoryDecoder decoder(d_data, d_size);
+
+    error = decoder.seek(position);
+    if (error) {
+        return error;
+    }
+
+    return result->decode(&decoder);
+}
+
+ntsa::Error MessageView::an(ntcdns::ResourceRecordView* result,
+                            bsl::size_t                 index) const
+{
+    BSLS_ASSERT(index < d_header.ancount());
+    return this->record(result, e_AN, index);
+}
+
+ntsa::Error MessageView::ns(ntcdns::ResourceRecordView* result,
+                            bsl::size_t                 index) const
+{
+    BSLS_ASSERT(index < d_header.nscount());
+    return this->record(result, e_NS, index);
+}
+
+ntsa::Error MessageView::ar(ntcdns::ResourceRecordView* result,
+                            bsl::size_t                 index) const
+{
+    BSLS_ASSERT(index < d_header.arcount());
+    return this->record(result, e_AR, index);
+}
+
+ntsa::Error MessageView::load(ntcdns::Message* result) const
+{
+    result->reset();
+
+    if (d_data == 0) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    MemoryDecoder decoder(d_data, d_size);
+    return result->decode(&decoder);
+}
+
+const ntcdns::Header& MessageView::header() const
+{
+    return d_header;
+}
+
+bsl::uint16_t MessageView::id() const
+{
+    return d_header.id();
+}
+
+bool MessageView::tc() const
+{
+    return d_header.tc();
+}
+
+ntcdns::Error::Value MessageView::error() const
+{
+    return d_header.error();
+}
+
+bsl::size_t MessageView::qdcount() const
+{
+    return d_header.qdcount();
+}
+
+bsl::size_t MessageView::ancount() const
+{
+    return d_header.ancount();
+}
+
+bsl::size_t MessageView::nscount() const
+{
+    return d_header.nscount();
+}
+
+bsl::size_t MessageView::arcount() const
+{
+    return d_header.arcount();
+}
+
+const bsl::uint8_t* MessageView::data() const
+{
+    return d_data;
+}
+
+bsl::size_t MessageView::size() const
+{
+    return d_size;
+}
+
+bsl::ostream& operator<<(bsl::ostream&              stream,
+                         const ntcdns::MessageView& object)
+{
+    ntcdns::Message message;
+    if (!object.load(&message)) {
+        stream << message;
+    }
+    else {
+        stream << "[ header = " << object.header() << " ]";
+    }
+
+    return stream;
+}
+
+ntsa::Error MessageUtil::encodeQuery(
+    MemoryEncoder*                encoder,
+    bsl::uint16_t                 id,
+    const bslstl::StringRef&      name,
+    ntcdns::Type::Value           type,
+    ntcdns::Classification::Value classification)
+{
+    ntsa::Error error;
+
+    ntcdns::Header header;
+
+    header.setId(id);
+    header.setDirection(ntcdns::Direction::e_REQUEST);
+    header.setOperation(ntcdns::Operation::e_STANDARD);
+    header.setRd(true);
+    header.setQdcount(1);
+
+    error = header.encode(encoder);
+    if (error) {
+        return error;
+    }
+
+    error = encoder->encodeDomainName(name);
+    if (error) {
+        return error;
+    }
+
+    error = encoder->encodeUint16(static_cast<bsl::uint16_t>(type));
+    if (error) {
+        return error;
+    }
+
+    error = encoder->encodeUint16(static_cast<bsl::uint16_t>(classification));
+    if (error) {
+        return error;
+    }
+
+    return ntsa::Error();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
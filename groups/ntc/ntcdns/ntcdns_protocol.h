@@ -19,6 +19,7 @@
 #include <ntcdns_vocabulary.h>
 #include <ntcscm_version.h>
 #include <ntsa_error.h>
+#include <ntsa_ipaddress.h>
 #include <bdlb_bigendian.h>
 #include <bdlbb_blob.h>
 #include <bsls_platform.h>
@@ -76,7 +77,7 @@ class MemoryEncoder
     ntsa::Error encodeUint32(const bdlb::BigEndianUint32& value);
 
     /// Encode the specified domain name 'value'. Return the error.
-    ntsa::Error encodeDomainName(const bsl::string& value);
+    ntsa::Error encodeDomainName(const bslstl::StringRef& value);
 
     /// Encode the specified character string 'value'. Return the error.
     ntsa::Error encodeCharacterString(const bsl::string& value);
@@ -1115,6 +1116,335 @@ class Message
     friend bool operator!=(const Message& lhs, const Message& rhs);
 };
 
+/// @internal @brief
+/// Provide a view of a domain name encoded in a DNS message.
+///
+/// @details
+/// This class refers to the encoded domain name in the contiguous memory
+/// holding the whole DNS message, without copying it. Label compression
+/// pointers, described in RFC 1035 section 4.1.4, are resolved on demand
+/// each time the domain name is compared or loaded. The memory holding the
+/// DNS message must outlive this object.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntcdns
+class DomainNameView
+{
+    const bsl::uint8_t* d_message;
+    bsl::size_t         d_messageSize;
+    bsl::size_t         d_offset;
+
+  public:
+    /// Create a new, null domain name view.
+    DomainNameView();
+
+    /// Create a new domain name view of the domain name encoded at the
+    /// specified 'offset' in the specified 'message' having the specified
+    /// 'messageSize'.
+    DomainNameView(const bsl::uint8_t* message,
+                   bsl::size_t         messageSize,
+                   bsl::size_t         offset);
+
+    /// Reset the value of this object to its value upon default
+    /// construction.
+    void reset();
+
+    /// Load into the specified 'result' the domain name, with each label
+    /// separated by a '.'. Return the error.
+    ntsa::Error load(bsl::string* result) const;
+
+    /// Return true if the domain name, compared case-insensitively, is the
+    /// specified 'name', otherwise return false. A trailing '.' in the
+    /// 'name' is ignored. Note that this comparison does not allocate
+    /// memory.
+    bool equals(const bslstl::StringRef& name) const;
+
+    /// Return the offset of the encoded domain name from the start of the
+    /// DNS message.
+    bsl::size_t offset() const;
+
+    /// Return true if this view does not refer to a domain name, otherwise
+    /// return false.
+    bool isNull() const;
+
+    /// Advance the specified 'decoder' past the domain name encoded at its
+    /// current position, without resolving any label compression pointer.
+    /// Return the error.
+    static ntsa::Error skip(MemoryDecoder* decoder);
+};
+
+/// Write a formatted, human-readable description of the specified 'object'
+/// to the specified 'stream'.
+///
+/// @related ntcdns::DomainNameView
+bsl::ostream& operator<<(bsl::ostream&                 stream,
+                         const ntcdns::DomainNameView& object);
+
+/// @internal @brief
+/// Provide a view of a question encoded in a DNS message.
+///
+/// @details
+/// This class decodes the fixed-length fields of a question and refers to
+/// its name in the memory holding the DNS message, without allocating
+/// memory.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntcdns
+class QuestionView
+{
+    ntcdns::DomainNameView        d_name;
+    ntcdns::Type::Value           d_type;
+    ntcdns::Classification::Value d_classification;
+
+  public:
+    /// Create a new, null question view.
+    QuestionView();
+
+    /// Reset the value of this object to its value upon default
+    /// construction.
+    void reset();
+
+    /// Decode the object from the specified 'decoder', which must decode
+    /// the whole DNS message. Return the error.
+    ntsa::Error decode(MemoryDecoder* decoder);
+
+    /// Load into the specified 'result' a copy of the question. Return the
+    /// error.
+    ntsa::Error load(ntcdns::Question* result) const;
+
+    /// Return the "QNAME" field.
+    const ntcdns::DomainNameView& name() const;
+
+    /// Return the "QTYPE" field.
+    ntcdns::Type::Value type() const;
+
+    /// Return the "QCLASS" field.
+    ntcdns::Classification::Value classification() const;
+};
+
+/// @internal @brief
+/// Provide a view of a resource record encoded in a DNS message.
+///
+/// @details
+/// This class decodes the fixed-length fields of a resource record and
+/// refers to its name and its "RDATA" field in the memory holding the DNS
+/// message, without allocating memory. The "RDATA" field is interpreted on
+/// demand.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntcdns
+class ResourceRecordView
+{
+    const bsl::uint8_t*           d_message;
+    bsl::size_t                   d_messageSize;
+    bsl::size_t                   d_offset;
+    ntcdns::DomainNameView        d_name;
+    ntcdns::Type::Value           d_type;
+    ntcdns::Classification::Value d_classification;
+    bsl::uint32_t                 d_ttl;
+    bsl::size_t                   d_rdataOffset;
+    bsl::size_t                   d_rdataSize;
+
+  public:
+    /// Create a new, null resource record view.
+    ResourceRecordView();
+
+    /// Reset the value of this object to its value upon default
+    /// construction.
+    void reset();
+
+    /// Decode the object from the specified 'decoder', which must decode
+    /// the whole DNS message. Return the error.
+    ntsa::Error decode(MemoryDecoder* decoder);
+
+    /// Load into the specified 'result' the IP address in the "RDATA"
+    /// field. Return the error, notably 'ntsa::Error::e_INVALID' unless
+    /// the resource record is of type A or AAAA.
+    ntsa::Error loadIpAddress(ntsa::IpAddress* result) const;
+
+    /// Load into the specified 'result' a view of the domain name in the
+    /// "RDATA" field. Return the error, notably 'ntsa::Error::e_INVALID'
+    /// unless the resource record is of type CNAME, NS, or PTR.
+    ntsa::Error loadDomainName(ntcdns::DomainNameView* result) const;
+
+    /// Load into the specified 'result' a copy of the resource record,
+    /// fully decoding its "RDATA" field. Return the error.
+    ntsa::Error load(ntcdns::ResourceRecord* result) const;
+
+    /// Return the "NAME" field.
+    const ntcdns::DomainNameView& name() const;
+
+    /// Return the "TYPE" field.
+    ntcdns::Type::Value type() const;
+
+    /// Return the "CLASS" field.
+    ntcdns::Classification::Value classification() const;
+
+    /// Return the "TTL" field. For EDNS OPT pseudo-records, return the
+    /// "Extended RCODE and Flags" field.
+    bsl::uint32_t ttl() const;
+
+    /// Return the pointer to the "RDATA" field.
+    const bsl::uint8_t* rdata() const;
+
+    /// Return the number of octets in the "RDATA" field.
+    bsl::size_t rdataSize() const;
+};
+
+/// @internal @brief
+/// Provide a view of a DNS message in contiguous memory.
+///
+/// @details
+/// This class decodes the header of a DNS message and validates the framing
+/// of each question and resource record, recording the offset of each
+/// section, but does not copy any name or record data. Questions and
+/// resource records are decoded on demand into views of the memory holding
+/// the message. Accessing the records of a section in increasing order of
+/// their index visits each record once. The memory holding the DNS message
+/// must outlive this object.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntcdns
+class MessageView
+{
+    enum Section { e_QD = 0, e_AN = 1, e_NS = 2, e_AR = 3, e_END = 4 };
+
+    const bsl::uint8_t* d_data;
+    bsl::size_t         d_size;
+    ntcdns::Header      d_header;
+    bsl::size_t         d_sectionOffset[5];
+    mutable bsl::size_t d_cursorSection;
+    mutable bsl::size_t d_cursorIndex;
+    mutable bsl::size_t d_cursorOffset;
+
+  private:
+    MessageView(const MessageView&) BSLS_KEYWORD_DELETED;
+    MessageView& operator=(const MessageView&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Load into the specified 'result' the offset of the record at the
+    /// specified 'index' in the specified 'section'. Return the error.
+    ntsa::Error locate(bsl::size_t* result,
+                       Section      section,
+                       bsl::size_t  index) const;
+
+    /// Load into the specified 'result' the resource record at the
+    /// specified 'index' in the specified 'section'. Return the error.
+    ntsa::Error record(ntcdns::ResourceRecordView* result,
+                       Section                     section,
+                       bsl::size_t                 index) const;
+
+  public:
+    /// Create a new, empty message view.
+    MessageView();
+
+    /// Destroy this object.
+    ~MessageView();
+
+    /// Reset the value of this object to its value upon default
+    /// construction.
+    void reset();
+
+    /// Decode the DNS message in the specified 'data' having the specified
+    /// 'size'. Return the error.
+    ntsa::Error decode(const bsl::uint8_t* data, bsl::size_t size);
+
+    /// Load into the specified 'result' the question at the specified
+    /// 'index' in the question section. Return the error. The behavior is
+    /// undefined unless 'index < qdcount()'.
+    ntsa::Error qd(ntcdns::QuestionView* result, bsl::size_t index) const;
+
+    /// Load into the specified 'result' the resource record at the
+    /// specified 'index' in the answers section. Return the error. The
+    /// behavior is undefined unless 'index < ancount()'.
+    ntsa::Error an(ntcdns::ResourceRecordView* result,
+                   bsl::size_t                 index) const;
+
+    /// Load into the specified 'result' the resource record at the
+    /// specified 'index' in the name server section. Return the error. The
+    /// behavior is undefined unless 'index < nscount()'.
+    ntsa::Error ns(ntcdns::ResourceRecordView* result,
+                   bsl::size_t                 index) const;
+
+    /// Load into the specified 'result' the resource record at the
+    /// specified 'index' in the additional records section. Return the
+    /// error. The behavior is undefined unless 'index < arcount()'.
+    ntsa::Error ar(ntcdns::ResourceRecordView* result,
+                   bsl::size_t                 index) const;
+
+    /// Load into the specified 'result' a copy of the whole message. Return
+    /// the error.
+    ntsa::Error load(ntcdns::Message* result) const;
+
+    /// Return the header.
+    const ntcdns::Header& header() const;
+
+    /// Return the "ID" field.
+    bsl::uint16_t id() const;
+
+    /// Return the "TC" field.
+    bool tc() const;
+
+    /// Return the "RCODE" field.
+    ntcdns::Error::Value error() const;
+
+    /// Return the "QDCOUNT" field.
+    bsl::size_t qdcount() const;
+
+    /// Return the "ANCOUNT" field.
+    bsl::size_t ancount() const;
+
+    /// Return the "NSCOUNT" field.
+    bsl::size_t nscount() const;
+
+    /// Return the "ARCOUNT" field.
+    bsl::size_t arcount() const;
+
+    /// Return the pointer to the encoded message.
+    const bsl::uint8_t* data() const;
+
+    /// Return the size of the encoded message.
+    bsl::size_t size() const;
+};
+
+/// Write a formatted, human-readable description of the specified 'object'
+/// to the specified 'stream'. Note that the description is formatted from
+/// a fully-decoded copy of the message.
+///
+/// @related ntcdns::MessageView
+bsl::ostream& operator<<(bsl::ostream&              stream,
+                         const ntcdns::MessageView& object);
+
+/// @internal @brief
+/// Provide utilities for encoding DNS messages.
+///
+/// @par Thread Safety
+/// This struct is thread safe.
+///
+/// @ingroup module_ntcdns
+struct MessageUtil {
+    /// Encode to the specified 'encoder' a standard query, identified by the
+    /// specified 'id' and requesting recursion, having a single question
+    /// for the specified 'name' of the specified 'type' in the specified
+    /// 'classification'. Return the error. Note that the query is encoded
+    /// directly, without building an 'ntcdns::Message', so this function
+    /// does not allocate memory.
+    static ntsa::Error encodeQuery(
+        MemoryEncoder*                encoder,
+        bsl::uint16_t                 id,
+        const bslstl::StringRef&      name,
+        ntcdns::Type::Value           type,
+        ntcdns::Classification::Value classification);
+};
+
 }  // close package namespace
 }  // close enterprise namespace
 #endif
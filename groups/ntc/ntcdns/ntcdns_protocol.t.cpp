@@ -17,6 +17,7 @@
 
 #include <ntccfg_test.h>
 #include <ntci_log.h>
+#include <ntsa_ipaddress.h>
 #include <ntsa_ipv4address.h>
 #include <ntsa_ipv6address.h>
 
@@ -525,11 +526,139 @@ NTCCFG_TEST_CASE(4)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+NTCCFG_TEST_CASE(5)
+{
+    // Concern: Messages are decoded through views and queries are encoded
+    // directly.
+    // Plan:
+
+    NTCI_LOG_CONTEXT();
+
+    ntsa::Error error;
+
+    // clang-format off
+    const bsl::uint8_t REQUEST[] = {
+        0x33, 0x7b, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x06, 0x67, 0x6f, 0x6f,
+        0x67, 0x6c, 0x65, 0x03, 0x63, 0x6f, 0x6d, 0x00,
+        0x00, 0x01, 0x00, 0x01
+    };
+
+    const bsl::uint8_t RESPONSE[] = {
+        0x33, 0x7b, 0x81, 0x80, 0x00, 0x01, 0x00, 0x01,
+        0x00, 0x00, 0x00, 0x00, 0x06, 0x67, 0x6f, 0x6f,
+        0x67, 0x6c, 0x65, 0x03, 0x63, 0x6f, 0x6d, 0x00,
+        0x00, 0x01, 0x00, 0x01, 0xc0, 0x0c, 0x00, 0x01,
+        0x00, 0x01, 0x00, 0x00, 0x00, 0x77, 0x00, 0x04,
+        0xac, 0xd9, 0x06, 0xee
+    };
+    // clang-format on
+
+    ntccfg::TestAllocator ta;
+    {
+        {
+            bsl::uint8_t buffer[512];
+
+            ntcdns::MemoryEncoder encoder(buffer, sizeof buffer);
+
+            error = ntcdns::MessageUtil::encodeQuery(
+                &encoder,
+                13179,
+                "google.com",
+                ntcdns::Type::e_A,
+                ntcdns::Classification::e_INTERNET);
+            NTCCFG_TEST_OK(error);
+
+            NTCCFG_TEST_EQ(encoder.position(), sizeof REQUEST);
+            NTCCFG_TEST_EQ(
+                bsl::memcmp(buffer, REQUEST, sizeof REQUEST), 0);
+        }
+
+        ntcdns::MessageView view;
+
+        error = view.decode(RESPONSE, sizeof RESPONSE);
+        NTCCFG_TEST_OK(error);
+
+        NTCCFG_TEST_EQ(view.id(), 13179);
+        NTCCFG_TEST_EQ(view.tc(), false);
+        NTCCFG_TEST_EQ(view.error(), ntcdns::Error::e_OK);
+        NTCCFG_TEST_EQ(view.qdcount(), 1);
+        NTCCFG_TEST_EQ(view.ancount(), 1);
+        NTCCFG_TEST_EQ(view.nscount(), 0);
+        NTCCFG_TEST_EQ(view.arcount(), 0);
+
+        ntcdns::QuestionView question;
+        error = view.qd(&question, 0);
+        NTCCFG_TEST_OK(error);
+
+        NTCCFG_TEST_TRUE(question.name().equals("google.com"));
+        NTCCFG_TEST_TRUE(question.name().equals("Google.COM."));
+        NTCCFG_TEST_FALSE(question.name().equals("google"));
+        NTCCFG_TEST_FALSE(question.name().equals("google.co"));
+        NTCCFG_TEST_FALSE(question.name().equals("google.com.au"));
+        NTCCFG_TEST_EQ(question.type(), ntcdns::Type::e_A);
+
+        ntcdns::ResourceRecordView answer;
+        error = view.an(&answer, 0);
+        NTCCFG_TEST_OK(error);
+
+        // The answer name is a compression pointer to the question name.
+
+        NTCCFG_TEST_TRUE(answer.name().equals("google.com"));
+        NTCCFG_TEST_EQ(answer.type(), ntcdns::Type::e_A);
+        NTCCFG_TEST_EQ(answer.classification(),
+                       ntcdns::Classification::e_INTERNET);
+        NTCCFG_TEST_EQ(answer.ttl(), 119);
+        NTCCFG_TEST_EQ(answer.rdataSize(), 4);
+
+        ntsa::IpAddress ipAddress;
+        error = answer.loadIpAddress(&ipAddress);
+        NTCCFG_TEST_OK(error);
+        NTCCFG_TEST_EQ(ipAddress, ntsa::IpAddress("172.217.6.238"));
+
+        bsl::string name(&ta);
+        error = answer.name().load(&name);
+        NTCCFG_TEST_OK(error);
+        NTCCFG_TEST_EQ(name, "google.com");
+
+        ntcdns::Message message(&ta);
+        error = view.load(&message);
+        NTCCFG_TEST_OK(error);
+
+        NTCCFG_TEST_EQ(message.an(0).name(), "google.com");
+        NTCCFG_TEST_EQ(message.an(0).ttl(), 119);
+
+        // A truncated message fails to decode.
+
+        ntcdns::MessageView truncated;
+        error = truncated.decode(RESPONSE, sizeof RESPONSE - 1);
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_INVALID));
+
+        // A compression pointer that refers to itself is rejected.
+
+        bsl::uint8_t looped[sizeof RESPONSE];
+        bsl::memcpy(looped, RESPONSE, sizeof RESPONSE);
+        looped[29] = 0x1c;
+
+        ntcdns::MessageView loopedView;
+        error = loopedView.decode(looped, sizeof looped);
+        NTCCFG_TEST_OK(error);
+
+        error = loopedView.an(&answer, 0);
+        NTCCFG_TEST_OK(error);
+
+        error = answer.name().load(&name);
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_INVALID));
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
     NTCCFG_TEST_REGISTER(2);
     NTCCFG_TEST_REGISTER(3);
     NTCCFG_TEST_REGISTER(4);
+    NTCCFG_TEST_REGISTER(5);
 }
 NTCCFG_TEST_DRIVER_END;
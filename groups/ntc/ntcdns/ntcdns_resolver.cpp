@@ -145,6 +145,317 @@ void processGetIpAddressResult(
     callback(resolver, endpoint, getEndpointEvent, ntci::Strand::unknown());
 }
 
+void processRefreshResult(const bsl::shared_ptr<ntci::Resolver>& resolver,
+                          const bsl::vector<ntsa::IpAddress>&    ipAddressList,
+                          const ntca::GetIpAddressEvent&         event)
+{
+    NTCCFG_WARNING_UNUSED(resolver);
+    NTCCFG_WARNING_UNUSED(ipAddressList);
+
+    NTCI_LOG_CONTEXT();
+
+    if (event.type() != ntca::GetIpAddressEventType::e_COMPLETE) {
+        NTCI_LOG_STREAM_DEBUG << "Failed to refresh the domain name '"
+                              << event.context().domainName()
+                              << "': " << event.context().error()
+                              << NTCI_LOG_STREAM_END;
+    }
+}
+
+/// Provide the state of the resolution of the targets of the SRV records
+/// assigned to a service name into the endpoints of the service.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+class ServiceEndpointsResolution
+: public ntccfg::Shared<ServiceEndpointsResolution>
+{
+    /// Define a type alias for a vector of SRV records.
+    typedef bsl::vector<ntcdns::ResourceRecordDataSvr> RecordList;
+
+    /// Define a type alias for a vector of IP address lists, one for each
+    /// SRV record.
+    typedef bsl::vector<bsl::vector<ntsa::IpAddress> > IpAddressListList;
+
+    bslmt::Mutex                      d_mutex;
+    RecordList                        d_recordList;
+    IpAddressListList                 d_ipAddressListList;
+    bsl::size_t                       d_numPending;
+    ntca::GetServiceEndpointsContext  d_context;
+    bsls::TimeInterval                d_startTime;
+    ntci::GetServiceEndpointsCallback d_callback;
+    bslma::Allocator*                 d_allocator_p;
+
+  private:
+    ServiceEndpointsResolution(const ServiceEndpointsResolution&)
+        BSLS_KEYWORD_DELETED;
+    ServiceEndpointsResolution& operator=(const ServiceEndpointsResolution&)
+        BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Order the records whose targets have resolved, combine the port of
+    /// each record with the IP addresses of its target, and invoke the
+    /// callback with the resulting endpoints on behalf of the specified
+    /// 'resolver'.
+    void complete(const bsl::shared_ptr<ntcdns::Resolver>& resolver);
+
+  public:
+    /// Create a new resolution of the targets of the specified
+    /// 'recordList' described by the specified 'context', started at the
+    /// specified 'startTime', that invokes the specified 'callback' when
+    /// complete. Optionally specify a 'basicAllocator' used to supply
+    /// memory. If 'basicAllocator' is 0, the currently installed default
+    /// allocator is used.
+    ServiceEndpointsResolution(
+        const RecordList&                        recordList,
+        const ntca::GetServiceEndpointsContext&  context,
+        const bsls::TimeInterval&                startTime,
+        const ntci::GetServiceEndpointsCallback& callback,
+        bslma::Allocator*                        basicAllocator = 0);
+
+    /// Destroy this object.
+    ~ServiceEndpointsResolution();
+
+    /// Resolve the target of each record using the specified 'resolver'
+    /// according to the specified 'options'.
+    void start(const bsl::shared_ptr<ntcdns::Resolver>& resolver,
+               const ntca::GetServiceEndpointsOptions&  options);
+
+    /// Process the resolution of the target of the record at the specified
+    /// 'index' to the specified 'ipAddressList' by the specified 'resolver'
+    /// according to the specified 'event'.
+    void processIpAddress(bsl::size_t                            index,
+                          const bsl::shared_ptr<ntci::Resolver>& resolver,
+                          const bsl::vector<ntsa::IpAddress>&    ipAddressList,
+                          const ntca::GetIpAddressEvent&         event);
+};
+
+ServiceEndpointsResolution::ServiceEndpointsResolution(
+    const RecordList&                        recordList,
+    const ntca::GetServiceEndpointsContext&  context,
+    const bsls::TimeInterval&                startTime,
+    const ntci::GetServiceEndpointsCallback& callback,
+    bslma::Allocator*                        basicAllocator)
+: d_mutex()
+, d_recordList(recordList, basicAllocator)
+, d_ipAddressListList(recordList.size(), basicAllocator)
+, d_numPending(recordList.size())
+, d_context(context, basicAllocator)
+, d_startTime(startTime)
+, d_callback(callback, basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+ServiceEndpointsResolution::~ServiceEndpointsResolution()
+{
+}
+
+void ServiceEndpointsResolution::start(
+    const bsl::shared_ptr<ntcdns::Resolver>& resolver,
+    const ntca::GetServiceEndpointsOptions&  options)
+{
+    bsl::shared_ptr<ServiceEndpointsResolution> self = this->getSelf(this);
+
+    ntca::GetIpAddressOptions getIpAddressOptions;
+
+    if (!options.ipAddressType().isNull()) {
+        getIpAddressOptions.setIpAddressType(options.ipAddressType().value());
+    }
+
+    if (!options.transport().isNull()) {
+        getIpAddressOptions.setTransport(options.transport().value());
+    }
+
+    if (!options.deadline().isNull()) {
+        getIpAddressOptions.setDeadline(options.deadline().value());
+    }
+
+    for (bsl::size_t i = 0; i < d_recordList.size(); ++i) {
+        ntci::GetIpAddressCallback getIpAddressCallback =
+            resolver->createGetIpAddressCallback(
+                bdlf::BindUtil::bind(
+                    &ServiceEndpointsResolution::processIpAddress,
+                    self,
+                    i,
+                    bdlf::PlaceHolders::_1,
+                    bdlf::PlaceHolders::_2,
+                    bdlf::PlaceHolders::_3),
+                d_allocator_p);
+
+        ntsa::Error error = resolver->getIpAddress(d_recordList[i].target(),
+                                                   getIpAddressOptions,
+                                                   getIpAddressCallback);
+        if (error) {
+            ntca::GetIpAddressContext getIpAddressContext;
+            getIpAddressContext.setDomainName(d_recordList[i].target());
+            getIpAddressContext.setError(error);
+
+            ntca::GetIpAddressEvent getIpAddressEvent;
+            getIpAddressEvent.setType(ntca::GetIpAddressEventType::e_ERROR);
+            getIpAddressEvent.setContext(getIpAddressContext);
+
+            this->processIpAddress(i,
+                                   resolver,
+                                   bsl::vector<ntsa::IpAddress>(),
+                                   getIpAddressEvent);
+        }
+    }
+}
+
+void ServiceEndpointsResolution::processIpAddress(
+    bsl::size_t                            index,
+    const bsl::shared_ptr<ntci::Resolver>& resolver,
+    const bsl::vector<ntsa::IpAddress>&    ipAddressList,
+    const ntca::GetIpAddressEvent&         event)
+{
+    NTCI_LOG_CONTEXT();
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    BSLS_ASSERT(index < d_ipAddressListList.size());
+    BSLS_ASSERT(d_numPending > 0);
+
+    if (event.type() == ntca::GetIpAddressEventType::e_COMPLETE) {
+        d_ipAddressListList[index] = ipAddressList;
+    }
+    else {
+        NTCI_LOG_STREAM_DEBUG << "Failed to resolve the target '"
+                              << d_recordList[index].target()
+                              << "' of the service '" << d_context.name()
+                              << "': " << event.context().error()
+                              << NTCI_LOG_STREAM_END;
+    }
+
+    if (--d_numPending == 0) {
+        this->complete(bsl::static_pointer_cast<ntcdns::Resolver>(resolver));
+    }
+}
+
+void ServiceEndpointsResolution::complete(
+    const bsl::shared_ptr<ntcdns::Resolver>& resolver)
+{
+    // Discard the records whose targets did not resolve to any IP address,
+    // then order the remaining records. The order is randomized each time
+    // the service is resolved, even when the records are cached, so that
+    // the load is distributed among the targets according to their weights.
+
+    RecordList recordList(d_allocator_p);
+    recordList.reserve(d_recordList.size());
+
+    for (bsl::size_t i = 0; i < d_recordList.size(); ++i) {
+        if (!d_ipAddressListList[i].empty()) {
+            recordList.push_back(d_recordList[i]);
+        }
+    }
+
+    int seed = static_cast<int>(d_startTime.totalMicroseconds());
+    ntcdns::Utility::sortServerList(&recordList, &seed);
+
+    bsl::vector<ntsa::Endpoint> endpointList(d_allocator_p);
+
+    for (bsl::size_t i = 0; i < recordList.size(); ++i) {
+        const ntcdns::ResourceRecordDataSvr& record = recordList[i];
+
+        for (bsl::size_t j = 0; j < d_recordList.size(); ++j) {
+            if (d_recordList[j].target() != record.target() ||
+                d_recordList[j].port() != record.port())
+            {
+                continue;
+            }
+
+            const bsl::vector<ntsa::IpAddress>& ipAddressList =
+                d_ipAddressListList[j];
+
+            for (bsl::size_t k = 0; k < ipAddressList.size(); ++k) {
+                endpointList.push_back(ntsa::Endpoint(
+                    ntsa::IpEndpoint(ipAddressList[k], record.port())));
+            }
+
+            break;
+        }
+    }
+
+    bsls::TimeInterval endTime = bdlt::CurrentTime::now();
+    if (endTime > d_startTime) {
+        d_context.setLatency(endTime - d_startTime);
+    }
+
+    ntca::GetServiceEndpointsEvent event;
+
+    if (!endpointList.empty()) {
+        event.setType(ntca::GetServiceEndpointsEventType::e_COMPLETE);
+    }
+    else {
+        d_context.setError(ntsa::Error(ntsa::Error::e_EOF));
+        event.setType(ntca::GetServiceEndpointsEventType::e_ERROR);
+    }
+
+    event.setContext(d_context);
+
+    d_callback.dispatch(resolver,
+                        endpointList,
+                        event,
+                        resolver->strand(),
+                        resolver,
+                        true,
+                        &d_mutex);
+
+    d_callback.reset();
+}
+
+/// Process the specified 'recordList' assigned to the service name
+/// described by the specified 'context', resolved on behalf of the specified
+/// 'resolver' starting at the specified 'startTime', by resolving the
+/// targets of the 'recordList' according to the specified 'options' then
+/// invoking the specified 'callback'.
+void processGetServerListResult(
+    const bsl::shared_ptr<ntcdns::Resolver>&          resolver,
+    const bsl::vector<ntcdns::ResourceRecordDataSvr>& recordList,
+    const ntca::GetServiceEndpointsContext&           context,
+    const bsls::TimeInterval&                         startTime,
+    const ntca::GetServiceEndpointsOptions&           options,
+    const ntci::GetServiceEndpointsCallback&          callback,
+    bslma::Allocator*                                 allocator)
+{
+    if (context.error() || recordList.empty()) {
+        ntca::GetServiceEndpointsContext getServiceEndpointsContext(context);
+        if (!context.error()) {
+            getServiceEndpointsContext.setError(
+                ntsa::Error(ntsa::Error::e_EOF));
+        }
+
+        bsls::TimeInterval endTime = bdlt::CurrentTime::now();
+        if (endTime > startTime) {
+            getServiceEndpointsContext.setLatency(endTime - startTime);
+        }
+
+        ntca::GetServiceEndpointsEvent getServiceEndpointsEvent;
+        getServiceEndpointsEvent.setType(
+            ntca::GetServiceEndpointsEventType::e_ERROR);
+        getServiceEndpointsEvent.setContext(getServiceEndpointsContext);
+
+        callback.dispatch(resolver,
+                          bsl::vector<ntsa::Endpoint>(),
+                          getServiceEndpointsEvent,
+                          resolver->strand(),
+                          resolver,
+                          true,
+                          0);
+        return;
+    }
+
+    bsl::shared_ptr<ServiceEndpointsResolution> resolution;
+    resolution.createInplace(allocator,
+                             recordList,
+                             context,
+                             startTime,
+                             callback,
+                             allocator);
+
+    resolution->start(resolver, options);
+}
+
 }  // close unnamed namespace
 
 ntsa::Error Resolver::initialize()
@@ -883,12 +1194,14 @@ ntsa::Error Resolver::getIpAddress(const bslstl::StringRef&         domainName,
     if (d_cache_sp) {
         bsl::vector<ntsa::IpAddress> ipAddressList;
         ntca::GetIpAddressContext    getIpAddressContext;
+        bool                         refresh = false;
 
         error = d_cache_sp->getIpAddress(&getIpAddressContext,
                                          &ipAddressList,
                                          domainName,
                                          options,
-                                         startTime);
+                                         startTime,
+                                         &refresh);
         if (!error) {
             bsls::TimeInterval endTime = bdlt::CurrentTime::now();
             if (endTime > startTime) {
@@ -907,6 +1220,26 @@ ntsa::Error Resolver::getIpAddress(const bslstl::StringRef&         domainName,
                               true,
                               0);
 
+            // If the cached result is popular but close to its expiration,
+            // re-resolve the domain name from the name servers in the
+            // background so the cache is updated before the result expires.
+            // The cache indicates a refresh at most once for each result.
+
+            if (refresh && d_client_sp) {
+                ntci::GetIpAddressCallback refreshCallback =
+                    this->createGetIpAddressCallback(
+                        bdlf::BindUtil::bind(&processRefreshResult,
+                                             bdlf::PlaceHolders::_1,
+                                             bdlf::PlaceHolders::_2,
+                                             bdlf::PlaceHolders::_3),
+                        d_allocator_p);
+
+                d_client_sp->getIpAddress(self,
+                                          domainName,
+                                          options,
+                                          refreshCallback);
+            }
+
             return ntsa::Error();
         }
     }
@@ -1902,6 +2235,97 @@ ntsa::Error Resolver::getEndpoint(const bslstl::StringRef&         text,
     return ntsa::Error();
 }
 
+ntsa::Error Resolver::getServiceEndpoints(
+    const bslstl::StringRef&                 name,
+    const ntca::GetServiceEndpointsOptions&  options,
+    const ntci::GetServiceEndpointsCallback& callback)
+{
+    ntsa::Error error;
+
+    bsl::shared_ptr<Resolver> self = this->getSelf(this);
+
+    bsls::TimeInterval startTime = bdlt::CurrentTime::now();
+
+    bsl::vector<ntcdns::ResourceRecordDataSvr> recordList;
+    ntca::GetServiceEndpointsContext           context;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        // Lazily initialize each enabled mechanism used by this object, if
+        // necessary.
+
+        if (!d_initialized) {
+            error = this->initialize();
+            if (error) {
+                return error;
+            }
+        }
+
+        // Get the SRV records assigned to the service name from the cache,
+        // if enabled. Note that the resolution of the targets of the records
+        // re-enters this object, so the records are processed after the
+        // mutex is released.
+
+        if (d_cache_sp) {
+            error = d_cache_sp->getServerList(&context,
+                                              &recordList,
+                                              name,
+                                              startTime);
+        }
+        else {
+            error = ntsa::Error(ntsa::Error::e_EOF);
+        }
+    }
+
+    if (!error) {
+        processGetServerListResult(self,
+                                   recordList,
+                                   context,
+                                   startTime,
+                                   options,
+                                   callback,
+                                   d_allocator_p);
+        return ntsa::Error();
+    }
+
+    // Get the SRV records assigned to the service name from the name
+    // servers, if enabled.
+
+    if (d_client_sp) {
+        error = d_client_sp->getServerList(
+            name,
+            options,
+            bdlf::BindUtil::bindS(d_allocator_p,
+                                  &processGetServerListResult,
+                                  self,
+                                  bdlf::PlaceHolders::_1,
+                                  bdlf::PlaceHolders::_2,
+                                  startTime,
+                                  options,
+                                  callback,
+                                  d_allocator_p));
+        if (!error) {
+            return ntsa::Error();
+        }
+    }
+
+    // The resolution has failed.
+
+    context.setName(name);
+    context.setError(ntsa::Error(ntsa::Error::e_EOF));
+
+    processGetServerListResult(self,
+                               bsl::vector<ntcdns::ResourceRecordDataSvr>(),
+                               context,
+                               startTime,
+                               options,
+                               callback,
+                               d_allocator_p);
+
+    return ntsa::Error();
+}
+
 ntsa::Error Resolver::getLocalIpAddress(bsl::vector<ntsa::IpAddress>* result,
                                         const ntsa::IpAddressOptions& options)
 {
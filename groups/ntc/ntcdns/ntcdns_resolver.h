@@ -314,6 +314,21 @@ class Resolver : public ntci::Resolver, public ntccfg::Shared<Resolver>
                             const ntci::GetEndpointCallback& callback)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Resolve the specified service 'name', in the form
+    /// '_<service>._<protocol>.<domain>', to the endpoints of the servers
+    /// providing that service, according to the specified 'options'. Query
+    /// the SRV records assigned to the 'name', resolve the target of each
+    /// record to its IP addresses, then order the resulting endpoints by
+    /// ascending priority and, within each priority, by a weighted random
+    /// selection, as described in RFC 2782. When resolution completes or
+    /// fails, invoke the specified 'callback' on the callback's strand, if
+    /// any, with the ordered endpoints. Return the error.
+    ntsa::Error getServiceEndpoints(
+        const bslstl::StringRef&                 name,
+        const ntca::GetServiceEndpointsOptions&  options,
+        const ntci::GetServiceEndpointsCallback& callback)
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Load into the specified 'result' the IP addresses assigned to the
     /// local machine. Perform all resolution and validation of the
     /// characteristics of the desired 'result' according to the specified
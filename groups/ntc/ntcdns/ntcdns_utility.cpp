@@ -18,6 +18,7 @@
 #include <ntci_log.h>
 
 #include <bdlb_chartype.h>
+#include <bdlb_random.h>
 #include <bdlb_string.h>
 #include <bdlb_stringrefutil.h>
 #include <bdlb_tokenizer.h>
@@ -31,6 +32,8 @@
 #include <bsls_platform.h>
 #include <bsls_stopwatch.h>
 
+#include <bsl_algorithm.h>
+#include <bsl_cstdint.h>
 #include <bsl_fstream.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
@@ -915,6 +918,20 @@ void sanitizeClientConfig(ntcdns::ClientConfig* config)
     }
 }
 
+/// Return true if the specified 'lhs' server should be ordered before the
+/// specified 'rhs' server when sorting servers by priority, with the servers
+/// having zero weight ordered first among servers having the same priority,
+/// otherwise return false.
+bool isServerOrderedBefore(const ntcdns::ResourceRecordDataSvr& lhs,
+                           const ntcdns::ResourceRecordDataSvr& rhs)
+{
+    if (lhs.priority() != rhs.priority()) {
+        return lhs.priority() < rhs.priority();
+    }
+
+    return (lhs.weight() == 0) && (rhs.weight() != 0);
+}
+
 }  // close unnamed namespace
 
 File::File(bslma::Allocator* basicAllocator)
@@ -1217,6 +1234,66 @@ bsl::size_t File::size() const
     return d_size;
 }
 
+FileStamp::FileStamp()
+: d_modificationTime()
+, d_size(0)
+{
+}
+
+ntsa::Error FileStamp::load(const bslstl::StringRef& path)
+{
+    bsl::string pathString(path);
+
+    int rc = bdls::FilesystemUtil::getLastModificationTime(
+        &d_modificationTime,
+        pathString);
+    if (rc != 0) {
+        return ntsa::Error(ntsa::Error::e_EOF);
+    }
+
+    bdls::FilesystemUtil::Offset size =
+        bdls::FilesystemUtil::getFileSize(pathString);
+    if (size < 0) {
+        return ntsa::Error(ntsa::Error::e_EOF);
+    }
+
+    d_size = static_cast<bsls::Types::Int64>(size);
+
+    return ntsa::Error();
+}
+
+void FileStamp::reset()
+{
+    d_modificationTime = bdlt::Datetime();
+    d_size             = 0;
+}
+
+const bdlt::Datetime& FileStamp::modificationTime() const
+{
+    return d_modificationTime;
+}
+
+bsls::Types::Int64 FileStamp::size() const
+{
+    return d_size;
+}
+
+bool FileStamp::equals(const FileStamp& other) const
+{
+    return d_modificationTime == other.d_modificationTime &&
+           d_size == other.d_size;
+}
+
+bool operator==(const FileStamp& lhs, const FileStamp& rhs)
+{
+    return lhs.equals(rhs);
+}
+
+bool operator!=(const FileStamp& lhs, const FileStamp& rhs)
+{
+    return !operator==(lhs, rhs);
+}
+
 ntsa::Error Utility::loadResolverConfig(ntcdns::ResolverConfig* result)
 {
     ntsa::Error error;
@@ -1620,5 +1697,82 @@ void Utility::sanitize(ntcdns::ResolverConfig* config)
     }
 }
 
+void Utility::sortServerList(
+    bsl::vector<ntcdns::ResourceRecordDataSvr>* serverList,
+    int*                                        seed)
+{
+    typedef bsl::vector<ntcdns::ResourceRecordDataSvr> ServerList;
+
+    ServerList input;
+    input.reserve(serverList->size());
+
+    for (ServerList::const_iterator it = serverList->begin();
+         it != serverList->end();
+         ++it)
+    {
+        if (it->target().empty() || it->target() == ".") {
+            continue;
+        }
+
+        input.push_back(*it);
+    }
+
+    // Order the servers by priority, then place the servers having zero
+    // weight at the beginning of each run of servers having the same
+    // priority, as recommended by RFC 2782, so that they have a very small
+    // chance of being selected while servers having a non-zero weight
+    // remain.
+
+    bsl::stable_sort(input.begin(), input.end(), &isServerOrderedBefore);
+
+    serverList->clear();
+    serverList->reserve(input.size());
+
+    bsl::size_t begin = 0;
+    while (begin < input.size()) {
+        bsl::size_t end = begin + 1;
+        while (end < input.size() &&
+               input[end].priority() == input[begin].priority())
+        {
+            ++end;
+        }
+
+        // Repeatedly select a server from the remaining servers having the
+        // same priority: choose a uniform random number between zero and
+        // the sum of the remaining weights, inclusive, and select the first
+        // server whose running sum of weights is greater than or equal to
+        // that number.
+
+        while (begin < end) {
+            bsl::uint64_t weightSum = 0;
+            for (bsl::size_t i = begin; i < end; ++i) {
+                weightSum += input[i].weight();
+            }
+
+            const bsl::uint64_t random =
+                (static_cast<bsl::uint64_t>(bdlb::Random::generate15(seed))
+                 << 15) |
+                static_cast<bsl::uint64_t>(bdlb::Random::generate15(seed));
+
+            const bsl::uint64_t threshold = random % (weightSum + 1);
+
+            bsl::size_t   selection  = begin;
+            bsl::uint64_t runningSum = 0;
+            for (bsl::size_t i = begin; i < end; ++i) {
+                runningSum += input[i].weight();
+                if (runningSum >= threshold) {
+                    selection = i;
+                    break;
+                }
+            }
+
+            serverList->push_back(input[selection]);
+
+            input.erase(input.begin() + selection);
+            --end;
+        }
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
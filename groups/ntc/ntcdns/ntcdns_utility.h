@@ -24,8 +24,10 @@
 #include <ntsa_port.h>
 #include <bdlb_nullablevalue.h>
 #include <bdls_filesystemutil.h>
+#include <bdlt_datetime.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
+#include <bsls_types.h>
 #include <bsl_array.h>
 #include <bsl_functional.h>
 #include <bsl_list.h>
@@ -86,6 +88,57 @@ class File
     bsl::size_t size() const;
 };
 
+/// @internal @brief
+/// Describe the modification time and size of a file.
+///
+/// @details
+/// A file stamp is used to detect whether a file has been modified since it
+/// was last loaded, without loading the file.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntcdns
+class FileStamp
+{
+    bdlt::Datetime     d_modificationTime;
+    bsls::Types::Int64 d_size;
+
+  public:
+    /// Create a new, empty file stamp.
+    FileStamp();
+
+    /// Load the stamp of the file at the specified 'path'. Return the
+    /// error.
+    ntsa::Error load(const bslstl::StringRef& path);
+
+    /// Reset the value of this object to its value upon default
+    /// construction.
+    void reset();
+
+    /// Return the time the file was last modified.
+    const bdlt::Datetime& modificationTime() const;
+
+    /// Return the size of the file.
+    bsls::Types::Int64 size() const;
+
+    /// Return true if this object has the same value as the specified
+    /// 'other' object, otherwise return false.
+    bool equals(const FileStamp& other) const;
+};
+
+/// Return true if the specified 'lhs' has the same value as the specified
+/// 'rhs', otherwise return false.
+///
+/// @related ntcdns::FileStamp
+bool operator==(const FileStamp& lhs, const FileStamp& rhs);
+
+/// Return true if the specified 'lhs' does not have the same value as the
+/// specified 'rhs', otherwise return false.
+///
+/// @related ntcdns::FileStamp
+bool operator!=(const FileStamp& lhs, const FileStamp& rhs);
+
 /// @internal @brief
 /// Provide utilities for DNS clients and servers.
 ///
@@ -152,6 +205,18 @@ struct Utility {
 
     /// Ensure sensible defaults for the specified 'config'.
     static void sanitize(ntcdns::ResolverConfig* config);
+
+    /// Sort the specified 'serverList' into the order in which the targets
+    /// of a service should be contacted, as defined by RFC 2782: in
+    /// ascending order of priority and, among servers having the same
+    /// priority, in a random order in which each next server is selected
+    /// with a probability proportional to its weight. Remove any server
+    /// whose target is ".", which indicates the service is decidedly not
+    /// available at the domain. Use the specified 'seed' to generate the
+    /// random order.
+    static void sortServerList(
+        bsl::vector<ntcdns::ResourceRecordDataSvr>* serverList,
+        int*                                        seed);
 };
 
 /// @internal @brief
@@ -533,6 +533,92 @@ NTCCFG_TEST_CASE(6)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+NTCCFG_TEST_CASE(7)
+{
+    // Concern: Servers are ordered by priority, then by a random selection
+    // weighted by the weight of each server, as defined by RFC 2782.
+    // Plan: Repeatedly sort a server list having two priority groups and
+    // verify that the priority groups are never interleaved, that the
+    // unavailable target is removed, and that, within the first priority
+    // group, the server with the greater weight is selected first in
+    // roughly the proportion of its weight.
+
+    NTCI_LOG_CONTEXT();
+
+    ntccfg::TestAllocator ta;
+    {
+        typedef bsl::vector<ntcdns::ResourceRecordDataSvr> ServerList;
+
+        ServerList serverList(&ta);
+
+        serverList.resize(5);
+
+        serverList[0].target()   = "c.example.com";
+        serverList[0].priority() = 20;
+        serverList[0].weight()   = 0;
+        serverList[0].port()     = 3000;
+
+        serverList[1].target()   = "a.example.com";
+        serverList[1].priority() = 10;
+        serverList[1].weight()   = 90;
+        serverList[1].port()     = 1000;
+
+        serverList[2].target()   = ".";
+        serverList[2].priority() = 10;
+        serverList[2].weight()   = 50;
+        serverList[2].port()     = 0;
+
+        serverList[3].target()   = "b.example.com";
+        serverList[3].priority() = 10;
+        serverList[3].weight()   = 10;
+        serverList[3].port()     = 2000;
+
+        serverList[4].target()   = "d.example.com";
+        serverList[4].priority() = 20;
+        serverList[4].weight()   = 0;
+        serverList[4].port()     = 4000;
+
+        const bsl::size_t k_NUM_ITERATIONS = 1000;
+
+        bsl::size_t numHeavierFirst = 0;
+        int         seed            = 12345;
+
+        for (bsl::size_t iteration = 0; iteration < k_NUM_ITERATIONS;
+             ++iteration)
+        {
+            ServerList result(serverList, &ta);
+            ntcdns::Utility::sortServerList(&result, &seed);
+
+            NTCCFG_TEST_EQ(result.size(), 4);
+
+            NTCCFG_TEST_EQ(result[0].priority(), 10);
+            NTCCFG_TEST_EQ(result[1].priority(), 10);
+            NTCCFG_TEST_EQ(result[2].priority(), 20);
+            NTCCFG_TEST_EQ(result[3].priority(), 20);
+
+            NTCCFG_TEST_NE(result[0].target(), result[1].target());
+            NTCCFG_TEST_NE(result[2].target(), result[3].target());
+
+            for (bsl::size_t i = 0; i < result.size(); ++i) {
+                NTCCFG_TEST_NE(result[i].target(), ".");
+            }
+
+            if (result[0].target() == "a.example.com") {
+                ++numHeavierFirst;
+            }
+        }
+
+        NTCI_LOG_STREAM_DEBUG << "The heavier server was selected first "
+                              << numHeavierFirst << " out of "
+                              << k_NUM_ITERATIONS << " times"
+                              << NTCI_LOG_STREAM_END;
+
+        NTCCFG_TEST_GT(numHeavierFirst, k_NUM_ITERATIONS * 8 / 10);
+        NTCCFG_TEST_LT(numHeavierFirst, k_NUM_ITERATIONS * 97 / 100);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
@@ -541,5 +627,6 @@ NTCCFG_TEST_DRIVER
     NTCCFG_TEST_REGISTER(4);
     NTCCFG_TEST_REGISTER(5);
     NTCCFG_TEST_REGISTER(6);
+    NTCCFG_TEST_REGISTER(7);
 }
 NTCCFG_TEST_DRIVER_END;
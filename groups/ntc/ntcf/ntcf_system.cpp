@@ -667,6 +667,26 @@ bsl::shared_ptr<ntci::Driver> System::createDriver(
                     configuration.maxCyclesPerWait().value());
             }
 
+            if (!configuration.busyPollDuration().isNull()) {
+                reactorConfig.setBusyPollDuration(
+                    configuration.busyPollDuration().value());
+            }
+
+            if (!configuration.busyPollSockets().isNull()) {
+                reactorConfig.setBusyPollSockets(
+                    configuration.busyPollSockets().value());
+            }
+
+            if (!configuration.deferInterestChanges().isNull()) {
+                reactorConfig.setDeferInterestChanges(
+                    configuration.deferInterestChanges().value());
+            }
+
+            if (!configuration.devicePerWaiter().isNull()) {
+                reactorConfig.setDevicePerWaiter(
+                    configuration.devicePerWaiter().value());
+            }
+
             if (reactorConfig.maxThreads() > 1) {
                 reactorConfig.setOneShot(true);
             }
@@ -722,6 +742,16 @@ bsl::shared_ptr<ntci::Driver> System::createDriver(
                     configuration.maxCyclesPerWait().value());
             }
 
+            if (!configuration.busyPollDuration().isNull()) {
+                proactorConfig.setBusyPollDuration(
+                    configuration.busyPollDuration().value());
+            }
+
+            if (!configuration.busyPollSockets().isNull()) {
+                proactorConfig.setBusyPollSockets(
+                    configuration.busyPollSockets().value());
+            }
+
             return proactorFactory->createProactor(
                 proactorConfig,
                 bsl::shared_ptr<ntci::User>(),
@@ -4374,6 +4374,18 @@ class Resolver : public ntci::Resolver, public ntccfg::Shared<Resolver>
                             const ntci::GetEndpointCallback& callback)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Resolve the specified service 'name' to the endpoints of the
+    /// service, according to the specified 'options'. When resolution
+    /// completes or fails, invoke the specified 'callback' on the
+    /// callback's strand, if any, with the endpoints of the service. Return
+    /// the error. Note that this resolver does not support resolving the
+    /// endpoints of a service.
+    ntsa::Error getServiceEndpoints(
+        const bslstl::StringRef&                 name,
+        const ntca::GetServiceEndpointsOptions&  options,
+        const ntci::GetServiceEndpointsCallback& callback)
+        BSLS_KEYWORD_OVERRIDE;
+
     /// Load into the specified 'result' the IP addresses assigned to the
     /// local machine. Perform all resolution and validation of the
     /// characteristics of the desired 'result' according to the specified
@@ -4656,6 +4668,14 @@ ntsa::Error Resolver::getEndpoint(const bslstl::StringRef&         text,
     return ntsa::Error();
 }
 
+ntsa::Error Resolver::getServiceEndpoints(
+    const bslstl::StringRef&                 name,
+    const ntca::GetServiceEndpointsOptions&  options,
+    const ntci::GetServiceEndpointsCallback& callback)
+{
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
 ntsa::Error Resolver::getLocalIpAddress(bsl::vector<ntsa::IpAddress>* result,
                                         const ntsa::IpAddressOptions& options)
 {
@@ -60,6 +60,11 @@ class ReactorMetrics : public ntci::Monitorable
     /// the controller interrupt system.
     virtual void logSpuriousWakeup() = 0;
 
+    /// Log the completion of a busy poll that either discovered events
+    /// before the busy poll duration elapsed, according to the specified
+    /// 'hit' flag, or was followed by a blocking wait.
+    virtual void logBusyPoll(bool hit) = 0;
+
     /// Log the specified 'duration' in the function to process a readable
     /// socket.
     virtual void logReadCallback(const bsls::TimeInterval& duration) = 0;
@@ -98,6 +103,11 @@ class ReactorMetrics : public ntci::Monitorable
         metrics->logSpuriousWakeup();                                         \
     }
 
+#define NTCI_REACTORMETRICS_UPDATE_BUSY_POLL(hit)                             \
+    if (metrics) {                                                            \
+        metrics->logBusyPoll(hit);                                            \
+    }
+
 #define NTCI_REACTORMETRICS_UPDATE_ERROR_CALLBACK_TIME_BEGIN()                \
     bsl::int64_t errorProcessingStartTime;                                    \
     if (metrics) {                                                            \
@@ -162,6 +172,7 @@ class ReactorMetrics : public ntci::Monitorable
 #define NTCI_REACTORMETRICS_UPDATE_POLL(numReadable, numWritable, numErrors)
 #define NTCI_REACTORMETRICS_UPDATE_DEFERRED_SOCKET()
 #define NTCI_REACTORMETRICS_UPDATE_SPURIOUS_WAKEUP()
+#define NTCI_REACTORMETRICS_UPDATE_BUSY_POLL(hit)
 #define NTCI_REACTORMETRICS_UPDATE_ERROR_CALLBACK_TIME_BEGIN()
 #define NTCI_REACTORMETRICS_UPDATE_ERROR_CALLBACK_TIME_END()
 #define NTCI_REACTORMETRICS_UPDATE_WRITE_CALLBACK_TIME_BEGIN()
@@ -27,6 +27,8 @@ BSLS_IDENT("$Id: $")
 #include <ntca_getipaddressoptions.h>
 #include <ntca_getportcontext.h>
 #include <ntca_getportoptions.h>
+#include <ntca_getserviceendpointscontext.h>
+#include <ntca_getserviceendpointsoptions.h>
 #include <ntca_getservicenamecontext.h>
 #include <ntca_getservicenameoptions.h>
 #include <ntccfg_platform.h>
@@ -35,6 +37,7 @@ BSLS_IDENT("$Id: $")
 #include <ntci_getendpointcallbackfactory.h>
 #include <ntci_getipaddresscallbackfactory.h>
 #include <ntci_getportcallbackfactory.h>
+#include <ntci_getserviceendpointscallbackfactory.h>
 #include <ntci_getservicenamecallbackfactory.h>
 #include <ntci_strand.h>
 #include <ntci_strandfactory.h>
@@ -67,7 +70,8 @@ class Resolver : public ntci::Executor,
                  public ntci::GetDomainNameCallbackFactory,
                  public ntci::GetPortCallbackFactory,
                  public ntci::GetServiceNameCallbackFactory,
-                 public ntci::GetEndpointCallbackFactory
+                 public ntci::GetEndpointCallbackFactory,
+                 public ntci::GetServiceEndpointsCallbackFactory
 {
   public:
     /// Destroy this object.
@@ -239,6 +243,23 @@ class Resolver : public ntci::Executor,
         const ntca::GetEndpointOptions&  options,
         const ntci::GetEndpointCallback& callback) = 0;
 
+    /// Resolve the specified service 'name', e.g. "_http._tcp.example.com",
+    /// to the endpoints of the service, according to the specified
+    /// 'options'. The endpoints are described by the SRV records of the
+    /// 'name', in the order defined by the priority and weight of each
+    /// record: records of lower priority precede records of higher
+    /// priority, and records of the same priority are ordered by a random
+    /// selection weighted by the weight of each record, so that the load
+    /// on the targets of the service is distributed as described by the
+    /// records. The IP addresses of each target are resolved and each is
+    /// combined with the port of the target. When resolution completes or
+    /// fails, invoke the specified 'callback' on the callback's strand, if
+    /// any, with the endpoints of the service. Return the error.
+    virtual ntsa::Error getServiceEndpoints(
+        const bslstl::StringRef&                 name,
+        const ntca::GetServiceEndpointsOptions&  options,
+        const ntci::GetServiceEndpointsCallback& callback) = 0;
+
     /// Load into the specified 'result' the IP addresses assigned to the
     /// local machine. Perform all resolution and validation of the
     /// characteristics of the desired 'result' according to the specified
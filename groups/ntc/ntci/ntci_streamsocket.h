@@ -1558,7 +1558,10 @@ class StreamSocket : public ntsi::Descriptor,
     /// once their data has begun to have been copied to the socket send
     /// buffer), or if the operation has already completed. Neither
     /// successful or unsuccessful cancellation has any effect on the
-    /// socket.
+    /// socket. Note that, as an exception, reactor-based sockets allow the
+    /// transmission of a file to be cancelled after it has begun, in which
+    /// case the remainder of the file is never sent and the peer observes
+    /// a truncated stream.
     virtual ntsa::Error cancel(const ntca::SendToken& token) = 0;
 
     /// Cancel the receive operation identified by the specified 'token'.
@@ -0,0 +1,77 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCI_STREAMSOCKETRELAY
+#define INCLUDED_NTCI_STREAMSOCKETRELAY
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_platform.h>
+#include <ntcscm_version.h>
+#include <ntsa_error.h>
+#include <bsl_functional.h>
+
+namespace BloombergLP {
+namespace ntci {
+
+/// Provide an interface to relay data between two stream sockets.
+///
+/// @details
+/// A relay pairs two established stream sockets so that data received by
+/// each socket is forwarded to, and sent by, the other, subject to
+/// backpressure from each destination. The relay completes when both
+/// sockets are completely shut down, when either socket encounters an
+/// error, or when the relay is stopped. Relays are implemented between two
+/// 'ntci::StreamSocket' objects, and between two socket handles monitored
+/// by an 'ntci::Reactor', through which data may be spliced within the
+/// kernel.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntci_socket
+class StreamSocketRelay
+{
+  public:
+    /// Define a type alias for the function invoked when the relay
+    /// completes, with the error, if any, that caused it to complete.
+    typedef bsl::function<void(const ntsa::Error& error)> Callback;
+
+    /// Destroy this object.
+    virtual ~StreamSocketRelay();
+
+    /// Begin forwarding data between the sockets, including any data
+    /// already received. Invoke the specified 'callback' when the relay
+    /// completes. Return the error.
+    virtual ntsa::Error start(const Callback& callback) = 0;
+
+    /// Stop the relay, if it is in progress, abandoning any data not yet
+    /// forwarded. The callback is invoked with the error
+    /// 'ntsa::Error::e_CANCELLED' once the relay has released both sockets.
+    virtual void stop() = 0;
+
+    /// Return the number of bytes forwarded from the first socket to the
+    /// second socket.
+    virtual bsl::size_t numBytesForwarded() const = 0;
+
+    /// Return the number of bytes forwarded from the second socket to the
+    /// first socket.
+    virtual bsl::size_t numBytesReturned() const = 0;
+};
+
+}  // end namespace ntci
+}  // end namespace BloombergLP
+#endif
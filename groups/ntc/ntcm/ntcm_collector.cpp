@@ -19,7 +19,6 @@
 BSLS_IDENT_RCSID(ntcm_collector_cpp, "$Id$ $CSID$")
 
 #include <bdld_manageddatum.h>
-#include <bdlma_bufferedsequentialallocator.h>
 #include <bdlt_currenttime.h>
 
 #include <bslma_allocator.h>
@@ -28,6 +27,7 @@ BSLS_IDENT_RCSID(ntcm_collector_cpp, "$Id$ $CSID$")
 #include <bsls_assert.h>
 #include <bsls_timeinterval.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_vector.h>
 
 namespace BloombergLP {
@@ -39,12 +39,51 @@ namespace {
 // that the smallest pool allocates 8 bytes and the largest pool allocates 1K.
 const int POOLS_UP_TO_1K = 8;
 
+/// Load into the specified 'result' the numeric value of the specified
+/// 'datum'. Return true if 'datum' has a numeric value, otherwise return
+/// false.
+bool loadNumber(double* result, const bdld::Datum& datum)
+{
+    if (datum.isDouble()) {
+        *result = datum.theDouble();
+        return true;
+    }
+    else if (datum.isInteger64()) {
+        *result = static_cast<double>(datum.theInteger64());
+        return true;
+    }
+    else if (datum.isInteger()) {
+        *result = static_cast<double>(datum.theInteger());
+        return true;
+    }
+
+    return false;
+}
+
 }  // close unnamed namespace
 
+/// Provide a functor to order candidates by increasing rank.
+class Collector::CandidateSorter
+{
+  public:
+    /// Return true if the specified 'lhs' is ranked higher than the
+    /// specified 'rhs', otherwise return false. Note that ordering a heap
+    /// with this functor keeps the lowest-ranked candidate at its front.
+    bool operator()(const Candidate& lhs, const Candidate& rhs) const
+    {
+        return lhs.d_rank > rhs.d_rank;
+    }
+};
+
 Collector::Collector(const LoadCallback& loadCallback,
                      bslma::Allocator*   basicAllocator)
 : d_mutex()
+, d_collectMutex()
 , d_publishers(basicAllocator)
+, d_publisherVector(basicAllocator)
+, d_monitorableVector(basicAllocator)
+, d_candidateVector(basicAllocator)
+, d_cursor(0)
 , d_memoryPools(POOLS_UP_TO_1K, basicAllocator)
 , d_loader(bsl::allocator_arg, basicAllocator, loadCallback)
 , d_config(basicAllocator)
@@ -56,7 +95,12 @@ Collector::Collector(const ntca::MonitorableCollectorConfig& configuration,
                      const LoadCallback&                     loadCallback,
                      bslma::Allocator*                       basicAllocator)
 : d_mutex()
+, d_collectMutex()
 , d_publishers(basicAllocator)
+, d_publisherVector(basicAllocator)
+, d_monitorableVector(basicAllocator)
+, d_candidateVector(basicAllocator)
+, d_cursor(0)
 , d_memoryPools(POOLS_UP_TO_1K, basicAllocator)
 , d_loader(bsl::allocator_arg, basicAllocator, loadCallback)
 , d_config(configuration, basicAllocator)
@@ -68,6 +112,193 @@ Collector::~Collector()
 {
 }
 
+void Collector::privateCollectSequence(bsl::size_t               index,
+                                       bsl::size_t               count,
+                                       const bsls::TimeInterval& now)
+{
+    // Publication of each object's statistics is deferred until the
+    // statistics of the next publishable object are collected, so that the
+    // final publication is known even when the last objects loaded are not
+    // publishable. The two datums alternate and their memory is recycled
+    // through the pools.
+
+    const bsl::size_t numMonitorables = d_monitorableVector.size();
+
+    bdld::ManagedDatum current(&d_memoryPools);
+    bdld::ManagedDatum pending(&d_memoryPools);
+
+    const bsl::shared_ptr<ntci::Monitorable>* pendingMonitorable = 0;
+
+    for (bsl::size_t i = 0; i < count; ++i) {
+        const bsl::shared_ptr<ntci::Monitorable>& monitorable =
+            d_monitorableVector[(index + i) % numMonitorables];
+
+        current.makeNull();
+        monitorable->getStats(&current);
+
+        if (!this->isPublishable(monitorable, current.datum())) {
+            continue;
+        }
+
+        if (pendingMonitorable != 0) {
+            this->privatePublish(*pendingMonitorable,
+                                 pending.datum(),
+                                 now,
+                                 false);
+        }
+
+        pending.swap(current);
+        pendingMonitorable = &monitorable;
+    }
+
+    if (pendingMonitorable != 0) {
+        this->privatePublish(*pendingMonitorable, pending.datum(), now, true);
+    }
+}
+
+void Collector::privateCollectRanked(const bsl::string&        fieldName,
+                                     bsl::size_t               count,
+                                     const bsls::TimeInterval& now)
+{
+    // Retain the statistics of at most 'count' objects in a heap having the
+    // lowest-ranked candidate at its front, so that the statistics of each
+    // object ranked lower than every retained candidate are released as
+    // soon as they are collected.
+
+    BSLS_ASSERT(d_candidateVector.empty());
+
+    if (count == 0) {
+        return;
+    }
+
+    d_candidateVector.reserve(count);
+
+    CandidateSorter sorter;
+
+    bdld::ManagedDatum current(&d_memoryPools);
+
+    for (MonitorableVector::const_iterator it = d_monitorableVector.begin();
+         it != d_monitorableVector.end();
+         ++it)
+    {
+        const bsl::shared_ptr<ntci::Monitorable>& monitorable = *it;
+
+        current.makeNull();
+        monitorable->getStats(&current);
+
+        if (!this->isPublishable(monitorable, current.datum())) {
+            continue;
+        }
+
+        const int ordinal = monitorable->getFieldOrdinal(fieldName.c_str());
+        if (ordinal < 0 || static_cast<bsl::size_t>(ordinal) >=
+                               current.datum().theArray().length())
+        {
+            continue;
+        }
+
+        double rank = 0;
+        if (!loadNumber(&rank, current.datum().theArray()[ordinal])) {
+            continue;
+        }
+
+        if (d_candidateVector.size() == count) {
+            if (rank <= d_candidateVector.front().d_rank) {
+                continue;
+            }
+
+            bsl::pop_heap(d_candidateVector.begin(),
+                          d_candidateVector.end(),
+                          sorter);
+
+            bdld::Datum::destroy(d_candidateVector.back().d_statistics,
+                                 &d_memoryPools);
+            d_candidateVector.pop_back();
+        }
+
+        Candidate candidate;
+        candidate.d_rank        = rank;
+        candidate.d_monitorable = monitorable;
+        candidate.d_statistics  = current.release();
+
+        d_candidateVector.push_back(candidate);
+
+        bsl::push_heap(d_candidateVector.begin(),
+                       d_candidateVector.end(),
+                       sorter);
+    }
+
+    bsl::sort_heap(d_candidateVector.begin(), d_candidateVector.end(), sorter);
+
+    for (CandidateVector::const_iterator it = d_candidateVector.begin();
+         it != d_candidateVector.end();
+         ++it)
+    {
+        const bool final = it == d_candidateVector.end() - 1;
+        this->privatePublish(it->d_monitorable, it->d_statistics, now, final);
+    }
+
+    for (CandidateVector::iterator it = d_candidateVector.begin();
+         it != d_candidateVector.end();
+         ++it)
+    {
+        bdld::Datum::destroy(it->d_statistics, &d_memoryPools);
+    }
+
+    d_candidateVector.clear();
+}
+
+void Collector::privatePublish(
+    const bsl::shared_ptr<ntci::Monitorable>& monitorable,
+    const bdld::Datum&                        statistics,
+    const bsls::TimeInterval&                 now,
+    bool                                      final)
+{
+    for (PublisherVector::const_iterator it = d_publisherVector.begin();
+         it != d_publisherVector.end();
+         ++it)
+    {
+        const bsl::shared_ptr<ntci::MonitorablePublisher>& publisher = *it;
+        publisher->publish(monitorable, statistics, now, final);
+    }
+}
+
+bool Collector::isPublishable(
+    const bsl::shared_ptr<ntci::Monitorable>& monitorable,
+    const bdld::Datum&                        statistics) const
+{
+    if (!statistics.isArray()) {
+        return false;
+    }
+
+    if (d_config.suppressInactive().isNull() ||
+        !d_config.suppressInactive().value())
+    {
+        return true;
+    }
+
+    const bdld::DatumArrayRef array = statistics.theArray();
+
+    for (bsl::size_t ordinal = 0; ordinal < array.length(); ++ordinal) {
+        const bdld::Datum& element = array[ordinal];
+        if (element.isNull()) {
+            continue;
+        }
+
+        double value = 0;
+        if (monitorable->getFieldType(static_cast<int>(ordinal)) ==
+                ntci::Monitorable::e_SUM &&
+            loadNumber(&value, element) && value == 0)
+        {
+            continue;
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
 void Collector::registerPublisher(
     const bsl::shared_ptr<ntci::MonitorablePublisher>& publisher)
 {
@@ -92,51 +323,48 @@ void Collector::stop()
 
 void Collector::collect()
 {
-    char                               arena[1024];
-    bdlma::BufferedSequentialAllocator sequentialAllocator(arena,
-                                                           sizeof arena,
-                                                           &d_memoryPools);
-
-    typedef bsl::vector<bsl::shared_ptr<ntci::MonitorablePublisher> >
-                    PublisherVector;
-    PublisherVector publishers(&sequentialAllocator);
+    bslmt::LockGuard<bslmt::Mutex> collectGuard(&d_collectMutex);
+
     {
         bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-
-        publishers.reserve(d_publishers.size());
-        publishers.assign(d_publishers.begin(), d_publishers.end());
+        d_publisherVector.assign(d_publishers.begin(), d_publishers.end());
     }
 
-    typedef bsl::vector<bsl::shared_ptr<ntci::Monitorable> > MonitorableVector;
-    MonitorableVector monitorables(&sequentialAllocator);
+    d_monitorableVector.clear();
+    d_loader(&d_monitorableVector);
 
-    d_loader(&monitorables);
+    const bsl::size_t        numMonitorables = d_monitorableVector.size();
+    const bsls::TimeInterval now             = bdlt::CurrentTime::now();
 
-    bsls::TimeInterval now = bdlt::CurrentTime::now();
-
-    for (MonitorableVector::const_iterator it = monitorables.begin();
-         it != monitorables.end();
-         ++it)
+    if (!d_config.maxObjects().isNull() &&
+        d_config.maxObjects().value() < numMonitorables)
     {
-        const bsl::shared_ptr<ntci::Monitorable>& monitorable = *it;
-
-        const bool final = it == monitorables.end() - 1;
-
-        bdld::ManagedDatum statistics(&sequentialAllocator);
-        monitorable->getStats(&statistics);
+        const bsl::size_t maxObjects = d_config.maxObjects().value();
 
-        if (!statistics.datum().isArray()) {
-            continue;
+        if (!d_config.rankingField().isNull()) {
+            this->privateCollectRanked(d_config.rankingField().value(),
+                                       maxObjects,
+                                       now);
         }
+        else {
+            if (d_cursor >= numMonitorables) {
+                d_cursor = 0;
+            }
 
-        for (PublisherVector::const_iterator jt = publishers.begin();
-             jt != publishers.end();
-             ++jt)
-        {
-            const bsl::shared_ptr<ntci::MonitorablePublisher>& publisher = *jt;
-            publisher->publish(monitorable, statistics.datum(), now, final);
+            this->privateCollectSequence(d_cursor, maxObjects, now);
+
+            d_cursor = (d_cursor + maxObjects) % numMonitorables;
         }
     }
+    else {
+        this->privateCollectSequence(0, numMonitorables, now);
+    }
+
+    // Release the references to each object and publisher but retain the
+    // capacity of each vector for the next collection.
+
+    d_monitorableVector.clear();
+    d_publisherVector.clear();
 }
 
 const ntca::MonitorableCollectorConfig& Collector::configuration() const
@@ -23,11 +23,14 @@ BSLS_IDENT("$Id: $")
 #include <ntccfg_platform.h>
 #include <ntci_monitorable.h>
 #include <ntcscm_version.h>
+#include <bdld_datum.h>
 #include <bdlma_concurrentmultipoolallocator.h>
 #include <bslmt_mutex.h>
+#include <bsls_timeinterval.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
 #include <bsl_unordered_set.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace ntcm {
@@ -44,6 +47,15 @@ namespace ntcm {
 /// along with the monitorable object that measured them, through various
 /// registered publishers.
 ///
+/// When the configuration limits the maximum number of objects published
+/// during each collection, the cost of each collection is bounded regardless
+/// of the number of registered objects: either a window of objects that
+/// advances at each collection is sampled, or the statistics of each object
+/// are collected but only those of the objects ranked highest by a
+/// configured field are retained and published. The statistics of each
+/// object are collected into memory recycled from one object to the next and
+/// from one collection to the next.
+///
 /// @par Thread Safety
 /// This class is thread safe.
 ///
@@ -63,8 +75,34 @@ class Collector : public ntci::MonitorableCollector
     typedef bsl::unordered_set<bsl::shared_ptr<ntci::MonitorablePublisher> >
         PublisherSet;
 
+    /// Define a type alias for a vector of publishers.
+    typedef bsl::vector<bsl::shared_ptr<ntci::MonitorablePublisher> >
+        PublisherVector;
+
+    /// Define a type alias for a vector of monitorable objects.
+    typedef bsl::vector<bsl::shared_ptr<ntci::Monitorable> > MonitorableVector;
+
+    /// Describe the statistics of a monitorable object retained for
+    /// publication because of its rank.
+    struct Candidate {
+        double                             d_rank;
+        bsl::shared_ptr<ntci::Monitorable> d_monitorable;
+        bdld::Datum                        d_statistics;
+    };
+
+    /// Provide a functor to order candidates by increasing rank.
+    class CandidateSorter;
+
+    /// Define a type alias for a vector of candidates.
+    typedef bsl::vector<Candidate> CandidateVector;
+
     bslmt::Mutex                        d_mutex;
+    bslmt::Mutex                        d_collectMutex;
     PublisherSet                        d_publishers;
+    PublisherVector                     d_publisherVector;
+    MonitorableVector                   d_monitorableVector;
+    CandidateVector                     d_candidateVector;
+    bsl::size_t                         d_cursor;
     bdlma::ConcurrentMultipoolAllocator d_memoryPools;
     LoadCallback                        d_loader;
     ntca::MonitorableCollectorConfig    d_config;
@@ -74,6 +112,41 @@ class Collector : public ntci::MonitorableCollector
     Collector(const Collector&) BSLS_KEYWORD_DELETED;
     Collector& operator=(const Collector&) BSLS_KEYWORD_DELETED;
 
+  private:
+    /// Collect and publish the statistics of the specified 'count' number
+    /// of loaded monitorable objects, starting at the specified 'index' and
+    /// wrapping around to the first loaded monitorable object, at the
+    /// specified 'now'. The behavior is undefined unless 'd_collectMutex'
+    /// is locked.
+    void privateCollectSequence(bsl::size_t               index,
+                                bsl::size_t               count,
+                                const bsls::TimeInterval& now);
+
+    /// Collect the statistics of each loaded monitorable object and
+    /// publish those of the specified 'count' number of objects having the
+    /// largest value of the field having the specified 'fieldName', at the
+    /// specified 'now'. The behavior is undefined unless 'd_collectMutex'
+    /// is locked.
+    void privateCollectRanked(const bsl::string&        fieldName,
+                              bsl::size_t               count,
+                              const bsls::TimeInterval& now);
+
+    /// Publish the specified 'statistics' measured by the specified
+    /// 'monitorable' object at the specified 'now' through each publisher.
+    /// If the specified 'final' flag is true, these are the final
+    /// statistics published during the collection. The behavior is
+    /// undefined unless 'd_collectMutex' is locked.
+    void privatePublish(const bsl::shared_ptr<ntci::Monitorable>& monitorable,
+                        const bdld::Datum&                        statistics,
+                        const bsls::TimeInterval&                 now,
+                        bool                                      final);
+
+    /// Return true if the specified 'statistics' measured by the specified
+    /// 'monitorable' object should be published according to the
+    /// configuration of this object, otherwise return false.
+    bool isPublishable(const bsl::shared_ptr<ntci::Monitorable>& monitorable,
+                       const bdld::Datum& statistics) const;
+
   public:
     /// Create a new collector having a default configuration that collects
     /// statistics on-demand from all monitorable objects loaded from the
@@ -113,7 +186,8 @@ class Collector : public ntci::MonitorableCollector
 
     /// Collect statistics from each monitorable object registered with
     /// the default monitorable object registry and publish their statistics
-    /// through each registered publisher.
+    /// through each registered publisher, subject to the maximum number of
+    /// objects published during each collection, if any.
     void collect() BSLS_KEYWORD_OVERRIDE;
 
     /// Return the configuration of this object.
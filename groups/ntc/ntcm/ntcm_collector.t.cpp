@@ -32,10 +32,13 @@
 #include <bsls_timeutil.h>
 
 #include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_set.h>
 #include <bsl_stdexcept.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace ntcm;
@@ -539,6 +542,201 @@ int Publisher::numPublications() const
     return d_numPublications;
 }
 
+/// This class implements the 'ntci::Monitorable' interface to count events
+/// deterministically for use by this test driver.
+class Counter : public ntci::Monitorable
+{
+    mutable bslmt::Mutex d_mutex;
+    bsl::int64_t         d_count;
+    bsl::int64_t         d_max;
+
+  private:
+    Counter(const Counter&) BSLS_KEYWORD_DELETED;
+    Counter& operator=(const Counter&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new counter.
+    Counter()
+    : d_mutex()
+    , d_count(0)
+    , d_max(0)
+    {
+    }
+
+    /// Destroy this object.
+    ~Counter()
+    {
+    }
+
+    /// Count the specified 'amount' of events.
+    void increment(bsl::int64_t amount)
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_count += amount;
+        if (d_max < amount) {
+            d_max = amount;
+        }
+    }
+
+    /// Load into the specified 'result' the number of events counted and
+    /// the largest increment since the last call to this function, then
+    /// reset the counter. The largest increment is null if no events were
+    /// counted.
+    virtual void getStats(bdld::ManagedDatum* result)
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        bdld::DatumMutableArrayRef array;
+        bdld::Datum::createUninitializedArray(&array, 2, result->allocator());
+
+        array.data()[0] =
+            bdld::Datum::createInteger64(d_count, result->allocator());
+        if (d_count > 0) {
+            array.data()[1] =
+                bdld::Datum::createInteger64(d_max, result->allocator());
+        }
+        else {
+            array.data()[1] = bdld::Datum::createNull();
+        }
+
+        *array.length() = 2;
+
+        result->adopt(bdld::Datum::adoptArray(array));
+
+        d_count = 0;
+        d_max   = 0;
+    }
+
+    /// Return the prefix of each field.
+    virtual const char* getFieldPrefix(int ordinal) const
+    {
+        return ordinal < 2 ? "test.counter" : 0;
+    }
+
+    /// Return the name of the field at the specified 'ordinal'.
+    virtual const char* getFieldName(int ordinal) const
+    {
+        return ordinal == 0 ? "count" : ordinal == 1 ? "max" : 0;
+    }
+
+    /// Return the description of the field at the specified 'ordinal'.
+    virtual const char* getFieldDescription(int ordinal) const
+    {
+        return ordinal == 0   ? "Number of events"
+               : ordinal == 1 ? "Largest increment"
+                              : 0;
+    }
+
+    /// Return the type of the field at the specified 'ordinal'.
+    virtual StatisticType getFieldType(int ordinal) const
+    {
+        return ordinal == 0 ? ntci::Monitorable::e_SUM
+                            : ntci::Monitorable::e_MAXIMUM;
+    }
+
+    /// Return the tags of the field at the specified 'ordinal'.
+    virtual int getFieldTags(int ordinal) const
+    {
+        return ntci::Monitorable::e_ANONYMOUS;
+    }
+
+    /// Return the ordinal of the specified 'fieldName', or a negative value
+    /// if no field identified by 'fieldName' exists.
+    virtual int getFieldOrdinal(const char* fieldName) const
+    {
+        if (bsl::strcmp(fieldName, "count") == 0) {
+            return 0;
+        }
+        else if (bsl::strcmp(fieldName, "max") == 0) {
+            return 1;
+        }
+        else {
+            return -1;
+        }
+    }
+
+    /// Return the number of fields.
+    virtual int numOrdinals() const
+    {
+        return 2;
+    }
+
+    /// Return the name of this object.
+    virtual const char* objectName() const
+    {
+        return 0;
+    }
+};
+
+/// This class implements the 'ntci::MonitorablePublisher' interface to
+/// record the identifier of each object published and the number of final
+/// publications for use by this test driver.
+class Recorder : public ntci::MonitorablePublisher
+{
+    mutable bslmt::Mutex d_mutex;
+    bsl::vector<int>     d_objectIds;
+    int                  d_numFinal;
+
+  private:
+    Recorder(const Recorder&) BSLS_KEYWORD_DELETED;
+    Recorder& operator=(const Recorder&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new recorder. Optionally specify a 'basicAllocator' used to
+    /// supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    explicit Recorder(bslma::Allocator* basicAllocator = 0)
+    : d_mutex()
+    , d_objectIds(basicAllocator)
+    , d_numFinal(0)
+    {
+    }
+
+    /// Destroy this object.
+    virtual ~Recorder()
+    {
+    }
+
+    /// Record the publication of the specified 'monitorable' object and
+    /// whether the publication is 'final'.
+    virtual void publish(const bsl::shared_ptr<ntci::Monitorable>& monitorable,
+                         const bdld::Datum&                        statistics,
+                         const bsls::TimeInterval&                 time,
+                         bool                                      final)
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        ASSERT(statistics.isArray());
+
+        d_objectIds.push_back(monitorable->objectId());
+        if (final) {
+            ++d_numFinal;
+        }
+    }
+
+    /// Clear the publications recorded.
+    void reset()
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_objectIds.clear();
+        d_numFinal = 0;
+    }
+
+    /// Return the identifiers of the objects published, in order.
+    bsl::vector<int> objectIds() const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return d_objectIds;
+    }
+
+    /// Return the number of final publications.
+    int numFinal() const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return d_numFinal;
+    }
+};
+
 }  // close namespace 'test'
 
 //=============================================================================
@@ -559,6 +757,146 @@ int main(int argc, char* argv[])
 
     switch (test) {
     case 0:  // Zero is always the leading case.
+    case 2: {
+        // TESTING BOUNDED COLLECTION
+        //
+        // Concerns:
+        //   When the number of registered objects exceeds the maximum number
+        //   of objects published during each collection, either a window of
+        //   objects that advances at each collection is published, or the
+        //   highest-ranked objects are published. Inactive objects are
+        //   optionally not published. Exactly one publication during each
+        //   collection is final.
+        //
+        // Plan:
+        //   Register a number of counters. Collect with a maximum number of
+        //   objects but no ranking field and ensure each collection
+        //   publishes the maximum number of objects and that every object is
+        //   eventually published. Collect with a ranking field and ensure
+        //   the objects having the largest counts are published in
+        //   decreasing order of their counts. Finally, collect while
+        //   suppressing inactive objects and ensure only the objects that
+        //   counted events are published.
+
+        ntccfg::TestAllocator ta;
+        {
+            const bsl::size_t NUM_OBJECTS = 5;
+            const bsl::size_t MAX_OBJECTS = 2;
+
+            bsl::shared_ptr<ntcm::MonitorableRegistry> monitorableRegistry;
+            monitorableRegistry.createInplace(&ta, &ta);
+
+            typedef bsl::vector<bsl::shared_ptr<test::Counter> > CounterVector;
+            CounterVector counters(&ta);
+
+            for (bsl::size_t i = 0; i < NUM_OBJECTS; ++i) {
+                bsl::shared_ptr<test::Counter> counter;
+                counter.createInplace(&ta);
+
+                monitorableRegistry->registerMonitorable(counter);
+
+                counters.push_back(counter);
+            }
+
+            ntcm::Collector::LoadCallback loadCallback =
+                bdlf::MemFnUtil::memFn(
+                    &ntcm::MonitorableRegistry::loadRegisteredObjects,
+                    monitorableRegistry);
+
+            bsl::shared_ptr<test::Recorder> recorder;
+            recorder.createInplace(&ta, &ta);
+
+            // Sample a window of objects at each collection.
+
+            {
+                ntca::MonitorableCollectorConfig config(&ta);
+                config.setMaxObjects(MAX_OBJECTS);
+
+                ntcm::Collector collector(config, loadCallback, &ta);
+                collector.registerPublisher(recorder);
+
+                bsl::set<int> objectIds;
+
+                const bsl::size_t NUM_COLLECTIONS =
+                    (NUM_OBJECTS + MAX_OBJECTS - 1) / MAX_OBJECTS;
+
+                for (bsl::size_t i = 0; i < NUM_COLLECTIONS; ++i) {
+                    recorder->reset();
+                    collector.collect();
+
+                    bsl::vector<int> published = recorder->objectIds();
+
+                    ASSERT(published.size() == MAX_OBJECTS);
+                    ASSERT(recorder->numFinal() == 1);
+
+                    objectIds.insert(published.begin(), published.end());
+                }
+
+                ASSERT(objectIds.size() == NUM_OBJECTS);
+            }
+
+            // Publish the objects ranked highest by their count.
+
+            {
+                ntca::MonitorableCollectorConfig config(&ta);
+                config.setMaxObjects(MAX_OBJECTS);
+                config.setRankingField("count");
+
+                ntcm::Collector collector(config, loadCallback, &ta);
+                collector.registerPublisher(recorder);
+
+                for (bsl::size_t i = 0; i < NUM_OBJECTS; ++i) {
+                    counters[i]->increment(static_cast<bsl::int64_t>(i + 1));
+                }
+
+                recorder->reset();
+                collector.collect();
+
+                bsl::vector<int> published = recorder->objectIds();
+
+                ASSERT(published.size() == MAX_OBJECTS);
+                ASSERT(recorder->numFinal() == 1);
+
+                ASSERT(published[0] == counters[NUM_OBJECTS - 1]->objectId());
+                ASSERT(published[1] == counters[NUM_OBJECTS - 2]->objectId());
+            }
+
+            // Suppress the publication of inactive objects.
+
+            {
+                ntca::MonitorableCollectorConfig config(&ta);
+                config.setSuppressInactive(true);
+
+                ntcm::Collector collector(config, loadCallback, &ta);
+                collector.registerPublisher(recorder);
+
+                counters[1]->increment(1);
+                counters[3]->increment(1);
+
+                recorder->reset();
+                collector.collect();
+
+                bsl::vector<int> published = recorder->objectIds();
+
+                ASSERT(published.size() == 2);
+                ASSERT(recorder->numFinal() == 1);
+
+                recorder->reset();
+                collector.collect();
+
+                ASSERT(recorder->objectIds().empty());
+                ASSERT(recorder->numFinal() == 0);
+            }
+
+            for (CounterVector::const_iterator it = counters.begin();
+                 it != counters.end();
+                 ++it)
+            {
+                monitorableRegistry->deregisterMonitorable(*it);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+    } break;
     case 1: {
         // TESTING COLLECTION AND PUBLICATION
         //
@@ -0,0 +1,784 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcm_openmetricspublisher.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcm_openmetricspublisher_cpp, "$Id$ $CSID$")
+
+#include <ntca_acceptoptions.h>
+#include <ntca_listenersocketoptions.h>
+#include <ntca_receiveoptions.h>
+#include <ntca_sendoptions.h>
+#include <ntca_timeroptions.h>
+#include <ntccfg_bind.h>
+#include <ntci_log.h>
+
+#include <bdlbb_blobutil.h>
+#include <bdld_datum.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstring.h>
+#include <bsl_limits.h>
+
+namespace BloombergLP {
+namespace ntcm {
+
+namespace {
+
+// The content type of the OpenMetrics text exposition format.
+const char k_CONTENT_TYPE[] =
+    "application/openmetrics-text; version=1.0.0; charset=utf-8";
+
+// The delimiter between the headers and the body of an HTTP message.
+const char k_HEADER_DELIMITER[] = "\r\n\r\n";
+
+// The timeout, in seconds, after which a connection that has not completed
+// its request is closed.
+const int k_REQUEST_TIMEOUT = 10;
+
+// The delay, in milliseconds, before the next connection is accepted after
+// the first of consecutive failures to accept a connection.
+const int k_ACCEPT_DELAY_MIN = 10;
+
+// The maximum delay, in milliseconds, before the next connection is
+// accepted after consecutive failures to accept a connection.
+const int k_ACCEPT_DELAY_MAX = 1000;
+
+/// Return true if the specified 'error' of an attempt to accept a
+/// connection is expected to clear by itself, such as the exhaustion of
+/// file descriptors or memory, or the abort of the connection by its peer,
+/// otherwise return false.
+bool isTransientAcceptError(const ntsa::Error& error)
+{
+    return error == ntsa::Error::e_LIMIT ||
+           error == ntsa::Error::e_INTERRUPTED ||
+           error == ntsa::Error::e_CONNECTION_DEAD ||
+           error == ntsa::Error::e_CONNECTION_RESET;
+}
+
+/// Return the specified 'text', or the empty string if 'text' is null.
+const char* nonNull(const char* text)
+{
+    return text ? text : "";
+}
+
+/// Append to the specified 'result' the specified 'text' with each
+/// character not allowed in a metric name replaced by an underscore.
+void appendName(bsl::string* result, const char* text)
+{
+    for (const char* current = text; *current != 0; ++current) {
+        const char ch = *current;
+        if ((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') ||
+            (ch >= '0' && ch <= '9' && current != text) || ch == '_' ||
+            ch == ':')
+        {
+            result->push_back(ch);
+        }
+        else {
+            result->push_back('_');
+        }
+    }
+}
+
+/// Append to the specified 'result' the name of the metric having the
+/// specified 'prefix' and 'name'.
+void appendMetricName(bsl::string* result,
+                      const char*  prefix,
+                      const char*  name)
+{
+    if (*prefix != 0) {
+        appendName(result, prefix);
+        result->push_back('_');
+    }
+
+    appendName(result, name);
+}
+
+/// Append to the specified 'result' the specified 'text' escaped for use
+/// within a quoted label value or a help string.
+void appendEscaped(bsl::string* result, const char* text)
+{
+    for (const char* current = text; *current != 0; ++current) {
+        const char ch = *current;
+        if (ch == '\\') {
+            result->append("\\\\", 2);
+        }
+        else if (ch == '"') {
+            result->append("\\\"", 2);
+        }
+        else if (ch == '\n') {
+            result->append("\\n", 2);
+        }
+        else {
+            result->push_back(ch);
+        }
+    }
+}
+
+/// Append to the specified 'result' the specified 'value'.
+void appendInteger(bsl::string* result, bsls::Types::Int64 value)
+{
+    char      buffer[32];
+    const int n = bsl::snprintf(buffer,
+                                sizeof buffer,
+                                "%lld",
+                                static_cast<long long>(value));
+    result->append(buffer, static_cast<bsl::size_t>(n));
+}
+
+/// Append to the specified 'result' the specified 'value'.
+void appendDouble(bsl::string* result, double value)
+{
+    if (value != value) {
+        result->append("NaN", 3);
+    }
+    else if (value == bsl::numeric_limits<double>::infinity()) {
+        result->append("+Inf", 4);
+    }
+    else if (value == -bsl::numeric_limits<double>::infinity()) {
+        result->append("-Inf", 4);
+    }
+    else {
+        char      buffer[32];
+        const int n = bsl::snprintf(buffer, sizeof buffer, "%.17g", value);
+        result->append(buffer, static_cast<bsl::size_t>(n));
+    }
+}
+
+/// Append to the specified 'request' the specified 'data'.
+void appendBlob(bsl::string* request, const bdlbb::Blob& data)
+{
+    const int numDataBuffers = data.numDataBuffers();
+    for (int i = 0; i < numDataBuffers; ++i) {
+        const bdlbb::BlobBuffer& buffer = data.buffer(i);
+
+        const int size =
+            (i == numDataBuffers - 1) ? data.lastDataBufferLength()
+                                      : buffer.size();
+
+        request->append(buffer.data(), static_cast<bsl::size_t>(size));
+    }
+}
+
+/// Return true if the specified 'request' begins with the specified
+/// 'method' followed by a space, otherwise return false.
+bool isMethod(const bsl::string& request, const char* method)
+{
+    const bsl::size_t length = bsl::strlen(method);
+
+    return request.size() > length &&
+           request.compare(0, length, method) == 0 && request[length] == ' ';
+}
+
+}  // close unnamed namespace
+
+class OpenMetricsPublisher::SampleSorter
+{
+  public:
+    /// Return true if the specified 'lhs' should be rendered before the
+    /// specified 'rhs', otherwise return false.
+    bool operator()(const Sample& lhs, const Sample& rhs) const
+    {
+        int comparison = bsl::strcmp(lhs.d_prefix, rhs.d_prefix);
+        if (comparison != 0) {
+            return comparison < 0;
+        }
+
+        comparison = bsl::strcmp(lhs.d_name, rhs.d_name);
+        if (comparison != 0) {
+            return comparison < 0;
+        }
+
+        comparison = bsl::strcmp(lhs.d_objectName, rhs.d_objectName);
+        if (comparison != 0) {
+            return comparison < 0;
+        }
+
+        return lhs.d_objectId < rhs.d_objectId;
+    }
+};
+
+void OpenMetricsPublisher::render()
+{
+    bsl::sort(d_samples.begin(), d_samples.end(), SampleSorter());
+
+    d_pending.clear();
+
+    const Sample* previous = 0;
+
+    for (SampleVector::const_iterator it = d_samples.begin();
+         it != d_samples.end();
+         ++it)
+    {
+        const Sample& sample = *it;
+
+        if (previous == 0 ||
+            bsl::strcmp(previous->d_prefix, sample.d_prefix) != 0 ||
+            bsl::strcmp(previous->d_name, sample.d_name) != 0)
+        {
+            d_pending.append("# TYPE ", 7);
+            appendMetricName(&d_pending, sample.d_prefix, sample.d_name);
+            d_pending.append(" gauge\n", 7);
+
+            if (*sample.d_description != 0) {
+                d_pending.append("# HELP ", 7);
+                appendMetricName(&d_pending, sample.d_prefix, sample.d_name);
+                d_pending.push_back(' ');
+                appendEscaped(&d_pending, sample.d_description);
+                d_pending.push_back('\n');
+            }
+        }
+
+        appendMetricName(&d_pending, sample.d_prefix, sample.d_name);
+
+        d_pending.append("{object=\"", 9);
+        appendEscaped(&d_pending, sample.d_objectName);
+        d_pending.append("\",id=\"", 6);
+        appendInteger(&d_pending, sample.d_objectId);
+        d_pending.append("\"} ", 3);
+
+        if (sample.d_integral) {
+            appendInteger(&d_pending, sample.d_integer);
+        }
+        else {
+            appendDouble(&d_pending, sample.d_value);
+        }
+
+        d_pending.push_back('\n');
+
+        previous = &sample;
+    }
+
+    d_pending.append("# EOF\n", 6);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_snapshot.swap(d_pending);
+    }
+
+    d_samples.clear();
+    d_objects.clear();
+}
+
+OpenMetricsPublisher::OpenMetricsPublisher(bslma::Allocator* basicAllocator)
+: d_mutex()
+, d_pendingMutex()
+, d_objects(basicAllocator)
+, d_samples(basicAllocator)
+, d_pending(basicAllocator)
+, d_snapshot("# EOF\n", basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+OpenMetricsPublisher::~OpenMetricsPublisher()
+{
+}
+
+void OpenMetricsPublisher::publish(
+    const bsl::shared_ptr<ntci::Monitorable>& monitorable,
+    const bdld::Datum&                        statistics,
+    const bsls::TimeInterval&                 time,
+    bool                                      final)
+{
+    NTCCFG_WARNING_UNUSED(time);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_pendingMutex);
+
+    if (statistics.isArray()) {
+        const bdld::DatumArrayRef array = statistics.theArray();
+
+        const char* objectName = nonNull(monitorable->objectName());
+        const int   objectId   = monitorable->objectId();
+
+        bool retained = false;
+
+        for (int fieldOrdinal = 0;
+             fieldOrdinal < static_cast<int>(array.length());
+             ++fieldOrdinal)
+        {
+            const bdld::Datum& datum = array.data()[fieldOrdinal];
+
+            // Skip nulls, which represent a statistic with no measured
+            // value during this interval.
+
+            Sample sample;
+
+            if (datum.isDouble()) {
+                sample.d_integral = false;
+                sample.d_integer  = 0;
+                sample.d_value    = datum.theDouble();
+            }
+            else if (datum.isInteger64()) {
+                sample.d_integral = true;
+                sample.d_integer  = datum.theInteger64();
+                sample.d_value    = 0.0;
+            }
+            else if (datum.isInteger()) {
+                sample.d_integral = true;
+                sample.d_integer  = datum.theInteger();
+                sample.d_value    = 0.0;
+            }
+            else {
+                continue;
+            }
+
+            const char* fieldName = monitorable->getFieldName(fieldOrdinal);
+            if (!fieldName) {
+                continue;
+            }
+
+            // The field names, prefixes, and descriptions are owned by the
+            // monitorable object, which is retained until the samples are
+            // rendered.
+
+            sample.d_prefix =
+                nonNull(monitorable->getFieldPrefix(fieldOrdinal));
+            sample.d_name = fieldName;
+            sample.d_description =
+                nonNull(monitorable->getFieldDescription(fieldOrdinal));
+            sample.d_objectName = objectName;
+            sample.d_objectId   = objectId;
+
+            d_samples.push_back(sample);
+
+            if (!retained) {
+                d_objects.push_back(monitorable);
+                retained = true;
+            }
+        }
+    }
+
+    if (final) {
+        this->render();
+    }
+}
+
+void OpenMetricsPublisher::load(bsl::string* result) const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    *result = d_snapshot;
+}
+
+const char* OpenMetricsPublisher::contentType()
+{
+    return k_CONTENT_TYPE;
+}
+
+void OpenMetricsListener::privateAccept(
+    const bsl::shared_ptr<ntci::ListenerSocket>& listenerSocket)
+{
+    bsl::shared_ptr<OpenMetricsListener> self = this->getSelf(this);
+
+    ntci::AcceptCallback acceptCallback = listenerSocket->createAcceptCallback(
+        NTCCFG_BIND(&OpenMetricsListener::processAccept,
+                    self,
+                    NTCCFG_BIND_PLACEHOLDER_1,
+                    NTCCFG_BIND_PLACEHOLDER_2,
+                    NTCCFG_BIND_PLACEHOLDER_3),
+        d_allocator_p);
+
+    ntsa::Error error =
+        listenerSocket->accept(ntca::AcceptOptions(), acceptCallback);
+    if (error && error != ntsa::Error::e_WOULD_BLOCK) {
+        this->privateAcceptFailed(listenerSocket, error);
+    }
+}
+
+void OpenMetricsListener::privateAcceptFailed(
+    const bsl::shared_ptr<ntci::ListenerSocket>& listenerSocket,
+    const ntsa::Error&                           error)
+{
+    NTCI_LOG_CONTEXT();
+
+    if (!isTransientAcceptError(error)) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+            if (d_listenerSocket_sp != listenerSocket) {
+                return;
+            }
+        }
+
+        NTCI_LOG_ERROR("Failed to accept metrics connection, stopping: %s",
+                       error.text().c_str());
+        this->stop();
+        return;
+    }
+
+    bsl::shared_ptr<OpenMetricsListener> self = this->getSelf(this);
+
+    ntca::TimerOptions timerOptions;
+    timerOptions.setOneShot(true);
+    timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
+    timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
+
+    ntci::TimerCallback timerCallback = listenerSocket->createTimerCallback(
+        NTCCFG_BIND(&OpenMetricsListener::processAcceptTimer,
+                    self,
+                    NTCCFG_BIND_PLACEHOLDER_1,
+                    NTCCFG_BIND_PLACEHOLDER_2),
+        d_allocator_p);
+
+    bsl::shared_ptr<ntci::Timer> timer = listenerSocket->createTimer(
+        timerOptions,
+        timerCallback,
+        d_allocator_p);
+
+    bsls::TimeInterval delay;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        if (d_listenerSocket_sp == listenerSocket && !d_acceptTimer_sp) {
+
+            if (d_acceptDelay == bsls::TimeInterval()) {
+                d_acceptDelay.setTotalMilliseconds(k_ACCEPT_DELAY_MIN);
+            }
+            else {
+                d_acceptDelay += d_acceptDelay;
+                if (d_acceptDelay.totalMilliseconds() > k_ACCEPT_DELAY_MAX) {
+                    d_acceptDelay.setTotalMilliseconds(k_ACCEPT_DELAY_MAX);
+                }
+            }
+
+            delay            = d_acceptDelay;
+            d_acceptTimer_sp = timer;
+        }
+    }
+
+    if (delay == bsls::TimeInterval()) {
+        timer->close();
+        return;
+    }
+
+    timer->schedule(listenerSocket->currentTime() + delay);
+
+    NTCI_LOG_WARN("Failed to accept metrics connection, retrying in "
+                  "%d milliseconds: %s",
+                  static_cast<int>(delay.totalMilliseconds()),
+                  error.text().c_str());
+}
+
+void OpenMetricsListener::privateReceive(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    const RequestPtr&                          request)
+{
+    bsl::shared_ptr<OpenMetricsListener> self = this->getSelf(this);
+
+    ntca::ReceiveOptions receiveOptions;
+    receiveOptions.setMinSize(1);
+    receiveOptions.setMaxSize(k_MAX_REQUEST_SIZE - request->size());
+    receiveOptions.setDeadline(streamSocket->currentTime() +
+                               bsls::TimeInterval(k_REQUEST_TIMEOUT, 0));
+
+    ntci::ReceiveCallback receiveCallback =
+        streamSocket->createReceiveCallback(
+            NTCCFG_BIND(&OpenMetricsListener::processReceive,
+                        self,
+                        streamSocket,
+                        request,
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2,
+                        NTCCFG_BIND_PLACEHOLDER_3),
+            d_allocator_p);
+
+    ntsa::Error error = streamSocket->receive(receiveOptions, receiveCallback);
+    if (error && error != ntsa::Error::e_WOULD_BLOCK) {
+        streamSocket->close();
+    }
+}
+
+void OpenMetricsListener::privateRespond(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    const bsl::string&                         request)
+{
+    bsl::shared_ptr<OpenMetricsListener> self = this->getSelf(this);
+
+    const bool isGet  = isMethod(request, "GET");
+    const bool isHead = isMethod(request, "HEAD");
+
+    bsl::string body(d_allocator_p);
+    bsl::string header(d_allocator_p);
+
+    if (isGet || isHead) {
+        d_publisher_sp->load(&body);
+
+        char buffer[32];
+        bsl::snprintf(buffer,
+                      sizeof buffer,
+                      "%llu",
+                      static_cast<unsigned long long>(body.size()));
+
+        header.append("HTTP/1.1 200 OK\r\n");
+        header.append("Content-Type: ");
+        header.append(OpenMetricsPublisher::contentType());
+        header.append("\r\n");
+        header.append("Content-Length: ");
+        header.append(buffer);
+        header.append("\r\n");
+    }
+    else {
+        header.append("HTTP/1.1 405 Method Not Allowed\r\n");
+        header.append("Allow: GET, HEAD\r\n");
+        header.append("Content-Length: 0\r\n");
+    }
+
+    header.append("Connection: close\r\n\r\n");
+
+    bdlbb::Blob response(streamSocket->outgoingBlobBufferFactory().get(),
+                         d_allocator_p);
+
+    bdlbb::BlobUtil::append(&response,
+                            header.data(),
+                            static_cast<int>(header.size()));
+
+    if (isGet && !body.empty()) {
+        bdlbb::BlobUtil::append(&response,
+                                body.data(),
+                                static_cast<int>(body.size()));
+    }
+
+    ntci::SendCallback sendCallback = streamSocket->createSendCallback(
+        NTCCFG_BIND(&OpenMetricsListener::processSend,
+                    self,
+                    streamSocket,
+                    NTCCFG_BIND_PLACEHOLDER_1,
+                    NTCCFG_BIND_PLACEHOLDER_2),
+        d_allocator_p);
+
+    ntsa::Error error =
+        streamSocket->send(response, ntca::SendOptions(), sendCallback);
+    if (error) {
+        streamSocket->close();
+    }
+}
+
+void OpenMetricsListener::processAccept(
+    const bsl::shared_ptr<ntci::Acceptor>&     acceptor,
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    const ntca::AcceptEvent&                   event)
+{
+    NTCCFG_WARNING_UNUSED(acceptor);
+
+    bsl::shared_ptr<ntci::ListenerSocket> listenerSocket;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        listenerSocket = d_listenerSocket_sp;
+
+        if (event.type() == ntca::AcceptEventType::e_COMPLETE) {
+            d_acceptDelay = bsls::TimeInterval();
+        }
+    }
+
+    if (event.type() == ntca::AcceptEventType::e_COMPLETE) {
+        RequestPtr request;
+        request.createInplace(d_allocator_p, d_allocator_p);
+
+        this->privateReceive(streamSocket, request);
+    }
+    else {
+        const ntsa::Error error = event.context().error();
+        if (error == ntsa::Error::e_EOF || error == ntsa::Error::e_CANCELLED) {
+            return;
+        }
+
+        if (listenerSocket) {
+            this->privateAcceptFailed(listenerSocket, error);
+        }
+
+        return;
+    }
+
+    if (listenerSocket) {
+        this->privateAccept(listenerSocket);
+    }
+}
+
+void OpenMetricsListener::processAcceptTimer(
+    const bsl::shared_ptr<ntci::Timer>& timer,
+    const ntca::TimerEvent&             event)
+{
+    if (event.type() != ntca::TimerEventType::e_DEADLINE) {
+        return;
+    }
+
+    bsl::shared_ptr<ntci::ListenerSocket> listenerSocket;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        if (timer != d_acceptTimer_sp) {
+            return;
+        }
+
+        d_acceptTimer_sp.reset();
+        listenerSocket = d_listenerSocket_sp;
+    }
+
+    timer->close();
+
+    if (listenerSocket) {
+        this->privateAccept(listenerSocket);
+    }
+}
+
+void OpenMetricsListener::processReceive(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    const RequestPtr&                          request,
+    const bsl::shared_ptr<ntci::Receiver>&     receiver,
+    const bsl::shared_ptr<bdlbb::Blob>&        data,
+    const ntca::ReceiveEvent&                  event)
+{
+    NTCCFG_WARNING_UNUSED(receiver);
+
+    if (event.type() == ntca::ReceiveEventType::e_ERROR) {
+        streamSocket->close();
+        return;
+    }
+
+    // Search only the data that could complete the delimiter.
+
+    bsl::size_t position = request->size();
+    if (position >= sizeof k_HEADER_DELIMITER - 1) {
+        position -= sizeof k_HEADER_DELIMITER - 1;
+    }
+    else {
+        position = 0;
+    }
+
+    appendBlob(request.get(), *data);
+
+    if (request->find(k_HEADER_DELIMITER, position) != bsl::string::npos) {
+        this->privateRespond(streamSocket, *request);
+    }
+    else if (request->size() >= k_MAX_REQUEST_SIZE) {
+        streamSocket->close();
+    }
+    else {
+        this->privateReceive(streamSocket, request);
+    }
+}
+
+void OpenMetricsListener::processSend(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    const bsl::shared_ptr<ntci::Sender>&       sender,
+    const ntca::SendEvent&                     event)
+{
+    NTCCFG_WARNING_UNUSED(sender);
+    NTCCFG_WARNING_UNUSED(event);
+
+    streamSocket->close();
+}
+
+OpenMetricsListener::OpenMetricsListener(
+    const bsl::shared_ptr<ntcm::OpenMetricsPublisher>& publisher,
+    const bsl::shared_ptr<ntci::Interface>&            interface,
+    const ntsa::Endpoint&                              endpoint,
+    bslma::Allocator*                                  basicAllocator)
+: d_mutex()
+, d_interface_sp(interface)
+, d_listenerSocket_sp()
+, d_acceptTimer_sp()
+, d_acceptDelay()
+, d_publisher_sp(publisher)
+, d_endpoint(endpoint)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+OpenMetricsListener::~OpenMetricsListener()
+{
+}
+
+ntsa::Error OpenMetricsListener::start()
+{
+    ntsa::Error error;
+
+    ntca::ListenerSocketOptions listenerSocketOptions;
+    listenerSocketOptions.setTransport(
+        d_endpoint.transport(ntsa::TransportMode::e_STREAM));
+    listenerSocketOptions.setSourceEndpoint(d_endpoint);
+    listenerSocketOptions.setReuseAddress(true);
+
+    bsl::shared_ptr<ntci::ListenerSocket> listenerSocket =
+        d_interface_sp->createListenerSocket(listenerSocketOptions,
+                                             d_allocator_p);
+
+    error = listenerSocket->open();
+    if (error) {
+        return error;
+    }
+
+    error = listenerSocket->listen();
+    if (error) {
+        listenerSocket->close();
+        return error;
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        if (d_listenerSocket_sp) {
+            listenerSocket->close();
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+
+        d_listenerSocket_sp = listenerSocket;
+    }
+
+    this->privateAccept(listenerSocket);
+
+    return ntsa::Error();
+}
+
+void OpenMetricsListener::stop()
+{
+    bsl::shared_ptr<ntci::ListenerSocket> listenerSocket;
+    bsl::shared_ptr<ntci::Timer>          acceptTimer;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        listenerSocket.swap(d_listenerSocket_sp);
+        acceptTimer.swap(d_acceptTimer_sp);
+        d_acceptDelay = bsls::TimeInterval();
+    }
+
+    if (acceptTimer) {
+        acceptTimer->close();
+    }
+
+    if (listenerSocket) {
+        listenerSocket->close();
+    }
+}
+
+ntsa::Endpoint OpenMetricsListener::sourceEndpoint() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (d_listenerSocket_sp) {
+        return d_listenerSocket_sp->sourceEndpoint();
+    }
+
+    return d_endpoint;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,281 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCM_OPENMETRICSPUBLISHER
+#define INCLUDED_NTCM_OPENMETRICSPUBLISHER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntca_acceptevent.h>
+#include <ntca_receiveevent.h>
+#include <ntca_sendevent.h>
+#include <ntca_timerevent.h>
+#include <ntccfg_platform.h>
+#include <ntci_acceptor.h>
+#include <ntci_interface.h>
+#include <ntci_listenersocket.h>
+#include <ntci_monitorable.h>
+#include <ntci_receiver.h>
+#include <ntci_sender.h>
+#include <ntci_streamsocket.h>
+#include <ntci_timer.h>
+#include <ntcscm_version.h>
+#include <ntsa_endpoint.h>
+#include <ntsa_error.h>
+#include <bdlbb_blob.h>
+#include <bslmt_mutex.h>
+#include <bsls_keyword.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ntcm {
+
+/// @internal @brief
+/// Provide a metrics publisher to the OpenMetrics text exposition format.
+///
+/// @details
+/// Each time the statistics of the registered monitorable objects are
+/// collected, this publisher renders the statistics into the OpenMetrics
+/// text exposition format, which is also understood by Prometheus, and
+/// retains the rendering as the current snapshot until the next collection
+/// completes. Each statistic is exposed as a gauge named by the field prefix
+/// and field name of the statistic, with the name and the locally-unique
+/// identifier of the monitorable object as labels. Samples of the same
+/// metric from different monitorable objects are grouped together, as
+/// required by the format.
+///
+/// The samples of each collection are accumulated and rendered into buffers
+/// owned by this object and reused for each collection, so that, once the
+/// buffers have grown to fit the number of statistics published, no memory
+/// is allocated for each sample.
+///
+/// The current snapshot may be served over HTTP by a
+/// 'ntcm::OpenMetricsListener'.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntcm
+class OpenMetricsPublisher : public ntci::MonitorablePublisher
+{
+    /// Describe a statistic published during the current collection.
+    struct Sample {
+        const char*        d_prefix;
+        const char*        d_name;
+        const char*        d_description;
+        const char*        d_objectName;
+        int                d_objectId;
+        bool               d_integral;
+        bsls::Types::Int64 d_integer;
+        double             d_value;
+    };
+
+    /// Provide a functor to order samples by metric then by object.
+    class SampleSorter;
+
+    /// Define a type alias for a vector of monitorable objects that have
+    /// published samples during the current collection.
+    typedef bsl::vector<bsl::shared_ptr<ntci::Monitorable> > ObjectVector;
+
+    /// Define a type alias for a vector of samples.
+    typedef bsl::vector<Sample> SampleVector;
+
+    mutable bslmt::Mutex d_mutex;
+    bslmt::Mutex         d_pendingMutex;
+    ObjectVector         d_objects;
+    SampleVector         d_samples;
+    bsl::string          d_pending;
+    bsl::string          d_snapshot;
+    bslma::Allocator*    d_allocator_p;
+
+  private:
+    OpenMetricsPublisher(const OpenMetricsPublisher&) BSLS_KEYWORD_DELETED;
+    OpenMetricsPublisher& operator=(const OpenMetricsPublisher&)
+        BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Render the samples accumulated during the current collection into
+    /// the pending buffer, then make the pending buffer the current
+    /// snapshot. The behavior is undefined unless 'd_pendingMutex' is
+    /// locked.
+    void render();
+
+  public:
+    /// Create a new OpenMetrics publisher. Optionally specify a
+    /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
+    /// the currently installed default allocator is used.
+    explicit OpenMetricsPublisher(bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~OpenMetricsPublisher() BSLS_KEYWORD_OVERRIDE;
+
+    /// Publish the specified 'statistics' collected from the specified
+    /// 'monitorable' object at the specified 'time'. If the specified
+    /// 'final' flag is true, these 'statistics' are the final statistics
+    /// collected during the same sample at the 'time'.
+    void publish(const bsl::shared_ptr<ntci::Monitorable>& monitorable,
+                 const bdld::Datum&                        statistics,
+                 const bsls::TimeInterval&                 time,
+                 bool final) BSLS_KEYWORD_OVERRIDE;
+
+    /// Load into the specified 'result' the rendering of the statistics
+    /// published during the most recently completed collection, in the
+    /// OpenMetrics text exposition format.
+    void load(bsl::string* result) const;
+
+    /// Return the content type of the rendering.
+    static const char* contentType();
+};
+
+/// @internal @brief
+/// Provide a minimal HTTP server of the metrics rendered by an OpenMetrics
+/// publisher.
+///
+/// @details
+/// This class listens for connections at an endpoint and responds to each
+/// HTTP GET request with the current snapshot of an
+/// 'ntcm::OpenMetricsPublisher', then closes the connection. This class is
+/// intended to be scraped by a metrics collection agent: it does not
+/// support persistent connections, chunked transfer encoding, or request
+/// bodies.
+///
+/// When a connection cannot be accepted because a resource, such as the
+/// number of open file descriptors, is exhausted, the next connection is
+/// accepted after a delay that doubles with each consecutive failure, so
+/// that the listener does not spin while the resource remains exhausted.
+/// When a connection cannot be accepted for any other reason, the listener
+/// stops.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntcm
+class OpenMetricsListener : public ntccfg::Shared<OpenMetricsListener>
+{
+    /// Define a type alias for a shared pointer to a request being
+    /// accumulated.
+    typedef bsl::shared_ptr<bsl::string> RequestPtr;
+
+    enum {
+        /// The maximum size of the request line and headers of a request.
+        k_MAX_REQUEST_SIZE = 8192
+    };
+
+    mutable bslmt::Mutex                        d_mutex;
+    bsl::shared_ptr<ntci::Interface>            d_interface_sp;
+    bsl::shared_ptr<ntci::ListenerSocket>       d_listenerSocket_sp;
+    bsl::shared_ptr<ntci::Timer>                d_acceptTimer_sp;
+    bsls::TimeInterval                          d_acceptDelay;
+    bsl::shared_ptr<ntcm::OpenMetricsPublisher> d_publisher_sp;
+    ntsa::Endpoint                              d_endpoint;
+    bslma::Allocator*                           d_allocator_p;
+
+  private:
+    OpenMetricsListener(const OpenMetricsListener&) BSLS_KEYWORD_DELETED;
+    OpenMetricsListener& operator=(const OpenMetricsListener&)
+        BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Accept the next connection from the specified 'listenerSocket'.
+    void privateAccept(
+        const bsl::shared_ptr<ntci::ListenerSocket>& listenerSocket);
+
+    /// Handle the failure to accept a connection from the specified
+    /// 'listenerSocket' with the specified 'error': accept the next
+    /// connection after a delay if 'error' indicates the exhaustion of a
+    /// resource or a connection aborted by its peer, otherwise stop.
+    void privateAcceptFailed(
+        const bsl::shared_ptr<ntci::ListenerSocket>& listenerSocket,
+        const ntsa::Error&                           error);
+
+    /// Receive more of the specified 'request' from the specified
+    /// 'streamSocket'.
+    void privateReceive(
+        const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+        const RequestPtr&                          request);
+
+    /// Respond to the specified complete 'request' on the specified
+    /// 'streamSocket'.
+    void privateRespond(
+        const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+        const bsl::string&                         request);
+
+    /// Process the acceptance of the specified 'streamSocket' by the
+    /// specified 'acceptor' according to the specified 'event'.
+    void processAccept(const bsl::shared_ptr<ntci::Acceptor>&     acceptor,
+                       const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+                       const ntca::AcceptEvent&                   event);
+
+    /// Process the expiration of the delay before the next connection is
+    /// accepted as indicated by the specified 'event' of the specified
+    /// 'timer'.
+    void processAcceptTimer(const bsl::shared_ptr<ntci::Timer>& timer,
+                            const ntca::TimerEvent&             event);
+
+    /// Process the reception of the specified 'data' by the specified
+    /// 'receiver' as part of the specified 'request' from the specified
+    /// 'streamSocket' according to the specified 'event'.
+    void processReceive(
+        const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+        const RequestPtr&                          request,
+        const bsl::shared_ptr<ntci::Receiver>&     receiver,
+        const bsl::shared_ptr<bdlbb::Blob>&        data,
+        const ntca::ReceiveEvent&                  event);
+
+    /// Process the completion of the response sent by the specified
+    /// 'sender' on the specified 'streamSocket' according to the specified
+    /// 'event'.
+    void processSend(const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+                     const bsl::shared_ptr<ntci::Sender>&       sender,
+                     const ntca::SendEvent&                     event);
+
+  public:
+    /// Create a new OpenMetrics listener serving the snapshot of the
+    /// specified 'publisher' from a listener socket created by the
+    /// specified 'interface' bound to the specified 'endpoint'.
+    /// Optionally specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    OpenMetricsListener(
+        const bsl::shared_ptr<ntcm::OpenMetricsPublisher>& publisher,
+        const bsl::shared_ptr<ntci::Interface>&            interface,
+        const ntsa::Endpoint&                              endpoint,
+        bslma::Allocator*                                  basicAllocator = 0);
+
+    /// Destroy this object.
+    ~OpenMetricsListener();
+
+    /// Begin listening for connections and serving requests. Return the
+    /// error.
+    ntsa::Error start();
+
+    /// Stop listening for connections. Requests already received are
+    /// still served.
+    void stop();
+
+    /// Return the endpoint at which this object listens for connections,
+    /// which may differ from the endpoint specified at construction if
+    /// that endpoint had an unspecified port.
+    ntsa::Endpoint sourceEndpoint() const;
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
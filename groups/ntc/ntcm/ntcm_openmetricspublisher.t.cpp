@@ -0,0 +1,3463 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcm_openmetricspublisher.h>
+
+#include <ntccfg_test.h>
+#include <ntca_acceptcontext.h>
+#include <ntca_acceptevent.h>
+#include <ntca_listenersocketoptions.h>
+#include <ntca_receivecontext.h>
+#include <ntca_receiveevent.h>
+#include <ntca_receiveoptions.h>
+#include <ntca_sendevent.h>
+#include <ntca_timercontext.h>
+#include <ntca_timerevent.h>
+#include <ntca_timeroptions.h>
+#include <ntci_interface.h>
+#include <ntci_listenersocket.h>
+#include <ntci_resolver.h>
+#include <ntci_streamsocket.h>
+#include <ntci_timer.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+#include <bdld_datum.h>
+#include <bdld_manageddatum.h>
+#include <bdlf_bind.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstring.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The publisher is tested directly. The listener is tested against a mock
+// interface that creates a mock listener socket, whose accept operations
+// are completed or failed by the test, and mock timers, which expire when
+// the test advances a virtual clock. The connections it accepts are mock
+// stream sockets whose remote peers are played by the test. All events are
+// deferred until the test drains them.
+//-----------------------------------------------------------------------------
+
+// [ 1]
+//-----------------------------------------------------------------------------
+// [ 1] Rendering
+// [ 2] GET
+// [ 3] HEAD
+// [ 4] Method not allowed
+// [ 5] Oversized request
+// [ 6] Request timeout
+// [ 7] Accept backoff on exhausted resources
+// [ 8] Accept failure
+//-----------------------------------------------------------------------------
+
+namespace test {
+
+/// Provide a monitorable object measuring a count and a latency for use by
+/// this test driver.
+class Object : public ntci::Monitorable
+{
+    bsl::string        d_name;
+    bsls::Types::Int64 d_count;
+    double             d_latency;
+
+  private:
+    Object(const Object&) BSLS_KEYWORD_DELETED;
+    Object& operator=(const Object&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new object having the specified 'name' that measures the
+    /// specified 'count' and 'latency'. Optionally specify a
+    /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
+    /// the currently installed default allocator is used.
+    Object(const bsl::string& name,
+           bsls::Types::Int64 count,
+           double             latency,
+           bslma::Allocator*  basicAllocator = 0)
+    : d_name(name, basicAllocator)
+    , d_count(count)
+    , d_latency(latency)
+    {
+    }
+
+    /// Destroy this object.
+    ~Object() BSLS_KEYWORD_OVERRIDE
+    {
+    }
+
+    /// Load into the specified 'result' the array of statistics for this
+    /// object: the count, the latency, and a statistic with no value.
+    void getStats(bdld::ManagedDatum* result) BSLS_KEYWORD_OVERRIDE
+    {
+        bdld::DatumMutableArrayRef array;
+        bdld::Datum::createUninitializedArray(&array,
+                                              3,
+                                              result->allocator());
+
+        array.data()[0] =
+            bdld::Datum::createInteger64(d_count, result->allocator());
+        array.data()[1] = bdld::Datum::createDouble(d_latency);
+        array.data()[2] = bdld::Datum::createNull();
+
+        *array.length() = 3;
+
+        result->adopt(bdld::Datum::adoptArray(array));
+    }
+
+    /// Return the prefix of each field.
+    const char* getFieldPrefix(int ordinal) const BSLS_KEYWORD_OVERRIDE
+    {
+        NTCCFG_WARNING_UNUSED(ordinal);
+        return "socket";
+    }
+
+    /// Return the name of the field at the specified 'ordinal'.
+    const char* getFieldName(int ordinal) const BSLS_KEYWORD_OVERRIDE
+    {
+        switch (ordinal) {
+        case 0:
+            return "bytesSent.count";
+        case 1:
+            return "latency.avg";
+        case 2:
+            return "unmeasured.avg";
+        default:
+            return 0;
+        }
+    }
+
+    /// Return the description of each field.
+    const char* getFieldDescription(int ordinal) const BSLS_KEYWORD_OVERRIDE
+    {
+        NTCCFG_WARNING_UNUSED(ordinal);
+        return "";
+    }
+
+    /// Return the type of the field at the specified 'ordinal'.
+    ntci::Monitorable::StatisticType getFieldType(int ordinal) const
+        BSLS_KEYWORD_OVERRIDE
+    {
+        return ordinal == 0 ? ntci::Monitorable::e_SUM
+                            : ntci::Monitorable::e_AVERAGE;
+    }
+
+    /// Return the tags of each field.
+    int getFieldTags(int ordinal) const BSLS_KEYWORD_OVERRIDE
+    {
+        NTCCFG_WARNING_UNUSED(ordinal);
+        return ntci::Monitorable::e_ANONYMOUS;
+    }
+
+    /// Return the ordinal of the specified 'fieldName'.
+    int getFieldOrdinal(const char* fieldName) const BSLS_KEYWORD_OVERRIDE
+    {
+        for (int ordinal = 0; ordinal < 3; ++ordinal) {
+            if (bsl::strcmp(getFieldName(ordinal), fieldName) == 0) {
+                return ordinal;
+            }
+        }
+        return -1;
+    }
+
+    /// Return the number of fields.
+    int numOrdinals() const BSLS_KEYWORD_OVERRIDE
+    {
+        return 3;
+    }
+
+    /// Return the name of this object.
+    const char* objectName() const BSLS_KEYWORD_OVERRIDE
+    {
+        return d_name.c_str();
+    }
+};
+
+/// Publish the statistics of the specified 'object' to the specified
+/// 'publisher', marking the publication as final according to the
+/// specified 'final' flag.
+void publish(ntcm::OpenMetricsPublisher*          publisher,
+             const bsl::shared_ptr<test::Object>& object,
+             bool                                 final,
+             bslma::Allocator*                    allocator)
+{
+    bdld::ManagedDatum statistics(allocator);
+    object->getStats(&statistics);
+
+    publisher->publish(object,
+                       statistics.datum(),
+                       bsls::TimeInterval(),
+                       final);
+}
+
+class Timer;
+
+/// This class implements a loop that defers the events announced by the
+/// mock sockets until the test drains it, and that drives a virtual clock
+/// which expires the mock timers when the test advances it.
+class Loop
+{
+    /// Define a type alias for a queue of deferred functions.
+    typedef bsl::vector<ntci::Executor::Functor> FunctorQueue;
+
+    /// Define a type alias for a vector of timers.
+    typedef bsl::vector<bsl::shared_ptr<test::Timer> > TimerVector;
+
+    mutable bslmt::Mutex d_mutex;
+    FunctorQueue         d_functorQueue;
+    TimerVector          d_timers;
+    bsls::TimeInterval   d_now;
+    bslma::Allocator*    d_allocator_p;
+
+  private:
+    Loop(const Loop&) BSLS_KEYWORD_DELETED;
+    Loop& operator=(const Loop&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new loop. Optionally specify a 'basicAllocator' used to
+    /// supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    explicit Loop(bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~Loop();
+
+    /// Defer the specified 'functor' until the loop is next drained.
+    void execute(const ntci::Executor::Functor& functor);
+
+    /// Invoke each deferred function, including those deferred while
+    /// draining, until no function is deferred.
+    void drain();
+
+    /// Register the specified 'timer' to be expired when its deadline is
+    /// reached by the virtual clock.
+    void registerTimer(const bsl::shared_ptr<test::Timer>& timer);
+
+    /// Advance the virtual clock by the specified 'interval', expire each
+    /// timer whose deadline is reached, then drain the loop.
+    void advance(const bsls::TimeInterval& interval);
+
+    /// Return the current time of the virtual clock.
+    bsls::TimeInterval now() const;
+
+    /// Return the number of timers registered.
+    bsl::size_t numTimers() const;
+
+    /// Return the number of timers registered that are scheduled.
+    bsl::size_t numScheduledTimers() const;
+
+    /// Return the timer at the specified 'index'.
+    bsl::shared_ptr<test::Timer> timer(bsl::size_t index) const;
+};
+
+/// This class mocks the ntci::Timer interface. The timer expires when the
+/// virtual clock of its loop reaches its deadline.
+class Timer : public ntci::Timer, public ntccfg::Shared<Timer>
+{
+    mutable bslmt::Mutex          d_mutex;
+    test::Loop*                   d_loop_p;
+    ntci::TimerCallback           d_callback;
+    bsls::TimeInterval            d_deadline;
+    bool                          d_scheduled;
+    bool                          d_closed;
+    bsl::shared_ptr<ntci::Strand> d_strand_sp;
+    bslma::Allocator*             d_allocator_p;
+
+  private:
+    Timer(const Timer&) BSLS_KEYWORD_DELETED;
+    Timer& operator=(const Timer&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new timer driven by the specified 'loop' that invokes the
+    /// specified 'callback' when it expires. Optionally specify a
+    /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
+    /// the currently installed default allocator is used.
+    Timer(test::Loop*                loop,
+          const ntci::TimerCallback& callback,
+          bslma::Allocator*          basicAllocator = 0);
+
+    /// Destroy this object.
+    ~Timer() BSLS_KEYWORD_OVERRIDE;
+
+    /// Announce the expiration of the timer if it is scheduled and its
+    /// deadline is at or before the specified 'now'.
+    void expire(const bsls::TimeInterval& now);
+
+    /// Return the deadline of the timer.
+    bsls::TimeInterval deadline() const;
+
+    /// Return true if the timer is scheduled, otherwise return false.
+    bool isScheduled() const;
+
+    /// Return true if the timer is closed, otherwise return false.
+    bool isClosed() const;
+
+    /// Schedule the timer to expire at the specified 'deadline'. The
+    /// specified 'period' must be zero. Return the error.
+    ntsa::Error schedule(const bsls::TimeInterval& deadline,
+                         const bsls::TimeInterval& period)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Cancel the timer. Return the error.
+    ntsa::Error cancel() BSLS_KEYWORD_OVERRIDE;
+
+    /// Close the timer and release its callback. Return the error.
+    ntsa::Error close() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the null strand.
+    const bsl::shared_ptr<ntci::Strand>& strand() const
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the current time of the virtual clock.
+    bsls::TimeInterval currentTime() const BSLS_KEYWORD_OVERRIDE;
+
+    // The following functions are assumed to be never called.
+
+    void arrive(const bsl::shared_ptr<ntci::Timer>&,
+                const bsls::TimeInterval&,
+                const bsls::TimeInterval&) BSLS_KEYWORD_OVERRIDE;
+    void* handle() const BSLS_KEYWORD_OVERRIDE;
+    int id() const BSLS_KEYWORD_OVERRIDE;
+    bool oneShot() const BSLS_KEYWORD_OVERRIDE;
+    bslmt::ThreadUtil::Handle threadHandle() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t threadIndex() const BSLS_KEYWORD_OVERRIDE;
+};
+
+
+/// This class mocks the ntci::StreamSocket interface. The test plays the
+/// role of the remote peer: it delivers data to the socket, expires the
+/// deadline of the pending receive operation, and observes the data sent
+/// by the socket. All events are announced when the loop is drained.
+class StreamSocket : public ntci::StreamSocket,
+                     public ntccfg::Shared<StreamSocket>
+{
+    mutable bslmt::Mutex                      d_mutex;
+    test::Loop*                               d_loop_p;
+    bsl::string                               d_readQueue;
+    ntca::ReceiveOptions                      d_receiveOptions;
+    ntci::ReceiveCallback                     d_receiveCallback;
+    bsl::string                               d_transmitted;
+    bool                                      d_closed;
+    bsl::shared_ptr<bdlbb::BlobBufferFactory> d_blobBufferFactory_sp;
+    bsl::shared_ptr<ntci::Strand>             d_strand_sp;
+    bslma::Allocator*                         d_allocator_p;
+
+  private:
+    StreamSocket(const StreamSocket&) BSLS_KEYWORD_DELETED;
+    StreamSocket& operator=(const StreamSocket&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Satisfy the pending receive operation, if any, from the read queue.
+    /// The behavior is undefined unless 'd_mutex' is locked.
+    void privateSatisfy();
+
+    /// Announce the specified 'data' received according to the specified
+    /// 'event' to the specified 'callback'.
+    void announceReceive(const ntci::ReceiveCallback&        callback,
+                         const bsl::shared_ptr<bdlbb::Blob>& data,
+                         const ntca::ReceiveEvent&           event);
+
+    /// Announce the completion of a send operation to the specified
+    /// 'callback'.
+    void announceSend(const ntci::SendCallback& callback);
+
+  public:
+    /// Create a new stream socket whose events are deferred to the
+    /// specified 'loop'. Optionally specify a 'basicAllocator' used to
+    /// supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    explicit StreamSocket(test::Loop*       loop,
+                          bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~StreamSocket() BSLS_KEYWORD_OVERRIDE;
+
+    /// Append the specified 'data' received from the remote peer to the
+    /// read queue.
+    void deliver(const bsl::string& data);
+
+    /// Fail the pending receive operation as if its deadline expired.
+    void expire();
+
+    /// Return the options of the most recent receive operation.
+    ntca::ReceiveOptions receiveOptions() const;
+
+    /// Return true if a receive operation is pending, otherwise return
+    /// false.
+    bool isReceiving() const;
+
+    /// Return the data transmitted to the remote peer.
+    bsl::string transmitted() const;
+
+    /// Return true if the socket is closed, otherwise return false.
+    bool isClosed() const;
+
+    /// Dequeue at least the minimum and at most the maximum number of bytes
+    /// specified by the 'options' from the read queue, and invoke the
+    /// specified 'callback' with the data when the loop is drained. Return
+    /// the error.
+    ntsa::Error receive(const ntca::ReceiveOptions&  options,
+                        const ntci::ReceiveCallback& callback)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Transmit the specified 'data' to the remote peer and invoke the
+    /// specified 'callback' when the loop is drained. The specified
+    /// 'options' are ignored. Return the error.
+    ntsa::Error send(const bdlbb::Blob&        data,
+                     const ntca::SendOptions&  options,
+                     const ntci::SendCallback& callback)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Close the socket and release its callbacks.
+    void close() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the null strand.
+    const bsl::shared_ptr<ntci::Strand>& strand() const
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the current time of the virtual clock.
+    bsls::TimeInterval currentTime() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the blob buffer factory.
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&
+    incomingBlobBufferFactory() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the blob buffer factory.
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&
+    outgoingBlobBufferFactory() const BSLS_KEYWORD_OVERRIDE;
+
+    // The following functions are assumed to be never called.
+
+    ntsa::Handle handle() const BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(ntsa::Transport::Value) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(ntsa::Transport::Value,
+                     ntsa::Handle) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(
+        ntsa::Transport::Value,
+        const bsl::shared_ptr<ntsi::StreamSocket>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(
+        ntsa::Transport::Value,
+        ntsa::Handle,
+        const bsl::shared_ptr<ntci::ListenerSocket>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(
+        ntsa::Transport::Value,
+        const bsl::shared_ptr<ntsi::StreamSocket>&,
+        const bsl::shared_ptr<ntci::ListenerSocket>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const ntsa::Endpoint&,
+                     const ntca::BindOptions&,
+                     const ntci::BindFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const ntsa::Endpoint&,
+                     const ntca::BindOptions&,
+                     const ntci::BindCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const bsl::string&,
+                     const ntca::BindOptions&,
+                     const ntci::BindFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const bsl::string&,
+                     const ntca::BindOptions&,
+                     const ntci::BindCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error connect(const ntsa::Endpoint&,
+                        const ntca::ConnectOptions&,
+                        const ntci::ConnectFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error connect(const ntsa::Endpoint&,
+                        const ntca::ConnectOptions&,
+                        const ntci::ConnectCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error connect(const bsl::string&,
+                        const ntca::ConnectOptions&,
+                        const ntci::ConnectFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error connect(const bsl::string&,
+                        const ntca::ConnectOptions&,
+                        const ntci::ConnectCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::Encryption>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::Encryption>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::EncryptionClient>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::EncryptionClient>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::EncryptionServer>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::EncryptionServer>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const bdlbb::Blob&,
+                     const ntca::SendOptions&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const ntsa::Data&,
+                     const ntca::SendOptions&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const bdlbb::Blob&,
+                     const ntca::SendOptions&,
+                     const ntci::SendFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const ntsa::Data&,
+                     const ntca::SendOptions&,
+                     const ntci::SendFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const ntsa::Data&,
+                     const ntca::SendOptions&,
+                     const ntci::SendCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error receive(ntca::ReceiveContext*,
+                        bdlbb::Blob*,
+                        const ntca::ReceiveOptions&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error receive(const ntca::ReceiveOptions&,
+                        const ntci::ReceiveFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerResolver(
+        const bsl::shared_ptr<ntci::Resolver>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error deregisterResolver() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerManager(
+        const bsl::shared_ptr<ntci::StreamSocketManager>&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error deregisterManager() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerSession(
+        const bsl::shared_ptr<ntci::StreamSocketSession>&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerSessionCallback(
+        const ntci::StreamSocket::SessionCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerSessionCallback(
+        const ntci::StreamSocket::SessionCallback&,
+        const bsl::shared_ptr<ntci::Strand>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error deregisterSession() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setWriteRateLimiter(
+        const bsl::shared_ptr<ntci::RateLimiter>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setWriteQueueLowWatermark(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setWriteQueueHighWatermark(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setWriteQueueWatermarks(bsl::size_t,
+                                        bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setReadRateLimiter(
+        const bsl::shared_ptr<ntci::RateLimiter>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setReadQueueLowWatermark(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setReadQueueHighWatermark(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setReadQueueWatermarks(bsl::size_t,
+                                       bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error relaxFlowControl(
+        ntca::FlowControlType::Value) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error applyFlowControl(
+        ntca::FlowControlType::Value,
+        ntca::FlowControlMode::Value) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::BindToken&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::ConnectToken&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::UpgradeToken&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::SendToken&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::ReceiveToken&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error downgrade() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error shutdown(ntsa::ShutdownType::Value,
+                         ntsa::ShutdownMode::Value) BSLS_KEYWORD_OVERRIDE;
+    void close(const ntci::CloseFunction&) BSLS_KEYWORD_OVERRIDE;
+    void close(const ntci::CloseCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Transport::Value transport() const BSLS_KEYWORD_OVERRIDE;
+    ntsa::Endpoint sourceEndpoint() const BSLS_KEYWORD_OVERRIDE;
+    ntsa::Endpoint remoteEndpoint() const BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::EncryptionCertificate> sourceCertificate() const
+        BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::EncryptionCertificate> remoteCertificate() const
+        BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::EncryptionKey> privateKey() const
+        BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::ListenerSocket> acceptor() const
+        BSLS_KEYWORD_OVERRIDE;
+    bslmt::ThreadUtil::Handle threadHandle() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t threadIndex() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t readQueueSize() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t readQueueLowWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t readQueueHighWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t writeQueueSize() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t writeQueueLowWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t writeQueueHighWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t totalBytesSent() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t totalBytesReceived() const BSLS_KEYWORD_OVERRIDE;
+    void execute(const Functor&) BSLS_KEYWORD_OVERRIDE;
+    void moveAndExecute(FunctorSequence*,
+                        const Functor&) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Strand> createStrand(
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&,
+        const bsl::shared_ptr<ntci::TimerSession>&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&,
+        const ntci::TimerCallback&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntsa::Data> createIncomingData() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntsa::Data> createOutgoingData() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<bdlbb::Blob> createIncomingBlob() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<bdlbb::Blob> createOutgoingBlob() BSLS_KEYWORD_OVERRIDE;
+    void createIncomingBlobBuffer(bdlbb::BlobBuffer*) BSLS_KEYWORD_OVERRIDE;
+    void createOutgoingBlobBuffer(bdlbb::BlobBuffer*) BSLS_KEYWORD_OVERRIDE;
+};
+
+/// This class mocks the ntci::ListenerSocket interface. The test plays the
+/// role of the operating system: it completes or fails the pending accept
+/// operation. All events are announced when the loop is drained.
+class ListenerSocket : public ntci::ListenerSocket,
+                       public ntccfg::Shared<ListenerSocket>
+{
+    mutable bslmt::Mutex                      d_mutex;
+    test::Loop*                               d_loop_p;
+    ntci::AcceptCallback                      d_acceptCallback;
+    bsl::size_t                               d_numAccepts;
+    bool                                      d_listening;
+    bool                                      d_closed;
+    ntsa::Endpoint                            d_sourceEndpoint;
+    bsl::shared_ptr<bdlbb::BlobBufferFactory> d_blobBufferFactory_sp;
+    bsl::shared_ptr<ntci::Strand>             d_strand_sp;
+    bslma::Allocator*                         d_allocator_p;
+
+  private:
+    ListenerSocket(const ListenerSocket&) BSLS_KEYWORD_DELETED;
+    ListenerSocket& operator=(const ListenerSocket&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Announce the specified 'streamSocket' accepted according to the
+    /// specified 'event' to the specified 'callback'.
+    void announceAccept(
+        const ntci::AcceptCallback&                 callback,
+        const bsl::shared_ptr<test::StreamSocket>& streamSocket,
+        const ntca::AcceptEvent&                    event);
+
+    /// Complete the pending accept operation according to the specified
+    /// 'event' with the specified 'streamSocket', if any.
+    void complete(const bsl::shared_ptr<test::StreamSocket>& streamSocket,
+                  const ntca::AcceptEvent&                    event);
+
+  public:
+    /// Create a new listener socket bound to the specified 'sourceEndpoint'
+    /// whose events are deferred to the specified 'loop'. Optionally
+    /// specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    ListenerSocket(test::Loop*           loop,
+                   const ntsa::Endpoint& sourceEndpoint,
+                   bslma::Allocator*     basicAllocator = 0);
+
+    /// Destroy this object.
+    ~ListenerSocket() BSLS_KEYWORD_OVERRIDE;
+
+    /// Complete the pending accept operation with the specified
+    /// 'streamSocket', as if a remote peer connected.
+    void connect(const bsl::shared_ptr<test::StreamSocket>& streamSocket);
+
+    /// Fail the pending accept operation with the specified 'error'.
+    void fail(const ntsa::Error& error);
+
+    /// Return the number of accept operations initiated.
+    bsl::size_t numAccepts() const;
+
+    /// Return true if an accept operation is pending, otherwise return
+    /// false.
+    bool isAccepting() const;
+
+    /// Return true if the socket is listening, otherwise return false.
+    bool isListening() const;
+
+    /// Return true if the socket is closed, otherwise return false.
+    bool isClosed() const;
+
+    /// Open the socket. Return the error.
+    ntsa::Error open() BSLS_KEYWORD_OVERRIDE;
+
+    /// Listen for connections. Return the error.
+    ntsa::Error listen() BSLS_KEYWORD_OVERRIDE;
+
+    /// Invoke the specified 'callback' when the test completes or fails the
+    /// accept operation. The specified 'options' are ignored. Return the
+    /// error.
+    ntsa::Error accept(const ntca::AcceptOptions&  options,
+                       const ntci::AcceptCallback& callback)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Close the socket and release its accept callback.
+    void close() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return a new one-shot timer that invokes the specified 'callback'
+    /// when it expires. The specified 'options' must be one-shot.
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&  options,
+        const ntci::TimerCallback& callback,
+        bslma::Allocator*          basicAllocator) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the source endpoint.
+    ntsa::Endpoint sourceEndpoint() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the null strand.
+    const bsl::shared_ptr<ntci::Strand>& strand() const
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the current time of the virtual clock.
+    bsls::TimeInterval currentTime() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the blob buffer factory.
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&
+    incomingBlobBufferFactory() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the blob buffer factory.
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&
+    outgoingBlobBufferFactory() const BSLS_KEYWORD_OVERRIDE;
+
+    // The following functions are assumed to be never called.
+
+    ntsa::Handle handle() const BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(ntsa::Transport::Value) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(ntsa::Transport::Value,
+                     ntsa::Handle) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(
+        ntsa::Transport::Value,
+        const bsl::shared_ptr<ntsi::ListenerSocket>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const ntsa::Endpoint&,
+                     const ntca::BindOptions&,
+                     const ntci::BindFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const ntsa::Endpoint&,
+                     const ntca::BindOptions&,
+                     const ntci::BindCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const bsl::string&,
+                     const ntca::BindOptions&,
+                     const ntci::BindFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const bsl::string&,
+                     const ntca::BindOptions&,
+                     const ntci::BindCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error listen(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error accept(ntca::AcceptContext*,
+                       bsl::shared_ptr<ntci::StreamSocket>*,
+                       const ntca::AcceptOptions&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error accept(const ntca::AcceptOptions&,
+                       const ntci::AcceptFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerResolver(
+        const bsl::shared_ptr<ntci::Resolver>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error deregisterResolver() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerManager(
+        const bsl::shared_ptr<ntci::ListenerSocketManager>&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error deregisterManager() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerSession(
+        const bsl::shared_ptr<ntci::ListenerSocketSession>&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerSessionCallback(
+        const ntci::ListenerSocket::SessionCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerSessionCallback(
+        const ntci::ListenerSocket::SessionCallback&,
+        const bsl::shared_ptr<ntci::Strand>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error deregisterSession() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setAcceptRateLimiter(
+        const bsl::shared_ptr<ntci::RateLimiter>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setAcceptQueueLowWatermark(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setAcceptQueueHighWatermark(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setAcceptQueueWatermarks(bsl::size_t,
+                                         bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error relaxFlowControl(
+        ntca::FlowControlType::Value) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error applyFlowControl(
+        ntca::FlowControlType::Value,
+        ntca::FlowControlMode::Value) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::BindToken&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::AcceptToken&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error shutdown() BSLS_KEYWORD_OVERRIDE;
+    void close(const ntci::CloseFunction&) BSLS_KEYWORD_OVERRIDE;
+    void close(const ntci::CloseCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Transport::Value transport() const BSLS_KEYWORD_OVERRIDE;
+    bslmt::ThreadUtil::Handle threadHandle() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t threadIndex() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t acceptQueueSize() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t acceptQueueLowWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t acceptQueueHighWatermark() const BSLS_KEYWORD_OVERRIDE;
+    void execute(const Functor&) BSLS_KEYWORD_OVERRIDE;
+    void moveAndExecute(FunctorSequence*,
+                        const Functor&) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Strand> createStrand(
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&,
+        const bsl::shared_ptr<ntci::TimerSession>&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntsa::Data> createIncomingData() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntsa::Data> createOutgoingData() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<bdlbb::Blob> createIncomingBlob() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<bdlbb::Blob> createOutgoingBlob() BSLS_KEYWORD_OVERRIDE;
+    void createIncomingBlobBuffer(bdlbb::BlobBuffer*) BSLS_KEYWORD_OVERRIDE;
+    void createOutgoingBlobBuffer(bdlbb::BlobBuffer*) BSLS_KEYWORD_OVERRIDE;
+};
+
+/// This class mocks the ntci::Interface interface. It creates a mock
+/// listener socket driven by a loop, and retains it so that the test may
+/// play the role of the operating system.
+class Interface : public ntci::Interface, public ntccfg::Shared<Interface>
+{
+    mutable bslmt::Mutex                      d_mutex;
+    test::Loop*                               d_loop_p;
+    bsl::shared_ptr<test::ListenerSocket>     d_listenerSocket_sp;
+    bsl::shared_ptr<ntci::Resolver>           d_resolver_sp;
+    bsl::shared_ptr<bdlbb::BlobBufferFactory> d_blobBufferFactory_sp;
+    bsl::shared_ptr<ntci::Strand>             d_strand_sp;
+    bslma::Allocator*                         d_allocator_p;
+
+  private:
+    Interface(const Interface&) BSLS_KEYWORD_DELETED;
+    Interface& operator=(const Interface&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new interface whose sockets and timers are driven by the
+    /// specified 'loop'. Optionally specify a 'basicAllocator' used to
+    /// supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    explicit Interface(test::Loop*       loop,
+                       bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~Interface() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the listener socket most recently created.
+    bsl::shared_ptr<test::ListenerSocket> listenerSocket() const;
+
+    /// Return a new listener socket bound to the source endpoint of the
+    /// specified 'options'.
+    bsl::shared_ptr<ntci::ListenerSocket> createListenerSocket(
+        const ntca::ListenerSocketOptions& options,
+        bslma::Allocator*                  basicAllocator)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the null resolver.
+    const bsl::shared_ptr<ntci::Resolver>& resolver() const
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the null blob buffer factory.
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&
+    incomingBlobBufferFactory() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the null blob buffer factory.
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&
+    outgoingBlobBufferFactory() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the null strand.
+    const bsl::shared_ptr<ntci::Strand>& strand() const
+        BSLS_KEYWORD_OVERRIDE;
+
+    // The following functions are assumed to be never called.
+
+    ntsa::Error start() BSLS_KEYWORD_OVERRIDE;
+    void shutdown() BSLS_KEYWORD_OVERRIDE;
+    void linger() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error closeAll() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::DatagramSocket> createDatagramSocket(
+        const ntca::DatagramSocketOptions&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::StreamSocket> createStreamSocket(
+        const ntca::StreamSocketOptions&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&,
+        const bsl::shared_ptr<ntci::TimerSession>&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&,
+        const ntci::TimerCallback&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Strand> createStrand(
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntsa::Data> createIncomingData() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntsa::Data> createOutgoingData() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<bdlbb::Blob> createIncomingBlob() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<bdlbb::Blob> createOutgoingBlob() BSLS_KEYWORD_OVERRIDE;
+    void createIncomingBlobBuffer(bdlbb::BlobBuffer*) BSLS_KEYWORD_OVERRIDE;
+    void createOutgoingBlobBuffer(bdlbb::BlobBuffer*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::RateLimiter> createRateLimiter(
+        const ntca::RateLimiterConfig&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error createEncryptionClient(
+        bsl::shared_ptr<ntci::EncryptionClient>*,
+        const ntca::EncryptionClientOptions&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error createEncryptionClient(
+        bsl::shared_ptr<ntci::EncryptionClient>*,
+        const ntca::EncryptionClientOptions&,
+        const bsl::shared_ptr<bdlbb::BlobBufferFactory>&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error createEncryptionClient(
+        bsl::shared_ptr<ntci::EncryptionClient>*,
+        const ntca::EncryptionClientOptions&,
+        const bsl::shared_ptr<ntci::DataPool>&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error createEncryptionServer(
+        bsl::shared_ptr<ntci::EncryptionServer>*,
+        const ntca::EncryptionServerOptions&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error createEncryptionServer(
+        bsl::shared_ptr<ntci::EncryptionServer>*,
+        const ntca::EncryptionServerOptions&,
+        const bsl::shared_ptr<bdlbb::BlobBufferFactory>&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error createEncryptionServer(
+        bsl::shared_ptr<ntci::EncryptionServer>*,
+        const ntca::EncryptionServerOptions&,
+        const bsl::shared_ptr<ntci::DataPool>&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    void execute(const Functor&) BSLS_KEYWORD_OVERRIDE;
+    void moveAndExecute(FunctorSequence*,
+                        const Functor&) BSLS_KEYWORD_OVERRIDE;
+    bool lookupByThreadHandle(
+        bsl::shared_ptr<ntci::Executor>*,
+        bslmt::ThreadUtil::Handle) const BSLS_KEYWORD_OVERRIDE;
+    bool lookupByThreadIndex(bsl::shared_ptr<ntci::Executor>*,
+                             bsl::size_t) const BSLS_KEYWORD_OVERRIDE;
+    bsls::TimeInterval currentTime() const BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error generateCertificate(
+        bsl::shared_ptr<ntci::EncryptionCertificate>*,
+        const ntsa::DistinguishedName&,
+        const bsl::shared_ptr<ntci::EncryptionKey>&,
+        const ntca::EncryptionCertificateOptions&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error generateCertificate(
+        bsl::shared_ptr<ntci::EncryptionCertificate>*,
+        const ntsa::DistinguishedName&,
+        const bsl::shared_ptr<ntci::EncryptionKey>&,
+        const bsl::shared_ptr<ntci::EncryptionCertificate>&,
+        const bsl::shared_ptr<ntci::EncryptionKey>&,
+        const ntca::EncryptionCertificateOptions&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error loadCertificate(bsl::shared_ptr<ntci::EncryptionCertificate>*,
+                                const bsl::string&,
+                                bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error encodeCertificate(
+        bsl::streambuf*,
+        const bsl::shared_ptr<ntci::EncryptionCertificate>&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error encodeCertificate(
+        bdlbb::Blob*,
+        const bsl::shared_ptr<ntci::EncryptionCertificate>&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error encodeCertificate(
+        bsl::string*,
+        const bsl::shared_ptr<ntci::EncryptionCertificate>&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error encodeCertificate(
+        bsl::vector<char>*,
+        const bsl::shared_ptr<ntci::EncryptionCertificate>&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error decodeCertificate(
+        bsl::shared_ptr<ntci::EncryptionCertificate>*,
+        bsl::streambuf*,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error decodeCertificate(
+        bsl::shared_ptr<ntci::EncryptionCertificate>*,
+        const bdlbb::Blob&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error decodeCertificate(
+        bsl::shared_ptr<ntci::EncryptionCertificate>*,
+        const bsl::string&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error decodeCertificate(
+        bsl::shared_ptr<ntci::EncryptionCertificate>*,
+        const bsl::vector<char>&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error generateKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                            const ntca::EncryptionKeyOptions&,
+                            bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error loadKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                        const bsl::string&,
+                        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error encodeKey(
+        bsl::streambuf*,
+        const bsl::shared_ptr<ntci::EncryptionKey>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error encodeKey(
+        bdlbb::Blob*,
+        const bsl::shared_ptr<ntci::EncryptionKey>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error encodeKey(
+        bsl::string*,
+        const bsl::shared_ptr<ntci::EncryptionKey>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error encodeKey(
+        bsl::vector<char>*,
+        const bsl::shared_ptr<ntci::EncryptionKey>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error decodeKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                          bsl::streambuf*,
+                          bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error decodeKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                          const bdlbb::Blob&,
+                          bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error decodeKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                          const bsl::string&,
+                          bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error decodeKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                          const bsl::vector<char>&,
+                          bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+};
+
+/// Provide a listener serving the metrics of a publisher from a mock
+/// listener socket, for use by this test driver.
+struct Fixture {
+    /// Create a new fixture whose events are deferred to the specified
+    /// 'loop' and start its listener. Optionally specify a 'basicAllocator'
+    /// used to supply memory. If 'basicAllocator' is 0, the currently
+    /// installed default allocator is used.
+    explicit Fixture(test::Loop* loop, bslma::Allocator* basicAllocator = 0);
+
+    /// Stop the listener and destroy this object.
+    ~Fixture();
+
+    /// Return a new stream socket accepted by the listener.
+    bsl::shared_ptr<test::StreamSocket> accept();
+
+    test::Loop*                                 d_loop_p;
+    bsl::shared_ptr<test::Object>               d_object_sp;
+    bsl::shared_ptr<ntcm::OpenMetricsPublisher> d_publisher_sp;
+    bsl::shared_ptr<test::Interface>            d_interface_sp;
+    bsl::shared_ptr<ntcm::OpenMetricsListener>  d_listener_sp;
+    bsl::shared_ptr<test::ListenerSocket>       d_listenerSocket_sp;
+    bslma::Allocator*                           d_allocator_p;
+};
+
+/// Return the header of the specified 'response', including the blank line
+/// that terminates it, or the empty string if the header is incomplete.
+bsl::string header(const bsl::string& response);
+
+/// Return the body of the specified 'response'.
+bsl::string body(const bsl::string& response);
+
+Loop::Loop(bslma::Allocator* basicAllocator)
+: d_mutex()
+, d_functorQueue(basicAllocator)
+, d_timers(basicAllocator)
+, d_now(1000)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+Loop::~Loop()
+{
+    NTCCFG_TEST_TRUE(d_functorQueue.empty());
+}
+
+void Loop::execute(const ntci::Executor::Functor& functor)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_functorQueue.push_back(functor);
+}
+
+void Loop::drain()
+{
+    while (true) {
+        FunctorQueue functorQueue(d_allocator_p);
+        {
+            bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+            functorQueue.swap(d_functorQueue);
+        }
+
+        if (functorQueue.empty()) {
+            break;
+        }
+
+        for (FunctorQueue::iterator it = functorQueue.begin();
+             it != functorQueue.end();
+             ++it)
+        {
+            (*it)();
+        }
+    }
+}
+
+void Loop::registerTimer(const bsl::shared_ptr<test::Timer>& timer)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_timers.push_back(timer);
+}
+
+void Loop::advance(const bsls::TimeInterval& interval)
+{
+    TimerVector        timers(d_allocator_p);
+    bsls::TimeInterval now;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        d_now += interval;
+        now    = d_now;
+        timers = d_timers;
+    }
+
+    for (TimerVector::iterator it = timers.begin(); it != timers.end(); ++it)
+    {
+        (*it)->expire(now);
+    }
+
+    this->drain();
+}
+
+bsls::TimeInterval Loop::now() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_now;
+}
+
+bsl::size_t Loop::numTimers() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_timers.size();
+}
+
+bsl::size_t Loop::numScheduledTimers() const
+{
+    TimerVector timers(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        timers = d_timers;
+    }
+
+    bsl::size_t result = 0;
+    for (TimerVector::const_iterator it = timers.begin();
+         it != timers.end();
+         ++it)
+    {
+        if ((*it)->isScheduled()) {
+            ++result;
+        }
+    }
+
+    return result;
+}
+
+bsl::shared_ptr<test::Timer> Loop::timer(bsl::size_t index) const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    BSLS_ASSERT(index < d_timers.size());
+    return d_timers[index];
+}
+
+Timer::Timer(test::Loop*                loop,
+             const ntci::TimerCallback& callback,
+             bslma::Allocator*          basicAllocator)
+: d_mutex()
+, d_loop_p(loop)
+, d_callback(callback, basicAllocator)
+, d_deadline()
+, d_scheduled(false)
+, d_closed(false)
+, d_strand_sp()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+Timer::~Timer()
+{
+}
+
+void Timer::expire(const bsls::TimeInterval& now)
+{
+    ntci::TimerCallback callback(d_allocator_p);
+    bsls::TimeInterval  deadline;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (!d_scheduled || d_closed || now < d_deadline) {
+            return;
+        }
+
+        d_scheduled = false;
+        deadline    = d_deadline;
+        callback    = d_callback;
+    }
+
+    ntca::TimerContext context;
+    context.setNow(now);
+    context.setDeadline(deadline);
+
+    ntca::TimerEvent event;
+    event.setType(ntca::TimerEventType::e_DEADLINE);
+    event.setContext(context);
+
+    callback(this->getSelf(this), event, ntci::Strand::unknown());
+}
+
+bsls::TimeInterval Timer::deadline() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_deadline;
+}
+
+bool Timer::isScheduled() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_scheduled;
+}
+
+bool Timer::isClosed() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_closed;
+}
+
+ntsa::Error Timer::schedule(const bsls::TimeInterval& deadline,
+                            const bsls::TimeInterval& period)
+{
+    NTCCFG_TEST_EQ(period, bsls::TimeInterval());
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (d_closed) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    d_deadline  = deadline;
+    d_scheduled = true;
+
+    return ntsa::Error();
+}
+
+ntsa::Error Timer::cancel()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    d_scheduled = false;
+
+    return ntsa::Error();
+}
+
+ntsa::Error Timer::close()
+{
+    ntci::TimerCallback callback(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        d_scheduled = false;
+        d_closed    = true;
+
+        callback.swap(d_callback);
+    }
+
+    return ntsa::Error();
+}
+
+const bsl::shared_ptr<ntci::Strand>& Timer::strand() const
+{
+    return d_strand_sp;
+}
+
+bsls::TimeInterval Timer::currentTime() const
+{
+    return d_loop_p->now();
+}
+
+void Timer::arrive(const bsl::shared_ptr<ntci::Timer>&,
+                   const bsls::TimeInterval&,
+                   const bsls::TimeInterval&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void* Timer::handle() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+int Timer::id() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bool Timer::oneShot() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return false;
+}
+
+bslmt::ThreadUtil::Handle Timer::threadHandle() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bslmt::ThreadUtil::invalidHandle();
+}
+
+bsl::size_t Timer::threadIndex() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+
+void StreamSocket::privateSatisfy()
+{
+    if (!d_receiveCallback || d_readQueue.empty() ||
+        d_readQueue.size() < d_receiveOptions.minSize())
+    {
+        return;
+    }
+
+    const bsl::size_t size =
+        bsl::min(d_readQueue.size(), d_receiveOptions.maxSize());
+
+    bsl::shared_ptr<bdlbb::Blob> data;
+    data.createInplace(d_allocator_p,
+                       d_blobBufferFactory_sp.get(),
+                       d_allocator_p);
+
+    bdlbb::BlobUtil::append(data.get(),
+                            d_readQueue.data(),
+                            static_cast<int>(size));
+
+    d_readQueue.erase(0, size);
+
+    ntci::ReceiveCallback callback(d_allocator_p);
+    callback.swap(d_receiveCallback);
+
+    ntca::ReceiveEvent event;
+    event.setType(ntca::ReceiveEventType::e_COMPLETE);
+
+    d_loop_p->execute(bdlf::BindUtil::bind(&StreamSocket::announceReceive,
+                                           this->getSelf(this),
+                                           callback,
+                                           data,
+                                           event));
+}
+
+void StreamSocket::announceReceive(
+    const ntci::ReceiveCallback&        callback,
+    const bsl::shared_ptr<bdlbb::Blob>& data,
+    const ntca::ReceiveEvent&           event)
+{
+    callback(this->getSelf(this), data, event, ntci::Strand::unknown());
+}
+
+void StreamSocket::announceSend(const ntci::SendCallback& callback)
+{
+    ntca::SendEvent event;
+    event.setType(ntca::SendEventType::e_COMPLETE);
+
+    callback(this->getSelf(this), event, ntci::Strand::unknown());
+}
+
+StreamSocket::StreamSocket(test::Loop* loop, bslma::Allocator* basicAllocator)
+: d_mutex()
+, d_loop_p(loop)
+, d_readQueue(basicAllocator)
+, d_receiveOptions()
+, d_receiveCallback(basicAllocator)
+, d_transmitted(basicAllocator)
+, d_closed(false)
+, d_blobBufferFactory_sp()
+, d_strand_sp()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    bsl::shared_ptr<bdlbb::SimpleBlobBufferFactory> blobBufferFactory;
+    blobBufferFactory.createInplace(d_allocator_p, 4096, d_allocator_p);
+
+    d_blobBufferFactory_sp = blobBufferFactory;
+}
+
+StreamSocket::~StreamSocket()
+{
+}
+
+void StreamSocket::deliver(const bsl::string& data)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    NTCCFG_TEST_FALSE(d_closed);
+
+    d_readQueue.append(data);
+    this->privateSatisfy();
+}
+
+void StreamSocket::expire()
+{
+    ntci::ReceiveCallback callback(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        callback.swap(d_receiveCallback);
+    }
+
+    NTCCFG_TEST_TRUE(callback);
+
+    ntca::ReceiveContext context;
+    context.setError(ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+
+    ntca::ReceiveEvent event;
+    event.setType(ntca::ReceiveEventType::e_ERROR);
+    event.setContext(context);
+
+    d_loop_p->execute(bdlf::BindUtil::bind(&StreamSocket::announceReceive,
+                                           this->getSelf(this),
+                                           callback,
+                                           bsl::shared_ptr<bdlbb::Blob>(),
+                                           event));
+}
+
+ntca::ReceiveOptions StreamSocket::receiveOptions() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_receiveOptions;
+}
+
+bool StreamSocket::isReceiving() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return static_cast<bool>(d_receiveCallback);
+}
+
+bsl::string StreamSocket::transmitted() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_transmitted;
+}
+
+bool StreamSocket::isClosed() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_closed;
+}
+
+ntsa::Error StreamSocket::receive(const ntca::ReceiveOptions&  options,
+                                  const ntci::ReceiveCallback& callback)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (d_closed || d_receiveCallback) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    d_receiveOptions  = options;
+    d_receiveCallback = callback;
+
+    this->privateSatisfy();
+
+    return ntsa::Error();
+}
+
+ntsa::Error StreamSocket::send(const bdlbb::Blob&        data,
+                               const ntca::SendOptions&  options,
+                               const ntci::SendCallback& callback)
+{
+    NTCCFG_WARNING_UNUSED(options);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (d_closed) {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+
+        const bsl::size_t offset = d_transmitted.size();
+
+        d_transmitted.resize(offset +
+                             static_cast<bsl::size_t>(data.length()));
+        if (data.length() > 0) {
+            bdlbb::BlobUtil::copy(&d_transmitted[offset],
+                                  data,
+                                  0,
+                                  data.length());
+        }
+    }
+
+    d_loop_p->execute(bdlf::BindUtil::bind(&StreamSocket::announceSend,
+                                           this->getSelf(this),
+                                           callback));
+
+    return ntsa::Error();
+}
+
+void StreamSocket::close()
+{
+    ntci::ReceiveCallback callback(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        d_closed = true;
+        d_readQueue.clear();
+
+        callback.swap(d_receiveCallback);
+    }
+}
+
+const bsl::shared_ptr<ntci::Strand>& StreamSocket::strand() const
+{
+    return d_strand_sp;
+}
+
+bsls::TimeInterval StreamSocket::currentTime() const
+{
+    return d_loop_p->now();
+}
+
+const bsl::shared_ptr<bdlbb::BlobBufferFactory>& StreamSocket::
+    incomingBlobBufferFactory() const
+{
+    return d_blobBufferFactory_sp;
+}
+
+const bsl::shared_ptr<bdlbb::BlobBufferFactory>& StreamSocket::
+    outgoingBlobBufferFactory() const
+{
+    return d_blobBufferFactory_sp;
+}
+
+ntsa::Handle StreamSocket::handle() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::k_INVALID_HANDLE;
+}
+
+ntsa::Error StreamSocket::open()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::open(ntsa::Transport::Value)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::open(ntsa::Transport::Value, ntsa::Handle)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::open(ntsa::Transport::Value,
+                               const bsl::shared_ptr<ntsi::StreamSocket>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::open(ntsa::Transport::Value,
+                               ntsa::Handle,
+                               const bsl::shared_ptr<ntci::ListenerSocket>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::open(ntsa::Transport::Value,
+                               const bsl::shared_ptr<ntsi::StreamSocket>&,
+                               const bsl::shared_ptr<ntci::ListenerSocket>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::bind(const ntsa::Endpoint&,
+                               const ntca::BindOptions&,
+                               const ntci::BindFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::bind(const ntsa::Endpoint&,
+                               const ntca::BindOptions&,
+                               const ntci::BindCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::bind(const bsl::string&,
+                               const ntca::BindOptions&,
+                               const ntci::BindFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::bind(const bsl::string&,
+                               const ntca::BindOptions&,
+                               const ntci::BindCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::connect(const ntsa::Endpoint&,
+                                  const ntca::ConnectOptions&,
+                                  const ntci::ConnectFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::connect(const ntsa::Endpoint&,
+                                  const ntca::ConnectOptions&,
+                                  const ntci::ConnectCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::connect(const bsl::string&,
+                                  const ntca::ConnectOptions&,
+                                  const ntci::ConnectFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::connect(const bsl::string&,
+                                  const ntca::ConnectOptions&,
+                                  const ntci::ConnectCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(const bsl::shared_ptr<ntci::Encryption>&,
+                                  const ntca::UpgradeOptions&,
+                                  const ntci::UpgradeFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(const bsl::shared_ptr<ntci::Encryption>&,
+                                  const ntca::UpgradeOptions&,
+                                  const ntci::UpgradeCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(
+    const bsl::shared_ptr<ntci::EncryptionClient>&,
+    const ntca::UpgradeOptions&,
+    const ntci::UpgradeFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(
+    const bsl::shared_ptr<ntci::EncryptionClient>&,
+    const ntca::UpgradeOptions&,
+    const ntci::UpgradeCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(
+    const bsl::shared_ptr<ntci::EncryptionServer>&,
+    const ntca::UpgradeOptions&,
+    const ntci::UpgradeFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(
+    const bsl::shared_ptr<ntci::EncryptionServer>&,
+    const ntca::UpgradeOptions&,
+    const ntci::UpgradeCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::send(const bdlbb::Blob&, const ntca::SendOptions&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::send(const ntsa::Data&, const ntca::SendOptions&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::send(const bdlbb::Blob&,
+                               const ntca::SendOptions&,
+                               const ntci::SendFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::send(const ntsa::Data&,
+                               const ntca::SendOptions&,
+                               const ntci::SendFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::send(const ntsa::Data&,
+                               const ntca::SendOptions&,
+                               const ntci::SendCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::receive(ntca::ReceiveContext*,
+                                  bdlbb::Blob*,
+                                  const ntca::ReceiveOptions&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::receive(const ntca::ReceiveOptions&,
+                                  const ntci::ReceiveFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::registerResolver(
+    const bsl::shared_ptr<ntci::Resolver>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::deregisterResolver()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::registerManager(
+    const bsl::shared_ptr<ntci::StreamSocketManager>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::deregisterManager()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::registerSession(
+    const bsl::shared_ptr<ntci::StreamSocketSession>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::registerSessionCallback(
+    const ntci::StreamSocket::SessionCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::registerSessionCallback(
+    const ntci::StreamSocket::SessionCallback&,
+    const bsl::shared_ptr<ntci::Strand>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::deregisterSession()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setWriteRateLimiter(
+    const bsl::shared_ptr<ntci::RateLimiter>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setWriteQueueLowWatermark(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setWriteQueueHighWatermark(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setWriteQueueWatermarks(bsl::size_t, bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setReadRateLimiter(
+    const bsl::shared_ptr<ntci::RateLimiter>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setReadQueueLowWatermark(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setReadQueueHighWatermark(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setReadQueueWatermarks(bsl::size_t, bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::relaxFlowControl(ntca::FlowControlType::Value)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::applyFlowControl(ntca::FlowControlType::Value,
+                                           ntca::FlowControlMode::Value)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::cancel(const ntca::BindToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::cancel(const ntca::ConnectToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::cancel(const ntca::UpgradeToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::cancel(const ntca::SendToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::cancel(const ntca::ReceiveToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::downgrade()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::shutdown(ntsa::ShutdownType::Value,
+                                   ntsa::ShutdownMode::Value)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+void StreamSocket::close(const ntci::CloseFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void StreamSocket::close(const ntci::CloseCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+ntsa::Transport::Value StreamSocket::transport() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Transport::e_UNDEFINED;
+}
+
+ntsa::Endpoint StreamSocket::sourceEndpoint() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Endpoint();
+}
+
+ntsa::Endpoint StreamSocket::remoteEndpoint() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Endpoint();
+}
+
+bsl::shared_ptr<ntci::EncryptionCertificate> StreamSocket::
+    sourceCertificate() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::EncryptionCertificate>();
+}
+
+bsl::shared_ptr<ntci::EncryptionCertificate> StreamSocket::
+    remoteCertificate() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::EncryptionCertificate>();
+}
+
+bsl::shared_ptr<ntci::EncryptionKey> StreamSocket::privateKey() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::EncryptionKey>();
+}
+
+bsl::shared_ptr<ntci::ListenerSocket> StreamSocket::acceptor() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::ListenerSocket>();
+}
+
+bslmt::ThreadUtil::Handle StreamSocket::threadHandle() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bslmt::ThreadUtil::invalidHandle();
+}
+
+bsl::size_t StreamSocket::threadIndex() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::readQueueSize() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::readQueueLowWatermark() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::readQueueHighWatermark() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::writeQueueSize() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::writeQueueLowWatermark() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::writeQueueHighWatermark() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::totalBytesSent() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::totalBytesReceived() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+void StreamSocket::execute(const Functor&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void StreamSocket::moveAndExecute(FunctorSequence*, const Functor&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+bsl::shared_ptr<ntci::Strand> StreamSocket::createStrand(bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Strand>();
+}
+
+bsl::shared_ptr<ntci::Timer> StreamSocket::createTimer(
+    const ntca::TimerOptions&,
+    const bsl::shared_ptr<ntci::TimerSession>&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Timer>();
+}
+
+bsl::shared_ptr<ntci::Timer> StreamSocket::createTimer(
+    const ntca::TimerOptions&,
+    const ntci::TimerCallback&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Timer>();
+}
+
+bsl::shared_ptr<ntsa::Data> StreamSocket::createIncomingData()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntsa::Data>();
+}
+
+bsl::shared_ptr<ntsa::Data> StreamSocket::createOutgoingData()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntsa::Data>();
+}
+
+bsl::shared_ptr<bdlbb::Blob> StreamSocket::createIncomingBlob()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<bdlbb::Blob>();
+}
+
+bsl::shared_ptr<bdlbb::Blob> StreamSocket::createOutgoingBlob()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<bdlbb::Blob>();
+}
+
+void StreamSocket::createIncomingBlobBuffer(bdlbb::BlobBuffer*)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void StreamSocket::createOutgoingBlobBuffer(bdlbb::BlobBuffer*)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void ListenerSocket::announceAccept(
+    const ntci::AcceptCallback&                 callback,
+    const bsl::shared_ptr<test::StreamSocket>& streamSocket,
+    const ntca::AcceptEvent&                    event)
+{
+    callback(this->getSelf(this),
+             streamSocket,
+             event,
+             ntci::Strand::unknown());
+}
+
+void ListenerSocket::complete(
+    const bsl::shared_ptr<test::StreamSocket>& streamSocket,
+    const ntca::AcceptEvent&                    event)
+{
+    ntci::AcceptCallback callback(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        callback.swap(d_acceptCallback);
+    }
+
+    NTCCFG_TEST_TRUE(callback);
+
+    d_loop_p->execute(bdlf::BindUtil::bind(&ListenerSocket::announceAccept,
+                                           this->getSelf(this),
+                                           callback,
+                                           streamSocket,
+                                           event));
+}
+
+ListenerSocket::ListenerSocket(test::Loop*           loop,
+                               const ntsa::Endpoint& sourceEndpoint,
+                               bslma::Allocator*     basicAllocator)
+: d_mutex()
+, d_loop_p(loop)
+, d_acceptCallback(basicAllocator)
+, d_numAccepts(0)
+, d_listening(false)
+, d_closed(false)
+, d_sourceEndpoint(sourceEndpoint)
+, d_blobBufferFactory_sp()
+, d_strand_sp()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+ListenerSocket::~ListenerSocket()
+{
+}
+
+void ListenerSocket::connect(
+    const bsl::shared_ptr<test::StreamSocket>& streamSocket)
+{
+    ntca::AcceptEvent event;
+    event.setType(ntca::AcceptEventType::e_COMPLETE);
+
+    this->complete(streamSocket, event);
+}
+
+void ListenerSocket::fail(const ntsa::Error& error)
+{
+    ntca::AcceptContext context;
+    context.setError(error);
+
+    ntca::AcceptEvent event;
+    event.setType(ntca::AcceptEventType::e_ERROR);
+    event.setContext(context);
+
+    this->complete(bsl::shared_ptr<test::StreamSocket>(), event);
+}
+
+bsl::size_t ListenerSocket::numAccepts() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_numAccepts;
+}
+
+bool ListenerSocket::isAccepting() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return static_cast<bool>(d_acceptCallback);
+}
+
+bool ListenerSocket::isListening() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_listening;
+}
+
+bool ListenerSocket::isClosed() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_closed;
+}
+
+ntsa::Error ListenerSocket::open()
+{
+    return ntsa::Error();
+}
+
+ntsa::Error ListenerSocket::listen()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_listening = true;
+    return ntsa::Error();
+}
+
+ntsa::Error ListenerSocket::accept(const ntca::AcceptOptions&  options,
+                                   const ntci::AcceptCallback& callback)
+{
+    NTCCFG_WARNING_UNUSED(options);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (d_closed || !d_listening || d_acceptCallback) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    d_acceptCallback = callback;
+    ++d_numAccepts;
+
+    return ntsa::Error();
+}
+
+void ListenerSocket::close()
+{
+    ntci::AcceptCallback callback(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        d_closed    = true;
+        d_listening = false;
+
+        callback.swap(d_acceptCallback);
+    }
+}
+
+bsl::shared_ptr<ntci::Timer> ListenerSocket::createTimer(
+    const ntca::TimerOptions&  options,
+    const ntci::TimerCallback& callback,
+    bslma::Allocator*          basicAllocator)
+{
+    NTCCFG_TEST_TRUE(options.oneShot());
+
+    bslma::Allocator* allocator = bslma::Default::allocator(basicAllocator);
+
+    bsl::shared_ptr<test::Timer> timer;
+    timer.createInplace(allocator, d_loop_p, callback, allocator);
+
+    d_loop_p->registerTimer(timer);
+
+    return timer;
+}
+
+ntsa::Endpoint ListenerSocket::sourceEndpoint() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_sourceEndpoint;
+}
+
+const bsl::shared_ptr<ntci::Strand>& ListenerSocket::strand() const
+{
+    return d_strand_sp;
+}
+
+bsls::TimeInterval ListenerSocket::currentTime() const
+{
+    return d_loop_p->now();
+}
+
+const bsl::shared_ptr<bdlbb::BlobBufferFactory>& ListenerSocket::
+    incomingBlobBufferFactory() const
+{
+    return d_blobBufferFactory_sp;
+}
+
+const bsl::shared_ptr<bdlbb::BlobBufferFactory>& ListenerSocket::
+    outgoingBlobBufferFactory() const
+{
+    return d_blobBufferFactory_sp;
+}
+
+ntsa::Handle ListenerSocket::handle() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::k_INVALID_HANDLE;
+}
+
+ntsa::Error ListenerSocket::open(ntsa::Transport::Value)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::open(ntsa::Transport::Value, ntsa::Handle)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::open(ntsa::Transport::Value,
+                                 const bsl::shared_ptr<ntsi::ListenerSocket>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::bind(const ntsa::Endpoint&,
+                                 const ntca::BindOptions&,
+                                 const ntci::BindFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::bind(const ntsa::Endpoint&,
+                                 const ntca::BindOptions&,
+                                 const ntci::BindCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::bind(const bsl::string&,
+                                 const ntca::BindOptions&,
+                                 const ntci::BindFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::bind(const bsl::string&,
+                                 const ntca::BindOptions&,
+                                 const ntci::BindCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::listen(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::accept(ntca::AcceptContext*,
+                                   bsl::shared_ptr<ntci::StreamSocket>*,
+                                   const ntca::AcceptOptions&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::accept(const ntca::AcceptOptions&,
+                                   const ntci::AcceptFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::registerResolver(
+    const bsl::shared_ptr<ntci::Resolver>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::deregisterResolver()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::registerManager(
+    const bsl::shared_ptr<ntci::ListenerSocketManager>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::deregisterManager()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::registerSession(
+    const bsl::shared_ptr<ntci::ListenerSocketSession>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::registerSessionCallback(
+    const ntci::ListenerSocket::SessionCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::registerSessionCallback(
+    const ntci::ListenerSocket::SessionCallback&,
+    const bsl::shared_ptr<ntci::Strand>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::deregisterSession()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::setAcceptRateLimiter(
+    const bsl::shared_ptr<ntci::RateLimiter>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::setAcceptQueueLowWatermark(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::setAcceptQueueHighWatermark(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::setAcceptQueueWatermarks(bsl::size_t, bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::relaxFlowControl(ntca::FlowControlType::Value)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::applyFlowControl(ntca::FlowControlType::Value,
+                                             ntca::FlowControlMode::Value)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::cancel(const ntca::BindToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::cancel(const ntca::AcceptToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error ListenerSocket::shutdown()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+void ListenerSocket::close(const ntci::CloseFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void ListenerSocket::close(const ntci::CloseCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+ntsa::Transport::Value ListenerSocket::transport() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Transport::e_UNDEFINED;
+}
+
+bslmt::ThreadUtil::Handle ListenerSocket::threadHandle() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bslmt::ThreadUtil::invalidHandle();
+}
+
+bsl::size_t ListenerSocket::threadIndex() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t ListenerSocket::acceptQueueSize() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t ListenerSocket::acceptQueueLowWatermark() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t ListenerSocket::acceptQueueHighWatermark() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+void ListenerSocket::execute(const Functor&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void ListenerSocket::moveAndExecute(FunctorSequence*, const Functor&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+bsl::shared_ptr<ntci::Strand> ListenerSocket::createStrand(bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Strand>();
+}
+
+bsl::shared_ptr<ntci::Timer> ListenerSocket::createTimer(
+    const ntca::TimerOptions&,
+    const bsl::shared_ptr<ntci::TimerSession>&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Timer>();
+}
+
+bsl::shared_ptr<ntsa::Data> ListenerSocket::createIncomingData()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntsa::Data>();
+}
+
+bsl::shared_ptr<ntsa::Data> ListenerSocket::createOutgoingData()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntsa::Data>();
+}
+
+bsl::shared_ptr<bdlbb::Blob> ListenerSocket::createIncomingBlob()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<bdlbb::Blob>();
+}
+
+bsl::shared_ptr<bdlbb::Blob> ListenerSocket::createOutgoingBlob()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<bdlbb::Blob>();
+}
+
+void ListenerSocket::createIncomingBlobBuffer(bdlbb::BlobBuffer*)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void ListenerSocket::createOutgoingBlobBuffer(bdlbb::BlobBuffer*)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+Interface::Interface(test::Loop* loop, bslma::Allocator* basicAllocator)
+: d_mutex()
+, d_loop_p(loop)
+, d_listenerSocket_sp()
+, d_resolver_sp()
+, d_blobBufferFactory_sp()
+, d_strand_sp()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+Interface::~Interface()
+{
+}
+
+bsl::shared_ptr<test::ListenerSocket> Interface::listenerSocket() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_listenerSocket_sp;
+}
+
+bsl::shared_ptr<ntci::ListenerSocket> Interface::createListenerSocket(
+    const ntca::ListenerSocketOptions& options,
+    bslma::Allocator*                  basicAllocator)
+{
+    bslma::Allocator* allocator = bslma::Default::allocator(basicAllocator);
+
+    ntsa::Endpoint sourceEndpoint;
+    if (!options.sourceEndpoint().isNull()) {
+        sourceEndpoint = options.sourceEndpoint().value();
+    }
+
+    bsl::shared_ptr<test::ListenerSocket> listenerSocket;
+    listenerSocket.createInplace(allocator,
+                                 d_loop_p,
+                                 sourceEndpoint,
+                                 allocator);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_listenerSocket_sp = listenerSocket;
+
+    return listenerSocket;
+}
+
+const bsl::shared_ptr<ntci::Resolver>& Interface::resolver() const
+{
+    return d_resolver_sp;
+}
+
+const bsl::shared_ptr<bdlbb::BlobBufferFactory>& Interface::
+    incomingBlobBufferFactory() const
+{
+    return d_blobBufferFactory_sp;
+}
+
+const bsl::shared_ptr<bdlbb::BlobBufferFactory>& Interface::
+    outgoingBlobBufferFactory() const
+{
+    return d_blobBufferFactory_sp;
+}
+
+const bsl::shared_ptr<ntci::Strand>& Interface::strand() const
+{
+    return d_strand_sp;
+}
+
+ntsa::Error Interface::start()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+void Interface::shutdown()
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void Interface::linger()
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+ntsa::Error Interface::closeAll()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+bsl::shared_ptr<ntci::DatagramSocket> Interface::createDatagramSocket(
+    const ntca::DatagramSocketOptions&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::DatagramSocket>();
+}
+
+bsl::shared_ptr<ntci::StreamSocket> Interface::createStreamSocket(
+    const ntca::StreamSocketOptions&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::StreamSocket>();
+}
+
+bsl::shared_ptr<ntci::Timer> Interface::createTimer(
+    const ntca::TimerOptions&,
+    const bsl::shared_ptr<ntci::TimerSession>&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Timer>();
+}
+
+bsl::shared_ptr<ntci::Timer> Interface::createTimer(const ntca::TimerOptions&,
+                                                    const ntci::TimerCallback&,
+                                                    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Timer>();
+}
+
+bsl::shared_ptr<ntci::Strand> Interface::createStrand(bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Strand>();
+}
+
+bsl::shared_ptr<ntsa::Data> Interface::createIncomingData()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntsa::Data>();
+}
+
+bsl::shared_ptr<ntsa::Data> Interface::createOutgoingData()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntsa::Data>();
+}
+
+bsl::shared_ptr<bdlbb::Blob> Interface::createIncomingBlob()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<bdlbb::Blob>();
+}
+
+bsl::shared_ptr<bdlbb::Blob> Interface::createOutgoingBlob()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<bdlbb::Blob>();
+}
+
+void Interface::createIncomingBlobBuffer(bdlbb::BlobBuffer*)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void Interface::createOutgoingBlobBuffer(bdlbb::BlobBuffer*)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+bsl::shared_ptr<ntci::RateLimiter> Interface::createRateLimiter(
+    const ntca::RateLimiterConfig&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::RateLimiter>();
+}
+
+ntsa::Error Interface::createEncryptionClient(
+    bsl::shared_ptr<ntci::EncryptionClient>*,
+    const ntca::EncryptionClientOptions&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::createEncryptionClient(
+    bsl::shared_ptr<ntci::EncryptionClient>*,
+    const ntca::EncryptionClientOptions&,
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::createEncryptionClient(
+    bsl::shared_ptr<ntci::EncryptionClient>*,
+    const ntca::EncryptionClientOptions&,
+    const bsl::shared_ptr<ntci::DataPool>&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::createEncryptionServer(
+    bsl::shared_ptr<ntci::EncryptionServer>*,
+    const ntca::EncryptionServerOptions&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::createEncryptionServer(
+    bsl::shared_ptr<ntci::EncryptionServer>*,
+    const ntca::EncryptionServerOptions&,
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::createEncryptionServer(
+    bsl::shared_ptr<ntci::EncryptionServer>*,
+    const ntca::EncryptionServerOptions&,
+    const bsl::shared_ptr<ntci::DataPool>&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+void Interface::execute(const Functor&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void Interface::moveAndExecute(FunctorSequence*, const Functor&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+bool Interface::lookupByThreadHandle(bsl::shared_ptr<ntci::Executor>*,
+                                     bslmt::ThreadUtil::Handle) const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return false;
+}
+
+bool Interface::lookupByThreadIndex(bsl::shared_ptr<ntci::Executor>*,
+                                    bsl::size_t) const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return false;
+}
+
+bsls::TimeInterval Interface::currentTime() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsls::TimeInterval();
+}
+
+ntsa::Error Interface::generateCertificate(
+    bsl::shared_ptr<ntci::EncryptionCertificate>*,
+    const ntsa::DistinguishedName&,
+    const bsl::shared_ptr<ntci::EncryptionKey>&,
+    const ntca::EncryptionCertificateOptions&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::generateCertificate(
+    bsl::shared_ptr<ntci::EncryptionCertificate>*,
+    const ntsa::DistinguishedName&,
+    const bsl::shared_ptr<ntci::EncryptionKey>&,
+    const bsl::shared_ptr<ntci::EncryptionCertificate>&,
+    const bsl::shared_ptr<ntci::EncryptionKey>&,
+    const ntca::EncryptionCertificateOptions&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::loadCertificate(
+    bsl::shared_ptr<ntci::EncryptionCertificate>*,
+    const bsl::string&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::encodeCertificate(
+    bsl::streambuf*,
+    const bsl::shared_ptr<ntci::EncryptionCertificate>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::encodeCertificate(
+    bdlbb::Blob*,
+    const bsl::shared_ptr<ntci::EncryptionCertificate>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::encodeCertificate(
+    bsl::string*,
+    const bsl::shared_ptr<ntci::EncryptionCertificate>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::encodeCertificate(
+    bsl::vector<char>*,
+    const bsl::shared_ptr<ntci::EncryptionCertificate>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::decodeCertificate(
+    bsl::shared_ptr<ntci::EncryptionCertificate>*,
+    bsl::streambuf*,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::decodeCertificate(
+    bsl::shared_ptr<ntci::EncryptionCertificate>*,
+    const bdlbb::Blob&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::decodeCertificate(
+    bsl::shared_ptr<ntci::EncryptionCertificate>*,
+    const bsl::string&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::decodeCertificate(
+    bsl::shared_ptr<ntci::EncryptionCertificate>*,
+    const bsl::vector<char>&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::generateKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                                   const ntca::EncryptionKeyOptions&,
+                                   bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::loadKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                               const bsl::string&,
+                               bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::encodeKey(bsl::streambuf*,
+                                 const bsl::shared_ptr<ntci::EncryptionKey>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::encodeKey(bdlbb::Blob*,
+                                 const bsl::shared_ptr<ntci::EncryptionKey>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::encodeKey(bsl::string*,
+                                 const bsl::shared_ptr<ntci::EncryptionKey>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::encodeKey(bsl::vector<char>*,
+                                 const bsl::shared_ptr<ntci::EncryptionKey>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::decodeKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                                 bsl::streambuf*,
+                                 bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::decodeKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                                 const bdlbb::Blob&,
+                                 bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::decodeKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                                 const bsl::string&,
+                                 bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::decodeKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                                 const bsl::vector<char>&,
+                                 bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+Fixture::Fixture(test::Loop* loop, bslma::Allocator* basicAllocator)
+: d_loop_p(loop)
+, d_object_sp()
+, d_publisher_sp()
+, d_interface_sp()
+, d_listener_sp()
+, d_listenerSocket_sp()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_object_sp.createInplace(d_allocator_p, "first", 10, 0.5, d_allocator_p);
+
+    d_publisher_sp.createInplace(d_allocator_p, d_allocator_p);
+
+    test::publish(d_publisher_sp.get(), d_object_sp, true, d_allocator_p);
+
+    d_interface_sp.createInplace(d_allocator_p, d_loop_p, d_allocator_p);
+
+    d_listener_sp.createInplace(d_allocator_p,
+                                d_publisher_sp,
+                                d_interface_sp,
+                                ntsa::Endpoint("127.0.0.1:9090"),
+                                d_allocator_p);
+
+    ntsa::Error error = d_listener_sp->start();
+    NTCCFG_TEST_OK(error);
+
+    d_listenerSocket_sp = d_interface_sp->listenerSocket();
+    NTCCFG_TEST_TRUE(d_listenerSocket_sp);
+
+    NTCCFG_TEST_TRUE(d_listenerSocket_sp->isListening());
+    NTCCFG_TEST_TRUE(d_listenerSocket_sp->isAccepting());
+    NTCCFG_TEST_EQ(d_listenerSocket_sp->numAccepts(), 1);
+}
+
+Fixture::~Fixture()
+{
+    d_listener_sp->stop();
+    d_loop_p->drain();
+
+    NTCCFG_TEST_TRUE(d_listenerSocket_sp->isClosed());
+}
+
+bsl::shared_ptr<test::StreamSocket> Fixture::accept()
+{
+    const bsl::size_t numAccepts = d_listenerSocket_sp->numAccepts();
+
+    bsl::shared_ptr<test::StreamSocket> streamSocket;
+    streamSocket.createInplace(d_allocator_p, d_loop_p, d_allocator_p);
+
+    d_listenerSocket_sp->connect(streamSocket);
+    d_loop_p->drain();
+
+    NTCCFG_TEST_TRUE(streamSocket->isReceiving());
+    NTCCFG_TEST_TRUE(d_listenerSocket_sp->isAccepting());
+    NTCCFG_TEST_EQ(d_listenerSocket_sp->numAccepts(), numAccepts + 1);
+
+    return streamSocket;
+}
+
+bsl::string header(const bsl::string& response)
+{
+    const bsl::size_t position = response.find("\r\n\r\n");
+    if (position == bsl::string::npos) {
+        return bsl::string();
+    }
+
+    return response.substr(0, position + 4);
+}
+
+bsl::string body(const bsl::string& response)
+{
+    return response.substr(test::header(response).size());
+}
+
+}  // close namespace test
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Statistics are rendered in the OpenMetrics text format,
+    // grouped by metric, and become visible when the collection completes.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        bsl::shared_ptr<test::Object> first;
+        first.createInplace(&ta, "first", 10, 0.5, &ta);
+
+        bsl::shared_ptr<test::Object> second;
+        second.createInplace(&ta, "se\"cond", 20, 1.25, &ta);
+
+        bsl::shared_ptr<ntcm::OpenMetricsPublisher> publisher;
+        publisher.createInplace(&ta, &ta);
+
+        bsl::string snapshot(&ta);
+
+        publisher->load(&snapshot);
+        NTCCFG_TEST_EQ(snapshot, "# EOF\n");
+
+        test::publish(publisher.get(), first, false, &ta);
+
+        publisher->load(&snapshot);
+        NTCCFG_TEST_EQ(snapshot, "# EOF\n");
+
+        test::publish(publisher.get(), second, true, &ta);
+
+        publisher->load(&snapshot);
+
+        NTCCFG_TEST_LOG_DEBUG << "Snapshot:\n"
+                              << snapshot << NTCCFG_TEST_LOG_END;
+
+        bsl::string expected(&ta);
+        {
+            char buffer[512];
+            bsl::sprintf(buffer,
+                         "# TYPE socket_bytesSent_count gauge\n"
+                         "socket_bytesSent_count"
+                         "{object=\"first\",id=\"%d\"} 10\n"
+                         "socket_bytesSent_count"
+                         "{object=\"se\\\"cond\",id=\"%d\"} 20\n"
+                         "# TYPE socket_latency_avg gauge\n"
+                         "socket_latency_avg"
+                         "{object=\"first\",id=\"%d\"} 0.5\n"
+                         "socket_latency_avg"
+                         "{object=\"se\\\"cond\",id=\"%d\"} 1.25\n"
+                         "# EOF\n",
+                         first->objectId(),
+                         second->objectId(),
+                         first->objectId(),
+                         second->objectId());
+            expected = buffer;
+        }
+
+        NTCCFG_TEST_EQ(snapshot, expected);
+
+        test::publish(publisher.get(), second, true, &ta);
+
+        publisher->load(&snapshot);
+
+        NTCCFG_TEST_EQ(snapshot.find("object=\"first\""), bsl::string::npos);
+        NTCCFG_TEST_NE(snapshot.find("object=\"se\\\"cond\""),
+                       bsl::string::npos);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: A GET request is answered with the snapshot of the
+    // publisher, its content type, and its length, then the connection is
+    // closed.
+    // Plan: Deliver a GET request whose terminating blank line arrives
+    // separately from the rest of the request, and ensure the response is
+    // sent only when the request is complete.
+
+    ntccfg::TestAllocator ta;
+    {
+        test::Loop loop(&ta);
+        {
+            test::Fixture fixture(&loop, &ta);
+
+            bsl::shared_ptr<test::StreamSocket> streamSocket =
+                fixture.accept();
+
+            streamSocket->deliver("GET /metrics HTTP/1.1\r\n"
+                                  "Host: localhost\r\n");
+            loop.drain();
+
+            NTCCFG_TEST_TRUE(streamSocket->transmitted().empty());
+            NTCCFG_TEST_TRUE(streamSocket->isReceiving());
+
+            streamSocket->deliver("\r\n");
+            loop.drain();
+
+            bsl::string snapshot(&ta);
+            fixture.d_publisher_sp->load(&snapshot);
+
+            NTCCFG_TEST_NE(snapshot.find("socket_bytesSent_count"),
+                           bsl::string::npos);
+
+            char contentLength[64];
+            bsl::sprintf(contentLength,
+                         "Content-Length: %d\r\n",
+                         static_cast<int>(snapshot.size()));
+
+            bsl::string contentType(&ta);
+            contentType.append("Content-Type: ");
+            contentType.append(ntcm::OpenMetricsPublisher::contentType());
+            contentType.append("\r\n");
+
+            const bsl::string response = streamSocket->transmitted();
+            const bsl::string header   = test::header(response);
+
+            NTCCFG_TEST_LOG_DEBUG << "Response:\n"
+                                  << response << NTCCFG_TEST_LOG_END;
+
+            NTCCFG_TEST_EQ(header.find("HTTP/1.1 200 OK\r\n"), 0);
+            NTCCFG_TEST_NE(header.find(contentType), bsl::string::npos);
+            NTCCFG_TEST_NE(header.find(contentLength), bsl::string::npos);
+            NTCCFG_TEST_NE(header.find("Connection: close\r\n"),
+                           bsl::string::npos);
+
+            NTCCFG_TEST_EQ(test::body(response), snapshot);
+
+            NTCCFG_TEST_TRUE(streamSocket->isClosed());
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(3)
+{
+    // Concern: A HEAD request is answered with the headers of the response
+    // to a GET request, but no body.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        test::Loop loop(&ta);
+        {
+            test::Fixture fixture(&loop, &ta);
+
+            bsl::shared_ptr<test::StreamSocket> streamSocket =
+                fixture.accept();
+
+            streamSocket->deliver("HEAD /metrics HTTP/1.1\r\n\r\n");
+            loop.drain();
+
+            bsl::string snapshot(&ta);
+            fixture.d_publisher_sp->load(&snapshot);
+
+            char contentLength[64];
+            bsl::sprintf(contentLength,
+                         "Content-Length: %d\r\n",
+                         static_cast<int>(snapshot.size()));
+
+            const bsl::string response = streamSocket->transmitted();
+            const bsl::string header   = test::header(response);
+
+            NTCCFG_TEST_EQ(header.find("HTTP/1.1 200 OK\r\n"), 0);
+            NTCCFG_TEST_NE(header.find(contentLength), bsl::string::npos);
+            NTCCFG_TEST_NE(
+                header.find(ntcm::OpenMetricsPublisher::contentType()),
+                bsl::string::npos);
+
+            NTCCFG_TEST_TRUE(test::body(response).empty());
+
+            NTCCFG_TEST_TRUE(streamSocket->isClosed());
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(4)
+{
+    // Concern: A request with a method other than GET or HEAD is answered
+    // with 405 Method Not Allowed and the allowed methods.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        test::Loop loop(&ta);
+        {
+            test::Fixture fixture(&loop, &ta);
+
+            bsl::shared_ptr<test::StreamSocket> streamSocket =
+                fixture.accept();
+
+            streamSocket->deliver("POST /metrics HTTP/1.1\r\n\r\n");
+            loop.drain();
+
+            const bsl::string response = streamSocket->transmitted();
+            const bsl::string header   = test::header(response);
+
+            NTCCFG_TEST_EQ(header.find("HTTP/1.1 405 Method Not Allowed\r\n"),
+                           0);
+            NTCCFG_TEST_NE(header.find("Allow: GET, HEAD\r\n"),
+                           bsl::string::npos);
+            NTCCFG_TEST_NE(header.find("Content-Length: 0\r\n"),
+                           bsl::string::npos);
+
+            NTCCFG_TEST_TRUE(test::body(response).empty());
+
+            NTCCFG_TEST_TRUE(streamSocket->isClosed());
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(5)
+{
+    // Concern: A request whose headers exceed the maximum request size is
+    // not answered, and the connection is closed.
+    // Plan: Deliver a request line followed by a header that reaches the
+    // maximum request size without a terminating blank line.
+
+    ntccfg::TestAllocator ta;
+    {
+        test::Loop loop(&ta);
+        {
+            test::Fixture fixture(&loop, &ta);
+
+            bsl::shared_ptr<test::StreamSocket> streamSocket =
+                fixture.accept();
+
+            bsl::string request(&ta);
+            request.append("GET /metrics HTTP/1.1\r\n");
+            request.append("X-Padding: ");
+            request.resize(8192, 'x');
+
+            streamSocket->deliver(request.substr(0, 4096));
+            loop.drain();
+
+            NTCCFG_TEST_TRUE(streamSocket->isReceiving());
+            NTCCFG_TEST_EQ(streamSocket->receiveOptions().maxSize(), 4096);
+
+            streamSocket->deliver(request.substr(4096));
+            loop.drain();
+
+            NTCCFG_TEST_TRUE(streamSocket->transmitted().empty());
+            NTCCFG_TEST_TRUE(streamSocket->isClosed());
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(6)
+{
+    // Concern: A connection that does not complete its request within the
+    // request timeout is closed without a response.
+    // Plan: Ensure each receive operation has a deadline ten seconds after
+    // it is initiated, then expire it.
+
+    ntccfg::TestAllocator ta;
+    {
+        test::Loop loop(&ta);
+        {
+            test::Fixture fixture(&loop, &ta);
+
+            bsl::shared_ptr<test::StreamSocket> streamSocket =
+                fixture.accept();
+
+            ntca::ReceiveOptions receiveOptions =
+                streamSocket->receiveOptions();
+
+            NTCCFG_TEST_FALSE(receiveOptions.deadline().isNull());
+            NTCCFG_TEST_EQ(receiveOptions.deadline().value(),
+                           loop.now() + bsls::TimeInterval(10));
+
+            loop.advance(bsls::TimeInterval(1));
+
+            streamSocket->deliver("GET /metrics HTTP/1.1\r\n");
+            loop.drain();
+
+            // Each receive operation is given a new deadline.
+
+            receiveOptions = streamSocket->receiveOptions();
+
+            NTCCFG_TEST_TRUE(streamSocket->isReceiving());
+            NTCCFG_TEST_FALSE(receiveOptions.deadline().isNull());
+            NTCCFG_TEST_EQ(receiveOptions.deadline().value(),
+                           loop.now() + bsls::TimeInterval(10));
+
+            streamSocket->expire();
+            loop.drain();
+
+            NTCCFG_TEST_TRUE(streamSocket->transmitted().empty());
+            NTCCFG_TEST_TRUE(streamSocket->isClosed());
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(7)
+{
+    // Concern: When a connection cannot be accepted because a resource is
+    // exhausted, the next connection is accepted after a delay that doubles
+    // with each consecutive failure, and is reset by a successful accept.
+    // Plan: Fail the accept operation with 'ntsa::Error::e_LIMIT', as
+    // reported for EMFILE and ENFILE, and ensure no accept operation is
+    // initiated until the delay elapses.
+
+    ntccfg::TestAllocator ta;
+    {
+        test::Loop loop(&ta);
+        {
+            test::Fixture fixture(&loop, &ta);
+
+            const bsl::shared_ptr<test::ListenerSocket>& listenerSocket =
+                fixture.d_listenerSocket_sp;
+
+            listenerSocket->fail(ntsa::Error(ntsa::Error::e_LIMIT));
+            loop.drain();
+
+            NTCCFG_TEST_FALSE(listenerSocket->isAccepting());
+            NTCCFG_TEST_EQ(loop.numScheduledTimers(), 1);
+            NTCCFG_TEST_EQ(loop.timer(0)->deadline(),
+                           loop.now() + bsls::TimeInterval(0.01));
+
+            loop.advance(bsls::TimeInterval(0.005));
+
+            NTCCFG_TEST_FALSE(listenerSocket->isAccepting());
+
+            loop.advance(bsls::TimeInterval(0.005));
+
+            NTCCFG_TEST_TRUE(listenerSocket->isAccepting());
+            NTCCFG_TEST_EQ(listenerSocket->numAccepts(), 2);
+            NTCCFG_TEST_TRUE(loop.timer(0)->isClosed());
+
+            listenerSocket->fail(ntsa::Error(ntsa::Error::e_LIMIT));
+            loop.drain();
+
+            NTCCFG_TEST_FALSE(listenerSocket->isAccepting());
+            NTCCFG_TEST_EQ(loop.numScheduledTimers(), 1);
+            NTCCFG_TEST_EQ(loop.timer(1)->deadline(),
+                           loop.now() + bsls::TimeInterval(0.02));
+
+            loop.advance(bsls::TimeInterval(0.02));
+
+            NTCCFG_TEST_TRUE(listenerSocket->isAccepting());
+            NTCCFG_TEST_EQ(listenerSocket->numAccepts(), 3);
+
+            bsl::shared_ptr<test::StreamSocket> streamSocket =
+                fixture.accept();
+
+            streamSocket->close();
+
+            listenerSocket->fail(ntsa::Error(ntsa::Error::e_LIMIT));
+            loop.drain();
+
+            NTCCFG_TEST_EQ(loop.numScheduledTimers(), 1);
+            NTCCFG_TEST_EQ(loop.timer(2)->deadline(),
+                           loop.now() + bsls::TimeInterval(0.01));
+
+            // Stopping the listener closes the pending timer.
+
+            fixture.d_listener_sp->stop();
+
+            NTCCFG_TEST_TRUE(loop.timer(2)->isClosed());
+            NTCCFG_TEST_TRUE(listenerSocket->isClosed());
+
+            loop.advance(bsls::TimeInterval(1));
+
+            NTCCFG_TEST_EQ(listenerSocket->numAccepts(), 4);
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(8)
+{
+    // Concern: When a connection cannot be accepted for a reason that is
+    // not expected to clear by itself, the listener stops rather than
+    // accepting again.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        test::Loop loop(&ta);
+        {
+            test::Fixture fixture(&loop, &ta);
+
+            const bsl::shared_ptr<test::ListenerSocket>& listenerSocket =
+                fixture.d_listenerSocket_sp;
+
+            listenerSocket->fail(ntsa::Error(ntsa::Error::e_INVALID));
+            loop.drain();
+
+            NTCCFG_TEST_FALSE(listenerSocket->isAccepting());
+            NTCCFG_TEST_TRUE(listenerSocket->isClosed());
+            NTCCFG_TEST_EQ(listenerSocket->numAccepts(), 1);
+            NTCCFG_TEST_EQ(loop.numTimers(), 0);
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+    NTCCFG_TEST_REGISTER(3);
+    NTCCFG_TEST_REGISTER(4);
+    NTCCFG_TEST_REGISTER(5);
+    NTCCFG_TEST_REGISTER(6);
+    NTCCFG_TEST_REGISTER(7);
+    NTCCFG_TEST_REGISTER(8);
+}
+NTCCFG_TEST_DRIVER_END;
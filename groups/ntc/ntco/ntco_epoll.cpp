@@ -28,10 +28,15 @@ BSLS_IDENT_RCSID(ntco_epoll_cpp, "$Id$ $CSID$")
 #include <ntcm_monitorableregistry.h>
 #include <ntcm_monitorableutil.h>
 
+#include <ntsu_socketoptionutil.h>
+
+#include <ntccfg_tune.h>
+#include <ntci_listenersocket.h>
 #include <ntci_log.h>
 #include <ntci_mutex.h>
 #include <ntcs_async.h>
 #include <ntcs_authorization.h>
+#include <ntcs_busypoll.h>
 #include <ntcs_chronology.h>
 #include <ntcs_controller.h>
 #include <ntcs_datapool.h>
@@ -41,8 +46,10 @@ BSLS_IDENT_RCSID(ntco_epoll_cpp, "$Id$ $CSID$")
 #include <ntcs_registry.h>
 #include <ntcs_reservation.h>
 #include <ntcs_strand.h>
+#include <ntcs_trace.h>
 #include <ntcs_user.h>
 
+#include <bdlb_nullablevalue.h>
 #include <bdlt_datetime.h>
 #include <bdlt_epochutil.h>
 #include <bdlt_localtimeoffset.h>
@@ -53,6 +60,8 @@ BSLS_IDENT_RCSID(ntco_epoll_cpp, "$Id$ $CSID$")
 #include <bsls_assert.h>
 #include <bsls_timeutil.h>
 
+#include <bsl_algorithm.h>
+#include <bsl_limits.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
@@ -60,8 +69,10 @@ BSLS_IDENT_RCSID(ntco_epoll_cpp, "$Id$ $CSID$")
 #include <bsl_vector.h>
 
 #include <errno.h>
+#include <signal.h>
 #include <sys/epoll.h>
 #include <sys/socket.h>
+#include <sys/syscall.h>
 #include <sys/timerfd.h>
 #include <time.h>
 #include <unistd.h>
@@ -70,42 +81,71 @@ BSLS_IDENT_RCSID(ntco_epoll_cpp, "$Id$ $CSID$")
 // device gains or loses interest in socket events.
 #define NTCRO_EPOLL_INTERRUPT_ALL false
 
-// Define to 1 to use timerfd's to implement high-resolution, but potentially
-// more expensive timing of epoll_wait.
-#define NTCO_EPOLL_USE_TIMERFD 0
+// The 'epoll_pwait2' system call number is identical on all architectures,
+// so define it when the C library headers are older than the kernel.
+#if defined(SYS_epoll_pwait2)
+#define NTCO_EPOLL_SYSTEM_CALL_PWAIT2 SYS_epoll_pwait2
+#else
+#define NTCO_EPOLL_SYSTEM_CALL_PWAIT2 441
+#endif
 
-#define NTCO_EPOLL_LOG_WAIT_INDEFINITE()                                      \
-    NTCI_LOG_TRACE("Polling for socket events indefinitely")
+// Define 'EPOLLEXCLUSIVE', introduced in Linux 4.5, when the C library
+// headers are older than the kernel.
+#if !defined(EPOLLEXCLUSIVE)
+#define EPOLLEXCLUSIVE (1U << 28)
+#endif
 
-#define NTCO_EPOLL_LOG_WAIT_TIMED(timeout)                                    \
-    NTCI_LOG_TRACE(                                                           \
-        "Polling for sockets events or until %d milliseconds have elapsed",   \
-        (int)(timeout))
+#define NTCO_EPOLL_LOG_WAIT_INDEFINITE(device)                                \
+    do {                                                                      \
+        NTCS_TRACE(e_WAIT_INDEFINITE, device, 0, 0);                          \
+        NTCI_LOG_TRACE("Polling for socket events indefinitely");             \
+    } while (false)
 
-#define NTCO_EPOLL_LOG_WAIT_TIMED_HIGH_PRECISION(timeInterval)                \
+#define NTCO_EPOLL_LOG_WAIT_TIMED(device, timeout)                            \
     do {                                                                      \
+        NTCS_TRACE(e_WAIT_TIMED, device, (timeout) * 1000, 0);                \
+        NTCI_LOG_TRACE("Polling for sockets events or until %d "              \
+                       "milliseconds have elapsed",                           \
+                       (int)(timeout));                                       \
+    } while (false)
+
+#define NTCO_EPOLL_LOG_WAIT_TIMED_HIGH_PRECISION(device, timeInterval)        \
+    do {                                                                      \
+        NTCS_TRACE(e_WAIT_TIMED,                                              \
+                   device,                                                    \
+                   (timeInterval).totalMicroseconds(),                        \
+                   0);                                                        \
         NTCI_LOG_TRACE(                                                       \
             "Polling for sockets events or until %.4f seconds have elapsed",  \
             (timeInterval).totalSecondsAsDouble());                           \
     } while (false)
 
-#define NTCO_EPOLL_LOG_WAIT_FAILURE(error)                                    \
-    NTCI_LOG_ERROR("Failed to poll for socket events: %s",                    \
-                   error.text().c_str())
+#define NTCO_EPOLL_LOG_WAIT_FAILURE(device, error)                            \
+    do {                                                                      \
+        NTCS_TRACE(e_WAIT_FAILURE, device, (error).number(), 0);              \
+        NTCI_LOG_ERROR("Failed to poll for socket events: %s",                \
+                       error.text().c_str());                                 \
+    } while (false)
 
-#define NTCO_EPOLL_LOG_WAIT_TIMEOUT()                                         \
-    NTCI_LOG_TRACE("Timed out polling for socket events")
+#define NTCO_EPOLL_LOG_WAIT_TIMEOUT(device)                                   \
+    do {                                                                      \
+        NTCS_TRACE(e_WAIT_TIMEOUT, device, 0, 0);                             \
+        NTCI_LOG_TRACE("Timed out polling for socket events");                \
+    } while (false)
 
-#define NTCO_EPOLL_LOG_WAIT_RESULT(numEvents)                                 \
-    NTCI_LOG_TRACE("Polled %d socket events", numEvents)
+#define NTCO_EPOLL_LOG_WAIT_RESULT(device, numEvents)                         \
+    do {                                                                      \
+        NTCS_TRACE(e_WAIT_RESULT, device, numEvents, 0);                      \
+        NTCI_LOG_TRACE("Polled %d socket events", numEvents);                 \
+    } while (false)
 
-#define NTCO_EPOLL_LOG_WAIT_RESULT_OR_TIMEOUT(numEvents, results)             \
+#define NTCO_EPOLL_LOG_WAIT_RESULT_OR_TIMEOUT(device, numEvents, results)     \
     do {                                                                      \
         if (numEvents == 1 && results[0].data.fd == d_timer) {                \
-            NTCO_EPOLL_LOG_WAIT_TIMEOUT();                                    \
+            NTCO_EPOLL_LOG_WAIT_TIMEOUT(device);                              \
         }                                                                     \
         else {                                                                \
-            NTCO_EPOLL_LOG_WAIT_RESULT(numEvents);                            \
+            NTCO_EPOLL_LOG_WAIT_RESULT(device, numEvents);                    \
         }                                                                     \
     } while (false)
 
@@ -117,17 +157,20 @@ BSLS_IDENT_RCSID(ntco_epoll_cpp, "$Id$ $CSID$")
                    error.text().c_str())
 
 #define NTCO_EPOLL_LOG_EVENTS(handle, event)                                  \
-    NTCI_LOG_TRACE(                                                           \
-        "Descriptor %d polled%s%s%s%s%s%s%s%s",                               \
-        handle,                                                               \
-        (((event.events & EPOLLIN) != 0) ? " EPOLLIN" : ""),                  \
-        (((event.events & EPOLLOUT) != 0) ? " EPOLLOUT" : ""),                \
-        (((event.events & EPOLLERR) != 0) ? " EPOLLERR" : ""),                \
-        (((event.events & EPOLLHUP) != 0) ? " EPOLLHUP" : ""),                \
-        (((event.events & EPOLLRDHUP) != 0) ? " EPOLLRDHUP" : ""),            \
-        (((event.events & EPOLLPRI) != 0) ? " EPOLLPRI" : ""),                \
-        (((event.events & EPOLLET) != 0) ? " EPOLLET" : ""),                  \
-        (((event.events & EPOLLONESHOT) != 0) ? " EPOLLONESHOT" : ""))
+    do {                                                                      \
+        NTCS_TRACE(e_DESCRIPTOR_POLLED, handle, event.events, 0);             \
+        NTCI_LOG_TRACE(                                                       \
+            "Descriptor %d polled%s%s%s%s%s%s%s%s",                           \
+            handle,                                                           \
+            (((event.events & EPOLLIN) != 0) ? " EPOLLIN" : ""),              \
+            (((event.events & EPOLLOUT) != 0) ? " EPOLLOUT" : ""),            \
+            (((event.events & EPOLLERR) != 0) ? " EPOLLERR" : ""),            \
+            (((event.events & EPOLLHUP) != 0) ? " EPOLLHUP" : ""),            \
+            (((event.events & EPOLLRDHUP) != 0) ? " EPOLLRDHUP" : ""),        \
+            (((event.events & EPOLLPRI) != 0) ? " EPOLLPRI" : ""),            \
+            (((event.events & EPOLLET) != 0) ? " EPOLLET" : ""),              \
+            (((event.events & EPOLLONESHOT) != 0) ? " EPOLLONESHOT" : ""));   \
+    } while (false)
 
 #define NTCO_EPOLL_LOG_CREATE(fd) NTCI_LOG_TRACE("Epoll fd %d created", fd)
 
@@ -136,48 +179,66 @@ BSLS_IDENT_RCSID(ntco_epoll_cpp, "$Id$ $CSID$")
                    error.text().c_str())
 
 #define NTCO_EPOLL_LOG_ADD(handle, event)                                     \
-    NTCI_LOG_TRACE(                                                           \
-        "Descriptor %d added%s%s%s%s%s%s%s%s",                                \
-        handle,                                                               \
-        (((event.events & EPOLLIN) != 0) ? " EPOLLIN" : ""),                  \
-        (((event.events & EPOLLOUT) != 0) ? " EPOLLOUT" : ""),                \
-        (((event.events & EPOLLERR) != 0) ? " EPOLLERR" : ""),                \
-        (((event.events & EPOLLHUP) != 0) ? " EPOLLHUP" : ""),                \
-        (((event.events & EPOLLRDHUP) != 0) ? " EPOLLRDHUP" : ""),            \
-        (((event.events & EPOLLPRI) != 0) ? " EPOLLPRI" : ""),                \
-        (((event.events & EPOLLET) != 0) ? " EPOLLET" : ""),                  \
-        (((event.events & EPOLLONESHOT) != 0) ? " EPOLLONESHOT" : ""))
+    do {                                                                      \
+        NTCS_TRACE(e_DESCRIPTOR_ADDED, handle, event.events, 0);              \
+        NTCI_LOG_TRACE(                                                       \
+            "Descriptor %d added%s%s%s%s%s%s%s%s",                            \
+            handle,                                                           \
+            (((event.events & EPOLLIN) != 0) ? " EPOLLIN" : ""),              \
+            (((event.events & EPOLLOUT) != 0) ? " EPOLLOUT" : ""),            \
+            (((event.events & EPOLLERR) != 0) ? " EPOLLERR" : ""),            \
+            (((event.events & EPOLLHUP) != 0) ? " EPOLLHUP" : ""),            \
+            (((event.events & EPOLLRDHUP) != 0) ? " EPOLLRDHUP" : ""),        \
+            (((event.events & EPOLLPRI) != 0) ? " EPOLLPRI" : ""),            \
+            (((event.events & EPOLLET) != 0) ? " EPOLLET" : ""),              \
+            (((event.events & EPOLLONESHOT) != 0) ? " EPOLLONESHOT" : ""));   \
+    } while (false)
 
 #define NTCO_EPOLL_LOG_ADD_FAILURE(handle, error)                             \
-    NTCI_LOG_ERROR("Failed to add descriptor %d: %s",                         \
-                   handle,                                                    \
-                   error.text().c_str())
+    do {                                                                      \
+        NTCS_TRACE(e_DESCRIPTOR_FAILURE, handle, (error).number(), 0);        \
+        NTCI_LOG_ERROR("Failed to add descriptor %d: %s",                     \
+                       handle,                                                \
+                       error.text().c_str());                                 \
+    } while (false)
 
 #define NTCO_EPOLL_LOG_UPDATE(handle, event)                                  \
-    NTCI_LOG_TRACE(                                                           \
-        "Descriptor %d updated%s%s%s%s%s%s%s%s",                              \
-        handle,                                                               \
-        (((event.events & EPOLLIN) != 0) ? " EPOLLIN" : ""),                  \
-        (((event.events & EPOLLOUT) != 0) ? " EPOLLOUT" : ""),                \
-        (((event.events & EPOLLERR) != 0) ? " EPOLLERR" : ""),                \
-        (((event.events & EPOLLHUP) != 0) ? " EPOLLHUP" : ""),                \
-        (((event.events & EPOLLRDHUP) != 0) ? " EPOLLRDHUP" : ""),            \
-        (((event.events & EPOLLPRI) != 0) ? " EPOLLPRI" : ""),                \
-        (((event.events & EPOLLET) != 0) ? " EPOLLET" : ""),                  \
-        (((event.events & EPOLLONESHOT) != 0) ? " EPOLLONESHOT" : ""))
+    do {                                                                      \
+        NTCS_TRACE(e_DESCRIPTOR_UPDATED, handle, event.events, 0);            \
+        NTCI_LOG_TRACE(                                                       \
+            "Descriptor %d updated%s%s%s%s%s%s%s%s",                          \
+            handle,                                                           \
+            (((event.events & EPOLLIN) != 0) ? " EPOLLIN" : ""),              \
+            (((event.events & EPOLLOUT) != 0) ? " EPOLLOUT" : ""),            \
+            (((event.events & EPOLLERR) != 0) ? " EPOLLERR" : ""),            \
+            (((event.events & EPOLLHUP) != 0) ? " EPOLLHUP" : ""),            \
+            (((event.events & EPOLLRDHUP) != 0) ? " EPOLLRDHUP" : ""),        \
+            (((event.events & EPOLLPRI) != 0) ? " EPOLLPRI" : ""),            \
+            (((event.events & EPOLLET) != 0) ? " EPOLLET" : ""),              \
+            (((event.events & EPOLLONESHOT) != 0) ? " EPOLLONESHOT" : ""));   \
+    } while (false)
 
 #define NTCO_EPOLL_LOG_UPDATE_FAILURE(handle, error)                          \
-    NTCI_LOG_ERROR("Failed to update descriptor %d: %s",                      \
-                   handle,                                                    \
-                   error.text().c_str())
+    do {                                                                      \
+        NTCS_TRACE(e_DESCRIPTOR_FAILURE, handle, (error).number(), 0);        \
+        NTCI_LOG_ERROR("Failed to update descriptor %d: %s",                  \
+                       handle,                                                \
+                       error.text().c_str());                                 \
+    } while (false)
 
 #define NTCO_EPOLL_LOG_REMOVE(handle)                                         \
-    NTCI_LOG_TRACE("Descriptor %d removed", handle)
+    do {                                                                      \
+        NTCS_TRACE(e_DESCRIPTOR_REMOVED, handle, 0, 0);                       \
+        NTCI_LOG_TRACE("Descriptor %d removed", handle);                      \
+    } while (false)
 
 #define NTCO_EPOLL_LOG_REMOVE_FAILURE(handle, error)                          \
-    NTCI_LOG_ERROR("Failed to remove descriptor %d: %s",                      \
-                   handle,                                                    \
-                   error.text().c_str())
+    do {                                                                      \
+        NTCS_TRACE(e_DESCRIPTOR_FAILURE, handle, (error).number(), 0);        \
+        NTCI_LOG_ERROR("Failed to remove descriptor %d: %s",                  \
+                       handle,                                                \
+                       error.text().c_str());                                 \
+    } while (false)
 
 #define NTCO_EPOLL_LOG_GENERATION_CATCHUP(currentGeneration)                  \
     NTCI_LOG_TRACE("Waiter catching up to generation %u",                     \
@@ -195,9 +256,65 @@ class Epoll : public ntci::Reactor,
     /// This typedef defines a set of waiters.
     typedef bsl::unordered_set<ntci::Waiter> WaiterSet;
 
+    /// This typedef defines a vector of handles.
+    typedef bsl::vector<ntsa::Handle> HandleVector;
+
+    /// This typedef defines a vector of devices.
+    typedef bsl::vector<int> DeviceVector;
+
+    /// This typedef defines a vector of device indexes.
+    typedef bsl::vector<bsl::size_t> DeviceIndexVector;
+
+    /// This typedef defines a map of handles to the binding of each handle
+    /// to the devices.
+    typedef bsl::unordered_map<ntsa::Handle, int> BindingMap;
+
     struct Result;
     // This struct describes the context of a waiter.
 
+    enum TimerMode {
+        // Enumerates the mechanisms used to time waits for events.
+
+        e_TIMER_MODE_MILLISECONDS = 0,
+        // Wait using 'epoll_wait' with a timeout in milliseconds.
+
+        e_TIMER_MODE_PWAIT2 = 1,
+        // Wait using 'epoll_pwait2' with a timeout in nanoseconds.
+
+        e_TIMER_MODE_TIMERFD = 2
+        // Wait using 'epoll_wait' indefinitely, and arm a timer file
+        // descriptor polled by the device to expire when the earliest timer
+        // is due.
+    };
+
+    enum WaiterState {
+        // Enumerates the states of a waiter.
+
+        e_WAITER_STATE_RUNNING = 0,
+        // The waiter is processing events, timers, or deferred functions,
+        // and will observe any new work before it next waits.
+
+        e_WAITER_STATE_ABOUT_TO_SLEEP = 1,
+        // The waiter is computing its timeout or busy polling the device,
+        // and may not observe new work before it blocks.
+
+        e_WAITER_STATE_SLEEPING = 2
+        // The waiter is blocked on the device.
+    };
+
+    enum Binding {
+        // Enumerates the bindings of handles to multiple devices. A
+        // non-negative binding is the index of the single device with which
+        // a handle is registered.
+
+        e_BINDING_SHARED = -1,
+        // The handle is registered with every device.
+
+        e_BINDING_EXCLUSIVE = -2
+        // The handle is registered exclusively with every device, so that
+        // each event wakes up only one waiter.
+    };
+
     enum UpdateType {
         // Enumerates the types of update.
 
@@ -220,6 +337,7 @@ class Epoll : public ntci::Reactor,
     int                                      d_epoll;
     int                                      d_timer;
     bsls::AtomicBool                         d_timerPending;
+    TimerMode                                d_timerMode;
     ntcs::RegistryEntryCatalog::EntryFunctor d_detachFunctor;
     ntcs::RegistryEntryCatalog               d_registry;
     ntcs::Chronology                         d_chronology;
@@ -232,11 +350,18 @@ class Epoll : public ntci::Reactor,
     ntsa::Handle                             d_controllerDescriptorHandle;
     mutable Mutex                            d_waiterSetMutex;
     WaiterSet                                d_waiterSet;
+    HandleVector                             d_deferredHandles;
+    DeviceVector                             d_devices;
+    DeviceIndexVector                        d_claimedDevices;
+    bsl::size_t                              d_nextDevice;
+    mutable Mutex                            d_bindingMapMutex;
+    BindingMap                               d_bindingMap;
     bslmt::ThreadUtil::Handle                d_threadHandle;
     bsl::size_t                              d_threadIndex;
     bsls::AtomicUint64                       d_threadId;
     bsls::AtomicUint64                       d_load;
     bsls::AtomicBool                         d_run;
+    bsls::AtomicUint                         d_numSleepers;
     ntca::ReactorConfig                      d_config;
     bslma::Allocator*                        d_allocator_p;
 
@@ -248,17 +373,85 @@ class Epoll : public ntci::Reactor,
     /// Execute all pending jobs.
     void flush();
 
-    /// Add the specified 'handle' identified by the with the specified
-    /// 'interest' to the device. Return the error.
-    ntsa::Error add(ntsa::Handle handle, ntcs::Interest interest);
+    /// Bind the specified 'handle' to the devices, registering it
+    /// exclusively with every device if the specified 'listener' flag is
+    /// true. Return the binding. The behavior is undefined unless the
+    /// binding mutex, if any, is locked.
+    int bind(ntsa::Handle handle, bool listener);
+
+    /// Unbind the specified 'handle' from the devices. The behavior is
+    /// undefined unless the binding mutex, if any, is locked.
+    void unbind(ntsa::Handle handle);
+
+    /// Bind each handle bound to the device at the specified 'deviceIndex'
+    /// to a device claimed by a waiter, or to the first device if no
+    /// device is claimed.
+    void rebind(bsl::size_t deviceIndex);
+
+    /// Return the binding to a device claimed by a waiter, chosen in
+    /// round-robin order, or to the first device if no device is claimed.
+    /// The behavior is undefined unless 'd_waiterSetMutex' is locked.
+    int nextBinding();
+
+    /// Return the binding of the specified 'handle' to the devices. The
+    /// behavior is undefined unless the binding mutex, if any, is locked.
+    int binding(ntsa::Handle handle) const;
+
+    /// Return the mutex that serializes the binding of handles to the
+    /// devices with the registration of those handles with the devices, or
+    /// null if there is only one device.
+    Mutex* bindingMutex() const;
+
+    /// Perform the specified 'operation' for the specified 'handle' and
+    /// 'event' on the devices indicated by the specified 'binding'. Return
+    /// 0 on success and -1 on error with 'errno' set accordingly.
+    int control(int            binding,
+                int            operation,
+                ntsa::Handle   handle,
+                ::epoll_event* event);
+
+    /// Return true if the specified 'socket' is a listener socket,
+    /// otherwise return false.
+    static bool isListener(const bsl::shared_ptr<ntci::ReactorSocket>& socket);
+
+    /// Return true if the specified 'handle' is a listening socket that
+    /// must be registered exclusively with multiple devices, otherwise
+    /// return false.
+    bool isListener(ntsa::Handle handle) const;
+
+    /// Add the specified 'handle' with the specified 'interest' to the
+    /// device. The specified 'listener' flag indicates whether 'handle' is
+    /// a listening socket. Return the error.
+    ntsa::Error add(ntsa::Handle   handle,
+                    ntcs::Interest interest,
+                    bool           listener);
 
     /// Update the specified 'handle' with the specified 'interest' in the
     /// device. The specified 'type' indicates whether events have been
-    /// included or excluded as a result of the update. Return the error.
+    /// included or excluded as a result of the update. If interest changes
+    /// are deferred and the update is made by the principle waiter, defer
+    /// the update until the waiter next waits. Return the error.
     ntsa::Error update(ntsa::Handle   handle,
                        ntcs::Interest interest,
                        UpdateType     type);
 
+    /// Modify the specified 'handle' to have the specified 'interest' in
+    /// the device, adding the 'handle' to the device if necessary. Return
+    /// the error.
+    ntsa::Error modify(ntsa::Handle handle, ntcs::Interest interest);
+
+    /// Modify the specified 'handle' to have the specified 'interest' in
+    /// the devices indicated by the specified 'binding', adding the
+    /// 'handle' to those devices if necessary. Return the error. The
+    /// behavior is undefined unless the binding mutex, if any, is locked.
+    ntsa::Error modify(int            binding,
+                       ntsa::Handle   handle,
+                       ntcs::Interest interest);
+
+    /// Apply to the device the interest of each handle whose update was
+    /// deferred, skipping handles that are no longer registered.
+    void flushUpdates();
+
     /// Remove the specified 'handle' from the device.
     ntsa::Error remove(ntsa::Handle handle);
 
@@ -279,17 +472,77 @@ class Epoll : public ntci::Reactor,
     /// configuration, otherwise return false.
     bool isWaiter();
 
-#if NTCO_EPOLL_USE_TIMERFD
-
+    /// Mark the waiter described by the specified 'result' as about to
+    /// sleep, so that threads introducing new work interrupt it. Note that
+    /// this function must be called before the waiter computes its timeout
+    /// so that any work introduced after the timeout is computed is
+    /// guaranteed to interrupt the waiter.
+    void prepareToSleep(Result* result);
+
+    /// Mark the waiter described by the specified 'result' as running, so
+    /// that threads introducing new work do not interrupt it.
+    void awaken(Result* result);
+
+    /// Wait for events on the device on behalf of the waiter described by
+    /// the specified 'result', loading at most the specified 'capacity'
+    /// events into the specified 'results'. Block for at most the
+    /// specified 'timeout', or indefinitely if 'timeout' is null, then
+    /// mark the waiter as running. Return the number of events loaded into
+    /// 'results', or -1 on error with 'errno' set accordingly.
+    int wait(Result*                                        result,
+             ::epoll_event*                                 results,
+             int                                            capacity,
+             const bdlb::NullableValue<bsls::TimeInterval>& timeout);
+
+    /// Wait for events on the device on behalf of the waiter described by
+    /// the specified 'result', loading at most the specified 'capacity'
+    /// events into the specified 'results', by repeatedly polling the
+    /// device without blocking, until either events occur or the busy poll
+    /// duration of the waiter elapses, before blocking for the remainder of
+    /// the specified 'timeout', or indefinitely if 'timeout' is null.
+    /// Return the number of events loaded into 'results', or -1 on error
+    /// with 'errno' set accordingly.
+    int busyWait(Result*                                        result,
+                 ::epoll_event*                                 results,
+                 int                                            capacity,
+                 const bdlb::NullableValue<bsls::TimeInterval>& timeout);
+
+    /// Configure the specified socket 'handle' to allow the kernel to busy
+    /// poll the network device queue, if so configured.
+    void enableSocketBusyPoll(ntsa::Handle handle);
+
+    /// Initialize the mechanism used to time waits for events, preferring
+    /// 'epoll_pwait2' if supported by the kernel, then a timer file
+    /// descriptor if this object is driven by a single thread, and finally
+    /// millisecond timeouts.
+    void initializeTimer();
+
+    /// Deinitialize the mechanism used to time waits for events.
+    void deinitializeTimer();
+
+    /// Set the timer to the specified 'absoluteTimeout'. Return the error.
     ntsa::Error setTimer(const bsls::TimeInterval& absoluteTimeout);
-    // Set the timer to the specified 'absoluteTimeout'. Return the error.
 
+    /// Read from the timer to acknowledge all previously occurred timeouts.
+    /// Increment the specified 'numTimers' if a timer has occurred and has
+    /// not yet been acknowledged. Return the error.
     ntsa::Error ackTimer(bsl::size_t* numTimers);
-    // Read from the timer to acknowledge all previously occurred timeouts.
-    // Increment the specified 'numTimers' if a timer has occurred and has
-    // not yet been acknowledged. Return the error.
 
-#endif
+    /// Load into the specified 'timeout' the relative timeout of the next
+    /// wait for events by the waiter described by the specified 'result',
+    /// or null if the waiter should wait indefinitely.
+    void computeTimeout(bdlb::NullableValue<bsls::TimeInterval>* timeout,
+                        Result*                                  result);
+
+    /// Wait for events on the specified 'device', loading at most the
+    /// specified 'capacity' events into the specified 'results'. Block for
+    /// at most the specified 'timeout', or indefinitely if 'timeout' is
+    /// null. Return the number of events loaded into 'results', or -1 on
+    /// error with 'errno' set accordingly.
+    int waitDevice(int                                            device,
+                   ::epoll_event*                                 results,
+                   int                                            capacity,
+                   const bdlb::NullableValue<bsls::TimeInterval>& timeout);
 
     /// Acquire usage of the most suitable reactor selected according to the
     /// specified load balancing 'options'.
@@ -712,6 +965,11 @@ struct Epoll::Result {
     ntca::WaiterOptions                     d_options;
     bsl::shared_ptr<ntci::ReactorMetrics>   d_metrics_sp;
     bdlb::NullableValue<bsls::TimeInterval> d_earliestTimerDue;
+    ntcs::BusyPoll                          d_busyPoll;
+    WaiterState                             d_state;
+    int                                     d_device;
+    bsl::size_t                             d_deviceIndex;
+    bool                                    d_deviceClaimed;
 
   private:
     Result(const Result&) BSLS_KEYWORD_DELETED;
@@ -731,6 +989,11 @@ Epoll::Result::Result(bslma::Allocator* basicAllocator)
 : d_options(basicAllocator)
 , d_metrics_sp()
 , d_earliestTimerDue()
+, d_busyPoll()
+, d_state(e_WAITER_STATE_RUNNING)
+, d_device(-1)
+, d_deviceIndex(0)
+, d_deviceClaimed(false)
 {
 }
 
@@ -747,8 +1010,264 @@ void Epoll::flush()
     }
 }
 
+int Epoll::bind(ntsa::Handle handle, bool listener)
+{
+    if (NTCCFG_LIKELY(d_devices.size() == 1)) {
+        return 0;
+    }
+
+    // The controller must wake up any waiter, so register it with every
+    // device. Listening sockets are registered exclusively with every
+    // device so that each incoming connection may be accepted by any, but
+    // only one, waiter. Bind all other sockets to a single device claimed
+    // by a waiter, chosen in round-robin order.
+
+    int binding;
+
+    if (handle == d_controllerDescriptorHandle) {
+        binding = e_BINDING_SHARED;
+    }
+    else if (listener) {
+        binding = e_BINDING_EXCLUSIVE;
+    }
+    else {
+        LockGuard lock(&d_waiterSetMutex);
+        binding = this->nextBinding();
+    }
+
+    d_bindingMap[handle] = binding;
+
+    return binding;
+}
+
+void Epoll::unbind(ntsa::Handle handle)
+{
+    if (NTCCFG_LIKELY(d_devices.size() == 1)) {
+        return;
+    }
+
+    d_bindingMap.erase(handle);
+}
+
+void Epoll::rebind(bsl::size_t deviceIndex)
+{
+    // Sockets bound to a device that no waiter polls would otherwise
+    // receive no events until another waiter claims that device, so move
+    // each such socket to a device claimed by a waiter. Registering a
+    // socket with the new device polls its current readiness, so no
+    // edge-triggered event is lost in the move.
+
+    HandleVector handles(d_allocator_p);
+
+    {
+        LockGuard lock(&d_bindingMapMutex);
+
+        for (BindingMap::const_iterator it = d_bindingMap.begin();
+             it != d_bindingMap.end();
+             ++it)
+        {
+            if (it->second == static_cast<int>(deviceIndex)) {
+                handles.push_back(it->first);
+            }
+        }
+    }
+
+    for (HandleVector::const_iterator it = handles.begin();
+         it != handles.end();
+         ++it)
+    {
+        const ntsa::Handle handle = *it;
+
+        // The registry announces detachment while its own mutex is locked,
+        // and detachment locks the binding mutex, so look up the entry
+        // before locking the binding mutex.
+
+        bsl::shared_ptr<ntcs::RegistryEntry> entry;
+        if (!d_registry.lookup(&entry, handle)) {
+            continue;
+        }
+
+        // Move the socket while the binding mutex is locked, so that the
+        // move is serialized with every other change to the registration
+        // of the socket. A socket detached since it was looked up has
+        // already been unbound, and a handle rebound since then may
+        // identify a different socket, so skip both.
+
+        LockGuard lock(&d_bindingMapMutex);
+
+        BindingMap::iterator jt = d_bindingMap.find(handle);
+        if (jt == d_bindingMap.end() ||
+            jt->second != static_cast<int>(deviceIndex))
+        {
+            continue;
+        }
+
+        int binding;
+        {
+            LockGuard waiterSetLock(&d_waiterSetMutex);
+            binding = this->nextBinding();
+        }
+
+        if (binding == static_cast<int>(deviceIndex)) {
+            continue;
+        }
+
+        jt->second = binding;
+
+        ::epoll_event e;
+
+        e.data.fd = handle;
+        e.events  = 0;
+
+        ::epoll_ctl(d_devices[deviceIndex], EPOLL_CTL_DEL, handle, &e);
+
+        // A one-shot registration whose event is being processed has been
+        // disarmed by the device, and must remain so until that processing
+        // re-arms it, so leave it unregistered: the next change to its
+        // interest adds it to the new device.
+
+        ntcs::Interest interest = entry->interest();
+
+        if (interest.oneShot() && entry->isProcessing()) {
+            continue;
+        }
+
+        this->modify(binding, handle, interest);
+    }
+}
+
+int Epoll::nextBinding()
+{
+    if (d_claimedDevices.empty()) {
+        return 0;
+    }
+
+    const int binding = static_cast<int>(
+        d_claimedDevices[d_nextDevice % d_claimedDevices.size()]);
+
+    ++d_nextDevice;
+
+    return binding;
+}
+
 NTCCFG_INLINE
-ntsa::Error Epoll::add(ntsa::Handle handle, ntcs::Interest interest)
+int Epoll::binding(ntsa::Handle handle) const
+{
+    if (NTCCFG_LIKELY(d_devices.size() == 1)) {
+        return 0;
+    }
+
+    BindingMap::const_iterator it = d_bindingMap.find(handle);
+    if (it != d_bindingMap.end()) {
+        return it->second;
+    }
+
+    return 0;
+}
+
+NTCCFG_INLINE
+Epoll::Mutex* Epoll::bindingMutex() const
+{
+    if (NTCCFG_LIKELY(d_devices.size() == 1)) {
+        return 0;
+    }
+
+    return &d_bindingMapMutex;
+}
+
+NTCCFG_INLINE
+int Epoll::control(int            binding,
+                   int            operation,
+                   ntsa::Handle   handle,
+                   ::epoll_event* event)
+{
+    if (NTCCFG_LIKELY(binding >= 0)) {
+        return ::epoll_ctl(d_devices[binding], operation, handle, event);
+    }
+
+    // The kernel does not permit modifying an exclusive registration, nor
+    // registering it without interest in readability or writability, nor
+    // combining it with one-shot mode, so modify exclusive registrations by
+    // removing them and re-adding them only while some interest remains.
+    // A registration that cannot be removed, notably because no interest
+    // remained, fails the modification with the error of the removal.
+
+    ::epoll_event e = *event;
+
+    bool exclusive = false;
+    bool interest  = true;
+
+    if (binding == e_BINDING_EXCLUSIVE) {
+        e.events &= ~static_cast<bsl::uint32_t>(EPOLLONESHOT);
+        e.events |= EPOLLEXCLUSIVE;
+
+        exclusive = true;
+        interest  = (e.events & (EPOLLIN | EPOLLOUT)) != 0;
+    }
+
+    int result = 0;
+    int error  = 0;
+
+    for (DeviceVector::const_iterator it = d_devices.begin();
+         it != d_devices.end();
+         ++it)
+    {
+        const int device = *it;
+
+        int rc = 0;
+        if (exclusive && operation != EPOLL_CTL_DEL) {
+            if (operation == EPOLL_CTL_MOD) {
+                rc = ::epoll_ctl(device, EPOLL_CTL_DEL, handle, &e);
+            }
+
+            if (rc == 0 && interest) {
+                rc = ::epoll_ctl(device, EPOLL_CTL_ADD, handle, &e);
+            }
+        }
+        else {
+            rc = ::epoll_ctl(device, operation, handle, &e);
+        }
+
+        if (rc != 0 && result == 0) {
+            result = rc;
+            error  = errno;
+        }
+    }
+
+    if (result != 0) {
+        errno = error;
+    }
+
+    return result;
+}
+
+bool Epoll::isListener(const bsl::shared_ptr<ntci::ReactorSocket>& socket)
+{
+    return dynamic_cast<ntci::ListenerSocket*>(socket.get()) != 0;
+}
+
+bool Epoll::isListener(ntsa::Handle handle) const
+{
+    // Only listening sockets bound to multiple devices are registered
+    // differently, and a raw handle carries no other indication of its
+    // role, so query the socket only when it may be so bound.
+
+    if (NTCCFG_LIKELY(d_devices.size() == 1)) {
+        return false;
+    }
+
+    int       value = 0;
+    socklen_t size  = sizeof value;
+
+    int rc = ::getsockopt(handle, SOL_SOCKET, SO_ACCEPTCONN, &value, &size);
+
+    return rc == 0 && value != 0;
+}
+
+NTCCFG_INLINE
+ntsa::Error Epoll::add(ntsa::Handle   handle,
+                       ntcs::Interest interest,
+                       bool           listener)
 {
     NTCI_LOG_CONTEXT();
 
@@ -777,13 +1296,25 @@ ntsa::Error Epoll::add(ntsa::Handle handle, ntcs::Interest interest)
         e.events |= EPOLLONESHOT;
     }
 
-    rc = ::epoll_ctl(d_epoll, EPOLL_CTL_ADD, handle, &e);
+    int lastError = 0;
+    {
+        LockGuard lock(this->bindingMutex());
+
+        rc = this->control(this->bind(handle, listener),
+                           EPOLL_CTL_ADD,
+                           handle,
+                           &e);
+        if (rc != 0) {
+            lastError = errno;
+        }
+    }
+
     if (rc == 0) {
         NTCO_EPOLL_LOG_ADD(handle, e);
         return ntsa::Error();
     }
     else {
-        ntsa::Error error(errno);
+        ntsa::Error error(lastError);
         NTCO_EPOLL_LOG_ADD_FAILURE(handle, error);
         return error;
     }
@@ -793,14 +1324,38 @@ NTCCFG_INLINE
 ntsa::Error Epoll::update(ntsa::Handle   handle,
                           ntcs::Interest interest,
                           UpdateType     type)
+{
+    NTCCFG_WARNING_UNUSED(type);
+
+    // Changes made by the principle waiter are observed by the device
+    // before that waiter next waits, so such changes may be accumulated and
+    // applied once per wait.
+
+    if (d_config.deferInterestChanges().value() && isWaiter()) {
+        d_deferredHandles.push_back(handle);
+        return ntsa::Error();
+    }
+
+    return this->modify(handle, interest);
+}
+
+NTCCFG_INLINE
+ntsa::Error Epoll::modify(ntsa::Handle handle, ntcs::Interest interest)
+{
+    LockGuard lock(this->bindingMutex());
+    return this->modify(this->binding(handle), handle, interest);
+}
+
+NTCCFG_INLINE
+ntsa::Error Epoll::modify(int            binding,
+                          ntsa::Handle   handle,
+                          ntcs::Interest interest)
 {
     // The socket is artificially removed from the epoll set each time it
     // polls EPOLLHUP, but allow subsequent event registrations to re-add it.
     // This behavior permits code to attempt to poll for the readability or
     // writability once after both sides of the socket have shut down.
 
-    NTCCFG_WARNING_UNUSED(type);
-
     NTCI_LOG_CONTEXT();
 
     int rc;
@@ -828,14 +1383,14 @@ ntsa::Error Epoll::update(ntsa::Handle   handle,
         e.events |= EPOLLONESHOT;
     }
 
-    rc = ::epoll_ctl(d_epoll, EPOLL_CTL_MOD, handle, &e);
+    rc = this->control(binding, EPOLL_CTL_MOD, handle, &e);
     if (rc == 0) {
         NTCO_EPOLL_LOG_UPDATE(handle, e);
         return ntsa::Error();
     }
     else {
         if (errno == ENOENT) {
-            rc = ::epoll_ctl(d_epoll, EPOLL_CTL_ADD, handle, &e);
+            rc = this->control(binding, EPOLL_CTL_ADD, handle, &e);
             if (rc == 0) {
                 NTCO_EPOLL_LOG_UPDATE(handle, e);
                 return ntsa::Error();
@@ -854,6 +1409,38 @@ ntsa::Error Epoll::update(ntsa::Handle   handle,
     }
 }
 
+void Epoll::flushUpdates()
+{
+    if (NTCCFG_LIKELY(d_deferredHandles.empty())) {
+        return;
+    }
+
+    // Collapse multiple updates to the same handle into a single
+    // modification of the device, using the interest registered for that
+    // handle at the time of the modification. Handles that have been
+    // removed since their update was deferred are no longer registered.
+
+    bsl::sort(d_deferredHandles.begin(), d_deferredHandles.end());
+
+    HandleVector::iterator end =
+        bsl::unique(d_deferredHandles.begin(), d_deferredHandles.end());
+
+    for (HandleVector::iterator it = d_deferredHandles.begin(); it != end;
+         ++it)
+    {
+        const ntsa::Handle handle = *it;
+
+        bsl::shared_ptr<ntcs::RegistryEntry> entry;
+        if (!d_registry.lookup(&entry, handle)) {
+            continue;
+        }
+
+        this->modify(handle, entry->interest());
+    }
+
+    d_deferredHandles.clear();
+}
+
 NTCCFG_INLINE
 ntsa::Error Epoll::remove(ntsa::Handle handle)
 {
@@ -868,13 +1455,22 @@ ntsa::Error Epoll::remove(ntsa::Handle handle)
     e.data.fd = handle;
     e.events  = 0;
 
-    rc = ::epoll_ctl(d_epoll, EPOLL_CTL_DEL, handle, &e);
+    int lastError = 0;
+    {
+        LockGuard lock(this->bindingMutex());
+
+        rc = this->control(this->binding(handle), EPOLL_CTL_DEL, handle, &e);
+        if (rc != 0) {
+            lastError = errno;
+        }
+    }
+
     if (rc == 0) {
         NTCO_EPOLL_LOG_REMOVE(handle);
         return ntsa::Error();
     }
-    else if (errno != ENOENT) {
-        ntsa::Error error(errno);
+    else if (lastError != ENOENT) {
+        ntsa::Error error(lastError);
         NTCO_EPOLL_LOG_REMOVE_FAILURE(handle, error);
         return error;
     }
@@ -901,69 +1497,298 @@ ntsa::Error Epoll::removeDetached(
     e.data.fd = handle;
     e.events  = 0;
 
-    int rc = ::epoll_ctl(d_epoll, EPOLL_CTL_DEL, handle, &e);
+    // Remove and unbind the handle while the binding mutex is locked, so
+    // that the handle is not concurrently moved to another device.
+
+    int rc;
+    int lastError = 0;
+    {
+        LockGuard lock(this->bindingMutex());
+
+        rc = this->control(this->binding(handle), EPOLL_CTL_DEL, handle, &e);
+        if (rc != 0) {
+            lastError = errno;
+        }
+
+        this->unbind(handle);
+    }
+
     if (rc == 0) {
         NTCO_EPOLL_LOG_REMOVE(handle);
     }
-    else if (errno != ENOENT) {
-        error = ntsa::Error(errno);
+    else if (lastError != ENOENT) {
+        error = ntsa::Error(lastError);
         NTCO_EPOLL_LOG_REMOVE_FAILURE(handle, error);
     }
-    else {
-        // TODO: NTCO_EPOLL_LOG_REMOVE_IGNORED(handle);
+    else {
+        // TODO: NTCO_EPOLL_LOG_REMOVE_IGNORED(handle);
+    }
+
+    if (!entry->isProcessing() && entry->announceDetached(this->getSelf(this)))
+    {
+        entry->clear();
+        Epoll::interruptOne();
+    }
+
+    return error;
+}
+
+void Epoll::reinitializeControl()
+{
+    if (d_controller_sp) {
+        bsl::shared_ptr<ntcs::RegistryEntry> entry =
+            d_registry.remove(d_controller_sp);
+        if (entry) {
+            this->remove(entry->handle());
+        }
+        d_controller_sp.reset();
+    }
+
+    d_controller_sp.createInplace(d_allocator_p);
+
+    bsl::shared_ptr<ntcs::RegistryEntry> entry =
+        d_registry.add(d_controller_sp);
+
+    d_controllerDescriptorHandle = entry->handle();
+
+    ntca::ReactorEventOptions options;
+
+    entry->showReadable(options);
+    this->add(entry->handle(), entry->interest(), false);
+}
+
+void Epoll::deinitializeControl()
+{
+    bsl::shared_ptr<ntcs::RegistryEntry> entry =
+        d_registry.remove(d_controller_sp);
+    if (entry) {
+        this->remove(entry->handle());
+    }
+
+    d_controller_sp.reset();
+}
+
+NTCCFG_INLINE
+bool Epoll::isWaiter()
+{
+    return bslmt::ThreadUtil::selfIdAsUint64() == d_threadId.load();
+}
+
+NTCCFG_INLINE
+void Epoll::prepareToSleep(Epoll::Result* result)
+{
+    BSLS_ASSERT(result->d_state == e_WAITER_STATE_RUNNING);
+
+    result->d_state = e_WAITER_STATE_ABOUT_TO_SLEEP;
+    ++d_numSleepers;
+}
+
+NTCCFG_INLINE
+void Epoll::awaken(Epoll::Result* result)
+{
+    if (result->d_state != e_WAITER_STATE_RUNNING) {
+        result->d_state = e_WAITER_STATE_RUNNING;
+        --d_numSleepers;
+    }
+}
+
+NTCCFG_INLINE
+int Epoll::wait(Epoll::Result*                                 result,
+                ::epoll_event*                                 results,
+                int                                            capacity,
+                const bdlb::NullableValue<bsls::TimeInterval>& timeout)
+{
+    int rc;
+
+    if (!timeout.isNull() && timeout.value() == bsls::TimeInterval()) {
+        this->awaken(result);
+        rc = this->waitDevice(result->d_device, results, capacity, timeout);
+    }
+    else if (NTCCFG_LIKELY(!result->d_busyPoll.isEnabled())) {
+        result->d_state = e_WAITER_STATE_SLEEPING;
+        rc = this->waitDevice(result->d_device, results, capacity, timeout);
+        this->awaken(result);
+    }
+    else {
+        rc = this->busyWait(result, results, capacity, timeout);
+        this->awaken(result);
+    }
+
+    return rc;
+}
+
+int Epoll::busyWait(Epoll::Result*                                 result,
+                    ::epoll_event*                                 results,
+                    int                                            capacity,
+                    const bdlb::NullableValue<bsls::TimeInterval>& timeout)
+{
+    ntcs::BusyPoll& busyPoll = result->d_busyPoll;
+
+    NTCS_METRICS_GET();
+
+    int rc;
+
+    bdlb::NullableValue<bsls::TimeInterval> remaining = timeout;
+
+    bsls::Types::Int64 now = bsls::TimeUtil::getTimer();
+
+    if (busyPoll.isActive()) {
+        const bsls::Types::Int64 start = now;
+
+        bsls::Types::Int64 deadline = start + busyPoll.duration();
+        if (!timeout.isNull()) {
+            const bsls::Types::Int64 timeoutDeadline =
+                start + timeout.value().totalNanoseconds();
+            if (deadline > timeoutDeadline) {
+                deadline = timeoutDeadline;
+            }
+        }
+
+        while (true) {
+            rc = ::epoll_wait(result->d_device, results, capacity, 0);
+            if (rc != 0) {
+                if (rc > 0) {
+                    busyPoll.recordHit();
+                    NTCS_METRICS_UPDATE_BUSY_POLL(true);
+                }
+                return rc;
+            }
+
+            now = bsls::TimeUtil::getTimer();
+            if (now >= deadline) {
+                break;
+            }
+        }
+
+        NTCS_METRICS_UPDATE_BUSY_POLL(false);
+
+        if (!remaining.isNull()) {
+            bsls::TimeInterval elapsed;
+            elapsed.setTotalNanoseconds(now - start);
+
+            if (remaining.value() > elapsed) {
+                remaining.value() -= elapsed;
+            }
+            else {
+                remaining.makeValue(bsls::TimeInterval());
+            }
+        }
+    }
+
+    result->d_state = e_WAITER_STATE_SLEEPING;
+
+    rc = this->waitDevice(result->d_device, results, capacity, remaining);
+
+    busyPoll.recordMiss(rc > 0, bsls::TimeUtil::getTimer() - now);
+
+    return rc;
+}
+
+void Epoll::enableSocketBusyPoll(ntsa::Handle handle)
+{
+    if (NTCCFG_LIKELY(!d_config.busyPollSockets().value())) {
+        return;
+    }
+
+    if (d_config.busyPollDuration().isNull()) {
+        return;
     }
 
-    if (!entry->isProcessing() && entry->announceDetached(this->getSelf(this)))
-    {
-        entry->clear();
-        Epoll::interruptOne();
+    const bsls::Types::Int64 microseconds =
+        d_config.busyPollDuration().value().totalMicroseconds();
+
+    if (microseconds <= 0) {
+        return;
     }
 
-    return error;
+    // Kernel busy polling is an optimization, so failure to enable it, for
+    // example because the kernel does not support it or the process lacks
+    // the necessary privileges, is ignored.
+
+    ntsu::SocketOptionUtil::setBusyPoll(
+        handle,
+        static_cast<bsl::size_t>(microseconds));
 }
 
-void Epoll::reinitializeControl()
+void Epoll::initializeTimer()
 {
-    if (d_controller_sp) {
-        bsl::shared_ptr<ntcs::RegistryEntry> entry =
-            d_registry.remove(d_controller_sp);
-        if (entry) {
-            this->remove(entry->handle());
+    d_timerMode = e_TIMER_MODE_MILLISECONDS;
+
+    // Each mechanism may be disabled through the environment, which allows
+    // each to be exercised regardless of the capabilities of the kernel.
+
+    bool usePwait2;
+    ntccfg::Tune::configure(&usePwait2, "NTCO_EPOLL_PWAIT2", true);
+
+    bool useTimerfd;
+    ntccfg::Tune::configure(&useTimerfd, "NTCO_EPOLL_TIMERFD", true);
+
+    // Probe for support for 'epoll_pwait2', introduced in Linux 5.11, by
+    // instantaneously polling the device, which must have no descriptors
+    // added so that no events are consumed.
+
+    if (usePwait2) {
+        ::epoll_event result;
+
+        struct ::timespec ts;
+        ts.tv_sec  = 0;
+        ts.tv_nsec = 0;
+
+        int rc = static_cast<int>(::syscall(NTCO_EPOLL_SYSTEM_CALL_PWAIT2,
+                                            d_epoll,
+                                            &result,
+                                            1,
+                                            &ts,
+                                            reinterpret_cast<sigset_t*>(0),
+                                            _NSIG / 8));
+        if (rc >= 0) {
+            d_timerMode = e_TIMER_MODE_PWAIT2;
+            return;
         }
-        d_controller_sp.reset();
     }
 
-    d_controller_sp.createInplace(d_allocator_p);
+    // Otherwise, a timer file descriptor can only be used to time the waits
+    // of a single thread.
 
-    bsl::shared_ptr<ntcs::RegistryEntry> entry =
-        d_registry.add(d_controller_sp);
+    if (useTimerfd && d_config.maxThreads().value() == 1) {
+        d_timer = ::timerfd_create(CLOCK_REALTIME, TFD_NONBLOCK | TFD_CLOEXEC);
+        if (d_timer < 0) {
+            return;
+        }
 
-    d_controllerDescriptorHandle = entry->handle();
+        ::epoll_event e;
 
-    ntca::ReactorEventOptions options;
+        e.data.fd = d_timer;
+        e.events  = EPOLLIN;
 
-    entry->showReadable(options);
-    this->add(entry->handle(), entry->interest());
-}
+        int rc = ::epoll_ctl(d_epoll, EPOLL_CTL_ADD, d_timer, &e);
+        if (rc != 0) {
+            ::close(d_timer);
+            d_timer = -1;
+            return;
+        }
 
-void Epoll::deinitializeControl()
-{
-    bsl::shared_ptr<ntcs::RegistryEntry> entry =
-        d_registry.remove(d_controller_sp);
-    if (entry) {
-        this->remove(entry->handle());
+        d_timerMode = e_TIMER_MODE_TIMERFD;
     }
-
-    d_controller_sp.reset();
 }
 
-NTCCFG_INLINE
-bool Epoll::isWaiter()
+void Epoll::deinitializeTimer()
 {
-    return bslmt::ThreadUtil::selfIdAsUint64() == d_threadId.load();
-}
+    if (d_timer >= 0) {
+        ::epoll_event e;
+
+        e.data.fd = d_timer;
+        e.events  = 0;
 
-#if NTCO_EPOLL_USE_TIMERFD
+        int rc = ::epoll_ctl(d_epoll, EPOLL_CTL_DEL, d_timer, &e);
+        if (rc != 0) {
+            NTCCFG_ABORT();
+        }
+
+        ::close(d_timer);
+        d_timer = -1;
+    }
+}
 
 ntsa::Error Epoll::setTimer(const bsls::TimeInterval& absoluteTimeout)
 {
@@ -1012,7 +1837,103 @@ ntsa::Error Epoll::ackTimer(bsl::size_t* numTimers)
     return ntsa::Error();
 }
 
-#endif
+void Epoll::computeTimeout(bdlb::NullableValue<bsls::TimeInterval>* timeout,
+                           Epoll::Result*                           result)
+{
+    NTCI_LOG_CONTEXT();
+
+    timeout->reset();
+
+    if (d_timerMode == e_TIMER_MODE_PWAIT2) {
+        *timeout = d_chronology.timeoutInterval();
+
+        if (!timeout->isNull()) {
+            NTCO_EPOLL_LOG_WAIT_TIMED_HIGH_PRECISION(result->d_device,
+                                                     timeout->value());
+        }
+        else {
+            NTCO_EPOLL_LOG_WAIT_INDEFINITE(result->d_device);
+        }
+    }
+    else if (d_timerMode == e_TIMER_MODE_TIMERFD) {
+        bdlb::NullableValue<bsls::TimeInterval> earliestTimerDue =
+            d_chronology.earliest();
+
+        if (!earliestTimerDue.isNull()) {
+            if (earliestTimerDue.value() == bsls::TimeInterval()) {
+                timeout->makeValue(bsls::TimeInterval());
+                NTCO_EPOLL_LOG_WAIT_TIMED(result->d_device, 0);
+            }
+            else {
+                NTCO_EPOLL_LOG_WAIT_TIMED_HIGH_PRECISION(
+                    result->d_device,
+                    earliestTimerDue.value());
+
+                if (earliestTimerDue != result->d_earliestTimerDue ||
+                    !d_timerPending)
+                {
+                    ntsa::Error error =
+                        this->setTimer(earliestTimerDue.value());
+                    if (error) {
+                        NTCO_EPOLL_LOG_TIMER_SET_FAILURE(error);
+                    }
+                    else {
+                        result->d_earliestTimerDue = earliestTimerDue;
+                    }
+                }
+            }
+        }
+        else {
+            NTCO_EPOLL_LOG_WAIT_INDEFINITE(result->d_device);
+        }
+    }
+    else {
+        const int milliseconds = d_chronology.timeoutInMilliseconds();
+
+        if (milliseconds >= 0) {
+            NTCO_EPOLL_LOG_WAIT_TIMED(result->d_device, milliseconds);
+            timeout->makeValue().setTotalMilliseconds(milliseconds);
+        }
+        else {
+            NTCO_EPOLL_LOG_WAIT_INDEFINITE(result->d_device);
+        }
+    }
+}
+
+NTCCFG_INLINE
+int Epoll::waitDevice(int                                            device,
+                      ::epoll_event*                                 results,
+                      int                                            capacity,
+                      const bdlb::NullableValue<bsls::TimeInterval>& timeout)
+{
+    if (timeout.isNull()) {
+        return ::epoll_wait(device, results, capacity, -1);
+    }
+
+    if (d_timerMode == e_TIMER_MODE_PWAIT2) {
+        struct ::timespec ts;
+        ts.tv_sec  = static_cast<time_t>(timeout.value().seconds());
+        ts.tv_nsec = static_cast<long>(timeout.value().nanoseconds());
+
+        return static_cast<int>(::syscall(NTCO_EPOLL_SYSTEM_CALL_PWAIT2,
+                                          device,
+                                          results,
+                                          capacity,
+                                          &ts,
+                                          reinterpret_cast<sigset_t*>(0),
+                                          _NSIG / 8));
+    }
+
+    const bsls::Types::Int64 milliseconds =
+        timeout.value().totalMilliseconds();
+
+    return ::epoll_wait(device,
+                        results,
+                        capacity,
+                        milliseconds < bsl::numeric_limits<int>::max()
+                            ? static_cast<int>(milliseconds)
+                            : bsl::numeric_limits<int>::max());
+}
 
 bsl::shared_ptr<ntci::Reactor> Epoll::acquireReactor(
     const ntca::LoadBalancingOptions& options)
@@ -1072,6 +1993,7 @@ Epoll::Epoll(const ntca::ReactorConfig&         configuration,
 , d_epoll(-1)
 , d_timer(-1)
 , d_timerPending(false)
+, d_timerMode(e_TIMER_MODE_MILLISECONDS)
 #if NTCCFG_PLATFORM_COMPILER_SUPPORTS_LAMDAS
 , d_detachFunctor([this](const auto& entry) {
     return this->removeDetached(entry);
@@ -1091,11 +2013,18 @@ Epoll::Epoll(const ntca::ReactorConfig&         configuration,
 , d_controllerDescriptorHandle(ntsa::k_INVALID_HANDLE)
 , d_waiterSetMutex()
 , d_waiterSet(basicAllocator)
+, d_deferredHandles(basicAllocator)
+, d_devices(basicAllocator)
+, d_claimedDevices(basicAllocator)
+, d_nextDevice(0)
+, d_bindingMapMutex()
+, d_bindingMap(basicAllocator)
 , d_threadHandle(bslmt::ThreadUtil::invalidHandle())
 , d_threadIndex(0)
 , d_threadId(0)
 , d_load(0)
 , d_run(true)
+, d_numSleepers(0)
 , d_config(configuration, basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
@@ -1146,6 +2075,16 @@ Epoll::Epoll(const ntca::ReactorConfig&         configuration,
         d_config.setMaxCyclesPerWait(NTCCFG_DEFAULT_MAX_CYCLES_PER_WAIT);
     }
 
+    if (d_config.busyPollSockets().isNull()) {
+        d_config.setBusyPollSockets(false);
+    }
+
+    if (d_config.deferInterestChanges().isNull() ||
+        d_config.maxThreads().value() > 1)
+    {
+        d_config.setDeferInterestChanges(false);
+    }
+
     if (d_config.metricCollection().isNull()) {
         d_config.setMetricCollection(NTCCFG_DEFAULT_DRIVER_METRICS);
     }
@@ -1167,8 +2106,16 @@ Epoll::Epoll(const ntca::ReactorConfig&         configuration,
         d_config.setAutoDetach(false);
     }
 
+    if (d_config.devicePerWaiter().isNull() ||
+        d_config.maxThreads().value() == 1)
+    {
+        d_config.setDevicePerWaiter(false);
+    }
+
     if (d_config.oneShot().isNull()) {
-        if (d_config.maxThreads().value() == 1) {
+        if (d_config.maxThreads().value() == 1 ||
+            d_config.devicePerWaiter().value())
+        {
             d_config.setOneShot(false);
         }
         else {
@@ -1230,30 +2177,25 @@ Epoll::Epoll(const ntca::ReactorConfig&         configuration,
 
     NTCO_EPOLL_LOG_CREATE(d_epoll);
 
-    this->reinitializeControl();
-
-#if NTCO_EPOLL_USE_TIMERFD
-
-    if (d_config.maxThreads().value() == 1) {
-        d_timer = timerfd_create(CLOCK_REALTIME, TFD_NONBLOCK | TFD_CLOEXEC);
-        if (d_timer < 0) {
-            NTCCFG_ABORT();
-        }
-
-        {
-            ::epoll_event e;
-
-            e.data.fd = d_timer;
-            e.events  = EPOLLIN;
+    d_devices.push_back(d_epoll);
 
-            int rc = ::epoll_ctl(d_epoll, EPOLL_CTL_ADD, d_timer, &e);
-            if (rc != 0) {
+    if (d_config.devicePerWaiter().value()) {
+        while (d_devices.size() < d_config.maxThreads().value()) {
+            int device = ::epoll_create1(EPOLL_CLOEXEC);
+            if (device < 0) {
+                NTCO_EPOLL_LOG_CREATE_FAILURE(ntsa::Error(errno));
                 NTCCFG_ABORT();
             }
+
+            NTCO_EPOLL_LOG_CREATE(device);
+
+            d_devices.push_back(device);
         }
     }
 
-#endif
+    this->initializeTimer();
+
+    this->reinitializeControl();
 }
 
 Epoll::~Epoll()
@@ -1268,30 +2210,15 @@ Epoll::~Epoll()
 
     BSLS_ASSERT_OPT(d_waiterSet.empty());
 
-#if NTCO_EPOLL_USE_TIMERFD
-
-    if (d_config.maxThreads().value() == 1) {
-        {
-            ::epoll_event e;
-
-            e.data.fd = d_timer;
-            e.events  = 0;
+    this->deinitializeTimer();
 
-            int rc = ::epoll_ctl(d_epoll, EPOLL_CTL_DEL, d_timer, &e);
-            if (rc != 0) {
-                NTCCFG_ABORT();
-            }
-        }
+    this->deinitializeControl();
 
-        if (d_timer >= 0) {
-            ::close(d_timer);
-            d_timer = -1;
-        }
+    for (bsl::size_t i = 1; i < d_devices.size(); ++i) {
+        ::close(d_devices[i]);
     }
 
-#endif
-
-    this->deinitializeControl();
+    d_devices.clear();
 
     if (d_epoll >= 0) {
         ::close(d_epoll);
@@ -1314,6 +2241,27 @@ ntci::Waiter Epoll::registerWaiter(const ntca::WaiterOptions& waiterOptions)
             result->d_options.setThreadHandle(bslmt::ThreadUtil::self());
         }
 
+        // Claim the first device not yet claimed by another waiter, or if
+        // all devices are claimed, share a claimed device.
+
+        while (result->d_deviceIndex < d_devices.size() &&
+               bsl::find(d_claimedDevices.begin(),
+                         d_claimedDevices.end(),
+                         result->d_deviceIndex) != d_claimedDevices.end())
+        {
+            ++result->d_deviceIndex;
+        }
+
+        if (result->d_deviceIndex < d_devices.size()) {
+            d_claimedDevices.push_back(result->d_deviceIndex);
+            result->d_deviceClaimed = true;
+        }
+        else {
+            result->d_deviceIndex = d_waiterSet.size() % d_devices.size();
+        }
+
+        result->d_device = d_devices[result->d_deviceIndex];
+
         if (d_waiterSet.empty()) {
             d_threadHandle = result->d_options.threadHandle();
             principleThreadHandle.makeValue(d_threadHandle);
@@ -1349,6 +2297,11 @@ ntci::Waiter Epoll::registerWaiter(const ntca::WaiterOptions& waiterOptions)
             }
         }
 
+        if (!d_config.busyPollDuration().isNull()) {
+            result->d_busyPoll.setMaxDuration(
+                d_config.busyPollDuration().value());
+        }
+
         d_waiterSet.insert(result);
     }
 
@@ -1365,6 +2318,7 @@ void Epoll::deregisterWaiter(ntci::Waiter waiter)
     Epoll::Result* result = static_cast<Epoll::Result*>(waiter);
 
     bool nowEmpty = false;
+    bool orphaned = false;
 
     {
         LockGuard lockGuard(&d_waiterSetMutex);
@@ -1372,14 +2326,31 @@ void Epoll::deregisterWaiter(ntci::Waiter waiter)
         bsl::size_t n = d_waiterSet.erase(result);
         BSLS_ASSERT_OPT(n == 1);
 
+        if (result->d_deviceClaimed) {
+            d_claimedDevices.erase(bsl::find(d_claimedDevices.begin(),
+                                             d_claimedDevices.end(),
+                                             result->d_deviceIndex));
+
+            // The first device is claimed first by the next waiter to
+            // register, so sockets bound to it are not orphaned when the
+            // last waiter deregisters.
+
+            orphaned = !d_claimedDevices.empty() || result->d_deviceIndex != 0;
+        }
+
         if (d_waiterSet.empty()) {
             d_threadHandle = bslmt::ThreadUtil::invalidHandle();
             nowEmpty       = true;
         }
     }
 
+    if (orphaned) {
+        this->rebind(result->d_deviceIndex);
+    }
+
     if (nowEmpty) {
         this->flush();
+        this->flushUpdates();
         d_threadId.store(0);
     }
 
@@ -1409,13 +2380,17 @@ ntsa::Error Epoll::attachSocket(
     const bsl::shared_ptr<ntci::ReactorSocket>& socket)
 {
     bsl::shared_ptr<ntcs::RegistryEntry> entry = d_registry.add(socket);
-    return this->add(entry->handle(), entry->interest());
+    this->enableSocketBusyPoll(entry->handle());
+    return this->add(entry->handle(),
+                     entry->interest(),
+                     Epoll::isListener(socket));
 }
 
 ntsa::Error Epoll::attachSocket(ntsa::Handle handle)
 {
     bsl::shared_ptr<ntcs::RegistryEntry> entry = d_registry.add(handle);
-    return this->add(handle, entry->interest());
+    this->enableSocketBusyPoll(handle);
+    return this->add(handle, entry->interest(), this->isListener(handle));
 }
 
 ntsa::Error Epoll::showReadable(
@@ -1462,7 +2437,9 @@ ntsa::Error Epoll::showReadable(
 
             ntcs::Interest interest = entry->showReadable(options);
 
-            error = this->add(entry->handle(), interest);
+            error = this->add(entry->handle(),
+                              interest,
+                              Epoll::isListener(socket));
             if (error) {
                 return error;
             }
@@ -1523,7 +2500,8 @@ ntsa::Error Epoll::showReadable(ntsa::Handle                      handle,
             ntcs::Interest interest =
                 entry->showReadableCallback(options, callback);
 
-            error = this->add(handle, interest);
+            error =
+                this->add(handle, interest, this->isListener(handle));
             if (error) {
                 return error;
             }
@@ -1585,7 +2563,9 @@ ntsa::Error Epoll::showWritable(
 
             ntcs::Interest interest = entry->showWritable(options);
 
-            error = this->add(entry->handle(), interest);
+            error = this->add(entry->handle(),
+                              interest,
+                              Epoll::isListener(socket));
             if (error) {
                 return error;
             }
@@ -1646,7 +2626,8 @@ ntsa::Error Epoll::showWritable(ntsa::Handle                      handle,
             ntcs::Interest interest =
                 entry->showWritableCallback(options, callback);
 
-            error = this->add(handle, interest);
+            error =
+                this->add(handle, interest, this->isListener(handle));
             if (error) {
                 return error;
             }
@@ -1708,7 +2689,9 @@ ntsa::Error Epoll::showError(
 
             ntcs::Interest interest = entry->showError(options);
 
-            error = this->add(entry->handle(), interest);
+            error = this->add(entry->handle(),
+                              interest,
+                              Epoll::isListener(socket));
             if (error) {
                 return error;
             }
@@ -1769,7 +2752,8 @@ ntsa::Error Epoll::showError(ntsa::Handle                      handle,
             ntcs::Interest interest =
                 entry->showErrorCallback(options, callback);
 
-            error = this->add(handle, interest);
+            error =
+                this->add(handle, interest, this->isListener(handle));
             if (error) {
                 return error;
             }
@@ -1814,7 +2798,9 @@ ntsa::Error Epoll::showNotifications(
 
             ntcs::Interest interest = entry->showNotifications();
 
-            error = this->add(entry->handle(), interest);
+            error = this->add(entry->handle(),
+                              interest,
+                              Epoll::isListener(socket));
             if (error) {
                 return error;
             }
@@ -1859,7 +2845,8 @@ ntsa::Error Epoll::showNotifications(
             ntcs::Interest interest =
                 entry->showNotificationsCallback(callback);
 
-            error = this->add(handle, interest);
+            error =
+                this->add(handle, interest, this->isListener(handle));
             if (error) {
                 return error;
             }
@@ -2156,67 +3143,20 @@ void Epoll::run(ntci::Waiter waiter)
     NTCS_METRICS_GET();
 
     while (d_run) {
-        int wait = -1;
-
-#if NTCO_EPOLL_USE_TIMERFD
-
-        if (NTCCFG_LIKELY(d_config.maxThreads().value() == 1)) {
-            bdlb::NullableValue<bsls::TimeInterval> earliestTimerDue =
-                d_chronology.earliest();
-
-            if (!earliestTimerDue.isNull()) {
-                if (earliestTimerDue.value() == bsls::TimeInterval()) {
-                    wait = 0;
-                    NTCO_EPOLL_LOG_WAIT_TIMED(wait);
-                }
-                else {
-                    NTCO_EPOLL_LOG_WAIT_TIMED_HIGH_PRECISION(
-                        earliestTimerDue.value());
-
-                    if (earliestTimerDue != result->d_earliestTimerDue ||
-                        !d_timerPending)
-                    {
-                        ntsa::Error error =
-                            this->setTimer(earliestTimerDue.value());
-                        if (error) {
-                            NTCO_EPOLL_LOG_TIMER_SET_FAILURE(error);
-                        }
-                        else {
-                            result->d_earliestTimerDue = earliestTimerDue;
-                        }
-                    }
-                }
-            }
-            else {
-                NTCO_EPOLL_LOG_WAIT_INDEFINITE();
-            }
-        }
-        else {
-            int timeout = d_chronology.timeoutInMilliseconds();
+        this->flushUpdates();
 
-            if (timeout >= 0) {
-                NTCO_EPOLL_LOG_WAIT_TIMED(timeout);
-                wait = timeout;
-            }
-            else {
-                NTCO_EPOLL_LOG_WAIT_INDEFINITE();
-            }
-        }
+        this->prepareToSleep(result);
 
-#else
+        bdlb::NullableValue<bsls::TimeInterval> timeout;
+        this->computeTimeout(&timeout, result);
 
-        int timeout = d_chronology.timeoutInMilliseconds();
+        // Re-check whether the reactor has been stopped, since the thread
+        // stopping it only interrupts waiters already about to sleep.
 
-        if (timeout >= 0) {
-            NTCO_EPOLL_LOG_WAIT_TIMED(timeout);
-            wait = timeout;
-        }
-        else {
-            NTCO_EPOLL_LOG_WAIT_INDEFINITE();
+        if (NTCCFG_UNLIKELY(!d_run)) {
+            timeout.makeValue(bsls::TimeInterval());
         }
 
-#endif
-
         // Note: it is possible to perform an optimization where no actual wait
         // is required if it is determine that an instantenous poll is desired
         // but there are no sockets registered. This optimization is currently
@@ -2224,8 +3164,8 @@ void Epoll::run(ntci::Waiter waiter)
         // registered in typical usage, and it is undesirable to incur the cost
         // of learning that no sockets are registered.
         //
-        // if (wait == 0 && this->numSockets() == 0) {
-        //     NTCO_EPOLL_LOG_WAIT_TIMEOUT();
+        // if (timeout == bsls::TimeInterval() && this->numSockets() == 0) {
+        //     NTCO_EPOLL_LOG_WAIT_TIMEOUT(result->d_device);
         //     NTCS_METRICS_UPDATE_POLL(0, 0, 0);
         //     return ntsa::Error();
         // }
@@ -2233,10 +3173,12 @@ void Epoll::run(ntci::Waiter waiter)
         enum { MAX_EVENTS = 128 };
         struct ::epoll_event results[MAX_EVENTS];
 
-        rc = ::epoll_wait(d_epoll, results, MAX_EVENTS, wait);
+        rc = this->wait(result, results, MAX_EVENTS, timeout);
 
         if (NTCCFG_LIKELY(rc > 0)) {
-            NTCO_EPOLL_LOG_WAIT_RESULT_OR_TIMEOUT(rc, results);
+            NTCO_EPOLL_LOG_WAIT_RESULT_OR_TIMEOUT(result->d_device,
+                                                  rc,
+                                                  results);
 
             const int numResults = rc;
 
@@ -2251,8 +3193,6 @@ void Epoll::run(ntci::Waiter waiter)
 
                 BSLS_ASSERT(e.events != 0);
 
-#if NTCO_EPOLL_USE_TIMERFD
-
                 if (NTCCFG_UNLIKELY(e.data.fd == d_timer)) {
                     ntsa::Error error = this->ackTimer(&numTimers);
                     if (error) {
@@ -2261,8 +3201,6 @@ void Epoll::run(ntci::Waiter waiter)
                     continue;
                 }
 
-#endif
-
                 const ntsa::Handle descriptorHandle = e.data.fd;
                 BSLS_ASSERT(descriptorHandle != ntsa::k_INVALID_HANDLE);
 
@@ -2407,7 +3345,7 @@ void Epoll::run(ntci::Waiter waiter)
             }
         }
         else if (NTCCFG_UNLIKELY(rc == 0)) {
-            NTCO_EPOLL_LOG_WAIT_TIMEOUT();
+            NTCO_EPOLL_LOG_WAIT_TIMEOUT(result->d_device);
             NTCS_METRICS_UPDATE_POLL(0, 0, 0);
         }
         else if (NTCCFG_UNLIKELY(rc < 0)) {
@@ -2422,7 +3360,7 @@ void Epoll::run(ntci::Waiter waiter)
             }
             else {
                 ntsa::Error error(errno);
-                NTCO_EPOLL_LOG_WAIT_FAILURE(error);
+                NTCO_EPOLL_LOG_WAIT_FAILURE(result->d_device, error);
             }
         }
 
@@ -2455,66 +3393,12 @@ void Epoll::poll(ntci::Waiter waiter)
 
     NTCS_METRICS_GET();
 
-    int wait = -1;
-
-#if NTCO_EPOLL_USE_TIMERFD
-
-    if (NTCCFG_LIKELY(d_config.maxThreads().value() == 1)) {
-        bdlb::NullableValue<bsls::TimeInterval> earliestTimerDue =
-            d_chronology.earliest();
-
-        if (!earliestTimerDue.isNull()) {
-            if (earliestTimerDue.value() == bsls::TimeInterval()) {
-                wait = 0;
-                NTCO_EPOLL_LOG_WAIT_TIMED(wait);
-            }
-            else {
-                NTCO_EPOLL_LOG_WAIT_TIMED_HIGH_PRECISION(
-                    earliestTimerDue.value());
-
-                if (earliestTimerDue != result->d_earliestTimerDue ||
-                    !d_timerPending)
-                {
-                    ntsa::Error error =
-                        this->setTimer(earliestTimerDue.value());
-                    if (error) {
-                        NTCO_EPOLL_LOG_TIMER_SET_FAILURE(error);
-                    }
-                    else {
-                        result->d_earliestTimerDue = earliestTimerDue;
-                    }
-                }
-            }
-        }
-        else {
-            NTCO_EPOLL_LOG_WAIT_INDEFINITE();
-        }
-    }
-    else {
-        int timeout = d_chronology.timeoutInMilliseconds();
-
-        if (timeout >= 0) {
-            NTCO_EPOLL_LOG_WAIT_TIMED(timeout);
-            wait = timeout;
-        }
-        else {
-            NTCO_EPOLL_LOG_WAIT_INDEFINITE();
-        }
-    }
+    this->flushUpdates();
 
-#else
-
-    int timeout = d_chronology.timeoutInMilliseconds();
-
-    if (timeout >= 0) {
-        NTCO_EPOLL_LOG_WAIT_TIMED(timeout);
-        wait = timeout;
-    }
-    else {
-        NTCO_EPOLL_LOG_WAIT_INDEFINITE();
-    }
+    this->prepareToSleep(result);
 
-#endif
+    bdlb::NullableValue<bsls::TimeInterval> timeout;
+    this->computeTimeout(&timeout, result);
 
     // Note: it is possible to perform an optimization where no actual wait
     // is required if it is determine that an instantenous poll is desired
@@ -2523,8 +3407,8 @@ void Epoll::poll(ntci::Waiter waiter)
     // in typical usage, and it is undesirable to incur the cost of learning
     // that no sockets are registered.
     //
-    // if (wait == 0 && this->numSockets() == 0) {
-    //     NTCO_EPOLL_LOG_WAIT_TIMEOUT();
+    // if (timeout == bsls::TimeInterval() && this->numSockets() == 0) {
+    //     NTCO_EPOLL_LOG_WAIT_TIMEOUT(result->d_device);
     //     NTCS_METRICS_UPDATE_POLL(0, 0, 0);
     //     return ntsa::Error();
     // }
@@ -2532,10 +3416,10 @@ void Epoll::poll(ntci::Waiter waiter)
     enum { MAX_EVENTS = 128 };
     struct ::epoll_event results[MAX_EVENTS];
 
-    rc = ::epoll_wait(d_epoll, results, MAX_EVENTS, wait);
+    rc = this->wait(result, results, MAX_EVENTS, timeout);
 
     if (NTCCFG_LIKELY(rc > 0)) {
-        NTCO_EPOLL_LOG_WAIT_RESULT_OR_TIMEOUT(rc, results);
+        NTCO_EPOLL_LOG_WAIT_RESULT_OR_TIMEOUT(result->d_device, rc, results);
 
         const int numResults = rc;
 
@@ -2550,8 +3434,6 @@ void Epoll::poll(ntci::Waiter waiter)
 
             BSLS_ASSERT(e.events != 0);
 
-#if NTCO_EPOLL_USE_TIMERFD
-
             if (NTCCFG_UNLIKELY(e.data.fd == d_timer)) {
                 ntsa::Error error = this->ackTimer(&numTimers);
                 if (error) {
@@ -2560,8 +3442,6 @@ void Epoll::poll(ntci::Waiter waiter)
                 continue;
             }
 
-#endif
-
             ntsa::Handle descriptorHandle = e.data.fd;
             BSLS_ASSERT(descriptorHandle != ntsa::k_INVALID_HANDLE);
 
@@ -2698,7 +3578,7 @@ void Epoll::poll(ntci::Waiter waiter)
         }
     }
     else if (NTCCFG_UNLIKELY(rc == 0)) {
-        NTCO_EPOLL_LOG_WAIT_TIMEOUT();
+        NTCO_EPOLL_LOG_WAIT_TIMEOUT(result->d_device);
         NTCS_METRICS_UPDATE_POLL(0, 0, 0);
     }
     else if (NTCCFG_UNLIKELY(rc < 0)) {
@@ -2713,7 +3593,7 @@ void Epoll::poll(ntci::Waiter waiter)
         }
         else {
             ntsa::Error error(errno);
-            NTCO_EPOLL_LOG_WAIT_FAILURE(error);
+            NTCO_EPOLL_LOG_WAIT_FAILURE(result->d_device, error);
         }
     }
 
@@ -2738,6 +3618,13 @@ void Epoll::interruptOne()
         return;
     }
 
+    // Waiters that are running observe new work before they next wait, so
+    // only interrupt a waiter if any waiter is about to sleep or sleeping.
+
+    if (NTCCFG_LIKELY(d_numSleepers.load() == 0)) {
+        return;
+    }
+
     ntsa::Error error = d_controller_sp->interrupt(1);
     if (NTCCFG_UNLIKELY(error)) {
         reinitializeControl();
@@ -2751,21 +3638,23 @@ void Epoll::interruptAll()
             return;
         }
 
+        if (NTCCFG_LIKELY(d_numSleepers.load() == 0)) {
+            return;
+        }
+
         ntsa::Error error = d_controller_sp->interrupt(1);
         if (NTCCFG_UNLIKELY(error)) {
             reinitializeControl();
         }
     }
     else {
-        unsigned int numWaiters;
-        {
-            LockGuard lock(&d_waiterSetMutex);
-            numWaiters =
-                NTCCFG_WARNING_NARROW(unsigned int, d_waiterSet.size());
-        }
+        // Only interrupt the waiters that are about to sleep or sleeping:
+        // waiters that are running observe new work before they next wait.
+
+        const unsigned int numSleepers = d_numSleepers.load();
 
-        if (NTCCFG_LIKELY(numWaiters > 0)) {
-            ntsa::Error error = d_controller_sp->interrupt(numWaiters);
+        if (NTCCFG_LIKELY(numSleepers > 0)) {
+            ntsa::Error error = d_controller_sp->interrupt(numSleepers);
             if (NTCCFG_UNLIKELY(error)) {
                 reinitializeControl();
             }
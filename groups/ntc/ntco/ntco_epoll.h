@@ -40,6 +40,12 @@ namespace ntco {
 /// This class implements the 'ntci::ReactorFactory' interface to produce
 /// reactors implemented using the "epoll" API.
 ///
+/// Waits for events are timed using 'epoll_pwait2', if supported by the
+/// kernel, otherwise using a timer file descriptor, for reactors limited to
+/// a single thread, otherwise using a timeout in milliseconds. Setting the
+/// environment variable 'NTCO_EPOLL_PWAIT2' or 'NTCO_EPOLL_TIMERFD' to
+/// false disables the respective mechanism in reactors created thereafter.
+///
 /// @par Thread Safety
 /// This class is thread safe.
 ///
@@ -32,18 +32,25 @@
 #include <bdlf_placeholder.h>
 #include <bdlma_concurrentmultipoolallocator.h>
 #include <bdlmt_eventscheduler.h>
+#include <bdlt_currenttime.h>
 #include <bslma_testallocator.h>
 #include <bslmt_barrier.h>
 #include <bslmt_latch.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
 #include <bslmt_semaphore.h>
 #include <bslmt_threadgroup.h>
 #include <bslmt_threadutil.h>
 #include <bslmt_turnstile.h>
+#include <bsls_atomic.h>
 #include <bsls_stopwatch.h>
 #include <bsls_timeinterval.h>
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
 #include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+
+#include <stdlib.h>
 
 using namespace BloombergLP;
 
@@ -1195,11 +1202,939 @@ NTCCFG_TEST_CASE(3)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+namespace test {
+namespace case4 {
+
+/// Describe a variation of the mechanism used to time waits.
+struct Variation {
+    const char* d_name;
+    bool        d_pwait2;
+    bool        d_timerfd;
+    bsl::size_t d_maxThreads;
+};
+
+void processTimer(bsl::vector<bsl::size_t>*           order,
+                  bsl::size_t                         index,
+                  bslmt::Latch*                       latch,
+                  const bsl::shared_ptr<ntci::Timer>& timer,
+                  const ntca::TimerEvent&             event)
+{
+    NTCCFG_WARNING_UNUSED(timer);
+
+    NTCCFG_TEST_EQ(event.type(), ntca::TimerEventType::e_DEADLINE);
+
+    // Ensure the timer did not fire before its deadline, regardless of the
+    // resolution of the mechanism used to time the wait.
+
+    bsls::TimeInterval now = bdlt::CurrentTime::now();
+    NTCCFG_TEST_GE(now, event.context().deadline());
+
+    NTCCFG_TEST_LOG_DEBUG << "Timer " << index << " drifted "
+                          << ntcd::DataUtil::formatMicroseconds(
+                                 event.context().drift().totalMicroseconds())
+                          << NTCCFG_TEST_LOG_END;
+
+    order->push_back(index);
+    latch->arrive();
+}
+
+void execute(const Variation& variation, bslma::Allocator* allocator)
+{
+    NTCCFG_TEST_LOG_DEBUG << "Testing timer mode " << variation.d_name
+                          << " with " << variation.d_maxThreads
+                          << " maximum threads" << NTCCFG_TEST_LOG_END;
+
+    enum { k_NUM_TIMERS = 8 };
+
+    // Create the user.
+
+    bsl::shared_ptr<ntci::User> user;
+
+    // Create the reactor, selecting the mechanism used to time waits
+    // through the environment, which is consulted when the reactor is
+    // constructed.
+
+    ntca::ReactorConfig reactorConfig;
+
+    reactorConfig.setMetricName("test");
+    reactorConfig.setMinThreads(1);
+    reactorConfig.setMaxThreads(variation.d_maxThreads);
+
+    ::setenv("NTCO_EPOLL_PWAIT2", variation.d_pwait2 ? "1" : "0", 1);
+    ::setenv("NTCO_EPOLL_TIMERFD", variation.d_timerfd ? "1" : "0", 1);
+
+    bsl::shared_ptr<ntco::EpollFactory> reactorFactory;
+    reactorFactory.createInplace(allocator, allocator);
+
+    bsl::shared_ptr<ntci::Reactor> reactor =
+        reactorFactory->createReactor(reactorConfig, user, allocator);
+
+    ::unsetenv("NTCO_EPOLL_PWAIT2");
+    ::unsetenv("NTCO_EPOLL_TIMERFD");
+
+    // Register this thread as a thread that will wait on the reactor.
+
+    ntci::Waiter waiter = reactor->registerWaiter(ntca::WaiterOptions());
+
+    // Schedule timers whose deadlines are separated by less than a
+    // millisecond, in the reverse order of their deadlines.
+
+    ntca::TimerOptions timerOptions;
+    timerOptions.setOneShot(true);
+    timerOptions.showEvent(ntca::TimerEventType::e_DEADLINE);
+    timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
+    timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
+
+    bsl::vector<bsl::size_t> order(allocator);
+    bslmt::Latch             latch(k_NUM_TIMERS);
+
+    bsl::vector<bsl::shared_ptr<ntci::Timer> > timers(allocator);
+
+    bsls::TimeInterval now = bdlt::CurrentTime::now();
+
+    for (bsl::size_t i = 0; i < k_NUM_TIMERS; ++i) {
+        bsl::size_t index = k_NUM_TIMERS - i - 1;
+
+        ntci::TimerCallback timerCallback(
+            NTCCFG_BIND(&processTimer,
+                        &order,
+                        index,
+                        &latch,
+                        NTCCFG_BIND_PLACEHOLDER_1,
+                        NTCCFG_BIND_PLACEHOLDER_2),
+            allocator);
+
+        bsl::shared_ptr<ntci::Timer> timer =
+            reactor->createTimer(timerOptions, timerCallback, allocator);
+
+        bsls::TimeInterval deadline = now;
+        deadline.addMilliseconds(5);
+        deadline.addMicroseconds(static_cast<bsls::Types::Int64>(index * 250));
+
+        ntsa::Error error = timer->schedule(deadline);
+        NTCCFG_TEST_OK(error);
+
+        timers.push_back(timer);
+    }
+
+    // Wait for all the timers to fire.
+
+    while (!latch.tryWait()) {
+        reactor->poll(waiter);
+    }
+
+    // Ensure the timers fired in the order of their deadlines.
+
+    NTCCFG_TEST_EQ(order.size(), k_NUM_TIMERS);
+    for (bsl::size_t i = 0; i < order.size(); ++i) {
+        NTCCFG_TEST_EQ(order[i], i);
+    }
+
+    timers.clear();
+
+    // Deregister the waiter.
+
+    reactor->deregisterWaiter(waiter);
+}
+
+}  // close namespace case4
+}  // close namespace test
+
+NTCCFG_TEST_CASE(4)
+{
+    // Concern: Timers fire no earlier than their deadlines, and in the
+    // order of their deadlines, when waits are timed using 'epoll_pwait2',
+    // a timer file descriptor, or millisecond timeouts, for both single-
+    // and multi-threaded reactors.
+
+    NTCI_LOG_CONTEXT();
+    NTCI_LOG_CONTEXT_GUARD_OWNER("test");
+
+    const test::case4::Variation k_DATA[] = {
+        {"pwait2", true, true, 1},
+        {"pwait2", true, true, 2},
+        {"timerfd", false, true, 1},
+        {"timerfd", false, true, 2},
+        {"milliseconds", false, false, 1},
+        {"milliseconds", false, false, 2}
+    };
+
+    enum { k_NUM_DATA = sizeof k_DATA / sizeof *k_DATA };
+
+    for (bsl::size_t i = 0; i < k_NUM_DATA; ++i) {
+        ntccfg::TestAllocator ta;
+        {
+            test::case4::execute(k_DATA[i], &ta);
+        }
+        NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+    }
+}
+
+namespace test {
+namespace case5 {
+
+void processFunction(bslmt::Latch* latch)
+{
+    latch->arrive();
+}
+
+void processTimer(bslmt::Latch*                       latch,
+                  const bsl::shared_ptr<ntci::Timer>& timer,
+                  const ntca::TimerEvent&             event)
+{
+    NTCCFG_WARNING_UNUSED(timer);
+
+    NTCCFG_TEST_EQ(event.type(), ntca::TimerEventType::e_DEADLINE);
+
+    latch->arrive();
+}
+
+void runReactor(const bsl::shared_ptr<ntci::Reactor>& reactor,
+                bslmt::Barrier*                       barrier,
+                bsl::size_t                           threadIndex)
+{
+    NTCI_LOG_CONTEXT();
+    NTCI_LOG_CONTEXT_GUARD_OWNER("test");
+    NTCI_LOG_CONTEXT_GUARD_THREAD(threadIndex);
+
+    // Register this thread as a thread that will wait on the reactor.
+
+    ntci::Waiter waiter = reactor->registerWaiter(ntca::WaiterOptions());
+
+    // Wait until all threads have reached the rendezvous point.
+
+    barrier->wait();
+
+    // Wait for events until the reactor is stopped.
+
+    reactor->run(waiter);
+
+    // Deregister the waiter.
+
+    reactor->deregisterWaiter(waiter);
+}
+
+void execute(bsl::size_t numThreads, bslma::Allocator* allocator)
+{
+    NTCCFG_TEST_LOG_DEBUG << "Testing interruption of " << numThreads
+                          << " waiters" << NTCCFG_TEST_LOG_END;
+
+    enum { k_NUM_ITERATIONS = 100 };
+
+    // Create the user.
+
+    bsl::shared_ptr<ntci::User> user;
+
+    // Create the reactor.
+
+    ntca::ReactorConfig reactorConfig;
+
+    reactorConfig.setMetricName("test");
+    reactorConfig.setMinThreads(numThreads);
+    reactorConfig.setMaxThreads(numThreads);
+
+    bsl::shared_ptr<ntco::EpollFactory> reactorFactory;
+    reactorFactory.createInplace(allocator, allocator);
+
+    bsl::shared_ptr<ntci::Reactor> reactor =
+        reactorFactory->createReactor(reactorConfig, user, allocator);
+
+    // Run the waiters in separate threads, so that this thread is never a
+    // waiter and must interrupt the waiters to have its work performed.
+
+    bslmt::Barrier barrier(numThreads + 1);
+
+    bslmt::ThreadGroup threadGroup(allocator);
+
+    for (bsl::size_t threadIndex = 0; threadIndex < numThreads;
+         ++threadIndex)
+    {
+        threadGroup.addThread(
+            NTCCFG_BIND(&runReactor, reactor, &barrier, threadIndex));
+    }
+
+    barrier.wait();
+
+    ntca::TimerOptions timerOptions;
+    timerOptions.setOneShot(true);
+    timerOptions.showEvent(ntca::TimerEventType::e_DEADLINE);
+    timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
+    timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
+
+    for (bsl::size_t iteration = 0; iteration < k_NUM_ITERATIONS;
+         ++iteration)
+    {
+        // Periodically give the waiters time to fall asleep waiting
+        // indefinitely, otherwise race with the waiters as they go to
+        // sleep after performing the previous work.
+
+        if (iteration % 10 == 0) {
+            bslmt::ThreadUtil::microSleep(10000);
+        }
+
+        // Defer a function to execute and wait for a waiter to execute it.
+
+        {
+            bslmt::Latch latch(1);
+            reactor->execute(NTCCFG_BIND(&processFunction, &latch));
+            latch.wait();
+        }
+
+        if (iteration % 10 == 5) {
+            bslmt::ThreadUtil::microSleep(10000);
+        }
+
+        // Schedule a timer and wait for a waiter to fire it. No other timer
+        // is scheduled, so any sleeping waiter is waiting indefinitely and
+        // must be interrupted to learn of the timer's deadline.
+
+        {
+            bslmt::Latch latch(1);
+
+            ntci::TimerCallback timerCallback(
+                NTCCFG_BIND(&processTimer,
+                            &latch,
+                            NTCCFG_BIND_PLACEHOLDER_1,
+                            NTCCFG_BIND_PLACEHOLDER_2),
+                allocator);
+
+            bsl::shared_ptr<ntci::Timer> timer =
+                reactor->createTimer(timerOptions, timerCallback, allocator);
+
+            bsls::TimeInterval deadline = bdlt::CurrentTime::now();
+            deadline.addMilliseconds(1);
+
+            ntsa::Error error = timer->schedule(deadline);
+            NTCCFG_TEST_OK(error);
+
+            latch.wait();
+        }
+    }
+
+    // Stop the reactor and join the waiters.
+
+    reactor->stop();
+
+    threadGroup.joinAll();
+}
+
+}  // close namespace case5
+}  // close namespace test
+
+NTCCFG_TEST_CASE(5)
+{
+    // Concern: Functions deferred and timers scheduled by a thread that is
+    // not a waiter wake the waiters sleeping in other threads, including
+    // waiters sleeping indefinitely.
+
+    NTCI_LOG_CONTEXT();
+    NTCI_LOG_CONTEXT_GUARD_OWNER("test");
+
+    for (bsl::size_t numThreads = 1; numThreads <= 2; ++numThreads) {
+        ntccfg::TestAllocator ta;
+        {
+            test::case5::execute(numThreads, &ta);
+        }
+        NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+    }
+}
+
+namespace test {
+namespace case6 {
+
+ntsa::Error processEvent(bsl::size_t*              counter,
+                         const ntca::ReactorEvent& event)
+{
+    NTCCFG_WARNING_UNUSED(event);
+
+    ++(*counter);
+    return ntsa::Error();
+}
+
+void processFunction(bool* flag)
+{
+    *flag = true;
+}
+
+void showReadable(const bsl::shared_ptr<ntci::Reactor>& reactor,
+                  ntsa::Handle                          handle,
+                  bsl::size_t*                          counter)
+{
+    reactor->showReadable(
+        handle,
+        ntca::ReactorEventOptions(),
+        ntci::ReactorEventCallback(NTCCFG_BIND(
+            &processEvent, counter, NTCCFG_BIND_PLACEHOLDER_1)));
+}
+
+void showWritable(const bsl::shared_ptr<ntci::Reactor>& reactor,
+                  ntsa::Handle                          handle,
+                  bsl::size_t*                          counter)
+{
+    reactor->showWritable(
+        handle,
+        ntca::ReactorEventOptions(),
+        ntci::ReactorEventCallback(NTCCFG_BIND(
+            &processEvent, counter, NTCCFG_BIND_PLACEHOLDER_1)));
+}
+
+void settle(const bsl::shared_ptr<ntci::Reactor>& reactor,
+            ntci::Waiter                          waiter)
+{
+    // Defer a function and poll until it is executed, so that the device
+    // is polled at least once, instantaneously, after all changes to
+    // interest made before this call have been applied.
+
+    bool flag = false;
+    reactor->execute(NTCCFG_BIND(&processFunction, &flag));
+
+    while (!flag) {
+        reactor->poll(waiter);
+    }
+}
+
+void execute(bslma::Allocator* allocator)
+{
+    ntsa::Error error;
+
+    bsl::size_t numReadable = 0;
+    bsl::size_t numWritable = 0;
+
+    // Create the user.
+
+    bsl::shared_ptr<ntci::User> user;
+
+    // Create the reactor, deferring changes to interest made by the waiter.
+
+    ntca::ReactorConfig reactorConfig;
+
+    reactorConfig.setMetricName("test");
+    reactorConfig.setMinThreads(1);
+    reactorConfig.setMaxThreads(1);
+    reactorConfig.setAutoAttach(false);
+    reactorConfig.setAutoDetach(false);
+    reactorConfig.setDeferInterestChanges(true);
+
+    bsl::shared_ptr<ntco::EpollFactory> reactorFactory;
+    reactorFactory.createInplace(allocator, allocator);
+
+    bsl::shared_ptr<ntci::Reactor> reactor =
+        reactorFactory->createReactor(reactorConfig, user, allocator);
+
+    // Register this thread as the thread that will wait on the reactor, so
+    // that changes to interest made by this thread are deferred.
+
+    ntci::Waiter waiter = reactor->registerWaiter(ntca::WaiterOptions());
+
+    // Create a connected pair of non-blocking sockets and attach the server
+    // to the reactor.
+
+    bsl::shared_ptr<ntsi::StreamSocket> client;
+    bsl::shared_ptr<ntsi::StreamSocket> server;
+
+    error = ntsf::System::createStreamSocketPair(
+        &client,
+        &server,
+        ntsa::Transport::e_TCP_IPV4_STREAM,
+        allocator);
+    NTCCFG_TEST_OK(error);
+
+    error = client->setBlocking(false);
+    NTCCFG_TEST_OK(error);
+
+    error = server->setBlocking(false);
+    NTCCFG_TEST_OK(error);
+
+    error = reactor->attachSocket(server->handle());
+    NTCCFG_TEST_OK(error);
+
+    // Send a single byte to the server, so that it is readable as well as
+    // writable for the remainder of the test.
+
+    {
+        char buffer = 'X';
+
+        ntsa::SendContext context;
+        ntsa::SendOptions options;
+
+        ntsa::Data data(ntsa::ConstBuffer(&buffer, 1));
+
+        error = client->send(&context, data, options);
+        NTCCFG_TEST_OK(error);
+        NTCCFG_TEST_EQ(context.bytesSent(), 1);
+    }
+
+    // Change the interest in the server several times before the next
+    // wait, ending interested only in readability. Ensure only the final
+    // interest is applied to the device.
+
+    showReadable(reactor, server->handle(), &numReadable);
+    showWritable(reactor, server->handle(), &numWritable);
+    reactor->hideReadable(server->handle());
+    showReadable(reactor, server->handle(), &numReadable);
+    reactor->hideWritable(server->handle());
+
+    while (numReadable == 0) {
+        reactor->poll(waiter);
+    }
+
+    NTCCFG_TEST_EQ(numWritable, 0);
+
+    // Change the interest in the server several times before the next
+    // wait, ending interested only in writability.
+
+    reactor->hideReadable(server->handle());
+    showWritable(reactor, server->handle(), &numWritable);
+    reactor->hideWritable(server->handle());
+    showWritable(reactor, server->handle(), &numWritable);
+
+    numReadable = 0;
+
+    while (numWritable == 0) {
+        reactor->poll(waiter);
+    }
+
+    NTCCFG_TEST_EQ(numReadable, 0);
+
+    // Lose interest in the server entirely, after briefly becoming
+    // interested in its readability. Ensure no events are announced.
+
+    showReadable(reactor, server->handle(), &numReadable);
+    reactor->hideReadable(server->handle());
+    reactor->hideWritable(server->handle());
+
+    numReadable = 0;
+    numWritable = 0;
+
+    settle(reactor, waiter);
+
+    NTCCFG_TEST_EQ(numReadable, 0);
+    NTCCFG_TEST_EQ(numWritable, 0);
+
+    // Become interested in the readability of the server from a thread
+    // other than the waiter, whose changes are applied immediately.
+
+    {
+        bslmt::ThreadGroup threadGroup(allocator);
+        threadGroup.addThread(NTCCFG_BIND(
+            &showReadable, reactor, server->handle(), &numReadable));
+        threadGroup.joinAll();
+    }
+
+    while (numReadable == 0) {
+        reactor->poll(waiter);
+    }
+
+    NTCCFG_TEST_EQ(numWritable, 0);
+
+    // Detach the server while a change to its interest is deferred, and
+    // ensure the deferred change is discarded.
+
+    reactor->hideReadable(server->handle());
+
+    error = reactor->detachSocket(server->handle());
+    NTCCFG_TEST_OK(error);
+
+    numReadable = 0;
+
+    settle(reactor, waiter);
+
+    NTCCFG_TEST_EQ(numReadable, 0);
+    NTCCFG_TEST_EQ(reactor->numSockets(), 0);
+
+    // Deregister the waiter.
+
+    reactor->deregisterWaiter(waiter);
+}
+
+}  // close namespace case6
+}  // close namespace test
+
+NTCCFG_TEST_CASE(6)
+{
+    // Concern: Changes to interest made by the waiter of a single-threaded
+    // reactor that defers such changes are applied before the next wait,
+    // with only the last change to each socket taking effect, and changes
+    // made by other threads are applied immediately.
+
+    NTCI_LOG_CONTEXT();
+    NTCI_LOG_CONTEXT_GUARD_OWNER("test");
+
+    ntccfg::TestAllocator ta;
+    {
+        test::case6::execute(&ta);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+namespace test {
+namespace case7 {
+
+/// Describe the state shared between the waiters and the test driver.
+struct State {
+    explicit State(bslma::Allocator* basicAllocator)
+    : d_mutex()
+    , d_listener_sp()
+    , d_servers(basicAllocator)
+    , d_numAccepted(0)
+    , d_numReceived(0)
+    , d_stop(false)
+    , d_stopped(false)
+    , d_allocator_p(basicAllocator)
+    {
+    }
+
+    bslmt::Mutex                                      d_mutex;
+    bsl::shared_ptr<ntsi::ListenerSocket>             d_listener_sp;
+    bsl::vector<bsl::shared_ptr<ntsi::StreamSocket> > d_servers;
+    bsls::AtomicUint                                  d_numAccepted;
+    bsls::AtomicUint                                  d_numReceived;
+    bsls::AtomicBool                                  d_stop;
+    bsls::AtomicBool                                  d_stopped;
+    bslma::Allocator*                                 d_allocator_p;
+};
+
+ntsa::Error processAcceptable(State*                    state,
+                              const ntca::ReactorEvent& event)
+{
+    NTCCFG_WARNING_UNUSED(event);
+
+    // Only one waiter is woken up per incoming connection, but another
+    // waiter may concurrently accept the same connection, so accept until
+    // the backlog is empty.
+
+    while (true) {
+        bsl::shared_ptr<ntsi::StreamSocket> server;
+        ntsa::Error error =
+            state->d_listener_sp->accept(&server, state->d_allocator_p);
+        if (error) {
+            NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+            break;
+        }
+
+        error = server->setBlocking(false);
+        NTCCFG_TEST_OK(error);
+
+        {
+            bslmt::LockGuard<bslmt::Mutex> lock(&state->d_mutex);
+            state->d_servers.push_back(server);
+        }
+
+        ++state->d_numAccepted;
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error processReadable(State*                    state,
+                            ntsi::StreamSocket*       server,
+                            const ntca::ReactorEvent& event)
+{
+    NTCCFG_WARNING_UNUSED(event);
+
+    char buffer;
+
+    ntsa::ReceiveContext context;
+    ntsa::ReceiveOptions options;
+
+    ntsa::Data data(ntsa::MutableBuffer(&buffer, 1));
+
+    ntsa::Error error = server->receive(&context, &data, options);
+    if (!error) {
+        NTCCFG_TEST_EQ(context.bytesReceived(), 1);
+        NTCCFG_TEST_EQ(buffer, 'X');
+        ++state->d_numReceived;
+    }
+
+    return ntsa::Error();
+}
+
+void pollReactor(const bsl::shared_ptr<ntci::Reactor>& reactor,
+                 bslmt::Barrier*                       barrier,
+                 State*                                state)
+{
+    NTCI_LOG_CONTEXT();
+    NTCI_LOG_CONTEXT_GUARD_OWNER("test");
+    NTCI_LOG_CONTEXT_GUARD_THREAD(1);
+
+    // Register this thread as a thread that will wait on the reactor.
+
+    ntci::Waiter waiter = reactor->registerWaiter(ntca::WaiterOptions());
+
+    // Wait until all threads have reached the rendezvous point.
+
+    barrier->wait();
+
+    // Wait for events until told to stop, while the other waiter keeps
+    // waiting.
+
+    while (!state->d_stop) {
+        reactor->poll(waiter);
+    }
+
+    // Deregister the waiter.
+
+    reactor->deregisterWaiter(waiter);
+
+    state->d_stopped = true;
+}
+
+void waitFor(const bsls::AtomicUint& counter, bsl::size_t value)
+{
+    while (counter < value) {
+        bslmt::ThreadUtil::microSleep(1000);
+    }
+}
+
+void connectClient(
+    bsl::vector<bsl::shared_ptr<ntsi::StreamSocket> >* clients,
+    const ntsa::Endpoint&                               endpoint,
+    bslma::Allocator*                                   allocator)
+{
+    bsl::shared_ptr<ntsi::StreamSocket> client =
+        ntsf::System::createStreamSocket(allocator);
+
+    ntsa::Error error = client->open(ntsa::Transport::e_TCP_IPV4_STREAM);
+    NTCCFG_TEST_OK(error);
+
+    error = client->connect(endpoint);
+    NTCCFG_TEST_OK(error);
+
+    clients->push_back(client);
+}
+
+void sendAll(const bsl::vector<bsl::shared_ptr<ntsi::StreamSocket> >& clients)
+{
+    for (bsl::size_t i = 0; i < clients.size(); ++i) {
+        char buffer = 'X';
+
+        ntsa::SendContext context;
+        ntsa::SendOptions options;
+
+        ntsa::Data data(ntsa::ConstBuffer(&buffer, 1));
+
+        ntsa::Error error = clients[i]->send(&context, data, options);
+        NTCCFG_TEST_OK(error);
+        NTCCFG_TEST_EQ(context.bytesSent(), 1);
+    }
+}
+
+void execute(bslma::Allocator* allocator)
+{
+    enum { k_NUM_CONNECTIONS = 8 };
+
+    ntsa::Error error;
+
+    State state(allocator);
+
+    // Create the user.
+
+    bsl::shared_ptr<ntci::User> user;
+
+    // Create the reactor, giving each of its two waiters its own device.
+
+    ntca::ReactorConfig reactorConfig;
+
+    reactorConfig.setMetricName("test");
+    reactorConfig.setMinThreads(2);
+    reactorConfig.setMaxThreads(2);
+    reactorConfig.setAutoAttach(false);
+    reactorConfig.setAutoDetach(false);
+    reactorConfig.setDevicePerWaiter(true);
+
+    bsl::shared_ptr<ntco::EpollFactory> reactorFactory;
+    reactorFactory.createInplace(allocator, allocator);
+
+    bsl::shared_ptr<ntci::Reactor> reactor =
+        reactorFactory->createReactor(reactorConfig, user, allocator);
+
+    // Run one waiter until the reactor is stopped, and another until it is
+    // told to stop, so that it may deregister while the first keeps
+    // waiting. Each waiter claims its own device.
+
+    bslmt::Barrier barrier(3);
+
+    bslmt::ThreadGroup runningThreadGroup(allocator);
+    runningThreadGroup.addThread(
+        NTCCFG_BIND(&test::case5::runReactor, reactor, &barrier, 0));
+
+    bslmt::ThreadGroup pollingThreadGroup(allocator);
+    pollingThreadGroup.addThread(
+        NTCCFG_BIND(&pollReactor, reactor, &barrier, &state));
+
+    barrier.wait();
+
+    // Create a listener, which is registered exclusively with every device,
+    // and become interested in its readability.
+
+    state.d_listener_sp = ntsf::System::createListenerSocket(allocator);
+
+    error = state.d_listener_sp->open(ntsa::Transport::e_TCP_IPV4_STREAM);
+    NTCCFG_TEST_OK(error);
+
+    error = state.d_listener_sp->setBlocking(false);
+    NTCCFG_TEST_OK(error);
+
+    error = state.d_listener_sp->bind(
+        ntsa::Endpoint(ntsa::Ipv4Address::loopback(), 0),
+        false);
+    NTCCFG_TEST_OK(error);
+
+    error = state.d_listener_sp->listen(k_NUM_CONNECTIONS * 2);
+    NTCCFG_TEST_OK(error);
+
+    ntsa::Endpoint listenerEndpoint;
+    error = state.d_listener_sp->sourceEndpoint(&listenerEndpoint);
+    NTCCFG_TEST_OK(error);
+
+    error = reactor->attachSocket(state.d_listener_sp->handle());
+    NTCCFG_TEST_OK(error);
+
+    error = reactor->showReadable(
+        state.d_listener_sp->handle(),
+        ntca::ReactorEventOptions(),
+        ntci::ReactorEventCallback(NTCCFG_BIND(
+            &processAcceptable, &state, NTCCFG_BIND_PLACEHOLDER_1)));
+    NTCCFG_TEST_OK(error);
+
+    // Connect clients to the listener and wait for every connection to be
+    // accepted by either waiter.
+
+    bsl::vector<bsl::shared_ptr<ntsi::StreamSocket> > clients(allocator);
+
+    for (bsl::size_t i = 0; i < k_NUM_CONNECTIONS; ++i) {
+        connectClient(&clients, listenerEndpoint, allocator);
+    }
+
+    waitFor(state.d_numAccepted, k_NUM_CONNECTIONS);
+
+    // Attach each accepted socket, binding the sockets to the devices of
+    // the waiters in round-robin order, and become interested in its
+    // readability.
+
+    bsl::vector<bsl::shared_ptr<ntsi::StreamSocket> > servers(allocator);
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&state.d_mutex);
+        servers = state.d_servers;
+    }
+
+    NTCCFG_TEST_EQ(servers.size(), k_NUM_CONNECTIONS);
+
+    for (bsl::size_t i = 0; i < servers.size(); ++i) {
+        error = reactor->attachSocket(servers[i]->handle());
+        NTCCFG_TEST_OK(error);
+
+        error = reactor->showReadable(
+            servers[i]->handle(),
+            ntca::ReactorEventOptions(),
+            ntci::ReactorEventCallback(
+                NTCCFG_BIND(&processReadable,
+                            &state,
+                            servers[i].get(),
+                            NTCCFG_BIND_PLACEHOLDER_1)));
+        NTCCFG_TEST_OK(error);
+    }
+
+    // Send a byte from each client and wait for each to be received.
+
+    sendAll(clients);
+
+    waitFor(state.d_numReceived, k_NUM_CONNECTIONS);
+
+    // Stop the second waiter and wait for it to deregister.
+
+    state.d_stop = true;
+
+    while (!state.d_stopped) {
+        reactor->interruptAll();
+        bslmt::ThreadUtil::microSleep(1000);
+    }
+
+    pollingThreadGroup.joinAll();
+
+    // Send another byte from each client and ensure each is still received,
+    // including those by sockets that were bound to the device of the
+    // waiter that deregistered.
+
+    sendAll(clients);
+
+    waitFor(state.d_numReceived, k_NUM_CONNECTIONS * 2);
+
+    // Ensure the remaining waiter still accepts connections.
+
+    connectClient(&clients, listenerEndpoint, allocator);
+
+    waitFor(state.d_numAccepted, k_NUM_CONNECTIONS + 1);
+
+    // Lose and regain interest in the readability of the listener, which
+    // removes its exclusive registration from every device and then adds
+    // it again, and ensure connections are still accepted.
+
+    error = reactor->hideReadable(state.d_listener_sp->handle());
+    NTCCFG_TEST_OK(error);
+
+    error = reactor->showReadable(
+        state.d_listener_sp->handle(),
+        ntca::ReactorEventOptions(),
+        ntci::ReactorEventCallback(NTCCFG_BIND(
+            &processAcceptable, &state, NTCCFG_BIND_PLACEHOLDER_1)));
+    NTCCFG_TEST_OK(error);
+
+    connectClient(&clients, listenerEndpoint, allocator);
+
+    waitFor(state.d_numAccepted, k_NUM_CONNECTIONS + 2);
+
+    // Detach all sockets, stop the reactor, and join the remaining waiter.
+
+    error = reactor->hideReadable(state.d_listener_sp->handle());
+    NTCCFG_TEST_OK(error);
+
+    error = reactor->detachSocket(state.d_listener_sp->handle());
+    NTCCFG_TEST_OK(error);
+
+    for (bsl::size_t i = 0; i < servers.size(); ++i) {
+        error = reactor->hideReadable(servers[i]->handle());
+        NTCCFG_TEST_OK(error);
+
+        error = reactor->detachSocket(servers[i]->handle());
+        NTCCFG_TEST_OK(error);
+    }
+
+    reactor->stop();
+
+    runningThreadGroup.joinAll();
+}
+
+}  // close namespace case7
+}  // close namespace test
+
+NTCCFG_TEST_CASE(7)
+{
+    // Concern: When each waiter polls its own device, incoming connections
+    // are accepted by any waiter, the events of other sockets are announced
+    // by the waiter polling the device to which each is bound, and the
+    // sockets bound to the device of a waiter that deregisters continue to
+    // have their events announced by the remaining waiter.
+
+    NTCI_LOG_CONTEXT();
+    NTCI_LOG_CONTEXT_GUARD_OWNER("test");
+
+    ntccfg::TestAllocator ta;
+    {
+        test::case7::execute(&ta);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
     NTCCFG_TEST_REGISTER(2);
     NTCCFG_TEST_REGISTER(3);
+    NTCCFG_TEST_REGISTER(4);
+    NTCCFG_TEST_REGISTER(5);
+    NTCCFG_TEST_REGISTER(6);
+    NTCCFG_TEST_REGISTER(7);
 }
 NTCCFG_TEST_DRIVER_END;
 
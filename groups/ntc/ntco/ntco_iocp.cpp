@@ -2239,8 +2239,8 @@ ntsa::Error Iocp::send(const bsl::shared_ptr<ntci::ProactorSocket>& socket,
         const ntsa::File& file = data.file();
 
         DWORD size;
-        if (file.size() <= bsl::numeric_limits<DWORD>::max()) {
-            size = NTCCFG_WARNING_NARROW(DWORD, file.size());
+        if (file.bytesRemaining() <= bsl::numeric_limits<DWORD>::max()) {
+            size = NTCCFG_WARNING_NARROW(DWORD, file.bytesRemaining());
         }
         else {
             size = bsl::numeric_limits<DWORD>::max();
@@ -53,6 +53,7 @@ BSLS_IDENT_RCSID(ntco_ioring_cpp, "$Id$ $CSID$")
 #include <ntci_mutex.h>
 #include <ntcs_async.h>
 #include <ntcs_authorization.h>
+#include <ntcs_busypoll.h>
 #include <ntcs_chronology.h>
 #include <ntcs_datapool.h>
 #include <ntcs_driver.h>
@@ -587,6 +588,7 @@ struct IoRingWaiter {
     ntca::WaiterOptions                    d_options;
     bsl::shared_ptr<ntci::ProactorMetrics> d_metrics_sp;
     struct __kernel_timespec               d_ts;
+    ntcs::BusyPoll                         d_busyPoll;
 
   private:
     IoRingWaiter(const IoRingWaiter&) BSLS_KEYWORD_DELETED;
@@ -1363,6 +1365,14 @@ class IoRingDevice
     bsl::size_t flush(ntco::IoRingCompletion* entryList,
                       bsl::size_t             entryListCapacity);
 
+    // Submit any pending entries in the submission queue without waiting
+    // for any entry to complete, then load into the specified 'entryList'
+    // having the specified 'entryListCapacity' the next entries from the
+    // completion queue. Return the number of entries popped and set in the
+    // 'entryList'.
+    bsl::size_t poll(ntco::IoRingCompletion* entryList,
+                     bsl::size_t             entryListCapacity);
+
     // Return the index of the head entry in the submission queue.
     bsl::uint32_t submissionQueueHead() const;
 
@@ -1837,6 +1847,7 @@ IoRingWaiter::IoRingWaiter(bslma::Allocator* basicAllocator)
 : d_options(basicAllocator)
 , d_metrics_sp()
 , d_ts()
+, d_busyPoll()
 {
 }
 
@@ -4050,6 +4061,29 @@ bsl::size_t IoRingDevice::flush(ntco::IoRingCompletion* entryList,
     return d_completionQueue.pop(entryList, entryListCapacity);
 }
 
+bsl::size_t IoRingDevice::poll(ntco::IoRingCompletion* entryList,
+                               bsl::size_t             entryListCapacity)
+{
+    NTCI_LOG_CONTEXT();
+
+    const bsl::size_t numToSubmit = d_submissionQueue.gather();
+
+    if (numToSubmit > 0) {
+        NTCO_IORING_LOG_ENTER_STARTING(numToSubmit, 0);
+
+        int rc = ntco::IoRingUtil::enter(d_ring, numToSubmit, 0);
+
+        NTCO_IORING_LOG_ENTER_COMPLETE(numToSubmit, 0, rc);
+
+        if (rc < 0) {
+            ntsa::Error error(errno);
+            NTCO_IORING_LOG_WAIT_FAILURE(error);
+        }
+    }
+
+    return d_completionQueue.pop(entryList, entryListCapacity);
+}
+
 // Return the index of the head entry in the submission queue.
 bsl::uint32_t IoRingDevice::submissionQueueHead() const
 {
@@ -4522,6 +4556,20 @@ class IoRing : public ntci::Proactor,
     // has previously registered the 'waiter'.
     void wait(ntci::Waiter waiter);
 
+    // Load into the specified 'entryList' having the specified
+    // 'entryListCapacity' the next entries from the completion queue on
+    // behalf of the waiter described by the specified 'result'. If busy
+    // polling is active for the waiter, repeatedly poll the completion
+    // queue without blocking, until either an entry has completed or the
+    // busy poll duration elapses, before blocking until either an entry has
+    // completed or the specified 'earliestTimerDue' has elapsed. Return the
+    // number of entries popped and set in the 'entryList'.
+    bsl::size_t waitDevice(
+        IoRingWaiter*                                  result,
+        ntco::IoRingCompletion*                        entryList,
+        bsl::size_t                                    entryListCapacity,
+        const bdlb::NullableValue<bsls::TimeInterval>& earliestTimerDue);
+
     // Acquire usage of the most suitable proactor selected according to
     // the specified load balancing 'options'.
     bsl::shared_ptr<ntci::Proactor> acquireProactor(
@@ -4913,6 +4961,78 @@ void IoRing::flush()
     }
 }
 
+bsl::size_t IoRing::waitDevice(
+    IoRingWaiter*                                  result,
+    ntco::IoRingCompletion*                        entryList,
+    bsl::size_t                                    entryListCapacity,
+    const bdlb::NullableValue<bsls::TimeInterval>& earliestTimerDue)
+{
+    ntcs::BusyPoll& busyPoll = result->d_busyPoll;
+
+    if (NTCCFG_LIKELY(!busyPoll.isEnabled())) {
+        return d_device.wait(result,
+                             entryList,
+                             entryListCapacity,
+                             1,
+                             earliestTimerDue);
+    }
+
+    NTCS_PROACTORMETRICS_GET();
+
+    bsl::size_t entryCount;
+
+    bsls::Types::Int64 now = bsls::TimeUtil::getTimer();
+
+    if (busyPoll.isActive()) {
+        const bsls::Types::Int64 start = now;
+
+        bsls::Types::Int64 deadline = start + busyPoll.duration();
+        if (!earliestTimerDue.isNull()) {
+            const bsls::TimeInterval timeout =
+                earliestTimerDue.value() - d_chronology.currentTime();
+            const bsls::Types::Int64 timeoutDeadline =
+                timeout > bsls::TimeInterval()
+                    ? start + timeout.totalNanoseconds()
+                    : start;
+            if (deadline > timeoutDeadline) {
+                deadline = timeoutDeadline;
+            }
+        }
+
+        while (true) {
+            entryCount = d_device.poll(entryList, entryListCapacity);
+            if (entryCount > 0) {
+                busyPoll.recordHit();
+                NTCS_PROACTORMETRICS_UPDATE_BUSY_POLL(true);
+                return entryCount;
+            }
+
+            now = bsls::TimeUtil::getTimer();
+            if (now >= deadline) {
+                break;
+            }
+        }
+
+        NTCS_PROACTORMETRICS_UPDATE_BUSY_POLL(false);
+    }
+
+    entryCount = d_device.wait(result,
+                               entryList,
+                               entryListCapacity,
+                               1,
+                               earliestTimerDue);
+
+    // A single completion without an event describes the expiration of the
+    // timeout submitted to wake up the waiter, rather than an event.
+
+    const bool eventsArrived =
+        entryCount > 1 || (entryCount == 1 && entryList[0].event() != 0);
+
+    busyPoll.recordMiss(eventsArrived, bsls::TimeUtil::getTimer() - now);
+
+    return entryCount;
+}
+
 void IoRing::wait(ntci::Waiter waiter)
 {
     NTCCFG_WARNING_UNUSED(waiter);
@@ -4943,11 +5063,11 @@ void IoRing::wait(ntci::Waiter waiter)
     const bsl::size_t entryListCapacity =
         d_config.maxThreads().value() == 1 ? ENTRY_LIST_CAPACITY : 1;
 
-    bsl::size_t entryCount = d_device.wait(waiter,
-                                           entryList,
-                                           entryListCapacity,
-                                           1,
-                                           earliestTimerDue);
+    bsl::size_t entryCount = this->waitDevice(
+        static_cast<IoRingWaiter*>(waiter),
+        entryList,
+        entryListCapacity,
+        earliestTimerDue);
 
     if (NTCCFG_UNLIKELY(d_config.maxThreads().value() > 1)) {
         d_semaphore.post();
@@ -5445,6 +5565,11 @@ ntci::Waiter IoRing::registerWaiter(const ntca::WaiterOptions& waiterOptions)
             }
         }
 
+        if (!d_config.busyPollDuration().isNull()) {
+            result->d_busyPoll.setMaxDuration(
+                d_config.busyPollDuration().value());
+        }
+
         d_waiterSet.insert(result);
     }
 
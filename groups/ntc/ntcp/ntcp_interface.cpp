@@ -193,6 +193,15 @@ bsl::shared_ptr<ntci::Proactor> Interface::addProactor()
             d_config.maxCyclesPerWait().value());
     }
 
+    if (!d_config.busyPollDuration().isNull()) {
+        proactorConfig.setBusyPollDuration(
+            d_config.busyPollDuration().value());
+    }
+
+    if (!d_config.busyPollSockets().isNull()) {
+        proactorConfig.setBusyPollSockets(d_config.busyPollSockets().value());
+    }
+
     if (!d_config.driverMetrics().isNull()) {
         proactorConfig.setMetricCollection(d_config.driverMetrics().value());
     }
@@ -5461,7 +5461,8 @@ ntsa::Error StreamSocket::cancel(const ntca::SendToken& token)
     NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
 
     ntci::SendCallback callback;
-    bool becameEmpty = d_sendQueue.removeEntryToken(&callback, token);
+    bool becameEmpty =
+        d_sendQueue.removeEntryToken(&callback, token, false);
 
     if (becameEmpty) {
         this->privateApplyFlowControl(self,
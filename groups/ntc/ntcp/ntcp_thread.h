@@ -31,6 +31,7 @@ BSLS_IDENT("$Id: $")
 #include <ntci_timer.h>
 #include <ntcs_metrics.h>
 #include <ntcs_user.h>
+#include <ntcs_watchdog.h>
 #include <ntcscm_version.h>
 #include <ntsi_descriptor.h>
 #include <bslmt_condition.h>
@@ -68,6 +69,7 @@ class Thread : public ntci::Thread, public ntccfg::Shared<Thread>
     bslmt::Condition                d_runCondition;
     bsls::AtomicInt                 d_runState;
     ntca::ThreadConfig              d_config;
+    bsl::shared_ptr<ntcs::Watchdog> d_watchdog_sp;
     bslma::Allocator*               d_allocator_p;
 
   private:
@@ -20,6 +20,7 @@ BSLS_IDENT_RCSID(ntcq_receive_cpp, "$Id$ $CSID$")
 
 #include <ntccfg_bind.h>
 #include <ntccfg_limits.h>
+#include <ntsu_socketutil.h>
 #include <bdlf_bind.h>
 #include <bdlf_memfn.h>
 #include <bdlf_placeholder.h>
@@ -124,6 +125,9 @@ ReceiveCallbackQueue::~ReceiveCallbackQueue()
 
 ReceiveQueue::ReceiveQueue(bslma::Allocator* basicAllocator)
 : d_entryList(basicAllocator)
+, d_foreignHandleList(basicAllocator)
+, d_pushOffset(0)
+, d_popOffset(0)
 , d_data_sp()
 , d_size(0)
 , d_watermarkLow(NTCCFG_DEFAULT_STREAM_SOCKET_READ_QUEUE_LOW_WATERMARK)
@@ -139,6 +143,12 @@ ReceiveQueue::ReceiveQueue(bslma::Allocator* basicAllocator)
 
 ReceiveQueue::~ReceiveQueue()
 {
+    for (ForeignHandleList::iterator it = d_foreignHandleList.begin();
+         it != d_foreignHandleList.end();
+         ++it)
+    {
+        ntsu::SocketUtil::close(it->d_handle);
+    }
 }
 
 }  // close package namespace
@@ -32,11 +32,13 @@ BSLS_IDENT("$Id: $")
 #include <ntcs_watermarkutil.h>
 #include <ntcscm_version.h>
 #include <ntsa_error.h>
+#include <ntsa_handle.h>
 #include <bdlb_nullablevalue.h>
 #include <bdlbb_blob.h>
 #include <bdlcc_sharedobjectpool.h>
 #include <bsls_timeinterval.h>
 #include <bsls_timeutil.h>
+#include <bsl_cstdint.h>
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
@@ -259,6 +261,7 @@ class ReceiveQueueEntry
     bsl::shared_ptr<bdlbb::Blob>        d_data_sp;
     bsl::size_t                         d_length;
     bsl::int64_t                        d_timestamp;
+    ntsa::Handle                        d_foreignHandle;
 
   public:
     /// Create a new receive from message queue entry.
@@ -279,6 +282,11 @@ class ReceiveQueueEntry
     /// Set the timestamp to the specified 'timestamp'.
     void setTimestamp(bsl::int64_t timestamp);
 
+    /// Set the handle passed by the peer along with the first byte of the
+    /// data to the specified 'value'. Note that the queue onto which this
+    /// entry is pushed assumes ownership of the handle.
+    void setForeignHandle(ntsa::Handle value);
+
     /// Return the endpoint.
     const bdlb::NullableValue<ntsa::Endpoint>& endpoint() const;
 
@@ -294,6 +302,10 @@ class ReceiveQueueEntry
 
     /// Return the duration from the timestamp until now.
     bsls::TimeInterval delay() const;
+
+    /// Return the handle passed by the peer along with the first byte of the
+    /// data, or 'ntsa::k_INVALID_HANDLE' if no such handle is defined.
+    ntsa::Handle foreignHandle() const;
 };
 
 /// @internal @brief
@@ -415,6 +427,16 @@ class ReceiveFeedback
 /// @internal @brief
 /// Provide a receive queue.
 ///
+/// @par Foreign Handles
+/// An entry may hold a foreign handle passed by the peer along with the first
+/// byte of its data. When the entry is pushed, the queue records the handle
+/// with the offset of that byte in the stream of bytes ever pushed onto the
+/// queue. A handle may be popped only once the byte at its offset has been
+/// popped, so after popping the bytes consumed by an operation, popping
+/// handles until none remain yields exactly the handles that arrived with
+/// those bytes, in the order in which they were received. Any handle still
+/// held by the queue when the queue is destroyed is closed.
+///
 /// @par Thread Safety
 /// This class is not thread safe.
 ///
@@ -425,7 +447,21 @@ class ReceiveQueue
     /// the read queue.
     typedef bsl::list<ReceiveQueueEntry> EntryList;
 
+    /// Describe a foreign handle and the offset of the byte with which it
+    /// was received.
+    struct ForeignHandle {
+        bsl::uint64_t d_offset;
+        ntsa::Handle  d_handle;
+    };
+
+    /// This typedef defines a linked list of foreign handles, in the order
+    /// of the offsets of the bytes with which they were received.
+    typedef bsl::list<ForeignHandle> ForeignHandleList;
+
     EntryList                    d_entryList;
+    ForeignHandleList            d_foreignHandleList;
+    bsl::uint64_t                d_pushOffset;
+    bsl::uint64_t                d_popOffset;
     bsl::shared_ptr<bdlbb::Blob> d_data_sp;
     bsl::size_t                  d_size;
     bsl::size_t                  d_watermarkLow;
@@ -466,6 +502,12 @@ class ReceiveQueue
     /// queue.
     void popSize(bsl::size_t numBytes);
 
+    /// Load into the specified 'result' the earliest received foreign handle
+    /// whose associated byte has been popped from the queue and transfer
+    /// ownership of that handle to the caller. Return true if such a handle
+    /// exists, otherwise return false.
+    bool popForeignHandle(ntsa::Handle* result);
+
     /// Return a shared pointer to a new receive callback queue entry.
     bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> createCallbackEntry();
 
@@ -696,6 +738,7 @@ ReceiveQueueEntry::ReceiveQueueEntry()
 , d_data_sp()
 , d_length(0)
 , d_timestamp(0)
+, d_foreignHandle(ntsa::k_INVALID_HANDLE)
 {
 }
 
@@ -730,6 +773,12 @@ void ReceiveQueueEntry::setTimestamp(bsl::int64_t timestamp)
     d_timestamp = timestamp;
 }
 
+NTCCFG_INLINE
+void ReceiveQueueEntry::setForeignHandle(ntsa::Handle value)
+{
+    d_foreignHandle = value;
+}
+
 NTCCFG_INLINE
 const bdlb::NullableValue<ntsa::Endpoint>& ReceiveQueueEntry::endpoint() const
 {
@@ -769,6 +818,12 @@ bsls::TimeInterval ReceiveQueueEntry::delay() const
     return delay;
 }
 
+NTCCFG_INLINE
+ntsa::Handle ReceiveQueueEntry::foreignHandle() const
+{
+    return d_foreignHandle;
+}
+
 NTCCFG_INLINE
 ReceiveFeedback::ReceiveFeedback()
 : d_minimum(NTCCFG_DEFAULT_STREAM_SOCKET_MIN_INCOMING_TRANSFER_SIZE)
@@ -899,8 +954,18 @@ bool ReceiveQueue::pushEntry(const ReceiveQueueEntry& entry)
 {
     d_entryList.push_back(entry);
 
+    if (NTCCFG_UNLIKELY(entry.foreignHandle() != ntsa::k_INVALID_HANDLE)) {
+        ForeignHandle foreignHandle;
+        foreignHandle.d_offset = d_pushOffset;
+        foreignHandle.d_handle = entry.foreignHandle();
+
+        d_foreignHandleList.push_back(foreignHandle);
+        d_entryList.back().setForeignHandle(ntsa::k_INVALID_HANDLE);
+    }
+
     BSLS_ASSERT(entry.length() > 0);
-    d_size += entry.length();
+    d_size       += entry.length();
+    d_pushOffset += entry.length();
 
     return d_entryList.size() == 1;
 }
@@ -919,7 +984,8 @@ bool ReceiveQueue::popEntry()
 
         BSLS_ASSERT(entry.length() > 0);
         BSLS_ASSERT(d_size >= entry.length());
-        d_size -= entry.length();
+        d_size      -= entry.length();
+        d_popOffset += entry.length();
     }
 
     if (d_size < d_watermarkLow) {
@@ -942,7 +1008,8 @@ void ReceiveQueue::popSize(bsl::size_t numBytes)
     entry.setLength(entry.length() - numBytes);
 
     BSLS_ASSERT(d_size >= numBytes);
-    d_size -= numBytes;
+    d_size      -= numBytes;
+    d_popOffset += numBytes;
 
     if (d_size < d_watermarkLow) {
         d_watermarkLowWanted  = true;
@@ -950,6 +1017,23 @@ void ReceiveQueue::popSize(bsl::size_t numBytes)
     }
 }
 
+NTCCFG_INLINE
+bool ReceiveQueue::popForeignHandle(ntsa::Handle* result)
+{
+    if (NTCCFG_LIKELY(d_foreignHandleList.empty())) {
+        return false;
+    }
+
+    if (d_foreignHandleList.front().d_offset >= d_popOffset) {
+        return false;
+    }
+
+    *result = d_foreignHandleList.front().d_handle;
+    d_foreignHandleList.pop_front();
+
+    return true;
+}
+
 NTCCFG_INLINE
 bsl::shared_ptr<ntcq::ReceiveCallbackQueueEntry> ReceiveQueue::
     createCallbackEntry()
@@ -17,6 +17,7 @@
 
 #include <ntccfg_bind.h>
 #include <ntccfg_test.h>
+#include <ntsu_socketutil.h>
 #include <bdlf_bind.h>
 #include <bdlf_placeholder.h>
 #include <bslma_allocator.h>
@@ -813,11 +814,137 @@ NTCCFG_TEST_CASE(4)
 #endif
 }
 
+NTCCFG_TEST_CASE(5)
+{
+    // Concern: Foreign handles are released in the order received once the
+    // byte with which each was received is popped, every handle received
+    // with the bytes popped is released, and any handles still held by the
+    // queue are closed when the queue is destroyed.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+        bool        result;
+
+        ntsa::Handle handle1 = ntsa::k_INVALID_HANDLE;
+        ntsa::Handle handle2 = ntsa::k_INVALID_HANDLE;
+        ntsa::Handle handle3 = ntsa::k_INVALID_HANDLE;
+        ntsa::Handle handle4 = ntsa::k_INVALID_HANDLE;
+
+        error = ntsu::SocketUtil::create(&handle1,
+                                         ntsa::Transport::e_TCP_IPV4_STREAM);
+        NTCCFG_TEST_OK(error);
+
+        error = ntsu::SocketUtil::create(&handle2,
+                                         ntsa::Transport::e_TCP_IPV4_STREAM);
+        NTCCFG_TEST_OK(error);
+
+        error = ntsu::SocketUtil::create(&handle3,
+                                         ntsa::Transport::e_TCP_IPV4_STREAM);
+        NTCCFG_TEST_OK(error);
+
+        error = ntsu::SocketUtil::create(&handle4,
+                                         ntsa::Transport::e_TCP_IPV4_STREAM);
+        NTCCFG_TEST_OK(error);
+
+        {
+            ntcq::ReceiveQueue receiveQueue(&ta);
+
+            // Push bytes [0, 10) with 'handle1', bytes [10, 20), bytes
+            // [20, 30) with 'handle2', bytes [30, 40) with 'handle3', and
+            // bytes [40, 50) with 'handle4'.
+
+            ntsa::Handle handles[5] = {handle1,
+                                       ntsa::k_INVALID_HANDLE,
+                                       handle2,
+                                       handle3,
+                                       handle4};
+
+            for (bsl::size_t i = 0; i < 5; ++i) {
+                ntcq::ReceiveQueueEntry entry;
+                entry.setLength(10);
+                if (handles[i] != ntsa::k_INVALID_HANDLE) {
+                    entry.setForeignHandle(handles[i]);
+                }
+
+                receiveQueue.pushEntry(entry);
+            }
+
+            ntsa::Handle foreignHandle = ntsa::k_INVALID_HANDLE;
+
+            result = receiveQueue.popForeignHandle(&foreignHandle);
+            NTCCFG_TEST_FALSE(result);
+
+            // Pop bytes [0, 5): 'handle1' is released.
+
+            receiveQueue.popSize(5);
+
+            result = receiveQueue.popForeignHandle(&foreignHandle);
+            NTCCFG_TEST_TRUE(result);
+            NTCCFG_TEST_EQ(foreignHandle, handle1);
+
+            result = receiveQueue.popForeignHandle(&foreignHandle);
+            NTCCFG_TEST_FALSE(result);
+
+            // Pop bytes [5, 20): no handle is released.
+
+            receiveQueue.popEntry();
+            receiveQueue.popEntry();
+
+            result = receiveQueue.popForeignHandle(&foreignHandle);
+            NTCCFG_TEST_FALSE(result);
+
+            // Pop bytes [20, 35), as a single operation spanning two
+            // entries: both 'handle2' and 'handle3' are released.
+
+            receiveQueue.popEntry();
+            receiveQueue.popSize(5);
+
+            result = receiveQueue.popForeignHandle(&foreignHandle);
+            NTCCFG_TEST_TRUE(result);
+            NTCCFG_TEST_EQ(foreignHandle, handle2);
+
+            result = receiveQueue.popForeignHandle(&foreignHandle);
+            NTCCFG_TEST_TRUE(result);
+            NTCCFG_TEST_EQ(foreignHandle, handle3);
+
+            result = receiveQueue.popForeignHandle(&foreignHandle);
+            NTCCFG_TEST_FALSE(result);
+
+            // Pop bytes [35, 40): 'handle4' is not released.
+
+            receiveQueue.popEntry();
+            NTCCFG_TEST_EQ(receiveQueue.size(), 10);
+
+            result = receiveQueue.popForeignHandle(&foreignHandle);
+            NTCCFG_TEST_FALSE(result);
+
+            NTCCFG_TEST_TRUE(ntsu::SocketUtil::isSocket(handle4));
+        }
+
+        NTCCFG_TEST_TRUE(ntsu::SocketUtil::isSocket(handle1));
+        NTCCFG_TEST_TRUE(ntsu::SocketUtil::isSocket(handle2));
+        NTCCFG_TEST_TRUE(ntsu::SocketUtil::isSocket(handle3));
+        NTCCFG_TEST_FALSE(ntsu::SocketUtil::isSocket(handle4));
+
+        error = ntsu::SocketUtil::close(handle1);
+        NTCCFG_TEST_OK(error);
+
+        error = ntsu::SocketUtil::close(handle2);
+        NTCCFG_TEST_OK(error);
+
+        error = ntsu::SocketUtil::close(handle3);
+        NTCCFG_TEST_OK(error);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
     NTCCFG_TEST_REGISTER(2);
     NTCCFG_TEST_REGISTER(3);
     NTCCFG_TEST_REGISTER(4);
+    NTCCFG_TEST_REGISTER(5);
 }
 NTCCFG_TEST_DRIVER_END;
@@ -32,6 +32,14 @@ BSLS_IDENT_RCSID(ntcq_send_cpp, "$Id$ $CSID$")
 namespace BloombergLP {
 namespace ntcq {
 
+void SendQueueEntry::closeForeignHandle()
+{
+    if (d_foreignHandle != ntsa::k_INVALID_HANDLE) {
+        ntsu::SocketUtil::close(d_foreignHandle);
+        d_foreignHandle = ntsa::k_INVALID_HANDLE;
+    }
+}
+
 bool SendQueueEntry::batchNext(ntsa::ConstBufferArray*  result,
                                const ntsa::SendOptions& options) const
 {
@@ -272,6 +280,11 @@ SendQueue::SendQueue(bslma::Allocator* basicAllocator)
 
 SendQueue::~SendQueue()
 {
+    for (EntryList::iterator it = d_entryList.begin(); it != d_entryList.end();
+         ++it)
+    {
+        it->closeForeignHandle();
+    }
 }
 
 bool SendQueue::batchNext(ntsa::ConstBufferArray*  result,
@@ -32,6 +32,7 @@ BSLS_IDENT("$Id: $")
 #include <ntcscm_version.h>
 #include <ntsa_data.h>
 #include <ntsa_error.h>
+#include <ntsa_handle.h>
 #include <ntsa_sendoptions.h>
 #include <bdlb_nullablevalue.h>
 #include <bdlcc_sharedobjectpool.h>
@@ -97,6 +98,13 @@ public:
 /// @internal @brief
 /// Describe an entry on a send queue.
 ///
+/// @par Foreign Handles
+/// An entry may hold a foreign handle to be passed to the peer along with the
+/// first byte of its data. Entries are copied by value, so the handle is not
+/// closed when an entry is destroyed; rather, the send queue that holds the
+/// entry closes the handle when the entry is popped or removed, or when the
+/// send queue is destroyed.
+///
 /// @par Thread Safety
 /// This class is not thread safe.
 ///
@@ -108,12 +116,15 @@ class SendQueueEntry
     bdlb::NullableValue<ntsa::Endpoint>     d_endpoint;
     bsl::shared_ptr<ntsa::Data>             d_data_sp;
     bsl::size_t                             d_length;
+    bsl::size_t                             d_bytesSent;
     bsl::int64_t                            d_timestamp;
     bdlb::NullableValue<bsls::TimeInterval> d_deadline;
     bsl::shared_ptr<ntci::Timer>            d_timer_sp;
     ntci::SendCallback                      d_callback;
+    ntsa::Handle                            d_foreignHandle;
     bool                                    d_inProgress;
     bool                                    d_zeroCopy;
+    bool                                    d_progress;
 
   private:
     /// If this entry is batchable, append a reference to this data of this
@@ -228,6 +239,10 @@ class SendQueueEntry
     /// Set the length of the data to the specified 'length'.
     void setLength(bsl::size_t length);
 
+    /// Set the number of bytes of the data of the original send operation
+    /// already copied to the send buffer to the specified 'value'.
+    void setBytesSent(bsl::size_t value);
+
     /// Set the timestamp to the specified 'timestamp'.
     void setTimestamp(bsl::int64_t timestamp);
 
@@ -248,6 +263,11 @@ class SendQueueEntry
     /// Set the callback to the empty callback.
     void setCallback(bsl::nullptr_t);
 
+    /// Set the handle to pass to the peer along with the first byte of the
+    /// data to the specified 'value'. Note that the queue holding this entry
+    /// assumes ownership of the handle.
+    void setForeignHandle(ntsa::Handle value);
+
     /// Set the flag to indicate that the entry is now in-progress, i.e. its
     /// data has been at least partially copied to the send buffer, to the
     /// specified 'inProgress' flag.
@@ -258,9 +278,18 @@ class SendQueueEntry
     /// 'zeroCopy' flag.
     void setZeroCopy(bool zeroCopy);
 
+    /// Set the flag that indicates the callback should be invoked each time
+    /// a portion, but not all, of the data is copied to the send buffer to
+    /// the specified 'value'.
+    void setProgress(bool value);
+
     /// Close the timer, if any.
     void closeTimer();
 
+    /// Close the handle to pass to the peer along with the first byte of the
+    /// data, if any.
+    void closeForeignHandle();
+
     /// If this entry is batchable, append a reference to this data of this
     /// entry to the specified 'result' according to the specified 'options'.
     /// Return true if more entries should be attempted to be batched, and
@@ -283,6 +312,10 @@ class SendQueueEntry
     /// Return the length of the data.
     bsl::size_t length() const;
 
+    /// Return the number of bytes of the data of the original send
+    /// operation already copied to the send buffer.
+    bsl::size_t bytesSent() const;
+
     /// Return the timestamp, in nanoseconds since an arbitrary but
     /// consistent epoch.
     bsl::int64_t timestamp() const;
@@ -296,6 +329,10 @@ class SendQueueEntry
     /// Return the callback entry.
     const ntci::SendCallback& callback() const;
 
+    /// Return the handle to pass to the peer along with the first byte of
+    /// the data, or 'ntsa::k_INVALID_HANDLE' if no such handle is defined.
+    ntsa::Handle foreignHandle() const;
+
     /// Return the flag that indicates whether the entry is now in-progress,
     /// i.e. its data has been at least partially copied to the send buffer.
     bool inProgress() const;
@@ -304,6 +341,11 @@ class SendQueueEntry
     /// has been successfully sent with zero-copy semantics.
     bool zeroCopy() const;
 
+    /// Return the flag that indicates the callback should be invoked each
+    /// time a portion, but not all, of the data is copied to the send
+    /// buffer.
+    bool progress() const;
+
     /// Return the flag that indicates the data representation of this entry
     /// is batchable with other similar representations.
     bool isBatchable() const;
@@ -383,11 +425,16 @@ class SendQueue
     /// Remove the entry having the specified 'token' and load its callback
     /// entry into the specified 'result', if an entry with such a 'token'
     /// and defined callback exists and has not already had any portion of
-    /// its data copied to the socket send buffer. Return true if queue
-    /// becomes empty as a result of this operation, otherwise return false.
+    /// its data copied to the socket send buffer. If the specified
+    /// 'removeFileInProgress' flag is true, also remove such an entry
+    /// describing a file that has already had a portion of its data copied
+    /// to the socket send buffer, in which case the remainder of the file
+    /// is never sent. Return true if queue becomes empty as a result of this
+    /// operation, otherwise return false.
     bool removeEntryToken(
         ntci::SendCallback*    result,
-        const ntca::SendToken& token);
+        const ntca::SendToken& token,
+        bool                   removeFileInProgress);
 
     /// Load into the specified 'result' any pending callback entries and
     /// clear the queue. Return true if the queue was non-empty, and false
@@ -508,12 +555,15 @@ SendQueueEntry::SendQueueEntry(bslma::Allocator* basicAllocator)
 , d_endpoint()
 , d_data_sp()
 , d_length(0)
+, d_bytesSent(0)
 , d_timestamp(0)
 , d_deadline()
 , d_timer_sp()
 , d_callback(basicAllocator)
+, d_foreignHandle(ntsa::k_INVALID_HANDLE)
 , d_inProgress(false)
 , d_zeroCopy(false)
+, d_progress(false)
 {
 }
 
@@ -525,12 +575,15 @@ SendQueueEntry::SendQueueEntry(const SendQueueEntry& original,
 , d_endpoint(original.d_endpoint)
 , d_data_sp(original.d_data_sp)
 , d_length(original.d_length)
+, d_bytesSent(original.d_bytesSent)
 , d_timestamp(original.d_timestamp)
 , d_deadline(original.d_deadline)
 , d_timer_sp(original.d_timer_sp)
 , d_callback(original.d_callback, basicAllocator)
+, d_foreignHandle(original.d_foreignHandle)
 , d_inProgress(original.d_inProgress)
 , d_zeroCopy(original.d_zeroCopy)
+, d_progress(original.d_progress)
 {
 }
 
@@ -583,6 +636,12 @@ void SendQueueEntry::setLength(bsl::size_t length)
     d_length = length;
 }
 
+NTCCFG_INLINE
+void SendQueueEntry::setBytesSent(bsl::size_t value)
+{
+    d_bytesSent = value;
+}
+
 NTCCFG_INLINE
 void SendQueueEntry::setTimestamp(bsl::int64_t timestamp)
 {
@@ -621,6 +680,12 @@ void SendQueueEntry::setCallback(bsl::nullptr_t)
     d_callback.reset();
 }
 
+NTCCFG_INLINE
+void SendQueueEntry::setForeignHandle(ntsa::Handle value)
+{
+    d_foreignHandle = value;
+}
+
 NTCCFG_INLINE
 void SendQueueEntry::setInProgress(bool inProgress)
 {
@@ -633,6 +698,12 @@ void SendQueueEntry::setZeroCopy(bool zeroCopy)
     d_zeroCopy = zeroCopy;
 }
 
+NTCCFG_INLINE
+void SendQueueEntry::setProgress(bool value)
+{
+    d_progress = value;
+}
+
 NTCCFG_INLINE
 void SendQueueEntry::closeTimer()
 {
@@ -672,6 +743,12 @@ bsl::size_t SendQueueEntry::length() const
     return d_length;
 }
 
+NTCCFG_INLINE
+bsl::size_t SendQueueEntry::bytesSent() const
+{
+    return d_bytesSent;
+}
+
 NTCCFG_INLINE
 bsl::int64_t SendQueueEntry::timestamp() const
 {
@@ -705,6 +782,12 @@ const ntci::SendCallback& SendQueueEntry::callback() const
     return d_callback;
 }
 
+NTCCFG_INLINE
+ntsa::Handle SendQueueEntry::foreignHandle() const
+{
+    return d_foreignHandle;
+}
+
 NTCCFG_INLINE
 bool SendQueueEntry::inProgress() const
 {
@@ -717,6 +800,12 @@ bool SendQueueEntry::zeroCopy() const
     return d_zeroCopy;
 }
 
+NTCCFG_INLINE
+bool SendQueueEntry::progress() const
+{
+    return d_progress;
+}
+
 NTCCFG_INLINE
 bool SendQueueEntry::isBatchable() const
 {
@@ -728,6 +817,10 @@ bool SendQueueEntry::isBatchable() const
         return false;
     }
 
+    if (NTCCFG_UNLIKELY(d_foreignHandle != ntsa::k_INVALID_HANDLE)) {
+        return false;
+    }
+
     return true;
 }
 
@@ -765,6 +858,7 @@ bool SendQueue::popEntry()
         SendQueueEntry& entry = d_entryList.front();
 
         entry.closeTimer();
+        entry.closeForeignHandle();
 
         if (entry.data()) {
             BSLS_ASSERT(entry.length() > 0);
@@ -795,6 +889,7 @@ void SendQueue::popSize(bsl::size_t numBytes)
 
     BSLS_ASSERT(entry.length() >= numBytes);
     entry.setLength(entry.length() - numBytes);
+    entry.setBytesSent(entry.bytesSent() + numBytes);
 
     BSLS_ASSERT(entry.data()->size() == entry.length());
 
@@ -825,6 +920,7 @@ bool SendQueue::removeEntryId(
                     }
 
                     entry.closeTimer();
+                    entry.closeForeignHandle();
 
                     if (entry.callback()) {
                         *result = entry.callback();
@@ -843,7 +939,8 @@ bool SendQueue::removeEntryId(
 NTCCFG_INLINE
 bool SendQueue::removeEntryToken(
     ntci::SendCallback*    result,
-    const ntca::SendToken& token)
+    const ntca::SendToken& token,
+    bool                   removeFileInProgress)
 {
     result->reset();
 
@@ -854,7 +951,10 @@ bool SendQueue::removeEntryToken(
 
         if (!entry.token().isNull()) {
             if (entry.token().value() == token) {
-                if (!entry.inProgress()) {
+                if (!entry.inProgress() ||
+                    (removeFileInProgress && entry.data() &&
+                     entry.data()->isFile()))
+                {
                     if (entry.data()) {
                         BSLS_ASSERT(entry.length() > 0);
                         BSLS_ASSERT(entry.length() == entry.data()->size());
@@ -863,6 +963,7 @@ bool SendQueue::removeEntryToken(
                     }
 
                     entry.closeTimer();
+                    entry.closeForeignHandle();
 
                     if (entry.callback()) {
                         *result = entry.callback();
@@ -890,6 +991,7 @@ bool SendQueue::removeAll(
         ntcq::SendQueueEntry& entry = *it;
 
         entry.closeTimer();
+        entry.closeForeignHandle();
 
         if (entry.callback()) {
             result->push_back(entry.callback());
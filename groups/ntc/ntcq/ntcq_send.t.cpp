@@ -21,6 +21,7 @@
 #include <ntsa_data.h>
 #include <ntsa_temporary.h>
 #include <ntsd_datautil.h>
+#include <ntsu_socketutil.h>
 #include <bdlbb_blob.h>
 #include <bdlbb_blobstreambuf.h>
 #include <bdlbb_blobutil.h>
@@ -634,6 +635,139 @@ NTCCFG_TEST_CASE(6)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+NTCCFG_TEST_CASE(7)
+{
+    // Concern: Entries holding a foreign handle are not batched, and the
+    // foreign handle is closed when its entry is popped or when the queue is
+    // destroyed.
+
+    ntccfg::TestAllocator ta;
+    {
+        const bsl::size_t k_BLOB_BUFFER_SIZE = 32;
+        const bsl::size_t k_MESSAGE_SIZE     = 1024;
+
+        bdlbb::SimpleBlobBufferFactory blobBufferFactory(k_BLOB_BUFFER_SIZE,
+                                                         &ta);
+
+        ntsa::Error error;
+        bool        result;
+
+        ntsa::Handle handle1 = ntsa::k_INVALID_HANDLE;
+        ntsa::Handle handle2 = ntsa::k_INVALID_HANDLE;
+
+        error = ntsu::SocketUtil::create(&handle1,
+                                         ntsa::Transport::e_TCP_IPV4_STREAM);
+        NTCCFG_TEST_OK(error);
+
+        error = ntsu::SocketUtil::create(&handle2,
+                                         ntsa::Transport::e_TCP_IPV4_STREAM);
+        NTCCFG_TEST_OK(error);
+
+        {
+            ntcq::SendQueue sendQueue(&ta);
+
+            bdlbb::Blob blob(&blobBufferFactory, &ta);
+            ntsd::DataUtil::generateData(&blob, k_MESSAGE_SIZE, 0, 0);
+
+            for (bsl::size_t i = 0; i < 3; ++i) {
+                bsl::shared_ptr<ntsa::Data> data;
+                data.createInplace(&ta, blob, &blobBufferFactory, &ta);
+
+                ntcq::SendQueueEntry sendQueueEntry;
+                sendQueueEntry.setId(sendQueue.generateEntryId());
+                sendQueueEntry.setData(data);
+                sendQueueEntry.setLength(data->size());
+
+                if (i == 0) {
+                    sendQueueEntry.setForeignHandle(handle1);
+                }
+                else if (i == 2) {
+                    sendQueueEntry.setForeignHandle(handle2);
+                }
+
+                sendQueue.pushEntry(sendQueueEntry);
+            }
+
+            ntsa::Data batch(&ta);
+            batch.makeConstBufferArray();
+
+            result = sendQueue.batchNext(&batch.constBufferArray(),
+                                         ntsa::SendOptions());
+            NTCCFG_TEST_FALSE(result);
+
+            NTCCFG_TEST_EQ(sendQueue.frontEntry().foreignHandle(), handle1);
+
+            result = sendQueue.popEntry();
+            NTCCFG_TEST_FALSE(result);
+
+            NTCCFG_TEST_FALSE(ntsu::SocketUtil::isSocket(handle1));
+            NTCCFG_TEST_TRUE(ntsu::SocketUtil::isSocket(handle2));
+
+            NTCCFG_TEST_EQ(sendQueue.frontEntry().foreignHandle(),
+                           ntsa::k_INVALID_HANDLE);
+        }
+
+        NTCCFG_TEST_FALSE(ntsu::SocketUtil::isSocket(handle2));
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(8)
+{
+    // Concern: Progress through a file is tracked across partial sends, and
+    // a file in progress is removed by its token only when requested.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntcq::SendQueue sendQueue(&ta);
+
+        ntsa::File file((bdls::FilesystemUtil::FileDescriptor)(1),
+                        static_cast<bdls::FilesystemUtil::Offset>(0),
+                        static_cast<bdls::FilesystemUtil::Offset>(1000));
+
+        ntca::SendToken token;
+        token.setValue(1);
+
+        {
+            bsl::shared_ptr<ntsa::Data> data;
+            data.createInplace(&ta, file, &ta);
+
+            ntcq::SendQueueEntry sendQueueEntry;
+            sendQueueEntry.setId(sendQueue.generateEntryId());
+            sendQueueEntry.setToken(token);
+            sendQueueEntry.setData(data);
+            sendQueueEntry.setLength(data->size());
+            sendQueueEntry.setProgress(true);
+
+            sendQueue.pushEntry(sendQueueEntry);
+        }
+
+        NTCCFG_TEST_EQ(sendQueue.size(), 1000);
+
+        sendQueue.popSize(300);
+
+        NTCCFG_TEST_EQ(sendQueue.size(), 700);
+        NTCCFG_TEST_EQ(sendQueue.frontEntry().bytesSent(), 300);
+        NTCCFG_TEST_EQ(sendQueue.frontEntry().length(), 700);
+        NTCCFG_TEST_EQ(sendQueue.frontEntry().data()->file().position(), 300);
+        NTCCFG_TEST_TRUE(sendQueue.frontEntry().inProgress());
+        NTCCFG_TEST_TRUE(sendQueue.frontEntry().progress());
+
+        ntci::SendCallback callback;
+        bool               becameEmpty;
+
+        becameEmpty = sendQueue.removeEntryToken(&callback, token, false);
+        NTCCFG_TEST_FALSE(becameEmpty);
+        NTCCFG_TEST_EQ(sendQueue.size(), 700);
+
+        becameEmpty = sendQueue.removeEntryToken(&callback, token, true);
+        NTCCFG_TEST_TRUE(becameEmpty);
+        NTCCFG_TEST_EQ(sendQueue.size(), 0);
+        NTCCFG_TEST_FALSE(sendQueue.hasEntry());
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
@@ -642,5 +776,7 @@ NTCCFG_TEST_DRIVER
     NTCCFG_TEST_REGISTER(4);
     NTCCFG_TEST_REGISTER(5);
     NTCCFG_TEST_REGISTER(6);
+    NTCCFG_TEST_REGISTER(7);
+    NTCCFG_TEST_REGISTER(8);
 }
 NTCCFG_TEST_DRIVER_END;
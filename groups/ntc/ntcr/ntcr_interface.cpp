@@ -190,6 +190,23 @@ bsl::shared_ptr<ntci::Reactor> Interface::addReactor()
         reactorConfig.setMaxCyclesPerWait(d_config.maxCyclesPerWait().value());
     }
 
+    if (!d_config.busyPollDuration().isNull()) {
+        reactorConfig.setBusyPollDuration(d_config.busyPollDuration().value());
+    }
+
+    if (!d_config.busyPollSockets().isNull()) {
+        reactorConfig.setBusyPollSockets(d_config.busyPollSockets().value());
+    }
+
+    if (!d_config.deferInterestChanges().isNull()) {
+        reactorConfig.setDeferInterestChanges(
+            d_config.deferInterestChanges().value());
+    }
+
+    if (!d_config.devicePerWaiter().isNull()) {
+        reactorConfig.setDevicePerWaiter(d_config.devicePerWaiter().value());
+    }
+
     if (!d_config.driverMetrics().isNull()) {
         reactorConfig.setMetricCollection(d_config.driverMetrics().value());
     }
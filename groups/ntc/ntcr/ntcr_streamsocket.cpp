@@ -29,6 +29,7 @@ BSLS_IDENT_RCSID(ntcr_streamsocket_cpp, "$Id$ $CSID$")
 #include <ntcs_blobutil.h>
 #include <ntcs_compat.h>
 #include <ntcs_dispatch.h>
+#include <ntcs_trace.h>
 #include <ntcu_streamsocketsession.h>
 #include <ntcu_streamsocketutil.h>
 #include <ntsa_data.h>
@@ -91,76 +92,133 @@ BSLS_IDENT_RCSID(ntcr_streamsocket_cpp, "$Id$ $CSID$")
     NTCI_LOG_DEBUG("Encryption upgrade failed: %s", details.c_str())
 
 #define NTCR_STREAMSOCKET_LOG_RECEIVE_BUFFER_THROTTLE_APPLIED(timeToSubmit)   \
-    NTCI_LOG_TRACE("Stream socket receive buffer throttle applied for %d "    \
-                   "milliseconds",                                            \
-                   (int)((timeToSubmit).totalMilliseconds()))
+    do {                                                                      \
+        NTCS_TRACE(e_RECEIVE_THROTTLE_APPLIED,                                \
+                   d_publicHandle,                                            \
+                   (timeToSubmit).totalMicroseconds(),                        \
+                   0);                                                        \
+        NTCI_LOG_TRACE("Stream socket receive buffer throttle applied "       \
+                       "for %d milliseconds",                                 \
+                       (int)((timeToSubmit).totalMilliseconds()));            \
+    } while (false)
 
 #define NTCR_STREAMSOCKET_LOG_RECEIVE_BUFFER_THROTTLE_RELAXED()               \
-    NTCI_LOG_TRACE("Stream socket receive buffer throttle relaxed")
+    do {                                                                      \
+        NTCS_TRACE(e_RECEIVE_THROTTLE_RELAXED, d_publicHandle, 0, 0);         \
+        NTCI_LOG_TRACE("Stream socket receive buffer throttle relaxed");      \
+    } while (false)
 
 #define NTCR_STREAMSOCKET_LOG_RECEIVE_BUFFER_UNDERFLOW()                      \
-    NTCI_LOG_TRACE("Stream socket "                                           \
-                   "has emptied the socket receive buffer")
+    do {                                                                      \
+        NTCS_TRACE(e_RECEIVE_BUFFER_UNDERFLOW, d_publicHandle, 0, 0);         \
+        NTCI_LOG_TRACE("Stream socket "                                       \
+                       "has emptied the socket receive buffer");              \
+    } while (false)
 
 #define NTCR_STREAMSOCKET_LOG_RECEIVE_RESULT(context)                         \
-    NTCI_LOG_TRACE("Stream socket "                                           \
-                   "has copied %zu bytes out of %zu bytes attempted from "    \
-                   "the socket receive buffer",                               \
+    do {                                                                      \
+        NTCS_TRACE(e_RECEIVE,                                                 \
+                   d_publicHandle,                                            \
                    (context).bytesReceived(),                                 \
-                   (context).bytesReceivable())
+                   (context).bytesReceivable());                              \
+        NTCI_LOG_TRACE("Stream socket "                                       \
+                       "has copied %zu bytes out of %zu bytes attempted "     \
+                       "from the socket receive buffer",                      \
+                       (context).bytesReceived(),                             \
+                       (context).bytesReceivable());                          \
+    } while (false)
 
 #define NTCR_STREAMSOCKET_LOG_RECEIVE_FAILURE(error)                          \
-    NTCI_LOG_TRACE("Stream socket "                                           \
-                   "failed to receive: %s",                                   \
-                   (error).text().c_str())
+    do {                                                                      \
+        NTCS_TRACE(e_RECEIVE_FAILURE, d_publicHandle, (error).number(), 0);   \
+        NTCI_LOG_TRACE("Stream socket "                                       \
+                       "failed to receive: %s",                               \
+                       (error).text().c_str());                               \
+    } while (false)
 
 #define NTCR_STREAMSOCKET_LOG_READ_QUEUE_FILLED(size)                         \
-    NTCI_LOG_TRACE("Stream socket "                                           \
-                   "has filled the read queue up to %zu bytes",               \
-                   size)
+    do {                                                                      \
+        NTCS_TRACE(e_READ_QUEUE_FILLED, d_publicHandle, size, 0);             \
+        NTCI_LOG_TRACE("Stream socket "                                       \
+                       "has filled the read queue up to %zu bytes",           \
+                       size);                                                 \
+    } while (false)
 
 #define NTCR_STREAMSOCKET_LOG_READ_QUEUE_DRAINED(size)                        \
-    NTCI_LOG_TRACE("Stream socket "                                           \
-                   "has drained the read queue down to %zu bytes",            \
-                   size)
+    do {                                                                      \
+        NTCS_TRACE(e_READ_QUEUE_DRAINED, d_publicHandle, size, 0);            \
+        NTCI_LOG_TRACE("Stream socket "                                       \
+                       "has drained the read queue down to %zu bytes",        \
+                       size);                                                 \
+    } while (false)
 
 #define NTCR_STREAMSOCKET_LOG_END_OF_ENCRYPTION()                             \
     NTCI_LOG_TRACE("Stream socket "                                           \
                    "has read all encrypted data from its peer")
 
 #define NTCR_STREAMSOCKET_LOG_END_OF_FILE()                                   \
-    NTCI_LOG_TRACE("Stream socket "                                           \
-                   "has read all data from its peer")
+    do {                                                                      \
+        NTCS_TRACE(e_END_OF_FILE, d_publicHandle, 0, 0);                      \
+        NTCI_LOG_TRACE("Stream socket "                                       \
+                       "has read all data from its peer");                    \
+    } while (false)
 
 #define NTCR_STREAMSOCKET_LOG_READ_QUEUE_LOW_WATERMARK(lowWatermark, size)    \
-    NTCI_LOG_TRACE("Stream socket "                                           \
-                   "has satisfied the read queue low watermark of %zu "       \
-                   "bytes with a read queue of %zu bytes",                    \
-                   lowWatermark,                                              \
-                   size)
+    do {                                                                      \
+        NTCS_TRACE(e_READ_QUEUE_LOW_WATERMARK,                                \
+                   d_publicHandle,                                            \
+                   size,                                                      \
+                   lowWatermark);                                             \
+        NTCI_LOG_TRACE("Stream socket "                                       \
+                       "has satisfied the read queue low watermark of %zu "   \
+                       "bytes with a read queue of %zu bytes",                \
+                       lowWatermark,                                          \
+                       size);                                                 \
+    } while (false)
 
 #define NTCR_STREAMSOCKET_LOG_READ_QUEUE_HIGH_WATERMARK(highWatermark, size)  \
-    NTCI_LOG_TRACE("Stream socket "                                           \
-                   "has breached the read queue high watermark of %zu "       \
-                   "bytes with a read queue of %zu bytes",                    \
-                   highWatermark,                                             \
-                   size)
+    do {                                                                      \
+        NTCS_TRACE(e_READ_QUEUE_HIGH_WATERMARK,                               \
+                   d_publicHandle,                                            \
+                   size,                                                      \
+                   highWatermark);                                            \
+        NTCI_LOG_TRACE("Stream socket "                                       \
+                       "has breached the read queue high watermark of %zu "   \
+                       "bytes with a read queue of %zu bytes",                \
+                       highWatermark,                                         \
+                       size);                                                 \
+    } while (false)
 
 #define NTCR_STREAMSOCKET_LOG_SHUTDOWN_RECEIVE()                              \
-    NTCI_LOG_TRACE("Stream socket "                                           \
-                   "is shutting down reception")
+    do {                                                                      \
+        NTCS_TRACE(e_SHUTDOWN_RECEIVE, d_publicHandle, 0, 0);                 \
+        NTCI_LOG_TRACE("Stream socket "                                       \
+                       "is shutting down reception");                         \
+    } while (false)
 
 #define NTCR_STREAMSOCKET_LOG_SEND_BUFFER_THROTTLE_APPLIED(timeToSubmit)      \
-    NTCI_LOG_TRACE("Stream socket send buffer throttle applied for %d "       \
-                   "milliseconds",                                            \
-                   (int)((timeToSubmit).totalMilliseconds()))
+    do {                                                                      \
+        NTCS_TRACE(e_SEND_THROTTLE_APPLIED,                                   \
+                   d_publicHandle,                                            \
+                   (timeToSubmit).totalMicroseconds(),                        \
+                   0);                                                        \
+        NTCI_LOG_TRACE("Stream socket send buffer throttle applied for %d "   \
+                       "milliseconds",                                        \
+                       (int)((timeToSubmit).totalMilliseconds()));            \
+    } while (false)
 
 #define NTCR_STREAMSOCKET_LOG_SEND_BUFFER_THROTTLE_RELAXED()                  \
-    NTCI_LOG_TRACE("Stream socket send buffer throttle relaxed")
+    do {                                                                      \
+        NTCS_TRACE(e_SEND_THROTTLE_RELAXED, d_publicHandle, 0, 0);            \
+        NTCI_LOG_TRACE("Stream socket send buffer throttle relaxed");         \
+    } while (false)
 
 #define NTCR_STREAMSOCKET_LOG_SEND_BUFFER_OVERFLOW()                          \
-    NTCI_LOG_TRACE("Stream socket "                                           \
-                   "has saturated the socket send buffer")
+    do {                                                                      \
+        NTCS_TRACE(e_SEND_BUFFER_OVERFLOW, d_publicHandle, 0, 0);             \
+        NTCI_LOG_TRACE("Stream socket "                                       \
+                       "has saturated the socket send buffer");               \
+    } while (false)
 
 #define NTCR_STREAMSOCKET_LOG_SEND_BUFFER_PAGE_LIMIT()                        \
     NTCI_LOG_TRACE("Stream socket "                                           \
@@ -189,54 +247,90 @@ BSLS_IDENT_RCSID(ntcr_streamsocket_cpp, "$Id$ $CSID$")
     NTCI_LOG_DEBUG("Stream socket zero copy is disabled")
 
 #define NTCR_STREAMSOCKET_LOG_SEND_RESULT(context)                            \
-    NTCI_LOG_TRACE("Stream socket "                                           \
-                   "has copied %zu bytes out of %zu bytes attempted to "      \
-                   "the socket send buffer",                                  \
+    do {                                                                      \
+        NTCS_TRACE(e_SEND,                                                    \
+                   d_publicHandle,                                            \
                    (context).bytesSent(),                                     \
-                   (context).bytesSendable())
+                   (context).bytesSendable());                                \
+        NTCI_LOG_TRACE("Stream socket "                                       \
+                       "has copied %zu bytes out of %zu bytes attempted to "  \
+                       "the socket send buffer",                              \
+                       (context).bytesSent(),                                 \
+                       (context).bytesSendable());                            \
+    } while (false)
 
 #define NTCR_STREAMSOCKET_LOG_SEND_FAILURE(error)                             \
-    NTCI_LOG_TRACE("Stream socket "                                           \
-                   "failed to send: %s",                                      \
-                   (error).text().c_str())
+    do {                                                                      \
+        NTCS_TRACE(e_SEND_FAILURE, d_publicHandle, (error).number(), 0);      \
+        NTCI_LOG_TRACE("Stream socket "                                       \
+                       "failed to send: %s",                                  \
+                       (error).text().c_str());                               \
+    } while (false)
 
 #define NTCR_STREAMSOCKET_LOG_WRITE_QUEUE_FILLED(size, highWatermark)         \
-    NTCI_LOG_TRACE("Stream socket "                                           \
-                   "has filled the write queue up to %zu bytes (%.1f%% of "   \
-                   "the high watermark of %zu bytes)",                        \
+    do {                                                                      \
+        NTCS_TRACE(e_WRITE_QUEUE_FILLED,                                      \
+                   d_publicHandle,                                            \
                    size,                                                      \
-                   static_cast<double>((static_cast<double>(size) /           \
-                                        static_cast<double>(highWatermark)) * \
-                                       100.0),                                \
-                   highWatermark)
+                   highWatermark);                                            \
+        NTCI_LOG_TRACE("Stream socket "                                       \
+                       "has filled the write queue up to %zu bytes (%.1f%% "  \
+                       "of the high watermark of %zu bytes)",                 \
+                       size,                                                  \
+                       (static_cast<double>(size) /                           \
+                        static_cast<double>(highWatermark)) *                 \
+                           100.0,                                             \
+                       highWatermark);                                        \
+    } while (false)
 
 #define NTCR_STREAMSOCKET_LOG_WRITE_QUEUE_DRAINED(size, highWatermark)        \
-    NTCI_LOG_TRACE("Stream socket "                                           \
-                   "has drained the write queue down to %zu bytes (%.1f%% "   \
-                   "of the high watermark of %zu bytes)",                     \
+    do {                                                                      \
+        NTCS_TRACE(e_WRITE_QUEUE_DRAINED,                                     \
+                   d_publicHandle,                                            \
                    size,                                                      \
-                   static_cast<double>((static_cast<double>(size) /           \
-                                        static_cast<double>(highWatermark)) * \
-                                       100.0),                                \
-                   highWatermark)
+                   highWatermark);                                            \
+        NTCI_LOG_TRACE("Stream socket "                                       \
+                       "has drained the write queue down to %zu bytes "       \
+                       "(%.1f%% of the high watermark of %zu bytes)",         \
+                       size,                                                  \
+                       (static_cast<double>(size) /                           \
+                        static_cast<double>(highWatermark)) *                 \
+                           100.0,                                             \
+                       highWatermark);                                        \
+    } while (false)
 
 #define NTCR_STREAMSOCKET_LOG_WRITE_QUEUE_LOW_WATERMARK(lowWatermark, size)   \
-    NTCI_LOG_TRACE("Stream socket "                                           \
-                   "has satisfied the write queue low watermark of %zu "      \
-                   "bytes with a write queue of %zu bytes",                   \
-                   lowWatermark,                                              \
-                   size)
+    do {                                                                      \
+        NTCS_TRACE(e_WRITE_QUEUE_LOW_WATERMARK,                               \
+                   d_publicHandle,                                            \
+                   size,                                                      \
+                   lowWatermark);                                             \
+        NTCI_LOG_TRACE("Stream socket "                                       \
+                       "has satisfied the write queue low watermark of %zu "  \
+                       "bytes with a write queue of %zu bytes",               \
+                       lowWatermark,                                          \
+                       size);                                                 \
+    } while (false)
 
 #define NTCR_STREAMSOCKET_LOG_WRITE_QUEUE_HIGH_WATERMARK(highWatermark, size) \
-    NTCI_LOG_TRACE("Stream socket "                                           \
-                   "has breached the write queue high watermark of %d "       \
-                   "bytes with a write queue of %d bytes",                    \
-                   highWatermark,                                             \
-                   size)
+    do {                                                                      \
+        NTCS_TRACE(e_WRITE_QUEUE_HIGH_WATERMARK,                              \
+                   d_publicHandle,                                            \
+                   size,                                                      \
+                   highWatermark);                                            \
+        NTCI_LOG_TRACE("Stream socket "                                       \
+                       "has breached the write queue high watermark of %d "   \
+                       "bytes with a write queue of %d bytes",                \
+                       highWatermark,                                         \
+                       size);                                                 \
+    } while (false)
 
 #define NTCR_STREAMSOCKET_LOG_SHUTDOWN_SEND()                                 \
-    NTCI_LOG_TRACE("Stream socket "                                           \
-                   "is shutting down transmission")
+    do {                                                                      \
+        NTCS_TRACE(e_SHUTDOWN_SEND, d_publicHandle, 0, 0);                    \
+        NTCI_LOG_TRACE("Stream socket "                                       \
+                       "is shutting down transmission");                      \
+    } while (false)
 
 #define NTCR_STREAMSOCKET_LOG_TIMESTAMP_PROCESSING_ERROR()                    \
     NTCI_LOG_WARN("Stream socket timestamp processing error")
@@ -307,40 +401,15 @@ void StreamSocket::processSocketReadable(const ntca::ReactorEvent& event)
         return;
     }
 
-    if (!d_shutdownState.canReceive()) {
-        return;
-    }
-
-    ntsa::Error error;
-    bsl::size_t numIterations = 0;
-
-    while (true) {
-        ++numIterations;
-
-        error = this->privateSocketReadableIteration(self);
-        if (error) {
-            break;
-        }
-
-        if (!d_receiveGreedily) {
-            break;
-        }
+    // If the receive budget was exhausted during a previous event, the
+    // remaining data is received by the pending continuation, which runs
+    // after the rest of the events detected in this wait cycle.
 
-        if (!d_shutdownState.canReceive()) {
-            break;
-        }
-    }
-
-    if (numIterations > 0) {
-        NTCS_METRICS_UPDATE_RECEIVE_ITERATIONS(numIterations);
+    if (d_receiveContinuationPending) {
+        return;
     }
 
-    if (error && error != ntsa::Error::e_WOULD_BLOCK) {
-        this->privateFail(self, error);
-    }
-    else {
-        this->privateRearmAfterReceive(self);
-    }
+    this->privateSocketReadable(self);
 }
 
 void StreamSocket::processSocketWritable(const ntca::ReactorEvent& event)
@@ -370,40 +439,73 @@ void StreamSocket::processSocketWritable(const ntca::ReactorEvent& event)
         return;
     }
 
-    if (!d_shutdownState.canSend()) {
+    // If the send budget was exhausted during a previous event, the
+    // remaining data is sent by the pending continuation, which runs after
+    // the rest of the events detected in this wait cycle.
+
+    if (d_sendContinuationPending) {
         return;
     }
 
-    ntsa::Error error;
-    bsl::size_t numIterations = 0;
+    this->privateSocketWritable(self);
+}
 
-    while (d_sendQueue.hasEntry()) {
-        ++numIterations;
+void StreamSocket::processSocketReadableContinuation()
+{
+    NTCCFG_OBJECT_GUARD(&d_object);
 
-        error = this->privateSocketWritableIteration(self);
-        if (error) {
-            break;
-        }
+    bsl::shared_ptr<StreamSocket> self = this->getSelf(this);
 
-        if (!d_sendGreedily) {
-            break;
-        }
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
-        if (!d_shutdownState.canSend()) {
-            break;
-        }
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_CONTEXT_GUARD_DESCRIPTOR(d_publicHandle);
+    NTCI_LOG_CONTEXT_GUARD_SOURCE_ENDPOINT(d_sourceEndpoint);
+    NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
+
+    d_receiveContinuationPending = false;
+
+    if (NTCCFG_UNLIKELY(d_detachState.get() ==
+                        ntcs::DetachState::e_DETACH_INITIATED))
+    {
+        return;
     }
 
-    if (numIterations > 0) {
-        NTCS_METRICS_UPDATE_SEND_ITERATIONS(numIterations);
+    if (!d_flowControlState.wantReceive()) {
+        return;
     }
 
-    if (error && error != ntsa::Error::e_WOULD_BLOCK) {
-        this->privateFail(self, error);
+    this->privateSocketReadable(self);
+}
+
+void StreamSocket::processSocketWritableContinuation()
+{
+    NTCCFG_OBJECT_GUARD(&d_object);
+
+    bsl::shared_ptr<StreamSocket> self = this->getSelf(this);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_CONTEXT_GUARD_DESCRIPTOR(d_publicHandle);
+    NTCI_LOG_CONTEXT_GUARD_SOURCE_ENDPOINT(d_sourceEndpoint);
+    NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
+
+    d_sendContinuationPending = false;
+
+    if (NTCCFG_UNLIKELY(d_detachState.get() ==
+                        ntcs::DetachState::e_DETACH_INITIATED))
+    {
+        return;
     }
-    else {
-        this->privateRearmAfterSend(self);
+
+    if (!d_flowControlState.wantSend()) {
+        return;
     }
+
+    this->privateSocketWritable(self);
 }
 
 void StreamSocket::processSocketError(const ntca::ReactorEvent& event)
@@ -810,6 +912,126 @@ void StreamSocket::privateEncryptionHandshake(
     }
 }
 
+void StreamSocket::privateSocketReadable(
+    const bsl::shared_ptr<StreamSocket>& self)
+{
+    if (!d_shutdownState.canReceive()) {
+        return;
+    }
+
+    ntsa::Error error;
+    bsl::size_t numIterations      = 0;
+    bool        budgetExhausted    = false;
+    bsl::size_t totalBytesReceived = d_totalBytesReceived;
+
+    while (true) {
+        ++numIterations;
+
+        error = this->privateSocketReadableIteration(self);
+        if (error) {
+            break;
+        }
+
+        if (!d_receiveGreedily) {
+            break;
+        }
+
+        if (!d_shutdownState.canReceive()) {
+            break;
+        }
+
+        if (d_receiveBudget != 0 &&
+            d_totalBytesReceived - totalBytesReceived >= d_receiveBudget)
+        {
+            budgetExhausted = true;
+            break;
+        }
+    }
+
+    if (numIterations > 0) {
+        NTCS_METRICS_UPDATE_RECEIVE_ITERATIONS(numIterations);
+    }
+
+    if (error && error != ntsa::Error::e_WOULD_BLOCK) {
+        this->privateFail(self, error);
+    }
+    else if (budgetExhausted) {
+        // Yield to the other sockets driven by the reactor and continue
+        // receiving once the reactor has processed the rest of the events
+        // detected in this wait cycle. The socket remains readable, so
+        // there is no need to poll the operating system to learn so.
+
+        d_receiveContinuationPending = true;
+
+        this->execute(bdlf::BindUtil::bind(
+            &StreamSocket::processSocketReadableContinuation,
+            self));
+    }
+    else {
+        this->privateRearmAfterReceive(self);
+    }
+}
+
+void StreamSocket::privateSocketWritable(
+    const bsl::shared_ptr<StreamSocket>& self)
+{
+    if (!d_shutdownState.canSend()) {
+        return;
+    }
+
+    ntsa::Error error;
+    bsl::size_t numIterations   = 0;
+    bool        budgetExhausted = false;
+    bsl::size_t totalBytesSent  = d_totalBytesSent;
+
+    while (d_sendQueue.hasEntry()) {
+        ++numIterations;
+
+        error = this->privateSocketWritableIteration(self);
+        if (error) {
+            break;
+        }
+
+        if (!d_sendGreedily) {
+            break;
+        }
+
+        if (!d_shutdownState.canSend()) {
+            break;
+        }
+
+        if (d_sendBudget != 0 &&
+            d_totalBytesSent - totalBytesSent >= d_sendBudget)
+        {
+            budgetExhausted = d_sendQueue.hasEntry();
+            break;
+        }
+    }
+
+    if (numIterations > 0) {
+        NTCS_METRICS_UPDATE_SEND_ITERATIONS(numIterations);
+    }
+
+    if (error && error != ntsa::Error::e_WOULD_BLOCK) {
+        this->privateFail(self, error);
+    }
+    else if (budgetExhausted) {
+        // Yield to the other sockets driven by the reactor and continue
+        // sending once the reactor has processed the rest of the events
+        // detected in this wait cycle. The socket remains writable, so
+        // there is no need to poll the operating system to learn so.
+
+        d_sendContinuationPending = true;
+
+        this->execute(bdlf::BindUtil::bind(
+            &StreamSocket::processSocketWritableContinuation,
+            self));
+    }
+    else {
+        this->privateRearmAfterSend(self);
+    }
+}
+
 ntsa::Error StreamSocket::privateSocketReadableIteration(
     const bsl::shared_ptr<StreamSocket>& self)
 {
@@ -834,6 +1056,10 @@ ntsa::Error StreamSocket::privateSocketReadableIteration(
         entry.setLength(context.bytesReceived());
         entry.setTimestamp(bsls::TimeUtil::getTimer());
 
+        if (NTCCFG_UNLIKELY(!context.foreignHandle().isNull())) {
+            entry.setForeignHandle(context.foreignHandle().value());
+        }
+
         d_receiveQueue.pushEntry(entry);
     }
 
@@ -910,6 +1136,13 @@ ntsa::Error StreamSocket::privateSocketReadableIteration(
         receiveContext.setTransport(d_transport);
         receiveContext.setEndpoint(d_remoteEndpoint);
 
+        ntsa::Handle foreignHandle = ntsa::k_INVALID_HANDLE;
+        while (
+            NTCCFG_UNLIKELY(d_receiveQueue.popForeignHandle(&foreignHandle)))
+        {
+            receiveContext.addForeignHandle(foreignHandle);
+        }
+
         ntca::ReceiveEvent receiveEvent;
         receiveEvent.setType(ntca::ReceiveEventType::e_COMPLETE);
         receiveEvent.setContext(receiveContext);
@@ -1181,7 +1414,10 @@ ntsa::Error StreamSocket::privateSocketWritableIterationBatch(
     ntsa::Error       error;
     ntsa::SendContext context;
 
-    error = this->privateEnqueueSendBuffer(self, &context, *d_sendData_sp);
+    error = this->privateEnqueueSendBuffer(self,
+                                           &context,
+                                           *d_sendData_sp,
+                                           ntsa::k_INVALID_HANDLE);
     if (NTCCFG_UNLIKELY(error)) {
         return error;
     }
@@ -1325,11 +1561,19 @@ ntsa::Error StreamSocket::privateSocketWritableIterationFront(
     ntcq::SendQueueEntry& entry = d_sendQueue.frontEntry();
 
     if (NTCCFG_LIKELY(entry.data())) {
-        error = this->privateEnqueueSendBuffer(self, &context, *entry.data());
+        error = this->privateEnqueueSendBuffer(self,
+                                               &context,
+                                               *entry.data(),
+                                               entry.foreignHandle());
         if (NTCCFG_UNLIKELY(error)) {
             return error;
         }
 
+        // The foreign handle, if any, has been passed to the peer along with
+        // the first byte sent, so close this socket's duplicate of it.
+
+        entry.closeForeignHandle();
+
         const bool hasDeadline = !entry.deadline().isNull();
 
         if (hasDeadline) {
@@ -1377,6 +1621,25 @@ ntsa::Error StreamSocket::privateSocketWritableIterationFront(
         }
         else {
             d_sendQueue.popSize(context.bytesSent());
+
+            if (NTCCFG_UNLIKELY(entry.progress() && entry.callback())) {
+                ntca::SendContext sendContext;
+                sendContext.setBytesSent(entry.bytesSent());
+                sendContext.setBytesRemaining(entry.length());
+
+                ntca::SendEvent sendEvent;
+                sendEvent.setType(ntca::SendEventType::e_PROGRESS);
+                sendEvent.setContext(sendContext);
+
+                ntci::SendCallback progressCallback = entry.callback();
+
+                progressCallback.dispatch(self,
+                                          sendEvent,
+                                          d_reactorStrand_sp,
+                                          self,
+                                          false,
+                                          &d_mutex);
+            }
         }
 
         NTCR_STREAMSOCKET_LOG_WRITE_QUEUE_DRAINED(d_sendQueue.size(),
@@ -2656,7 +2919,8 @@ ntsa::Error StreamSocket::privateThrottleReceiveBuffer(
 ntsa::Error StreamSocket::privateEnqueueSendBuffer(
     const bsl::shared_ptr<StreamSocket>& self,
     ntsa::SendContext*                   context,
-    const bdlbb::Blob&                   data)
+    const bdlbb::Blob&                   data,
+    ntsa::Handle                         foreignHandle)
 {
     NTCI_LOG_CONTEXT();
 
@@ -2705,6 +2969,10 @@ ntsa::Error StreamSocket::privateEnqueueSendBuffer(
         options.setZeroCopy(true);
     }
 
+    if (NTCCFG_UNLIKELY(foreignHandle != ntsa::k_INVALID_HANDLE)) {
+        options.setForeignHandle(foreignHandle);
+    }
+
     bsls::TimeInterval timestamp;
     if (d_timestampOutgoingData) {
         timestamp = this->currentTime();
@@ -2756,7 +3024,8 @@ ntsa::Error StreamSocket::privateEnqueueSendBuffer(
 ntsa::Error StreamSocket::privateEnqueueSendBuffer(
     const bsl::shared_ptr<StreamSocket>& self,
     ntsa::SendContext*                   context,
-    const ntsa::Data&                    data)
+    const ntsa::Data&                    data,
+    ntsa::Handle                         foreignHandle)
 {
     NTCI_LOG_CONTEXT();
 
@@ -2805,6 +3074,10 @@ ntsa::Error StreamSocket::privateEnqueueSendBuffer(
         options.setZeroCopy(true);
     }
 
+    if (NTCCFG_UNLIKELY(foreignHandle != ntsa::k_INVALID_HANDLE)) {
+        options.setForeignHandle(foreignHandle);
+    }
+
     bsls::TimeInterval timestamp;
     if (d_timestampOutgoingData) {
         timestamp = this->currentTime();
@@ -2862,6 +3135,10 @@ ntsa::Error StreamSocket::privateDequeueReceiveBuffer(
 
     if (NTCCFG_LIKELY(!d_encryption_sp)) {
 #if NTCR_STREAMSOCKET_RECEIVE_FEEDBACK
+        if (d_receiveFeedback.current() <= d_receiveCopyThreshold) {
+            return this->privateDequeueReceiveBufferCopy(self, context, data);
+        }
+
         ntcs::BlobBufferUtil::reserveCapacity(data,
                                               d_incomingBufferFactory_sp.get(),
                                               d_metrics_sp.get(),
@@ -3016,13 +3293,60 @@ ntsa::Error StreamSocket::privateDequeueReceiveBuffer(
     }
 }
 
+ntsa::Error StreamSocket::privateDequeueReceiveBufferCopy(
+    const bsl::shared_ptr<StreamSocket>& self,
+    ntsa::ReceiveContext*                context,
+    bdlbb::Blob*                         data)
+{
+    ntsa::Error error;
+
+    const bsl::size_t size   = d_receiveFeedback.current();
+    char*             buffer = ntcs::BlobBufferUtil::threadLocalBuffer(size);
+
+    ntsa::Data scratch(ntsa::MutableBuffer(buffer, size));
+
+    error = this->privateDequeueReceiveBufferRaw(self, context, &scratch);
+    if (error) {
+        return error;
+    }
+
+    ntcs::BlobBufferUtil::copy(data,
+                               d_incomingBufferFactory_sp.get(),
+                               d_metrics_sp.get(),
+                               buffer,
+                               context->bytesReceived());
+
+    return ntsa::Error();
+}
+
 ntsa::Error StreamSocket::privateDequeueReceiveBufferRaw(
     const bsl::shared_ptr<StreamSocket>& self,
     ntsa::ReceiveContext*                context,
     bdlbb::Blob*                         data)
 {
-    NTCI_LOG_CONTEXT();
+    ntsa::Error error;
+
+    if (!d_socket_sp) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    if (NTCCFG_UNLIKELY(d_receiveRateLimiter_sp)) {
+        error = this->privateThrottleReceiveBuffer(self);
+        if (error) {
+            return error;
+        }
+    }
+
+    error = d_socket_sp->receive(context, data, d_receiveOptions);
+
+    return this->privateDequeueReceiveBufferComplete(self, context, error);
+}
 
+ntsa::Error StreamSocket::privateDequeueReceiveBufferRaw(
+    const bsl::shared_ptr<StreamSocket>& self,
+    ntsa::ReceiveContext*                context,
+    ntsa::Data*                          data)
+{
     ntsa::Error error;
 
     if (!d_socket_sp) {
@@ -3038,6 +3362,16 @@ ntsa::Error StreamSocket::privateDequeueReceiveBufferRaw(
 
     error = d_socket_sp->receive(context, data, d_receiveOptions);
 
+    return this->privateDequeueReceiveBufferComplete(self, context, error);
+}
+
+ntsa::Error StreamSocket::privateDequeueReceiveBufferComplete(
+    const bsl::shared_ptr<StreamSocket>& self,
+    ntsa::ReceiveContext*                context,
+    ntsa::Error                          error)
+{
+    NTCI_LOG_CONTEXT();
+
     if (d_receiveOptions.wantTimestamp()) {
         const bdlb::NullableValue<bsls::TimeInterval>& softwareTs =
             context->softwareTimestamp();
@@ -3175,8 +3509,16 @@ ntsa::Error StreamSocket::privateSendRaw(
     ntsa::Error       error;
     ntsa::SendContext context;
 
+    ntsa::Handle foreignHandle = ntsa::k_INVALID_HANDLE;
+    if (NTCCFG_UNLIKELY(!options.foreignHandle().isNull())) {
+        foreignHandle = options.foreignHandle().value();
+    }
+
     if (NTCCFG_LIKELY(!d_sendQueue.hasEntry())) {
-        error = this->privateEnqueueSendBuffer(self, &context, data);
+        error = this->privateEnqueueSendBuffer(self,
+                                               &context,
+                                               data,
+                                               foreignHandle);
         if (NTCCFG_UNLIKELY(error)) {
             if (NTCCFG_UNLIKELY(error != ntsa::Error::e_WOULD_BLOCK)) {
                 return error;
@@ -3213,6 +3555,21 @@ ntsa::Error StreamSocket::privateSendRaw(
 
     BSLS_ASSERT(context.bytesSent() < static_cast<bsl::size_t>(data.length()));
 
+    // If the foreign handle, if any, has not yet been passed to the peer,
+    // queue a duplicate of it with the remaining data, since the handle itself
+    // remains owned by the caller.
+
+    ntsa::Handle foreignHandleDuplicate = ntsa::k_INVALID_HANDLE;
+    if (NTCCFG_UNLIKELY(foreignHandle != ntsa::k_INVALID_HANDLE &&
+                        context.bytesSent() == 0))
+    {
+        error = ntsf::System::duplicate(&foreignHandleDuplicate,
+                                        foreignHandle);
+        if (error) {
+            return error;
+        }
+    }
+
     bsl::shared_ptr<ntsa::Data> dataContainer =
         d_dataPool_sp->createOutgoingData();
 
@@ -3236,6 +3593,9 @@ ntsa::Error StreamSocket::privateSendRaw(
     entry.setLength(dataContainer->blob().length());
     entry.setTimestamp(bsls::TimeUtil::getTimer());
     entry.setZeroCopy(context.zeroCopy());
+    entry.setForeignHandle(foreignHandleDuplicate);
+    entry.setBytesSent(context.bytesSent());
+    entry.setProgress(options.progress());
 
     if (callback && !context.zeroCopy()) {
         entry.setCallback(callback);
@@ -3296,8 +3656,16 @@ ntsa::Error StreamSocket::privateSendRaw(
     ntsa::Error       error;
     ntsa::SendContext context;
 
+    ntsa::Handle foreignHandle = ntsa::k_INVALID_HANDLE;
+    if (NTCCFG_UNLIKELY(!options.foreignHandle().isNull())) {
+        foreignHandle = options.foreignHandle().value();
+    }
+
     if (NTCCFG_LIKELY(!d_sendQueue.hasEntry())) {
-        error = this->privateEnqueueSendBuffer(self, &context, data);
+        error = this->privateEnqueueSendBuffer(self,
+                                               &context,
+                                               data,
+                                               foreignHandle);
         if (NTCCFG_UNLIKELY(error)) {
             if (NTCCFG_UNLIKELY(error != ntsa::Error::e_WOULD_BLOCK)) {
                 return error;
@@ -3337,6 +3705,21 @@ ntsa::Error StreamSocket::privateSendRaw(
 
     BSLS_ASSERT(context.bytesSent() < data.size());
 
+    // If the foreign handle, if any, has not yet been passed to the peer,
+    // queue a duplicate of it with the remaining data, since the handle itself
+    // remains owned by the caller.
+
+    ntsa::Handle foreignHandleDuplicate = ntsa::k_INVALID_HANDLE;
+    if (NTCCFG_UNLIKELY(foreignHandle != ntsa::k_INVALID_HANDLE &&
+                        context.bytesSent() == 0))
+    {
+        error = ntsf::System::duplicate(&foreignHandleDuplicate,
+                                        foreignHandle);
+        if (error) {
+            return error;
+        }
+    }
+
     bsl::shared_ptr<ntsa::Data> dataContainer =
         d_dataPool_sp->createOutgoingData();
 
@@ -3360,6 +3743,9 @@ ntsa::Error StreamSocket::privateSendRaw(
     entry.setLength(dataContainer->size());
     entry.setTimestamp(bsls::TimeUtil::getTimer());
     entry.setZeroCopy(context.zeroCopy());
+    entry.setForeignHandle(foreignHandleDuplicate);
+    entry.setBytesSent(context.bytesSent());
+    entry.setProgress(options.progress());
 
     if (callback) {
         entry.setCallback(callback);
@@ -4560,6 +4946,8 @@ StreamSocket::StreamSocket(
 , d_sendRateLimiter_sp()
 , d_sendRateTimer_sp()
 , d_sendGreedily(NTCCFG_DEFAULT_STREAM_SOCKET_WRITE_GREEDILY)
+, d_sendBudget(0)
+, d_sendContinuationPending(false)
 , d_sendComplete(basicAllocator)
 , d_sendCounter(0)
 , d_sendData_sp()
@@ -4569,6 +4957,9 @@ StreamSocket::StreamSocket(
 , d_receiveRateLimiter_sp()
 , d_receiveRateTimer_sp()
 , d_receiveGreedily(NTCCFG_DEFAULT_STREAM_SOCKET_READ_GREEDILY)
+, d_receiveBudget(0)
+, d_receiveContinuationPending(false)
+, d_receiveCopyThreshold(0)
 , d_receiveBlob_sp()
 , d_connectEndpoint()
 , d_connectName(basicAllocator)
@@ -4628,6 +5019,10 @@ StreamSocket::StreamSocket(
         d_sendGreedily = d_options.sendGreedily().value();
     }
 
+    if (!d_options.sendBudget().isNull()) {
+        d_sendBudget = d_options.sendBudget().value();
+    }
+
     if (!d_options.readQueueLowWatermark().isNull()) {
         d_receiveQueue.setLowWatermark(
             d_options.readQueueLowWatermark().value());
@@ -4652,6 +5047,20 @@ StreamSocket::StreamSocket(
         d_receiveGreedily = d_options.receiveGreedily().value();
     }
 
+    if (!d_options.receiveBudget().isNull()) {
+        d_receiveBudget = d_options.receiveBudget().value();
+    }
+
+    if (!d_options.receiveCopyThreshold().isNull()) {
+        d_receiveCopyThreshold = d_options.receiveCopyThreshold().value();
+    }
+
+    if (!d_options.receiveForeignHandles().isNull()) {
+        if (d_options.receiveForeignHandles().value()) {
+            d_receiveOptions.showForeignHandles();
+        }
+    }
+
     if (reactor->maxThreads() > 1) {
         d_reactorStrand_sp = reactor->createStrand(d_allocator_p);
     }
@@ -5309,6 +5718,13 @@ ntsa::Error StreamSocket::send(const bdlbb::Blob&        data,
         return ntsa::Error(ntsa::Error::e_INVALID);
     }
 
+    if (NTCCFG_UNLIKELY(!options.foreignHandle().isNull())) {
+        if (d_transport != ntsa::Transport::e_LOCAL_STREAM || d_encryption_sp)
+        {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+    }
+
     bsl::size_t effectiveHighWatermark = d_sendQueue.highWatermark();
     if (!options.highWatermark().isNull()) {
         effectiveHighWatermark = options.highWatermark().value();
@@ -5383,6 +5799,13 @@ ntsa::Error StreamSocket::send(const ntsa::Data&         data,
         return ntsa::Error(ntsa::Error::e_INVALID);
     }
 
+    if (NTCCFG_UNLIKELY(!options.foreignHandle().isNull())) {
+        if (d_transport != ntsa::Transport::e_LOCAL_STREAM || d_encryption_sp)
+        {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+    }
+
     bsl::size_t effectiveHighWatermark = d_sendQueue.highWatermark();
     if (!options.highWatermark().isNull()) {
         effectiveHighWatermark = options.highWatermark().value();
@@ -5498,6 +5921,13 @@ ntsa::Error StreamSocket::receive(ntca::ReceiveContext*       context,
         context->setTransport(d_transport);
         context->setEndpoint(d_remoteEndpoint);
 
+        ntsa::Handle foreignHandle = ntsa::k_INVALID_HANDLE;
+        while (
+            NTCCFG_UNLIKELY(d_receiveQueue.popForeignHandle(&foreignHandle)))
+        {
+            context->addForeignHandle(foreignHandle);
+        }
+
         ntcs::BlobUtil::append(data, d_receiveQueue.data(), numBytesDequeued);
 
         ntcs::BlobUtil::pop(d_receiveQueue.data(), numBytesDequeued);
@@ -5642,6 +6072,13 @@ ntsa::Error StreamSocket::receive(const ntca::ReceiveOptions&  options,
         receiveContext.setTransport(d_transport);
         receiveContext.setEndpoint(d_remoteEndpoint);
 
+        ntsa::Handle foreignHandle = ntsa::k_INVALID_HANDLE;
+        while (
+            NTCCFG_UNLIKELY(d_receiveQueue.popForeignHandle(&foreignHandle)))
+        {
+            receiveContext.addForeignHandle(foreignHandle);
+        }
+
         ntca::ReceiveEvent receiveEvent;
         receiveEvent.setType(ntca::ReceiveEventType::e_COMPLETE);
         receiveEvent.setContext(receiveContext);
@@ -6326,7 +6763,8 @@ ntsa::Error StreamSocket::cancel(const ntca::SendToken& token)
     NTCI_LOG_CONTEXT_GUARD_REMOTE_ENDPOINT(d_remoteEndpoint);
 
     ntci::SendCallback callback;
-    bool becameEmpty = d_sendQueue.removeEntryToken(&callback, token);
+    bool becameEmpty =
+        d_sendQueue.removeEntryToken(&callback, token, true);
 
     if (becameEmpty) {
         this->privateApplyFlowControl(self,
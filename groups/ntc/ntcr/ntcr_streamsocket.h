@@ -115,6 +115,8 @@ class StreamSocket : public ntci::StreamSocket,
     bsl::shared_ptr<ntci::RateLimiter>         d_sendRateLimiter_sp;
     bsl::shared_ptr<ntci::Timer>               d_sendRateTimer_sp;
     bool                                       d_sendGreedily;
+    bsl::size_t                                d_sendBudget;
+    bool                                       d_sendContinuationPending;
     ntci::SendCallback                         d_sendComplete;
     ntcq::SendCounter                          d_sendCounter;
     bsl::shared_ptr<ntsa::Data>                d_sendData_sp;
@@ -124,6 +126,9 @@ class StreamSocket : public ntci::StreamSocket,
     bsl::shared_ptr<ntci::RateLimiter>         d_receiveRateLimiter_sp;
     bsl::shared_ptr<ntci::Timer>               d_receiveRateTimer_sp;
     bool                                       d_receiveGreedily;
+    bsl::size_t                                d_receiveBudget;
+    bool                                       d_receiveContinuationPending;
+    bsl::size_t                                d_receiveCopyThreshold;
     bsl::shared_ptr<bdlbb::Blob>               d_receiveBlob_sp;
     ntsa::Endpoint                             d_connectEndpoint;
     bsl::string                                d_connectName;
@@ -165,6 +170,14 @@ class StreamSocket : public ntci::StreamSocket,
     void processSocketWritable(const ntca::ReactorEvent& event)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Continue receiving from the socket after the receive budget was
+    /// exhausted while processing its most recent readability.
+    void processSocketReadableContinuation();
+
+    /// Continue sending to the socket after the send budget was exhausted
+    /// while processing its most recent writability.
+    void processSocketWritableContinuation();
+
     /// Process the specified 'error' for the socket.
     void processSocketError(const ntca::ReactorEvent& event)
         BSLS_KEYWORD_OVERRIDE;
@@ -218,6 +231,13 @@ class StreamSocket : public ntci::StreamSocket,
         const bsl::shared_ptr<ntci::EncryptionCertificate>& certificate,
         const bsl::string&                                  details);
 
+    /// Process the readability of the socket by performing read iterations
+    /// until the socket would block, unless receiving greedily is disabled,
+    /// or the receive budget is exhausted, in which case the remaining data
+    /// is received after the reactor processes the rest of the events
+    /// detected in its current wait cycle.
+    void privateSocketReadable(const bsl::shared_ptr<StreamSocket>& self);
+
     /// Process the readability of the socket by performing one read
     /// iteration.
     ntsa::Error privateSocketReadableIteration(
@@ -228,6 +248,13 @@ class StreamSocket : public ntci::StreamSocket,
     ntsa::Error privateSocketWritableConnection(
         const bsl::shared_ptr<StreamSocket>& self);
 
+    /// Process the writability of the socket by performing write iterations
+    /// until the socket would block or the write queue is empty, unless
+    /// sending greedily is disabled, or the send budget is exhausted, in
+    /// which case the remaining data is sent after the reactor processes
+    /// the rest of the events detected in its current wait cycle.
+    void privateSocketWritable(const bsl::shared_ptr<StreamSocket>& self);
+
     /// Process the writability of the socket by performing one write
     /// iteration.
     ntsa::Error privateSocketWritableIteration(
@@ -365,19 +392,23 @@ class StreamSocket : public ntci::StreamSocket,
     ntsa::Error privateThrottleReceiveBuffer(
         const bsl::shared_ptr<StreamSocket>& self);
 
-    /// Enqueue the specified 'data' to the socket send buffer. Return the
-    /// error.
+    /// Enqueue the specified 'data' to the socket send buffer along with
+    /// the specified 'foreignHandle', unless 'foreignHandle' is
+    /// 'ntsa::k_INVALID_HANDLE'. Return the error.
     ntsa::Error privateEnqueueSendBuffer(
         const bsl::shared_ptr<StreamSocket>& self,
         ntsa::SendContext*                   context,
-        const bdlbb::Blob&                   data);
+        const bdlbb::Blob&                   data,
+        ntsa::Handle                         foreignHandle);
 
-    /// Enqueue the specified 'data' to the socket send buffer. Return the
-    /// error.
+    /// Enqueue the specified 'data' to the socket send buffer along with
+    /// the specified 'foreignHandle', unless 'foreignHandle' is
+    /// 'ntsa::k_INVALID_HANDLE'. Return the error.
     ntsa::Error privateEnqueueSendBuffer(
         const bsl::shared_ptr<StreamSocket>& self,
         ntsa::SendContext*                   context,
-        const ntsa::Data&                    data);
+        const ntsa::Data&                    data,
+        ntsa::Handle                         foreignHandle);
 
     /// Dequeue data from the socket receive buffer. Append to the
     /// specified 'data' the data dequeued. Return the error.
@@ -386,6 +417,14 @@ class StreamSocket : public ntci::StreamSocket,
         ntsa::ReceiveContext*                context,
         bdlbb::Blob*                         data);
 
+    /// Dequeue raw data from the socket receive buffer into a buffer shared
+    /// by all sockets driven by the calling thread, then append to the
+    /// specified 'data' only the data dequeued. Return the error.
+    ntsa::Error privateDequeueReceiveBufferCopy(
+        const bsl::shared_ptr<StreamSocket>& self,
+        ntsa::ReceiveContext*                context,
+        bdlbb::Blob*                         data);
+
     /// Dequeue raw or encrypted data from the socket receive buffer. Append
     /// to the specified 'data' the data dequeued . Return the error.
     ntsa::Error privateDequeueReceiveBufferRaw(
@@ -393,6 +432,20 @@ class StreamSocket : public ntci::StreamSocket,
         ntsa::ReceiveContext*                context,
         bdlbb::Blob*                         data);
 
+    /// Dequeue raw or encrypted data from the socket receive buffer into the
+    /// specified 'data'. Return the error.
+    ntsa::Error privateDequeueReceiveBufferRaw(
+        const bsl::shared_ptr<StreamSocket>& self,
+        ntsa::ReceiveContext*                context,
+        ntsa::Data*                          data);
+
+    /// Process the result of dequeuing data from the socket receive buffer
+    /// described by the specified 'context' and 'error'. Return the error.
+    ntsa::Error privateDequeueReceiveBufferComplete(
+        const bsl::shared_ptr<StreamSocket>& self,
+        ntsa::ReceiveContext*                context,
+        ntsa::Error                          error);
+
     /// Rearm the interest in the writability of the socket in the reactor,
     /// if necessary.
     void privateRearmAfterSend(const bsl::shared_ptr<StreamSocket>& self);
@@ -36,6 +36,7 @@
 #include <bdlbb_blobstreambuf.h>
 #include <bdlbb_blobutil.h>
 #include <bdlbb_pooledblobbufferfactory.h>
+#include <bdlbb_simpleblobbufferfactory.h>
 #include <bdlf_bind.h>
 #include <bdlf_memfn.h>
 #include <bdlf_placeholder.h>
@@ -314,6 +315,9 @@ struct Parameters {
     bsl::size_t                        d_writeQueueHighWatermark;
     bdlb::NullableValue<bsl::size_t>   d_sendBufferSize;
     bdlb::NullableValue<bsl::size_t>   d_receiveBufferSize;
+    bdlb::NullableValue<bsl::size_t>   d_sendBudget;
+    bdlb::NullableValue<bsl::size_t>   d_receiveBudget;
+    bdlb::NullableValue<bsl::size_t>   d_receiveCopyThreshold;
     bool                               d_useAsyncCallbacks;
     bool                               d_timestampIncomingData;
     bool                               d_timestampOutgoingData;
@@ -334,6 +338,9 @@ struct Parameters {
     , d_writeQueueHighWatermark(static_cast<bsl::size_t>(-1))
     , d_sendBufferSize()
     , d_receiveBufferSize()
+    , d_sendBudget()
+    , d_receiveBudget()
+    , d_receiveCopyThreshold()
     , d_useAsyncCallbacks(false)
     , d_timestampIncomingData(false)
     , d_timestampOutgoingData(false)
@@ -1022,6 +1029,21 @@ void StreamSocketManager::run()
                 d_parameters.d_receiveBufferSize.value());
         }
 
+        if (!d_parameters.d_sendBudget.isNull()) {
+            options.setSendGreedily(true);
+            options.setSendBudget(d_parameters.d_sendBudget.value());
+        }
+
+        if (!d_parameters.d_receiveBudget.isNull()) {
+            options.setReceiveGreedily(true);
+            options.setReceiveBudget(d_parameters.d_receiveBudget.value());
+        }
+
+        if (!d_parameters.d_receiveCopyThreshold.isNull()) {
+            options.setReceiveCopyThreshold(
+                d_parameters.d_receiveCopyThreshold.value());
+        }
+
         options.setTimestampIncomingData(d_parameters.d_timestampIncomingData);
         options.setTimestampOutgoingData(d_parameters.d_timestampOutgoingData);
         options.setMetrics(d_parameters.d_collectMetrics);
@@ -3347,6 +3369,622 @@ NTCCFG_TEST_CASE(21)
 #endif
 }
 
+NTCCFG_TEST_CASE(22)
+{
+    // Concern: Greedy sends and receives limited by a budget per event.
+    //
+    // Plan: Run a simulation to be able to control when data is transferred
+    //       and when the reactor polls. Create two pairs of sockets: a bulk
+    //       pair whose server socket receives greedily but is limited by a
+    //       receive budget, and a small pair whose server socket receives
+    //       a single small message. Configure the reactor to run at most
+    //       one cycle of deferred functions per wait. Send all the data
+    //       through both pairs, then poll the reactor round by round and
+    //       ensure the small server socket is served in the first round,
+    //       while the bulk server socket receives at least one byte, but
+    //       no more than its budget allows, in every round until all its
+    //       data has been received.
+
+    ntccfg::TestAllocator ta;
+    {
+        NTCI_LOG_CONTEXT();
+        NTCI_LOG_CONTEXT_GUARD_OWNER("main");
+
+        const bsl::size_t k_BLOB_BUFFER_SIZE = 1024;
+        const bsl::size_t k_TRANSFER_SIZE    = 1024;
+        const bsl::size_t k_RECEIVE_BUDGET   = 1024 * 4;
+        const bsl::size_t k_BULK_SIZE        = 1024 * 64;
+        const bsl::size_t k_SMALL_SIZE       = 100;
+        const bsl::size_t k_MAX_ROUNDS       = 1000;
+
+        // Each iteration receives into at most the capacity reserved for
+        // it, which is less than two blob buffers, and the iterations of a
+        // single readable event or continuation stop as soon as the budget
+        // is reached. The first round may process both the readable event
+        // and the continuation it defers.
+
+        const bsl::size_t k_MAX_BYTES_PER_ROUND =
+            2 * (k_RECEIVE_BUDGET + 2 * k_BLOB_BUFFER_SIZE);
+
+        ntsa::Error error;
+
+        // Create and start the simulation.
+
+        bsl::shared_ptr<ntcd::Simulation> simulation;
+        simulation.createInplace(&ta, &ta);
+
+        // Create a reactor that runs at most one cycle of deferred functions
+        // per wait.
+
+        bsl::shared_ptr<ntcs::DataPool> dataPool;
+        dataPool.createInplace(&ta,
+                               k_BLOB_BUFFER_SIZE,
+                               k_BLOB_BUFFER_SIZE,
+                               &ta);
+
+        bsl::shared_ptr<ntcs::User> user;
+        user.createInplace(&ta, &ta);
+        user->setDataPool(dataPool);
+
+        ntca::ReactorConfig reactorConfig;
+        reactorConfig.setMetricName("test");
+        reactorConfig.setMinThreads(1);
+        reactorConfig.setMaxThreads(1);
+        reactorConfig.setMaxCyclesPerWait(1);
+        reactorConfig.setAutoAttach(false);
+        reactorConfig.setAutoDetach(false);
+        reactorConfig.setOneShot(false);
+
+        bsl::shared_ptr<ntcd::Reactor> reactor;
+        reactor.createInplace(&ta, reactorConfig, user, &ta);
+
+        // Register this thread as the thread that will wait on the reactor.
+
+        ntci::Waiter waiter = reactor->registerWaiter(ntca::WaiterOptions());
+
+        bsl::shared_ptr<ntci::Resolver> resolver;
+        bsl::shared_ptr<ntcs::Metrics>  metrics;
+
+        // Create the bulk pair and the small pair of connected, non-blocking
+        // stream sockets using the simulation.
+
+        bsl::shared_ptr<ntcd::StreamSocket> basicBulkClientSocket;
+        bsl::shared_ptr<ntcd::StreamSocket> basicBulkServerSocket;
+
+        error = ntcd::Simulation::createStreamSocketPair(
+            &basicBulkClientSocket,
+            &basicBulkServerSocket,
+            ntsa::Transport::e_TCP_IPV4_STREAM);
+        NTCCFG_TEST_FALSE(error);
+
+        bsl::shared_ptr<ntcd::StreamSocket> basicSmallClientSocket;
+        bsl::shared_ptr<ntcd::StreamSocket> basicSmallServerSocket;
+
+        error = ntcd::Simulation::createStreamSocketPair(
+            &basicSmallClientSocket,
+            &basicSmallServerSocket,
+            ntsa::Transport::e_TCP_IPV4_STREAM);
+        NTCCFG_TEST_FALSE(error);
+
+        // Create the client stream sockets.
+
+        ntca::StreamSocketOptions clientStreamSocketOptions;
+        clientStreamSocketOptions.setTransport(
+            ntsa::Transport::e_TCP_IPV4_STREAM);
+
+        bsl::shared_ptr<ntcr::StreamSocket> bulkClientStreamSocket;
+        bulkClientStreamSocket.createInplace(&ta,
+                                             clientStreamSocketOptions,
+                                             resolver,
+                                             reactor,
+                                             reactor,
+                                             metrics,
+                                             &ta);
+
+        error = bulkClientStreamSocket->open(
+            ntsa::Transport::e_TCP_IPV4_STREAM,
+            basicBulkClientSocket);
+        NTCCFG_TEST_FALSE(error);
+
+        bsl::shared_ptr<ntcr::StreamSocket> smallClientStreamSocket;
+        smallClientStreamSocket.createInplace(&ta,
+                                              clientStreamSocketOptions,
+                                              resolver,
+                                              reactor,
+                                              reactor,
+                                              metrics,
+                                              &ta);
+
+        error = smallClientStreamSocket->open(
+            ntsa::Transport::e_TCP_IPV4_STREAM,
+            basicSmallClientSocket);
+        NTCCFG_TEST_FALSE(error);
+
+        // Create the server stream sockets. Both receive greedily with a
+        // fixed transfer size, but only the bulk server stream socket is
+        // limited by a receive budget.
+
+        ntca::StreamSocketOptions serverStreamSocketOptions;
+        serverStreamSocketOptions.setTransport(
+            ntsa::Transport::e_TCP_IPV4_STREAM);
+        serverStreamSocketOptions.setReceiveGreedily(true);
+        serverStreamSocketOptions.setMinIncomingStreamTransferSize(
+            k_TRANSFER_SIZE);
+        serverStreamSocketOptions.setMaxIncomingStreamTransferSize(
+            k_TRANSFER_SIZE);
+        serverStreamSocketOptions.setReadQueueHighWatermark(k_BULK_SIZE * 2);
+
+        bsl::shared_ptr<ntcr::StreamSocket> smallServerStreamSocket;
+        smallServerStreamSocket.createInplace(&ta,
+                                              serverStreamSocketOptions,
+                                              resolver,
+                                              reactor,
+                                              reactor,
+                                              metrics,
+                                              &ta);
+
+        error = smallServerStreamSocket->open(
+            ntsa::Transport::e_TCP_IPV4_STREAM,
+            basicSmallServerSocket);
+        NTCCFG_TEST_FALSE(error);
+
+        serverStreamSocketOptions.setReceiveBudget(k_RECEIVE_BUDGET);
+
+        bsl::shared_ptr<ntcr::StreamSocket> bulkServerStreamSocket;
+        bulkServerStreamSocket.createInplace(&ta,
+                                             serverStreamSocketOptions,
+                                             resolver,
+                                             reactor,
+                                             reactor,
+                                             metrics,
+                                             &ta);
+
+        error = bulkServerStreamSocket->open(
+            ntsa::Transport::e_TCP_IPV4_STREAM,
+            basicBulkServerSocket);
+        NTCCFG_TEST_FALSE(error);
+
+        // Send all the data through both pairs. Each send fits entirely in
+        // the socket send buffer.
+
+        {
+            bsl::shared_ptr<bdlbb::Blob> blob =
+                bulkClientStreamSocket->createOutgoingBlob();
+
+            ntcd::DataUtil::generateData(blob.get(), k_BULK_SIZE);
+
+            error = bulkClientStreamSocket->send(*blob, ntca::SendOptions());
+            NTCCFG_TEST_FALSE(error);
+
+            NTCCFG_TEST_EQ(bulkClientStreamSocket->writeQueueSize(), 0);
+        }
+
+        {
+            bsl::shared_ptr<bdlbb::Blob> blob =
+                smallClientStreamSocket->createOutgoingBlob();
+
+            ntcd::DataUtil::generateData(blob.get(), k_SMALL_SIZE);
+
+            error = smallClientStreamSocket->send(*blob, ntca::SendOptions());
+            NTCCFG_TEST_FALSE(error);
+
+            NTCCFG_TEST_EQ(smallClientStreamSocket->writeQueueSize(), 0);
+        }
+
+        // Transfer the data into the receive buffers of the server sockets.
+
+        simulation->step(true);
+
+        // Poll the reactor once and ensure the small server stream socket
+        // has received its entire message while the bulk server stream
+        // socket has yielded after reaching its budget.
+
+        reactor->poll(waiter);
+
+        NTCCFG_TEST_EQ(smallServerStreamSocket->readQueueSize(),
+                       k_SMALL_SIZE);
+
+        bsl::size_t bulkSize = bulkServerStreamSocket->readQueueSize();
+
+        NTCCFG_TEST_GE(bulkSize, k_RECEIVE_BUDGET);
+        NTCCFG_TEST_LE(bulkSize, k_MAX_BYTES_PER_ROUND);
+        NTCCFG_TEST_LT(bulkSize, k_BULK_SIZE);
+
+        // Poll the reactor round by round and ensure the bulk server stream
+        // socket makes progress, bounded by its budget, in each round.
+
+        bsl::size_t numRounds = 1;
+
+        while (bulkSize < k_BULK_SIZE) {
+            NTCCFG_TEST_LT(numRounds, k_MAX_ROUNDS);
+
+            simulation->step(false);
+            reactor->poll(waiter);
+            ++numRounds;
+
+            const bsl::size_t bulkSizeNow =
+                bulkServerStreamSocket->readQueueSize();
+
+            NTCCFG_TEST_GT(bulkSizeNow, bulkSize);
+            NTCCFG_TEST_LE(bulkSizeNow - bulkSize, k_MAX_BYTES_PER_ROUND);
+
+            bulkSize = bulkSizeNow;
+        }
+
+        NTCCFG_TEST_EQ(bulkSize, k_BULK_SIZE);
+        NTCCFG_TEST_GE(numRounds, k_BULK_SIZE / k_MAX_BYTES_PER_ROUND);
+
+        NTCCFG_TEST_EQ(smallServerStreamSocket->readQueueSize(),
+                       k_SMALL_SIZE);
+
+        // Close the clients and servers.
+
+        bulkClientStreamSocket->close();
+        bulkServerStreamSocket->close();
+        smallClientStreamSocket->close();
+        smallServerStreamSocket->close();
+
+        // Step through the simulation to process the asynchronous closure
+        // of each socket.
+
+        simulation->step(true);
+        reactor->poll(waiter);
+
+        // Deregister the waiter.
+
+        reactor->deregisterWaiter(waiter);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+
+    // Concern: Greedy sends and receives limited by a budget per event,
+    //          under load from many socket pairs.
+
+    test::Parameters parameters;
+    parameters.d_numTimers         = 0;
+    parameters.d_numSocketPairs    = 10;
+    parameters.d_numMessages       = 100;
+    parameters.d_messageSize       = 1024 * 32;
+    parameters.d_useAsyncCallbacks = false;
+    parameters.d_sendBudget        = 1024 * 4;
+    parameters.d_receiveBudget     = 1024 * 4;
+
+    test::variation(parameters);
+}
+
+namespace test {
+namespace concern23 {
+
+/// Provide a blob buffer factory that counts the blob buffers it allocates.
+class BlobBufferFactory : public bdlbb::BlobBufferFactory
+{
+    bdlbb::SimpleBlobBufferFactory d_factory;
+    bsl::size_t                    d_numAllocations;
+
+  private:
+    BlobBufferFactory(const BlobBufferFactory&) BSLS_KEYWORD_DELETED;
+    BlobBufferFactory& operator=(const BlobBufferFactory&)
+        BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new blob buffer factory that allocates blob buffers each
+    /// having the specified 'blobBufferSize'. Optionally specify a
+    /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
+    /// the currently installed default allocator is used.
+    explicit BlobBufferFactory(int               blobBufferSize,
+                               bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~BlobBufferFactory() BSLS_KEYWORD_OVERRIDE;
+
+    /// Load into the specified 'buffer' a new blob buffer.
+    void allocate(bdlbb::BlobBuffer* buffer) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the number of blob buffers allocated by this object.
+    bsl::size_t numAllocations() const;
+};
+
+BlobBufferFactory::BlobBufferFactory(int               blobBufferSize,
+                                     bslma::Allocator* basicAllocator)
+: d_factory(blobBufferSize, basicAllocator)
+, d_numAllocations(0)
+{
+}
+
+BlobBufferFactory::~BlobBufferFactory()
+{
+}
+
+void BlobBufferFactory::allocate(bdlbb::BlobBuffer* buffer)
+{
+    d_factory.allocate(buffer);
+    ++d_numAllocations;
+}
+
+bsl::size_t BlobBufferFactory::numAllocations() const
+{
+    return d_numAllocations;
+}
+
+}  // close namespace concern23
+}  // close namespace test
+
+NTCCFG_TEST_CASE(23)
+{
+    // Concern: Small receives copied through a buffer local to the thread.
+    //
+    // Plan: Run a simulation to be able to control when data is transferred
+    //       through the sockets. Supply incoming blob buffers from a factory
+    //       that counts them, sized much smaller than the transfer size.
+    //       Create one server socket whose receive copy threshold is at
+    //       least its transfer size, so it receives into the buffer local to
+    //       the thread, and another whose threshold is less, so it receives
+    //       directly into blob buffers reserved for the entire transfer.
+    //       Send a small message to each and ensure the first allocates
+    //       only the blob buffers needed to hold the message while the
+    //       second allocates the blob buffers needed for the transfer.
+
+    ntccfg::TestAllocator ta;
+    {
+        NTCI_LOG_CONTEXT();
+        NTCI_LOG_CONTEXT_GUARD_OWNER("main");
+
+        const bsl::size_t k_BLOB_BUFFER_SIZE = 256;
+        const bsl::size_t k_TRANSFER_SIZE    = 1024 * 4;
+        const bsl::size_t k_MESSAGE_SIZE     = 100;
+
+        ntsa::Error error;
+
+        // Create and start the simulation.
+
+        bsl::shared_ptr<ntcd::Simulation> simulation;
+        simulation.createInplace(&ta, &ta);
+
+        // Create a reactor whose incoming blob buffers are counted.
+
+        bsl::shared_ptr<test::concern23::BlobBufferFactory>
+            incomingBlobBufferFactory;
+        incomingBlobBufferFactory.createInplace(
+            &ta,
+            static_cast<int>(k_BLOB_BUFFER_SIZE),
+            &ta);
+
+        bsl::shared_ptr<bdlbb::PooledBlobBufferFactory>
+            outgoingBlobBufferFactory;
+        outgoingBlobBufferFactory.createInplace(
+            &ta,
+            static_cast<int>(k_BLOB_BUFFER_SIZE),
+            &ta);
+
+        bsl::shared_ptr<ntcs::DataPool> dataPool;
+        dataPool.createInplace(&ta,
+                               incomingBlobBufferFactory,
+                               outgoingBlobBufferFactory,
+                               &ta);
+
+        bsl::shared_ptr<ntcs::User> user;
+        user.createInplace(&ta, &ta);
+        user->setDataPool(dataPool);
+
+        ntca::ReactorConfig reactorConfig;
+        reactorConfig.setMetricName("test");
+        reactorConfig.setMinThreads(1);
+        reactorConfig.setMaxThreads(1);
+        reactorConfig.setAutoAttach(false);
+        reactorConfig.setAutoDetach(false);
+        reactorConfig.setOneShot(false);
+
+        bsl::shared_ptr<ntcd::Reactor> reactor;
+        reactor.createInplace(&ta, reactorConfig, user, &ta);
+
+        // Register this thread as the thread that will wait on the reactor.
+
+        ntci::Waiter waiter = reactor->registerWaiter(ntca::WaiterOptions());
+
+        bsl::shared_ptr<ntci::Resolver> resolver;
+        bsl::shared_ptr<ntcs::Metrics>  metrics;
+
+        // Create a pair of connected, non-blocking stream sockets for each
+        // receive copy threshold using the simulation.
+
+        bsl::shared_ptr<ntcd::StreamSocket> basicCopyClientSocket;
+        bsl::shared_ptr<ntcd::StreamSocket> basicCopyServerSocket;
+
+        error = ntcd::Simulation::createStreamSocketPair(
+            &basicCopyClientSocket,
+            &basicCopyServerSocket,
+            ntsa::Transport::e_TCP_IPV4_STREAM);
+        NTCCFG_TEST_FALSE(error);
+
+        bsl::shared_ptr<ntcd::StreamSocket> basicDirectClientSocket;
+        bsl::shared_ptr<ntcd::StreamSocket> basicDirectServerSocket;
+
+        error = ntcd::Simulation::createStreamSocketPair(
+            &basicDirectClientSocket,
+            &basicDirectServerSocket,
+            ntsa::Transport::e_TCP_IPV4_STREAM);
+        NTCCFG_TEST_FALSE(error);
+
+        // Create the client stream sockets.
+
+        ntca::StreamSocketOptions clientStreamSocketOptions;
+        clientStreamSocketOptions.setTransport(
+            ntsa::Transport::e_TCP_IPV4_STREAM);
+
+        bsl::shared_ptr<ntcr::StreamSocket> copyClientStreamSocket;
+        copyClientStreamSocket.createInplace(&ta,
+                                             clientStreamSocketOptions,
+                                             resolver,
+                                             reactor,
+                                             reactor,
+                                             metrics,
+                                             &ta);
+
+        error = copyClientStreamSocket->open(
+            ntsa::Transport::e_TCP_IPV4_STREAM,
+            basicCopyClientSocket);
+        NTCCFG_TEST_FALSE(error);
+
+        bsl::shared_ptr<ntcr::StreamSocket> directClientStreamSocket;
+        directClientStreamSocket.createInplace(&ta,
+                                               clientStreamSocketOptions,
+                                               resolver,
+                                               reactor,
+                                               reactor,
+                                               metrics,
+                                               &ta);
+
+        error = directClientStreamSocket->open(
+            ntsa::Transport::e_TCP_IPV4_STREAM,
+            basicDirectClientSocket);
+        NTCCFG_TEST_FALSE(error);
+
+        // Create the server stream sockets, each with a fixed transfer size.
+        // The first copies receives no larger than its threshold through the
+        // buffer local to the thread, the second receives directly into
+        // blob buffers.
+
+        ntca::StreamSocketOptions serverStreamSocketOptions;
+        serverStreamSocketOptions.setTransport(
+            ntsa::Transport::e_TCP_IPV4_STREAM);
+        serverStreamSocketOptions.setMinIncomingStreamTransferSize(
+            k_TRANSFER_SIZE);
+        serverStreamSocketOptions.setMaxIncomingStreamTransferSize(
+            k_TRANSFER_SIZE);
+
+        serverStreamSocketOptions.setReceiveCopyThreshold(k_TRANSFER_SIZE);
+
+        bsl::shared_ptr<ntcr::StreamSocket> copyServerStreamSocket;
+        copyServerStreamSocket.createInplace(&ta,
+                                             serverStreamSocketOptions,
+                                             resolver,
+                                             reactor,
+                                             reactor,
+                                             metrics,
+                                             &ta);
+
+        serverStreamSocketOptions.setReceiveCopyThreshold(k_TRANSFER_SIZE /
+                                                          4);
+
+        bsl::shared_ptr<ntcr::StreamSocket> directServerStreamSocket;
+        directServerStreamSocket.createInplace(&ta,
+                                               serverStreamSocketOptions,
+                                               resolver,
+                                               reactor,
+                                               reactor,
+                                               metrics,
+                                               &ta);
+
+        // Open the server stream socket that copies, send it a small
+        // message, and ensure it allocates only the blob buffers needed to
+        // hold the message.
+
+        {
+            error = copyServerStreamSocket->open(
+                ntsa::Transport::e_TCP_IPV4_STREAM,
+                basicCopyServerSocket);
+            NTCCFG_TEST_FALSE(error);
+
+            bsl::shared_ptr<bdlbb::Blob> blob =
+                copyClientStreamSocket->createOutgoingBlob();
+
+            ntcd::DataUtil::generateData(blob.get(), k_MESSAGE_SIZE);
+
+            error = copyClientStreamSocket->send(*blob, ntca::SendOptions());
+            NTCCFG_TEST_FALSE(error);
+
+            const bsl::size_t numAllocationsBefore =
+                incomingBlobBufferFactory->numAllocations();
+
+            while (copyServerStreamSocket->readQueueSize() < k_MESSAGE_SIZE) {
+                simulation->step(true);
+                reactor->poll(waiter);
+            }
+
+            const bsl::size_t numAllocations =
+                incomingBlobBufferFactory->numAllocations() -
+                numAllocationsBefore;
+
+            NTCCFG_TEST_EQ(copyServerStreamSocket->readQueueSize(),
+                           k_MESSAGE_SIZE);
+
+            NTCCFG_TEST_EQ(numAllocations,
+                           (k_MESSAGE_SIZE + k_BLOB_BUFFER_SIZE - 1) /
+                               k_BLOB_BUFFER_SIZE);
+        }
+
+        // Open the server stream socket that receives directly, send it
+        // the same small message, and ensure it allocates the blob buffers
+        // needed for the entire transfer.
+
+        {
+            error = directServerStreamSocket->open(
+                ntsa::Transport::e_TCP_IPV4_STREAM,
+                basicDirectServerSocket);
+            NTCCFG_TEST_FALSE(error);
+
+            bsl::shared_ptr<bdlbb::Blob> blob =
+                directClientStreamSocket->createOutgoingBlob();
+
+            ntcd::DataUtil::generateData(blob.get(), k_MESSAGE_SIZE);
+
+            error =
+                directClientStreamSocket->send(*blob, ntca::SendOptions());
+            NTCCFG_TEST_FALSE(error);
+
+            const bsl::size_t numAllocationsBefore =
+                incomingBlobBufferFactory->numAllocations();
+
+            while (directServerStreamSocket->readQueueSize() <
+                   k_MESSAGE_SIZE)
+            {
+                simulation->step(true);
+                reactor->poll(waiter);
+            }
+
+            const bsl::size_t numAllocations =
+                incomingBlobBufferFactory->numAllocations() -
+                numAllocationsBefore;
+
+            NTCCFG_TEST_EQ(directServerStreamSocket->readQueueSize(),
+                           k_MESSAGE_SIZE);
+
+            NTCCFG_TEST_GE(numAllocations,
+                           k_TRANSFER_SIZE / k_BLOB_BUFFER_SIZE);
+        }
+
+        // Close the clients and servers.
+
+        copyClientStreamSocket->close();
+        copyServerStreamSocket->close();
+        directClientStreamSocket->close();
+        directServerStreamSocket->close();
+
+        // Step through the simulation to process the asynchronous closure
+        // of each socket.
+
+        simulation->step(true);
+        reactor->poll(waiter);
+
+        // Deregister the waiter.
+
+        reactor->deregisterWaiter(waiter);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+
+    // Concern: Small receives copied through a buffer local to the thread,
+    //          under load from many socket pairs.
+
+    test::Parameters parameters;
+    parameters.d_numTimers            = 0;
+    parameters.d_numSocketPairs       = 10;
+    parameters.d_numMessages          = 100;
+    parameters.d_messageSize          = 1024 * 32;
+    parameters.d_useAsyncCallbacks    = false;
+    parameters.d_receiveCopyThreshold = 1024 * 64;
+
+    test::variation(parameters);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
@@ -3376,5 +4014,8 @@ NTCCFG_TEST_DRIVER
 
     NTCCFG_TEST_REGISTER(20);
     NTCCFG_TEST_REGISTER(21);
+
+    NTCCFG_TEST_REGISTER(22);
+    NTCCFG_TEST_REGISTER(23);
 }
 NTCCFG_TEST_DRIVER_END;
@@ -32,6 +32,7 @@ BSLS_IDENT_RCSID(ntcr_thread_cpp, "$Id$ $CSID$")
 #include <ntcs_nomenclature.h>
 #include <ntcs_reactormetrics.h>
 #include <ntcs_threadutil.h>
+#include <ntcs_watchdog.h>
 
 #include <bdlf_bind.h>
 #include <bdlf_memfn.h>
@@ -85,6 +86,8 @@ void* Thread::run(ntcr::Thread* thread)
         thread->d_runCondition.signal();
     }
 
+    ntcs::WatchdogGuard watchdogGuard(thread->d_watchdog_sp.get());
+
     thread->d_reactor_sp->run(waiter);
     thread->d_reactor_sp->drainFunctions();
     thread->d_reactor_sp->deregisterWaiter(waiter);
@@ -164,6 +167,21 @@ void Thread::initialize()
             d_config.setResolverConfig(resolverConfig);
         }
     }
+
+    if (!d_config.stallThreshold().isNull() &&
+        d_config.stallThreshold().value() > bsls::TimeInterval())
+    {
+        bsl::shared_ptr<ntcs::Watchdog> watchdog;
+        watchdog.createInplace(d_allocator_p,
+                               "watchdog",
+                               d_config.metricName().value(),
+                               d_config.stallThreshold().value(),
+                               d_allocator_p);
+
+        d_watchdog_sp = watchdog;
+
+        ntcm::MonitorableUtil::registerMonitorable(d_watchdog_sp);
+    }
 }
 
 Thread::Thread(const ntca::ThreadConfig&                    configuration,
@@ -177,6 +195,7 @@ Thread::Thread(const ntca::ThreadConfig&                    configuration,
 , d_runCondition()
 , d_runState(RUN_STATE_STOPPED)
 , d_config(configuration, basicAllocator)
+, d_watchdog_sp()
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     this->initialize();
@@ -204,6 +223,23 @@ Thread::Thread(const ntca::ThreadConfig&                    configuration,
         reactorConfig.setMaxCyclesPerWait(d_config.maxCyclesPerWait().value());
     }
 
+    if (!d_config.busyPollDuration().isNull()) {
+        reactorConfig.setBusyPollDuration(d_config.busyPollDuration().value());
+    }
+
+    if (!d_config.busyPollSockets().isNull()) {
+        reactorConfig.setBusyPollSockets(d_config.busyPollSockets().value());
+    }
+
+    if (!d_config.deferInterestChanges().isNull()) {
+        reactorConfig.setDeferInterestChanges(
+            d_config.deferInterestChanges().value());
+    }
+
+    if (!d_config.devicePerWaiter().isNull()) {
+        reactorConfig.setDevicePerWaiter(d_config.devicePerWaiter().value());
+    }
+
     if (!d_config.metricCollection().isNull()) {
         reactorConfig.setMetricCollection(d_config.metricCollection().value());
     }
@@ -239,6 +275,7 @@ Thread::Thread(const ntca::ThreadConfig&             configuration,
 , d_runCondition()
 , d_runState(RUN_STATE_STOPPED)
 , d_config(configuration, basicAllocator)
+, d_watchdog_sp()
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     this->initialize();
@@ -254,6 +291,11 @@ Thread::~Thread()
 
     d_reactor_sp->clear();
     d_reactor_sp.reset();
+
+    if (d_watchdog_sp) {
+        ntcm::MonitorableUtil::deregisterMonitorable(d_watchdog_sp);
+        d_watchdog_sp.reset();
+    }
 }
 
 ntsa::Error Thread::start()
@@ -31,6 +31,7 @@ BSLS_IDENT("$Id: $")
 #include <ntci_timer.h>
 #include <ntcs_metrics.h>
 #include <ntcs_user.h>
+#include <ntcs_watchdog.h>
 #include <ntcscm_version.h>
 #include <ntsi_descriptor.h>
 #include <bslmt_condition.h>
@@ -60,15 +61,16 @@ namespace ntcr {
 /// @ingroup module_ntcr
 class Thread : public ntci::Thread, public ntccfg::Shared<Thread>
 {
-    ntccfg::Object                 d_object;
-    bsl::shared_ptr<ntci::Reactor> d_reactor_sp;
-    bslmt::ThreadUtil::Handle      d_threadHandle;
-    bslmt::ThreadAttributes        d_threadAttributes;
-    bslmt::Mutex                   d_runMutex;
-    bslmt::Condition               d_runCondition;
-    bsls::AtomicInt                d_runState;
-    ntca::ThreadConfig             d_config;
-    bslma::Allocator*              d_allocator_p;
+    ntccfg::Object                  d_object;
+    bsl::shared_ptr<ntci::Reactor>  d_reactor_sp;
+    bslmt::ThreadUtil::Handle       d_threadHandle;
+    bslmt::ThreadAttributes         d_threadAttributes;
+    bslmt::Mutex                    d_runMutex;
+    bslmt::Condition                d_runCondition;
+    bsls::AtomicInt                 d_runState;
+    ntca::ThreadConfig              d_config;
+    bsl::shared_ptr<ntcs::Watchdog> d_watchdog_sp;
+    bslma::Allocator*               d_allocator_p;
 
   private:
     Thread(const Thread&) BSLS_KEYWORD_DELETED;
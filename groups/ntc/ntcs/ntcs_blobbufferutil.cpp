@@ -18,9 +18,45 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(ntcs_blobbufferutil_cpp, "$Id$ $CSID$")
 
+#include <bdlbb_blobutil.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslmt_threadutil.h>
+#include <bsls_assert.h>
+
+extern "C" {
+
+/// Destroy the specified 'buffer' owned by an exiting thread.
+static void ntcs_BlobBufferUtil_destroyThreadLocalBuffer(void* buffer);
+
+}  // close extern "C"
+
 namespace BloombergLP {
 namespace ntcs {
 
+namespace {
+
+/// Describe a buffer owned by a thread.
+struct ThreadLocalBuffer {
+    char*             d_data;
+    bsl::size_t       d_size;
+    bslma::Allocator* d_allocator_p;
+};
+
+bslmt::ThreadUtil::Key s_key;
+
+struct Initializer {
+    Initializer()
+    {
+        int rc = bslmt::ThreadUtil::createKey(
+            &s_key,
+            &ntcs_BlobBufferUtil_destroyThreadLocalBuffer);
+        BSLS_ASSERT_OPT(rc == 0);
+    }
+} s_initializer;
+
+}  // close unnamed namespace
+
 size_t BlobBufferUtil::calculateNumBytesToAllocate(size_t size,
                                                    size_t capacity,
                                                    size_t lowWatermark,
@@ -101,5 +137,90 @@ void BlobBufferUtil::reserveCapacity(
                 bsl::min(minReceiveSize, maxReceiveSize));
 }
 
+void BlobBufferUtil::copy(bdlbb::Blob*              readQueue,
+                          bdlbb::BlobBufferFactory* blobBufferFactory,
+                          ntcs::Metrics*            metrics,
+                          const char*               data,
+                          size_t                    size)
+{
+    if (size == 0) {
+        return;
+    }
+
+    bsl::size_t numBytesAvailable =
+        static_cast<bsl::size_t>(readQueue->totalSize() - readQueue->length());
+
+    while (numBytesAvailable < size) {
+        bdlbb::BlobBuffer buffer;
+        blobBufferFactory->allocate(&buffer);
+
+        bsl::size_t blobBufferCapacity = buffer.size();
+
+        readQueue->appendBuffer(buffer);
+        numBytesAvailable += blobBufferCapacity;
+
+        if (metrics) {
+            metrics->logBlobBufferAllocation(blobBufferCapacity);
+        }
+    }
+
+    bdlbb::BlobUtil::append(readQueue, data, 0, static_cast<int>(size));
+}
+
+char* BlobBufferUtil::threadLocalBuffer(size_t size)
+{
+    ThreadLocalBuffer* buffer = reinterpret_cast<ThreadLocalBuffer*>(
+        bslmt::ThreadUtil::getSpecific(s_key));
+
+    if (NTCCFG_UNLIKELY(buffer == 0)) {
+        bslma::Allocator* allocator = bslma::Default::globalAllocator();
+
+        buffer = static_cast<ThreadLocalBuffer*>(
+            allocator->allocate(sizeof(ThreadLocalBuffer)));
+
+        buffer->d_data        = 0;
+        buffer->d_size        = 0;
+        buffer->d_allocator_p = allocator;
+
+        int rc = bslmt::ThreadUtil::setSpecific(
+            s_key,
+            const_cast<const void*>(static_cast<void*>(buffer)));
+        BSLS_ASSERT_OPT(rc == 0);
+    }
+
+    if (NTCCFG_UNLIKELY(buffer->d_size < size)) {
+        if (buffer->d_data != 0) {
+            buffer->d_allocator_p->deallocate(buffer->d_data);
+        }
+
+        buffer->d_data =
+            static_cast<char*>(buffer->d_allocator_p->allocate(size));
+        buffer->d_size = size;
+    }
+
+    return buffer->d_data;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
+
+extern "C" {
+
+static void ntcs_BlobBufferUtil_destroyThreadLocalBuffer(void* buffer)
+{
+    BloombergLP::ntcs::ThreadLocalBuffer* threadLocalBuffer =
+        static_cast<BloombergLP::ntcs::ThreadLocalBuffer*>(buffer);
+
+    if (threadLocalBuffer != 0) {
+        BloombergLP::bslma::Allocator* allocator =
+            threadLocalBuffer->d_allocator_p;
+
+        if (threadLocalBuffer->d_data != 0) {
+            allocator->deallocate(threadLocalBuffer->d_data);
+        }
+
+        allocator->deallocate(threadLocalBuffer);
+    }
+}
+
+}  // close extern "C"
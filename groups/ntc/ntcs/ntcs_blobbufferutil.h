@@ -64,6 +64,22 @@ struct BlobBufferUtil {
                                 size_t                    lowWatermark,
                                 size_t                    minReceiveSize,
                                 size_t                    maxReceiveSize);
+
+    /// Copy the specified 'size' bytes at the specified 'data' to the end of
+    /// the specified 'readQueue', first into the unused capacity buffers of
+    /// the 'readQueue', then into only as many more buffers allocated from
+    /// the specified 'blobBufferFactory' as necessary.
+    static void copy(bdlbb::Blob*              readQueue,
+                     bdlbb::BlobBufferFactory* blobBufferFactory,
+                     ntcs::Metrics*            metrics,
+                     const char*               data,
+                     size_t                    size);
+
+    /// Return the address of a buffer of at least the specified 'size'
+    /// bytes owned by the calling thread. The buffer remains valid until
+    /// the next call to this function by the calling thread, or until the
+    /// calling thread exits.
+    static char* threadLocalBuffer(size_t size);
 };
 
 }  // end namespace ntcs
@@ -19,7 +19,9 @@
 #include <ntci_log.h>
 
 #include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
 #include <bdlbb_pooledblobbufferfactory.h>
+#include <bsl_string.h>
 
 using namespace BloombergLP;
 
@@ -251,10 +253,55 @@ NTCCFG_TEST_CASE(3)
     NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+NTCCFG_TEST_CASE(4)
+{
+    // Concern: Copying into a read queue only allocates the buffers
+    // necessary to hold the data copied.
+
+    ntccfg::TestAllocator ta;
+    {
+        bdlbb::PooledBlobBufferFactory blobBufferFactory(4, &ta);
+
+        bdlbb::Blob blob(&blobBufferFactory, &ta);
+
+        blob.setLength(8);
+        blob.setLength(6);
+
+        NTCCFG_TEST_EQ(blob.length(), 6);
+        NTCCFG_TEST_EQ(blob.totalSize(), 8);
+
+        char* buffer = ntcs::BlobBufferUtil::threadLocalBuffer(16);
+        NTCCFG_TEST_TRUE(buffer != 0);
+
+        for (bsl::size_t i = 0; i < 16; ++i) {
+            buffer[i] = static_cast<char>('a' + i);
+        }
+
+        NTCCFG_TEST_EQ(ntcs::BlobBufferUtil::threadLocalBuffer(8), buffer);
+
+        ntcs::BlobBufferUtil::copy(&blob, &blobBufferFactory, 0, buffer, 7);
+
+        NTCCFG_TEST_EQ(blob.length(), 13);
+        NTCCFG_TEST_EQ(blob.totalSize(), 16);
+
+        char result[7];
+        bdlbb::BlobUtil::copy(result, blob, 6, 7);
+
+        NTCCFG_TEST_EQ(bsl::string(result, 7), bsl::string("abcdefg"));
+
+        ntcs::BlobBufferUtil::copy(&blob, &blobBufferFactory, 0, buffer, 0);
+
+        NTCCFG_TEST_EQ(blob.length(), 13);
+        NTCCFG_TEST_EQ(blob.totalSize(), 16);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTCCFG_TEST_DRIVER
 {
     NTCCFG_TEST_REGISTER(1);
     NTCCFG_TEST_REGISTER(2);
     NTCCFG_TEST_REGISTER(3);
+    NTCCFG_TEST_REGISTER(4);
 }
 NTCCFG_TEST_DRIVER_END;
@@ -0,0 +1,97 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <ntcs_busypoll.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcs_busypoll_cpp, "$Id$ $CSID$")
+
+namespace BloombergLP {
+namespace ntcs {
+
+namespace {
+
+// The factor by which the duration grows or shrinks.
+const bsls::Types::Int64 k_SCALE = 2;
+
+// The divisor of the maximum duration that defines the minimum non-zero
+// duration.
+const bsls::Types::Int64 k_MINIMUM_DIVISOR = 4;
+
+}  // close unnamed namespace
+
+BusyPoll::BusyPoll()
+: d_duration(0)
+, d_maxDuration(0)
+{
+}
+
+BusyPoll::BusyPoll(const bsls::TimeInterval& maxDuration)
+: d_duration(0)
+, d_maxDuration(0)
+{
+    this->setMaxDuration(maxDuration);
+}
+
+BusyPoll::~BusyPoll()
+{
+}
+
+void BusyPoll::setMaxDuration(const bsls::TimeInterval& maxDuration)
+{
+    if (maxDuration > bsls::TimeInterval()) {
+        d_maxDuration = maxDuration.totalNanoseconds();
+    }
+    else {
+        d_maxDuration = 0;
+    }
+
+    d_duration = d_maxDuration;
+}
+
+void BusyPoll::recordMiss(bool               eventsArrived,
+                          bsls::Types::Int64 blockedDuration)
+{
+    if (d_maxDuration == 0) {
+        return;
+    }
+
+    bsls::Types::Int64 minDuration = d_maxDuration / k_MINIMUM_DIVISOR;
+    if (minDuration == 0) {
+        minDuration = 1;
+    }
+
+    if (eventsArrived && blockedDuration <= d_maxDuration) {
+        if (d_duration < minDuration) {
+            d_duration = minDuration;
+        }
+        else if (d_duration < d_maxDuration / k_SCALE) {
+            d_duration *= k_SCALE;
+        }
+        else {
+            d_duration = d_maxDuration;
+        }
+    }
+    else {
+        d_duration /= k_SCALE;
+        if (d_duration < minDuration) {
+            d_duration = 0;
+        }
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
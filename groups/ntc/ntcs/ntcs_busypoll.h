@@ -0,0 +1,145 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef INCLUDED_NTCS_BUSYPOLL
+#define INCLUDED_NTCS_BUSYPOLL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_inline.h>
+#include <ntccfg_platform.h>
+#include <ntcscm_version.h>
+#include <bsls_keyword.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+/// @internal @brief
+/// Provide a mechanism to adapt the duration of a busy poll.
+///
+/// @details
+/// Provide a mechanism that decides for how long a thread waiting for events
+/// should repeatedly poll for events without blocking before falling back to
+/// blocking until events occur. Each busy poll is at most the maximum
+/// duration, and the effective duration adapts according to the outcome of
+/// each wait:
+///
+/// @li If events are discovered while busy polling, the busy poll was a hit,
+/// and the duration is unchanged.
+///
+/// @li If no events are discovered while busy polling but events arrive while
+/// subsequently blocked before the maximum duration elapses, a longer busy
+/// poll would have avoided blocking, and the duration is doubled, up to the
+/// maximum duration. A duration of zero grows to one quarter of the maximum
+/// duration.
+///
+/// @li Otherwise, busy polling was wasted, and the duration is halved. A
+/// duration less than one quarter of the maximum duration shrinks to zero.
+///
+/// Consequently, a thread that receives a steady stream of events busy polls
+/// and rarely blocks, while an idle thread quickly stops busy polling and
+/// blocks without consuming processor time.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntcs
+class BusyPoll
+{
+    bsls::Types::Int64 d_duration;
+    bsls::Types::Int64 d_maxDuration;
+
+  private:
+    BusyPoll(const BusyPoll&) BSLS_KEYWORD_DELETED;
+    BusyPoll& operator=(const BusyPoll&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new busy poll mechanism that never busy polls.
+    BusyPoll();
+
+    /// Create a new busy poll mechanism that busy polls for at most the
+    /// specified 'maxDuration', initially busy polling for 'maxDuration'.
+    explicit BusyPoll(const bsls::TimeInterval& maxDuration);
+
+    /// Destroy this object.
+    ~BusyPoll();
+
+    /// Set the maximum duration of each busy poll to the specified
+    /// 'maxDuration' and reset the duration of the next busy poll to
+    /// 'maxDuration'.
+    void setMaxDuration(const bsls::TimeInterval& maxDuration);
+
+    /// Record that events were discovered while busy polling.
+    void recordHit();
+
+    /// Record that no events were discovered while busy polling, if any, and
+    /// that the subsequent blocking wait returned after the specified
+    /// 'blockedDuration', in nanoseconds, with events available according to
+    /// the specified 'eventsArrived' flag.
+    void recordMiss(bool eventsArrived, bsls::Types::Int64 blockedDuration);
+
+    /// Return the duration of the next busy poll, in nanoseconds. Note that
+    /// zero indicates the thread should immediately block.
+    bsls::Types::Int64 duration() const;
+
+    /// Return the maximum duration of each busy poll, in nanoseconds.
+    bsls::Types::Int64 maxDuration() const;
+
+    /// Return true if the next wait should busy poll, otherwise return
+    /// false.
+    bool isActive() const;
+
+    /// Return true if busy polling is enabled, i.e., the maximum duration of
+    /// each busy poll is non-zero, otherwise return false. Note that busy
+    /// polling may be enabled but not active.
+    bool isEnabled() const;
+};
+
+NTCCFG_INLINE
+void BusyPoll::recordHit()
+{
+}
+
+NTCCFG_INLINE
+bsls::Types::Int64 BusyPoll::duration() const
+{
+    return d_duration;
+}
+
+NTCCFG_INLINE
+bsls::Types::Int64 BusyPoll::maxDuration() const
+{
+    return d_maxDuration;
+}
+
+NTCCFG_INLINE
+bool BusyPoll::isActive() const
+{
+    return d_duration > 0;
+}
+
+NTCCFG_INLINE
+bool BusyPoll::isEnabled() const
+{
+    return d_maxDuration > 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
@@ -0,0 +1,91 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <ntcs_busypoll.h>
+
+#include <ntccfg_test.h>
+
+using namespace BloombergLP;
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: A default-constructed mechanism never busy polls.
+
+    ntcs::BusyPoll busyPoll;
+
+    NTCCFG_TEST_FALSE(busyPoll.isEnabled());
+    NTCCFG_TEST_FALSE(busyPoll.isActive());
+
+    busyPoll.recordMiss(true, 0);
+
+    NTCCFG_TEST_FALSE(busyPoll.isActive());
+    NTCCFG_TEST_EQ(busyPoll.duration(), 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: The duration shrinks to zero when busy polling is wasted and
+    // grows back to the maximum when events arrive soon after blocking.
+
+    const bsls::Types::Int64 k_MAX = 100 * 1000;
+
+    ntcs::BusyPoll busyPoll(bsls::TimeInterval(0, 100 * 1000));
+
+    NTCCFG_TEST_TRUE(busyPoll.isEnabled());
+    NTCCFG_TEST_TRUE(busyPoll.isActive());
+    NTCCFG_TEST_EQ(busyPoll.maxDuration(), k_MAX);
+    NTCCFG_TEST_EQ(busyPoll.duration(), k_MAX);
+
+    busyPoll.recordHit();
+    NTCCFG_TEST_EQ(busyPoll.duration(), k_MAX);
+
+    busyPoll.recordMiss(false, 1000 * 1000);
+    NTCCFG_TEST_EQ(busyPoll.duration(), k_MAX / 2);
+
+    busyPoll.recordMiss(true, 2 * k_MAX);
+    NTCCFG_TEST_EQ(busyPoll.duration(), k_MAX / 4);
+
+    busyPoll.recordMiss(false, 0);
+    NTCCFG_TEST_EQ(busyPoll.duration(), 0);
+    NTCCFG_TEST_FALSE(busyPoll.isActive());
+    NTCCFG_TEST_TRUE(busyPoll.isEnabled());
+
+    busyPoll.recordMiss(false, 0);
+    NTCCFG_TEST_EQ(busyPoll.duration(), 0);
+
+    busyPoll.recordMiss(true, k_MAX);
+    NTCCFG_TEST_EQ(busyPoll.duration(), k_MAX / 4);
+
+    busyPoll.recordMiss(true, k_MAX / 2);
+    NTCCFG_TEST_EQ(busyPoll.duration(), k_MAX / 2);
+
+    busyPoll.recordMiss(true, 0);
+    NTCCFG_TEST_EQ(busyPoll.duration(), k_MAX);
+
+    busyPoll.recordMiss(true, 0);
+    NTCCFG_TEST_EQ(busyPoll.duration(), k_MAX);
+
+    busyPoll.setMaxDuration(bsls::TimeInterval());
+    NTCCFG_TEST_FALSE(busyPoll.isEnabled());
+    NTCCFG_TEST_FALSE(busyPoll.isActive());
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+}
+NTCCFG_TEST_DRIVER_END;
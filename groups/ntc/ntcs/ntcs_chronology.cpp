@@ -22,6 +22,7 @@ BSLS_IDENT_RCSID(ntcs_chronology_cpp, "$Id$ $CSID$")
 #include <ntccfg_bind.h>
 #include <ntci_log.h>
 #include <ntcs_dispatch.h>
+#include <ntcs_watchdog.h>
 #include <ntsa_error.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_datetime.h>
@@ -698,7 +699,7 @@ const bsl::shared_ptr<ntci::Strand>& Chronology::Timer::strand() const
 
 bsls::TimeInterval Chronology::Timer::currentTime() const
 {
-    return bdlt::CurrentTime::now();
+    return d_chronology_p->currentTime();
 }
 
 NTCCFG_INLINE
@@ -829,6 +830,7 @@ Chronology::Chronology(ntcs::Driver* driver, bslma::Allocator* basicAllocator)
 , d_driver_sp(bsl::shared_ptr<ntcs::Driver>(driver,
                                             bslstl::SharedPtrNilDeleter(),
                                             basicAllocator))
+, d_currentTimeFunction(bsl::allocator_arg, d_allocator_p)
 , d_nodePool(sizeof(TimerNode), d_allocator_p)
 , d_nodeArray(d_allocator_p)
 , d_nodeFree_p(0)
@@ -851,6 +853,7 @@ Chronology::Chronology(const bsl::shared_ptr<ntcs::Driver>& driver,
 , d_mutex(NTCCFG_LOCK_INIT)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_driver_sp(driver)
+, d_currentTimeFunction(bsl::allocator_arg, d_allocator_p)
 , d_nodePool(sizeof(TimerNode), d_allocator_p)
 , d_nodeArray(d_allocator_p)
 , d_nodeFree_p(0)
@@ -874,6 +877,13 @@ Chronology::~Chronology()
     BSLS_ASSERT(d_nodeCount == 0);
 }
 
+void Chronology::setCurrentTimeFunction(
+    const CurrentTimeFunction& currentTimeFunction)
+{
+    LockGuard lock(&d_mutex);
+    d_currentTimeFunction = currentTimeFunction;
+}
+
 void Chronology::clear()
 {
     typedef bsl::vector<TimerNode*> NodeVector;
@@ -1150,7 +1160,10 @@ void Chronology::announce()
 
         while (it != et) {
             Functor& functor = *it;
-            functor();
+            {
+                ntcs::WatchdogScope watchdogScope("function");
+                functor();
+            }
             functor = Functor();
             ++it;
         }
@@ -1168,6 +1181,8 @@ void Chronology::announce()
             TimerRep* timerRep = dueEntry.d_node_p->d_storage.address();
             Timer*    timer    = timerRep->getObject();
 
+            ntcs::WatchdogScope watchdogScope("timer");
+
             timer->arrive(bsl::shared_ptr<ntci::Timer>(
                               static_cast<ntci::Timer*>(timer),
                               static_cast<bslma::SharedPtrRep*>(timerRep)),
@@ -1179,6 +1194,11 @@ void Chronology::announce()
 
         timersDue.clear();
     }
+
+    ntcs::Watchdog* watchdog = ntcs::Watchdog::getThreadLocal();
+    if (NTCCFG_UNLIKELY(watchdog)) {
+        watchdog->cycle();
+    }
 }
 
 void Chronology::drain()
@@ -32,6 +32,7 @@ BSLS_IDENT("$Id: $")
 #include <bdlb_nullablevalue.h>
 #include <bdlma_concurrentmultipoolallocator.h>
 #include <bdlma_pool.h>
+#include <bdlt_currenttime.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
 #include <bsls_atomic.h>
@@ -414,10 +415,17 @@ class Chronology
     typedef bslmt::LockGuard<ntccfg::Mutex> LockGuard;
 #endif
 
+  public:
+    /// Define a type alias for a function that returns the current elapsed
+    /// time since the Unix epoch.
+    typedef bsl::function<bsls::TimeInterval()> CurrentTimeFunction;
+
+  private:
     ntccfg::Object                      d_object;
     mutable Mutex                       d_mutex;
     bslma::Allocator*                   d_allocator_p;
     bsl::shared_ptr<ntcs::Driver>       d_driver_sp;
+    CurrentTimeFunction                 d_currentTimeFunction;
     bdlma::Pool                         d_nodePool;
     bsl::vector<TimerNode*>             d_nodeArray;
     TimerNode*                          d_nodeFree_p;
@@ -475,6 +483,14 @@ class Chronology
     /// Destroy this object.
     ~Chronology();
 
+    /// Set the function used to load the current elapsed time since the
+    /// Unix epoch to the specified 'currentTimeFunction'. If
+    /// 'currentTimeFunction' is empty, the system clock is used. The
+    /// behavior is undefined unless this function is called before any
+    /// timer is created or any function is deferred.
+    void setCurrentTimeFunction(
+        const CurrentTimeFunction& currentTimeFunction);
+
     /// Remove all functions and timers from the chronology.
     void clear();
 
@@ -647,6 +663,10 @@ bool Chronology::hasAnyScheduledOrDeferred() const
 NTCCFG_INLINE
 bsls::TimeInterval Chronology::currentTime() const
 {
+    if (NTCCFG_UNLIKELY(d_currentTimeFunction)) {
+        return d_currentTimeFunction();
+    }
+
     return bdlt::CurrentTime::now();
 }
 
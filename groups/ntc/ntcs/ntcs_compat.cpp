@@ -248,6 +248,24 @@ void Compat::convert(ntca::StreamSocketOptions*         result,
         result->setReceiveGreedily(options.receiveGreedily().value());
     }
 
+    if (!options.sendBudget().isNull()) {
+        result->setSendBudget(options.sendBudget().value());
+    }
+
+    if (!options.receiveBudget().isNull()) {
+        result->setReceiveBudget(options.receiveBudget().value());
+    }
+
+    if (!options.receiveCopyThreshold().isNull()) {
+        result->setReceiveCopyThreshold(
+            options.receiveCopyThreshold().value());
+    }
+
+    if (!options.receiveForeignHandles().isNull()) {
+        result->setReceiveForeignHandles(
+            options.receiveForeignHandles().value());
+    }
+
     if (!options.sendBufferSize().isNull()) {
         result->setSendBufferSize(options.sendBufferSize().value());
     }
@@ -378,6 +396,24 @@ void Compat::convert(ntca::ListenerSocketOptions*     result,
         result->setReceiveGreedily(options.receiveGreedily().value());
     }
 
+    if (!options.sendBudget().isNull()) {
+        result->setSendBudget(options.sendBudget().value());
+    }
+
+    if (!options.receiveBudget().isNull()) {
+        result->setReceiveBudget(options.receiveBudget().value());
+    }
+
+    if (!options.receiveCopyThreshold().isNull()) {
+        result->setReceiveCopyThreshold(
+            options.receiveCopyThreshold().value());
+    }
+
+    if (!options.receiveForeignHandles().isNull()) {
+        result->setReceiveForeignHandles(
+            options.receiveForeignHandles().value());
+    }
+
     if (!options.sendBufferSize().isNull()) {
         result->setSendBufferSize(options.sendBufferSize().value());
     }
@@ -718,6 +754,25 @@ void Compat::convert(ntca::ListenerSocketOptions*       result,
         }
     }
 
+    if (result->sendBudget().isNull()) {
+        if (!config.sendBudget().isNull()) {
+            result->setSendBudget(config.sendBudget().value());
+        }
+    }
+
+    if (result->receiveBudget().isNull()) {
+        if (!config.receiveBudget().isNull()) {
+            result->setReceiveBudget(config.receiveBudget().value());
+        }
+    }
+
+    if (result->receiveCopyThreshold().isNull()) {
+        if (!config.receiveCopyThreshold().isNull()) {
+            result->setReceiveCopyThreshold(
+                config.receiveCopyThreshold().value());
+        }
+    }
+
     if (result->sendBufferSize().isNull()) {
         if (!config.sendBufferSize().isNull()) {
             result->setSendBufferSize(config.sendBufferSize().value());
@@ -902,6 +957,25 @@ void Compat::convert(ntca::StreamSocketOptions*       result,
         }
     }
 
+    if (result->sendBudget().isNull()) {
+        if (!config.sendBudget().isNull()) {
+            result->setSendBudget(config.sendBudget().value());
+        }
+    }
+
+    if (result->receiveBudget().isNull()) {
+        if (!config.receiveBudget().isNull()) {
+            result->setReceiveBudget(config.receiveBudget().value());
+        }
+    }
+
+    if (result->receiveCopyThreshold().isNull()) {
+        if (!config.receiveCopyThreshold().isNull()) {
+            result->setReceiveCopyThreshold(
+                config.receiveCopyThreshold().value());
+        }
+    }
+
     if (result->sendBufferSize().isNull()) {
         if (!config.sendBufferSize().isNull()) {
             result->setSendBufferSize(config.sendBufferSize().value());
@@ -2171,6 +2171,9 @@ void Dispatch::announceAccepted(
     const bsl::shared_ptr<ntci::Strand>&         destination)
 {
     if (NTCCFG_LIKELY(!destination)) {
+        ntcs::WatchdogScope watchdogScope("accepted",
+                                          socket->handle(),
+                                          socket.get());
         socket->processSocketAccepted(error, streamSocket);
     }
     else {
@@ -2188,6 +2191,9 @@ void Dispatch::announceConnected(
     const bsl::shared_ptr<ntci::Strand>&         destination)
 {
     if (NTCCFG_LIKELY(!destination)) {
+        ntcs::WatchdogScope watchdogScope("connected",
+                                          socket->handle(),
+                                          socket.get());
         socket->processSocketConnected(error);
     }
     else {
@@ -2205,6 +2211,9 @@ void Dispatch::announceReceived(
     const bsl::shared_ptr<ntci::Strand>&         destination)
 {
     if (NTCCFG_LIKELY(!destination)) {
+        ntcs::WatchdogScope watchdogScope("received",
+                                          socket->handle(),
+                                          socket.get());
         socket->processSocketReceived(error, context);
     }
     else {
@@ -2223,6 +2232,9 @@ void Dispatch::announceSent(
     const bsl::shared_ptr<ntci::Strand>&         destination)
 {
     if (NTCCFG_LIKELY(!destination)) {
+        ntcs::WatchdogScope watchdogScope("sent",
+                                          socket->handle(),
+                                          socket.get());
         socket->processSocketSent(error, context);
     }
     else {
@@ -2240,6 +2252,9 @@ void Dispatch::announceError(
     const bsl::shared_ptr<ntci::Strand>&         destination)
 {
     if (NTCCFG_LIKELY(!destination)) {
+        ntcs::WatchdogScope watchdogScope("error",
+                                          socket->handle(),
+                                          socket.get());
         socket->processSocketError(error);
     }
     else {
@@ -2255,6 +2270,9 @@ void Dispatch::announceDetached(
     const bsl::shared_ptr<ntci::Strand>&         destination)
 {
     if (NTCCFG_LIKELY(!destination)) {
+        ntcs::WatchdogScope watchdogScope("detached",
+                                          socket->handle(),
+                                          socket.get());
         socket->processSocketDetached();
     }
     else {
@@ -34,6 +34,7 @@ BSLS_IDENT("$Id: $")
 #include <ntci_streamsocketsession.h>
 #include <ntci_timer.h>
 #include <ntci_timersession.h>
+#include <ntcs_watchdog.h>
 #include <ntcscm_version.h>
 #include <bslmt_mutex.h>
 #include <bsl_memory.h>
@@ -1586,6 +1587,9 @@ void Dispatch::announceReadable(
     const bsl::shared_ptr<ntci::Strand>&        destination)
 {
     if (NTCCFG_LIKELY(!destination)) {
+        ntcs::WatchdogScope watchdogScope("readable",
+                                          event.handle(),
+                                          socket.get());
         socket->processSocketReadable(event);
     }
     else {
@@ -1603,6 +1607,9 @@ void Dispatch::announceWritable(
     const bsl::shared_ptr<ntci::Strand>&        destination)
 {
     if (NTCCFG_LIKELY(!destination)) {
+        ntcs::WatchdogScope watchdogScope("writable",
+                                          event.handle(),
+                                          socket.get());
         socket->processSocketWritable(event);
     }
     else {
@@ -1620,6 +1627,9 @@ void Dispatch::announceError(
     const bsl::shared_ptr<ntci::Strand>&        destination)
 {
     if (NTCCFG_LIKELY(!destination)) {
+        ntcs::WatchdogScope watchdogScope("error",
+                                          event.handle(),
+                                          socket.get());
         socket->processSocketError(event);
     }
     else {
@@ -1637,6 +1647,9 @@ void Dispatch::announceNotifications(
     const bsl::shared_ptr<ntci::Strand>&        destination)
 {
     if (NTCCFG_LIKELY(!destination)) {
+        ntcs::WatchdogScope watchdogScope("notifications",
+                                          notifications.handle(),
+                                          socket.get());
         socket->processNotifications(notifications);
     }
     else {
@@ -52,6 +52,7 @@ class ProactorMetrics : public ntci::ProactorMetrics,
     ntci::Metric                           d_numErrorsPerPoll;
     ntci::Metric                           d_numSocketsDeferred;
     ntci::Metric                           d_numWakeupsSpurious;
+    ntci::Metric                           d_numBusyPollHits;
     ntci::Metric                           d_readProcessingTime;
     ntci::Metric                           d_writeProcessingTime;
     ntci::Metric                           d_errorProcessingTime;
@@ -109,6 +110,11 @@ class ProactorMetrics : public ntci::ProactorMetrics,
     /// the controller interrupt system.
     void logSpuriousWakeup() BSLS_KEYWORD_OVERRIDE;
 
+    /// Log the completion of a busy poll that either discovered events
+    /// before the busy poll duration elapsed, according to the specified
+    /// 'hit' flag, or was followed by a blocking wait.
+    void logBusyPoll(bool hit) BSLS_KEYWORD_OVERRIDE;
+
     /// Log the specified 'duration' in the function to process a readable
     /// socket.
     void logReadCallback(const bsls::TimeInterval& duration)
@@ -262,6 +268,11 @@ ProactorMetricsGuard::~ProactorMetricsGuard()
         metrics->logSpuriousWakeup();                                         \
     }
 
+#define NTCS_PROACTORMETRICS_UPDATE_BUSY_POLL(hit)                            \
+    if (metrics) {                                                            \
+        metrics->logBusyPoll(hit);                                            \
+    }
+
 #define NTCS_PROACTORMETRICS_UPDATE_ERROR_CALLBACK_TIME_BEGIN()               \
     bsl::int64_t errorProcessingStartTime;                                    \
     if (metrics) {                                                            \
@@ -326,6 +337,7 @@ ProactorMetricsGuard::~ProactorMetricsGuard()
 #define NTCS_PROACTORMETRICS_UPDATE_POLL(numReadable, numWritable, numErrors)
 #define NTCS_PROACTORMETRICS_UPDATE_DEFERRED_SOCKET()
 #define NTCS_PROACTORMETRICS_UPDATE_SPURIOUS_WAKEUP()
+#define NTCS_PROACTORMETRICS_UPDATE_BUSY_POLL(hit)
 #define NTCS_PROACTORMETRICS_UPDATE_ERROR_CALLBACK_TIME_BEGIN()
 #define NTCS_PROACTORMETRICS_UPDATE_ERROR_CALLBACK_TIME_END()
 #define NTCS_PROACTORMETRICS_UPDATE_WRITE_CALLBACK_TIME_BEGIN()
@@ -54,6 +54,7 @@ const ntci::MetricMetadata ReactorMetrics::STATISTICS[] = {
     NTCI_METRIC_METADATA_SUMMARY(socketsFailed),
     NTCI_METRIC_METADATA_SUMMARY(socketsDeferred),
     NTCI_METRIC_METADATA_SUMMARY(wakeupsSpurious),
+    NTCI_METRIC_METADATA_SUMMARY(busyPollHits),
     NTCI_METRIC_METADATA_SUMMARY(timeProcessingReadability),
     NTCI_METRIC_METADATA_SUMMARY(timeProcessingWritability),
     NTCI_METRIC_METADATA_SUMMARY(timeProcessingError)};
@@ -68,6 +69,7 @@ ReactorMetrics::ReactorMetrics(const bslstl::StringRef& prefix,
 , d_numErrorsPerPoll()
 , d_numSocketsDeferred()
 , d_numWakeupsSpurious()
+, d_numBusyPollHits()
 , d_readProcessingTime()
 , d_writeProcessingTime()
 , d_errorProcessingTime()
@@ -90,6 +92,7 @@ ReactorMetrics::ReactorMetrics(
 , d_numErrorsPerPoll()
 , d_numSocketsDeferred()
 , d_numWakeupsSpurious()
+, d_numBusyPollHits()
 , d_readProcessingTime()
 , d_writeProcessingTime()
 , d_errorProcessingTime()
@@ -155,6 +158,15 @@ void ReactorMetrics::logSpuriousWakeup()
     }
 }
 
+void ReactorMetrics::logBusyPoll(bool hit)
+{
+    d_numBusyPollHits.update(hit ? 1 : 0);
+
+    if (d_parent_sp) {
+        d_parent_sp->logBusyPoll(hit);
+    }
+}
+
 void ReactorMetrics::logReadCallback(const bsls::TimeInterval& duration)
 {
     d_readProcessingTime.update(duration.totalSecondsAsDouble());
@@ -205,6 +217,8 @@ void ReactorMetrics::getStats(bdld::ManagedDatum* result)
 
     d_numWakeupsSpurious.collectSummary(&array, &index);
 
+    d_numBusyPollHits.collectSummary(&array, &index);
+
     d_readProcessingTime.collectSummary(&array, &index);
 
     d_writeProcessingTime.collectSummary(&array, &index);
@@ -0,0 +1,536 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_trace.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcs_trace_cpp, "$Id$ $CSID$")
+
+#include <ntccfg_tune.h>
+#include <bdlt_currenttime.h>
+#include <bdlt_datetime.h>
+#include <bdlt_epochutil.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
+#include <bsl_algorithm.h>
+#include <bsl_atomic.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_ostream.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+namespace {
+
+// The magic bytes that begin each saved trace.
+const char k_MAGIC[8] = {'N', 'T', 'C', 'T', 'R', 'A', 'C', 'E'};
+
+// The version of the saved trace format.
+const bsl::uint32_t k_VERSION = 1;
+
+// The value written in native byte order to detect traces saved on a host
+// having a different byte order.
+const bsl::uint32_t k_BYTE_ORDER = 0x01020304;
+
+// The default number of records in each ring.
+const bsl::size_t k_DEFAULT_CAPACITY = 1024;
+
+/// Describe the header of a saved trace.
+struct TraceHeader {
+    char          d_magic[8];
+    bsl::uint32_t d_version;
+    bsl::uint32_t d_byteOrder;
+    bsl::uint32_t d_recordSize;
+    bsl::uint32_t d_numRings;
+    bsl::int64_t  d_wallClock;
+    bsl::int64_t  d_timer;
+};
+
+/// Describe the header of each ring within a saved trace.
+struct TraceRingHeader {
+    bsl::uint64_t d_threadId;
+    bsl::uint64_t d_numRecords;
+};
+
+/// Provide a fixed-capacity ring of trace records written by a single
+/// thread and read by any thread.
+struct TraceRing {
+    TraceRecord*       d_records;
+    bsl::uint64_t      d_mask;
+    bsls::AtomicUint64 d_position;
+    bsl::uint64_t      d_threadId;
+    bool               d_active;
+};
+
+bslmt::ThreadUtil::Key   s_key;
+bsls::AtomicBool         s_enabled(true);
+bsls::AtomicUint64       s_capacity(k_DEFAULT_CAPACITY);
+bslmt::Mutex             s_mutex;
+bsl::vector<TraceRing*>* s_rings_p;
+
+/// Return the specified 'capacity' rounded up to the nearest power of two.
+bsl::uint64_t roundCapacity(bsl::uint64_t capacity)
+{
+    bsl::uint64_t result = 1;
+    while (result < capacity) {
+        result <<= 1;
+    }
+    return result;
+}
+
+/// Retire the ring assigned to an exiting thread so that it may be
+/// reassigned to a subsequently-created thread.
+void retireRing(void* key)
+{
+    if (key) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&s_mutex);
+        reinterpret_cast<TraceRing*>(key)->d_active = false;
+    }
+}
+
+/// Return the ring assigned to the current thread, assigning a ring if
+/// necessary.
+TraceRing* assignRing()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&s_mutex);
+
+    if (s_rings_p == 0) {
+        void* arena = bsl::malloc(sizeof(bsl::vector<TraceRing*>));
+        s_rings_p   = new (arena)
+            bsl::vector<TraceRing*>(bslma::Default::globalAllocator());
+    }
+
+    const bsl::uint64_t capacity = roundCapacity(s_capacity.load());
+
+    TraceRing* ring = 0;
+
+    for (bsl::size_t i = 0; i < s_rings_p->size(); ++i) {
+        TraceRing* candidate = (*s_rings_p)[i];
+        if (!candidate->d_active && candidate->d_mask + 1 == capacity) {
+            ring = candidate;
+            break;
+        }
+    }
+
+    if (ring == 0) {
+        void* arena = bsl::malloc(sizeof(TraceRing));
+        ring        = new (arena) TraceRing();
+
+        ring->d_records = static_cast<TraceRecord*>(
+            bsl::malloc(sizeof(TraceRecord) * capacity));
+        ring->d_mask = capacity - 1;
+
+        s_rings_p->push_back(ring);
+    }
+
+    ring->d_position.store(0);
+    ring->d_threadId = bslmt::ThreadUtil::selfIdAsUint64();
+    ring->d_active   = true;
+
+    int rc = bslmt::ThreadUtil::setSpecific(
+        s_key,
+        const_cast<const void*>(static_cast<void*>(ring)));
+    BSLS_ASSERT_OPT(rc == 0);
+
+    return ring;
+}
+
+/// Append to the specified 'result' the records currently retained by the
+/// specified 'ring', oldest first. Note that the owner of 'ring' may
+/// concurrently record events: records overwritten while being copied are
+/// discarded.
+void copyRing(bsl::vector<TraceRecord>* result, const TraceRing& ring)
+{
+    const bsl::uint64_t capacity = ring.d_mask + 1;
+    const bsl::uint64_t end      = ring.d_position.loadAcquire();
+    const bsl::uint64_t begin    = end > capacity ? end - capacity : 0;
+
+    const bsl::size_t offset = result->size();
+
+    for (bsl::uint64_t i = begin; i < end; ++i) {
+        result->push_back(ring.d_records[i & ring.d_mask]);
+    }
+
+    // The owner publishes a position before it overwrites the record that
+    // position allows to be overwritten, so prevent the copies above from
+    // being reordered after the position is read again: any record the
+    // owner has begun to overwrite is then detected by that read.
+
+    bsl::atomic_thread_fence(bsl::memory_order_acquire);
+
+    const bsl::uint64_t after = ring.d_position.loadRelaxed();
+    if (after > begin + capacity - 1) {
+        const bsl::uint64_t numOverwritten =
+            bsl::min(after - (begin + capacity - 1), end - begin);
+        result->erase(result->begin() + offset,
+                      result->begin() + offset + numOverwritten);
+    }
+}
+
+/// Return true if the specified 'lhs' occurred before the specified 'rhs',
+/// otherwise return false.
+bool isEarlier(const bsl::pair<bsl::uint64_t, TraceRecord>& lhs,
+               const bsl::pair<bsl::uint64_t, TraceRecord>& rhs)
+{
+    return lhs.second.d_timestamp < rhs.second.d_timestamp;
+}
+
+struct Initializer {
+    Initializer()
+    {
+        int rc = bslmt::ThreadUtil::createKey(&s_key, &retireRing);
+        BSLS_ASSERT_OPT(rc == 0);
+
+        bool enabled;
+        if (ntccfg::Tune::configure(&enabled, "NTC_TRACE")) {
+            s_enabled = enabled;
+        }
+
+        unsigned int capacity;
+        if (ntccfg::Tune::configure(&capacity, "NTC_TRACE_CAPACITY")) {
+            if (capacity > 0) {
+                s_capacity = capacity;
+            }
+        }
+    }
+
+    ~Initializer()
+    {
+        // The rings are intentionally leaked: threads may record events
+        // during static destruction.
+    }
+} s_initializer;
+
+const char* const k_EVENT_NAMES[] = {"UNDEFINED",
+                                     "WAIT_INDEFINITE",
+                                     "WAIT_TIMED",
+                                     "WAIT_RESULT",
+                                     "WAIT_TIMEOUT",
+                                     "WAIT_FAILURE",
+                                     "DESCRIPTOR_POLLED",
+                                     "DESCRIPTOR_ADDED",
+                                     "DESCRIPTOR_UPDATED",
+                                     "DESCRIPTOR_REMOVED",
+                                     "DESCRIPTOR_FAILURE",
+                                     "SEND",
+                                     "SEND_FAILURE",
+                                     "RECEIVE",
+                                     "RECEIVE_FAILURE",
+                                     "SEND_BUFFER_OVERFLOW",
+                                     "RECEIVE_BUFFER_UNDERFLOW",
+                                     "SEND_THROTTLE_APPLIED",
+                                     "SEND_THROTTLE_RELAXED",
+                                     "RECEIVE_THROTTLE_APPLIED",
+                                     "RECEIVE_THROTTLE_RELAXED",
+                                     "WRITE_QUEUE_FILLED",
+                                     "WRITE_QUEUE_DRAINED",
+                                     "WRITE_QUEUE_LOW_WATERMARK",
+                                     "WRITE_QUEUE_HIGH_WATERMARK",
+                                     "READ_QUEUE_FILLED",
+                                     "READ_QUEUE_DRAINED",
+                                     "READ_QUEUE_LOW_WATERMARK",
+                                     "READ_QUEUE_HIGH_WATERMARK",
+                                     "END_OF_FILE",
+                                     "SHUTDOWN_SEND",
+                                     "SHUTDOWN_RECEIVE"};
+
+const int k_NUM_EVENTS =
+    static_cast<int>(sizeof k_EVENT_NAMES / sizeof k_EVENT_NAMES[0]);
+
+}  // close unnamed namespace
+
+const char* TraceEvent::toString(Value value)
+{
+    const int index = static_cast<int>(value);
+    if (index >= 0 && index < k_NUM_EVENTS) {
+        return k_EVENT_NAMES[index];
+    }
+
+    return "UNKNOWN";
+}
+
+int TraceEvent::fromInt(Value* result, int number)
+{
+    if (number >= 0 && number < k_NUM_EVENTS) {
+        *result = static_cast<Value>(number);
+        return 0;
+    }
+
+    return -1;
+}
+
+bsl::ostream& TraceEvent::print(bsl::ostream& stream, Value value)
+{
+    return stream << toString(value);
+}
+
+bsl::ostream& operator<<(bsl::ostream& stream, TraceEvent::Value rhs)
+{
+    return TraceEvent::print(stream, rhs);
+}
+
+void Trace::enable()
+{
+    s_enabled = true;
+}
+
+void Trace::disable()
+{
+    s_enabled = false;
+}
+
+bool Trace::isEnabled()
+{
+    return s_enabled.loadRelaxed();
+}
+
+void Trace::setCapacity(bsl::size_t capacity)
+{
+    if (capacity > 0) {
+        s_capacity = capacity;
+    }
+}
+
+void Trace::record(ntcs::TraceEvent::Value event,
+                   ntsa::Handle            handle,
+                   bsl::uint64_t           value1,
+                   bsl::uint64_t           value2)
+{
+    if (NTCCFG_UNLIKELY(!s_enabled.loadRelaxed())) {
+        return;
+    }
+
+    TraceRing* ring =
+        reinterpret_cast<TraceRing*>(bslmt::ThreadUtil::getSpecific(s_key));
+
+    if (NTCCFG_UNLIKELY(ring == 0)) {
+        ring = assignRing();
+    }
+
+    const bsl::uint64_t position = ring->d_position.loadRelaxed();
+
+    TraceRecord& entry = ring->d_records[position & ring->d_mask];
+
+    // Ensure the position published by the previous record is visible
+    // before any store to the record it now allows to be overwritten.
+
+    bsl::atomic_thread_fence(bsl::memory_order_release);
+
+    entry.d_timestamp = bsls::TimeUtil::getTimer();
+    entry.d_event     = static_cast<bsl::uint16_t>(event);
+    entry.d_reserved  = 0;
+    entry.d_handle    = static_cast<bsl::int32_t>(handle);
+    entry.d_value1    = value1;
+    entry.d_value2    = value2;
+
+    ring->d_position.storeRelease(position + 1);
+}
+
+void Trace::clear()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&s_mutex);
+
+    if (s_rings_p == 0) {
+        return;
+    }
+
+    for (bsl::size_t i = 0; i < s_rings_p->size(); ++i) {
+        TraceRing* ring = (*s_rings_p)[i];
+        if (!ring->d_active) {
+            ring->d_position.store(0);
+        }
+        else if (ring->d_threadId == bslmt::ThreadUtil::selfIdAsUint64()) {
+            ring->d_position.store(0);
+        }
+    }
+}
+
+ntsa::Error Trace::save(bsl::streambuf* destination)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&s_mutex);
+
+    const bsl::size_t numRings = s_rings_p ? s_rings_p->size() : 0;
+
+    TraceHeader header;
+    bsl::memcpy(header.d_magic, k_MAGIC, sizeof header.d_magic);
+    header.d_version    = k_VERSION;
+    header.d_byteOrder  = k_BYTE_ORDER;
+    header.d_recordSize = sizeof(TraceRecord);
+    header.d_numRings   = static_cast<bsl::uint32_t>(numRings);
+    header.d_timer      = bsls::TimeUtil::getTimer();
+    header.d_wallClock  = bdlt::CurrentTime::now().totalNanoseconds();
+
+    const bsl::streamsize headerSize = sizeof header;
+    if (destination->sputn(reinterpret_cast<const char*>(&header),
+                           headerSize) != headerSize)
+    {
+        return ntsa::Error(ntsa::Error::e_LIMIT);
+    }
+
+    bsl::vector<TraceRecord> records(bslma::Default::globalAllocator());
+
+    for (bsl::size_t i = 0; i < numRings; ++i) {
+        const TraceRing& ring = *(*s_rings_p)[i];
+
+        records.clear();
+        copyRing(&records, ring);
+
+        TraceRingHeader ringHeader;
+        ringHeader.d_threadId   = ring.d_threadId;
+        ringHeader.d_numRecords = records.size();
+
+        const bsl::streamsize ringHeaderSize = sizeof ringHeader;
+        if (destination->sputn(reinterpret_cast<const char*>(&ringHeader),
+                               ringHeaderSize) != ringHeaderSize)
+        {
+            return ntsa::Error(ntsa::Error::e_LIMIT);
+        }
+
+        if (!records.empty()) {
+            const bsl::streamsize recordsSize =
+                static_cast<bsl::streamsize>(sizeof(TraceRecord) *
+                                             records.size());
+            if (destination->sputn(
+                    reinterpret_cast<const char*>(&records.front()),
+                    recordsSize) != recordsSize)
+            {
+                return ntsa::Error(ntsa::Error::e_LIMIT);
+            }
+        }
+    }
+
+    if (destination->pubsync() != 0) {
+        return ntsa::Error(ntsa::Error::e_LIMIT);
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error Trace::save(const bsl::string& path)
+{
+    bsl::filebuf file;
+    if (!file.open(path.c_str(),
+                   bsl::ios_base::out | bsl::ios_base::trunc |
+                       bsl::ios_base::binary))
+    {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    ntsa::Error error = Trace::save(&file);
+
+    if (!file.close()) {
+        if (!error) {
+            error = ntsa::Error(ntsa::Error::e_LIMIT);
+        }
+    }
+
+    return error;
+}
+
+ntsa::Error Trace::print(bsl::ostream& stream, bsl::streambuf* source)
+{
+    TraceHeader header;
+
+    const bsl::streamsize headerSize = sizeof header;
+    if (source->sgetn(reinterpret_cast<char*>(&header), headerSize) !=
+        headerSize)
+    {
+        return ntsa::Error(ntsa::Error::e_EOF);
+    }
+
+    if (bsl::memcmp(header.d_magic, k_MAGIC, sizeof header.d_magic) != 0 ||
+        header.d_version != k_VERSION ||
+        header.d_byteOrder != k_BYTE_ORDER ||
+        header.d_recordSize != sizeof(TraceRecord))
+    {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    typedef bsl::pair<bsl::uint64_t, TraceRecord> Entry;
+
+    bsl::vector<Entry> entries(bslma::Default::globalAllocator());
+
+    for (bsl::uint32_t i = 0; i < header.d_numRings; ++i) {
+        TraceRingHeader ringHeader;
+
+        const bsl::streamsize ringHeaderSize = sizeof ringHeader;
+        if (source->sgetn(reinterpret_cast<char*>(&ringHeader),
+                          ringHeaderSize) != ringHeaderSize)
+        {
+            return ntsa::Error(ntsa::Error::e_EOF);
+        }
+
+        for (bsl::uint64_t j = 0; j < ringHeader.d_numRecords; ++j) {
+            TraceRecord traceRecord;
+
+            const bsl::streamsize recordSize = sizeof traceRecord;
+            if (source->sgetn(reinterpret_cast<char*>(&traceRecord),
+                              recordSize) != recordSize)
+            {
+                return ntsa::Error(ntsa::Error::e_EOF);
+            }
+
+            entries.push_back(Entry(ringHeader.d_threadId, traceRecord));
+        }
+    }
+
+    bsl::stable_sort(entries.begin(), entries.end(), &isEarlier);
+
+    for (bsl::size_t i = 0; i < entries.size(); ++i) {
+        const bsl::uint64_t threadId    = entries[i].first;
+        const TraceRecord&  traceRecord = entries[i].second;
+
+        bsls::TimeInterval wallClock;
+        wallClock.setTotalNanoseconds(
+            header.d_wallClock + (traceRecord.d_timestamp - header.d_timer));
+
+        bdlt::Datetime datetime =
+            bdlt::EpochUtil::convertFromTimeInterval(wallClock);
+
+        // Traces saved by a newer build may contain events unknown to this
+        // build: describe such events by their number rather than failing.
+
+        stream << datetime << " thread " << threadId << " descriptor "
+               << traceRecord.d_handle << ' ';
+
+        ntcs::TraceEvent::Value event;
+        if (ntcs::TraceEvent::fromInt(&event, traceRecord.d_event) == 0) {
+            stream << ntcs::TraceEvent::toString(event);
+        }
+        else {
+            stream << "UNKNOWN(" << traceRecord.d_event << ')';
+        }
+
+        stream << ' ' << traceRecord.d_value1 << ' ' << traceRecord.d_value2
+               << '\n';
+    }
+
+    stream.flush();
+
+    return ntsa::Error();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,297 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCS_TRACE
+#define INCLUDED_NTCS_TRACE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_platform.h>
+#include <ntcscm_version.h>
+#include <ntsa_error.h>
+#include <ntsa_handle.h>
+#include <bsl_cstdint.h>
+#include <bsl_iosfwd.h>
+#include <bsl_streambuf.h>
+#include <bsl_string.h>
+
+/// Record the specified 'event' that occurred for the specified 'handle',
+/// described by the specified 'value1' and 'value2', into the trace ring of
+/// the current thread. The 'event' must be an enumerator of
+/// 'ntcs::TraceEvent::Value'.
+#define NTCS_TRACE(event, handle, value1, value2)                             \
+    BloombergLP::ntcs::Trace::record(                                         \
+        BloombergLP::ntcs::TraceEvent::event,                                 \
+        (handle),                                                             \
+        static_cast<bsl::uint64_t>(value1),                                   \
+        static_cast<bsl::uint64_t>(value2))
+
+namespace BloombergLP {
+namespace ntcs {
+
+/// @internal @brief
+/// Enumerate the structured events recorded by the trace facility.
+///
+/// @details
+/// The meaning of the two values recorded with each event is described
+/// alongside each enumerator. The numeric value of each enumerator is part
+/// of the persisted trace format: enumerators may be added but never
+/// renumbered.
+///
+/// @par Thread Safety
+/// This struct is thread safe.
+///
+/// @ingroup module_ntcs
+struct TraceEvent {
+  public:
+    /// Enumerate the structured events recorded by the trace facility.
+    enum Value {
+        /// The event is undefined.
+        e_UNDEFINED = 0,
+
+        /// The driver is polling indefinitely. No values.
+        e_WAIT_INDEFINITE = 1,
+
+        /// The driver is polling with a timeout. The first value is the
+        /// timeout in microseconds.
+        e_WAIT_TIMED = 2,
+
+        /// The driver polled events. The first value is the number of
+        /// events.
+        e_WAIT_RESULT = 3,
+
+        /// The driver timed out polling. No values.
+        e_WAIT_TIMEOUT = 4,
+
+        /// The driver failed to poll. The first value is the error number.
+        e_WAIT_FAILURE = 5,
+
+        /// The driver polled an event for a descriptor. The first value is
+        /// the driver-specific event mask.
+        e_DESCRIPTOR_POLLED = 6,
+
+        /// The driver gained interest in a descriptor. The first value is
+        /// the driver-specific event mask.
+        e_DESCRIPTOR_ADDED = 7,
+
+        /// The driver updated its interest in a descriptor. The first value
+        /// is the driver-specific event mask.
+        e_DESCRIPTOR_UPDATED = 8,
+
+        /// The driver lost interest in a descriptor. No values.
+        e_DESCRIPTOR_REMOVED = 9,
+
+        /// The driver failed to change its interest in a descriptor. The
+        /// first value is the error number.
+        e_DESCRIPTOR_FAILURE = 10,
+
+        /// The socket copied data to the socket send buffer. The values are
+        /// the number of bytes sent and the number of bytes attempted.
+        e_SEND = 11,
+
+        /// The socket failed to send. The first value is the error number.
+        e_SEND_FAILURE = 12,
+
+        /// The socket copied data from the socket receive buffer. The values
+        /// are the number of bytes received and the number of bytes
+        /// attempted.
+        e_RECEIVE = 13,
+
+        /// The socket failed to receive. The first value is the error
+        /// number.
+        e_RECEIVE_FAILURE = 14,
+
+        /// The socket saturated the socket send buffer. No values.
+        e_SEND_BUFFER_OVERFLOW = 15,
+
+        /// The socket emptied the socket receive buffer. No values.
+        e_RECEIVE_BUFFER_UNDERFLOW = 16,
+
+        /// The socket applied the send rate limit. The first value is the
+        /// delay in microseconds.
+        e_SEND_THROTTLE_APPLIED = 17,
+
+        /// The socket relaxed the send rate limit. No values.
+        e_SEND_THROTTLE_RELAXED = 18,
+
+        /// The socket applied the receive rate limit. The first value is the
+        /// delay in microseconds.
+        e_RECEIVE_THROTTLE_APPLIED = 19,
+
+        /// The socket relaxed the receive rate limit. No values.
+        e_RECEIVE_THROTTLE_RELAXED = 20,
+
+        /// The write queue grew. The values are the size of the write queue
+        /// and its high watermark.
+        e_WRITE_QUEUE_FILLED = 21,
+
+        /// The write queue shrank. The values are the size of the write
+        /// queue and its high watermark.
+        e_WRITE_QUEUE_DRAINED = 22,
+
+        /// The write queue satisfied its low watermark. The values are the
+        /// size of the write queue and its low watermark.
+        e_WRITE_QUEUE_LOW_WATERMARK = 23,
+
+        /// The write queue breached its high watermark. The values are the
+        /// size of the write queue and its high watermark.
+        e_WRITE_QUEUE_HIGH_WATERMARK = 24,
+
+        /// The read queue grew. The first value is the size of the read
+        /// queue.
+        e_READ_QUEUE_FILLED = 25,
+
+        /// The read queue shrank. The first value is the size of the read
+        /// queue.
+        e_READ_QUEUE_DRAINED = 26,
+
+        /// The read queue satisfied its low watermark. The values are the
+        /// size of the read queue and its low watermark.
+        e_READ_QUEUE_LOW_WATERMARK = 27,
+
+        /// The read queue breached its high watermark. The values are the
+        /// size of the read queue and its high watermark.
+        e_READ_QUEUE_HIGH_WATERMARK = 28,
+
+        /// The socket read all data from its peer. No values.
+        e_END_OF_FILE = 29,
+
+        /// The socket is shutting down transmission. No values.
+        e_SHUTDOWN_SEND = 30,
+
+        /// The socket is shutting down reception. No values.
+        e_SHUTDOWN_RECEIVE = 31
+    };
+
+    /// Return the string representation exactly matching the enumerator
+    /// name corresponding to the specified enumeration 'value', or
+    /// "UNKNOWN" if 'value' does not match any enumerator.
+    static const char* toString(Value value);
+
+    /// Load into the specified 'result' the enumerator matching the
+    /// specified 'number'. Return 0 on success, and a non-zero value with
+    /// no effect on 'result' if 'number' does not match any enumerator.
+    static int fromInt(Value* result, int number);
+
+    /// Write to the specified 'stream' the string representation of the
+    /// specified enumeration 'value'. Return a reference to the modifiable
+    /// 'stream'.
+    static bsl::ostream& print(bsl::ostream& stream, Value value);
+};
+
+/// Format the specified 'rhs' to the specified output 'stream' and return a
+/// reference to the modifiable 'stream'.
+///
+/// @related ntcs::TraceEvent
+bsl::ostream& operator<<(bsl::ostream& stream, TraceEvent::Value rhs);
+
+/// @internal @brief
+/// Describe a binary trace record.
+///
+/// @details
+/// Each record has a fixed size and layout so that it may be written with a
+/// handful of stores and persisted without any encoding. The timestamp is
+/// measured by the monotonic clock, in nanoseconds. Persisted traces record
+/// the correspondence between the monotonic clock and the wall clock at the
+/// time the trace is saved.
+///
+/// @par Thread Safety
+/// This struct is not thread safe.
+///
+/// @ingroup module_ntcs
+struct TraceRecord {
+    bsl::int64_t  d_timestamp;
+    bsl::uint16_t d_event;
+    bsl::uint16_t d_reserved;
+    bsl::int32_t  d_handle;
+    bsl::uint64_t d_value1;
+    bsl::uint64_t d_value2;
+};
+
+/// @internal @brief
+/// Provide a per-thread, binary flight recorder.
+///
+/// @details
+/// Each thread that records an event is lazily assigned a fixed-capacity
+/// ring of 'ntcs::TraceRecord' objects, into which only that thread writes.
+/// Recording an event never locks, allocates (except when the ring is first
+/// assigned), or formats: the cost is a clock read and a few stores. When a
+/// ring is full the oldest records are overwritten.
+///
+/// The rings of all threads, including threads that have exited but whose
+/// rings have not yet been reassigned, may be saved at any time, for
+/// example when an incident is detected, without stopping the recording
+/// threads. Saved traces are decoded offline by 'print', which is the basis
+/// of the 'ntctrace' tool.
+///
+/// Tracing is enabled by default. Tracing is disabled either by calling
+/// 'disable' or by setting the environment variable 'NTC_TRACE' to 0, in
+/// which case recording an event costs a single load and no ring is
+/// assigned to any thread. The environment variable 'NTC_TRACE_CAPACITY'
+/// may be set to the number of records in each ring.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntcs
+class Trace
+{
+  public:
+    /// Enable the recording of events.
+    static void enable();
+
+    /// Disable the recording of events. Events already recorded are
+    /// retained.
+    static void disable();
+
+    /// Return true if the recording of events is enabled, otherwise return
+    /// false.
+    static bool isEnabled();
+
+    /// Set the number of records in each ring subsequently assigned to a
+    /// thread to the specified 'capacity', rounded up to the nearest power
+    /// of two.
+    static void setCapacity(bsl::size_t capacity);
+
+    /// Record the specified 'event' that occurred for the specified
+    /// 'handle', described by the specified 'value1' and 'value2', into the
+    /// ring of the current thread, if tracing is enabled.
+    static void record(ntcs::TraceEvent::Value event,
+                       ntsa::Handle            handle,
+                       bsl::uint64_t           value1,
+                       bsl::uint64_t           value2);
+
+    /// Discard the events recorded by the current thread and by threads
+    /// that have exited.
+    static void clear();
+
+    /// Write the events recorded by all threads to the specified
+    /// 'destination'. Return the error.
+    static ntsa::Error save(bsl::streambuf* destination);
+
+    /// Write the events recorded by all threads to the file at the
+    /// specified 'path'. Return the error.
+    static ntsa::Error save(const bsl::string& path);
+
+    /// Decode the trace previously saved to the specified 'source' and
+    /// write the events, one per line, ordered by time, to the specified
+    /// 'stream'. Return the error.
+    static ntsa::Error print(bsl::ostream& stream, bsl::streambuf* source);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
@@ -0,0 +1,226 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_trace.h>
+
+#include <ntccfg_test.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+#include <bdlsb_memoutstreambuf.h>
+#include <bslmt_threadutil.h>
+#include <bsl_cstdlib.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+//
+//-----------------------------------------------------------------------------
+
+// [ 1]
+//-----------------------------------------------------------------------------
+// [ 1]
+//-----------------------------------------------------------------------------
+
+namespace test {
+
+/// Save the trace and decode it into the specified 'result'. Return the
+/// error.
+ntsa::Error decode(bsl::string* result, bslma::Allocator* allocator)
+{
+    ntsa::Error error;
+
+    bdlsb::MemOutStreamBuf destination(allocator);
+
+    error = ntcs::Trace::save(&destination);
+    if (error) {
+        return error;
+    }
+
+    bdlsb::FixedMemInStreamBuf source(destination.data(),
+                                      destination.length());
+
+    bsl::ostringstream ss(allocator);
+
+    error = ntcs::Trace::print(ss, &source);
+    if (error) {
+        return error;
+    }
+
+    *result = ss.str();
+    return ntsa::Error();
+}
+
+/// Record an event from a thread other than the main thread.
+extern "C" void* recordFromThread(void*)
+{
+    NTCS_TRACE(e_SHUTDOWN_SEND, 7, 0, 0);
+    return 0;
+}
+
+}  // close namespace test
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Tracing is enabled by default, and recorded events are saved
+    // and decoded in order, including events recorded by threads that have
+    // exited.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        if (bsl::getenv("NTC_TRACE") == 0) {
+            NTCCFG_TEST_TRUE(ntcs::Trace::isEnabled());
+        }
+
+        ntcs::Trace::enable();
+        ntcs::Trace::clear();
+
+        NTCS_TRACE(e_DESCRIPTOR_ADDED, 5, 1, 0);
+        NTCS_TRACE(e_SEND, 5, 100, 200);
+        NTCS_TRACE(e_RECEIVE_FAILURE, 5, 104, 0);
+
+        bslmt::ThreadUtil::Handle thread;
+        int rc =
+            bslmt::ThreadUtil::create(&thread, &test::recordFromThread, 0);
+        NTCCFG_TEST_EQ(rc, 0);
+
+        rc = bslmt::ThreadUtil::join(thread);
+        NTCCFG_TEST_EQ(rc, 0);
+
+        bsl::string output(&ta);
+        error = test::decode(&output, &ta);
+        NTCCFG_TEST_OK(error);
+
+        NTCCFG_TEST_LOG_DEBUG << "Trace:\n" << output << NTCCFG_TEST_LOG_END;
+
+        const bsl::size_t added    = output.find(" DESCRIPTOR_ADDED 1 0");
+        const bsl::size_t sent     = output.find(" SEND 100 200");
+        const bsl::size_t failed   = output.find(" RECEIVE_FAILURE 104 0");
+        const bsl::size_t shutdown = output.find(" SHUTDOWN_SEND 0 0");
+
+        NTCCFG_TEST_NE(added, bsl::string::npos);
+        NTCCFG_TEST_NE(sent, bsl::string::npos);
+        NTCCFG_TEST_NE(failed, bsl::string::npos);
+        NTCCFG_TEST_NE(shutdown, bsl::string::npos);
+
+        NTCCFG_TEST_LT(added, sent);
+        NTCCFG_TEST_LT(sent, failed);
+        NTCCFG_TEST_LT(failed, shutdown);
+
+        NTCCFG_TEST_NE(output.find("descriptor 7 SHUTDOWN_SEND"),
+                       bsl::string::npos);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: Events are not recorded while tracing is disabled, and the
+    // oldest events are overwritten when a ring is full.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        ntcs::Trace::enable();
+        ntcs::Trace::clear();
+
+        ntcs::Trace::disable();
+        NTCCFG_TEST_FALSE(ntcs::Trace::isEnabled());
+
+        NTCS_TRACE(e_END_OF_FILE, 5, 0, 0);
+
+        ntcs::Trace::enable();
+        NTCCFG_TEST_TRUE(ntcs::Trace::isEnabled());
+
+        for (bsl::uint64_t i = 0; i < 100000; ++i) {
+            NTCS_TRACE(e_WAIT_RESULT, 3, i, 0);
+        }
+
+        bsl::string output(&ta);
+        error = test::decode(&output, &ta);
+        NTCCFG_TEST_OK(error);
+
+        NTCCFG_TEST_EQ(output.find("END_OF_FILE"), bsl::string::npos);
+        NTCCFG_TEST_EQ(output.find(" WAIT_RESULT 0 0"), bsl::string::npos);
+        NTCCFG_TEST_NE(output.find(" WAIT_RESULT 99999 0"),
+                       bsl::string::npos);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(3)
+{
+    // Concern: Decoding data that is not a saved trace fails.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        const char DATA[] = "This is not a trace, but it is long enough to "
+                            "be mistaken for one if not validated";
+
+        bdlsb::FixedMemInStreamBuf source(DATA, sizeof DATA);
+
+        bsl::ostringstream ss(&ta);
+
+        error = ntcs::Trace::print(ss, &source);
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_INVALID));
+
+        bdlsb::FixedMemInStreamBuf empty(DATA, 0);
+
+        error = ntcs::Trace::print(ss, &empty);
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_EOF));
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(4)
+{
+    // Concern: Events unknown to this build are described rather than
+    // rejected.
+    // Plan:
+
+    NTCCFG_TEST_EQ(bsl::string(ntcs::TraceEvent::toString(
+                       ntcs::TraceEvent::e_SHUTDOWN_RECEIVE)),
+                   "SHUTDOWN_RECEIVE");
+
+    NTCCFG_TEST_EQ(bsl::string(ntcs::TraceEvent::toString(
+                       static_cast<ntcs::TraceEvent::Value>(31 + 1))),
+                   "UNKNOWN");
+
+    ntcs::TraceEvent::Value event = ntcs::TraceEvent::e_UNDEFINED;
+    NTCCFG_TEST_NE(ntcs::TraceEvent::fromInt(&event, 1000), 0);
+    NTCCFG_TEST_EQ(event, ntcs::TraceEvent::e_UNDEFINED);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+    NTCCFG_TEST_REGISTER(3);
+    NTCCFG_TEST_REGISTER(4);
+}
+NTCCFG_TEST_DRIVER_END;
@@ -0,0 +1,451 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_watchdog.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcs_watchdog_cpp, "$Id$ $CSID$")
+
+#include <ntci_log.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_threadutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bsls_assert.h>
+#include <bsls_timeutil.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+namespace {
+
+bslmt::ThreadUtil::Key s_key;
+
+struct Initializer {
+    Initializer()
+    {
+        int rc = bslmt::ThreadUtil::createKey(&s_key, 0);
+        BSLS_ASSERT_OPT(rc == 0);
+    }
+
+    ~Initializer()
+    {
+    }
+} s_initializer;
+
+/// Return the specified 'nanoseconds' as a number of seconds.
+double toSeconds(bsl::int64_t nanoseconds)
+{
+    return static_cast<double>(nanoseconds) / 1000000000.0;
+}
+
+/// Load into the specified 'buffer' having the specified 'capacity' a
+/// description of the specified 'socket' identified by the specified
+/// 'handle' and of the specified 'owner', omitting each identifier that is
+/// not defined.
+void describe(char*                   buffer,
+              bsl::size_t             capacity,
+              ntsa::Handle            handle,
+              const ntsi::Descriptor* socket,
+              const char*             owner)
+{
+    bsl::size_t length = 0;
+    int         rc     = 0;
+
+    if (handle != ntsa::k_INVALID_HANDLE) {
+        rc = bsl::snprintf(buffer + length,
+                           capacity - length,
+                           "descriptor %d",
+                           static_cast<int>(handle));
+        if (rc > 0) {
+            length = bsl::min(length + static_cast<bsl::size_t>(rc),
+                              capacity - 1);
+        }
+    }
+
+    if (socket != 0) {
+        rc = bsl::snprintf(buffer + length,
+                           capacity - length,
+                           "%ssocket %p",
+                           length > 0 ? ", " : "",
+                           static_cast<const void*>(socket));
+        if (rc > 0) {
+            length = bsl::min(length + static_cast<bsl::size_t>(rc),
+                              capacity - 1);
+        }
+    }
+
+    if (owner != 0 && owner[0] != 0) {
+        rc = bsl::snprintf(buffer + length,
+                           capacity - length,
+                           "%sowner '%s'",
+                           length > 0 ? ", " : "",
+                           owner);
+        if (rc > 0) {
+            length = bsl::min(length + static_cast<bsl::size_t>(rc),
+                              capacity - 1);
+        }
+    }
+
+    if (length == 0) {
+        bsl::snprintf(buffer, capacity, "an unknown socket");
+    }
+}
+
+}  // close unnamed namespace
+
+const ntci::MetricMetadata Watchdog::STATISTICS[] = {
+    NTCI_METRIC_METADATA_SUMMARY(timeProcessingCallback),
+    NTCI_METRIC_METADATA_SUMMARY(timeProcessingCycle),
+    NTCI_METRIC_METADATA_SUMMARY(callbacksStalled),
+    NTCI_METRIC_METADATA_SUMMARY(cyclesStalled)};
+
+Watchdog::Watchdog(const bslstl::StringRef&  prefix,
+                   const bslstl::StringRef&  objectName,
+                   const bsls::TimeInterval& threshold,
+                   bslma::Allocator*         basicAllocator)
+: d_mutex()
+, d_thresholdInNanoseconds(threshold.totalNanoseconds())
+, d_depth(0)
+, d_cycleTimeInNanoseconds(0)
+, d_startTime(0)
+, d_handle(ntsa::k_INVALID_HANDLE)
+, d_owner_p(0)
+, d_socket_p(0)
+, d_activity_p(0)
+, d_sequence(0)
+, d_reportedSequence(0)
+, d_numStalledCallbacks(0)
+, d_numStalledCycles(0)
+, d_callbackTime()
+, d_cycleTime()
+, d_numCallbacksStalled()
+, d_numCyclesStalled()
+, d_prefix(prefix, basicAllocator)
+, d_objectName(objectName, basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+Watchdog::~Watchdog()
+{
+}
+
+void Watchdog::enter(const char*             activity,
+                     ntsa::Handle            handle,
+                     const ntsi::Descriptor* socket)
+{
+    if (d_depth++ != 0) {
+        return;
+    }
+
+    const char* owner = 0;
+
+    ntci::LogContext* logContext = ntci::LogContext::getThreadLocal();
+    if (logContext) {
+        owner = logContext->d_owner;
+    }
+
+    // Increment the sequence number before publishing the remaining state so
+    // that a concurrent 'check()' never attributes the start time of one
+    // activity to another.
+
+    ++d_sequence;
+
+    d_activity_p.storeRelease(activity);
+    d_handle.storeRelease(handle);
+    d_owner_p.storeRelease(owner);
+    d_socket_p.storeRelease(socket);
+    d_startTime.storeRelease(bsls::TimeUtil::getTimer());
+}
+
+void Watchdog::leave()
+{
+    BSLS_ASSERT(d_depth > 0);
+
+    if (--d_depth != 0) {
+        return;
+    }
+
+    const bsl::int64_t stopTime  = bsls::TimeUtil::getTimer();
+    const bsl::int64_t startTime = d_startTime.swap(0);
+
+    bsl::int64_t duration = stopTime - startTime;
+    if (duration < 0) {
+        duration = 0;
+    }
+
+    d_cycleTimeInNanoseconds += duration;
+    d_callbackTime.update(toSeconds(duration));
+
+    if (NTCCFG_LIKELY(duration <= d_thresholdInNanoseconds)) {
+        return;
+    }
+
+    // Mark the activity as reported. If 'check()' has already reported the
+    // activity as stalled, do not report it again.
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        const bsl::uint64_t sequence = d_sequence.load();
+
+        if (d_reportedSequence == sequence) {
+            return;
+        }
+
+        d_reportedSequence = sequence;
+    }
+
+    ++d_numStalledCallbacks;
+    d_numCallbacksStalled.update(1);
+
+    NTCI_LOG_CONTEXT();
+
+    char identity[k_MAX_IDENTITY_LENGTH];
+    describe(identity,
+             sizeof identity,
+             d_handle.loadAcquire(),
+             d_socket_p.loadAcquire(),
+             d_owner_p.loadAcquire());
+
+    NTCI_LOG_WARN("Callback '%s' for %s completed after %.6f "
+                  "seconds, exceeding the stall threshold of %.6f seconds",
+                  d_activity_p.loadAcquire(),
+                  identity,
+                  toSeconds(duration),
+                  toSeconds(d_thresholdInNanoseconds));
+}
+
+void Watchdog::cycle()
+{
+    if (d_depth != 0) {
+        return;
+    }
+
+    const bsl::int64_t duration = d_cycleTimeInNanoseconds;
+    if (duration == 0) {
+        return;
+    }
+
+    d_cycleTimeInNanoseconds = 0;
+
+    d_cycleTime.update(toSeconds(duration));
+
+    if (NTCCFG_LIKELY(duration <= d_thresholdInNanoseconds)) {
+        return;
+    }
+
+    ++d_numStalledCycles;
+    d_numCyclesStalled.update(1);
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_WARN("Wait cycle completed after %.6f seconds of processing, "
+                  "exceeding the stall threshold of %.6f seconds",
+                  toSeconds(duration),
+                  toSeconds(d_thresholdInNanoseconds));
+}
+
+bool Watchdog::check()
+{
+    const bsl::uint64_t sequence = d_sequence.load();
+
+    const bsl::int64_t startTime = d_startTime.loadAcquire();
+    if (startTime == 0) {
+        return false;
+    }
+
+    bsl::int64_t duration = bsls::TimeUtil::getTimer() - startTime;
+    if (duration <= d_thresholdInNanoseconds) {
+        return false;
+    }
+
+    const char*             activity = d_activity_p.loadAcquire();
+    ntsa::Handle            handle   = d_handle.loadAcquire();
+    const ntsi::Descriptor* socket   = d_socket_p.loadAcquire();
+    const char*             owner    = d_owner_p.loadAcquire();
+
+    if (d_sequence.load() != sequence) {
+        return false;
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (d_reportedSequence == sequence) {
+            return true;
+        }
+
+        d_reportedSequence = sequence;
+    }
+
+    ++d_numStalledCallbacks;
+    d_numCallbacksStalled.update(1);
+
+    NTCI_LOG_CONTEXT();
+
+    NTCI_LOG_CONTEXT_GUARD_OWNER(d_objectName.c_str());
+
+    char identity[k_MAX_IDENTITY_LENGTH];
+    describe(identity, sizeof identity, handle, socket, owner);
+
+    NTCI_LOG_WARN("Callback '%s' for %s has stalled the thread "
+                  "for %.6f seconds, exceeding the stall threshold of %.6f "
+                  "seconds",
+                  activity,
+                  identity,
+                  toSeconds(duration),
+                  toSeconds(d_thresholdInNanoseconds));
+
+    return true;
+}
+
+void Watchdog::getStats(bdld::ManagedDatum* result)
+{
+    this->check();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    bdld::DatumMutableArrayRef array;
+    bdld::Datum::createUninitializedArray(&array,
+                                          numOrdinals(),
+                                          result->allocator());
+
+    bsl::size_t index = 0;
+
+    d_callbackTime.collectSummary(&array, &index);
+
+    d_cycleTime.collectSummary(&array, &index);
+
+    d_numCallbacksStalled.collectSummary(&array, &index);
+
+    d_numCyclesStalled.collectSummary(&array, &index);
+
+    *array.length() = numOrdinals();
+
+    result->adopt(bdld::Datum::adoptArray(array));
+}
+
+const char* Watchdog::getFieldPrefix(int ordinal) const
+{
+    NTCCFG_WARNING_UNUSED(ordinal);
+
+    return d_prefix.c_str();
+}
+
+const char* Watchdog::getFieldName(int ordinal) const
+{
+    if (ordinal < numOrdinals()) {
+        return Watchdog::STATISTICS[ordinal].d_name;
+    }
+    else {
+        return 0;
+    }
+}
+
+const char* Watchdog::getFieldDescription(int ordinal) const
+{
+    NTCCFG_WARNING_UNUSED(ordinal);
+
+    return "";
+}
+
+ntci::Monitorable::StatisticType Watchdog::getFieldType(int ordinal) const
+{
+    if (ordinal < numOrdinals()) {
+        return Watchdog::STATISTICS[ordinal].d_type;
+    }
+    else {
+        return ntci::Monitorable::e_AVERAGE;
+    }
+}
+
+int Watchdog::getFieldTags(int ordinal) const
+{
+    NTCCFG_WARNING_UNUSED(ordinal);
+
+    return ntci::Monitorable::e_ANONYMOUS;
+}
+
+int Watchdog::getFieldOrdinal(const char* fieldName) const
+{
+    for (int ordinal = 0; ordinal < numOrdinals(); ++ordinal) {
+        if (bsl::strcmp(Watchdog::STATISTICS[ordinal].d_name, fieldName) ==
+            0)
+        {
+            return ordinal;
+        }
+    }
+
+    return -1;
+}
+
+int Watchdog::numOrdinals() const
+{
+    return sizeof Watchdog::STATISTICS / sizeof Watchdog::STATISTICS[0];
+}
+
+const char* Watchdog::objectName() const
+{
+    return d_objectName.c_str();
+}
+
+bsls::TimeInterval Watchdog::threshold() const
+{
+    bsls::TimeInterval result;
+    result.setTotalNanoseconds(d_thresholdInNanoseconds);
+    return result;
+}
+
+bsl::uint64_t Watchdog::numStalledCallbacks() const
+{
+    return d_numStalledCallbacks.load();
+}
+
+bsl::uint64_t Watchdog::numStalledCycles() const
+{
+    return d_numStalledCycles.load();
+}
+
+ntcs::Watchdog* Watchdog::setThreadLocal(ntcs::Watchdog* watchdog)
+{
+    ntcs::Watchdog* previous = reinterpret_cast<ntcs::Watchdog*>(
+        bslmt::ThreadUtil::getSpecific(s_key));
+
+    int rc = bslmt::ThreadUtil::setSpecific(
+        s_key,
+        const_cast<const void*>(static_cast<void*>(watchdog)));
+    BSLS_ASSERT_OPT(rc == 0);
+
+    return previous;
+}
+
+ntcs::Watchdog* Watchdog::getThreadLocal()
+{
+    ntcs::Watchdog* current = reinterpret_cast<ntcs::Watchdog*>(
+        bslmt::ThreadUtil::getSpecific(s_key));
+
+    return current;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,300 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCS_WATCHDOG
+#define INCLUDED_NTCS_WATCHDOG
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntccfg_platform.h>
+#include <ntci_metric.h>
+#include <ntci_monitorable.h>
+#include <ntcscm_version.h>
+#include <ntsa_handle.h>
+#include <ntsi_descriptor.h>
+
+#include <bslmt_mutex.h>
+#include <bsls_atomic.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_memory.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace ntcs {
+
+/// @internal @brief
+/// Provide a detector of callbacks that stall an I/O thread.
+///
+/// @details
+/// A watchdog measures the time spent by an I/O thread in each callback it
+/// dispatches, and the time spent processing each cycle of its wait loop,
+/// reporting to the log each callback or cycle whose duration exceeds a
+/// threshold, attributed to the socket being processed. Callbacks still in
+/// progress are reported as stalled when the watchdog is checked from any
+/// other thread, which occurs each time the watchdog statistics are
+/// collected.
+///
+/// A watchdog is installed into the thread-local storage of the I/O thread
+/// it observes by a 'ntcs::WatchdogGuard'. Each callback to be measured
+/// is bracketed by a 'ntcs::WatchdogScope', which has no effect when no
+/// watchdog is installed for the current thread.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntcs
+class Watchdog : public ntci::Monitorable, public ntccfg::Shared<Watchdog>
+{
+    mutable bslmt::Mutex                        d_mutex;
+    bsl::int64_t                                d_thresholdInNanoseconds;
+    bsl::size_t                                 d_depth;
+    bsl::int64_t                                d_cycleTimeInNanoseconds;
+    bsls::AtomicInt64                           d_startTime;
+    bsls::AtomicInt                             d_handle;
+    bsls::AtomicPointer<const char>             d_owner_p;
+    bsls::AtomicPointer<const ntsi::Descriptor> d_socket_p;
+    bsls::AtomicPointer<const char>             d_activity_p;
+    bsls::AtomicUint64                          d_sequence;
+    bsl::uint64_t                               d_reportedSequence;
+    bsls::AtomicUint64                          d_numStalledCallbacks;
+    bsls::AtomicUint64                          d_numStalledCycles;
+    ntci::Metric                                d_callbackTime;
+    ntci::Metric                                d_cycleTime;
+    ntci::Metric                                d_numCallbacksStalled;
+    ntci::Metric                                d_numCyclesStalled;
+    bsl::string                                 d_prefix;
+    bsl::string                                 d_objectName;
+    bslma::Allocator*                           d_allocator_p;
+
+    static const struct ntci::MetricMetadata STATISTICS[];
+
+  private:
+    Watchdog(const Watchdog&) BSLS_KEYWORD_DELETED;
+    Watchdog& operator=(const Watchdog&) BSLS_KEYWORD_DELETED;
+
+  public:
+    enum {
+        /// The maximum length of the description of the socket to which a
+        /// reported activity is attributed.
+        k_MAX_IDENTITY_LENGTH = 256
+    };
+
+    /// Create a new watchdog for the specified 'objectName' whose field
+    /// names have the specified 'prefix', reporting each callback or cycle
+    /// whose duration exceeds the specified 'threshold'. Optionally specify
+    /// a 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
+    /// the currently installed default allocator is used.
+    Watchdog(const bslstl::StringRef&  prefix,
+             const bslstl::StringRef&  objectName,
+             const bsls::TimeInterval& threshold,
+             bslma::Allocator*         basicAllocator = 0);
+
+    /// Destroy this object.
+    ~Watchdog() BSLS_KEYWORD_OVERRIDE;
+
+    /// Mark the beginning of the specified 'activity' performed for the
+    /// specified 'socket' identified by the specified 'handle'. Attribute
+    /// the activity to the owner in the log context of the current thread,
+    /// if any. Either 'handle' may be invalid or 'socket' may be null if
+    /// the activity is not performed for a socket. The behavior is
+    /// undefined unless this function is called by the thread observed by
+    /// this watchdog and 'activity' has static storage duration. Note that
+    /// 'socket' identifies the socket in reports but is never dereferenced.
+    void enter(const char*             activity,
+               ntsa::Handle            handle,
+               const ntsi::Descriptor* socket);
+
+    /// Mark the end of the activity most recently entered. Report the
+    /// activity if its duration exceeds the threshold, unless it has
+    /// already been reported as stalled by 'check()'. The behavior is
+    /// undefined unless this function is called by the thread observed by
+    /// this watchdog.
+    void leave();
+
+    /// Mark the end of the current cycle of the wait loop. Report the cycle
+    /// if the total duration of the activities performed during the cycle
+    /// exceeds the threshold. The behavior is undefined unless this
+    /// function is called by the thread observed by this watchdog.
+    void cycle();
+
+    /// Report the activity currently in progress, if any, if it has been in
+    /// progress longer than the threshold and has not already been
+    /// reported. Return true if the observed thread is stalled, otherwise
+    /// return false. Note that this function may be called by any thread.
+    bool check();
+
+    /// Load into the specified 'result' the array of statistics for this
+    /// object. Check the observed thread for stalls before collecting the
+    /// statistics.
+    void getStats(bdld::ManagedDatum* result) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the prefix corresponding to the field at the specified
+    /// 'ordinal' position, or 0 if no field at the 'ordinal' position
+    /// exists.
+    const char* getFieldPrefix(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the field name corresponding to the field at the specified
+    /// 'ordinal' position, or 0 if no field at the 'ordinal' position
+    /// exists.
+    const char* getFieldName(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the field description corresponding to the field at the
+    /// specified 'ordinal' position, or 0 if no field at the 'ordinal'
+    /// position exists.
+    const char* getFieldDescription(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the type of the statistic at the specified 'ordinal'
+    /// position, or e_AVERAGE if no field at the 'ordinal' position exists
+    /// or the type is unknown.
+    ntci::Monitorable::StatisticType getFieldType(int ordinal) const
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the flags that indicate which indexes to apply to the
+    /// statistics measured by this monitorable object.
+    int getFieldTags(int ordinal) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the ordinal of the specified 'fieldName', or a negative value
+    /// if no field identified by 'fieldName' exists.
+    int getFieldOrdinal(const char* fieldName) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the maximum number of elements in a datum resulting from
+    /// a call to 'getStats()'.
+    int numOrdinals() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the human-readable name of the monitorable object, or 0 or
+    /// the empty string if no such human-readable name has been assigned to
+    /// the monitorable object.
+    const char* objectName() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the duration after which a callback or cycle is considered
+    /// to stall the observed thread.
+    bsls::TimeInterval threshold() const;
+
+    /// Return the number of callbacks reported to have stalled the observed
+    /// thread during the lifetime of this object.
+    bsl::uint64_t numStalledCallbacks() const;
+
+    /// Return the number of cycles of the wait loop reported to have
+    /// stalled the observed thread during the lifetime of this object.
+    bsl::uint64_t numStalledCycles() const;
+
+    /// Set the specified 'watchdog' as the watchdog to use by this thread.
+    /// Return the previous watchdog used by this thread, if any.
+    static ntcs::Watchdog* setThreadLocal(ntcs::Watchdog* watchdog);
+
+    /// Return the watchdog to use by the current thread, if any.
+    static ntcs::Watchdog* getThreadLocal();
+};
+
+/// @internal @brief
+/// Provide a guard to install and uninstall a watchdog into thread-local
+/// storage.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntcs
+class WatchdogGuard
+{
+    ntcs::Watchdog* d_current_p;
+    ntcs::Watchdog* d_previous_p;
+
+  private:
+    WatchdogGuard(const WatchdogGuard&) BSLS_KEYWORD_DELETED;
+    WatchdogGuard& operator=(const WatchdogGuard&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new watchdog guard that installs the specified 'watchdog'
+    /// into thread local storage and uninstalls it when this object is
+    /// destroyed.
+    explicit WatchdogGuard(ntcs::Watchdog* watchdog);
+
+    /// Uninstall the underlying watchdog from thread local storage then
+    /// destroy this object.
+    ~WatchdogGuard();
+};
+
+/// @internal @brief
+/// Provide a guard to measure the duration of a callback by the watchdog
+/// installed for the current thread, if any.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntcs
+class WatchdogScope
+{
+    ntcs::Watchdog* d_watchdog_p;
+
+  private:
+    WatchdogScope(const WatchdogScope&) BSLS_KEYWORD_DELETED;
+    WatchdogScope& operator=(const WatchdogScope&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new watchdog scope that marks the beginning of the
+    /// specified 'activity' performed for the optionally specified 'socket'
+    /// identified by the optionally specified 'handle' to the watchdog
+    /// installed for the current thread, if any.
+    explicit WatchdogScope(
+        const char*             activity,
+        ntsa::Handle            handle = ntsa::k_INVALID_HANDLE,
+        const ntsi::Descriptor* socket = 0);
+
+    /// Mark the end of the activity then destroy this object.
+    ~WatchdogScope();
+};
+
+NTCCFG_INLINE
+WatchdogGuard::WatchdogGuard(ntcs::Watchdog* watchdog)
+: d_current_p(watchdog)
+, d_previous_p(0)
+{
+    if (d_current_p) {
+        d_previous_p = ntcs::Watchdog::setThreadLocal(d_current_p);
+    }
+}
+
+NTCCFG_INLINE
+WatchdogGuard::~WatchdogGuard()
+{
+    if (d_current_p) {
+        ntcs::Watchdog::setThreadLocal(d_previous_p);
+    }
+}
+
+NTCCFG_INLINE
+WatchdogScope::WatchdogScope(const char*             activity,
+                             ntsa::Handle            handle,
+                             const ntsi::Descriptor* socket)
+: d_watchdog_p(ntcs::Watchdog::getThreadLocal())
+{
+    if (NTCCFG_UNLIKELY(d_watchdog_p)) {
+        d_watchdog_p->enter(activity, handle, socket);
+    }
+}
+
+NTCCFG_INLINE
+WatchdogScope::~WatchdogScope()
+{
+    if (NTCCFG_UNLIKELY(d_watchdog_p)) {
+        d_watchdog_p->leave();
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
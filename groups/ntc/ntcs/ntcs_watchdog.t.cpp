@@ -0,0 +1,225 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcs_watchdog.h>
+
+#include <ntccfg_test.h>
+#include <ntci_log.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslmt_threadutil.h>
+#include <bsls_assert.h>
+#include <bsls_timeinterval.h>
+
+using namespace BloombergLP;
+
+namespace test {
+
+/// Provide a descriptor for use by this test driver.
+class Descriptor : public ntsi::Descriptor
+{
+    ntsa::Handle d_handle;
+
+  private:
+    Descriptor(const Descriptor&) BSLS_KEYWORD_DELETED;
+    Descriptor& operator=(const Descriptor&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new descriptor identified by the specified 'handle'.
+    explicit Descriptor(ntsa::Handle handle);
+
+    /// Destroy this object.
+    ~Descriptor() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the handle.
+    ntsa::Handle handle() const BSLS_KEYWORD_OVERRIDE;
+};
+
+Descriptor::Descriptor(ntsa::Handle handle)
+: d_handle(handle)
+{
+}
+
+Descriptor::~Descriptor()
+{
+}
+
+ntsa::Handle Descriptor::handle() const
+{
+    return d_handle;
+}
+
+}  // close namespace test
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+//
+//-----------------------------------------------------------------------------
+
+// [ 1]
+//-----------------------------------------------------------------------------
+// [ 1]
+// [ 2]
+// [ 3]
+//-----------------------------------------------------------------------------
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Callbacks and cycles exceeding the threshold are reported.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        bsl::shared_ptr<ntcs::Watchdog> watchdog;
+        watchdog.createInplace(&ta,
+                               "watchdog",
+                               "test",
+                               bsls::TimeInterval(0, 10 * 1000 * 1000),
+                               &ta);
+
+        NTCCFG_TEST_TRUE(ntcs::Watchdog::getThreadLocal() == 0);
+
+        {
+            ntcs::WatchdogGuard watchdogGuard(watchdog.get());
+
+            NTCCFG_TEST_TRUE(ntcs::Watchdog::getThreadLocal() ==
+                             watchdog.get());
+
+            {
+                ntcs::WatchdogScope watchdogScope("fast");
+            }
+
+            watchdog->cycle();
+
+            NTCCFG_TEST_EQ(watchdog->numStalledCallbacks(), 0);
+            NTCCFG_TEST_EQ(watchdog->numStalledCycles(), 0);
+
+            {
+                ntcs::WatchdogScope watchdogScope("slow");
+                bslmt::ThreadUtil::sleep(bsls::TimeInterval(0.05));
+            }
+
+            NTCCFG_TEST_EQ(watchdog->numStalledCallbacks(), 1);
+            NTCCFG_TEST_EQ(watchdog->numStalledCycles(), 0);
+
+            watchdog->cycle();
+
+            NTCCFG_TEST_EQ(watchdog->numStalledCallbacks(), 1);
+            NTCCFG_TEST_EQ(watchdog->numStalledCycles(), 1);
+        }
+
+        NTCCFG_TEST_TRUE(ntcs::Watchdog::getThreadLocal() == 0);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: A callback still in progress is reported as stalled exactly
+    // once, whether detected by 'check()' or upon completion: a callback
+    // reported by 'check()' is not reported again when it completes.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        bsl::shared_ptr<ntcs::Watchdog> watchdog;
+        watchdog.createInplace(&ta,
+                               "watchdog",
+                               "test",
+                               bsls::TimeInterval(0, 10 * 1000 * 1000),
+                               &ta);
+
+        ntcs::WatchdogGuard watchdogGuard(watchdog.get());
+
+        NTCCFG_TEST_FALSE(watchdog->check());
+
+        {
+            ntcs::WatchdogScope watchdogScope("outer", 42);
+
+            {
+                ntcs::WatchdogScope nestedScope("inner");
+            }
+
+            NTCCFG_TEST_FALSE(watchdog->check());
+
+            bslmt::ThreadUtil::sleep(bsls::TimeInterval(0.05));
+
+            NTCCFG_TEST_TRUE(watchdog->check());
+            NTCCFG_TEST_TRUE(watchdog->check());
+
+            NTCCFG_TEST_EQ(watchdog->numStalledCallbacks(), 1);
+        }
+
+        NTCCFG_TEST_FALSE(watchdog->check());
+
+        NTCCFG_TEST_EQ(watchdog->numStalledCallbacks(), 1);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(3)
+{
+    // Concern: A callback is attributed to the socket and handle passed to
+    // its scope and to the owner of the log context, and unknown field
+    // names have a negative ordinal.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        bsl::shared_ptr<ntcs::Watchdog> watchdog;
+        watchdog.createInplace(&ta,
+                               "watchdog",
+                               "test",
+                               bsls::TimeInterval(0, 10 * 1000 * 1000),
+                               &ta);
+
+        NTCCFG_TEST_EQ(watchdog->getFieldOrdinal("timeProcessingCallback"),
+                       0);
+        NTCCFG_TEST_EQ(watchdog->getFieldOrdinal("cyclesStalled"), 3);
+        NTCCFG_TEST_LT(watchdog->getFieldOrdinal("unknown"), 0);
+
+        ntcs::WatchdogGuard watchdogGuard(watchdog.get());
+
+        test::Descriptor descriptor(42);
+
+        {
+            NTCI_LOG_CONTEXT();
+            NTCI_LOG_CONTEXT_GUARD_OWNER("socket-owner");
+
+            ntcs::WatchdogScope watchdogScope("attributed",
+                                              descriptor.handle(),
+                                              &descriptor);
+
+            bslmt::ThreadUtil::sleep(bsls::TimeInterval(0.05));
+
+            NTCCFG_TEST_TRUE(watchdog->check());
+        }
+
+        NTCCFG_TEST_EQ(watchdog->numStalledCallbacks(), 1);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+    NTCCFG_TEST_REGISTER(3);
+}
+NTCCFG_TEST_DRIVER_END;
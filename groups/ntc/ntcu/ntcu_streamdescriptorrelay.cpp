@@ -0,0 +1,641 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcu_streamdescriptorrelay.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcu_streamdescriptorrelay_cpp, "$Id$ $CSID$")
+
+#include <ntca_reactoreventoptions.h>
+#include <ntccfg_bind.h>
+#include <ntccfg_tune.h>
+#include <ntci_datapool.h>
+#include <ntcs_blobbufferutil.h>
+#include <ntsa_receivecontext.h>
+#include <ntsa_receiveoptions.h>
+#include <ntsa_sendcontext.h>
+#include <ntsa_sendoptions.h>
+#include <ntsa_shutdowntype.h>
+#include <ntsu_socketoptionutil.h>
+#include <ntsu_socketutil.h>
+#include <bdlbb_blobutil.h>
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace ntcu {
+
+StreamDescriptorRelay::Direction::Direction()
+: d_source(ntsa::k_INVALID_HANDLE)
+, d_destination(ntsa::k_INVALID_HANDLE)
+, d_pipeReader(ntsa::k_INVALID_HANDLE)
+, d_pipeWriter(ntsa::k_INVALID_HANDLE)
+, d_numBytesInPipe(0)
+, d_pending_sp()
+, d_numBytesForwarded(0)
+, d_readable(false)
+, d_writable(false)
+, d_shutdown(false)
+, d_complete(false)
+{
+}
+
+StreamDescriptorRelay::Direction* StreamDescriptorRelay::privateSource(
+    ntsa::Handle handle)
+{
+    if (!d_started || d_complete) {
+        return 0;
+    }
+
+    if (handle == d_forward.d_source) {
+        return &d_forward;
+    }
+    else if (handle == d_backward.d_source) {
+        return &d_backward;
+    }
+
+    return 0;
+}
+
+StreamDescriptorRelay::Direction* StreamDescriptorRelay::privateDestination(
+    ntsa::Handle handle)
+{
+    if (!d_started || d_complete) {
+        return 0;
+    }
+
+    if (handle == d_forward.d_destination) {
+        return &d_forward;
+    }
+    else if (handle == d_backward.d_destination) {
+        return &d_backward;
+    }
+
+    return 0;
+}
+
+void StreamDescriptorRelay::privateForward(Direction* direction)
+{
+    ntsa::Error error;
+
+    while (!d_complete && !direction->d_complete) {
+        error = this->privateSend(direction);
+        if (error) {
+            if (error == ntsa::Error::e_WOULD_BLOCK) {
+                this->privateMonitor(direction, false, true);
+            }
+            else {
+                this->privateFail(error);
+            }
+            return;
+        }
+
+        if (direction->d_shutdown) {
+            direction->d_complete = true;
+
+            this->privateMonitor(direction, false, false);
+
+            error = ntsu::SocketUtil::shutdown(ntsa::ShutdownType::e_SEND,
+                                               direction->d_destination);
+            if (error) {
+                this->privateFail(error);
+            }
+            else if (d_forward.d_complete && d_backward.d_complete) {
+                d_complete = true;
+            }
+            return;
+        }
+
+        error = this->privateReceive(direction);
+        if (error) {
+            if (error == ntsa::Error::e_EOF) {
+                direction->d_shutdown = true;
+            }
+            else if (error == ntsa::Error::e_WOULD_BLOCK) {
+                this->privateMonitor(direction, true, false);
+                return;
+            }
+            else {
+                this->privateFail(error);
+                return;
+            }
+        }
+    }
+}
+
+ntsa::Error StreamDescriptorRelay::privateSend(Direction* direction)
+{
+    ntsa::Error error;
+
+    if (direction->d_pipeReader != ntsa::k_INVALID_HANDLE) {
+        while (direction->d_numBytesInPipe > 0) {
+            bsl::size_t numBytesSpliced = 0;
+            error = ntsu::SocketUtil::splice(&numBytesSpliced,
+                                             direction->d_pipeReader,
+                                             direction->d_destination,
+                                             direction->d_numBytesInPipe);
+            if (error) {
+                return error;
+            }
+
+            direction->d_numBytesInPipe    -= numBytesSpliced;
+            direction->d_numBytesForwarded += numBytesSpliced;
+        }
+    }
+    else {
+        while (direction->d_pending_sp->length() > 0) {
+            ntsa::SendContext sendContext;
+            error = ntsu::SocketUtil::send(&sendContext,
+                                           *direction->d_pending_sp,
+                                           ntsa::SendOptions(),
+                                           direction->d_destination);
+            if (error) {
+                return error;
+            }
+
+            bdlbb::BlobUtil::erase(direction->d_pending_sp.get(),
+                                   0,
+                                   static_cast<int>(sendContext.bytesSent()));
+
+            direction->d_numBytesForwarded += sendContext.bytesSent();
+        }
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error StreamDescriptorRelay::privateReceive(Direction* direction)
+{
+    ntsa::Error error;
+
+    if (direction->d_pipeWriter != ntsa::k_INVALID_HANDLE) {
+        bsl::size_t numBytesSpliced = 0;
+        error = ntsu::SocketUtil::splice(&numBytesSpliced,
+                                         direction->d_source,
+                                         direction->d_pipeWriter,
+                                         k_MAX_BYTES_PER_TRANSFER);
+        if (!error) {
+            direction->d_numBytesInPipe += numBytesSpliced;
+            return ntsa::Error();
+        }
+
+        // The kernel rejects splicing from sources that do not support it;
+        // if nothing has yet been spliced, receive through a blob instead.
+
+        if ((error != ntsa::Error::e_INVALID &&
+             error != ntsa::Error::e_NOT_IMPLEMENTED) ||
+            direction->d_numBytesForwarded != 0)
+        {
+            return error;
+        }
+
+        this->privateFallback(direction);
+    }
+
+    ntcs::BlobBufferUtil::reserveCapacity(
+        direction->d_pending_sp.get(),
+        d_reactor_sp->dataPool()->incomingBlobBufferFactory().get(),
+        0,
+        1,
+        k_MAX_BYTES_PER_TRANSFER,
+        k_MAX_BYTES_PER_TRANSFER);
+
+    ntsa::ReceiveContext receiveContext;
+    error = ntsu::SocketUtil::receive(&receiveContext,
+                                      direction->d_pending_sp.get(),
+                                      ntsa::ReceiveOptions(),
+                                      direction->d_source);
+    if (error) {
+        return error;
+    }
+
+    if (receiveContext.bytesReceived() == 0) {
+        return ntsa::Error(ntsa::Error::e_EOF);
+    }
+
+    return ntsa::Error();
+}
+
+void StreamDescriptorRelay::privateFallback(Direction* direction)
+{
+    BSLS_ASSERT(direction->d_numBytesInPipe == 0);
+
+    StreamDescriptorRelay::privateClose(&direction->d_pipeReader);
+    StreamDescriptorRelay::privateClose(&direction->d_pipeWriter);
+
+    if (!direction->d_pending_sp) {
+        direction->d_pending_sp =
+            d_reactor_sp->dataPool()->createIncomingBlob();
+    }
+}
+
+void StreamDescriptorRelay::privateMonitor(Direction* direction,
+                                           bool       readable,
+                                           bool       writable)
+{
+    ntsa::Error error;
+
+    bsl::shared_ptr<StreamDescriptorRelay> self = this->getSelf(this);
+
+    if (direction->d_readable != readable) {
+        direction->d_readable = readable;
+        if (readable) {
+            error = d_reactor_sp->showReadable(
+                direction->d_source,
+                ntca::ReactorEventOptions(),
+                ntci::ReactorEventCallback(
+                    NTCCFG_BIND(&StreamDescriptorRelay::processReadable,
+                                self,
+                                NTCCFG_BIND_PLACEHOLDER_1),
+                    d_allocator_p));
+        }
+        else {
+            error = d_reactor_sp->hideReadable(direction->d_source);
+        }
+
+        if (error) {
+            this->privateFail(error);
+            return;
+        }
+    }
+
+    if (direction->d_writable != writable) {
+        direction->d_writable = writable;
+        if (writable) {
+            error = d_reactor_sp->showWritable(
+                direction->d_destination,
+                ntca::ReactorEventOptions(),
+                ntci::ReactorEventCallback(
+                    NTCCFG_BIND(&StreamDescriptorRelay::processWritable,
+                                self,
+                                NTCCFG_BIND_PLACEHOLDER_1),
+                    d_allocator_p));
+        }
+        else {
+            error = d_reactor_sp->hideWritable(direction->d_destination);
+        }
+
+        if (error) {
+            this->privateFail(error);
+            return;
+        }
+    }
+}
+
+void StreamDescriptorRelay::privateFail(const ntsa::Error& error)
+{
+    if (d_complete) {
+        return;
+    }
+
+    d_error    = error;
+    d_complete = true;
+}
+
+bool StreamDescriptorRelay::privateDetachPending()
+{
+    if (!d_complete || d_detaching) {
+        return false;
+    }
+
+    d_detaching = true;
+    return true;
+}
+
+void StreamDescriptorRelay::privateClose(ntsa::Handle* handle)
+{
+    if (*handle != ntsa::k_INVALID_HANDLE) {
+        ntsu::SocketUtil::close(*handle);
+        *handle = ntsa::k_INVALID_HANDLE;
+    }
+}
+
+void StreamDescriptorRelay::detach()
+{
+    bsl::shared_ptr<StreamDescriptorRelay> self = this->getSelf(this);
+
+    ntsa::Handle first;
+    ntsa::Handle second;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        first  = d_forward.d_source;
+        second = d_backward.d_source;
+    }
+
+    ntci::SocketDetachedCallback callback(
+        NTCCFG_BIND(&StreamDescriptorRelay::processDetached, self),
+        d_allocator_p);
+
+    // Detaching a handle removes all interest in it. A handle the reactor
+    // has already detached, or cannot detach, is considered detached.
+
+    ntsa::Error error = d_reactor_sp->detachSocket(first, callback);
+    if (error) {
+        this->processDetached();
+    }
+
+    error = d_reactor_sp->detachSocket(second, callback);
+    if (error) {
+        this->processDetached();
+    }
+}
+
+void StreamDescriptorRelay::processReadable(const ntca::ReactorEvent& event)
+{
+    bool detach = false;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        Direction* direction = this->privateSource(event.handle());
+        if (direction) {
+            if (d_reactor_sp->oneShot()) {
+                direction->d_readable = false;
+            }
+
+            this->privateForward(direction);
+        }
+
+        detach = this->privateDetachPending();
+    }
+
+    if (detach) {
+        this->detach();
+    }
+}
+
+void StreamDescriptorRelay::processWritable(const ntca::ReactorEvent& event)
+{
+    bool detach = false;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        Direction* direction = this->privateDestination(event.handle());
+        if (direction) {
+            if (d_reactor_sp->oneShot()) {
+                direction->d_writable = false;
+            }
+
+            this->privateForward(direction);
+        }
+
+        detach = this->privateDetachPending();
+    }
+
+    if (detach) {
+        this->detach();
+    }
+}
+
+void StreamDescriptorRelay::processError(const ntca::ReactorEvent& event)
+{
+    bool detach = false;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        Direction* direction = this->privateSource(event.handle());
+        if (direction) {
+            ntsa::Error error = event.error();
+            if (!error) {
+                error = ntsa::Error(ntsa::Error::e_CONNECTION_DEAD);
+            }
+
+            this->privateFail(error);
+        }
+
+        detach = this->privateDetachPending();
+    }
+
+    if (detach) {
+        this->detach();
+    }
+}
+
+void StreamDescriptorRelay::processDetached()
+{
+    ntsa::Error error;
+    Callback    callback(bsl::allocator_arg, d_allocator_p);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        BSLS_ASSERT(d_numAttached > 0);
+
+        --d_numAttached;
+        if (d_numAttached != 0) {
+            return;
+        }
+
+        StreamDescriptorRelay::privateClose(&d_forward.d_pipeReader);
+        StreamDescriptorRelay::privateClose(&d_forward.d_pipeWriter);
+        StreamDescriptorRelay::privateClose(&d_backward.d_pipeReader);
+        StreamDescriptorRelay::privateClose(&d_backward.d_pipeWriter);
+
+        StreamDescriptorRelay::privateClose(&d_forward.d_source);
+        StreamDescriptorRelay::privateClose(&d_backward.d_source);
+
+        d_forward.d_destination  = ntsa::k_INVALID_HANDLE;
+        d_backward.d_destination = ntsa::k_INVALID_HANDLE;
+
+        d_forward.d_numBytesInPipe  = 0;
+        d_backward.d_numBytesInPipe = 0;
+
+        d_forward.d_pending_sp.reset();
+        d_backward.d_pending_sp.reset();
+
+        callback.swap(d_callback);
+        error = d_error;
+    }
+
+    if (callback) {
+        callback(error);
+    }
+}
+
+StreamDescriptorRelay::StreamDescriptorRelay(
+    const bsl::shared_ptr<ntci::Reactor>& reactor,
+    ntsa::Handle                          first,
+    ntsa::Handle                          second,
+    bslma::Allocator*                     basicAllocator)
+: d_mutex()
+, d_reactor_sp(reactor)
+, d_forward()
+, d_backward()
+, d_numAttached(0)
+, d_error()
+, d_started(false)
+, d_complete(false)
+, d_detaching(false)
+, d_callback(bsl::allocator_arg, basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(first != ntsa::k_INVALID_HANDLE);
+    BSLS_ASSERT(second != ntsa::k_INVALID_HANDLE);
+    BSLS_ASSERT(first != second);
+
+    d_forward.d_source      = first;
+    d_forward.d_destination = second;
+
+    d_backward.d_source      = second;
+    d_backward.d_destination = first;
+}
+
+StreamDescriptorRelay::~StreamDescriptorRelay()
+{
+    StreamDescriptorRelay::privateClose(&d_forward.d_pipeReader);
+    StreamDescriptorRelay::privateClose(&d_forward.d_pipeWriter);
+    StreamDescriptorRelay::privateClose(&d_backward.d_pipeReader);
+    StreamDescriptorRelay::privateClose(&d_backward.d_pipeWriter);
+
+    StreamDescriptorRelay::privateClose(&d_forward.d_source);
+    StreamDescriptorRelay::privateClose(&d_backward.d_source);
+}
+
+ntsa::Error StreamDescriptorRelay::start(const Callback& callback)
+{
+    bsl::shared_ptr<StreamDescriptorRelay> self = this->getSelf(this);
+
+    bool detach = false;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        ntsa::Error error;
+
+        if (d_started) {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+
+        error =
+            ntsu::SocketOptionUtil::setBlocking(d_forward.d_source, false);
+        if (error) {
+            return error;
+        }
+
+        error =
+            ntsu::SocketOptionUtil::setBlocking(d_backward.d_source, false);
+        if (error) {
+            return error;
+        }
+
+        if (!d_reactor_sp->autoAttach()) {
+            error = d_reactor_sp->attachSocket(d_forward.d_source);
+            if (error) {
+                return error;
+            }
+
+            error = d_reactor_sp->attachSocket(d_backward.d_source);
+            if (error) {
+                d_reactor_sp->detachSocket(d_forward.d_source,
+                                           ntci::SocketDetachedCallback());
+                return error;
+            }
+        }
+
+        bool splice = true;
+        ntccfg::Tune::configure(&splice,
+                                "NTCU_STREAMDESCRIPTORRELAY_SPLICE",
+                                true);
+
+        Direction* directions[2] = {&d_forward, &d_backward};
+
+        for (bsl::size_t i = 0; i < 2; ++i) {
+            Direction* direction = directions[i];
+
+            if (splice) {
+                error = ntsu::SocketUtil::pipe(&direction->d_pipeReader,
+                                               &direction->d_pipeWriter);
+            }
+
+            if (!splice || error) {
+                this->privateFallback(direction);
+            }
+        }
+
+        d_numAttached = 2;
+        d_callback    = callback;
+        d_started     = true;
+
+        for (bsl::size_t i = 0; i < 2 && !d_complete; ++i) {
+            error = d_reactor_sp->showError(
+                directions[i]->d_source,
+                ntca::ReactorEventOptions(),
+                ntci::ReactorEventCallback(
+                    NTCCFG_BIND(&StreamDescriptorRelay::processError,
+                                self,
+                                NTCCFG_BIND_PLACEHOLDER_1),
+                    d_allocator_p));
+            if (error) {
+                this->privateFail(error);
+            }
+        }
+
+        this->privateForward(&d_forward);
+        this->privateForward(&d_backward);
+
+        detach = this->privateDetachPending();
+    }
+
+    if (detach) {
+        this->detach();
+    }
+
+    return ntsa::Error();
+}
+
+void StreamDescriptorRelay::stop()
+{
+    bool detach = false;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (d_started) {
+            this->privateFail(ntsa::Error(ntsa::Error::e_CANCELLED));
+        }
+
+        detach = this->privateDetachPending();
+    }
+
+    if (detach) {
+        this->detach();
+    }
+}
+
+bsl::size_t StreamDescriptorRelay::numBytesForwarded() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_forward.d_numBytesForwarded;
+}
+
+bsl::size_t StreamDescriptorRelay::numBytesReturned() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_backward.d_numBytesForwarded;
+}
+
+bool StreamDescriptorRelay::isSpliced() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_forward.d_pipeReader != ntsa::k_INVALID_HANDLE &&
+           d_backward.d_pipeReader != ntsa::k_INVALID_HANDLE;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
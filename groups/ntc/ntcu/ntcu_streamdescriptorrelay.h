@@ -0,0 +1,246 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCU_STREAMDESCRIPTORRELAY
+#define INCLUDED_NTCU_STREAMDESCRIPTORRELAY
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntca_reactorevent.h>
+#include <ntccfg_platform.h>
+#include <ntci_reactor.h>
+#include <ntci_streamsocketrelay.h>
+#include <ntcscm_version.h>
+#include <ntsa_error.h>
+#include <ntsa_handle.h>
+#include <bdlbb_blob.h>
+#include <bslmt_mutex.h>
+#include <bsls_keyword.h>
+#include <bsl_memory.h>
+
+namespace BloombergLP {
+namespace ntcu {
+
+/// @internal @brief
+/// Provide a relay of data between two stream socket handles through kernel
+/// pipes.
+///
+/// @details
+/// This class pairs two connected stream socket handles, monitored by a
+/// reactor, so that data received by each handle is sent through the other.
+/// Where supported, each direction moves data from its source into a kernel
+/// pipe, then from that pipe into its destination, using 'splice', so the
+/// forwarded bytes are never copied into user space. Where pipes or
+/// splicing are not supported, or if the environment variable
+/// 'NTCU_STREAMDESCRIPTORRELAY_SPLICE' is set to 0, each direction instead
+/// receives into a blob whose buffers are supplied by the data pool of the
+/// reactor, and sends from that same blob.
+///
+/// Each direction is subject to backpressure from its destination. While
+/// the destination cannot accept more data, the relay stops reading from
+/// the source, so at most one pipe, or one blob, of data is held for each
+/// direction, and the kernel applies flow control to the peer of the
+/// source.
+///
+/// The relay operates on handles rather than on 'ntci::StreamSocket'
+/// objects because a stream socket owns the read and write queues through
+/// which its data passes, and may encrypt, rate limit, or timestamp that
+/// data, none of which can be applied to bytes that never leave the kernel.
+/// Use this class to proxy unencrypted connections accepted or connected
+/// directly on a reactor, and 'ntcu::StreamSocketRelay' to relay data
+/// between two stream sockets.
+///
+/// When the peer of one handle shuts down its side of the connection, the
+/// relay shuts down the other handle for sending, after all data received
+/// before the shutdown has been forwarded. When both directions are shut
+/// down, or if either handle encounters an error, both handles are detached
+/// from the reactor and closed, and the callback is invoked.
+///
+/// Note that splicing data into a socket whose peer has closed the
+/// connection raises 'SIGPIPE'; applications relaying through kernel pipes
+/// should ignore that signal, for example by calling
+/// 'ntcf::System::ignore(ntscfg::Signal::e_PIPE)'.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntcu
+class StreamDescriptorRelay : public ntci::StreamSocketRelay,
+                              public ntccfg::Shared<StreamDescriptorRelay>
+{
+    /// Describe the forwarding of data in one direction.
+    struct Direction {
+        /// Create a new direction.
+        Direction();
+
+        ntsa::Handle                 d_source;
+        ntsa::Handle                 d_destination;
+        ntsa::Handle                 d_pipeReader;
+        ntsa::Handle                 d_pipeWriter;
+        bsl::size_t                  d_numBytesInPipe;
+        bsl::shared_ptr<bdlbb::Blob> d_pending_sp;
+        bsl::size_t                  d_numBytesForwarded;
+        bool                         d_readable;
+        bool                         d_writable;
+        bool                         d_shutdown;
+        bool                         d_complete;
+    };
+
+    enum {
+        /// The maximum number of bytes moved into the pipe, or received
+        /// into the blob, of a direction at a time.
+        k_MAX_BYTES_PER_TRANSFER = 65536
+    };
+
+    mutable bslmt::Mutex           d_mutex;
+    bsl::shared_ptr<ntci::Reactor> d_reactor_sp;
+    Direction                      d_forward;
+    Direction                      d_backward;
+    bsl::size_t                    d_numAttached;
+    ntsa::Error                    d_error;
+    bool                           d_started;
+    bool                           d_complete;
+    bool                           d_detaching;
+    Callback                       d_callback;
+    bslma::Allocator*              d_allocator_p;
+
+  private:
+    StreamDescriptorRelay(const StreamDescriptorRelay&) BSLS_KEYWORD_DELETED;
+    StreamDescriptorRelay& operator=(const StreamDescriptorRelay&)
+        BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Return the direction whose source is the specified 'handle', or null
+    /// if the relay is not in progress. The behavior is undefined unless
+    /// 'd_mutex' is locked.
+    Direction* privateSource(ntsa::Handle handle);
+
+    /// Return the direction whose destination is the specified 'handle', or
+    /// null if the relay is not in progress. The behavior is undefined
+    /// unless 'd_mutex' is locked.
+    Direction* privateDestination(ntsa::Handle handle);
+
+    /// Send all data held for the specified 'direction' to its destination,
+    /// then move all data available from its source to its destination,
+    /// until either no more data is available, the destination cannot
+    /// accept more data, or the source is shut down. The behavior is
+    /// undefined unless 'd_mutex' is locked.
+    void privateForward(Direction* direction);
+
+    /// Send the data held for the specified 'direction' to its destination.
+    /// Return the error, notably 'ntsa::Error::e_WOULD_BLOCK' if the
+    /// destination cannot accept all of that data. The behavior is
+    /// undefined unless 'd_mutex' is locked.
+    ntsa::Error privateSend(Direction* direction);
+
+    /// Hold the data available from the source of the specified 'direction'
+    /// for sending to its destination. Return the error, notably
+    /// 'ntsa::Error::e_WOULD_BLOCK' if no data is available and
+    /// 'ntsa::Error::e_EOF' if the source is shut down. The behavior is
+    /// undefined unless 'd_mutex' is locked and no data is held for
+    /// 'direction'.
+    ntsa::Error privateReceive(Direction* direction);
+
+    /// Close the pipe of the specified 'direction', if any, and hold the
+    /// data of 'direction' in a blob instead. The behavior is undefined
+    /// unless 'd_mutex' is locked.
+    void privateFallback(Direction* direction);
+
+    /// Monitor the source of the specified 'direction' for readability if
+    /// the specified 'readable' flag is true, and its destination for
+    /// writability if the specified 'writable' flag is true, and stop
+    /// monitoring each otherwise. The behavior is undefined unless
+    /// 'd_mutex' is locked.
+    void privateMonitor(Direction* direction, bool readable, bool writable);
+
+    /// Fail the relay with the specified 'error': record the error and stop
+    /// forwarding in both directions. The behavior is undefined unless
+    /// 'd_mutex' is locked.
+    void privateFail(const ntsa::Error& error);
+
+    /// Return true if the relay is complete but the detachment of its
+    /// handles from the reactor has not yet been initiated, and mark that
+    /// detachment initiated, otherwise return false. The behavior is
+    /// undefined unless 'd_mutex' is locked.
+    bool privateDetachPending();
+
+    /// Close the specified 'handle', if valid, and set it invalid. The
+    /// behavior is undefined unless 'd_mutex' is locked.
+    static void privateClose(ntsa::Handle* handle);
+
+    /// Detach both handles from the reactor. The behavior is undefined
+    /// unless 'd_mutex' is unlocked.
+    void detach();
+
+    /// Process the specified reactor 'event' indicating the source of a
+    /// direction is readable.
+    void processReadable(const ntca::ReactorEvent& event);
+
+    /// Process the specified reactor 'event' indicating the destination of
+    /// a direction is writable.
+    void processWritable(const ntca::ReactorEvent& event);
+
+    /// Process the specified reactor 'event' indicating a handle has
+    /// encountered an error.
+    void processError(const ntca::ReactorEvent& event);
+
+    /// Process the detachment of a handle from the reactor. When both
+    /// handles are detached, close them and invoke the callback.
+    void processDetached();
+
+  public:
+    /// Create a new relay between the specified 'first' and 'second' stream
+    /// socket handles monitored by the specified 'reactor'. Optionally
+    /// specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used. The relay takes ownership of 'first' and 'second' and closes
+    /// them when it completes or is destroyed. The behavior is undefined
+    /// unless 'first' and 'second' are connected, distinct, and not
+    /// attached to 'reactor'.
+    StreamDescriptorRelay(const bsl::shared_ptr<ntci::Reactor>& reactor,
+                          ntsa::Handle                          first,
+                          ntsa::Handle                          second,
+                          bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~StreamDescriptorRelay() BSLS_KEYWORD_OVERRIDE;
+
+    /// Attach both handles to the reactor and begin forwarding data between
+    /// them. Invoke the specified 'callback' when the relay completes.
+    /// Return the error.
+    ntsa::Error start(const Callback& callback) BSLS_KEYWORD_OVERRIDE;
+
+    /// Stop the relay, if it is in progress. The callback is invoked with
+    /// the error 'ntsa::Error::e_CANCELLED' once both handles are detached
+    /// from the reactor and closed.
+    void stop() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the number of bytes forwarded from the first handle to the
+    /// second handle.
+    bsl::size_t numBytesForwarded() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the number of bytes forwarded from the second handle to the
+    /// first handle.
+    bsl::size_t numBytesReturned() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return true if data is moved between the handles through kernel
+    /// pipes, otherwise return false.
+    bool isSpliced() const;
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
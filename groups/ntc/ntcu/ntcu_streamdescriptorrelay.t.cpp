@@ -0,0 +1,1602 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcu_streamdescriptorrelay.h>
+
+#include <ntccfg_test.h>
+#include <ntca_reactorevent.h>
+#include <ntca_reactoreventoptions.h>
+#include <ntca_reactoreventtrigger.h>
+#include <ntca_reactoreventtype.h>
+#include <ntci_reactor.h>
+#include <ntci_streamsocketrelay.h>
+#include <ntcs_datapool.h>
+#include <ntsa_error.h>
+#include <ntsa_handle.h>
+#include <ntsa_receivecontext.h>
+#include <ntsa_receiveoptions.h>
+#include <ntsa_sendcontext.h>
+#include <ntsa_sendoptions.h>
+#include <ntsa_shutdowntype.h>
+#include <ntsa_transport.h>
+#include <ntscfg_platform.h>
+#include <ntsu_socketoptionutil.h>
+#include <ntsu_socketutil.h>
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+#include <bdlt_currenttime.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bsls_platform.h>
+#include <bsls_timeinterval.h>
+#include <bsl_cstdlib.h>
+#include <bsl_map.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The relay is tested between two pairs of connected TCP sockets: one
+// socket of each pair is relayed, and the other is played by the test as
+// the remote peer. The reactor is mocked: the test dispatches it to invoke
+// the callback of each event of interest, each polled from the kernel
+// without blocking. Each case is run both with and without splicing
+// through kernel pipes.
+//-----------------------------------------------------------------------------
+
+// [ 1]
+//-----------------------------------------------------------------------------
+// [ 1] Forwarding in both directions
+// [ 2] Backpressure from the destination
+// [ 3] Half-close on shutdown
+// [ 4] Stop
+// [ 5] Error
+//-----------------------------------------------------------------------------
+
+namespace test {
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+/// True if splicing through kernel pipes is supported on this platform.
+const bool k_SPLICE_SUPPORTED = true;
+#else
+/// True if splicing through kernel pipes is supported on this platform.
+const bool k_SPLICE_SUPPORTED = false;
+#endif
+
+/// The maximum number of rounds of sending and dispatching to reach a
+/// condition.
+const bsl::size_t k_MAX_ROUNDS = 10000;
+
+/// The maximum duration, in seconds, to wait for data from a peer.
+const int k_TIMEOUT = 10;
+
+/// This class mocks the ntci::Reactor interface for socket handles. The
+/// test dispatches the reactor to invoke the callback of each socket
+/// detachment initiated since the previous dispatch, and of each event of
+/// interest that has occurred, polling the kernel without blocking to
+/// determine whether a socket is readable or writable. Errors are injected
+/// by the test. Sockets must be attached before interest in them is shown.
+class Reactor : public ntci::Reactor, public ntccfg::Shared<Reactor>
+{
+    /// Describe the interest in an attached socket.
+    struct Entry {
+        /// Create a new entry having no interest. Optionally specify a
+        /// 'basicAllocator' used to supply memory. If 'basicAllocator' is
+        /// 0, the currently installed default allocator is used.
+        explicit Entry(bslma::Allocator* basicAllocator = 0);
+
+        ntci::ReactorEventCallback d_readableCallback;
+        ntci::ReactorEventCallback d_writableCallback;
+        ntci::ReactorEventCallback d_errorCallback;
+        ntsa::Error                d_error;
+    };
+
+    /// Define a type alias for a map of attached sockets to the interest
+    /// in them.
+    typedef bsl::map<ntsa::Handle, bsl::shared_ptr<Entry> > EntryMap;
+
+    /// Define a type alias for a queue of detachments to announce.
+    typedef bsl::vector<ntci::SocketDetachedCallback> DetachQueue;
+
+    EntryMap                        d_entryMap;
+    DetachQueue                     d_detachQueue;
+    bsl::size_t                     d_numDetached;
+    bool                            d_oneShot;
+    bsl::shared_ptr<ntci::DataPool> d_dataPool_sp;
+    bsl::shared_ptr<ntci::Strand>   d_strand_sp;
+    bslma::Allocator*               d_allocator_p;
+
+  private:
+    Reactor(const Reactor&) BSLS_KEYWORD_DELETED;
+    Reactor& operator=(const Reactor&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Invoke the callback of the interest in the specified 'type' of event
+    /// for the specified 'handle', if that interest is shown and such an
+    /// event has occurred, consuming the interest if the reactor is
+    /// one-shot. Return true if the callback is invoked, otherwise return
+    /// false.
+    bool announce(ntsa::Handle handle, ntca::ReactorEventType::Value type);
+
+  public:
+    /// Create a new reactor that consumes the interest in each event when
+    /// that event is announced if the specified 'oneShot' flag is true.
+    /// Optionally specify a 'basicAllocator' used to supply memory. If
+    /// 'basicAllocator' is 0, the currently installed default allocator is
+    /// used.
+    explicit Reactor(bool oneShot, bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~Reactor() BSLS_KEYWORD_OVERRIDE;
+
+    /// Invoke the callback of each socket detachment initiated since the
+    /// previous dispatch, then the callback of each event of interest that
+    /// has occurred. Return the number of callbacks invoked.
+    bsl::size_t dispatch();
+
+    /// Announce the specified 'error' for the specified socket 'handle' at
+    /// the next dispatch, if interest in errors is shown.
+    void injectError(ntsa::Handle handle, const ntsa::Error& error);
+
+    /// Return true if the specified socket 'handle' is attached, otherwise
+    /// return false.
+    bool isAttached(ntsa::Handle handle) const;
+
+    /// Return true if the specified socket 'handle' is monitored for
+    /// readability, otherwise return false.
+    bool isReadable(ntsa::Handle handle) const;
+
+    /// Return true if the specified socket 'handle' is monitored for
+    /// writability, otherwise return false.
+    bool isWritable(ntsa::Handle handle) const;
+
+    /// Return the number of sockets detached.
+    bsl::size_t numDetached() const;
+
+    /// Start monitoring the specified socket 'handle'. Return the error.
+    ntsa::Error attachSocket(ntsa::Handle handle) BSLS_KEYWORD_OVERRIDE;
+
+    /// Start monitoring for readability of the specified socket 'handle'
+    /// according to the specified 'options'. Invoke the specified
+    /// 'callback' when the socket becomes readable. Return the error.
+    ntsa::Error showReadable(ntsa::Handle                      handle,
+                             const ntca::ReactorEventOptions&  options,
+                             const ntci::ReactorEventCallback& callback)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Start monitoring for writability of the specified socket 'handle'
+    /// according to the specified 'options'. Invoke the specified
+    /// 'callback' when the socket becomes writable. Return the error.
+    ntsa::Error showWritable(ntsa::Handle                      handle,
+                             const ntca::ReactorEventOptions&  options,
+                             const ntci::ReactorEventCallback& callback)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Start monitoring for errors of the specified socket 'handle'. Invoke
+    /// the specified 'callback' when the socket has an error. Return the
+    /// error.
+    ntsa::Error showError(ntsa::Handle                      handle,
+                          const ntca::ReactorEventOptions&  options,
+                          const ntci::ReactorEventCallback& callback)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Stop monitoring for readability of the specified socket 'handle'.
+    /// Return the error.
+    ntsa::Error hideReadable(ntsa::Handle handle) BSLS_KEYWORD_OVERRIDE;
+
+    /// Stop monitoring for writability of the specified socket 'handle'.
+    /// Return the error.
+    ntsa::Error hideWritable(ntsa::Handle handle) BSLS_KEYWORD_OVERRIDE;
+
+    /// Stop monitoring for errors of the specified socket 'handle'. Return
+    /// the error.
+    ntsa::Error hideError(ntsa::Handle handle) BSLS_KEYWORD_OVERRIDE;
+
+    /// Stop monitoring the specified socket 'handle'. Return the error.
+    ntsa::Error detachSocket(ntsa::Handle handle) BSLS_KEYWORD_OVERRIDE;
+
+    /// Stop monitoring the specified socket 'handle'. Invoke the specified
+    /// 'callback' at the next dispatch. Return the error.
+    ntsa::Error detachSocket(ntsa::Handle                        handle,
+                             const ntci::SocketDetachedCallback& callback)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return false: sockets must be attached explicitly.
+    bool autoAttach() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return false: sockets must be detached explicitly.
+    bool autoDetach() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return true if the interest in each event is consumed when that
+    /// event is announced, otherwise return false.
+    bool oneShot() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the level trigger.
+    ntca::ReactorEventTrigger::Value trigger() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the data pool.
+    const bsl::shared_ptr<ntci::DataPool>& dataPool() const
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return true if the specified 'oneShot' mode is the mode of this
+    /// reactor, otherwise return false.
+    bool supportsOneShot(bool oneShot) const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return true if the specified 'trigger' is the level trigger,
+    /// otherwise return false.
+    bool supportsTrigger(ntca::ReactorEventTrigger::Value trigger) const
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return null: the reactor has no strand.
+    const bsl::shared_ptr<ntci::Strand>& strand() const
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the current elapsed time since the Unix epoch.
+    bsls::TimeInterval currentTime() const BSLS_KEYWORD_OVERRIDE;
+
+    bsl::shared_ptr<ntsa::Data> createIncomingData() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntsa::Data> createOutgoingData() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<bdlbb::Blob> createIncomingBlob() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<bdlbb::Blob> createOutgoingBlob() BSLS_KEYWORD_OVERRIDE;
+    void createIncomingBlobBuffer(bdlbb::BlobBuffer* blobBuffer)
+        BSLS_KEYWORD_OVERRIDE;
+    void createOutgoingBlobBuffer(bdlbb::BlobBuffer* blobBuffer)
+        BSLS_KEYWORD_OVERRIDE;
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&
+    incomingBlobBufferFactory() const BSLS_KEYWORD_OVERRIDE;
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&
+    outgoingBlobBufferFactory() const BSLS_KEYWORD_OVERRIDE;
+
+    void execute(const Functor&) BSLS_KEYWORD_OVERRIDE;
+    void moveAndExecute(FunctorSequence*,
+                        const Functor&) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&,
+        const bsl::shared_ptr<ntci::TimerSession>&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&,
+        const ntci::TimerCallback&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Strand> createStrand(
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::DatagramSocket> createDatagramSocket(
+        const ntca::DatagramSocketOptions&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::ListenerSocket> createListenerSocket(
+        const ntca::ListenerSocketOptions&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::StreamSocket> createStreamSocket(
+        const ntca::StreamSocketOptions&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntci::Waiter registerWaiter(
+        const ntca::WaiterOptions&) BSLS_KEYWORD_OVERRIDE;
+    void deregisterWaiter(ntci::Waiter) BSLS_KEYWORD_OVERRIDE;
+    void run(ntci::Waiter) BSLS_KEYWORD_OVERRIDE;
+    void poll(ntci::Waiter) BSLS_KEYWORD_OVERRIDE;
+    void interruptOne() BSLS_KEYWORD_OVERRIDE;
+    void interruptAll() BSLS_KEYWORD_OVERRIDE;
+    void stop() BSLS_KEYWORD_OVERRIDE;
+    void restart() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Reactor> acquireReactor(
+        const ntca::LoadBalancingOptions&) BSLS_KEYWORD_OVERRIDE;
+    void releaseReactor(
+        const bsl::shared_ptr<ntci::Reactor>&,
+        const ntca::LoadBalancingOptions&) BSLS_KEYWORD_OVERRIDE;
+    bool acquireHandleReservation() BSLS_KEYWORD_OVERRIDE;
+    void releaseHandleReservation() BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t numReactors() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t numThreads() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t minThreads() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t maxThreads() const BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error attachSocket(
+        const bsl::shared_ptr<ntci::ReactorSocket>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error showReadable(
+        const bsl::shared_ptr<ntci::ReactorSocket>&,
+        const ntca::ReactorEventOptions&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error showWritable(
+        const bsl::shared_ptr<ntci::ReactorSocket>&,
+        const ntca::ReactorEventOptions&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error showError(
+        const bsl::shared_ptr<ntci::ReactorSocket>&,
+        const ntca::ReactorEventOptions&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error hideReadable(
+        const bsl::shared_ptr<ntci::ReactorSocket>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error hideWritable(
+        const bsl::shared_ptr<ntci::ReactorSocket>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error hideError(
+        const bsl::shared_ptr<ntci::ReactorSocket>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error detachSocket(
+        const bsl::shared_ptr<ntci::ReactorSocket>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error closeAll() BSLS_KEYWORD_OVERRIDE;
+    void incrementLoad(
+        const ntca::LoadBalancingOptions&) BSLS_KEYWORD_OVERRIDE;
+    void decrementLoad(
+        const ntca::LoadBalancingOptions&) BSLS_KEYWORD_OVERRIDE;
+    void drainFunctions() BSLS_KEYWORD_OVERRIDE;
+    void clearFunctions() BSLS_KEYWORD_OVERRIDE;
+    void clearTimers() BSLS_KEYWORD_OVERRIDE;
+    void clearSockets() BSLS_KEYWORD_OVERRIDE;
+    void clear() BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t numSockets() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t maxSockets() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t numTimers() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t maxTimers() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t load() const BSLS_KEYWORD_OVERRIDE;
+    bslmt::ThreadUtil::Handle threadHandle() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t threadIndex() const BSLS_KEYWORD_OVERRIDE;
+    bool empty() const BSLS_KEYWORD_OVERRIDE;
+};
+
+/// Describe the completion of a relay.
+struct Result {
+    /// Create a new result of an incomplete relay.
+    Result();
+
+    bool        d_complete;
+    ntsa::Error d_error;
+};
+
+/// Record in the specified 'result' the completion of a relay with the
+/// specified 'error'.
+void processComplete(test::Result* result, const ntsa::Error& error);
+
+/// Return the callback that records the completion of a relay in the
+/// specified 'result'.
+ntci::StreamSocketRelay::Callback createCallback(test::Result* result);
+
+/// Return a new relay between the specified 'first' and 'second' handles
+/// monitored by the specified 'reactor', allocated using the specified
+/// 'basicAllocator'.
+bsl::shared_ptr<ntcu::StreamDescriptorRelay> createRelay(
+    const bsl::shared_ptr<test::Reactor>& reactor,
+    ntsa::Handle                          first,
+    ntsa::Handle                          second,
+    bslma::Allocator*                     basicAllocator);
+
+/// Configure relays started hereafter to splice through kernel pipes, where
+/// supported, according to the specified 'splice' flag.
+void configureSplice(bool splice);
+
+/// Load into the specified 'peer' and 'socket' a pair of connected TCP
+/// sockets. The 'peer' is non-blocking.
+void createPair(ntsa::Handle* peer, ntsa::Handle* socket);
+
+/// Return the byte at the specified 'position' of the data sent by 'fill'.
+char pattern(bsl::size_t position);
+
+/// Send the specified 'data' through the specified 'peer'.
+void send(ntsa::Handle peer, const bsl::string& data);
+
+/// Send through the specified 'peer' the bytes of the pattern starting at
+/// the specified 'position', until 'peer' cannot accept more data, and
+/// advance 'position' by the number of bytes sent.
+void fill(ntsa::Handle peer, bsl::size_t* position);
+
+/// Dispatch the specified 'reactor' while receiving through the specified
+/// 'peer' until the specified 'size' bytes are received, the peer is shut
+/// down, or the operation times out. Return the data received.
+bsl::string receive(test::Reactor*    reactor,
+                    ntsa::Handle      peer,
+                    bsl::size_t       size,
+                    bslma::Allocator* basicAllocator);
+
+/// Dispatch the specified 'reactor' while receiving through the specified
+/// 'peer' until 'peer' is shut down for receiving, or the operation times
+/// out. Return true if 'peer' is shut down without receiving any data,
+/// otherwise return false.
+bool receiveShutdown(test::Reactor* reactor, ntsa::Handle peer);
+
+Reactor::Entry::Entry(bslma::Allocator* basicAllocator)
+: d_readableCallback(basicAllocator)
+, d_writableCallback(basicAllocator)
+, d_errorCallback(basicAllocator)
+, d_error()
+{
+}
+
+bool Reactor::announce(ntsa::Handle handle, ntca::ReactorEventType::Value type)
+{
+    EntryMap::iterator it = d_entryMap.find(handle);
+    if (it == d_entryMap.end()) {
+        return false;
+    }
+
+    bsl::shared_ptr<Entry> entry = it->second;
+
+    ntca::ReactorEvent event;
+    event.setHandle(handle);
+    event.setType(type);
+
+    ntci::ReactorEventCallback* interest = 0;
+
+    if (type == ntca::ReactorEventType::e_READABLE) {
+        interest = &entry->d_readableCallback;
+        if (!*interest || ntsu::SocketUtil::waitUntilReadable(
+                              handle,
+                              bdlt::CurrentTime::now()))
+        {
+            return false;
+        }
+    }
+    else if (type == ntca::ReactorEventType::e_WRITABLE) {
+        interest = &entry->d_writableCallback;
+        if (!*interest || ntsu::SocketUtil::waitUntilWritable(
+                              handle,
+                              bdlt::CurrentTime::now()))
+        {
+            return false;
+        }
+    }
+    else {
+        interest = &entry->d_errorCallback;
+        if (!*interest || !entry->d_error) {
+            return false;
+        }
+
+        event.setError(entry->d_error);
+        entry->d_error = ntsa::Error();
+    }
+
+    ntci::ReactorEventCallback callback(*interest, d_allocator_p);
+
+    if (d_oneShot) {
+        interest->reset();
+    }
+
+    callback(event, ntci::Strand::unknown());
+
+    return true;
+}
+
+Reactor::Reactor(bool oneShot, bslma::Allocator* basicAllocator)
+: d_entryMap(basicAllocator)
+, d_detachQueue(basicAllocator)
+, d_numDetached(0)
+, d_oneShot(oneShot)
+, d_dataPool_sp()
+, d_strand_sp()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    bsl::shared_ptr<ntcs::DataPool> dataPool;
+    dataPool.createInplace(d_allocator_p, 4096, 4096, d_allocator_p);
+
+    d_dataPool_sp = dataPool;
+}
+
+Reactor::~Reactor()
+{
+    NTCCFG_TEST_TRUE(d_entryMap.empty());
+    NTCCFG_TEST_TRUE(d_detachQueue.empty());
+}
+
+bsl::size_t Reactor::dispatch()
+{
+    bsl::size_t numCallbacks = 0;
+
+    DetachQueue detachQueue(d_allocator_p);
+    detachQueue.swap(d_detachQueue);
+
+    for (DetachQueue::iterator it = detachQueue.begin();
+         it != detachQueue.end();
+         ++it)
+    {
+        (*it)(ntci::Strand::unknown());
+        ++numCallbacks;
+    }
+
+    bsl::vector<ntsa::Handle> handles(d_allocator_p);
+    for (EntryMap::const_iterator it = d_entryMap.begin();
+         it != d_entryMap.end();
+         ++it)
+    {
+        handles.push_back(it->first);
+    }
+
+    for (bsl::vector<ntsa::Handle>::const_iterator it = handles.begin();
+         it != handles.end();
+         ++it)
+    {
+        if (this->announce(*it, ntca::ReactorEventType::e_ERROR)) {
+            ++numCallbacks;
+        }
+
+        if (this->announce(*it, ntca::ReactorEventType::e_READABLE)) {
+            ++numCallbacks;
+        }
+
+        if (this->announce(*it, ntca::ReactorEventType::e_WRITABLE)) {
+            ++numCallbacks;
+        }
+    }
+
+    return numCallbacks;
+}
+
+void Reactor::injectError(ntsa::Handle handle, const ntsa::Error& error)
+{
+    EntryMap::iterator it = d_entryMap.find(handle);
+    NTCCFG_TEST_TRUE(it != d_entryMap.end());
+
+    it->second->d_error = error;
+}
+
+bool Reactor::isAttached(ntsa::Handle handle) const
+{
+    return d_entryMap.find(handle) != d_entryMap.end();
+}
+
+bool Reactor::isReadable(ntsa::Handle handle) const
+{
+    EntryMap::const_iterator it = d_entryMap.find(handle);
+    return it != d_entryMap.end() && it->second->d_readableCallback;
+}
+
+bool Reactor::isWritable(ntsa::Handle handle) const
+{
+    EntryMap::const_iterator it = d_entryMap.find(handle);
+    return it != d_entryMap.end() && it->second->d_writableCallback;
+}
+
+bsl::size_t Reactor::numDetached() const
+{
+    return d_numDetached;
+}
+
+ntsa::Error Reactor::attachSocket(ntsa::Handle handle)
+{
+    if (d_entryMap.find(handle) != d_entryMap.end()) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    bsl::shared_ptr<Entry> entry;
+    entry.createInplace(d_allocator_p, d_allocator_p);
+
+    d_entryMap[handle] = entry;
+
+    return ntsa::Error();
+}
+
+ntsa::Error Reactor::showReadable(ntsa::Handle                      handle,
+                                  const ntca::ReactorEventOptions&  options,
+                                  const ntci::ReactorEventCallback& callback)
+{
+    NTCCFG_WARNING_UNUSED(options);
+
+    EntryMap::iterator it = d_entryMap.find(handle);
+    if (it == d_entryMap.end()) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    it->second->d_readableCallback = callback;
+    return ntsa::Error();
+}
+
+ntsa::Error Reactor::showWritable(ntsa::Handle                      handle,
+                                  const ntca::ReactorEventOptions&  options,
+                                  const ntci::ReactorEventCallback& callback)
+{
+    NTCCFG_WARNING_UNUSED(options);
+
+    EntryMap::iterator it = d_entryMap.find(handle);
+    if (it == d_entryMap.end()) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    it->second->d_writableCallback = callback;
+    return ntsa::Error();
+}
+
+ntsa::Error Reactor::showError(ntsa::Handle                      handle,
+                               const ntca::ReactorEventOptions&  options,
+                               const ntci::ReactorEventCallback& callback)
+{
+    NTCCFG_WARNING_UNUSED(options);
+
+    EntryMap::iterator it = d_entryMap.find(handle);
+    if (it == d_entryMap.end()) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    it->second->d_errorCallback = callback;
+    return ntsa::Error();
+}
+
+ntsa::Error Reactor::hideReadable(ntsa::Handle handle)
+{
+    EntryMap::iterator it = d_entryMap.find(handle);
+    if (it == d_entryMap.end()) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    it->second->d_readableCallback.reset();
+    return ntsa::Error();
+}
+
+ntsa::Error Reactor::hideWritable(ntsa::Handle handle)
+{
+    EntryMap::iterator it = d_entryMap.find(handle);
+    if (it == d_entryMap.end()) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    it->second->d_writableCallback.reset();
+    return ntsa::Error();
+}
+
+ntsa::Error Reactor::hideError(ntsa::Handle handle)
+{
+    EntryMap::iterator it = d_entryMap.find(handle);
+    if (it == d_entryMap.end()) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    it->second->d_errorCallback.reset();
+    return ntsa::Error();
+}
+
+ntsa::Error Reactor::detachSocket(ntsa::Handle handle)
+{
+    if (d_entryMap.erase(handle) == 0) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    ++d_numDetached;
+    return ntsa::Error();
+}
+
+ntsa::Error Reactor::detachSocket(ntsa::Handle                        handle,
+                                  const ntci::SocketDetachedCallback& callback)
+{
+    if (d_entryMap.erase(handle) == 0) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    ++d_numDetached;
+
+    if (callback) {
+        d_detachQueue.push_back(callback);
+    }
+
+    return ntsa::Error();
+}
+
+bool Reactor::autoAttach() const
+{
+    return false;
+}
+
+bool Reactor::autoDetach() const
+{
+    return false;
+}
+
+bool Reactor::oneShot() const
+{
+    return d_oneShot;
+}
+
+ntca::ReactorEventTrigger::Value Reactor::trigger() const
+{
+    return ntca::ReactorEventTrigger::e_LEVEL;
+}
+
+const bsl::shared_ptr<ntci::DataPool>& Reactor::dataPool() const
+{
+    return d_dataPool_sp;
+}
+
+bool Reactor::supportsOneShot(bool oneShot) const
+{
+    return oneShot == d_oneShot;
+}
+
+bool Reactor::supportsTrigger(ntca::ReactorEventTrigger::Value trigger) const
+{
+    return trigger == ntca::ReactorEventTrigger::e_LEVEL;
+}
+
+const bsl::shared_ptr<ntci::Strand>& Reactor::strand() const
+{
+    return d_strand_sp;
+}
+
+bsls::TimeInterval Reactor::currentTime() const
+{
+    return bdlt::CurrentTime::now();
+}
+
+bsl::shared_ptr<ntsa::Data> Reactor::createIncomingData()
+{
+    return d_dataPool_sp->createIncomingData();
+}
+
+bsl::shared_ptr<ntsa::Data> Reactor::createOutgoingData()
+{
+    return d_dataPool_sp->createOutgoingData();
+}
+
+bsl::shared_ptr<bdlbb::Blob> Reactor::createIncomingBlob()
+{
+    return d_dataPool_sp->createIncomingBlob();
+}
+
+bsl::shared_ptr<bdlbb::Blob> Reactor::createOutgoingBlob()
+{
+    return d_dataPool_sp->createOutgoingBlob();
+}
+
+void Reactor::createIncomingBlobBuffer(bdlbb::BlobBuffer* blobBuffer)
+{
+    d_dataPool_sp->createIncomingBlobBuffer(blobBuffer);
+}
+
+void Reactor::createOutgoingBlobBuffer(bdlbb::BlobBuffer* blobBuffer)
+{
+    d_dataPool_sp->createOutgoingBlobBuffer(blobBuffer);
+}
+
+const bsl::shared_ptr<bdlbb::BlobBufferFactory>& Reactor::
+    incomingBlobBufferFactory() const
+{
+    return d_dataPool_sp->incomingBlobBufferFactory();
+}
+
+const bsl::shared_ptr<bdlbb::BlobBufferFactory>& Reactor::
+    outgoingBlobBufferFactory() const
+{
+    return d_dataPool_sp->outgoingBlobBufferFactory();
+}
+
+void Reactor::execute(const Functor&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void Reactor::moveAndExecute(FunctorSequence*, const Functor&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+bsl::shared_ptr<ntci::Timer> Reactor::createTimer(
+    const ntca::TimerOptions&,
+    const bsl::shared_ptr<ntci::TimerSession>&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Timer>();
+}
+
+bsl::shared_ptr<ntci::Timer> Reactor::createTimer(const ntca::TimerOptions&,
+                                                  const ntci::TimerCallback&,
+                                                  bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Timer>();
+}
+
+bsl::shared_ptr<ntci::Strand> Reactor::createStrand(bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Strand>();
+}
+
+bsl::shared_ptr<ntci::DatagramSocket> Reactor::createDatagramSocket(
+    const ntca::DatagramSocketOptions&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::DatagramSocket>();
+}
+
+bsl::shared_ptr<ntci::ListenerSocket> Reactor::createListenerSocket(
+    const ntca::ListenerSocketOptions&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::ListenerSocket>();
+}
+
+bsl::shared_ptr<ntci::StreamSocket> Reactor::createStreamSocket(
+    const ntca::StreamSocketOptions&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::StreamSocket>();
+}
+
+ntci::Waiter Reactor::registerWaiter(const ntca::WaiterOptions&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntci::Waiter();
+}
+
+void Reactor::deregisterWaiter(ntci::Waiter)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void Reactor::run(ntci::Waiter)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void Reactor::poll(ntci::Waiter)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void Reactor::interruptOne()
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void Reactor::interruptAll()
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void Reactor::stop()
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void Reactor::restart()
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+bsl::shared_ptr<ntci::Reactor> Reactor::acquireReactor(
+    const ntca::LoadBalancingOptions&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Reactor>();
+}
+
+void Reactor::releaseReactor(const bsl::shared_ptr<ntci::Reactor>&,
+                             const ntca::LoadBalancingOptions&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+bool Reactor::acquireHandleReservation()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return false;
+}
+
+void Reactor::releaseHandleReservation()
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+bsl::size_t Reactor::numReactors() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t Reactor::numThreads() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t Reactor::minThreads() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t Reactor::maxThreads() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+ntsa::Error Reactor::attachSocket(const bsl::shared_ptr<ntci::ReactorSocket>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Reactor::showReadable(const bsl::shared_ptr<ntci::ReactorSocket>&,
+                                  const ntca::ReactorEventOptions&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Reactor::showWritable(const bsl::shared_ptr<ntci::ReactorSocket>&,
+                                  const ntca::ReactorEventOptions&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Reactor::showError(const bsl::shared_ptr<ntci::ReactorSocket>&,
+                               const ntca::ReactorEventOptions&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Reactor::hideReadable(const bsl::shared_ptr<ntci::ReactorSocket>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Reactor::hideWritable(const bsl::shared_ptr<ntci::ReactorSocket>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Reactor::hideError(const bsl::shared_ptr<ntci::ReactorSocket>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Reactor::detachSocket(const bsl::shared_ptr<ntci::ReactorSocket>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Reactor::closeAll()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+void Reactor::incrementLoad(const ntca::LoadBalancingOptions&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void Reactor::decrementLoad(const ntca::LoadBalancingOptions&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void Reactor::drainFunctions()
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void Reactor::clearFunctions()
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void Reactor::clearTimers()
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void Reactor::clearSockets()
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void Reactor::clear()
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+bsl::size_t Reactor::numSockets() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t Reactor::maxSockets() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t Reactor::numTimers() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t Reactor::maxTimers() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t Reactor::load() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bslmt::ThreadUtil::Handle Reactor::threadHandle() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bslmt::ThreadUtil::invalidHandle();
+}
+
+bsl::size_t Reactor::threadIndex() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bool Reactor::empty() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return false;
+}
+
+Result::Result()
+: d_complete(false)
+, d_error()
+{
+}
+
+void processComplete(test::Result* result, const ntsa::Error& error)
+{
+    NTCCFG_TEST_FALSE(result->d_complete);
+
+    result->d_complete = true;
+    result->d_error    = error;
+}
+
+ntci::StreamSocketRelay::Callback createCallback(test::Result* result)
+{
+    return bdlf::BindUtil::bind(&test::processComplete,
+                                result,
+                                bdlf::PlaceHolders::_1);
+}
+
+bsl::shared_ptr<ntcu::StreamDescriptorRelay> createRelay(
+    const bsl::shared_ptr<test::Reactor>& reactor,
+    ntsa::Handle                          first,
+    ntsa::Handle                          second,
+    bslma::Allocator*                     basicAllocator)
+{
+    bsl::shared_ptr<ntcu::StreamDescriptorRelay> relay;
+    relay.createInplace(basicAllocator,
+                        reactor,
+                        first,
+                        second,
+                        basicAllocator);
+    return relay;
+}
+
+void configureSplice(bool splice)
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    ::setenv("NTCU_STREAMDESCRIPTORRELAY_SPLICE", splice ? "1" : "0", 1);
+#else
+    NTCCFG_WARNING_UNUSED(splice);
+#endif
+}
+
+void createPair(ntsa::Handle* peer, ntsa::Handle* socket)
+{
+    ntsa::Error error;
+
+    error = ntsu::SocketUtil::pair(peer,
+                                   socket,
+                                   ntsa::Transport::e_TCP_IPV4_STREAM);
+    NTCCFG_TEST_OK(error);
+
+    error = ntsu::SocketOptionUtil::setBlocking(*peer, false);
+    NTCCFG_TEST_OK(error);
+}
+
+char pattern(bsl::size_t position)
+{
+    return static_cast<char>('a' + position % 26);
+}
+
+void send(ntsa::Handle peer, const bsl::string& data)
+{
+    ntsa::SendContext context;
+    ntsa::Error       error = ntsu::SocketUtil::send(&context,
+                                               bslstl::StringRef(data),
+                                               ntsa::SendOptions(),
+                                               peer);
+    NTCCFG_TEST_OK(error);
+    NTCCFG_TEST_EQ(context.bytesSent(), data.size());
+}
+
+void fill(ntsa::Handle peer, bsl::size_t* position)
+{
+    char buffer[4096];
+
+    while (true) {
+        for (bsl::size_t i = 0; i < sizeof buffer; ++i) {
+            buffer[i] = test::pattern(*position + i);
+        }
+
+        ntsa::SendContext context;
+        ntsa::Error       error = ntsu::SocketUtil::send(
+            &context,
+            bslstl::StringRef(buffer, sizeof buffer),
+            ntsa::SendOptions(),
+            peer);
+        if (error) {
+            NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+            return;
+        }
+
+        *position += context.bytesSent();
+    }
+}
+
+bsl::string receive(test::Reactor*    reactor,
+                    ntsa::Handle      peer,
+                    bsl::size_t       size,
+                    bslma::Allocator* basicAllocator)
+{
+    bsl::string result(basicAllocator);
+
+    const bsls::TimeInterval deadline =
+        bdlt::CurrentTime::now() + bsls::TimeInterval(k_TIMEOUT, 0);
+
+    while (result.size() < size && bdlt::CurrentTime::now() < deadline) {
+        reactor->dispatch();
+
+        char buffer[65536];
+
+        ntsa::ReceiveContext context;
+        ntsa::Error          error =
+            ntsu::SocketUtil::receive(&context,
+                                      buffer,
+                                      sizeof buffer,
+                                      ntsa::ReceiveOptions(),
+                                      peer);
+        if (error) {
+            NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_WOULD_BLOCK));
+            ntsu::SocketUtil::waitUntilReadable(
+                peer,
+                bdlt::CurrentTime::now() + bsls::TimeInterval(0, 1000000));
+            continue;
+        }
+
+        if (context.bytesReceived() == 0) {
+            break;
+        }
+
+        result.append(buffer, context.bytesReceived());
+    }
+
+    return result;
+}
+
+bool receiveShutdown(test::Reactor* reactor, ntsa::Handle peer)
+{
+    const bsls::TimeInterval deadline =
+        bdlt::CurrentTime::now() + bsls::TimeInterval(k_TIMEOUT, 0);
+
+    while (bdlt::CurrentTime::now() < deadline) {
+        reactor->dispatch();
+
+        char buffer[1];
+
+        ntsa::ReceiveContext context;
+        ntsa::Error          error =
+            ntsu::SocketUtil::receive(&context,
+                                      buffer,
+                                      sizeof buffer,
+                                      ntsa::ReceiveOptions(),
+                                      peer);
+        if (error) {
+            if (error != ntsa::Error::e_WOULD_BLOCK) {
+                return false;
+            }
+
+            ntsu::SocketUtil::waitUntilReadable(
+                peer,
+                bdlt::CurrentTime::now() + bsls::TimeInterval(0, 1000000));
+            continue;
+        }
+
+        return context.bytesReceived() == 0;
+    }
+
+    return false;
+}
+
+}  // close namespace test
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Data is forwarded in both directions, including data
+    // received before the relay is started, by one-shot reactors and
+    // otherwise.
+    // Plan: Send data through each peer and ensure it is received by the
+    // other.
+
+    ntscfg::Platform::ignore(ntscfg::Signal::e_PIPE);
+
+    ntccfg::TestAllocator ta;
+    {
+        for (bsl::size_t variation = 0; variation < 4; ++variation) {
+            const bool splice  = (variation & 1) != 0;
+            const bool oneShot = (variation & 2) != 0;
+
+            ntsa::Error error;
+
+            test::configureSplice(splice);
+
+            bsl::shared_ptr<test::Reactor> reactor;
+            reactor.createInplace(&ta, oneShot, &ta);
+
+            ntsa::Handle firstPeer;
+            ntsa::Handle first;
+            test::createPair(&firstPeer, &first);
+
+            ntsa::Handle secondPeer;
+            ntsa::Handle second;
+            test::createPair(&secondPeer, &second);
+
+            test::send(firstPeer, "early");
+
+            bsl::shared_ptr<ntcu::StreamDescriptorRelay> relay =
+                test::createRelay(reactor, first, second, &ta);
+
+            test::Result result;
+            error = relay->start(test::createCallback(&result));
+            NTCCFG_TEST_OK(error);
+
+            NTCCFG_TEST_EQ(relay->isSpliced(),
+                           splice && test::k_SPLICE_SUPPORTED);
+
+            NTCCFG_TEST_TRUE(reactor->isAttached(first));
+            NTCCFG_TEST_TRUE(reactor->isAttached(second));
+
+            error = relay->start(test::createCallback(&result));
+            NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_INVALID));
+
+            test::send(firstPeer, "hello");
+            test::send(secondPeer, "world!");
+
+            NTCCFG_TEST_EQ(test::receive(reactor.get(), secondPeer, 10, &ta),
+                           "earlyhello");
+            NTCCFG_TEST_EQ(test::receive(reactor.get(), firstPeer, 6, &ta),
+                           "world!");
+
+            NTCCFG_TEST_EQ(relay->numBytesForwarded(), 10);
+            NTCCFG_TEST_EQ(relay->numBytesReturned(), 6);
+
+            NTCCFG_TEST_FALSE(result.d_complete);
+
+            relay->stop();
+            reactor->dispatch();
+
+            NTCCFG_TEST_TRUE(result.d_complete);
+
+            ntsu::SocketUtil::close(firstPeer);
+            ntsu::SocketUtil::close(secondPeer);
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: Forwarding is subject to backpressure from the destination.
+    // Plan: Send data through the first peer, without receiving any through
+    // the second peer, until the relay stops reading from the source, and
+    // ensure the first peer is then flow controlled by the kernel. Receive
+    // all data through the second peer and ensure none is lost.
+
+    ntscfg::Platform::ignore(ntscfg::Signal::e_PIPE);
+
+    ntccfg::TestAllocator ta;
+    {
+        for (bsl::size_t variation = 0; variation < 2; ++variation) {
+            const bool splice = variation != 0;
+
+            ntsa::Error error;
+
+            test::configureSplice(splice);
+
+            bsl::shared_ptr<test::Reactor> reactor;
+            reactor.createInplace(&ta, false, &ta);
+
+            ntsa::Handle firstPeer;
+            ntsa::Handle first;
+            test::createPair(&firstPeer, &first);
+
+            ntsa::Handle secondPeer;
+            ntsa::Handle second;
+            test::createPair(&secondPeer, &second);
+
+            bsl::shared_ptr<ntcu::StreamDescriptorRelay> relay =
+                test::createRelay(reactor, first, second, &ta);
+
+            test::Result result;
+            error = relay->start(test::createCallback(&result));
+            NTCCFG_TEST_OK(error);
+
+            bsl::size_t numBytesSent = 0;
+            bool        blocked      = false;
+
+            for (bsl::size_t i = 0; i < test::k_MAX_ROUNDS && !blocked; ++i)
+            {
+                test::fill(firstPeer, &numBytesSent);
+                reactor->dispatch();
+
+                blocked = reactor->isWritable(second) &&
+                          !reactor->isReadable(first);
+            }
+
+            NTCCFG_TEST_TRUE(blocked);
+
+            test::fill(firstPeer, &numBytesSent);
+
+            NTCCFG_TEST_LT(relay->numBytesForwarded(), numBytesSent);
+
+            bsl::string data =
+                test::receive(reactor.get(), secondPeer, numBytesSent, &ta);
+
+            NTCCFG_TEST_EQ(data.size(), numBytesSent);
+
+            bsl::size_t numMismatches = 0;
+            for (bsl::size_t i = 0; i < data.size(); ++i) {
+                if (data[i] != test::pattern(i)) {
+                    ++numMismatches;
+                }
+            }
+
+            NTCCFG_TEST_EQ(numMismatches, 0);
+            NTCCFG_TEST_EQ(relay->numBytesForwarded(), numBytesSent);
+
+            NTCCFG_TEST_FALSE(reactor->isWritable(second));
+            NTCCFG_TEST_TRUE(reactor->isReadable(first));
+
+            relay->stop();
+            reactor->dispatch();
+
+            NTCCFG_TEST_TRUE(result.d_complete);
+            NTCCFG_TEST_EQ(result.d_error,
+                           ntsa::Error(ntsa::Error::e_CANCELLED));
+
+            ntsu::SocketUtil::close(firstPeer);
+            ntsu::SocketUtil::close(secondPeer);
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(3)
+{
+    // Concern: A shutdown by one peer half-closes the connection to the
+    // other peer after all preceding data is forwarded, and the relay
+    // completes when both peers have shut down.
+    // Plan: Send data through then shut down each peer in turn, and ensure
+    // the other peer receives the data then the shutdown.
+
+    ntscfg::Platform::ignore(ntscfg::Signal::e_PIPE);
+
+    ntccfg::TestAllocator ta;
+    {
+        for (bsl::size_t variation = 0; variation < 2; ++variation) {
+            const bool splice = variation != 0;
+
+            ntsa::Error error;
+
+            test::configureSplice(splice);
+
+            bsl::shared_ptr<test::Reactor> reactor;
+            reactor.createInplace(&ta, false, &ta);
+
+            ntsa::Handle firstPeer;
+            ntsa::Handle first;
+            test::createPair(&firstPeer, &first);
+
+            ntsa::Handle secondPeer;
+            ntsa::Handle second;
+            test::createPair(&secondPeer, &second);
+
+            bsl::shared_ptr<ntcu::StreamDescriptorRelay> relay =
+                test::createRelay(reactor, first, second, &ta);
+
+            test::Result result;
+            error = relay->start(test::createCallback(&result));
+            NTCCFG_TEST_OK(error);
+
+            test::send(firstPeer, "hello");
+
+            error = ntsu::SocketUtil::shutdown(ntsa::ShutdownType::e_SEND,
+                                               firstPeer);
+            NTCCFG_TEST_OK(error);
+
+            NTCCFG_TEST_EQ(test::receive(reactor.get(), secondPeer, 5, &ta),
+                           "hello");
+            NTCCFG_TEST_TRUE(test::receiveShutdown(reactor.get(), secondPeer));
+
+            NTCCFG_TEST_FALSE(result.d_complete);
+
+            test::send(secondPeer, "world");
+
+            NTCCFG_TEST_EQ(test::receive(reactor.get(), firstPeer, 5, &ta),
+                           "world");
+
+            error = ntsu::SocketUtil::shutdown(ntsa::ShutdownType::e_SEND,
+                                               secondPeer);
+            NTCCFG_TEST_OK(error);
+
+            NTCCFG_TEST_TRUE(test::receiveShutdown(reactor.get(), firstPeer));
+
+            reactor->dispatch();
+
+            NTCCFG_TEST_TRUE(result.d_complete);
+            NTCCFG_TEST_OK(result.d_error);
+
+            NTCCFG_TEST_EQ(relay->numBytesForwarded(), 5);
+            NTCCFG_TEST_EQ(relay->numBytesReturned(), 5);
+
+            NTCCFG_TEST_EQ(reactor->numDetached(), 2);
+            NTCCFG_TEST_FALSE(reactor->isAttached(first));
+            NTCCFG_TEST_FALSE(reactor->isAttached(second));
+
+            ntsu::SocketUtil::close(firstPeer);
+            ntsu::SocketUtil::close(secondPeer);
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(4)
+{
+    // Concern: Stopping the relay detaches and closes both handles, then
+    // invokes the callback with 'ntsa::Error::e_CANCELLED'.
+    // Plan: Stop a relay in progress and ensure the callback is invoked
+    // once both handles are detached, and both peers are shut down.
+
+    ntscfg::Platform::ignore(ntscfg::Signal::e_PIPE);
+
+    ntccfg::TestAllocator ta;
+    {
+        for (bsl::size_t variation = 0; variation < 2; ++variation) {
+            const bool splice = variation != 0;
+
+            ntsa::Error error;
+
+            test::configureSplice(splice);
+
+            bsl::shared_ptr<test::Reactor> reactor;
+            reactor.createInplace(&ta, false, &ta);
+
+            ntsa::Handle firstPeer;
+            ntsa::Handle first;
+            test::createPair(&firstPeer, &first);
+
+            ntsa::Handle secondPeer;
+            ntsa::Handle second;
+            test::createPair(&secondPeer, &second);
+
+            bsl::shared_ptr<ntcu::StreamDescriptorRelay> relay =
+                test::createRelay(reactor, first, second, &ta);
+
+            test::Result result;
+            error = relay->start(test::createCallback(&result));
+            NTCCFG_TEST_OK(error);
+
+            test::send(firstPeer, "hello");
+
+            NTCCFG_TEST_EQ(test::receive(reactor.get(), secondPeer, 5, &ta),
+                           "hello");
+
+            relay->stop();
+
+            NTCCFG_TEST_FALSE(result.d_complete);
+            NTCCFG_TEST_EQ(reactor->numDetached(), 2);
+
+            reactor->dispatch();
+
+            NTCCFG_TEST_TRUE(result.d_complete);
+            NTCCFG_TEST_EQ(result.d_error,
+                           ntsa::Error(ntsa::Error::e_CANCELLED));
+
+            relay->stop();
+
+            NTCCFG_TEST_TRUE(test::receiveShutdown(reactor.get(), firstPeer));
+            NTCCFG_TEST_TRUE(test::receiveShutdown(reactor.get(), secondPeer));
+
+            ntsu::SocketUtil::close(firstPeer);
+            ntsu::SocketUtil::close(secondPeer);
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(5)
+{
+    // Concern: An error on either handle completes the relay with that
+    // error.
+    // Plan: Inject an error for the first handle and ensure the callback is
+    // invoked with that error once both handles are detached, and both
+    // peers are shut down.
+
+    ntscfg::Platform::ignore(ntscfg::Signal::e_PIPE);
+
+    ntccfg::TestAllocator ta;
+    {
+        for (bsl::size_t variation = 0; variation < 2; ++variation) {
+            const bool splice = variation != 0;
+
+            ntsa::Error error;
+
+            test::configureSplice(splice);
+
+            bsl::shared_ptr<test::Reactor> reactor;
+            reactor.createInplace(&ta, false, &ta);
+
+            ntsa::Handle firstPeer;
+            ntsa::Handle first;
+            test::createPair(&firstPeer, &first);
+
+            ntsa::Handle secondPeer;
+            ntsa::Handle second;
+            test::createPair(&secondPeer, &second);
+
+            bsl::shared_ptr<ntcu::StreamDescriptorRelay> relay =
+                test::createRelay(reactor, first, second, &ta);
+
+            test::Result result;
+            error = relay->start(test::createCallback(&result));
+            NTCCFG_TEST_OK(error);
+
+            reactor->injectError(first,
+                                 ntsa::Error(ntsa::Error::e_CONNECTION_RESET));
+
+            // The first dispatch announces the error, which initiates the
+            // detachment of both handles, and the second announces their
+            // detachment.
+
+            reactor->dispatch();
+            NTCCFG_TEST_FALSE(result.d_complete);
+
+            reactor->dispatch();
+            NTCCFG_TEST_TRUE(result.d_complete);
+            NTCCFG_TEST_EQ(result.d_error,
+                           ntsa::Error(ntsa::Error::e_CONNECTION_RESET));
+
+            NTCCFG_TEST_TRUE(test::receiveShutdown(reactor.get(), firstPeer));
+            NTCCFG_TEST_TRUE(test::receiveShutdown(reactor.get(), secondPeer));
+
+            ntsu::SocketUtil::close(firstPeer);
+            ntsu::SocketUtil::close(secondPeer);
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+    NTCCFG_TEST_REGISTER(3);
+    NTCCFG_TEST_REGISTER(4);
+    NTCCFG_TEST_REGISTER(5);
+}
+NTCCFG_TEST_DRIVER_END;
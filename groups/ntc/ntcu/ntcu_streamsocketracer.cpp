@@ -0,0 +1,628 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcu_streamsocketracer.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcu_streamsocketracer_cpp, "$Id$ $CSID$")
+
+#include <ntca_getipaddressoptions.h>
+#include <ntca_timeroptions.h>
+#include <ntci_log.h>
+#include <ntsa_ipendpoint.h>
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace ntcu {
+
+StreamSocketRacerAttempt::StreamSocketRacerAttempt(
+    const ntsa::Endpoint& endpoint)
+: d_endpoint(endpoint)
+, d_delay()
+, d_latency()
+, d_error()
+, d_started(false)
+, d_complete(false)
+, d_winner(false)
+{
+}
+
+void StreamSocketRacerAttempt::setDelay(const bsls::TimeInterval& value)
+{
+    d_delay = value;
+}
+
+void StreamSocketRacerAttempt::setLatency(const bsls::TimeInterval& value)
+{
+    d_latency = value;
+}
+
+void StreamSocketRacerAttempt::setError(const ntsa::Error& value)
+{
+    d_error = value;
+}
+
+void StreamSocketRacerAttempt::setStarted(bool value)
+{
+    d_started = value;
+}
+
+void StreamSocketRacerAttempt::setComplete(bool value)
+{
+    d_complete = value;
+}
+
+void StreamSocketRacerAttempt::setWinner(bool value)
+{
+    d_winner = value;
+}
+
+const ntsa::Endpoint& StreamSocketRacerAttempt::endpoint() const
+{
+    return d_endpoint;
+}
+
+const bsls::TimeInterval& StreamSocketRacerAttempt::delay() const
+{
+    return d_delay;
+}
+
+const bsls::TimeInterval& StreamSocketRacerAttempt::latency() const
+{
+    return d_latency;
+}
+
+const ntsa::Error& StreamSocketRacerAttempt::error() const
+{
+    return d_error;
+}
+
+bool StreamSocketRacerAttempt::started() const
+{
+    return d_started;
+}
+
+bool StreamSocketRacerAttempt::complete() const
+{
+    return d_complete;
+}
+
+bool StreamSocketRacerAttempt::winner() const
+{
+    return d_winner;
+}
+
+StreamSocketRacer::Completion::Completion(bslma::Allocator* basicAllocator)
+: d_callback(bsl::allocator_arg, basicAllocator)
+, d_streamSocket()
+, d_closeList(basicAllocator)
+, d_timer_sp()
+, d_attempts(basicAllocator)
+, d_error()
+{
+}
+
+void StreamSocketRacer::processIpAddress(
+    const bsl::shared_ptr<ntci::Resolver>& resolver,
+    const bsl::vector<ntsa::IpAddress>&    ipAddressList,
+    const ntca::GetIpAddressEvent&         event)
+{
+    NTCCFG_WARNING_UNUSED(resolver);
+
+    Completion completion(d_allocator_p);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (!d_inProgress) {
+            return;
+        }
+
+        if (event.type() == ntca::GetIpAddressEventType::e_ERROR) {
+            this->privateComplete(&completion,
+                                  d_attempts.size(),
+                                  event.context().error());
+        }
+        else {
+            this->privateStart(&completion, ipAddressList);
+        }
+    }
+
+    StreamSocketRacer::announce(completion);
+}
+
+void StreamSocketRacer::processConnect(
+    bsl::size_t                             index,
+    const bsl::shared_ptr<ntci::Connector>& connector,
+    const ntca::ConnectEvent&               event)
+{
+    NTCCFG_WARNING_UNUSED(connector);
+
+    NTCI_LOG_CONTEXT();
+
+    Completion completion(d_allocator_p);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (!d_inProgress) {
+            return;
+        }
+
+        BSLS_ASSERT(index < d_attempts.size());
+
+        ntcu::StreamSocketRacerAttempt& attempt = d_attempts[index];
+
+        if (attempt.complete()) {
+            return;
+        }
+
+        attempt.setComplete(true);
+        attempt.setLatency(d_interface_sp->currentTime() - d_startTime -
+                           attempt.delay());
+
+        BSLS_ASSERT(d_numPending > 0);
+        --d_numPending;
+
+        if (event.type() == ntca::ConnectEventType::e_COMPLETE) {
+            this->privateComplete(&completion, index, ntsa::Error());
+        }
+        else {
+            attempt.setError(event.context().error());
+
+            NTCI_LOG_STREAM_DEBUG << "Stream socket racer attempt "
+                                  << index << " to " << attempt.endpoint()
+                                  << " failed: " << attempt.error()
+                                  << NTCI_LOG_STREAM_END;
+
+            bool expired = false;
+            if (!d_connectOptions.deadline().isNull()) {
+                expired = d_interface_sp->currentTime() >=
+                          d_connectOptions.deadline().value();
+            }
+
+            if (expired) {
+                this->privateComplete(
+                    &completion,
+                    d_attempts.size(),
+                    ntsa::Error(ntsa::Error::e_CONNECTION_TIMEOUT));
+            }
+            else if (d_numStarted < d_attempts.size()) {
+                this->privateStartNext(&completion);
+            }
+            else if (d_numPending == 0) {
+                this->privateComplete(&completion,
+                                      d_attempts.size(),
+                                      attempt.error());
+            }
+        }
+    }
+
+    StreamSocketRacer::announce(completion);
+}
+
+void StreamSocketRacer::processTimer(
+    const bsl::shared_ptr<ntci::Timer>& timer,
+    const ntca::TimerEvent&             event)
+{
+    if (event.type() != ntca::TimerEventType::e_DEADLINE) {
+        return;
+    }
+
+    Completion completion(d_allocator_p);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (!d_inProgress) {
+            return;
+        }
+
+        if (timer != d_timer_sp) {
+            return;
+        }
+
+        if (d_numStarted < d_attempts.size()) {
+            this->privateStartNext(&completion);
+        }
+    }
+
+    StreamSocketRacer::announce(completion);
+}
+
+void StreamSocketRacer::privateStart(
+    Completion*                         completion,
+    const bsl::vector<ntsa::IpAddress>& ipAddressList)
+{
+    bsl::vector<ntsa::IpAddress> sortedIpAddressList(ipAddressList,
+                                                     d_allocator_p);
+    StreamSocketRacer::sortIpAddressList(&sortedIpAddressList);
+
+    for (bsl::size_t i = 0; i < sortedIpAddressList.size(); ++i) {
+        const ntsa::IpAddress& ipAddress = sortedIpAddressList[i];
+
+        if (!d_connectOptions.ipAddressType().isNull()) {
+            if (ipAddress.type() != d_connectOptions.ipAddressType().value()) {
+                continue;
+            }
+        }
+
+        d_attempts.push_back(ntcu::StreamSocketRacerAttempt(
+            ntsa::Endpoint(ntsa::IpEndpoint(ipAddress, d_port))));
+    }
+
+    d_streamSockets.resize(d_attempts.size());
+
+    if (d_attempts.empty()) {
+        this->privateComplete(completion,
+                              d_attempts.size(),
+                              ntsa::Error(ntsa::Error::e_EOF));
+        return;
+    }
+
+    this->privateStartNext(completion);
+}
+
+void StreamSocketRacer::privateStartNext(Completion* completion)
+{
+    NTCI_LOG_CONTEXT();
+
+    bsl::shared_ptr<StreamSocketRacer> self = this->getSelf(this);
+
+    ntsa::Error error;
+
+    // Start the next attempt. If the attempt cannot be started, fail it and
+    // immediately start the attempt after it.
+
+    while (d_numStarted < d_attempts.size()) {
+        const bsl::size_t               index   = d_numStarted++;
+        ntcu::StreamSocketRacerAttempt& attempt = d_attempts[index];
+
+        attempt.setStarted(true);
+        attempt.setDelay(d_interface_sp->currentTime() - d_startTime);
+
+        bsl::shared_ptr<ntci::StreamSocket> streamSocket =
+            d_interface_sp->createStreamSocket(d_streamSocketOptions,
+                                               d_allocator_p);
+
+        ntca::ConnectOptions connectOptions;
+        if (!d_connectOptions.deadline().isNull()) {
+            connectOptions.setDeadline(d_connectOptions.deadline().value());
+        }
+
+        ntci::ConnectCallback connectCallback =
+            streamSocket->createConnectCallback(
+                bdlf::BindUtil::bind(&StreamSocketRacer::processConnect,
+                                     self,
+                                     index,
+                                     bdlf::PlaceHolders::_1,
+                                     bdlf::PlaceHolders::_2),
+                d_allocator_p);
+
+        error = streamSocket->connect(attempt.endpoint(),
+                                      connectOptions,
+                                      connectCallback);
+        if (error) {
+            NTCI_LOG_STREAM_DEBUG << "Stream socket racer attempt " << index
+                                  << " to " << attempt.endpoint()
+                                  << " failed to start: " << error
+                                  << NTCI_LOG_STREAM_END;
+
+            attempt.setComplete(true);
+            attempt.setError(error);
+
+            completion->d_closeList.push_back(streamSocket);
+            continue;
+        }
+
+        d_streamSockets[index] = streamSocket;
+        ++d_numPending;
+        break;
+    }
+
+    if (d_numPending == 0) {
+        this->privateComplete(completion, d_attempts.size(), error);
+        return;
+    }
+
+    // Start the attempt after this one when the attempt delay elapses, if
+    // no attempt succeeds or fails first.
+
+    if (d_numStarted < d_attempts.size()) {
+        if (d_timer_sp) {
+            d_timer_sp->close();
+            d_timer_sp.reset();
+        }
+
+        ntca::TimerOptions timerOptions;
+        timerOptions.setOneShot(true);
+        timerOptions.hideEvent(ntca::TimerEventType::e_CANCELED);
+        timerOptions.hideEvent(ntca::TimerEventType::e_CLOSED);
+
+        ntci::TimerCallback timerCallback =
+            d_interface_sp->createTimerCallback(
+                bdlf::BindUtil::bind(&StreamSocketRacer::processTimer,
+                                     self,
+                                     bdlf::PlaceHolders::_1,
+                                     bdlf::PlaceHolders::_2),
+                d_allocator_p);
+
+        d_timer_sp = d_interface_sp->createTimer(timerOptions,
+                                                 timerCallback,
+                                                 d_allocator_p);
+
+        d_timer_sp->schedule(d_interface_sp->currentTime() + d_attemptDelay);
+    }
+}
+
+void StreamSocketRacer::privateComplete(Completion*        completion,
+                                        bsl::size_t        winner,
+                                        const ntsa::Error& error)
+{
+    for (bsl::size_t i = 0; i < d_attempts.size(); ++i) {
+        ntcu::StreamSocketRacerAttempt& attempt = d_attempts[i];
+
+        if (i == winner) {
+            attempt.setWinner(true);
+            completion->d_streamSocket = d_streamSockets[i];
+            continue;
+        }
+
+        if (attempt.started() && !attempt.complete()) {
+            attempt.setComplete(true);
+            attempt.setError(ntsa::Error(ntsa::Error::e_CANCELLED));
+            attempt.setLatency(d_interface_sp->currentTime() - d_startTime -
+                               attempt.delay());
+        }
+
+        if (d_streamSockets[i]) {
+            completion->d_closeList.push_back(d_streamSockets[i]);
+        }
+    }
+
+    if (winner < d_attempts.size()) {
+        completion->d_error = ntsa::Error();
+    }
+    else if (error) {
+        completion->d_error = error;
+    }
+    else {
+        completion->d_error = ntsa::Error(ntsa::Error::e_CONNECTION_REFUSED);
+    }
+
+    completion->d_attempts = d_attempts;
+    completion->d_timer_sp = d_timer_sp;
+
+    bsl::swap(completion->d_callback, d_callback);
+
+    d_streamSockets.clear();
+    d_timer_sp.reset();
+    d_numPending = 0;
+    d_inProgress = false;
+}
+
+void StreamSocketRacer::announce(const Completion& completion)
+{
+    if (completion.d_timer_sp) {
+        completion.d_timer_sp->close();
+    }
+
+    for (bsl::size_t i = 0; i < completion.d_closeList.size(); ++i) {
+        completion.d_closeList[i]->close();
+    }
+
+    if (completion.d_callback) {
+        completion.d_callback(completion.d_streamSocket,
+                              completion.d_attempts,
+                              completion.d_error);
+    }
+}
+
+StreamSocketRacer::StreamSocketRacer(
+    const bsl::shared_ptr<ntci::Interface>& interface,
+    const ntca::StreamSocketOptions&        options,
+    const bsls::TimeInterval&               attemptDelay,
+    bslma::Allocator*                       basicAllocator)
+: d_mutex()
+, d_interface_sp(interface)
+, d_streamSocketOptions(options)
+, d_attemptDelay(attemptDelay)
+, d_port(0)
+, d_connectOptions()
+, d_attempts(basicAllocator)
+, d_streamSockets(basicAllocator)
+, d_numStarted(0)
+, d_numPending(0)
+, d_timer_sp()
+, d_startTime()
+, d_inProgress(false)
+, d_callback(bsl::allocator_arg, basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+StreamSocketRacer::~StreamSocketRacer()
+{
+}
+
+ntsa::Error StreamSocketRacer::connect(const bsl::string&          domainName,
+                                       ntsa::Port                  port,
+                                       const ntca::ConnectOptions& options,
+                                       const Callback&             callback)
+{
+    ntsa::IpAddress ipAddress;
+    if (ipAddress.parse(domainName)) {
+        bsl::vector<ntsa::IpAddress> ipAddressList(1, ipAddress);
+        return this->connect(ipAddressList, port, options, callback);
+    }
+
+    bsl::shared_ptr<StreamSocketRacer> self = this->getSelf(this);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (d_inProgress) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    const bsl::shared_ptr<ntci::Resolver>& resolver =
+        d_interface_sp->resolver();
+    if (!resolver) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    ntca::GetIpAddressOptions getIpAddressOptions;
+
+    if (!options.ipAddressType().isNull()) {
+        getIpAddressOptions.setIpAddressType(options.ipAddressType().value());
+    }
+
+    if (!options.transport().isNull()) {
+        getIpAddressOptions.setTransport(options.transport().value());
+    }
+
+    if (!options.deadline().isNull()) {
+        getIpAddressOptions.setDeadline(options.deadline().value());
+    }
+
+    ntci::GetIpAddressCallback getIpAddressCallback =
+        resolver->createGetIpAddressCallback(
+            bdlf::BindUtil::bind(&StreamSocketRacer::processIpAddress,
+                                 self,
+                                 bdlf::PlaceHolders::_1,
+                                 bdlf::PlaceHolders::_2,
+                                 bdlf::PlaceHolders::_3),
+            d_allocator_p);
+
+    d_port           = port;
+    d_connectOptions = options;
+    d_callback       = callback;
+    d_startTime      = d_interface_sp->currentTime();
+    d_numStarted     = 0;
+    d_numPending     = 0;
+    d_inProgress     = true;
+
+    d_attempts.clear();
+    d_streamSockets.clear();
+
+    ntsa::Error error = resolver->getIpAddress(domainName,
+                                               getIpAddressOptions,
+                                               getIpAddressCallback);
+    if (error) {
+        d_callback   = Callback();
+        d_inProgress = false;
+        return error;
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error StreamSocketRacer::connect(
+    const bsl::vector<ntsa::IpAddress>& ipAddressList,
+    ntsa::Port                          port,
+    const ntca::ConnectOptions&         options,
+    const Callback&                     callback)
+{
+    Completion completion(d_allocator_p);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (d_inProgress) {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+
+        d_port           = port;
+        d_connectOptions = options;
+        d_callback       = callback;
+        d_startTime      = d_interface_sp->currentTime();
+        d_numStarted     = 0;
+        d_numPending     = 0;
+        d_inProgress     = true;
+
+        d_attempts.clear();
+        d_streamSockets.clear();
+
+        this->privateStart(&completion, ipAddressList);
+    }
+
+    StreamSocketRacer::announce(completion);
+
+    return ntsa::Error();
+}
+
+void StreamSocketRacer::cancel()
+{
+    Completion completion(d_allocator_p);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (!d_inProgress) {
+            return;
+        }
+
+        this->privateComplete(&completion,
+                              d_attempts.size(),
+                              ntsa::Error(ntsa::Error::e_CANCELLED));
+    }
+
+    StreamSocketRacer::announce(completion);
+}
+
+void StreamSocketRacer::sortIpAddressList(
+    bsl::vector<ntsa::IpAddress>* ipAddressList)
+{
+    bsl::vector<ntsa::IpAddress> ipv4AddressList(
+        ipAddressList->get_allocator());
+    bsl::vector<ntsa::IpAddress> ipv6AddressList(
+        ipAddressList->get_allocator());
+
+    for (bsl::size_t i = 0; i < ipAddressList->size(); ++i) {
+        const ntsa::IpAddress& ipAddress = (*ipAddressList)[i];
+        if (ipAddress.isV6()) {
+            ipv6AddressList.push_back(ipAddress);
+        }
+        else {
+            ipv4AddressList.push_back(ipAddress);
+        }
+    }
+
+    ipAddressList->clear();
+
+    bsl::size_t i = 0;
+    while (i < ipv6AddressList.size() || i < ipv4AddressList.size()) {
+        if (i < ipv6AddressList.size()) {
+            ipAddressList->push_back(ipv6AddressList[i]);
+        }
+
+        if (i < ipv4AddressList.size()) {
+            ipAddressList->push_back(ipv4AddressList[i]);
+        }
+
+        ++i;
+    }
+}
+
+bsls::TimeInterval StreamSocketRacer::defaultAttemptDelay()
+{
+    return bsls::TimeInterval(0, 250 * 1000 * 1000);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
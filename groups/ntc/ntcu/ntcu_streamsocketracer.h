@@ -0,0 +1,304 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCU_STREAMSOCKETRACER
+#define INCLUDED_NTCU_STREAMSOCKETRACER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntca_connectevent.h>
+#include <ntca_connectoptions.h>
+#include <ntca_getipaddressevent.h>
+#include <ntca_streamsocketoptions.h>
+#include <ntca_timerevent.h>
+#include <ntccfg_platform.h>
+#include <ntci_connector.h>
+#include <ntci_interface.h>
+#include <ntci_resolver.h>
+#include <ntci_streamsocket.h>
+#include <ntci_timer.h>
+#include <ntcscm_version.h>
+#include <ntsa_endpoint.h>
+#include <ntsa_error.h>
+#include <ntsa_ipaddress.h>
+#include <ntsa_port.h>
+#include <bslmt_mutex.h>
+#include <bsls_keyword.h>
+#include <bsls_timeinterval.h>
+#include <bsl_functional.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ntcu {
+
+/// @internal @brief
+/// Describe an attempt to connect a stream socket made by a racer.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntcu
+class StreamSocketRacerAttempt
+{
+    ntsa::Endpoint     d_endpoint;
+    bsls::TimeInterval d_delay;
+    bsls::TimeInterval d_latency;
+    ntsa::Error        d_error;
+    bool               d_started;
+    bool               d_complete;
+    bool               d_winner;
+
+  public:
+    /// Create a new attempt to connect to the specified 'endpoint'.
+    explicit StreamSocketRacerAttempt(const ntsa::Endpoint& endpoint);
+
+    /// Set the delay from the start of the race until this attempt was
+    /// started to the specified 'value'.
+    void setDelay(const bsls::TimeInterval& value);
+
+    /// Set the duration of this attempt to the specified 'value'.
+    void setLatency(const bsls::TimeInterval& value);
+
+    /// Set the error of this attempt to the specified 'value'.
+    void setError(const ntsa::Error& value);
+
+    /// Set the flag that indicates this attempt has started to the
+    /// specified 'value'.
+    void setStarted(bool value);
+
+    /// Set the flag that indicates this attempt has completed, either
+    /// successfully or in failure, to the specified 'value'.
+    void setComplete(bool value);
+
+    /// Set the flag that indicates this attempt won the race to the
+    /// specified 'value'.
+    void setWinner(bool value);
+
+    /// Return the endpoint to which the connection is attempted.
+    const ntsa::Endpoint& endpoint() const;
+
+    /// Return the delay from the start of the race until this attempt was
+    /// started.
+    const bsls::TimeInterval& delay() const;
+
+    /// Return the duration of this attempt, which is only meaningful if
+    /// the attempt is complete.
+    const bsls::TimeInterval& latency() const;
+
+    /// Return the error of this attempt. Attempts that are cancelled because
+    /// another attempt won the race have the error
+    /// 'ntsa::Error::e_CANCELLED'.
+    const ntsa::Error& error() const;
+
+    /// Return true if this attempt has started, otherwise return false.
+    bool started() const;
+
+    /// Return true if this attempt has completed, otherwise return false.
+    bool complete() const;
+
+    /// Return true if this attempt won the race, otherwise return false.
+    bool winner() const;
+};
+
+/// @internal @brief
+/// Provide a racing connection of stream sockets to the addresses of a
+/// domain name.
+///
+/// @details
+/// This class implements the "Happy Eyeballs" algorithm described in RFC
+/// 8305. The domain name is resolved to all of its IP addresses, which are
+/// interleaved by address family, starting with IPv6. A stream socket is
+/// created and connected to the first address, then, each time the attempt
+/// delay elapses without a connection being established, or immediately
+/// when the most recent attempt fails, another stream socket is created and
+/// connected to the next address, while the earlier attempts remain in
+/// progress. The first socket to connect wins the race: every other
+/// attempt is cancelled and its socket closed, and the callback is invoked
+/// with the winning socket.
+///
+/// Stream sockets connect to only one endpoint at a time, so the attempts
+/// made by this class are made by separate stream sockets created from an
+/// interface. On hosts with a broken IPv6 path, this establishes a
+/// connection over IPv4 after the attempt delay, rather than after the
+/// connection deadline.
+///
+/// The outcome of each attempt, including its delay from the start of the
+/// race and its latency, is reported to the callback so that it may be
+/// measured.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntcu
+class StreamSocketRacer : public ntccfg::Shared<StreamSocketRacer>
+{
+  public:
+    /// Define a type alias for a vector of attempts.
+    typedef bsl::vector<ntcu::StreamSocketRacerAttempt> AttemptVector;
+
+    /// Define a type alias for the function invoked when the race completes
+    /// with the winning stream socket, if any, the attempts made, and the
+    /// error.
+    typedef bsl::function<void(
+        const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+        const AttemptVector&                       attempts,
+        const ntsa::Error&                         error)>
+        Callback;
+
+  private:
+    /// Define a type alias for a vector of stream sockets, one for each
+    /// attempt.
+    typedef bsl::vector<bsl::shared_ptr<ntci::StreamSocket> >
+        StreamSocketVector;
+
+    /// Describe the completion of a race, which is announced after the mutex
+    /// is released.
+    struct Completion {
+        /// Create a new, empty completion. Optionally specify a
+        /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
+        /// the currently installed default allocator is used.
+        explicit Completion(bslma::Allocator* basicAllocator = 0);
+
+        Callback                            d_callback;
+        bsl::shared_ptr<ntci::StreamSocket> d_streamSocket;
+        StreamSocketVector                  d_closeList;
+        bsl::shared_ptr<ntci::Timer>        d_timer_sp;
+        AttemptVector                       d_attempts;
+        ntsa::Error                         d_error;
+    };
+
+    mutable bslmt::Mutex             d_mutex;
+    bsl::shared_ptr<ntci::Interface> d_interface_sp;
+    ntca::StreamSocketOptions        d_streamSocketOptions;
+    bsls::TimeInterval               d_attemptDelay;
+    ntsa::Port                       d_port;
+    ntca::ConnectOptions             d_connectOptions;
+    AttemptVector                    d_attempts;
+    StreamSocketVector               d_streamSockets;
+    bsl::size_t                      d_numStarted;
+    bsl::size_t                      d_numPending;
+    bsl::shared_ptr<ntci::Timer>     d_timer_sp;
+    bsls::TimeInterval               d_startTime;
+    bool                             d_inProgress;
+    Callback                         d_callback;
+    bslma::Allocator*                d_allocator_p;
+
+  private:
+    StreamSocketRacer(const StreamSocketRacer&) BSLS_KEYWORD_DELETED;
+    StreamSocketRacer& operator=(const StreamSocketRacer&)
+        BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Process the resolution of the domain name to the specified
+    /// 'ipAddressList' according to the specified 'event'.
+    void processIpAddress(const bsl::shared_ptr<ntci::Resolver>& resolver,
+                          const bsl::vector<ntsa::IpAddress>&    ipAddressList,
+                          const ntca::GetIpAddressEvent&         event);
+
+    /// Process the completion of the attempt at the specified 'index' by the
+    /// specified 'connector' according to the specified 'event'.
+    void processConnect(bsl::size_t                             index,
+                        const bsl::shared_ptr<ntci::Connector>& connector,
+                        const ntca::ConnectEvent&               event);
+
+    /// Process the expiration of the attempt delay as indicated by the
+    /// specified 'event' of the specified 'timer'.
+    void processTimer(const bsl::shared_ptr<ntci::Timer>& timer,
+                      const ntca::TimerEvent&             event);
+
+    /// Start the race to connect to each of the specified 'ipAddressList'.
+    /// Load into the specified 'completion' the completion of the race, if
+    /// the race completes immediately. The behavior is undefined unless
+    /// 'd_mutex' is locked.
+    void privateStart(Completion*                         completion,
+                      const bsl::vector<ntsa::IpAddress>& ipAddressList);
+
+    /// Start the next attempt, if any, then schedule the attempt after it.
+    /// Load into the specified 'completion' the completion of the race, if
+    /// the race completes. The behavior is undefined unless 'd_mutex' is
+    /// locked.
+    void privateStartNext(Completion* completion);
+
+    /// Complete the race won by the attempt at the specified 'winner' index,
+    /// or, if 'winner' is out of range, failed with the specified 'error'.
+    /// Load into the specified 'completion' the completion of the race. The
+    /// behavior is undefined unless 'd_mutex' is locked.
+    void privateComplete(Completion*        completion,
+                         bsl::size_t        winner,
+                         const ntsa::Error& error);
+
+    /// Close the timer and the sockets of the losing attempts described by
+    /// the specified 'completion', then invoke its callback, if any. The
+    /// behavior is undefined unless 'd_mutex' is unlocked.
+    static void announce(const Completion& completion);
+
+  public:
+    /// Create a new racer of stream sockets created by the specified
+    /// 'interface' according to the specified 'options' that
+    /// starts a new attempt each time the specified 'attemptDelay' elapses
+    /// without any attempt succeeding. Optionally specify a
+    /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0, the
+    /// currently installed default allocator is used.
+    StreamSocketRacer(const bsl::shared_ptr<ntci::Interface>& interface,
+                      const ntca::StreamSocketOptions&        options,
+                      const bsls::TimeInterval&               attemptDelay,
+                      bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~StreamSocketRacer();
+
+    /// Resolve the specified 'domainName' to its IP addresses and race to
+    /// connect to the specified 'port' at each address, according to the
+    /// specified 'options'. The 'options' retry count and retry interval
+    /// are ignored; the 'options' deadline, if any, applies to the whole
+    /// race. Invoke the specified 'callback' when the race completes.
+    /// Return the error.
+    ntsa::Error connect(const bsl::string&          domainName,
+                        ntsa::Port                  port,
+                        const ntca::ConnectOptions& options,
+                        const Callback&             callback);
+
+    /// Race to connect to the specified 'port' at each of the specified
+    /// 'ipAddressList', according to the specified 'options'. The 'options'
+    /// retry count and retry interval are ignored; the 'options' deadline,
+    /// if any, applies to the whole race. Invoke the specified 'callback'
+    /// when the race completes. Return the error.
+    ntsa::Error connect(const bsl::vector<ntsa::IpAddress>& ipAddressList,
+                        ntsa::Port                          port,
+                        const ntca::ConnectOptions&         options,
+                        const Callback&                     callback);
+
+    /// Cancel the race, if it is in progress. Close the socket of every
+    /// attempt and invoke the callback with the error
+    /// 'ntsa::Error::e_CANCELLED'.
+    void cancel();
+
+    /// Order the specified 'ipAddressList' for racing: interleave the
+    /// addresses by family, starting with IPv6 if any IPv6 address is
+    /// present, while preserving the relative order of the addresses of the
+    /// same family.
+    static void sortIpAddressList(bsl::vector<ntsa::IpAddress>* ipAddressList);
+
+    /// Return the default delay between the start of successive attempts,
+    /// as recommended by RFC 8305.
+    static bsls::TimeInterval defaultAttemptDelay();
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
@@ -0,0 +1,2679 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcu_streamsocketracer.h>
+
+#include <ntccfg_test.h>
+#include <ntca_connectcontext.h>
+#include <ntca_connectevent.h>
+#include <ntca_connectoptions.h>
+#include <ntca_timercontext.h>
+#include <ntca_timerevent.h>
+#include <ntca_timeroptions.h>
+#include <ntci_interface.h>
+#include <ntci_resolver.h>
+#include <ntci_streamsocket.h>
+#include <ntci_timer.h>
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bsls_assert.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The racer is tested against a mock interface that creates mock stream
+// sockets, whose connections are established or failed by the test, and
+// mock timers, which expire when the test advances a virtual clock. All
+// events are deferred until the test drains them.
+//-----------------------------------------------------------------------------
+
+// [ 1]
+//-----------------------------------------------------------------------------
+// [ 1] Sorting of IP addresses
+// [ 2] Attempt
+// [ 3] Staggered start after the attempt delay
+// [ 4] Immediate next attempt on failure
+// [ 5] First success wins
+// [ 6] Deadline
+// [ 7] All attempts fail
+// [ 8] Cancel
+//-----------------------------------------------------------------------------
+
+namespace test {
+
+/// The port to which connections are attempted.
+const ntsa::Port k_PORT = 12345;
+
+class Timer;
+
+/// This class implements a loop that defers the events announced by the
+/// mock sockets until the test drains it, and that drives a virtual clock
+/// which expires the mock timers when the test advances it.
+class Loop
+{
+    /// Define a type alias for a queue of deferred functions.
+    typedef bsl::vector<ntci::Executor::Functor> FunctorQueue;
+
+    /// Define a type alias for a vector of timers.
+    typedef bsl::vector<bsl::shared_ptr<test::Timer> > TimerVector;
+
+    mutable bslmt::Mutex d_mutex;
+    FunctorQueue         d_functorQueue;
+    TimerVector          d_timers;
+    bsls::TimeInterval   d_now;
+    bslma::Allocator*    d_allocator_p;
+
+  private:
+    Loop(const Loop&) BSLS_KEYWORD_DELETED;
+    Loop& operator=(const Loop&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new loop. Optionally specify a 'basicAllocator' used to
+    /// supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    explicit Loop(bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~Loop();
+
+    /// Defer the specified 'functor' until the loop is next drained.
+    void execute(const ntci::Executor::Functor& functor);
+
+    /// Invoke each deferred function, including those deferred while
+    /// draining, until no function is deferred.
+    void drain();
+
+    /// Register the specified 'timer' to be expired when its deadline is
+    /// reached by the virtual clock.
+    void registerTimer(const bsl::shared_ptr<test::Timer>& timer);
+
+    /// Advance the virtual clock by the specified 'interval', expire each
+    /// timer whose deadline is reached, then drain the loop.
+    void advance(const bsls::TimeInterval& interval);
+
+    /// Return the current time of the virtual clock.
+    bsls::TimeInterval now() const;
+
+    /// Return the number of timers registered.
+    bsl::size_t numTimers() const;
+
+    /// Return the number of timers registered that are scheduled.
+    bsl::size_t numScheduledTimers() const;
+
+    /// Return the timer at the specified 'index'.
+    bsl::shared_ptr<test::Timer> timer(bsl::size_t index) const;
+};
+
+/// This class mocks the ntci::Timer interface. The timer expires when the
+/// virtual clock of its loop reaches its deadline.
+class Timer : public ntci::Timer, public ntccfg::Shared<Timer>
+{
+    mutable bslmt::Mutex          d_mutex;
+    test::Loop*                   d_loop_p;
+    ntci::TimerCallback           d_callback;
+    bsls::TimeInterval            d_deadline;
+    bool                          d_scheduled;
+    bool                          d_closed;
+    bsl::shared_ptr<ntci::Strand> d_strand_sp;
+    bslma::Allocator*             d_allocator_p;
+
+  private:
+    Timer(const Timer&) BSLS_KEYWORD_DELETED;
+    Timer& operator=(const Timer&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new timer driven by the specified 'loop' that invokes the
+    /// specified 'callback' when it expires. Optionally specify a
+    /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
+    /// the currently installed default allocator is used.
+    Timer(test::Loop*                loop,
+          const ntci::TimerCallback& callback,
+          bslma::Allocator*          basicAllocator = 0);
+
+    /// Destroy this object.
+    ~Timer() BSLS_KEYWORD_OVERRIDE;
+
+    /// Announce the expiration of the timer if it is scheduled and its
+    /// deadline is at or before the specified 'now'.
+    void expire(const bsls::TimeInterval& now);
+
+    /// Return the deadline of the timer.
+    bsls::TimeInterval deadline() const;
+
+    /// Return true if the timer is scheduled, otherwise return false.
+    bool isScheduled() const;
+
+    /// Return true if the timer is closed, otherwise return false.
+    bool isClosed() const;
+
+    /// Schedule the timer to expire at the specified 'deadline'. The
+    /// specified 'period' must be zero. Return the error.
+    ntsa::Error schedule(const bsls::TimeInterval& deadline,
+                         const bsls::TimeInterval& period)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Cancel the timer. Return the error.
+    ntsa::Error cancel() BSLS_KEYWORD_OVERRIDE;
+
+    /// Close the timer and release its callback. Return the error.
+    ntsa::Error close() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the null strand.
+    const bsl::shared_ptr<ntci::Strand>& strand() const
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the current time of the virtual clock.
+    bsls::TimeInterval currentTime() const BSLS_KEYWORD_OVERRIDE;
+
+    // The following functions are assumed to be never called.
+
+    void arrive(const bsl::shared_ptr<ntci::Timer>&,
+                const bsls::TimeInterval&,
+                const bsls::TimeInterval&) BSLS_KEYWORD_OVERRIDE;
+    void* handle() const BSLS_KEYWORD_OVERRIDE;
+    int id() const BSLS_KEYWORD_OVERRIDE;
+    bool oneShot() const BSLS_KEYWORD_OVERRIDE;
+    bslmt::ThreadUtil::Handle threadHandle() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t threadIndex() const BSLS_KEYWORD_OVERRIDE;
+};
+
+/// This class mocks the ntci::StreamSocket interface. The test plays the
+/// role of the remote peer: it establishes or fails the connection
+/// attempted by the socket. The outcome is announced when the loop is
+/// drained, unless the socket is closed first.
+class StreamSocket : public ntci::StreamSocket,
+                     public ntccfg::Shared<StreamSocket>
+{
+    mutable bslmt::Mutex                      d_mutex;
+    test::Loop*                               d_loop_p;
+    ntsa::Endpoint                            d_endpoint;
+    ntca::ConnectOptions                      d_connectOptions;
+    ntci::ConnectCallback                     d_connectCallback;
+    bool                                      d_connecting;
+    bool                                      d_closed;
+    bsl::shared_ptr<ntci::Strand>             d_strand_sp;
+    bsl::shared_ptr<bdlbb::BlobBufferFactory> d_blobBufferFactory_sp;
+    bslma::Allocator*                         d_allocator_p;
+
+  private:
+    StreamSocket(const StreamSocket&) BSLS_KEYWORD_DELETED;
+    StreamSocket& operator=(const StreamSocket&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Announce the specified 'event' to the connect callback, unless the
+    /// socket is closed.
+    void announceConnect(const ntca::ConnectEvent& event);
+
+  public:
+    /// Create a new stream socket whose events are deferred to the
+    /// specified 'loop'. Optionally specify a 'basicAllocator' used to
+    /// supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    explicit StreamSocket(test::Loop*       loop,
+                          bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~StreamSocket() BSLS_KEYWORD_OVERRIDE;
+
+    /// Establish the connection, as if the remote peer accepted it.
+    void complete();
+
+    /// Fail the connection with the specified 'error'.
+    void fail(const ntsa::Error& error);
+
+    /// Return the endpoint to which the connection is attempted.
+    ntsa::Endpoint endpoint() const;
+
+    /// Return the options of the connection attempt.
+    ntca::ConnectOptions connectOptions() const;
+
+    /// Return true if the connection is attempted and its outcome has not
+    /// yet been determined, otherwise return false.
+    bool isConnecting() const;
+
+    /// Return true if the socket is closed, otherwise return false.
+    bool isClosed() const;
+
+    /// Attempt to connect to the specified 'endpoint' according to the
+    /// specified 'options'. Invoke the specified 'callback' when the test
+    /// determines the outcome. Return the error.
+    ntsa::Error connect(const ntsa::Endpoint&        endpoint,
+                        const ntca::ConnectOptions&  options,
+                        const ntci::ConnectCallback& callback)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Close the socket and release its connect callback.
+    void close() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the null strand.
+    const bsl::shared_ptr<ntci::Strand>& strand() const
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the current time of the virtual clock.
+    bsls::TimeInterval currentTime() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the null blob buffer factory.
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&
+    incomingBlobBufferFactory() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the null blob buffer factory.
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&
+    outgoingBlobBufferFactory() const BSLS_KEYWORD_OVERRIDE;
+
+    // The following functions are assumed to be never called.
+
+    ntsa::Handle handle() const BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(ntsa::Transport::Value) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(ntsa::Transport::Value,
+                     ntsa::Handle) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(
+        ntsa::Transport::Value,
+        const bsl::shared_ptr<ntsi::StreamSocket>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(
+        ntsa::Transport::Value,
+        ntsa::Handle,
+        const bsl::shared_ptr<ntci::ListenerSocket>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(
+        ntsa::Transport::Value,
+        const bsl::shared_ptr<ntsi::StreamSocket>&,
+        const bsl::shared_ptr<ntci::ListenerSocket>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const ntsa::Endpoint&,
+                     const ntca::BindOptions&,
+                     const ntci::BindFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const ntsa::Endpoint&,
+                     const ntca::BindOptions&,
+                     const ntci::BindCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const bsl::string&,
+                     const ntca::BindOptions&,
+                     const ntci::BindFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const bsl::string&,
+                     const ntca::BindOptions&,
+                     const ntci::BindCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error connect(const ntsa::Endpoint&,
+                        const ntca::ConnectOptions&,
+                        const ntci::ConnectFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error connect(const bsl::string&,
+                        const ntca::ConnectOptions&,
+                        const ntci::ConnectFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error connect(const bsl::string&,
+                        const ntca::ConnectOptions&,
+                        const ntci::ConnectCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::Encryption>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::Encryption>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::EncryptionClient>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::EncryptionClient>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::EncryptionServer>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::EncryptionServer>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const bdlbb::Blob&,
+                     const ntca::SendOptions&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const ntsa::Data&,
+                     const ntca::SendOptions&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const bdlbb::Blob&,
+                     const ntca::SendOptions&,
+                     const ntci::SendFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const bdlbb::Blob&,
+                     const ntca::SendOptions&,
+                     const ntci::SendCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const ntsa::Data&,
+                     const ntca::SendOptions&,
+                     const ntci::SendFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const ntsa::Data&,
+                     const ntca::SendOptions&,
+                     const ntci::SendCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error receive(ntca::ReceiveContext*,
+                        bdlbb::Blob*,
+                        const ntca::ReceiveOptions&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error receive(const ntca::ReceiveOptions&,
+                        const ntci::ReceiveFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error receive(const ntca::ReceiveOptions&,
+                        const ntci::ReceiveCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerResolver(
+        const bsl::shared_ptr<ntci::Resolver>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error deregisterResolver() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerManager(
+        const bsl::shared_ptr<ntci::StreamSocketManager>&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error deregisterManager() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerSession(
+        const bsl::shared_ptr<ntci::StreamSocketSession>&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerSessionCallback(
+        const ntci::StreamSocket::SessionCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerSessionCallback(
+        const ntci::StreamSocket::SessionCallback&,
+        const bsl::shared_ptr<ntci::Strand>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error deregisterSession() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setWriteRateLimiter(
+        const bsl::shared_ptr<ntci::RateLimiter>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setWriteQueueLowWatermark(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setWriteQueueHighWatermark(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setWriteQueueWatermarks(bsl::size_t,
+                                        bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setReadRateLimiter(
+        const bsl::shared_ptr<ntci::RateLimiter>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setReadQueueLowWatermark(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setReadQueueHighWatermark(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setReadQueueWatermarks(bsl::size_t,
+                                       bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error relaxFlowControl(
+        ntca::FlowControlType::Value) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error applyFlowControl(
+        ntca::FlowControlType::Value,
+        ntca::FlowControlMode::Value) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::BindToken&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::ConnectToken&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::UpgradeToken&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::SendToken&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::ReceiveToken&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error downgrade() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error shutdown(ntsa::ShutdownType::Value,
+                         ntsa::ShutdownMode::Value) BSLS_KEYWORD_OVERRIDE;
+    void close(const ntci::CloseFunction&) BSLS_KEYWORD_OVERRIDE;
+    void close(const ntci::CloseCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Transport::Value transport() const BSLS_KEYWORD_OVERRIDE;
+    ntsa::Endpoint sourceEndpoint() const BSLS_KEYWORD_OVERRIDE;
+    ntsa::Endpoint remoteEndpoint() const BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::EncryptionCertificate> sourceCertificate() const
+        BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::EncryptionCertificate> remoteCertificate() const
+        BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::EncryptionKey> privateKey() const
+        BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::ListenerSocket> acceptor() const
+        BSLS_KEYWORD_OVERRIDE;
+    bslmt::ThreadUtil::Handle threadHandle() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t threadIndex() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t readQueueSize() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t readQueueLowWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t readQueueHighWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t writeQueueSize() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t writeQueueLowWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t writeQueueHighWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t totalBytesSent() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t totalBytesReceived() const BSLS_KEYWORD_OVERRIDE;
+    void execute(const Functor&) BSLS_KEYWORD_OVERRIDE;
+    void moveAndExecute(FunctorSequence*,
+                        const Functor&) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Strand> createStrand(
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&,
+        const bsl::shared_ptr<ntci::TimerSession>&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&,
+        const ntci::TimerCallback&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsls::TimeInterval currentTime() const BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntsa::Data> createIncomingData() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntsa::Data> createOutgoingData() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<bdlbb::Blob> createIncomingBlob() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<bdlbb::Blob> createOutgoingBlob() BSLS_KEYWORD_OVERRIDE;
+    void createIncomingBlobBuffer(bdlbb::BlobBuffer*) BSLS_KEYWORD_OVERRIDE;
+    void createOutgoingBlobBuffer(bdlbb::BlobBuffer*) BSLS_KEYWORD_OVERRIDE;
+};
+
+/// This class mocks the ntci::Interface interface. It creates mock stream
+/// sockets and mock timers driven by a loop, and retains each stream
+/// socket it creates so that the test may play the role of its remote
+/// peer.
+class Interface : public ntci::Interface, public ntccfg::Shared<Interface>
+{
+    /// Define a type alias for a vector of stream sockets.
+    typedef bsl::vector<bsl::shared_ptr<test::StreamSocket> >
+        StreamSocketVector;
+
+    mutable bslmt::Mutex                      d_mutex;
+    test::Loop*                               d_loop_p;
+    StreamSocketVector                        d_streamSockets;
+    bsl::shared_ptr<ntci::Resolver>           d_resolver_sp;
+    bsl::shared_ptr<bdlbb::BlobBufferFactory> d_blobBufferFactory_sp;
+    bsl::shared_ptr<ntci::Strand>             d_strand_sp;
+    bslma::Allocator*                         d_allocator_p;
+
+  private:
+    Interface(const Interface&) BSLS_KEYWORD_DELETED;
+    Interface& operator=(const Interface&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new interface whose sockets and timers are driven by the
+    /// specified 'loop'. Optionally specify a 'basicAllocator' used to
+    /// supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    explicit Interface(test::Loop*       loop,
+                       bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~Interface() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the number of stream sockets created.
+    bsl::size_t numStreamSockets() const;
+
+    /// Return the stream socket created at the specified 'index'.
+    bsl::shared_ptr<test::StreamSocket> streamSocket(bsl::size_t index) const;
+
+    /// Return a new stream socket. The specified 'options' are ignored.
+    bsl::shared_ptr<ntci::StreamSocket> createStreamSocket(
+        const ntca::StreamSocketOptions& options,
+        bslma::Allocator*                basicAllocator)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return a new one-shot timer that invokes the specified 'callback'
+    /// when it expires. The specified 'options' must be one-shot.
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&  options,
+        const ntci::TimerCallback& callback,
+        bslma::Allocator*          basicAllocator) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the null resolver.
+    const bsl::shared_ptr<ntci::Resolver>& resolver() const
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the null blob buffer factory.
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&
+    incomingBlobBufferFactory() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the null blob buffer factory.
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&
+    outgoingBlobBufferFactory() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the null strand.
+    const bsl::shared_ptr<ntci::Strand>& strand() const
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the current time of the virtual clock.
+    bsls::TimeInterval currentTime() const BSLS_KEYWORD_OVERRIDE;
+
+    // The following functions are assumed to be never called.
+
+    ntsa::Error start() BSLS_KEYWORD_OVERRIDE;
+    void shutdown() BSLS_KEYWORD_OVERRIDE;
+    void linger() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error closeAll() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::DatagramSocket> createDatagramSocket(
+        const ntca::DatagramSocketOptions&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::ListenerSocket> createListenerSocket(
+        const ntca::ListenerSocketOptions&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&,
+        const bsl::shared_ptr<ntci::TimerSession>&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Strand> createStrand(
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntsa::Data> createIncomingData() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntsa::Data> createOutgoingData() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<bdlbb::Blob> createIncomingBlob() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<bdlbb::Blob> createOutgoingBlob() BSLS_KEYWORD_OVERRIDE;
+    void createIncomingBlobBuffer(bdlbb::BlobBuffer*) BSLS_KEYWORD_OVERRIDE;
+    void createOutgoingBlobBuffer(bdlbb::BlobBuffer*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::RateLimiter> createRateLimiter(
+        const ntca::RateLimiterConfig&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error createEncryptionClient(
+        bsl::shared_ptr<ntci::EncryptionClient>*,
+        const ntca::EncryptionClientOptions&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error createEncryptionClient(
+        bsl::shared_ptr<ntci::EncryptionClient>*,
+        const ntca::EncryptionClientOptions&,
+        const bsl::shared_ptr<bdlbb::BlobBufferFactory>&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error createEncryptionClient(
+        bsl::shared_ptr<ntci::EncryptionClient>*,
+        const ntca::EncryptionClientOptions&,
+        const bsl::shared_ptr<ntci::DataPool>&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error createEncryptionServer(
+        bsl::shared_ptr<ntci::EncryptionServer>*,
+        const ntca::EncryptionServerOptions&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error createEncryptionServer(
+        bsl::shared_ptr<ntci::EncryptionServer>*,
+        const ntca::EncryptionServerOptions&,
+        const bsl::shared_ptr<bdlbb::BlobBufferFactory>&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error createEncryptionServer(
+        bsl::shared_ptr<ntci::EncryptionServer>*,
+        const ntca::EncryptionServerOptions&,
+        const bsl::shared_ptr<ntci::DataPool>&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    void execute(const Functor&) BSLS_KEYWORD_OVERRIDE;
+    void moveAndExecute(FunctorSequence*,
+                        const Functor&) BSLS_KEYWORD_OVERRIDE;
+    bool lookupByThreadHandle(
+        bsl::shared_ptr<ntci::Executor>*,
+        bslmt::ThreadUtil::Handle) const BSLS_KEYWORD_OVERRIDE;
+    bool lookupByThreadIndex(bsl::shared_ptr<ntci::Executor>*,
+                             bsl::size_t) const BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error generateCertificate(
+        bsl::shared_ptr<ntci::EncryptionCertificate>*,
+        const ntsa::DistinguishedName&,
+        const bsl::shared_ptr<ntci::EncryptionKey>&,
+        const ntca::EncryptionCertificateOptions&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error generateCertificate(
+        bsl::shared_ptr<ntci::EncryptionCertificate>*,
+        const ntsa::DistinguishedName&,
+        const bsl::shared_ptr<ntci::EncryptionKey>&,
+        const bsl::shared_ptr<ntci::EncryptionCertificate>&,
+        const bsl::shared_ptr<ntci::EncryptionKey>&,
+        const ntca::EncryptionCertificateOptions&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error loadCertificate(bsl::shared_ptr<ntci::EncryptionCertificate>*,
+                                const bsl::string&,
+                                bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error encodeCertificate(
+        bsl::streambuf*,
+        const bsl::shared_ptr<ntci::EncryptionCertificate>&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error encodeCertificate(
+        bdlbb::Blob*,
+        const bsl::shared_ptr<ntci::EncryptionCertificate>&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error encodeCertificate(
+        bsl::string*,
+        const bsl::shared_ptr<ntci::EncryptionCertificate>&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error encodeCertificate(
+        bsl::vector<char>*,
+        const bsl::shared_ptr<ntci::EncryptionCertificate>&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error decodeCertificate(
+        bsl::shared_ptr<ntci::EncryptionCertificate>*,
+        bsl::streambuf*,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error decodeCertificate(
+        bsl::shared_ptr<ntci::EncryptionCertificate>*,
+        const bdlbb::Blob&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error decodeCertificate(
+        bsl::shared_ptr<ntci::EncryptionCertificate>*,
+        const bsl::string&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error decodeCertificate(
+        bsl::shared_ptr<ntci::EncryptionCertificate>*,
+        const bsl::vector<char>&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error generateKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                            const ntca::EncryptionKeyOptions&,
+                            bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error loadKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                        const bsl::string&,
+                        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error encodeKey(
+        bsl::streambuf*,
+        const bsl::shared_ptr<ntci::EncryptionKey>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error encodeKey(
+        bdlbb::Blob*,
+        const bsl::shared_ptr<ntci::EncryptionKey>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error encodeKey(
+        bsl::string*,
+        const bsl::shared_ptr<ntci::EncryptionKey>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error encodeKey(
+        bsl::vector<char>*,
+        const bsl::shared_ptr<ntci::EncryptionKey>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error decodeKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                          bsl::streambuf*,
+                          bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error decodeKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                          const bdlbb::Blob&,
+                          bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error decodeKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                          const bsl::string&,
+                          bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error decodeKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                          const bsl::vector<char>&,
+                          bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+};
+
+/// Describe the completion of a race.
+struct Result {
+    /// Create a new, incomplete result. Optionally specify a
+    /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
+    /// the currently installed default allocator is used.
+    explicit Result(bslma::Allocator* basicAllocator = 0);
+
+    bsl::size_t                            d_numCompletions;
+    bsl::shared_ptr<ntci::StreamSocket>    d_streamSocket;
+    ntcu::StreamSocketRacer::AttemptVector d_attempts;
+    ntsa::Error                            d_error;
+};
+
+/// Record into the specified 'result' the specified 'streamSocket',
+/// 'attempts', and 'error' of a completed race.
+void processComplete(
+    test::Result*                                 result,
+    const bsl::shared_ptr<ntci::StreamSocket>&    streamSocket,
+    const ntcu::StreamSocketRacer::AttemptVector& attempts,
+    const ntsa::Error&                            error);
+
+/// Return a callback that records the completion of a race into the
+/// specified 'result'.
+ntcu::StreamSocketRacer::Callback createCallback(test::Result* result);
+
+/// Return the endpoint at the specified 'ipAddress' and 'k_PORT'.
+ntsa::Endpoint createEndpoint(const char* ipAddress);
+
+Loop::Loop(bslma::Allocator* basicAllocator)
+: d_mutex()
+, d_functorQueue(basicAllocator)
+, d_timers(basicAllocator)
+, d_now(1000)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+Loop::~Loop()
+{
+    NTCCFG_TEST_TRUE(d_functorQueue.empty());
+}
+
+void Loop::execute(const ntci::Executor::Functor& functor)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_functorQueue.push_back(functor);
+}
+
+void Loop::drain()
+{
+    while (true) {
+        FunctorQueue functorQueue(d_allocator_p);
+        {
+            bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+            functorQueue.swap(d_functorQueue);
+        }
+
+        if (functorQueue.empty()) {
+            break;
+        }
+
+        for (FunctorQueue::iterator it = functorQueue.begin();
+             it != functorQueue.end();
+             ++it)
+        {
+            (*it)();
+        }
+    }
+}
+
+void Loop::registerTimer(const bsl::shared_ptr<test::Timer>& timer)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_timers.push_back(timer);
+}
+
+void Loop::advance(const bsls::TimeInterval& interval)
+{
+    TimerVector        timers(d_allocator_p);
+    bsls::TimeInterval now;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        d_now += interval;
+        now    = d_now;
+        timers = d_timers;
+    }
+
+    for (TimerVector::iterator it = timers.begin(); it != timers.end(); ++it)
+    {
+        (*it)->expire(now);
+    }
+
+    this->drain();
+}
+
+bsls::TimeInterval Loop::now() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_now;
+}
+
+bsl::size_t Loop::numTimers() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_timers.size();
+}
+
+bsl::size_t Loop::numScheduledTimers() const
+{
+    TimerVector timers(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        timers = d_timers;
+    }
+
+    bsl::size_t result = 0;
+    for (TimerVector::const_iterator it = timers.begin();
+         it != timers.end();
+         ++it)
+    {
+        if ((*it)->isScheduled()) {
+            ++result;
+        }
+    }
+
+    return result;
+}
+
+bsl::shared_ptr<test::Timer> Loop::timer(bsl::size_t index) const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    BSLS_ASSERT(index < d_timers.size());
+    return d_timers[index];
+}
+
+Timer::Timer(test::Loop*                loop,
+             const ntci::TimerCallback& callback,
+             bslma::Allocator*          basicAllocator)
+: d_mutex()
+, d_loop_p(loop)
+, d_callback(callback, basicAllocator)
+, d_deadline()
+, d_scheduled(false)
+, d_closed(false)
+, d_strand_sp()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+Timer::~Timer()
+{
+}
+
+void Timer::expire(const bsls::TimeInterval& now)
+{
+    ntci::TimerCallback callback(d_allocator_p);
+    bsls::TimeInterval  deadline;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (!d_scheduled || d_closed || now < d_deadline) {
+            return;
+        }
+
+        d_scheduled = false;
+        deadline    = d_deadline;
+        callback    = d_callback;
+    }
+
+    ntca::TimerContext context;
+    context.setNow(now);
+    context.setDeadline(deadline);
+
+    ntca::TimerEvent event;
+    event.setType(ntca::TimerEventType::e_DEADLINE);
+    event.setContext(context);
+
+    callback(this->getSelf(this), event, ntci::Strand::unknown());
+}
+
+bsls::TimeInterval Timer::deadline() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_deadline;
+}
+
+bool Timer::isScheduled() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_scheduled;
+}
+
+bool Timer::isClosed() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_closed;
+}
+
+ntsa::Error Timer::schedule(const bsls::TimeInterval& deadline,
+                            const bsls::TimeInterval& period)
+{
+    NTCCFG_TEST_EQ(period, bsls::TimeInterval());
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (d_closed) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    d_deadline  = deadline;
+    d_scheduled = true;
+
+    return ntsa::Error();
+}
+
+ntsa::Error Timer::cancel()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    d_scheduled = false;
+
+    return ntsa::Error();
+}
+
+ntsa::Error Timer::close()
+{
+    ntci::TimerCallback callback(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        d_scheduled = false;
+        d_closed    = true;
+
+        callback.swap(d_callback);
+    }
+
+    return ntsa::Error();
+}
+
+const bsl::shared_ptr<ntci::Strand>& Timer::strand() const
+{
+    return d_strand_sp;
+}
+
+bsls::TimeInterval Timer::currentTime() const
+{
+    return d_loop_p->now();
+}
+
+void Timer::arrive(const bsl::shared_ptr<ntci::Timer>&,
+                   const bsls::TimeInterval&,
+                   const bsls::TimeInterval&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void* Timer::handle() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+int Timer::id() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bool Timer::oneShot() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return false;
+}
+
+bslmt::ThreadUtil::Handle Timer::threadHandle() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bslmt::ThreadUtil::invalidHandle();
+}
+
+bsl::size_t Timer::threadIndex() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+void StreamSocket::announceConnect(const ntca::ConnectEvent& event)
+{
+    ntci::ConnectCallback callback(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (d_closed) {
+            return;
+        }
+
+        callback.swap(d_connectCallback);
+    }
+
+    if (callback) {
+        callback(this->getSelf(this), event, ntci::Strand::unknown());
+    }
+}
+
+StreamSocket::StreamSocket(test::Loop* loop, bslma::Allocator* basicAllocator)
+: d_mutex()
+, d_loop_p(loop)
+, d_endpoint()
+, d_connectOptions()
+, d_connectCallback(basicAllocator)
+, d_connecting(false)
+, d_closed(false)
+, d_strand_sp()
+, d_blobBufferFactory_sp()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+StreamSocket::~StreamSocket()
+{
+}
+
+void StreamSocket::complete()
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        NTCCFG_TEST_TRUE(d_connecting);
+        d_connecting = false;
+    }
+
+    ntca::ConnectEvent event;
+    event.setType(ntca::ConnectEventType::e_COMPLETE);
+
+    d_loop_p->execute(bdlf::BindUtil::bind(&StreamSocket::announceConnect,
+                                           this->getSelf(this),
+                                           event));
+}
+
+void StreamSocket::fail(const ntsa::Error& error)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        NTCCFG_TEST_TRUE(d_connecting);
+        d_connecting = false;
+    }
+
+    ntca::ConnectContext context;
+    context.setError(error);
+
+    ntca::ConnectEvent event;
+    event.setType(ntca::ConnectEventType::e_ERROR);
+    event.setContext(context);
+
+    d_loop_p->execute(bdlf::BindUtil::bind(&StreamSocket::announceConnect,
+                                           this->getSelf(this),
+                                           event));
+}
+
+ntsa::Endpoint StreamSocket::endpoint() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_endpoint;
+}
+
+ntca::ConnectOptions StreamSocket::connectOptions() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_connectOptions;
+}
+
+bool StreamSocket::isConnecting() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_connecting;
+}
+
+bool StreamSocket::isClosed() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_closed;
+}
+
+ntsa::Error StreamSocket::connect(const ntsa::Endpoint&        endpoint,
+                                  const ntca::ConnectOptions&  options,
+                                  const ntci::ConnectCallback& callback)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (d_closed || d_connecting || d_connectCallback) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    d_endpoint        = endpoint;
+    d_connectOptions  = options;
+    d_connectCallback = callback;
+    d_connecting      = true;
+
+    return ntsa::Error();
+}
+
+void StreamSocket::close()
+{
+    ntci::ConnectCallback callback(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        d_closed     = true;
+        d_connecting = false;
+
+        callback.swap(d_connectCallback);
+    }
+}
+
+const bsl::shared_ptr<ntci::Strand>& StreamSocket::strand() const
+{
+    return d_strand_sp;
+}
+
+bsls::TimeInterval StreamSocket::currentTime() const
+{
+    return d_loop_p->now();
+}
+
+const bsl::shared_ptr<bdlbb::BlobBufferFactory>& StreamSocket::
+    incomingBlobBufferFactory() const
+{
+    return d_blobBufferFactory_sp;
+}
+
+const bsl::shared_ptr<bdlbb::BlobBufferFactory>& StreamSocket::
+    outgoingBlobBufferFactory() const
+{
+    return d_blobBufferFactory_sp;
+}
+
+ntsa::Handle StreamSocket::handle() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::k_INVALID_HANDLE;
+}
+
+ntsa::Error StreamSocket::open()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::open(ntsa::Transport::Value)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::open(ntsa::Transport::Value, ntsa::Handle)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::open(ntsa::Transport::Value,
+                               const bsl::shared_ptr<ntsi::StreamSocket>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::open(ntsa::Transport::Value,
+                               ntsa::Handle,
+                               const bsl::shared_ptr<ntci::ListenerSocket>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::open(ntsa::Transport::Value,
+                               const bsl::shared_ptr<ntsi::StreamSocket>&,
+                               const bsl::shared_ptr<ntci::ListenerSocket>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::bind(const ntsa::Endpoint&,
+                               const ntca::BindOptions&,
+                               const ntci::BindFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::bind(const ntsa::Endpoint&,
+                               const ntca::BindOptions&,
+                               const ntci::BindCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::bind(const bsl::string&,
+                               const ntca::BindOptions&,
+                               const ntci::BindFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::bind(const bsl::string&,
+                               const ntca::BindOptions&,
+                               const ntci::BindCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::connect(const ntsa::Endpoint&,
+                                  const ntca::ConnectOptions&,
+                                  const ntci::ConnectFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::connect(const bsl::string&,
+                                  const ntca::ConnectOptions&,
+                                  const ntci::ConnectFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::connect(const bsl::string&,
+                                  const ntca::ConnectOptions&,
+                                  const ntci::ConnectCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(const bsl::shared_ptr<ntci::Encryption>&,
+                                  const ntca::UpgradeOptions&,
+                                  const ntci::UpgradeFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(const bsl::shared_ptr<ntci::Encryption>&,
+                                  const ntca::UpgradeOptions&,
+                                  const ntci::UpgradeCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(
+    const bsl::shared_ptr<ntci::EncryptionClient>&,
+    const ntca::UpgradeOptions&,
+    const ntci::UpgradeFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(
+    const bsl::shared_ptr<ntci::EncryptionClient>&,
+    const ntca::UpgradeOptions&,
+    const ntci::UpgradeCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(
+    const bsl::shared_ptr<ntci::EncryptionServer>&,
+    const ntca::UpgradeOptions&,
+    const ntci::UpgradeFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(
+    const bsl::shared_ptr<ntci::EncryptionServer>&,
+    const ntca::UpgradeOptions&,
+    const ntci::UpgradeCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::send(const bdlbb::Blob&, const ntca::SendOptions&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::send(const ntsa::Data&, const ntca::SendOptions&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::send(const bdlbb::Blob&,
+                               const ntca::SendOptions&,
+                               const ntci::SendFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::send(const bdlbb::Blob&,
+                               const ntca::SendOptions&,
+                               const ntci::SendCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::send(const ntsa::Data&,
+                               const ntca::SendOptions&,
+                               const ntci::SendFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::send(const ntsa::Data&,
+                               const ntca::SendOptions&,
+                               const ntci::SendCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::receive(ntca::ReceiveContext*,
+                                  bdlbb::Blob*,
+                                  const ntca::ReceiveOptions&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::receive(const ntca::ReceiveOptions&,
+                                  const ntci::ReceiveFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::receive(const ntca::ReceiveOptions&,
+                                  const ntci::ReceiveCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::registerResolver(
+    const bsl::shared_ptr<ntci::Resolver>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::deregisterResolver()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::registerManager(
+    const bsl::shared_ptr<ntci::StreamSocketManager>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::deregisterManager()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::registerSession(
+    const bsl::shared_ptr<ntci::StreamSocketSession>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::registerSessionCallback(
+    const ntci::StreamSocket::SessionCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::registerSessionCallback(
+    const ntci::StreamSocket::SessionCallback&,
+    const bsl::shared_ptr<ntci::Strand>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::deregisterSession()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setWriteRateLimiter(
+    const bsl::shared_ptr<ntci::RateLimiter>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setWriteQueueLowWatermark(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setWriteQueueHighWatermark(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setWriteQueueWatermarks(bsl::size_t, bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setReadRateLimiter(
+    const bsl::shared_ptr<ntci::RateLimiter>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setReadQueueLowWatermark(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setReadQueueHighWatermark(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setReadQueueWatermarks(bsl::size_t, bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::relaxFlowControl(ntca::FlowControlType::Value)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::applyFlowControl(ntca::FlowControlType::Value,
+                                           ntca::FlowControlMode::Value)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::cancel(const ntca::BindToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::cancel(const ntca::ConnectToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::cancel(const ntca::UpgradeToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::cancel(const ntca::SendToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::cancel(const ntca::ReceiveToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::downgrade()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::shutdown(ntsa::ShutdownType::Value,
+                                   ntsa::ShutdownMode::Value)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+void StreamSocket::close(const ntci::CloseFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void StreamSocket::close(const ntci::CloseCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+ntsa::Transport::Value StreamSocket::transport() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Transport::e_UNDEFINED;
+}
+
+ntsa::Endpoint StreamSocket::sourceEndpoint() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Endpoint();
+}
+
+ntsa::Endpoint StreamSocket::remoteEndpoint() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Endpoint();
+}
+
+bsl::shared_ptr<ntci::EncryptionCertificate> StreamSocket::
+    sourceCertificate() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::EncryptionCertificate>();
+}
+
+bsl::shared_ptr<ntci::EncryptionCertificate> StreamSocket::
+    remoteCertificate() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::EncryptionCertificate>();
+}
+
+bsl::shared_ptr<ntci::EncryptionKey> StreamSocket::privateKey() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::EncryptionKey>();
+}
+
+bsl::shared_ptr<ntci::ListenerSocket> StreamSocket::acceptor() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::ListenerSocket>();
+}
+
+bslmt::ThreadUtil::Handle StreamSocket::threadHandle() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bslmt::ThreadUtil::invalidHandle();
+}
+
+bsl::size_t StreamSocket::threadIndex() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::readQueueSize() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::readQueueLowWatermark() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::readQueueHighWatermark() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::writeQueueSize() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::writeQueueLowWatermark() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::writeQueueHighWatermark() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::totalBytesSent() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::totalBytesReceived() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+void StreamSocket::execute(const Functor&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void StreamSocket::moveAndExecute(FunctorSequence*, const Functor&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+bsl::shared_ptr<ntci::Strand> StreamSocket::createStrand(bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Strand>();
+}
+
+bsl::shared_ptr<ntci::Timer> StreamSocket::createTimer(
+    const ntca::TimerOptions&,
+    const bsl::shared_ptr<ntci::TimerSession>&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Timer>();
+}
+
+bsl::shared_ptr<ntci::Timer> StreamSocket::createTimer(
+    const ntca::TimerOptions&,
+    const ntci::TimerCallback&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Timer>();
+}
+
+bsls::TimeInterval StreamSocket::currentTime() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsls::TimeInterval();
+}
+
+bsl::shared_ptr<ntsa::Data> StreamSocket::createIncomingData()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntsa::Data>();
+}
+
+bsl::shared_ptr<ntsa::Data> StreamSocket::createOutgoingData()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntsa::Data>();
+}
+
+bsl::shared_ptr<bdlbb::Blob> StreamSocket::createIncomingBlob()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<bdlbb::Blob>();
+}
+
+bsl::shared_ptr<bdlbb::Blob> StreamSocket::createOutgoingBlob()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<bdlbb::Blob>();
+}
+
+void StreamSocket::createIncomingBlobBuffer(bdlbb::BlobBuffer*)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void StreamSocket::createOutgoingBlobBuffer(bdlbb::BlobBuffer*)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+Interface::Interface(test::Loop* loop, bslma::Allocator* basicAllocator)
+: d_mutex()
+, d_loop_p(loop)
+, d_streamSockets(basicAllocator)
+, d_resolver_sp()
+, d_blobBufferFactory_sp()
+, d_strand_sp()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+Interface::~Interface()
+{
+}
+
+bsl::size_t Interface::numStreamSockets() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_streamSockets.size();
+}
+
+bsl::shared_ptr<test::StreamSocket> Interface::streamSocket(
+    bsl::size_t index) const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    BSLS_ASSERT(index < d_streamSockets.size());
+    return d_streamSockets[index];
+}
+
+bsl::shared_ptr<ntci::StreamSocket> Interface::createStreamSocket(
+    const ntca::StreamSocketOptions& options,
+    bslma::Allocator*                basicAllocator)
+{
+    NTCCFG_WARNING_UNUSED(options);
+
+    bslma::Allocator* allocator = bslma::Default::allocator(basicAllocator);
+
+    bsl::shared_ptr<test::StreamSocket> streamSocket;
+    streamSocket.createInplace(allocator, d_loop_p, allocator);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_streamSockets.push_back(streamSocket);
+
+    return streamSocket;
+}
+
+bsl::shared_ptr<ntci::Timer> Interface::createTimer(
+    const ntca::TimerOptions&  options,
+    const ntci::TimerCallback& callback,
+    bslma::Allocator*          basicAllocator)
+{
+    NTCCFG_TEST_TRUE(options.oneShot());
+
+    bslma::Allocator* allocator = bslma::Default::allocator(basicAllocator);
+
+    bsl::shared_ptr<test::Timer> timer;
+    timer.createInplace(allocator, d_loop_p, callback, allocator);
+
+    d_loop_p->registerTimer(timer);
+
+    return timer;
+}
+
+const bsl::shared_ptr<ntci::Resolver>& Interface::resolver() const
+{
+    return d_resolver_sp;
+}
+
+const bsl::shared_ptr<bdlbb::BlobBufferFactory>& Interface::
+    incomingBlobBufferFactory() const
+{
+    return d_blobBufferFactory_sp;
+}
+
+const bsl::shared_ptr<bdlbb::BlobBufferFactory>& Interface::
+    outgoingBlobBufferFactory() const
+{
+    return d_blobBufferFactory_sp;
+}
+
+const bsl::shared_ptr<ntci::Strand>& Interface::strand() const
+{
+    return d_strand_sp;
+}
+
+bsls::TimeInterval Interface::currentTime() const
+{
+    return d_loop_p->now();
+}
+
+ntsa::Error Interface::start()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+void Interface::shutdown()
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void Interface::linger()
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+ntsa::Error Interface::closeAll()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+bsl::shared_ptr<ntci::DatagramSocket> Interface::createDatagramSocket(
+    const ntca::DatagramSocketOptions&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::DatagramSocket>();
+}
+
+bsl::shared_ptr<ntci::ListenerSocket> Interface::createListenerSocket(
+    const ntca::ListenerSocketOptions&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::ListenerSocket>();
+}
+
+bsl::shared_ptr<ntci::Timer> Interface::createTimer(
+    const ntca::TimerOptions&,
+    const bsl::shared_ptr<ntci::TimerSession>&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Timer>();
+}
+
+bsl::shared_ptr<ntci::Strand> Interface::createStrand(bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Strand>();
+}
+
+bsl::shared_ptr<ntsa::Data> Interface::createIncomingData()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntsa::Data>();
+}
+
+bsl::shared_ptr<ntsa::Data> Interface::createOutgoingData()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntsa::Data>();
+}
+
+bsl::shared_ptr<bdlbb::Blob> Interface::createIncomingBlob()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<bdlbb::Blob>();
+}
+
+bsl::shared_ptr<bdlbb::Blob> Interface::createOutgoingBlob()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<bdlbb::Blob>();
+}
+
+void Interface::createIncomingBlobBuffer(bdlbb::BlobBuffer*)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void Interface::createOutgoingBlobBuffer(bdlbb::BlobBuffer*)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+bsl::shared_ptr<ntci::RateLimiter> Interface::createRateLimiter(
+    const ntca::RateLimiterConfig&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::RateLimiter>();
+}
+
+ntsa::Error Interface::createEncryptionClient(
+    bsl::shared_ptr<ntci::EncryptionClient>*,
+    const ntca::EncryptionClientOptions&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::createEncryptionClient(
+    bsl::shared_ptr<ntci::EncryptionClient>*,
+    const ntca::EncryptionClientOptions&,
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::createEncryptionClient(
+    bsl::shared_ptr<ntci::EncryptionClient>*,
+    const ntca::EncryptionClientOptions&,
+    const bsl::shared_ptr<ntci::DataPool>&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::createEncryptionServer(
+    bsl::shared_ptr<ntci::EncryptionServer>*,
+    const ntca::EncryptionServerOptions&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::createEncryptionServer(
+    bsl::shared_ptr<ntci::EncryptionServer>*,
+    const ntca::EncryptionServerOptions&,
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::createEncryptionServer(
+    bsl::shared_ptr<ntci::EncryptionServer>*,
+    const ntca::EncryptionServerOptions&,
+    const bsl::shared_ptr<ntci::DataPool>&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+void Interface::execute(const Functor&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void Interface::moveAndExecute(FunctorSequence*, const Functor&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+bool Interface::lookupByThreadHandle(bsl::shared_ptr<ntci::Executor>*,
+                                     bslmt::ThreadUtil::Handle) const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return false;
+}
+
+bool Interface::lookupByThreadIndex(bsl::shared_ptr<ntci::Executor>*,
+                                    bsl::size_t) const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return false;
+}
+
+ntsa::Error Interface::generateCertificate(
+    bsl::shared_ptr<ntci::EncryptionCertificate>*,
+    const ntsa::DistinguishedName&,
+    const bsl::shared_ptr<ntci::EncryptionKey>&,
+    const ntca::EncryptionCertificateOptions&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::generateCertificate(
+    bsl::shared_ptr<ntci::EncryptionCertificate>*,
+    const ntsa::DistinguishedName&,
+    const bsl::shared_ptr<ntci::EncryptionKey>&,
+    const bsl::shared_ptr<ntci::EncryptionCertificate>&,
+    const bsl::shared_ptr<ntci::EncryptionKey>&,
+    const ntca::EncryptionCertificateOptions&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::loadCertificate(
+    bsl::shared_ptr<ntci::EncryptionCertificate>*,
+    const bsl::string&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::encodeCertificate(
+    bsl::streambuf*,
+    const bsl::shared_ptr<ntci::EncryptionCertificate>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::encodeCertificate(
+    bdlbb::Blob*,
+    const bsl::shared_ptr<ntci::EncryptionCertificate>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::encodeCertificate(
+    bsl::string*,
+    const bsl::shared_ptr<ntci::EncryptionCertificate>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::encodeCertificate(
+    bsl::vector<char>*,
+    const bsl::shared_ptr<ntci::EncryptionCertificate>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::decodeCertificate(
+    bsl::shared_ptr<ntci::EncryptionCertificate>*,
+    bsl::streambuf*,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::decodeCertificate(
+    bsl::shared_ptr<ntci::EncryptionCertificate>*,
+    const bdlbb::Blob&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::decodeCertificate(
+    bsl::shared_ptr<ntci::EncryptionCertificate>*,
+    const bsl::string&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::decodeCertificate(
+    bsl::shared_ptr<ntci::EncryptionCertificate>*,
+    const bsl::vector<char>&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::generateKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                                   const ntca::EncryptionKeyOptions&,
+                                   bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::loadKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                               const bsl::string&,
+                               bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::encodeKey(bsl::streambuf*,
+                                 const bsl::shared_ptr<ntci::EncryptionKey>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::encodeKey(bdlbb::Blob*,
+                                 const bsl::shared_ptr<ntci::EncryptionKey>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::encodeKey(bsl::string*,
+                                 const bsl::shared_ptr<ntci::EncryptionKey>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::encodeKey(bsl::vector<char>*,
+                                 const bsl::shared_ptr<ntci::EncryptionKey>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::decodeKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                                 bsl::streambuf*,
+                                 bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::decodeKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                                 const bdlbb::Blob&,
+                                 bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::decodeKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                                 const bsl::string&,
+                                 bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error Interface::decodeKey(bsl::shared_ptr<ntci::EncryptionKey>*,
+                                 const bsl::vector<char>&,
+                                 bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+Result::Result(bslma::Allocator* basicAllocator)
+: d_numCompletions(0)
+, d_streamSocket()
+, d_attempts(basicAllocator)
+, d_error()
+{
+}
+
+void processComplete(
+    test::Result*                                 result,
+    const bsl::shared_ptr<ntci::StreamSocket>&    streamSocket,
+    const ntcu::StreamSocketRacer::AttemptVector& attempts,
+    const ntsa::Error&                            error)
+{
+    ++result->d_numCompletions;
+
+    result->d_streamSocket = streamSocket;
+    result->d_attempts     = attempts;
+    result->d_error        = error;
+}
+
+ntcu::StreamSocketRacer::Callback createCallback(test::Result* result)
+{
+    return bdlf::BindUtil::bind(&test::processComplete,
+                                result,
+                                bdlf::PlaceHolders::_1,
+                                bdlf::PlaceHolders::_2,
+                                bdlf::PlaceHolders::_3);
+}
+
+ntsa::Endpoint createEndpoint(const char* ipAddress)
+{
+    return ntsa::Endpoint(
+        ntsa::IpEndpoint(ntsa::IpAddress(ipAddress), test::k_PORT));
+}
+
+}  // close namespace test
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: IP addresses are interleaved by family, starting with IPv6,
+    // preserving the relative order of addresses of the same family.
+    // Plan:
+
+    ntccfg::TestAllocator ta;
+    {
+        bsl::vector<ntsa::IpAddress> ipAddressList(&ta);
+
+        ipAddressList.push_back(ntsa::IpAddress("10.0.0.1"));
+        ipAddressList.push_back(ntsa::IpAddress("10.0.0.2"));
+        ipAddressList.push_back(ntsa::IpAddress("10.0.0.3"));
+        ipAddressList.push_back(ntsa::IpAddress("::1"));
+        ipAddressList.push_back(ntsa::IpAddress("::2"));
+
+        ntcu::StreamSocketRacer::sortIpAddressList(&ipAddressList);
+
+        NTCCFG_TEST_EQ(ipAddressList.size(), 5);
+
+        NTCCFG_TEST_EQ(ipAddressList[0], ntsa::IpAddress("::1"));
+        NTCCFG_TEST_EQ(ipAddressList[1], ntsa::IpAddress("10.0.0.1"));
+        NTCCFG_TEST_EQ(ipAddressList[2], ntsa::IpAddress("::2"));
+        NTCCFG_TEST_EQ(ipAddressList[3], ntsa::IpAddress("10.0.0.2"));
+        NTCCFG_TEST_EQ(ipAddressList[4], ntsa::IpAddress("10.0.0.3"));
+
+        ipAddressList.clear();
+
+        ipAddressList.push_back(ntsa::IpAddress("10.0.0.2"));
+        ipAddressList.push_back(ntsa::IpAddress("10.0.0.1"));
+
+        ntcu::StreamSocketRacer::sortIpAddressList(&ipAddressList);
+
+        NTCCFG_TEST_EQ(ipAddressList.size(), 2);
+
+        NTCCFG_TEST_EQ(ipAddressList[0], ntsa::IpAddress("10.0.0.2"));
+        NTCCFG_TEST_EQ(ipAddressList[1], ntsa::IpAddress("10.0.0.1"));
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: An attempt records its outcome.
+    // Plan:
+
+    ntsa::Endpoint endpoint("127.0.0.1:12345");
+
+    ntcu::StreamSocketRacerAttempt attempt(endpoint);
+
+    NTCCFG_TEST_EQ(attempt.endpoint(), endpoint);
+    NTCCFG_TEST_FALSE(attempt.started());
+    NTCCFG_TEST_FALSE(attempt.complete());
+    NTCCFG_TEST_FALSE(attempt.winner());
+    NTCCFG_TEST_OK(attempt.error());
+
+    attempt.setStarted(true);
+    attempt.setDelay(bsls::TimeInterval(0.25));
+    attempt.setComplete(true);
+    attempt.setLatency(bsls::TimeInterval(0.5));
+    attempt.setError(ntsa::Error(ntsa::Error::e_CANCELLED));
+
+    NTCCFG_TEST_TRUE(attempt.started());
+    NTCCFG_TEST_TRUE(attempt.complete());
+    NTCCFG_TEST_FALSE(attempt.winner());
+    NTCCFG_TEST_EQ(attempt.delay(), bsls::TimeInterval(0.25));
+    NTCCFG_TEST_EQ(attempt.latency(), bsls::TimeInterval(0.5));
+    NTCCFG_TEST_EQ(attempt.error(), ntsa::Error(ntsa::Error::e_CANCELLED));
+
+    NTCCFG_TEST_EQ(ntcu::StreamSocketRacer::defaultAttemptDelay(),
+                   bsls::TimeInterval(0.25));
+}
+
+NTCCFG_TEST_CASE(3)
+{
+    // Concern: Each attempt after the first starts when the attempt delay
+    // elapses, while the earlier attempts remain in progress.
+    // Plan: Race to three addresses and advance the clock by less than,
+    // then by exactly, the attempt delay, and ensure a socket is created
+    // and connected to the next address only when the delay elapses.
+
+    ntccfg::TestAllocator ta;
+    {
+        test::Loop loop(&ta);
+
+        bsl::shared_ptr<test::Interface> interface;
+        interface.createInplace(&ta, &loop, &ta);
+
+        const bsls::TimeInterval attemptDelay(0.25);
+
+        bsl::shared_ptr<ntcu::StreamSocketRacer> racer;
+        racer.createInplace(&ta,
+                            interface,
+                            ntca::StreamSocketOptions(),
+                            attemptDelay,
+                            &ta);
+
+        bsl::vector<ntsa::IpAddress> ipAddressList(&ta);
+        ipAddressList.push_back(ntsa::IpAddress("10.0.0.1"));
+        ipAddressList.push_back(ntsa::IpAddress("::1"));
+        ipAddressList.push_back(ntsa::IpAddress("10.0.0.2"));
+
+        test::Result result(&ta);
+
+        ntsa::Error error = racer->connect(ipAddressList,
+                                           test::k_PORT,
+                                           ntca::ConnectOptions(),
+                                           test::createCallback(&result));
+        NTCCFG_TEST_OK(error);
+
+        NTCCFG_TEST_EQ(interface->numStreamSockets(), 1);
+        NTCCFG_TEST_EQ(interface->streamSocket(0)->endpoint(),
+                       test::createEndpoint("::1"));
+        NTCCFG_TEST_TRUE(interface->streamSocket(0)->isConnecting());
+
+        NTCCFG_TEST_EQ(loop.numScheduledTimers(), 1);
+        NTCCFG_TEST_EQ(loop.timer(0)->deadline(), loop.now() + attemptDelay);
+
+        loop.advance(bsls::TimeInterval(0.1));
+
+        NTCCFG_TEST_EQ(interface->numStreamSockets(), 1);
+
+        loop.advance(bsls::TimeInterval(0.15));
+
+        NTCCFG_TEST_EQ(interface->numStreamSockets(), 2);
+        NTCCFG_TEST_EQ(interface->streamSocket(1)->endpoint(),
+                       test::createEndpoint("10.0.0.1"));
+        NTCCFG_TEST_TRUE(interface->streamSocket(0)->isConnecting());
+        NTCCFG_TEST_TRUE(interface->streamSocket(1)->isConnecting());
+
+        loop.advance(attemptDelay);
+
+        NTCCFG_TEST_EQ(interface->numStreamSockets(), 3);
+        NTCCFG_TEST_EQ(interface->streamSocket(2)->endpoint(),
+                       test::createEndpoint("10.0.0.2"));
+
+        // No attempt remains to be started, so no timer is scheduled.
+
+        NTCCFG_TEST_EQ(loop.numScheduledTimers(), 0);
+
+        loop.advance(bsls::TimeInterval(1.0));
+
+        NTCCFG_TEST_EQ(interface->numStreamSockets(), 3);
+        NTCCFG_TEST_EQ(result.d_numCompletions, 0);
+
+        interface->streamSocket(2)->complete();
+        loop.drain();
+
+        NTCCFG_TEST_EQ(result.d_numCompletions, 1);
+        NTCCFG_TEST_OK(result.d_error);
+
+        NTCCFG_TEST_EQ(result.d_attempts.size(), 3);
+        NTCCFG_TEST_EQ(result.d_attempts[0].delay(), bsls::TimeInterval());
+        NTCCFG_TEST_EQ(result.d_attempts[1].delay(), attemptDelay);
+        NTCCFG_TEST_EQ(result.d_attempts[2].delay(), bsls::TimeInterval(0.5));
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(4)
+{
+    // Concern: When an attempt fails, the next attempt starts immediately,
+    // without waiting for the attempt delay to elapse.
+    // Plan: Race to two addresses, fail the first attempt without
+    // advancing the clock, and ensure the second attempt starts.
+
+    ntccfg::TestAllocator ta;
+    {
+        test::Loop loop(&ta);
+
+        bsl::shared_ptr<test::Interface> interface;
+        interface.createInplace(&ta, &loop, &ta);
+
+        bsl::shared_ptr<ntcu::StreamSocketRacer> racer;
+        racer.createInplace(&ta,
+                            interface,
+                            ntca::StreamSocketOptions(),
+                            bsls::TimeInterval(0.25),
+                            &ta);
+
+        bsl::vector<ntsa::IpAddress> ipAddressList(&ta);
+        ipAddressList.push_back(ntsa::IpAddress("::1"));
+        ipAddressList.push_back(ntsa::IpAddress("10.0.0.1"));
+
+        test::Result result(&ta);
+
+        ntsa::Error error = racer->connect(ipAddressList,
+                                           test::k_PORT,
+                                           ntca::ConnectOptions(),
+                                           test::createCallback(&result));
+        NTCCFG_TEST_OK(error);
+
+        NTCCFG_TEST_EQ(interface->numStreamSockets(), 1);
+
+        interface->streamSocket(0)->fail(
+            ntsa::Error(ntsa::Error::e_CONNECTION_REFUSED));
+        loop.drain();
+
+        NTCCFG_TEST_EQ(interface->numStreamSockets(), 2);
+        NTCCFG_TEST_EQ(interface->streamSocket(1)->endpoint(),
+                       test::createEndpoint("10.0.0.1"));
+        NTCCFG_TEST_TRUE(interface->streamSocket(1)->isConnecting());
+        NTCCFG_TEST_EQ(result.d_numCompletions, 0);
+
+        interface->streamSocket(1)->complete();
+        loop.drain();
+
+        NTCCFG_TEST_EQ(result.d_numCompletions, 1);
+        NTCCFG_TEST_OK(result.d_error);
+        NTCCFG_TEST_EQ(result.d_streamSocket, interface->streamSocket(1));
+
+        NTCCFG_TEST_EQ(result.d_attempts.size(), 2);
+        NTCCFG_TEST_EQ(result.d_attempts[0].error(),
+                       ntsa::Error(ntsa::Error::e_CONNECTION_REFUSED));
+        NTCCFG_TEST_EQ(result.d_attempts[1].delay(), bsls::TimeInterval());
+        NTCCFG_TEST_TRUE(result.d_attempts[1].winner());
+
+        NTCCFG_TEST_TRUE(interface->streamSocket(0)->isClosed());
+        NTCCFG_TEST_FALSE(interface->streamSocket(1)->isClosed());
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(5)
+{
+    // Concern: The first attempt to succeed wins the race, and every other
+    // attempt is cancelled and its socket closed.
+    // Plan: Race to three addresses until every attempt is in progress,
+    // establish the connection of the second attempt, and ensure it is
+    // reported as the winner while the others are reported as cancelled.
+
+    ntccfg::TestAllocator ta;
+    {
+        test::Loop loop(&ta);
+
+        bsl::shared_ptr<test::Interface> interface;
+        interface.createInplace(&ta, &loop, &ta);
+
+        const bsls::TimeInterval attemptDelay(0.25);
+
+        bsl::shared_ptr<ntcu::StreamSocketRacer> racer;
+        racer.createInplace(&ta,
+                            interface,
+                            ntca::StreamSocketOptions(),
+                            attemptDelay,
+                            &ta);
+
+        bsl::vector<ntsa::IpAddress> ipAddressList(&ta);
+        ipAddressList.push_back(ntsa::IpAddress("::1"));
+        ipAddressList.push_back(ntsa::IpAddress("10.0.0.1"));
+        ipAddressList.push_back(ntsa::IpAddress("::2"));
+
+        test::Result result(&ta);
+
+        ntsa::Error error = racer->connect(ipAddressList,
+                                           test::k_PORT,
+                                           ntca::ConnectOptions(),
+                                           test::createCallback(&result));
+        NTCCFG_TEST_OK(error);
+
+        loop.advance(attemptDelay);
+        loop.advance(attemptDelay);
+
+        NTCCFG_TEST_EQ(interface->numStreamSockets(), 3);
+
+        interface->streamSocket(1)->complete();
+        loop.drain();
+
+        NTCCFG_TEST_EQ(result.d_numCompletions, 1);
+        NTCCFG_TEST_OK(result.d_error);
+        NTCCFG_TEST_EQ(result.d_streamSocket, interface->streamSocket(1));
+
+        NTCCFG_TEST_EQ(result.d_attempts.size(), 3);
+
+        NTCCFG_TEST_TRUE(result.d_attempts[1].winner());
+        NTCCFG_TEST_TRUE(result.d_attempts[1].complete());
+        NTCCFG_TEST_OK(result.d_attempts[1].error());
+
+        NTCCFG_TEST_FALSE(result.d_attempts[0].winner());
+        NTCCFG_TEST_TRUE(result.d_attempts[0].complete());
+        NTCCFG_TEST_EQ(result.d_attempts[0].error(),
+                       ntsa::Error(ntsa::Error::e_CANCELLED));
+
+        NTCCFG_TEST_FALSE(result.d_attempts[2].winner());
+        NTCCFG_TEST_TRUE(result.d_attempts[2].complete());
+        NTCCFG_TEST_EQ(result.d_attempts[2].error(),
+                       ntsa::Error(ntsa::Error::e_CANCELLED));
+
+        NTCCFG_TEST_TRUE(interface->streamSocket(0)->isClosed());
+        NTCCFG_TEST_FALSE(interface->streamSocket(1)->isClosed());
+        NTCCFG_TEST_TRUE(interface->streamSocket(2)->isClosed());
+
+        for (bsl::size_t i = 0; i < loop.numTimers(); ++i) {
+            NTCCFG_TEST_TRUE(loop.timer(i)->isClosed());
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(6)
+{
+    // Concern: An attempt that fails once the deadline has expired
+    // completes the race with a timeout, even if other attempts remain to
+    // be started.
+    // Plan: Race to three addresses with a deadline that expires before
+    // the third attempt is started, fail the first attempt with a timeout
+    // at the deadline, and ensure the race times out and the attempt in
+    // progress is cancelled.
+
+    ntccfg::TestAllocator ta;
+    {
+        test::Loop loop(&ta);
+
+        bsl::shared_ptr<test::Interface> interface;
+        interface.createInplace(&ta, &loop, &ta);
+
+        const bsls::TimeInterval attemptDelay(0.5);
+
+        bsl::shared_ptr<ntcu::StreamSocketRacer> racer;
+        racer.createInplace(&ta,
+                            interface,
+                            ntca::StreamSocketOptions(),
+                            attemptDelay,
+                            &ta);
+
+        bsl::vector<ntsa::IpAddress> ipAddressList(&ta);
+        ipAddressList.push_back(ntsa::IpAddress("::1"));
+        ipAddressList.push_back(ntsa::IpAddress("10.0.0.1"));
+        ipAddressList.push_back(ntsa::IpAddress("::2"));
+
+        const bsls::TimeInterval deadline =
+            loop.now() + bsls::TimeInterval(0.75);
+
+        ntca::ConnectOptions connectOptions;
+        connectOptions.setDeadline(deadline);
+
+        test::Result result(&ta);
+
+        ntsa::Error error = racer->connect(ipAddressList,
+                                           test::k_PORT,
+                                           connectOptions,
+                                           test::createCallback(&result));
+        NTCCFG_TEST_OK(error);
+
+        loop.advance(attemptDelay);
+
+        NTCCFG_TEST_EQ(interface->numStreamSockets(), 2);
+
+        for (bsl::size_t i = 0; i < interface->numStreamSockets(); ++i) {
+            ntca::ConnectOptions options =
+                interface->streamSocket(i)->connectOptions();
+            NTCCFG_TEST_FALSE(options.deadline().isNull());
+            NTCCFG_TEST_EQ(options.deadline().value(), deadline);
+        }
+
+        loop.advance(bsls::TimeInterval(0.25));
+
+        NTCCFG_TEST_EQ(loop.now(), deadline);
+        NTCCFG_TEST_EQ(interface->numStreamSockets(), 2);
+
+        interface->streamSocket(0)->fail(
+            ntsa::Error(ntsa::Error::e_CONNECTION_TIMEOUT));
+        loop.drain();
+
+        NTCCFG_TEST_EQ(result.d_numCompletions, 1);
+        NTCCFG_TEST_EQ(result.d_error,
+                       ntsa::Error(ntsa::Error::e_CONNECTION_TIMEOUT));
+        NTCCFG_TEST_FALSE(result.d_streamSocket);
+
+        NTCCFG_TEST_EQ(result.d_attempts.size(), 3);
+        NTCCFG_TEST_EQ(result.d_attempts[1].error(),
+                       ntsa::Error(ntsa::Error::e_CANCELLED));
+        NTCCFG_TEST_FALSE(result.d_attempts[2].started());
+
+        NTCCFG_TEST_TRUE(interface->streamSocket(0)->isClosed());
+        NTCCFG_TEST_TRUE(interface->streamSocket(1)->isClosed());
+
+        loop.advance(attemptDelay);
+
+        NTCCFG_TEST_EQ(interface->numStreamSockets(), 2);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(7)
+{
+    // Concern: When every attempt fails, the race fails with the error of
+    // the last attempt to fail.
+    // Plan: Race to two addresses, fail each attempt with a different
+    // error, and ensure the error of the second is reported.
+
+    ntccfg::TestAllocator ta;
+    {
+        test::Loop loop(&ta);
+
+        bsl::shared_ptr<test::Interface> interface;
+        interface.createInplace(&ta, &loop, &ta);
+
+        bsl::shared_ptr<ntcu::StreamSocketRacer> racer;
+        racer.createInplace(&ta,
+                            interface,
+                            ntca::StreamSocketOptions(),
+                            bsls::TimeInterval(0.25),
+                            &ta);
+
+        bsl::vector<ntsa::IpAddress> ipAddressList(&ta);
+        ipAddressList.push_back(ntsa::IpAddress("::1"));
+        ipAddressList.push_back(ntsa::IpAddress("10.0.0.1"));
+
+        test::Result result(&ta);
+
+        ntsa::Error error = racer->connect(ipAddressList,
+                                           test::k_PORT,
+                                           ntca::ConnectOptions(),
+                                           test::createCallback(&result));
+        NTCCFG_TEST_OK(error);
+
+        interface->streamSocket(0)->fail(
+            ntsa::Error(ntsa::Error::e_UNREACHABLE));
+        loop.drain();
+
+        NTCCFG_TEST_EQ(interface->numStreamSockets(), 2);
+        NTCCFG_TEST_EQ(result.d_numCompletions, 0);
+
+        interface->streamSocket(1)->fail(
+            ntsa::Error(ntsa::Error::e_CONNECTION_REFUSED));
+        loop.drain();
+
+        NTCCFG_TEST_EQ(result.d_numCompletions, 1);
+        NTCCFG_TEST_EQ(result.d_error,
+                       ntsa::Error(ntsa::Error::e_CONNECTION_REFUSED));
+        NTCCFG_TEST_FALSE(result.d_streamSocket);
+
+        NTCCFG_TEST_EQ(result.d_attempts.size(), 2);
+        NTCCFG_TEST_EQ(result.d_attempts[0].error(),
+                       ntsa::Error(ntsa::Error::e_UNREACHABLE));
+        NTCCFG_TEST_EQ(result.d_attempts[1].error(),
+                       ntsa::Error(ntsa::Error::e_CONNECTION_REFUSED));
+
+        NTCCFG_TEST_TRUE(interface->streamSocket(0)->isClosed());
+        NTCCFG_TEST_TRUE(interface->streamSocket(1)->isClosed());
+
+        for (bsl::size_t i = 0; i < loop.numTimers(); ++i) {
+            NTCCFG_TEST_TRUE(loop.timer(i)->isClosed());
+        }
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(8)
+{
+    // Concern: Cancelling the race completes it with
+    // 'ntsa::Error::e_CANCELLED', closes every socket and the timer, and
+    // starts no further attempt.
+    // Plan: Race to two addresses, cancel the race while the first attempt
+    // is in progress, then advance the clock beyond the attempt delay.
+
+    ntccfg::TestAllocator ta;
+    {
+        test::Loop loop(&ta);
+
+        bsl::shared_ptr<test::Interface> interface;
+        interface.createInplace(&ta, &loop, &ta);
+
+        const bsls::TimeInterval attemptDelay(0.25);
+
+        bsl::shared_ptr<ntcu::StreamSocketRacer> racer;
+        racer.createInplace(&ta,
+                            interface,
+                            ntca::StreamSocketOptions(),
+                            attemptDelay,
+                            &ta);
+
+        bsl::vector<ntsa::IpAddress> ipAddressList(&ta);
+        ipAddressList.push_back(ntsa::IpAddress("::1"));
+        ipAddressList.push_back(ntsa::IpAddress("10.0.0.1"));
+
+        test::Result result(&ta);
+
+        ntsa::Error error = racer->connect(ipAddressList,
+                                           test::k_PORT,
+                                           ntca::ConnectOptions(),
+                                           test::createCallback(&result));
+        NTCCFG_TEST_OK(error);
+
+        NTCCFG_TEST_EQ(interface->numStreamSockets(), 1);
+
+        racer->cancel();
+
+        NTCCFG_TEST_EQ(result.d_numCompletions, 1);
+        NTCCFG_TEST_EQ(result.d_error, ntsa::Error(ntsa::Error::e_CANCELLED));
+        NTCCFG_TEST_FALSE(result.d_streamSocket);
+
+        NTCCFG_TEST_EQ(result.d_attempts.size(), 2);
+        NTCCFG_TEST_EQ(result.d_attempts[0].error(),
+                       ntsa::Error(ntsa::Error::e_CANCELLED));
+        NTCCFG_TEST_FALSE(result.d_attempts[1].started());
+
+        NTCCFG_TEST_TRUE(interface->streamSocket(0)->isClosed());
+
+        NTCCFG_TEST_EQ(loop.numTimers(), 1);
+        NTCCFG_TEST_TRUE(loop.timer(0)->isClosed());
+
+        loop.advance(bsls::TimeInterval(0.5));
+
+        NTCCFG_TEST_EQ(interface->numStreamSockets(), 1);
+        NTCCFG_TEST_EQ(result.d_numCompletions, 1);
+
+        // Cancelling a race that is complete has no effect.
+
+        racer->cancel();
+
+        NTCCFG_TEST_EQ(result.d_numCompletions, 1);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+    NTCCFG_TEST_REGISTER(3);
+    NTCCFG_TEST_REGISTER(4);
+    NTCCFG_TEST_REGISTER(5);
+    NTCCFG_TEST_REGISTER(6);
+    NTCCFG_TEST_REGISTER(7);
+    NTCCFG_TEST_REGISTER(8);
+}
+NTCCFG_TEST_DRIVER_END;
@@ -0,0 +1,475 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcu_streamsocketrelay.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntcu_streamsocketrelay_cpp, "$Id$ $CSID$")
+
+#include <ntca_flowcontrolmode.h>
+#include <ntca_flowcontroltype.h>
+#include <ntca_receivecontext.h>
+#include <ntca_receiveoptions.h>
+#include <ntca_sendoptions.h>
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace ntcu {
+
+StreamSocketRelay::Direction::Direction(bslma::Allocator* basicAllocator)
+: d_source_sp()
+, d_destination_sp()
+, d_pending(basicAllocator)
+, d_numBytesForwarded(0)
+, d_blocked(false)
+, d_shutdown(false)
+, d_complete(false)
+{
+}
+
+StreamSocketRelay::Direction* StreamSocketRelay::privateSource(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket)
+{
+    if (!d_started || d_complete) {
+        return 0;
+    }
+
+    if (streamSocket == d_forward.d_source_sp) {
+        return &d_forward;
+    }
+    else if (streamSocket == d_backward.d_source_sp) {
+        return &d_backward;
+    }
+
+    return 0;
+}
+
+StreamSocketRelay::Direction* StreamSocketRelay::privateDestination(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket)
+{
+    if (!d_started || d_complete) {
+        return 0;
+    }
+
+    if (streamSocket == d_forward.d_destination_sp) {
+        return &d_forward;
+    }
+    else if (streamSocket == d_backward.d_destination_sp) {
+        return &d_backward;
+    }
+
+    return 0;
+}
+
+void StreamSocketRelay::privateForward(Direction* direction)
+{
+    ntsa::Error error;
+
+    while (!direction->d_blocked && !direction->d_shutdown) {
+        if (direction->d_pending.length() > 0) {
+            error = direction->d_destination_sp->send(direction->d_pending,
+                                                      ntca::SendOptions());
+            if (error) {
+                if (error == ntsa::Error::e_WOULD_BLOCK) {
+                    this->privateBlock(direction);
+                }
+                else {
+                    this->privateFail(error);
+                }
+                return;
+            }
+
+            direction->d_numBytesForwarded +=
+                static_cast<bsl::size_t>(direction->d_pending.length());
+
+            direction->d_pending.removeAll();
+        }
+
+        ntca::ReceiveContext receiveContext;
+        error = direction->d_source_sp->receive(&receiveContext,
+                                                &direction->d_pending,
+                                                ntca::ReceiveOptions());
+        if (error) {
+            if (error == ntsa::Error::e_EOF) {
+                direction->d_shutdown = true;
+                this->privateShutdown(direction->d_destination_sp,
+                                      ntsa::ShutdownType::e_SEND,
+                                      ntsa::ShutdownMode::e_GRACEFUL);
+            }
+            else if (error != ntsa::Error::e_WOULD_BLOCK) {
+                this->privateFail(error);
+            }
+            return;
+        }
+    }
+}
+
+void StreamSocketRelay::privateBlock(Direction* direction)
+{
+    if (direction->d_blocked) {
+        return;
+    }
+
+    direction->d_blocked = true;
+
+    ntsa::Error error = direction->d_source_sp->applyFlowControl(
+        ntca::FlowControlType::e_RECEIVE,
+        ntca::FlowControlMode::e_IMMEDIATE);
+    if (error) {
+        this->privateFail(error);
+    }
+}
+
+void StreamSocketRelay::privateUnblock(Direction* direction)
+{
+    if (!direction->d_blocked) {
+        return;
+    }
+
+    direction->d_blocked = false;
+
+    ntsa::Error error = direction->d_source_sp->relaxFlowControl(
+        ntca::FlowControlType::e_RECEIVE);
+    if (error) {
+        this->privateFail(error);
+        return;
+    }
+
+    this->privateForward(direction);
+}
+
+void StreamSocketRelay::privateShutdown(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    ntsa::ShutdownType::Value                  type,
+    ntsa::ShutdownMode::Value                  mode)
+{
+    Shutdown shutdown;
+    shutdown.d_streamSocket_sp = streamSocket;
+    shutdown.d_type            = type;
+    shutdown.d_mode            = mode;
+
+    d_shutdownQueue.push_back(shutdown);
+}
+
+void StreamSocketRelay::privateFail(const ntsa::Error& error)
+{
+    if (!d_error) {
+        d_error = error;
+    }
+
+    d_forward.d_shutdown  = true;
+    d_backward.d_shutdown = true;
+
+    if (d_failed) {
+        return;
+    }
+
+    d_failed = true;
+
+    this->privateShutdown(d_forward.d_source_sp,
+                          ntsa::ShutdownType::e_BOTH,
+                          ntsa::ShutdownMode::e_IMMEDIATE);
+
+    this->privateShutdown(d_backward.d_source_sp,
+                          ntsa::ShutdownType::e_BOTH,
+                          ntsa::ShutdownMode::e_IMMEDIATE);
+}
+
+void StreamSocketRelay::flush(ShutdownQueue* shutdownQueue)
+{
+    while (!shutdownQueue->empty()) {
+        for (ShutdownQueue::const_iterator it = shutdownQueue->begin();
+             it != shutdownQueue->end();
+             ++it)
+        {
+            ntsa::Error error =
+                it->d_streamSocket_sp->shutdown(it->d_type, it->d_mode);
+            if (error && it->d_mode == ntsa::ShutdownMode::e_GRACEFUL) {
+                bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+                if (d_started && !d_complete) {
+                    this->privateFail(error);
+                }
+            }
+        }
+
+        shutdownQueue->clear();
+
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        shutdownQueue->swap(d_shutdownQueue);
+    }
+}
+
+StreamSocketRelay::StreamSocketRelay(
+    const bsl::shared_ptr<ntci::StreamSocket>& first,
+    const bsl::shared_ptr<ntci::StreamSocket>& second,
+    bslma::Allocator*                          basicAllocator)
+: d_mutex()
+, d_forward(basicAllocator)
+, d_backward(basicAllocator)
+, d_shutdownQueue(basicAllocator)
+, d_error()
+, d_started(false)
+, d_failed(false)
+, d_complete(false)
+, d_callback(bsl::allocator_arg, basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(first);
+    BSLS_ASSERT(second);
+    BSLS_ASSERT(first != second);
+
+    d_forward.d_source_sp      = first;
+    d_forward.d_destination_sp = second;
+
+    d_backward.d_source_sp      = second;
+    d_backward.d_destination_sp = first;
+}
+
+StreamSocketRelay::~StreamSocketRelay()
+{
+}
+
+void StreamSocketRelay::processReadQueueLowWatermark(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    const ntca::ReadQueueEvent&                event)
+{
+    NTCCFG_WARNING_UNUSED(event);
+
+    ShutdownQueue shutdownQueue(d_allocator_p);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        Direction* direction = this->privateSource(streamSocket);
+        if (direction) {
+            this->privateForward(direction);
+        }
+
+        shutdownQueue.swap(d_shutdownQueue);
+    }
+
+    this->flush(&shutdownQueue);
+}
+
+void StreamSocketRelay::processWriteQueueLowWatermark(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    const ntca::WriteQueueEvent&               event)
+{
+    NTCCFG_WARNING_UNUSED(event);
+
+    ShutdownQueue shutdownQueue(d_allocator_p);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        Direction* direction = this->privateDestination(streamSocket);
+        if (direction) {
+            this->privateUnblock(direction);
+        }
+
+        shutdownQueue.swap(d_shutdownQueue);
+    }
+
+    this->flush(&shutdownQueue);
+}
+
+void StreamSocketRelay::processWriteQueueHighWatermark(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    const ntca::WriteQueueEvent&               event)
+{
+    NTCCFG_WARNING_UNUSED(event);
+
+    ShutdownQueue shutdownQueue(d_allocator_p);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        Direction* direction = this->privateDestination(streamSocket);
+        if (direction) {
+            this->privateBlock(direction);
+        }
+
+        shutdownQueue.swap(d_shutdownQueue);
+    }
+
+    this->flush(&shutdownQueue);
+}
+
+void StreamSocketRelay::processShutdownReceive(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    const ntca::ShutdownEvent&                 event)
+{
+    NTCCFG_WARNING_UNUSED(event);
+
+    ShutdownQueue shutdownQueue(d_allocator_p);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        Direction* direction = this->privateSource(streamSocket);
+        if (direction) {
+            this->privateForward(direction);
+        }
+
+        shutdownQueue.swap(d_shutdownQueue);
+    }
+
+    this->flush(&shutdownQueue);
+}
+
+void StreamSocketRelay::processShutdownComplete(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    const ntca::ShutdownEvent&                 event)
+{
+    NTCCFG_WARNING_UNUSED(event);
+
+    bsl::shared_ptr<ntci::StreamSocket> first;
+    bsl::shared_ptr<ntci::StreamSocket> second;
+    ntsa::Error                         error;
+
+    Callback callback(bsl::allocator_arg, d_allocator_p);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        Direction* direction = this->privateSource(streamSocket);
+        if (!direction) {
+            return;
+        }
+
+        direction->d_complete = true;
+
+        if (!d_forward.d_complete || !d_backward.d_complete) {
+            return;
+        }
+
+        d_complete = true;
+
+        first  = d_forward.d_source_sp;
+        second = d_backward.d_source_sp;
+
+        d_forward.d_source_sp.reset();
+        d_forward.d_destination_sp.reset();
+        d_forward.d_pending.removeAll();
+
+        d_backward.d_source_sp.reset();
+        d_backward.d_destination_sp.reset();
+        d_backward.d_pending.removeAll();
+
+        callback.swap(d_callback);
+        error = d_error;
+    }
+
+    first->close();
+    second->close();
+
+    if (callback) {
+        callback(error);
+    }
+}
+
+void StreamSocketRelay::processError(
+    const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+    const ntca::ErrorEvent&                    event)
+{
+    ShutdownQueue shutdownQueue(d_allocator_p);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        Direction* direction = this->privateSource(streamSocket);
+        if (direction) {
+            this->privateFail(event.context().error());
+        }
+
+        shutdownQueue.swap(d_shutdownQueue);
+    }
+
+    this->flush(&shutdownQueue);
+}
+
+ntsa::Error StreamSocketRelay::start(const Callback& callback)
+{
+    bsl::shared_ptr<StreamSocketRelay> self = this->getSelf(this);
+
+    ShutdownQueue shutdownQueue(d_allocator_p);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        ntsa::Error error;
+
+        if (d_started) {
+            return ntsa::Error(ntsa::Error::e_INVALID);
+        }
+
+        error = d_forward.d_source_sp->registerSession(self);
+        if (error) {
+            return error;
+        }
+
+        error = d_backward.d_source_sp->registerSession(self);
+        if (error) {
+            d_forward.d_source_sp->deregisterSession();
+            return error;
+        }
+
+        d_callback = callback;
+        d_started  = true;
+
+        this->privateForward(&d_forward);
+        this->privateForward(&d_backward);
+
+        shutdownQueue.swap(d_shutdownQueue);
+    }
+
+    this->flush(&shutdownQueue);
+
+    return ntsa::Error();
+}
+
+void StreamSocketRelay::stop()
+{
+    ShutdownQueue shutdownQueue(d_allocator_p);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (d_started && !d_complete) {
+            this->privateFail(ntsa::Error(ntsa::Error::e_CANCELLED));
+        }
+
+        shutdownQueue.swap(d_shutdownQueue);
+    }
+
+    this->flush(&shutdownQueue);
+}
+
+bsl::size_t StreamSocketRelay::numBytesForwarded() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_forward.d_numBytesForwarded;
+}
+
+bsl::size_t StreamSocketRelay::numBytesReturned() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_backward.d_numBytesForwarded;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,246 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTCU_STREAMSOCKETRELAY
+#define INCLUDED_NTCU_STREAMSOCKETRELAY
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntca_errorevent.h>
+#include <ntca_readqueueevent.h>
+#include <ntca_shutdownevent.h>
+#include <ntca_writequeueevent.h>
+#include <ntccfg_platform.h>
+#include <ntci_streamsocket.h>
+#include <ntci_streamsocketrelay.h>
+#include <ntci_streamsocketsession.h>
+#include <ntcscm_version.h>
+#include <ntsa_error.h>
+#include <ntsa_shutdownmode.h>
+#include <ntsa_shutdowntype.h>
+#include <bdlbb_blob.h>
+#include <bslmt_mutex.h>
+#include <bsls_keyword.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ntcu {
+
+/// @internal @brief
+/// Provide a relay of data between two stream sockets.
+///
+/// @details
+/// This class pairs two established stream sockets so that data received
+/// by each socket is forwarded to, and sent by, the other. The relay
+/// registers itself as the session of both sockets: each time the read
+/// queue of one socket rises to its low watermark, the contents of that
+/// read queue are dequeued and sent through the other socket.
+///
+/// Forwarding does not copy the forwarded bytes in user space: the blob
+/// dequeued from the read queue of the source socket refers to the same
+/// buffers into which the source socket received the data, and the blob
+/// sent through the destination socket is enqueued onto its write queue by
+/// referring to those same buffers.
+///
+/// Each direction is subject to backpressure from the write queue of its
+/// destination. When the write queue of the destination socket breaches
+/// its high watermark, flow control is applied to the receive direction of
+/// the source socket, and data that could not be sent is held by the relay.
+/// When the write queue of the destination socket drains to its low
+/// watermark, the held data is sent and flow control is relaxed. The
+/// memory consumed by each direction is therefore bounded by the read
+/// queue high watermark of its source and the write queue high watermark
+/// of its destination.
+///
+/// When the peer of one socket shuts down its side of the connection, the
+/// relay shuts down the other socket for sending, after all data received
+/// before the shutdown has been forwarded. When both sockets are
+/// completely shut down, or if either socket encounters an error, both
+/// sockets are closed and the callback is invoked.
+///
+/// Shutting down a socket may announce the completion of its shutdown
+/// sequence to its session before the call returns. The relay therefore
+/// never shuts down a socket while holding its own lock: shutdowns decided
+/// while the lock is held are queued, and initiated once it is released.
+///
+/// @par Thread Safety
+/// This class is thread safe.
+///
+/// @ingroup module_ntcu
+class StreamSocketRelay : public ntci::StreamSocketRelay,
+                          public ntci::StreamSocketSession,
+                          public ntccfg::Shared<StreamSocketRelay>
+{
+    /// Describe the forwarding of data in one direction.
+    struct Direction {
+        /// Create a new direction. Optionally specify a 'basicAllocator'
+        /// used to supply memory. If 'basicAllocator' is 0, the currently
+        /// installed default allocator is used.
+        explicit Direction(bslma::Allocator* basicAllocator = 0);
+
+        bsl::shared_ptr<ntci::StreamSocket> d_source_sp;
+        bsl::shared_ptr<ntci::StreamSocket> d_destination_sp;
+        bdlbb::Blob                         d_pending;
+        bsl::size_t                         d_numBytesForwarded;
+        bool                                d_blocked;
+        bool                                d_shutdown;
+        bool                                d_complete;
+    };
+
+    /// Describe a shutdown of a socket to be initiated once 'd_mutex' is
+    /// released.
+    struct Shutdown {
+        bsl::shared_ptr<ntci::StreamSocket> d_streamSocket_sp;
+        ntsa::ShutdownType::Value           d_type;
+        ntsa::ShutdownMode::Value           d_mode;
+    };
+
+    /// Define a type alias for a queue of shutdowns.
+    typedef bsl::vector<Shutdown> ShutdownQueue;
+
+    mutable bslmt::Mutex d_mutex;
+    Direction            d_forward;
+    Direction            d_backward;
+    ShutdownQueue        d_shutdownQueue;
+    ntsa::Error          d_error;
+    bool                 d_started;
+    bool                 d_failed;
+    bool                 d_complete;
+    Callback             d_callback;
+    bslma::Allocator*    d_allocator_p;
+
+  private:
+    StreamSocketRelay(const StreamSocketRelay&) BSLS_KEYWORD_DELETED;
+    StreamSocketRelay& operator=(const StreamSocketRelay&)
+        BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Return the direction whose source is the specified 'streamSocket',
+    /// or null if the relay is not in progress. The behavior is undefined
+    /// unless 'd_mutex' is locked.
+    Direction* privateSource(
+        const bsl::shared_ptr<ntci::StreamSocket>& streamSocket);
+
+    /// Return the direction whose destination is the specified
+    /// 'streamSocket', or null if the relay is not in progress. The
+    /// behavior is undefined unless 'd_mutex' is locked.
+    Direction* privateDestination(
+        const bsl::shared_ptr<ntci::StreamSocket>& streamSocket);
+
+    /// Send any data held for the specified 'direction' then dequeue and
+    /// send all data available from its source, until either no more data
+    /// is available or the destination cannot accept more data. The
+    /// behavior is undefined unless 'd_mutex' is locked.
+    void privateForward(Direction* direction);
+
+    /// Apply flow control to the receive direction of the source of the
+    /// specified 'direction', if not already applied. The behavior is
+    /// undefined unless 'd_mutex' is locked.
+    void privateBlock(Direction* direction);
+
+    /// Relax flow control on the receive direction of the source of the
+    /// specified 'direction', if applied, and resume forwarding. The
+    /// behavior is undefined unless 'd_mutex' is locked.
+    void privateUnblock(Direction* direction);
+
+    /// Queue the shutdown of the specified 'streamSocket' in the specified
+    /// 'type' of direction according to the specified 'mode'. The behavior
+    /// is undefined unless 'd_mutex' is locked.
+    void privateShutdown(
+        const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+        ntsa::ShutdownType::Value                  type,
+        ntsa::ShutdownMode::Value                  mode);
+
+    /// Fail the relay with the specified 'error': record the error, stop
+    /// forwarding, and queue the immediate shutdown of both sockets in both
+    /// directions. The behavior is undefined unless 'd_mutex' is locked.
+    void privateFail(const ntsa::Error& error);
+
+    /// Initiate each shutdown in the specified 'shutdownQueue', then any
+    /// shutdowns queued in the meantime, until none remain. Fail the relay
+    /// if a graceful shutdown cannot be initiated. The behavior is
+    /// undefined unless 'd_mutex' is unlocked.
+    void flush(ShutdownQueue* shutdownQueue);
+
+  public:
+    /// Create a new relay between the specified 'first' and 'second'
+    /// stream sockets. Optionally specify a 'basicAllocator' used to supply
+    /// memory. If 'basicAllocator' is 0, the currently installed default
+    /// allocator is used. The behavior is undefined unless 'first' and
+    /// 'second' are established and distinct.
+    StreamSocketRelay(const bsl::shared_ptr<ntci::StreamSocket>& first,
+                      const bsl::shared_ptr<ntci::StreamSocket>& second,
+                      bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~StreamSocketRelay() BSLS_KEYWORD_OVERRIDE;
+
+    /// Process the condition that the size of the read queue is greater
+    /// than or equal to the read queue low watermark.
+    void processReadQueueLowWatermark(
+        const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+        const ntca::ReadQueueEvent& event) BSLS_KEYWORD_OVERRIDE;
+
+    /// Process the condition that the size of the write queue has been
+    /// drained down to less than or equal to the write queue low watermark.
+    void processWriteQueueLowWatermark(
+        const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+        const ntca::WriteQueueEvent& event) BSLS_KEYWORD_OVERRIDE;
+
+    /// Process the condition that the size of the write queue is greater
+    /// than the write queue high watermark.
+    void processWriteQueueHighWatermark(
+        const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+        const ntca::WriteQueueEvent& event) BSLS_KEYWORD_OVERRIDE;
+
+    /// Process the socket being shut down for reading.
+    void processShutdownReceive(
+        const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+        const ntca::ShutdownEvent& event) BSLS_KEYWORD_OVERRIDE;
+
+    /// Process the completion of the shutdown sequence.
+    void processShutdownComplete(
+        const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+        const ntca::ShutdownEvent& event) BSLS_KEYWORD_OVERRIDE;
+
+    /// Process an error.
+    void processError(const bsl::shared_ptr<ntci::StreamSocket>& streamSocket,
+                      const ntca::ErrorEvent& event) BSLS_KEYWORD_OVERRIDE;
+
+    /// Register this object as the session of both sockets and begin
+    /// forwarding data between them, including any data already in their
+    /// read queues. Invoke the specified 'callback' when the relay
+    /// completes. Return the error.
+    ntsa::Error start(const Callback& callback) BSLS_KEYWORD_OVERRIDE;
+
+    /// Stop the relay, if it is in progress, immediately shutting down both
+    /// sockets. The callback is invoked with the error
+    /// 'ntsa::Error::e_CANCELLED' once both sockets are shut down.
+    void stop() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the number of bytes forwarded from the first socket to the
+    /// second socket.
+    bsl::size_t numBytesForwarded() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the number of bytes forwarded from the second socket to the
+    /// first socket.
+    bsl::size_t numBytesReturned() const BSLS_KEYWORD_OVERRIDE;
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
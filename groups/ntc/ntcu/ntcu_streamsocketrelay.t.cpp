@@ -0,0 +1,1810 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntcu_streamsocketrelay.h>
+
+#include <ntccfg_test.h>
+#include <ntca_errorcontext.h>
+#include <ntca_errorevent.h>
+#include <ntca_readqueueevent.h>
+#include <ntca_shutdownevent.h>
+#include <ntca_writequeueevent.h>
+#include <ntci_streamsocket.h>
+#include <ntci_streamsocketrelay.h>
+#include <ntci_streamsocketsession.h>
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+#include <bdlt_currenttime.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bsls_assert.h>
+#include <bsl_algorithm.h>
+#include <bsl_limits.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The relay is tested against mock stream sockets whose remote peers are
+// played by the test, and whose events are deferred until the test drains
+// them.
+//-----------------------------------------------------------------------------
+
+// [ 1]
+//-----------------------------------------------------------------------------
+// [ 1] Forwarding in both directions
+// [ 2] Backpressure from the write queue watermarks
+// [ 3] Half-close on shutdown
+// [ 4] Stop
+// [ 5] Error
+//-----------------------------------------------------------------------------
+
+namespace test {
+
+/// The maximum number of bytes transmitted at once.
+const bsl::size_t k_MAX_BYTES = bsl::numeric_limits<bsl::size_t>::max();
+
+/// This class implements a loop that defers the events announced by the
+/// mock sockets until the test drains it, so that, like a real socket, no
+/// event is announced from within a call made by the session, unless
+/// stated otherwise.
+class Loop
+{
+    /// Define a type alias for a queue of deferred functions.
+    typedef bsl::vector<ntci::Executor::Functor> FunctorQueue;
+
+    bslmt::Mutex      d_mutex;
+    FunctorQueue      d_functorQueue;
+    bslma::Allocator* d_allocator_p;
+
+  private:
+    Loop(const Loop&) BSLS_KEYWORD_DELETED;
+    Loop& operator=(const Loop&) BSLS_KEYWORD_DELETED;
+
+  public:
+    /// Create a new loop. Optionally specify a 'basicAllocator' used to
+    /// supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    explicit Loop(bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~Loop();
+
+    /// Defer the specified 'functor' until the loop is next drained.
+    void execute(const ntci::Executor::Functor& functor);
+
+    /// Invoke each deferred function, including those deferred while
+    /// draining, until no function is deferred.
+    void drain();
+};
+
+/// This class mocks the ntci::StreamSocket interface. The test plays the
+/// role of the remote peer: it delivers data, a shutdown, or an error to
+/// the socket, and transmits the contents of the write queue of the socket
+/// to the remote peer. The write queue is subject to watermarks like that
+/// of a real socket. All events are announced when the loop is drained,
+/// except the completion of the shutdown sequence initiated by a call to
+/// 'shutdown', which is announced before that call returns, as a real
+/// socket does when shut down from a thread driving its reactor.
+class StreamSocket : public ntci::StreamSocket,
+                     public ntccfg::Shared<StreamSocket>
+{
+    mutable bslmt::Mutex                       d_mutex;
+    test::Loop*                                d_loop_p;
+    bsl::shared_ptr<ntci::StreamSocketSession> d_session_sp;
+    bsl::shared_ptr<bdlbb::BlobBufferFactory>  d_blobBufferFactory_sp;
+    bdlbb::Blob                                d_readQueue;
+    bdlbb::Blob                                d_writeQueue;
+    bdlbb::Blob                                d_transmitted;
+    bsl::size_t                                d_writeQueueLowWatermark;
+    bsl::size_t                                d_writeQueueHighWatermark;
+    bool                                       d_writeQueueBreached;
+    bool                                       d_receiveBlocked;
+    bsl::size_t                                d_numFlowControlApplied;
+    bool                                       d_shutdownSend;
+    bool                                       d_shutdownReceive;
+    bool                                       d_shutdownComplete;
+    bool                                       d_closed;
+    bsl::shared_ptr<ntci::Strand>              d_strand_sp;
+    bslma::Allocator*                          d_allocator_p;
+
+  private:
+    StreamSocket(const StreamSocket&) BSLS_KEYWORD_DELETED;
+    StreamSocket& operator=(const StreamSocket&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Announce to the session that the read queue has risen to its low
+    /// watermark, unless flow control is applied to the receive direction.
+    void announceReadQueueLowWatermark();
+
+    /// Announce to the session that the write queue has drained to its low
+    /// watermark.
+    void announceWriteQueueLowWatermark();
+
+    /// Announce to the session that the write queue has breached its high
+    /// watermark.
+    void announceWriteQueueHighWatermark();
+
+    /// Announce to the session that the socket is shut down for reading.
+    void announceShutdownReceive();
+
+    /// Announce to the session the completion of the shutdown sequence.
+    void announceShutdownComplete();
+
+    /// Announce the specified 'error' to the session.
+    void announceError(const ntsa::Error& error);
+
+    /// Return true if both directions are shut down and the completion of
+    /// the shutdown sequence has not yet been announced, and mark it
+    /// announced, otherwise return false. The behavior is undefined unless
+    /// 'd_mutex' is locked.
+    bool privateComplete();
+
+  public:
+    /// Create a new stream socket whose events are deferred to the
+    /// specified 'loop'. Optionally specify a 'basicAllocator' used to
+    /// supply memory. If 'basicAllocator' is 0, the currently installed
+    /// default allocator is used.
+    explicit StreamSocket(test::Loop*       loop,
+                          bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~StreamSocket() BSLS_KEYWORD_OVERRIDE;
+
+    /// Append the specified 'data' received from the remote peer to the
+    /// read queue.
+    void deliver(const bsl::string& data);
+
+    /// Shut down the socket for reading, as if the remote peer shut down
+    /// its side of the connection for writing.
+    void deliverShutdown();
+
+    /// Announce the specified 'error' to the session, as if the connection
+    /// failed.
+    void deliverError(const ntsa::Error& error);
+
+    /// Transmit at most the specified 'maxBytes' from the front of the
+    /// write queue to the remote peer.
+    void transmit(bsl::size_t maxBytes);
+
+    /// Return the data transmitted to the remote peer.
+    bsl::string transmitted() const;
+
+    /// Return true if the remote peer has observed the socket shut down for
+    /// writing, i.e., the socket is shut down for sending and the write
+    /// queue is empty, otherwise return false.
+    bool isShutdownTransmitted() const;
+
+    /// Return true if flow control is applied to the receive direction,
+    /// otherwise return false.
+    bool isReceiveBlocked() const;
+
+    /// Return the number of times flow control has been applied.
+    bsl::size_t numFlowControlApplied() const;
+
+    /// Return true if the socket is closed, otherwise return false.
+    bool isClosed() const;
+
+    /// Enqueue the specified 'data' onto the write queue. Return the error,
+    /// notably 'ntsa::Error::e_WOULD_BLOCK' if the write queue is at or
+    /// above its high watermark.
+    ntsa::Error send(const bdlbb::Blob&       data,
+                     const ntca::SendOptions& options) BSLS_KEYWORD_OVERRIDE;
+
+    /// Dequeue the read queue into the specified 'data'. Return the error,
+    /// notably 'ntsa::Error::e_WOULD_BLOCK' if the read queue is empty and
+    /// 'ntsa::Error::e_EOF' if it is empty and the socket is shut down for
+    /// reading.
+    ntsa::Error receive(ntca::ReceiveContext*       context,
+                        bdlbb::Blob*                data,
+                        const ntca::ReceiveOptions& options)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Register the specified 'session'. Return the error.
+    ntsa::Error registerSession(
+        const bsl::shared_ptr<ntci::StreamSocketSession>& session)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Deregister the session. Return the error.
+    ntsa::Error deregisterSession() BSLS_KEYWORD_OVERRIDE;
+
+    /// Set the write queue low watermark to the specified 'lowWatermark'
+    /// and the write queue high watermark to the specified 'highWatermark'.
+    /// Return the error.
+    ntsa::Error setWriteQueueWatermarks(bsl::size_t lowWatermark,
+                                        bsl::size_t highWatermark)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Apply flow control in the specified 'direction'. Return the error.
+    ntsa::Error applyFlowControl(ntca::FlowControlType::Value direction,
+                                 ntca::FlowControlMode::Value mode)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Relax flow control in the specified 'direction', announcing the read
+    /// queue low watermark if data was received while flow control was
+    /// applied. Return the error.
+    ntsa::Error relaxFlowControl(ntca::FlowControlType::Value direction)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Shut down the socket in the specified 'direction' according to the
+    /// specified 'mode', announcing the completion of the shutdown sequence
+    /// before returning if both directions are then shut down. Return the
+    /// error.
+    ntsa::Error shutdown(ntsa::ShutdownType::Value direction,
+                         ntsa::ShutdownMode::Value mode)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Close the socket.
+    void close() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the size of the write queue.
+    bsl::size_t writeQueueSize() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return an invalid handle.
+    ntsa::Handle handle() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the null strand.
+    const bsl::shared_ptr<ntci::Strand>& strand() const
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the current elapsed time since the Unix epoch.
+    bsls::TimeInterval currentTime() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return a new blob.
+    bsl::shared_ptr<bdlbb::Blob> createIncomingBlob() BSLS_KEYWORD_OVERRIDE;
+
+    /// Return a new blob.
+    bsl::shared_ptr<bdlbb::Blob> createOutgoingBlob() BSLS_KEYWORD_OVERRIDE;
+
+    /// Load into the specified 'blobBuffer' a new blob buffer.
+    void createIncomingBlobBuffer(bdlbb::BlobBuffer* blobBuffer)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Load into the specified 'blobBuffer' a new blob buffer.
+    void createOutgoingBlobBuffer(bdlbb::BlobBuffer* blobBuffer)
+        BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the blob buffer factory.
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&
+    incomingBlobBufferFactory() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the blob buffer factory.
+    const bsl::shared_ptr<bdlbb::BlobBufferFactory>&
+    outgoingBlobBufferFactory() const BSLS_KEYWORD_OVERRIDE;
+
+    // The following functions are assumed to be never called.
+
+    void execute(const Functor&) BSLS_KEYWORD_OVERRIDE;
+    void moveAndExecute(FunctorSequence*,
+                        const Functor&) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Strand> createStrand(
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&,
+        const bsl::shared_ptr<ntci::TimerSession>&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::Timer> createTimer(
+        const ntca::TimerOptions&,
+        const ntci::TimerCallback&,
+        bslma::Allocator*) BSLS_KEYWORD_OVERRIDE;
+    void close(const ntci::CloseFunction&) BSLS_KEYWORD_OVERRIDE;
+    void close(const ntci::CloseCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const ntsa::Endpoint&,
+                     const ntca::BindOptions&,
+                     const ntci::BindFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const ntsa::Endpoint&,
+                     const ntca::BindOptions&,
+                     const ntci::BindCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const bsl::string&,
+                     const ntca::BindOptions&,
+                     const ntci::BindFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error bind(const bsl::string&,
+                     const ntca::BindOptions&,
+                     const ntci::BindCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::BindToken&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error connect(const ntsa::Endpoint&,
+                        const ntca::ConnectOptions&,
+                        const ntci::ConnectFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error connect(const ntsa::Endpoint&,
+                        const ntca::ConnectOptions&,
+                        const ntci::ConnectCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error connect(const bsl::string&,
+                        const ntca::ConnectOptions&,
+                        const ntci::ConnectFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error connect(const bsl::string&,
+                        const ntca::ConnectOptions&,
+                        const ntci::ConnectCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::ConnectToken&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::Encryption>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::Encryption>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::EncryptionClient>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::EncryptionClient>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::EncryptionServer>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error upgrade(const bsl::shared_ptr<ntci::EncryptionServer>&,
+                        const ntca::UpgradeOptions&,
+                        const ntci::UpgradeCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::UpgradeToken&) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::EncryptionCertificate> sourceCertificate() const
+        BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::EncryptionCertificate> remoteCertificate() const
+        BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::EncryptionKey> privateKey() const
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const ntsa::Data&,
+                     const ntca::SendOptions&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const bdlbb::Blob&,
+                     const ntca::SendOptions&,
+                     const ntci::SendFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const bdlbb::Blob&,
+                     const ntca::SendOptions&,
+                     const ntci::SendCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const ntsa::Data&,
+                     const ntca::SendOptions&,
+                     const ntci::SendFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error send(const ntsa::Data&,
+                     const ntca::SendOptions&,
+                     const ntci::SendCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::SendToken&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error receive(const ntca::ReceiveOptions&,
+                        const ntci::ReceiveFunction&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error receive(const ntca::ReceiveOptions&,
+                        const ntci::ReceiveCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error cancel(const ntca::ReceiveToken&) BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntsa::Data> createIncomingData() BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntsa::Data> createOutgoingData() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(ntsa::Transport::Value) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(ntsa::Transport::Value,
+                     ntsa::Handle) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(
+        ntsa::Transport::Value,
+        const bsl::shared_ptr<ntsi::StreamSocket>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(
+        ntsa::Transport::Value,
+        ntsa::Handle,
+        const bsl::shared_ptr<ntci::ListenerSocket>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error open(
+        ntsa::Transport::Value,
+        const bsl::shared_ptr<ntsi::StreamSocket>&,
+        const bsl::shared_ptr<ntci::ListenerSocket>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerResolver(
+        const bsl::shared_ptr<ntci::Resolver>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error deregisterResolver() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerManager(
+        const bsl::shared_ptr<ntci::StreamSocketManager>&)
+        BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error deregisterManager() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerSessionCallback(
+        const ntci::StreamSocket::SessionCallback&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error registerSessionCallback(
+        const ntci::StreamSocket::SessionCallback&,
+        const bsl::shared_ptr<ntci::Strand>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setWriteRateLimiter(
+        const bsl::shared_ptr<ntci::RateLimiter>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setWriteQueueLowWatermark(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setWriteQueueHighWatermark(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setReadRateLimiter(
+        const bsl::shared_ptr<ntci::RateLimiter>&) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setReadQueueLowWatermark(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setReadQueueHighWatermark(bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error setReadQueueWatermarks(bsl::size_t,
+                                       bsl::size_t) BSLS_KEYWORD_OVERRIDE;
+    ntsa::Error downgrade() BSLS_KEYWORD_OVERRIDE;
+    ntsa::Transport::Value transport() const BSLS_KEYWORD_OVERRIDE;
+    ntsa::Endpoint sourceEndpoint() const BSLS_KEYWORD_OVERRIDE;
+    ntsa::Endpoint remoteEndpoint() const BSLS_KEYWORD_OVERRIDE;
+    bsl::shared_ptr<ntci::ListenerSocket> acceptor() const
+        BSLS_KEYWORD_OVERRIDE;
+    bslmt::ThreadUtil::Handle threadHandle() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t threadIndex() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t readQueueSize() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t readQueueLowWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t readQueueHighWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t writeQueueLowWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t writeQueueHighWatermark() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t totalBytesSent() const BSLS_KEYWORD_OVERRIDE;
+    bsl::size_t totalBytesReceived() const BSLS_KEYWORD_OVERRIDE;
+};
+
+/// Describe the completion of a relay.
+struct Result {
+    /// Create a new result of an incomplete relay.
+    Result();
+
+    bool        d_complete;
+    ntsa::Error d_error;
+};
+
+/// Record in the specified 'result' the completion of a relay with the
+/// specified 'error'.
+void processComplete(test::Result* result, const ntsa::Error& error);
+
+/// Return the callback that records the completion of a relay in the
+/// specified 'result'.
+ntci::StreamSocketRelay::Callback createCallback(test::Result* result);
+
+/// Return a new relay between the specified 'first' and 'second' sockets
+/// allocated using the specified 'basicAllocator'.
+bsl::shared_ptr<ntci::StreamSocketRelay> createRelay(
+    const bsl::shared_ptr<test::StreamSocket>& first,
+    const bsl::shared_ptr<test::StreamSocket>& second,
+    bslma::Allocator*                          basicAllocator);
+
+Loop::Loop(bslma::Allocator* basicAllocator)
+: d_mutex()
+, d_functorQueue(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+Loop::~Loop()
+{
+    NTCCFG_TEST_TRUE(d_functorQueue.empty());
+}
+
+void Loop::execute(const ntci::Executor::Functor& functor)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_functorQueue.push_back(functor);
+}
+
+void Loop::drain()
+{
+    while (true) {
+        FunctorQueue functorQueue(d_allocator_p);
+        {
+            bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+            functorQueue.swap(d_functorQueue);
+        }
+
+        if (functorQueue.empty()) {
+            break;
+        }
+
+        for (FunctorQueue::iterator it = functorQueue.begin();
+             it != functorQueue.end();
+             ++it)
+        {
+            (*it)();
+        }
+    }
+}
+
+void StreamSocket::announceReadQueueLowWatermark()
+{
+    bsl::shared_ptr<ntci::StreamSocketSession> session;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (d_closed || d_receiveBlocked) {
+            return;
+        }
+
+        session = d_session_sp;
+    }
+
+    if (session) {
+        ntca::ReadQueueEvent event;
+        event.setType(ntca::ReadQueueEventType::e_LOW_WATERMARK);
+
+        session->processReadQueueLowWatermark(this->getSelf(this), event);
+    }
+}
+
+void StreamSocket::announceWriteQueueLowWatermark()
+{
+    bsl::shared_ptr<ntci::StreamSocketSession> session;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (d_closed) {
+            return;
+        }
+
+        session = d_session_sp;
+    }
+
+    if (session) {
+        ntca::WriteQueueEvent event;
+        event.setType(ntca::WriteQueueEventType::e_LOW_WATERMARK);
+
+        session->processWriteQueueLowWatermark(this->getSelf(this), event);
+    }
+}
+
+void StreamSocket::announceWriteQueueHighWatermark()
+{
+    bsl::shared_ptr<ntci::StreamSocketSession> session;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (d_closed) {
+            return;
+        }
+
+        session = d_session_sp;
+    }
+
+    if (session) {
+        ntca::WriteQueueEvent event;
+        event.setType(ntca::WriteQueueEventType::e_HIGH_WATERMARK);
+
+        session->processWriteQueueHighWatermark(this->getSelf(this), event);
+    }
+}
+
+void StreamSocket::announceShutdownReceive()
+{
+    bsl::shared_ptr<ntci::StreamSocketSession> session;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (d_closed) {
+            return;
+        }
+
+        session = d_session_sp;
+    }
+
+    if (session) {
+        ntca::ShutdownEvent event;
+        event.setType(ntca::ShutdownEventType::e_RECEIVE);
+
+        session->processShutdownReceive(this->getSelf(this), event);
+    }
+}
+
+void StreamSocket::announceShutdownComplete()
+{
+    bsl::shared_ptr<ntci::StreamSocketSession> session;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        session = d_session_sp;
+    }
+
+    if (session) {
+        ntca::ShutdownEvent event;
+        event.setType(ntca::ShutdownEventType::e_COMPLETE);
+
+        session->processShutdownComplete(this->getSelf(this), event);
+    }
+}
+
+void StreamSocket::announceError(const ntsa::Error& error)
+{
+    bsl::shared_ptr<ntci::StreamSocketSession> session;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (d_closed) {
+            return;
+        }
+
+        session = d_session_sp;
+    }
+
+    if (session) {
+        ntca::ErrorContext context;
+        context.setError(error);
+
+        ntca::ErrorEvent event;
+        event.setType(ntca::ErrorEventType::e_TRANSPORT);
+        event.setContext(context);
+
+        session->processError(this->getSelf(this), event);
+    }
+}
+
+bool StreamSocket::privateComplete()
+{
+    if (d_shutdownSend && d_shutdownReceive && !d_shutdownComplete) {
+        d_shutdownComplete = true;
+        return true;
+    }
+
+    return false;
+}
+
+StreamSocket::StreamSocket(test::Loop* loop, bslma::Allocator* basicAllocator)
+: d_mutex()
+, d_loop_p(loop)
+, d_session_sp()
+, d_blobBufferFactory_sp()
+, d_readQueue(basicAllocator)
+, d_writeQueue(basicAllocator)
+, d_transmitted(basicAllocator)
+, d_writeQueueLowWatermark(0)
+, d_writeQueueHighWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_writeQueueBreached(false)
+, d_receiveBlocked(false)
+, d_numFlowControlApplied(0)
+, d_shutdownSend(false)
+, d_shutdownReceive(false)
+, d_shutdownComplete(false)
+, d_closed(false)
+, d_strand_sp()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    bsl::shared_ptr<bdlbb::SimpleBlobBufferFactory> blobBufferFactory;
+    blobBufferFactory.createInplace(d_allocator_p, 4096, d_allocator_p);
+
+    d_blobBufferFactory_sp = blobBufferFactory;
+}
+
+StreamSocket::~StreamSocket()
+{
+}
+
+void StreamSocket::deliver(const bsl::string& data)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        NTCCFG_TEST_FALSE(d_shutdownReceive);
+
+        bdlbb::BlobUtil::append(&d_readQueue,
+                                data.c_str(),
+                                static_cast<int>(data.size()));
+    }
+
+    d_loop_p->execute(
+        bdlf::BindUtil::bind(&StreamSocket::announceReadQueueLowWatermark,
+                             this->getSelf(this)));
+}
+
+void StreamSocket::deliverShutdown()
+{
+    bool complete;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        NTCCFG_TEST_FALSE(d_shutdownReceive);
+
+        d_shutdownReceive = true;
+        complete          = this->privateComplete();
+    }
+
+    d_loop_p->execute(
+        bdlf::BindUtil::bind(&StreamSocket::announceShutdownReceive,
+                             this->getSelf(this)));
+
+    if (complete) {
+        d_loop_p->execute(
+            bdlf::BindUtil::bind(&StreamSocket::announceShutdownComplete,
+                                 this->getSelf(this)));
+    }
+}
+
+void StreamSocket::deliverError(const ntsa::Error& error)
+{
+    d_loop_p->execute(bdlf::BindUtil::bind(&StreamSocket::announceError,
+                                           this->getSelf(this),
+                                           error));
+}
+
+void StreamSocket::transmit(bsl::size_t maxBytes)
+{
+    bool drained = false;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        const int numBytes = static_cast<int>(bsl::min(
+            maxBytes,
+            static_cast<bsl::size_t>(d_writeQueue.length())));
+
+        bdlbb::BlobUtil::append(&d_transmitted, d_writeQueue, 0, numBytes);
+        bdlbb::BlobUtil::erase(&d_writeQueue, 0, numBytes);
+
+        if (d_writeQueueBreached &&
+            static_cast<bsl::size_t>(d_writeQueue.length()) <=
+                d_writeQueueLowWatermark)
+        {
+            d_writeQueueBreached = false;
+            drained              = true;
+        }
+    }
+
+    if (drained) {
+        d_loop_p->execute(bdlf::BindUtil::bind(
+            &StreamSocket::announceWriteQueueLowWatermark,
+            this->getSelf(this)));
+    }
+}
+
+bsl::string StreamSocket::transmitted() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    bsl::string result(static_cast<bsl::size_t>(d_transmitted.length()),
+                       ' ');
+    if (!result.empty()) {
+        bdlbb::BlobUtil::copy(&result[0],
+                              d_transmitted,
+                              0,
+                              d_transmitted.length());
+    }
+
+    return result;
+}
+
+bool StreamSocket::isShutdownTransmitted() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_shutdownSend && d_writeQueue.length() == 0;
+}
+
+bool StreamSocket::isReceiveBlocked() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_receiveBlocked;
+}
+
+bsl::size_t StreamSocket::numFlowControlApplied() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_numFlowControlApplied;
+}
+
+bool StreamSocket::isClosed() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return d_closed;
+}
+
+ntsa::Error StreamSocket::send(const bdlbb::Blob&       data,
+                               const ntca::SendOptions& options)
+{
+    NTCCFG_WARNING_UNUSED(options);
+
+    bool breached = false;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (d_closed || d_shutdownSend) {
+            return ntsa::Error(ntsa::Error::e_CONNECTION_DEAD);
+        }
+
+        if (static_cast<bsl::size_t>(d_writeQueue.length()) >=
+            d_writeQueueHighWatermark)
+        {
+            d_writeQueueBreached = true;
+            return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+        }
+
+        bdlbb::BlobUtil::append(&d_writeQueue, data);
+
+        if (!d_writeQueueBreached &&
+            static_cast<bsl::size_t>(d_writeQueue.length()) >
+                d_writeQueueHighWatermark)
+        {
+            d_writeQueueBreached = true;
+            breached             = true;
+        }
+    }
+
+    if (breached) {
+        d_loop_p->execute(bdlf::BindUtil::bind(
+            &StreamSocket::announceWriteQueueHighWatermark,
+            this->getSelf(this)));
+    }
+
+    return ntsa::Error();
+}
+
+ntsa::Error StreamSocket::receive(ntca::ReceiveContext*       context,
+                                  bdlbb::Blob*                data,
+                                  const ntca::ReceiveOptions& options)
+{
+    NTCCFG_WARNING_UNUSED(context);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    const bsl::size_t size = static_cast<bsl::size_t>(d_readQueue.length());
+
+    if (size == 0) {
+        if (d_shutdownReceive) {
+            return ntsa::Error(ntsa::Error::e_EOF);
+        }
+
+        return ntsa::Error(ntsa::Error::e_WOULD_BLOCK);
+    }
+
+    const int numBytes =
+        static_cast<int>(bsl::min(size, options.maxSize()));
+
+    bdlbb::BlobUtil::append(data, d_readQueue, 0, numBytes);
+    bdlbb::BlobUtil::erase(&d_readQueue, 0, numBytes);
+
+    return ntsa::Error();
+}
+
+ntsa::Error StreamSocket::registerSession(
+    const bsl::shared_ptr<ntci::StreamSocketSession>& session)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_session_sp = session;
+    return ntsa::Error();
+}
+
+ntsa::Error StreamSocket::deregisterSession()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    d_session_sp.reset();
+    return ntsa::Error();
+}
+
+ntsa::Error StreamSocket::setWriteQueueWatermarks(bsl::size_t lowWatermark,
+                                                  bsl::size_t highWatermark)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    d_writeQueueLowWatermark  = lowWatermark;
+    d_writeQueueHighWatermark = highWatermark;
+
+    return ntsa::Error();
+}
+
+ntsa::Error StreamSocket::applyFlowControl(
+    ntca::FlowControlType::Value direction,
+    ntca::FlowControlMode::Value mode)
+{
+    NTCCFG_WARNING_UNUSED(mode);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (direction != ntca::FlowControlType::e_SEND) {
+        d_receiveBlocked = true;
+    }
+
+    ++d_numFlowControlApplied;
+
+    return ntsa::Error();
+}
+
+ntsa::Error StreamSocket::relaxFlowControl(
+    ntca::FlowControlType::Value direction)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (direction == ntca::FlowControlType::e_SEND ||
+            !d_receiveBlocked)
+        {
+            return ntsa::Error();
+        }
+
+        d_receiveBlocked = false;
+
+        if (d_readQueue.length() == 0) {
+            return ntsa::Error();
+        }
+    }
+
+    d_loop_p->execute(
+        bdlf::BindUtil::bind(&StreamSocket::announceReadQueueLowWatermark,
+                             this->getSelf(this)));
+
+    return ntsa::Error();
+}
+
+ntsa::Error StreamSocket::shutdown(ntsa::ShutdownType::Value direction,
+                                   ntsa::ShutdownMode::Value mode)
+{
+    bool complete;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (direction != ntsa::ShutdownType::e_RECEIVE) {
+            d_shutdownSend = true;
+            if (mode == ntsa::ShutdownMode::e_IMMEDIATE) {
+                d_writeQueue.removeAll();
+            }
+        }
+
+        if (direction != ntsa::ShutdownType::e_SEND) {
+            d_shutdownReceive = true;
+            d_readQueue.removeAll();
+        }
+
+        complete = this->privateComplete();
+    }
+
+    if (complete) {
+        this->announceShutdownComplete();
+    }
+
+    return ntsa::Error();
+}
+
+void StreamSocket::close()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    d_closed = true;
+    d_readQueue.removeAll();
+    d_writeQueue.removeAll();
+}
+
+bsl::size_t StreamSocket::writeQueueSize() const
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    return static_cast<bsl::size_t>(d_writeQueue.length());
+}
+
+ntsa::Handle StreamSocket::handle() const
+{
+    return ntsa::k_INVALID_HANDLE;
+}
+
+const bsl::shared_ptr<ntci::Strand>& StreamSocket::strand() const
+{
+    return d_strand_sp;
+}
+
+bsls::TimeInterval StreamSocket::currentTime() const
+{
+    return bdlt::CurrentTime::now();
+}
+
+bsl::shared_ptr<bdlbb::Blob> StreamSocket::createIncomingBlob()
+{
+    bsl::shared_ptr<bdlbb::Blob> blob;
+    blob.createInplace(d_allocator_p,
+                       d_blobBufferFactory_sp.get(),
+                       d_allocator_p);
+    return blob;
+}
+
+bsl::shared_ptr<bdlbb::Blob> StreamSocket::createOutgoingBlob()
+{
+    return this->createIncomingBlob();
+}
+
+void StreamSocket::createIncomingBlobBuffer(bdlbb::BlobBuffer* blobBuffer)
+{
+    d_blobBufferFactory_sp->allocate(blobBuffer);
+}
+
+void StreamSocket::createOutgoingBlobBuffer(bdlbb::BlobBuffer* blobBuffer)
+{
+    d_blobBufferFactory_sp->allocate(blobBuffer);
+}
+
+const bsl::shared_ptr<bdlbb::BlobBufferFactory>& StreamSocket::
+    incomingBlobBufferFactory() const
+{
+    return d_blobBufferFactory_sp;
+}
+
+const bsl::shared_ptr<bdlbb::BlobBufferFactory>& StreamSocket::
+    outgoingBlobBufferFactory() const
+{
+    return d_blobBufferFactory_sp;
+}
+
+void StreamSocket::execute(const Functor&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void StreamSocket::moveAndExecute(FunctorSequence*, const Functor&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+bsl::shared_ptr<ntci::Strand> StreamSocket::createStrand(bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Strand>();
+}
+
+bsl::shared_ptr<ntci::Timer> StreamSocket::createTimer(
+    const ntca::TimerOptions&,
+    const bsl::shared_ptr<ntci::TimerSession>&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Timer>();
+}
+
+bsl::shared_ptr<ntci::Timer> StreamSocket::createTimer(
+    const ntca::TimerOptions&,
+    const ntci::TimerCallback&,
+    bslma::Allocator*)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::Timer>();
+}
+
+void StreamSocket::close(const ntci::CloseFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+void StreamSocket::close(const ntci::CloseCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+}
+
+ntsa::Error StreamSocket::bind(const ntsa::Endpoint&,
+                               const ntca::BindOptions&,
+                               const ntci::BindFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::bind(const ntsa::Endpoint&,
+                               const ntca::BindOptions&,
+                               const ntci::BindCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::bind(const bsl::string&,
+                               const ntca::BindOptions&,
+                               const ntci::BindFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::bind(const bsl::string&,
+                               const ntca::BindOptions&,
+                               const ntci::BindCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::cancel(const ntca::BindToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::connect(const ntsa::Endpoint&,
+                                  const ntca::ConnectOptions&,
+                                  const ntci::ConnectFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::connect(const ntsa::Endpoint&,
+                                  const ntca::ConnectOptions&,
+                                  const ntci::ConnectCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::connect(const bsl::string&,
+                                  const ntca::ConnectOptions&,
+                                  const ntci::ConnectFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::connect(const bsl::string&,
+                                  const ntca::ConnectOptions&,
+                                  const ntci::ConnectCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::cancel(const ntca::ConnectToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(const bsl::shared_ptr<ntci::Encryption>&,
+                                  const ntca::UpgradeOptions&,
+                                  const ntci::UpgradeFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(const bsl::shared_ptr<ntci::Encryption>&,
+                                  const ntca::UpgradeOptions&,
+                                  const ntci::UpgradeCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(
+    const bsl::shared_ptr<ntci::EncryptionClient>&,
+    const ntca::UpgradeOptions&,
+    const ntci::UpgradeFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(
+    const bsl::shared_ptr<ntci::EncryptionClient>&,
+    const ntca::UpgradeOptions&,
+    const ntci::UpgradeCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(
+    const bsl::shared_ptr<ntci::EncryptionServer>&,
+    const ntca::UpgradeOptions&,
+    const ntci::UpgradeFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::upgrade(
+    const bsl::shared_ptr<ntci::EncryptionServer>&,
+    const ntca::UpgradeOptions&,
+    const ntci::UpgradeCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::cancel(const ntca::UpgradeToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+bsl::shared_ptr<ntci::EncryptionCertificate> StreamSocket::
+    sourceCertificate() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::EncryptionCertificate>();
+}
+
+bsl::shared_ptr<ntci::EncryptionCertificate> StreamSocket::
+    remoteCertificate() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::EncryptionCertificate>();
+}
+
+bsl::shared_ptr<ntci::EncryptionKey> StreamSocket::privateKey() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::EncryptionKey>();
+}
+
+ntsa::Error StreamSocket::send(const ntsa::Data&, const ntca::SendOptions&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::send(const bdlbb::Blob&,
+                               const ntca::SendOptions&,
+                               const ntci::SendFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::send(const bdlbb::Blob&,
+                               const ntca::SendOptions&,
+                               const ntci::SendCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::send(const ntsa::Data&,
+                               const ntca::SendOptions&,
+                               const ntci::SendFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::send(const ntsa::Data&,
+                               const ntca::SendOptions&,
+                               const ntci::SendCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::cancel(const ntca::SendToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::receive(const ntca::ReceiveOptions&,
+                                  const ntci::ReceiveFunction&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::receive(const ntca::ReceiveOptions&,
+                                  const ntci::ReceiveCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::cancel(const ntca::ReceiveToken&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+bsl::shared_ptr<ntsa::Data> StreamSocket::createIncomingData()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntsa::Data>();
+}
+
+bsl::shared_ptr<ntsa::Data> StreamSocket::createOutgoingData()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntsa::Data>();
+}
+
+ntsa::Error StreamSocket::open()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::open(ntsa::Transport::Value)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::open(ntsa::Transport::Value, ntsa::Handle)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::open(ntsa::Transport::Value,
+                               const bsl::shared_ptr<ntsi::StreamSocket>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::open(ntsa::Transport::Value,
+                               ntsa::Handle,
+                               const bsl::shared_ptr<ntci::ListenerSocket>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::open(ntsa::Transport::Value,
+                               const bsl::shared_ptr<ntsi::StreamSocket>&,
+                               const bsl::shared_ptr<ntci::ListenerSocket>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::registerResolver(
+    const bsl::shared_ptr<ntci::Resolver>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::deregisterResolver()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::registerManager(
+    const bsl::shared_ptr<ntci::StreamSocketManager>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::deregisterManager()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::registerSessionCallback(
+    const ntci::StreamSocket::SessionCallback&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::registerSessionCallback(
+    const ntci::StreamSocket::SessionCallback&,
+    const bsl::shared_ptr<ntci::Strand>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setWriteRateLimiter(
+    const bsl::shared_ptr<ntci::RateLimiter>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setWriteQueueLowWatermark(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setWriteQueueHighWatermark(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setReadRateLimiter(
+    const bsl::shared_ptr<ntci::RateLimiter>&)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setReadQueueLowWatermark(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setReadQueueHighWatermark(bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::setReadQueueWatermarks(bsl::size_t, bsl::size_t)
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error StreamSocket::downgrade()
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Transport::Value StreamSocket::transport() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Transport::e_UNDEFINED;
+}
+
+ntsa::Endpoint StreamSocket::sourceEndpoint() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Endpoint();
+}
+
+ntsa::Endpoint StreamSocket::remoteEndpoint() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return ntsa::Endpoint();
+}
+
+bsl::shared_ptr<ntci::ListenerSocket> StreamSocket::acceptor() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bsl::shared_ptr<ntci::ListenerSocket>();
+}
+
+bslmt::ThreadUtil::Handle StreamSocket::threadHandle() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return bslmt::ThreadUtil::invalidHandle();
+}
+
+bsl::size_t StreamSocket::threadIndex() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::readQueueSize() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::readQueueLowWatermark() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::readQueueHighWatermark() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::writeQueueLowWatermark() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::writeQueueHighWatermark() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::totalBytesSent() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+bsl::size_t StreamSocket::totalBytesReceived() const
+{
+    NTCCFG_TEST_ASSERT(false);
+    return 0;
+}
+
+Result::Result()
+: d_complete(false)
+, d_error()
+{
+}
+
+void processComplete(test::Result* result, const ntsa::Error& error)
+{
+    NTCCFG_TEST_FALSE(result->d_complete);
+
+    result->d_complete = true;
+    result->d_error    = error;
+}
+
+ntci::StreamSocketRelay::Callback createCallback(test::Result* result)
+{
+    return bdlf::BindUtil::bind(&test::processComplete,
+                                result,
+                                bdlf::PlaceHolders::_1);
+}
+
+bsl::shared_ptr<ntci::StreamSocketRelay> createRelay(
+    const bsl::shared_ptr<test::StreamSocket>& first,
+    const bsl::shared_ptr<test::StreamSocket>& second,
+    bslma::Allocator*                          basicAllocator)
+{
+    bsl::shared_ptr<ntcu::StreamSocketRelay> relay;
+    relay.createInplace(basicAllocator, first, second, basicAllocator);
+    return relay;
+}
+
+}  // close namespace test
+
+NTCCFG_TEST_CASE(1)
+{
+    // Concern: Data is forwarded in both directions, including data
+    // received before the relay is started.
+    // Plan: Deliver data to each socket and ensure it is transmitted by the
+    // other.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        test::Loop loop(&ta);
+
+        bsl::shared_ptr<test::StreamSocket> first;
+        first.createInplace(&ta, &loop, &ta);
+
+        bsl::shared_ptr<test::StreamSocket> second;
+        second.createInplace(&ta, &loop, &ta);
+
+        first->deliver("early");
+
+        bsl::shared_ptr<ntci::StreamSocketRelay> relay =
+            test::createRelay(first, second, &ta);
+
+        test::Result result;
+        error = relay->start(test::createCallback(&result));
+        NTCCFG_TEST_OK(error);
+
+        NTCCFG_TEST_EQ(second->writeQueueSize(), 5);
+
+        error = relay->start(test::createCallback(&result));
+        NTCCFG_TEST_EQ(error, ntsa::Error(ntsa::Error::e_INVALID));
+
+        first->deliver("hello");
+        second->deliver("world!");
+
+        loop.drain();
+
+        first->transmit(test::k_MAX_BYTES);
+        second->transmit(test::k_MAX_BYTES);
+
+        NTCCFG_TEST_EQ(second->transmitted(), "earlyhello");
+        NTCCFG_TEST_EQ(first->transmitted(), "world!");
+
+        NTCCFG_TEST_EQ(relay->numBytesForwarded(), 10);
+        NTCCFG_TEST_EQ(relay->numBytesReturned(), 6);
+
+        NTCCFG_TEST_FALSE(result.d_complete);
+
+        relay->stop();
+        loop.drain();
+
+        NTCCFG_TEST_TRUE(result.d_complete);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(2)
+{
+    // Concern: Forwarding is subject to backpressure from the write queue
+    // watermarks of the destination.
+    // Plan: Breach the write queue high watermark of the destination and
+    // ensure flow control is applied to the source until the write queue
+    // drains to its low watermark, and that no data is lost.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        test::Loop loop(&ta);
+
+        bsl::shared_ptr<test::StreamSocket> first;
+        first.createInplace(&ta, &loop, &ta);
+
+        bsl::shared_ptr<test::StreamSocket> second;
+        second.createInplace(&ta, &loop, &ta);
+
+        error = second->setWriteQueueWatermarks(4, 8);
+        NTCCFG_TEST_OK(error);
+
+        bsl::shared_ptr<ntci::StreamSocketRelay> relay =
+            test::createRelay(first, second, &ta);
+
+        test::Result result;
+        error = relay->start(test::createCallback(&result));
+        NTCCFG_TEST_OK(error);
+
+        first->deliver(bsl::string(16, 'a'));
+        loop.drain();
+
+        NTCCFG_TEST_EQ(second->writeQueueSize(), 16);
+        NTCCFG_TEST_TRUE(first->isReceiveBlocked());
+        NTCCFG_TEST_EQ(first->numFlowControlApplied(), 1);
+
+        first->deliver(bsl::string(5, 'b'));
+        loop.drain();
+
+        NTCCFG_TEST_EQ(second->writeQueueSize(), 16);
+        NTCCFG_TEST_EQ(relay->numBytesForwarded(), 16);
+
+        second->transmit(12);
+        loop.drain();
+
+        NTCCFG_TEST_EQ(second->writeQueueSize(), 9);
+        NTCCFG_TEST_EQ(relay->numBytesForwarded(), 21);
+        NTCCFG_TEST_TRUE(first->isReceiveBlocked());
+        NTCCFG_TEST_EQ(first->numFlowControlApplied(), 2);
+
+        second->transmit(test::k_MAX_BYTES);
+        loop.drain();
+
+        NTCCFG_TEST_FALSE(first->isReceiveBlocked());
+        NTCCFG_TEST_EQ(second->transmitted(),
+                       bsl::string(16, 'a') + bsl::string(5, 'b'));
+
+        relay->stop();
+        loop.drain();
+
+        NTCCFG_TEST_TRUE(result.d_complete);
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(3)
+{
+    // Concern: A shutdown by one peer half-closes the relay: the other
+    // socket is shut down for sending once all data received before the
+    // shutdown is forwarded, and data continues to be forwarded in the
+    // other direction.
+    // Plan: Shut down each peer in turn and ensure the relay completes
+    // without error once both sockets are shut down.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        test::Loop loop(&ta);
+
+        bsl::shared_ptr<test::StreamSocket> first;
+        first.createInplace(&ta, &loop, &ta);
+
+        bsl::shared_ptr<test::StreamSocket> second;
+        second.createInplace(&ta, &loop, &ta);
+
+        bsl::shared_ptr<ntci::StreamSocketRelay> relay =
+            test::createRelay(first, second, &ta);
+
+        test::Result result;
+        error = relay->start(test::createCallback(&result));
+        NTCCFG_TEST_OK(error);
+
+        first->deliver("abc");
+        first->deliverShutdown();
+        loop.drain();
+
+        second->transmit(test::k_MAX_BYTES);
+
+        NTCCFG_TEST_EQ(second->transmitted(), "abc");
+        NTCCFG_TEST_TRUE(second->isShutdownTransmitted());
+        NTCCFG_TEST_FALSE(first->isShutdownTransmitted());
+        NTCCFG_TEST_FALSE(result.d_complete);
+
+        second->deliver("xyz");
+        loop.drain();
+
+        first->transmit(test::k_MAX_BYTES);
+
+        NTCCFG_TEST_EQ(first->transmitted(), "xyz");
+        NTCCFG_TEST_EQ(relay->numBytesReturned(), 3);
+        NTCCFG_TEST_FALSE(result.d_complete);
+
+        second->deliverShutdown();
+        loop.drain();
+
+        NTCCFG_TEST_TRUE(first->isShutdownTransmitted());
+
+        NTCCFG_TEST_TRUE(result.d_complete);
+        NTCCFG_TEST_OK(result.d_error);
+
+        NTCCFG_TEST_TRUE(first->isClosed());
+        NTCCFG_TEST_TRUE(second->isClosed());
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(4)
+{
+    // Concern: Stopping the relay shuts down both sockets and completes the
+    // relay with the error 'ntsa::Error::e_CANCELLED'.
+    // Plan: Stop the relay with data in flight. The mock sockets announce
+    // the completion of their shutdown before 'shutdown' returns, so the
+    // relay completes within 'stop', which requires the relay to not hold
+    // its lock while shutting down the sockets.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        test::Loop loop(&ta);
+
+        bsl::shared_ptr<test::StreamSocket> first;
+        first.createInplace(&ta, &loop, &ta);
+
+        bsl::shared_ptr<test::StreamSocket> second;
+        second.createInplace(&ta, &loop, &ta);
+
+        bsl::shared_ptr<ntci::StreamSocketRelay> relay =
+            test::createRelay(first, second, &ta);
+
+        test::Result result;
+        error = relay->start(test::createCallback(&result));
+        NTCCFG_TEST_OK(error);
+
+        first->deliver("abc");
+        loop.drain();
+
+        relay->stop();
+
+        NTCCFG_TEST_TRUE(result.d_complete);
+        NTCCFG_TEST_EQ(result.d_error, ntsa::Error(ntsa::Error::e_CANCELLED));
+
+        NTCCFG_TEST_TRUE(first->isClosed());
+        NTCCFG_TEST_TRUE(second->isClosed());
+
+        relay->stop();
+        loop.drain();
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_CASE(5)
+{
+    // Concern: An error on either socket fails the relay with that error.
+    // Plan: Announce an error on the second socket and ensure both sockets
+    // are shut down and closed and the callback receives the error.
+
+    ntccfg::TestAllocator ta;
+    {
+        ntsa::Error error;
+
+        test::Loop loop(&ta);
+
+        bsl::shared_ptr<test::StreamSocket> first;
+        first.createInplace(&ta, &loop, &ta);
+
+        bsl::shared_ptr<test::StreamSocket> second;
+        second.createInplace(&ta, &loop, &ta);
+
+        bsl::shared_ptr<ntci::StreamSocketRelay> relay =
+            test::createRelay(first, second, &ta);
+
+        test::Result result;
+        error = relay->start(test::createCallback(&result));
+        NTCCFG_TEST_OK(error);
+
+        second->deliverError(ntsa::Error(ntsa::Error::e_CONNECTION_RESET));
+        loop.drain();
+
+        NTCCFG_TEST_TRUE(result.d_complete);
+        NTCCFG_TEST_EQ(result.d_error,
+                       ntsa::Error(ntsa::Error::e_CONNECTION_RESET));
+
+        NTCCFG_TEST_TRUE(first->isClosed());
+        NTCCFG_TEST_TRUE(second->isClosed());
+    }
+    NTCCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTCCFG_TEST_DRIVER
+{
+    NTCCFG_TEST_REGISTER(1);
+    NTCCFG_TEST_REGISTER(2);
+    NTCCFG_TEST_REGISTER(3);
+    NTCCFG_TEST_REGISTER(4);
+    NTCCFG_TEST_REGISTER(5);
+}
+NTCCFG_TEST_DRIVER_END;
@@ -0,0 +1,43 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntsa_addressmap.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntsa_addressmap_cpp, "$Id$ $CSID$")
+
+namespace BloombergLP {
+namespace ntsa {
+
+bsl::uint64_t AddressHashUtil::hash(const ntsa::LocalName& value)
+{
+    // Compute the FNV-1a hash of the name, then mix the result so that the
+    // low-order bits, which select the slot of a hash table, depend on every
+    // character of the name.
+
+    const bslstl::StringRef name = value.value();
+
+    bsl::uint64_t result = 0xcbf29ce484222325ULL;
+
+    for (bsl::size_t i = 0; i < name.size(); ++i) {
+        result ^= static_cast<unsigned char>(name[i]);
+        result *= 0x100000001b3ULL;
+    }
+
+    return AddressHashUtil::mix(result);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,585 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTSA_ADDRESSMAP
+#define INCLUDED_NTSA_ADDRESSMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntsa_endpoint.h>
+#include <ntsa_ipaddress.h>
+#include <ntsa_ipendpoint.h>
+#include <ntsa_ipv4address.h>
+#include <ntsa_ipv6address.h>
+#include <ntsa_localname.h>
+#include <ntscfg_platform.h>
+#include <ntsscm_version.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bsls_assert.h>
+#include <bsls_keyword.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ntsa {
+
+/// Provide utilities to hash addresses and endpoints.
+///
+/// @details
+/// Provide a suite of functions to compute the hash of the value of IP
+/// addresses, local names, and endpoints directly from their
+/// representation, rather than by appending each member of each variant to a
+/// general purpose hash algorithm. Equal values always have equal hashes.
+///
+/// @par Thread Safety
+/// This struct is thread safe.
+///
+/// @ingroup module_ntsa_identity
+struct AddressHashUtil {
+    /// Return the specified 'value' with its bits thoroughly mixed, so that
+    /// every bit of the result depends on every bit of 'value'.
+    static bsl::uint64_t mix(bsl::uint64_t value);
+
+    /// Return the hash of the specified 'value'.
+    static bsl::uint64_t hash(const ntsa::Ipv4Address& value);
+
+    /// Return the hash of the specified 'value'.
+    static bsl::uint64_t hash(const ntsa::Ipv6Address& value);
+
+    /// Return the hash of the specified 'value'.
+    static bsl::uint64_t hash(const ntsa::IpAddress& value);
+
+    /// Return the hash of the specified 'value'.
+    static bsl::uint64_t hash(const ntsa::IpEndpoint& value);
+
+    /// Return the hash of the specified 'value'.
+    static bsl::uint64_t hash(const ntsa::LocalName& value);
+
+    /// Return the hash of the specified 'value'.
+    static bsl::uint64_t hash(const ntsa::Endpoint& value);
+};
+
+/// Provide a compact associative container keyed by addresses.
+///
+/// @details
+/// Provide an associative container of values keyed by IP addresses or
+/// endpoints, or any other type for which 'ntsa::AddressHashUtil::hash' is
+/// defined. The container is implemented as an open-addressing hash table
+/// using linear probing: keys and values are stored in contiguous arrays
+/// and a parallel array of 32-bit tags, each derived from the hash of the
+/// key in the corresponding slot, is scanned to find a key. A key is only
+/// compared for equality when its tag matches, so a lookup usually touches
+/// a single cache line of tags and a single key. Removal shifts subsequent
+/// entries backwards into the vacated slot, so the table never accumulates
+/// tombstones.
+///
+/// The table is grown, doubling its capacity, whenever an insertion would
+/// raise the load factor above 3/4. The addresses of values are not stable
+/// across insertions or removals.
+///
+/// @par Thread Safety
+/// This class is not thread safe.
+///
+/// @ingroup module_ntsa_identity
+template <typename KEY, typename VALUE>
+class AddressMap
+{
+    /// Define a type alias for a vector of tags.
+    typedef bsl::vector<bsl::uint32_t> TagVector;
+
+    /// Define a type alias for a vector of keys.
+    typedef bsl::vector<KEY> KeyVector;
+
+    /// Define a type alias for a vector of values.
+    typedef bsl::vector<VALUE> ValueVector;
+
+    enum {
+        /// The minimum number of slots allocated by a non-empty table.
+        k_MIN_CAPACITY = 16
+    };
+
+    TagVector         d_tags;
+    KeyVector         d_keys;
+    ValueVector       d_values;
+    bsl::size_t       d_size;
+    bsl::size_t       d_mask;
+    bslma::Allocator* d_allocator_p;
+
+  private:
+    AddressMap(const AddressMap&) BSLS_KEYWORD_DELETED;
+    AddressMap& operator=(const AddressMap&) BSLS_KEYWORD_DELETED;
+
+  private:
+    /// Return the non-zero tag of the specified 'key'.
+    static bsl::uint32_t tag(const KEY& key);
+
+    /// Load into the specified 'index' the slot of the specified 'key'
+    /// having the specified 'tag'. Return true if the 'key' is found, and
+    /// false otherwise.
+    bool privateFind(bsl::size_t*  index,
+                     const KEY&    key,
+                     bsl::uint32_t tag) const;
+
+    /// Load into the specified 'index' the slot of the specified 'key',
+    /// first inserting the 'key' associated with a default-constructed
+    /// value if the 'key' does not already exist. Return true if the 'key'
+    /// is inserted, and false if the 'key' already exists.
+    bool privateInsert(bsl::size_t* index, const KEY& key);
+
+    /// Remove the entry in the slot at the specified 'index', shifting
+    /// the entries that follow it in its probe sequence backwards.
+    void privateErase(bsl::size_t index);
+
+    /// Rebuild the table with the specified 'capacity' number of slots.
+    /// The behavior is undefined unless 'capacity' is a power of two
+    /// greater than the number of entries.
+    void privateRehash(bsl::size_t capacity);
+
+  public:
+    /// Create a new, empty container. Optionally specify a
+    /// 'basicAllocator' used to supply memory. If 'basicAllocator' is 0,
+    /// the currently installed default allocator is used.
+    explicit AddressMap(bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.
+    ~AddressMap();
+
+    /// Add the specified 'key' associated with the specified 'value' if
+    /// 'key' does not already exist. Return true if 'key' does not already
+    /// exist, and false otherwise.
+    bool add(const KEY& key, const VALUE& value);
+
+    /// Associate the specified 'key' with the specified 'value', replacing
+    /// the value previously associated with the 'key', if any.
+    void set(const KEY& key, const VALUE& value);
+
+    /// Return a reference to the modifiable value associated with the
+    /// specified 'key', first inserting the 'key' associated with a
+    /// default-constructed value if the 'key' does not already exist.
+    VALUE& operator[](const KEY& key);
+
+    /// Return a pointer to the modifiable value associated with the
+    /// specified 'key', or null if the 'key' does not exist. The pointer
+    /// is invalidated by the next insertion or removal.
+    VALUE* find(const KEY& key);
+
+    /// Remove the value associated with the specified 'key'. Return true
+    /// if a value associated with the 'key' previously existed, and false
+    /// otherwise.
+    bool remove(const KEY& key);
+
+    /// Remove the value associated with the specified 'key' and load it
+    /// into the specified 'result'. Return true if a value associated with
+    /// the 'key' previously existed, and false otherwise.
+    bool remove(VALUE* result, const KEY& key);
+
+    /// Ensure the container can hold at least the specified 'numEntries'
+    /// without growing.
+    void reserve(bsl::size_t numEntries);
+
+    /// Remove all entries from the container, retaining its capacity.
+    void clear();
+
+    /// Return a pointer to the non-modifiable value associated with the
+    /// specified 'key', or null if the 'key' does not exist. The pointer
+    /// is invalidated by the next insertion or removal.
+    const VALUE* find(const KEY& key) const;
+
+    /// Return true if a value is associated with the specified 'key', and
+    /// false otherwise.
+    bool contains(const KEY& key) const;
+
+    /// Append each key to the specified 'result'.
+    void keys(bsl::vector<KEY>* result) const;
+
+    /// Return the number of entries.
+    bsl::size_t size() const;
+
+    /// Return the number of slots in the table.
+    bsl::size_t capacity() const;
+
+    /// Return true if there are no entries, and false otherwise.
+    bool empty() const;
+};
+
+NTSCFG_INLINE
+bsl::uint64_t AddressHashUtil::mix(bsl::uint64_t value)
+{
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+NTSCFG_INLINE
+bsl::uint64_t AddressHashUtil::hash(const ntsa::Ipv4Address& value)
+{
+    return AddressHashUtil::mix(value.value());
+}
+
+NTSCFG_INLINE
+bsl::uint64_t AddressHashUtil::hash(const ntsa::Ipv6Address& value)
+{
+    return AddressHashUtil::mix(
+        value.byQword(0) ^
+        AddressHashUtil::mix(value.byQword(1) ^ value.scopeId()));
+}
+
+NTSCFG_INLINE
+bsl::uint64_t AddressHashUtil::hash(const ntsa::IpAddress& value)
+{
+    if (value.isV4()) {
+        return AddressHashUtil::hash(value.v4());
+    }
+    else if (value.isV6()) {
+        return AddressHashUtil::hash(value.v6());
+    }
+
+    return 0;
+}
+
+NTSCFG_INLINE
+bsl::uint64_t AddressHashUtil::hash(const ntsa::IpEndpoint& value)
+{
+    return AddressHashUtil::mix(AddressHashUtil::hash(value.host()) ^
+                                value.port());
+}
+
+NTSCFG_INLINE
+bsl::uint64_t AddressHashUtil::hash(const ntsa::Endpoint& value)
+{
+    if (value.isIp()) {
+        return AddressHashUtil::hash(value.ip());
+    }
+    else if (value.isLocal()) {
+        return AddressHashUtil::hash(value.local());
+    }
+
+    return 0;
+}
+
+template <typename KEY, typename VALUE>
+NTSCFG_INLINE bsl::uint32_t AddressMap<KEY, VALUE>::tag(const KEY& key)
+{
+    const bsl::uint64_t hash = ntsa::AddressHashUtil::hash(key);
+
+    const bsl::uint32_t result =
+        static_cast<bsl::uint32_t>(hash ^ (hash >> 32));
+
+    return result != 0 ? result : 1;
+}
+
+template <typename KEY, typename VALUE>
+NTSCFG_INLINE bool AddressMap<KEY, VALUE>::privateFind(
+    bsl::size_t*  index,
+    const KEY&    key,
+    bsl::uint32_t tag) const
+{
+    if (d_size == 0) {
+        return false;
+    }
+
+    bsl::size_t i = tag & d_mask;
+
+    while (true) {
+        const bsl::uint32_t current = d_tags[i];
+        if (current == 0) {
+            return false;
+        }
+
+        if (current == tag && d_keys[i] == key) {
+            *index = i;
+            return true;
+        }
+
+        i = (i + 1) & d_mask;
+    }
+}
+
+template <typename KEY, typename VALUE>
+bool AddressMap<KEY, VALUE>::privateInsert(bsl::size_t* index,
+                                           const KEY&   key)
+{
+    const bsl::uint32_t t = AddressMap::tag(key);
+
+    if (this->privateFind(index, key, t)) {
+        return false;
+    }
+
+    if ((d_size + 1) * 4 > d_tags.size() * 3) {
+        this->privateRehash(d_tags.empty() ? k_MIN_CAPACITY
+                                           : d_tags.size() * 2);
+    }
+
+    bsl::size_t i = t & d_mask;
+    while (d_tags[i] != 0) {
+        i = (i + 1) & d_mask;
+    }
+
+    d_tags[i] = t;
+    d_keys[i] = key;
+    ++d_size;
+
+    *index = i;
+    return true;
+}
+
+template <typename KEY, typename VALUE>
+void AddressMap<KEY, VALUE>::privateErase(bsl::size_t index)
+{
+    using bsl::swap;
+
+    // Shift each subsequent entry in the probe sequence into the hole,
+    // unless the slot to which the entry hashes lies cyclically after the
+    // hole, in which case the entry would no longer be found.
+
+    bsl::size_t hole = index;
+    bsl::size_t i    = index;
+
+    while (true) {
+        i = (i + 1) & d_mask;
+
+        const bsl::uint32_t current = d_tags[i];
+        if (current == 0) {
+            break;
+        }
+
+        const bsl::size_t home = current & d_mask;
+        if (((i - home) & d_mask) < ((i - hole) & d_mask)) {
+            continue;
+        }
+
+        d_tags[hole] = current;
+        d_keys[hole] = d_keys[i];
+        swap(d_values[hole], d_values[i]);
+
+        hole = i;
+    }
+
+    d_tags[hole]   = 0;
+    d_keys[hole]   = KEY();
+    d_values[hole] = VALUE();
+
+    --d_size;
+}
+
+template <typename KEY, typename VALUE>
+void AddressMap<KEY, VALUE>::privateRehash(bsl::size_t capacity)
+{
+    using bsl::swap;
+
+    BSLS_ASSERT((capacity & (capacity - 1)) == 0);
+    BSLS_ASSERT(capacity > d_size);
+
+    TagVector   tags(capacity, 0, d_allocator_p);
+    KeyVector   keys(capacity, KEY(), d_allocator_p);
+    ValueVector values(capacity, VALUE(), d_allocator_p);
+
+    const bsl::size_t mask = capacity - 1;
+
+    for (bsl::size_t i = 0; i < d_tags.size(); ++i) {
+        const bsl::uint32_t current = d_tags[i];
+        if (current == 0) {
+            continue;
+        }
+
+        bsl::size_t j = current & mask;
+        while (tags[j] != 0) {
+            j = (j + 1) & mask;
+        }
+
+        tags[j] = current;
+        keys[j] = d_keys[i];
+        swap(values[j], d_values[i]);
+    }
+
+    d_tags.swap(tags);
+    d_keys.swap(keys);
+    d_values.swap(values);
+
+    d_mask = mask;
+}
+
+template <typename KEY, typename VALUE>
+AddressMap<KEY, VALUE>::AddressMap(bslma::Allocator* basicAllocator)
+: d_tags(basicAllocator)
+, d_keys(basicAllocator)
+, d_values(basicAllocator)
+, d_size(0)
+, d_mask(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <typename KEY, typename VALUE>
+AddressMap<KEY, VALUE>::~AddressMap()
+{
+}
+
+template <typename KEY, typename VALUE>
+bool AddressMap<KEY, VALUE>::add(const KEY& key, const VALUE& value)
+{
+    bsl::size_t index;
+    if (!this->privateInsert(&index, key)) {
+        return false;
+    }
+
+    d_values[index] = value;
+    return true;
+}
+
+template <typename KEY, typename VALUE>
+void AddressMap<KEY, VALUE>::set(const KEY& key, const VALUE& value)
+{
+    bsl::size_t index;
+    this->privateInsert(&index, key);
+
+    d_values[index] = value;
+}
+
+template <typename KEY, typename VALUE>
+VALUE& AddressMap<KEY, VALUE>::operator[](const KEY& key)
+{
+    bsl::size_t index;
+    this->privateInsert(&index, key);
+
+    return d_values[index];
+}
+
+template <typename KEY, typename VALUE>
+NTSCFG_INLINE VALUE* AddressMap<KEY, VALUE>::find(const KEY& key)
+{
+    bsl::size_t index;
+    if (!this->privateFind(&index, key, AddressMap::tag(key))) {
+        return 0;
+    }
+
+    return &d_values[index];
+}
+
+template <typename KEY, typename VALUE>
+bool AddressMap<KEY, VALUE>::remove(const KEY& key)
+{
+    bsl::size_t index;
+    if (!this->privateFind(&index, key, AddressMap::tag(key))) {
+        return false;
+    }
+
+    this->privateErase(index);
+    return true;
+}
+
+template <typename KEY, typename VALUE>
+bool AddressMap<KEY, VALUE>::remove(VALUE* result, const KEY& key)
+{
+    using bsl::swap;
+
+    bsl::size_t index;
+    if (!this->privateFind(&index, key, AddressMap::tag(key))) {
+        return false;
+    }
+
+    swap(*result, d_values[index]);
+
+    this->privateErase(index);
+    return true;
+}
+
+template <typename KEY, typename VALUE>
+void AddressMap<KEY, VALUE>::reserve(bsl::size_t numEntries)
+{
+    if (numEntries * 4 <= d_tags.size() * 3) {
+        return;
+    }
+
+    bsl::size_t capacity = d_tags.empty() ? k_MIN_CAPACITY : d_tags.size();
+    while (numEntries * 4 > capacity * 3) {
+        capacity *= 2;
+    }
+
+    this->privateRehash(capacity);
+}
+
+template <typename KEY, typename VALUE>
+void AddressMap<KEY, VALUE>::clear()
+{
+    for (bsl::size_t i = 0; i < d_tags.size(); ++i) {
+        if (d_tags[i] != 0) {
+            d_tags[i]   = 0;
+            d_keys[i]   = KEY();
+            d_values[i] = VALUE();
+        }
+    }
+
+    d_size = 0;
+}
+
+template <typename KEY, typename VALUE>
+NTSCFG_INLINE const VALUE* AddressMap<KEY, VALUE>::find(const KEY& key) const
+{
+    bsl::size_t index;
+    if (!this->privateFind(&index, key, AddressMap::tag(key))) {
+        return 0;
+    }
+
+    return &d_values[index];
+}
+
+template <typename KEY, typename VALUE>
+NTSCFG_INLINE bool AddressMap<KEY, VALUE>::contains(const KEY& key) const
+{
+    bsl::size_t index;
+    return this->privateFind(&index, key, AddressMap::tag(key));
+}
+
+template <typename KEY, typename VALUE>
+void AddressMap<KEY, VALUE>::keys(bsl::vector<KEY>* result) const
+{
+    result->reserve(result->size() + d_size);
+
+    for (bsl::size_t i = 0; i < d_tags.size(); ++i) {
+        if (d_tags[i] != 0) {
+            result->push_back(d_keys[i]);
+        }
+    }
+}
+
+template <typename KEY, typename VALUE>
+NTSCFG_INLINE bsl::size_t AddressMap<KEY, VALUE>::size() const
+{
+    return d_size;
+}
+
+template <typename KEY, typename VALUE>
+NTSCFG_INLINE bsl::size_t AddressMap<KEY, VALUE>::capacity() const
+{
+    return d_tags.size();
+}
+
+template <typename KEY, typename VALUE>
+NTSCFG_INLINE bool AddressMap<KEY, VALUE>::empty() const
+{
+    return d_size == 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
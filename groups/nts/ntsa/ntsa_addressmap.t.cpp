@@ -0,0 +1,417 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntsa_addressmap.h>
+#include <ntscfg_test.h>
+#include <bslma_testallocator.h>
+#include <bsls_stopwatch.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace ntsa;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+//
+//-----------------------------------------------------------------------------
+
+// [ 1]
+//-----------------------------------------------------------------------------
+// [ 1]
+//-----------------------------------------------------------------------------
+
+namespace test {
+
+/// Return the IPv4 address having the specified 'index'.
+ntsa::IpAddress generateIpv4Address(bsl::uint32_t index)
+{
+    ntsa::Ipv4Address ipv4Address;
+    ipv4Address[0] = 10;
+    ipv4Address[1] = static_cast<bsl::uint8_t>(index >> 16);
+    ipv4Address[2] = static_cast<bsl::uint8_t>(index >> 8);
+    ipv4Address[3] = static_cast<bsl::uint8_t>(index);
+
+    return ntsa::IpAddress(ipv4Address);
+}
+
+/// Return the IPv6 address having the specified 'index'.
+ntsa::IpAddress generateIpv6Address(bsl::uint32_t index)
+{
+    ntsa::Ipv6Address ipv6Address;
+    ipv6Address[0]  = 0xFD;
+    ipv6Address[12] = static_cast<bsl::uint8_t>(index >> 24);
+    ipv6Address[13] = static_cast<bsl::uint8_t>(index >> 16);
+    ipv6Address[14] = static_cast<bsl::uint8_t>(index >> 8);
+    ipv6Address[15] = static_cast<bsl::uint8_t>(index);
+
+    return ntsa::IpAddress(ipv6Address);
+}
+
+/// Return the IP address having the specified 'index', alternating between
+/// the IPv4 and IPv6 address families.
+ntsa::IpAddress generateIpAddress(bsl::uint32_t index)
+{
+    if (index % 2 == 0) {
+        return test::generateIpv4Address(index / 2);
+    }
+    else {
+        return test::generateIpv6Address(index / 2);
+    }
+}
+
+}  // close namespace test
+
+NTSCFG_TEST_CASE(1)
+{
+    // Concern: Equal addresses and endpoints have equal hashes, and the
+    // hashes of distinct values are well distributed.
+    // Plan:
+
+    ntscfg::TestAllocator ta;
+    {
+        const ntsa::IpAddress ipv4Address("192.168.1.1");
+        const ntsa::IpAddress ipv6Address("fd00::1");
+
+        NTSCFG_TEST_EQ(ntsa::AddressHashUtil::hash(ipv4Address),
+                       ntsa::AddressHashUtil::hash(
+                           ntsa::IpAddress("192.168.1.1")));
+
+        NTSCFG_TEST_EQ(ntsa::AddressHashUtil::hash(ipv4Address),
+                       ntsa::AddressHashUtil::hash(ipv4Address.v4()));
+
+        NTSCFG_TEST_EQ(ntsa::AddressHashUtil::hash(ipv6Address),
+                       ntsa::AddressHashUtil::hash(
+                           ntsa::IpAddress("fd00::1")));
+
+        NTSCFG_TEST_EQ(ntsa::AddressHashUtil::hash(ipv6Address),
+                       ntsa::AddressHashUtil::hash(ipv6Address.v6()));
+
+        NTSCFG_TEST_NE(ntsa::AddressHashUtil::hash(ipv4Address),
+                       ntsa::AddressHashUtil::hash(
+                           ntsa::IpAddress("192.168.1.2")));
+
+        const ntsa::Endpoint ipEndpoint("192.168.1.1:12345");
+
+        NTSCFG_TEST_EQ(ntsa::AddressHashUtil::hash(ipEndpoint),
+                       ntsa::AddressHashUtil::hash(ipEndpoint.ip()));
+
+        NTSCFG_TEST_NE(ntsa::AddressHashUtil::hash(ipEndpoint),
+                       ntsa::AddressHashUtil::hash(
+                           ntsa::Endpoint("192.168.1.1:12346")));
+
+        ntsa::LocalName localName;
+        localName.setValue("/tmp/ntsa_addressmap.t.sock");
+
+        ntsa::LocalName otherLocalName;
+        otherLocalName.setValue("/tmp/ntsa_addressmap.t.sock");
+
+        NTSCFG_TEST_EQ(ntsa::AddressHashUtil::hash(localName),
+                       ntsa::AddressHashUtil::hash(otherLocalName));
+
+        NTSCFG_TEST_EQ(ntsa::AddressHashUtil::hash(ntsa::Endpoint(localName)),
+                       ntsa::AddressHashUtil::hash(localName));
+
+        // The low-order bits of the hashes of consecutive addresses, which
+        // select the slot of the table, should be evenly distributed.
+
+        const bsl::size_t k_NUM_BUCKETS   = 64;
+        const bsl::size_t k_NUM_ADDRESSES = k_NUM_BUCKETS * 64;
+
+        bsl::vector<bsl::size_t> bucketCount(k_NUM_BUCKETS, 0, &ta);
+
+        for (bsl::uint32_t i = 0; i < k_NUM_ADDRESSES; ++i) {
+            const bsl::uint64_t hash =
+                ntsa::AddressHashUtil::hash(test::generateIpv4Address(i));
+            ++bucketCount[hash % k_NUM_BUCKETS];
+        }
+
+        for (bsl::size_t i = 0; i < k_NUM_BUCKETS; ++i) {
+            NTSCFG_TEST_GT(bucketCount[i], 0);
+            NTSCFG_TEST_LT(bucketCount[i], 64 * 2);
+        }
+    }
+    NTSCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTSCFG_TEST_CASE(2)
+{
+    // Concern: The map keyed by IP addresses behaves like a node-based map
+    // through insertions, replacements, removals, and growth.
+    // Plan: Apply the same sequence of operations to an 'ntsa::AddressMap'
+    // and a 'bsl::map' and compare their contents after each operation.
+
+    ntscfg::TestAllocator ta;
+    {
+        typedef ntsa::AddressMap<ntsa::IpAddress, bsl::string> Map;
+        typedef bsl::map<ntsa::IpAddress, bsl::string>         Reference;
+
+        Map       map(&ta);
+        Reference reference(&ta);
+
+        NTSCFG_TEST_TRUE(map.empty());
+        NTSCFG_TEST_EQ(map.size(), 0);
+        NTSCFG_TEST_EQ(map.capacity(), 0);
+        NTSCFG_TEST_EQ(map.find(test::generateIpAddress(0)), 0);
+        NTSCFG_TEST_FALSE(map.remove(test::generateIpAddress(0)));
+
+        const bsl::uint32_t k_NUM_KEYS = 1000;
+
+        bsl::uint32_t seed = 1;
+
+        for (bsl::size_t iteration = 0; iteration < 20000; ++iteration) {
+            seed = seed * 1103515245 + 12345;
+
+            const bsl::uint32_t   index     = (seed >> 16) % k_NUM_KEYS;
+            const ntsa::IpAddress ipAddress = test::generateIpAddress(index);
+
+            bsl::ostringstream ss;
+            ss << "value-of-sufficient-length-to-allocate-" << iteration;
+            const bsl::string value(ss.str(), &ta);
+
+            switch ((seed >> 8) % 4) {
+            case 0: {
+                const bool inserted = map.add(ipAddress, value);
+                const bool expected =
+                    reference.insert(Reference::value_type(ipAddress, value))
+                        .second;
+                NTSCFG_TEST_EQ(inserted, expected);
+                break;
+            }
+            case 1: {
+                map.set(ipAddress, value);
+                reference[ipAddress] = value;
+                break;
+            }
+            case 2: {
+                const bool removed  = map.remove(ipAddress);
+                const bool expected = reference.erase(ipAddress) != 0;
+                NTSCFG_TEST_EQ(removed, expected);
+                break;
+            }
+            default: {
+                bsl::string removedValue(&ta);
+                const bool  removed = map.remove(&removedValue, ipAddress);
+
+                Reference::iterator it = reference.find(ipAddress);
+                if (it != reference.end()) {
+                    NTSCFG_TEST_TRUE(removed);
+                    NTSCFG_TEST_EQ(removedValue, it->second);
+                    reference.erase(it);
+                }
+                else {
+                    NTSCFG_TEST_FALSE(removed);
+                }
+                break;
+            }
+            }
+
+            NTSCFG_TEST_EQ(map.size(), reference.size());
+            NTSCFG_TEST_LE(map.size() * 4, map.capacity() * 3);
+
+            if (iteration % 1000 == 0) {
+                for (bsl::uint32_t i = 0; i < k_NUM_KEYS; ++i) {
+                    const ntsa::IpAddress key = test::generateIpAddress(i);
+
+                    const bsl::string*        found = map.find(key);
+                    Reference::const_iterator it    = reference.find(key);
+
+                    if (it == reference.end()) {
+                        NTSCFG_TEST_EQ(found, 0);
+                        NTSCFG_TEST_FALSE(map.contains(key));
+                    }
+                    else {
+                        NTSCFG_TEST_NE(found, 0);
+                        NTSCFG_TEST_EQ(*found, it->second);
+                        NTSCFG_TEST_TRUE(map.contains(key));
+                    }
+                }
+
+                bsl::vector<ntsa::IpAddress> keys(&ta);
+                map.keys(&keys);
+                NTSCFG_TEST_EQ(keys.size(), reference.size());
+            }
+        }
+
+        map[test::generateIpAddress(0)] = "modified";
+        NTSCFG_TEST_EQ(*map.find(test::generateIpAddress(0)), "modified");
+
+        const bsl::size_t capacity = map.capacity();
+
+        map.clear();
+
+        NTSCFG_TEST_TRUE(map.empty());
+        NTSCFG_TEST_EQ(map.capacity(), capacity);
+        NTSCFG_TEST_EQ(map.find(test::generateIpAddress(0)), 0);
+
+        map.reserve(10000);
+        NTSCFG_TEST_GE(map.capacity() * 3, 10000 * 4);
+    }
+    NTSCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTSCFG_TEST_CASE(3)
+{
+    // Concern: The map keyed by endpoints distinguishes IP endpoints by
+    // address and port, and local names by path.
+    // Plan:
+
+    ntscfg::TestAllocator ta;
+    {
+        typedef ntsa::AddressMap<ntsa::Endpoint, bsl::size_t> Map;
+
+        Map map(&ta);
+
+        const bsl::size_t k_NUM_PORTS = 500;
+
+        for (bsl::size_t i = 0; i < k_NUM_PORTS; ++i) {
+            const ntsa::Port port = static_cast<ntsa::Port>(49152 + i);
+
+            NTSCFG_TEST_TRUE(map.add(
+                ntsa::Endpoint(ntsa::IpEndpoint(
+                    ntsa::Ipv4Address::loopback(), port)),
+                i));
+
+            NTSCFG_TEST_TRUE(map.add(
+                ntsa::Endpoint(ntsa::IpEndpoint(
+                    ntsa::Ipv6Address::loopback(), port)),
+                k_NUM_PORTS + i));
+        }
+
+        ntsa::LocalName localName;
+        localName.setValue("/tmp/ntsa_addressmap.t.sock");
+
+        NTSCFG_TEST_TRUE(map.add(ntsa::Endpoint(localName), 2 * k_NUM_PORTS));
+        NTSCFG_TEST_FALSE(map.add(ntsa::Endpoint(localName), 0));
+
+        NTSCFG_TEST_EQ(map.size(), 2 * k_NUM_PORTS + 1);
+
+        for (bsl::size_t i = 0; i < k_NUM_PORTS; i += 2) {
+            const ntsa::Port port = static_cast<ntsa::Port>(49152 + i);
+
+            NTSCFG_TEST_TRUE(map.remove(ntsa::Endpoint(
+                ntsa::IpEndpoint(ntsa::Ipv4Address::loopback(), port))));
+        }
+
+        for (bsl::size_t i = 0; i < k_NUM_PORTS; ++i) {
+            const ntsa::Port port = static_cast<ntsa::Port>(49152 + i);
+
+            const bsl::size_t* ipv4Value = map.find(ntsa::Endpoint(
+                ntsa::IpEndpoint(ntsa::Ipv4Address::loopback(), port)));
+
+            if (i % 2 == 0) {
+                NTSCFG_TEST_EQ(ipv4Value, 0);
+            }
+            else {
+                NTSCFG_TEST_NE(ipv4Value, 0);
+                NTSCFG_TEST_EQ(*ipv4Value, i);
+            }
+
+            const bsl::size_t* ipv6Value = map.find(ntsa::Endpoint(
+                ntsa::IpEndpoint(ntsa::Ipv6Address::loopback(), port)));
+
+            NTSCFG_TEST_NE(ipv6Value, 0);
+            NTSCFG_TEST_EQ(*ipv6Value, k_NUM_PORTS + i);
+        }
+
+        const bsl::size_t* localValue = map.find(ntsa::Endpoint(localName));
+        NTSCFG_TEST_NE(localValue, 0);
+        NTSCFG_TEST_EQ(*localValue, 2 * k_NUM_PORTS);
+    }
+    NTSCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTSCFG_TEST_CASE(4)
+{
+    // Concern: Benchmark lookups against a node-based hash map.
+    // Plan:
+
+    if (NTSCFG_TEST_VERBOSITY > 0) {
+        typedef ntsa::AddressMap<ntsa::IpAddress, bsl::size_t> Map;
+        typedef bsl::unordered_map<ntsa::IpAddress, bsl::size_t> Reference;
+
+        const bsl::uint32_t k_NUM_KEYS       = 10000;
+        const bsl::size_t   k_NUM_ITERATIONS = 100;
+
+        Map       map;
+        Reference reference;
+
+        for (bsl::uint32_t i = 0; i < k_NUM_KEYS; ++i) {
+            map.add(test::generateIpAddress(i), i);
+            reference[test::generateIpAddress(i)] = i;
+        }
+
+        bsl::vector<ntsa::IpAddress> keys;
+        for (bsl::uint32_t i = 0; i < k_NUM_KEYS * 2; ++i) {
+            keys.push_back(test::generateIpAddress(i));
+        }
+
+        bsls::Stopwatch referenceStopwatch;
+        bsls::Stopwatch stopwatch;
+
+        bsl::size_t checksum = 0;
+
+        referenceStopwatch.start();
+        for (bsl::size_t iteration = 0; iteration < k_NUM_ITERATIONS;
+             ++iteration)
+        {
+            for (bsl::size_t i = 0; i < keys.size(); ++i) {
+                Reference::const_iterator it = reference.find(keys[i]);
+                if (it != reference.end()) {
+                    checksum += it->second;
+                }
+            }
+        }
+        referenceStopwatch.stop();
+
+        stopwatch.start();
+        for (bsl::size_t iteration = 0; iteration < k_NUM_ITERATIONS;
+             ++iteration)
+        {
+            for (bsl::size_t i = 0; i < keys.size(); ++i) {
+                const bsl::size_t* value = map.find(keys[i]);
+                if (value != 0) {
+                    checksum += *value;
+                }
+            }
+        }
+        stopwatch.stop();
+
+        bsl::cout << "Looked up " << k_NUM_ITERATIONS * keys.size()
+                  << " IP addresses (checksum " << checksum << ")"
+                  << bsl::endl;
+        bsl::cout << "    Reference: "
+                  << referenceStopwatch.accumulatedWallTime() << " seconds"
+                  << bsl::endl;
+        bsl::cout << "    Current:   " << stopwatch.accumulatedWallTime()
+                  << " seconds" << bsl::endl;
+    }
+}
+
+NTSCFG_TEST_DRIVER
+{
+    NTSCFG_TEST_REGISTER(1);
+    NTSCFG_TEST_REGISTER(2);
+    NTSCFG_TEST_REGISTER(3);
+    NTSCFG_TEST_REGISTER(4);
+}
+NTSCFG_TEST_DRIVER_END;
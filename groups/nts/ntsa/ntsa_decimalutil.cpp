@@ -0,0 +1,114 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntsa_decimalutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ntsa_decimalutil_cpp, "$Id$ $CSID$")
+
+namespace BloombergLP {
+namespace ntsa {
+
+namespace {
+
+// The two decimal digits of each value in the range [0, 100).
+const char k_DECIMAL_DIGIT_PAIRS[] = "00010203040506070809"
+                                     "10111213141516171819"
+                                     "20212223242526272829"
+                                     "30313233343536373839"
+                                     "40414243444546474849"
+                                     "50515253545556575859"
+                                     "60616263646566676869"
+                                     "70717273747576777879"
+                                     "80818283848586878889"
+                                     "90919293949596979899";
+
+}  // close unnamed namespace
+
+char* DecimalUtil::formatUint8(char* destination, bsl::uint8_t value)
+{
+    if (value >= 100) {
+        const unsigned int hundreds  = value / 100U;
+        const unsigned int remainder = value - (hundreds * 100U);
+
+        destination[0] = static_cast<char>('0' + hundreds);
+        destination[1] = k_DECIMAL_DIGIT_PAIRS[remainder * 2];
+        destination[2] = k_DECIMAL_DIGIT_PAIRS[remainder * 2 + 1];
+
+        return destination + 3;
+    }
+    else if (value >= 10) {
+        destination[0] = k_DECIMAL_DIGIT_PAIRS[value * 2];
+        destination[1] = k_DECIMAL_DIGIT_PAIRS[value * 2 + 1];
+
+        return destination + 2;
+    }
+    else {
+        destination[0] = static_cast<char>('0' + value);
+
+        return destination + 1;
+    }
+}
+
+char* DecimalUtil::formatUint16(char* destination, bsl::uint16_t value)
+{
+    // Count the digits, then write them from the least significant, two at
+    // a time, backwards from the end.
+
+    bsl::size_t length;
+    if (value < 10) {
+        length = 1;
+    }
+    else if (value < 100) {
+        length = 2;
+    }
+    else if (value < 1000) {
+        length = 3;
+    }
+    else if (value < 10000) {
+        length = 4;
+    }
+    else {
+        length = 5;
+    }
+
+    char* const end     = destination + length;
+    char*       current = end;
+
+    unsigned int remaining = value;
+
+    while (remaining >= 100) {
+        const unsigned int remainder = remaining % 100;
+        remaining /= 100;
+
+        current -= 2;
+        current[0] = k_DECIMAL_DIGIT_PAIRS[remainder * 2];
+        current[1] = k_DECIMAL_DIGIT_PAIRS[remainder * 2 + 1];
+    }
+
+    if (remaining >= 10) {
+        current -= 2;
+        current[0] = k_DECIMAL_DIGIT_PAIRS[remaining * 2];
+        current[1] = k_DECIMAL_DIGIT_PAIRS[remaining * 2 + 1];
+    }
+    else {
+        *--current = static_cast<char>('0' + remaining);
+    }
+
+    return end;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,66 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_NTSA_DECIMALUTIL
+#define INCLUDED_NTSA_DECIMALUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+#include <ntscfg_platform.h>
+#include <ntsscm_version.h>
+#include <bsl_cstdint.h>
+
+namespace BloombergLP {
+namespace ntsa {
+
+/// @internal @brief
+/// Provide utilities for formatting unsigned integers in decimal.
+///
+/// @details
+/// The digits are written from a table of the two decimal digits of each
+/// value in the range [0, 100), so that each division produces two digits,
+/// and each digit is written directly to its final position.
+///
+/// @par Thread Safety
+/// This struct is thread safe.
+///
+/// @ingroup module_ntsa_identity
+struct DecimalUtil {
+    enum {
+        /// The maximum number of decimal digits in an 8-bit unsigned integer.
+        MAX_LENGTH_UINT8 = 3,
+
+        /// The maximum number of decimal digits in a 16-bit unsigned
+        /// integer.
+        MAX_LENGTH_UINT16 = 5
+    };
+
+    /// Write the decimal digits of the specified 'value' to the specified
+    /// 'destination'. Return the position after the last digit written. Do
+    /// not null-terminate 'destination'. The behavior is undefined unless
+    /// 'destination' has room for at least 'MAX_LENGTH_UINT8' characters.
+    static char* formatUint8(char* destination, bsl::uint8_t value);
+
+    /// Write the decimal digits of the specified 'value' to the specified
+    /// 'destination'. Return the position after the last digit written. Do
+    /// not null-terminate 'destination'. The behavior is undefined unless
+    /// 'destination' has room for at least 'MAX_LENGTH_UINT16' characters.
+    static char* formatUint16(char* destination, bsl::uint16_t value);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+#endif
@@ -0,0 +1,89 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ntsa_decimalutil.h>
+#include <ntscfg_test.h>
+#include <bslma_testallocator.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstring.h>
+
+using namespace BloombergLP;
+using namespace ntsa;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+//
+//-----------------------------------------------------------------------------
+
+// [ 1]
+//-----------------------------------------------------------------------------
+// [ 1]
+//-----------------------------------------------------------------------------
+
+NTSCFG_TEST_CASE(1)
+{
+    // Concern: Every 8-bit unsigned integer is formatted in decimal.
+    // Plan: Format every value and compare it to the text formatted by
+    // 'sprintf'.
+
+    for (unsigned int value = 0; value <= 0xFF; ++value) {
+        char expected[16];
+        bsl::sprintf(expected, "%u", value);
+
+        char found[ntsa::DecimalUtil::MAX_LENGTH_UINT8 + 1];
+        bsl::memset(found, 0, sizeof found);
+
+        char* end = ntsa::DecimalUtil::formatUint8(
+            found,
+            static_cast<bsl::uint8_t>(value));
+
+        NTSCFG_TEST_EQ(static_cast<bsl::size_t>(end - found),
+                       bsl::strlen(expected));
+        NTSCFG_TEST_EQ(bsl::strcmp(found, expected), 0);
+    }
+}
+
+NTSCFG_TEST_CASE(2)
+{
+    // Concern: Every 16-bit unsigned integer is formatted in decimal.
+    // Plan: Format every value and compare it to the text formatted by
+    // 'sprintf'.
+
+    for (unsigned int value = 0; value <= 0xFFFF; ++value) {
+        char expected[16];
+        bsl::sprintf(expected, "%u", value);
+
+        char found[ntsa::DecimalUtil::MAX_LENGTH_UINT16 + 1];
+        bsl::memset(found, 0, sizeof found);
+
+        char* end = ntsa::DecimalUtil::formatUint16(
+            found,
+            static_cast<bsl::uint16_t>(value));
+
+        NTSCFG_TEST_EQ(static_cast<bsl::size_t>(end - found),
+                       bsl::strlen(expected));
+        NTSCFG_TEST_EQ(bsl::strcmp(found, expected), 0);
+    }
+}
+
+NTSCFG_TEST_DRIVER
+{
+    NTSCFG_TEST_REGISTER(1);
+    NTSCFG_TEST_REGISTER(2);
+}
+NTSCFG_TEST_DRIVER_END;
@@ -48,7 +48,7 @@ class File
 
     /// Create a new file description of the specified 'size' bytes starting
     /// at the specified 'position' in the file identified by the specified
-    /// 'descriptor'
+    /// 'descriptor', all of which remain to be transmitted.
     File(bdls::FilesystemUtil::FileDescriptor descriptor,
          bdls::FilesystemUtil::Offset         position,
          bdls::FilesystemUtil::Offset         size);
@@ -147,7 +147,7 @@ File::File(bdls::FilesystemUtil::FileDescriptor descriptor,
            bdls::FilesystemUtil::Offset         size)
 : d_fileDescriptor(descriptor)
 , d_filePosition(position)
-, d_fileBytesRemaining(0)
+, d_fileBytesRemaining(size)
 , d_fileSize(size)
 {
 }
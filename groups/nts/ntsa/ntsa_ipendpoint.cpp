@@ -247,12 +247,12 @@ bsl::ostream& IpEndpoint::print(bsl::ostream& stream,
                                 int           level,
                                 int           spacesPerLevel) const
 {
-    char buffer[ntsa::IpEndpoint::MAX_TEXT_LENGTH + 1];
-    this->format(buffer, sizeof buffer);
+    char              buffer[ntsa::IpEndpoint::MAX_TEXT_LENGTH + 1];
+    const bsl::size_t size = this->format(buffer, sizeof buffer);
 
     bslim::Printer printer(&stream, level, spacesPerLevel);
     printer.start(true);
-    stream << buffer;
+    stream.write(buffer, size);
     printer.end(true);
 
     return stream;
@@ -18,6 +18,7 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(ntsa_ipv4address_cpp, "$Id$ $CSID$")
 
+#include <ntsa_decimalutil.h>
 #include <bslim_printer.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
@@ -81,55 +82,57 @@ bool Ipv4Address::parse(const bslstl::StringRef& text)
 
     this->reset();
 
-    const char* const begin = text.data();
-    const char* const end   = begin + text.size();
-
-    const char* current = begin;
-    bsl::size_t index   = 0;
+    const char*       current = text.data();
+    const char* const end     = current + text.size();
 
     Representation newValue;
     newValue.d_asDword = 0;
 
-    bsl::uint32_t byteAtIndex = 0;
+    // Parse each octet, rejecting any octet that is empty or whose value
+    // exceeds 255 as soon as the offending digit is seen, so the value of
+    // an octet never overflows regardless of its number of digits.
+
+    for (bsl::size_t index = 0; index < 4; ++index) {
+        if (index != 0) {
+            if (current == end || *current != '.') {
+                return false;
+            }
 
-    while (current != end) {
-        const char ch = *current;
-        if (NTSCFG_LIKELY(ch >= '0' && ch <= '9')) {
-            byteAtIndex *= 10;
-            byteAtIndex += ch - '0';
+            ++current;
         }
-        else {
-            if (ch == '.') {
-                if (byteAtIndex > 255) {
-                    return false;
-                }
-                newValue.d_asBytes[index] =
-                    NTSCFG_WARNING_NARROW(bsl::uint8_t, byteAtIndex);
-                byteAtIndex = 0;
-                ++index;
-                if (index > 3) {
-                    return false;
-                }
+
+        const char* const first = current;
+        bsl::uint32_t     value = 0;
+
+        while (current != end) {
+            const bsl::uint32_t digit =
+                static_cast<bsl::uint32_t>(
+                    static_cast<unsigned char>(*current)) -
+                static_cast<bsl::uint32_t>('0');
+
+            if (digit > 9) {
+                break;
             }
-            else {
+
+            value = (value * 10) + digit;
+            if (NTSCFG_UNLIKELY(value > 255)) {
                 return false;
             }
+
+            ++current;
         }
 
-        ++current;
-    }
+        if (current == first) {
+            return false;
+        }
 
-    if (index != 3) {
-        return false;
+        newValue.d_asBytes[index] = static_cast<bsl::uint8_t>(value);
     }
 
-    if (byteAtIndex > 255) {
+    if (current != end) {
         return false;
     }
 
-    newValue.d_asBytes[index] =
-        NTSCFG_WARNING_NARROW(bsl::uint8_t, byteAtIndex);
-
     d_value.d_asDword = newValue.d_asDword;
 
     return true;
@@ -165,43 +168,19 @@ bsl::size_t Ipv4Address::format(char* buffer, bsl::size_t capacity) const
         return 0;
     }
 
-    char* bufferTarget = buffer;
-
-    char temp[3];
+    char* target = buffer;
 
-    for (bsl::size_t byteIndex = 0; byteIndex < 4; ++byteIndex) {
-        bsl::uint8_t value = d_value.d_asBytes[byteIndex];
-
-        char* tempTarget = temp;
-
-        while (true) {
-            const bsl::uint8_t digit = static_cast<bsl::uint8_t>(
-                value % static_cast<bsl::uint8_t>(10));
-
-            *tempTarget++ = static_cast<char>('0' + digit);
-
-            value /= static_cast<bsl::uint8_t>(10);
-            if (value == 0) {
-                break;
-            }
-        }
-
-        while (true) {
-            if (--tempTarget < temp) {
-                break;
-            }
-
-            *bufferTarget++ = *tempTarget;
-        }
-
-        if (byteIndex != 3) {
-            *bufferTarget++ = '.';
-        }
-    }
+    target    = DecimalUtil::formatUint8(target, d_value.d_asBytes[0]);
+    *target++ = '.';
+    target    = DecimalUtil::formatUint8(target, d_value.d_asBytes[1]);
+    *target++ = '.';
+    target    = DecimalUtil::formatUint8(target, d_value.d_asBytes[2]);
+    *target++ = '.';
+    target    = DecimalUtil::formatUint8(target, d_value.d_asBytes[3]);
 
-    const bsl::size_t count = static_cast<bsl::size_t>(bufferTarget - buffer);
+    const bsl::size_t count = static_cast<bsl::size_t>(target - buffer);
 
-    *bufferTarget++ = 0;
+    *target = 0;
 
     return count;
 }
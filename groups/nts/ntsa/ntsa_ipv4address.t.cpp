@@ -17,9 +17,14 @@
 #include <ntscfg_test.h>
 #include <bslma_testallocator.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
 #include <bsl_unordered_set.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace ntsa;
@@ -37,6 +42,57 @@ using namespace ntsa;
 // [ 1]
 //-----------------------------------------------------------------------------
 
+namespace test {
+
+/// Load into the specified 'buffer' the text of the specified 'address'
+/// formatted by 'sprintf'. This is the reference against which the
+/// formatting of 'ntsa::Ipv4Address' is verified and benchmarked. The
+/// behavior is undefined unless 'buffer' has room for at least
+/// 'ntsa::Ipv4Address::MAX_TEXT_LENGTH + 1' characters. Return the number
+/// of characters written, not including the null terminator.
+bsl::size_t formatReference(char* buffer, const ntsa::Ipv4Address& address)
+{
+    bsl::uint8_t bytes[4];
+    address.copyTo(bytes, sizeof bytes);
+
+    return static_cast<bsl::size_t>(
+        bsl::sprintf(buffer,
+                     "%u.%u.%u.%u",
+                     static_cast<unsigned int>(bytes[0]),
+                     static_cast<unsigned int>(bytes[1]),
+                     static_cast<unsigned int>(bytes[2]),
+                     static_cast<unsigned int>(bytes[3])));
+}
+
+/// Load into the specified 'result' a set of addresses whose octets cover
+/// every number of digits in every position.
+void generate(bsl::vector<ntsa::Ipv4Address>* result)
+{
+    const bsl::uint8_t k_OCTETS[] = {0, 1, 9, 10, 99, 100, 127, 192, 255};
+
+    enum { k_NUM_OCTETS = sizeof k_OCTETS / sizeof k_OCTETS[0] };
+
+    for (bsl::size_t a = 0; a < k_NUM_OCTETS; ++a) {
+        for (bsl::size_t b = 0; b < k_NUM_OCTETS; ++b) {
+            for (bsl::size_t c = 0; c < k_NUM_OCTETS; ++c) {
+                for (bsl::size_t d = 0; d < k_NUM_OCTETS; ++d) {
+                    const bsl::uint8_t bytes[4] = {k_OCTETS[a],
+                                                   k_OCTETS[b],
+                                                   k_OCTETS[c],
+                                                   k_OCTETS[d]};
+
+                    ntsa::Ipv4Address address;
+                    address.copyFrom(bytes, sizeof bytes);
+
+                    result->push_back(address);
+                }
+            }
+        }
+    }
+}
+
+}  // close namespace test
+
 NTSCFG_TEST_CASE(1)
 {
     // Concern: Parsing
@@ -55,6 +111,7 @@ NTSCFG_TEST_CASE(1)
         {            "1.2.3.4", {0x01, 0x02, 0x03, 0x04},  true},
         {         "0.1.12.123", {0x00, 0x01, 0x0C, 0x7B},  true},
         {    "255.255.255.255", {0xFF, 0xFF, 0xFF, 0xFF},  true},
+        {    "001.002.003.004", {0x01, 0x02, 0x03, 0x04},  true},
 
         {            "x.y.z.w", {0x00, 0x00, 0x00, 0x00}, false},
         {            "x.2.3.4", {0x00, 0x00, 0x00, 0x00}, false},
@@ -62,6 +119,12 @@ NTSCFG_TEST_CASE(1)
         {          "x.2.3.4.5", {0x00, 0x00, 0x00, 0x00}, false},
         {    "256.256.256.256", {0x00, 0x00, 0x00, 0x00}, false},
         {"9999.9999.9999.9999", {0x00, 0x00, 0x00, 0x00}, false},
+        {   "4294967297.1.1.1", {0x00, 0x00, 0x00, 0x00}, false},
+        {             "1..2.3", {0x00, 0x00, 0x00, 0x00}, false},
+        {             ".1.2.3", {0x00, 0x00, 0x00, 0x00}, false},
+        {             "1.2.3.", {0x00, 0x00, 0x00, 0x00}, false},
+        {           "1.2.3.4.", {0x00, 0x00, 0x00, 0x00}, false},
+        {                   "", {0x00, 0x00, 0x00, 0x00}, false},
     };
 
     enum { NUM_DATA = sizeof(DATA) / sizeof(DATA[0]) };
@@ -160,10 +223,82 @@ NTSCFG_TEST_CASE(3)
     NTSCFG_TEST_ASSERT(addressSet.size() == 2);
 }
 
+NTSCFG_TEST_CASE(4)
+{
+    // Concern: Formatting writes the same text as 'sprintf', and fails when
+    // the buffer is too small.
+    // Plan: Format a set of addresses covering every number of digits in
+    // every octet, compare the result to the text formatted by 'sprintf',
+    // then, if verbose, benchmark the formatting against 'sprintf'.
+
+    bsl::vector<ntsa::Ipv4Address> addressList;
+    test::generate(&addressList);
+
+    for (bsl::size_t i = 0; i < addressList.size(); ++i) {
+        char              expected[ntsa::Ipv4Address::MAX_TEXT_LENGTH + 1];
+        const bsl::size_t expectedLength =
+            test::formatReference(expected, addressList[i]);
+
+        char              found[ntsa::Ipv4Address::MAX_TEXT_LENGTH + 1];
+        const bsl::size_t foundLength =
+            addressList[i].format(found, sizeof found);
+
+        NTSCFG_TEST_EQ(foundLength, expectedLength);
+        NTSCFG_TEST_EQ(bsl::strcmp(found, expected), 0);
+
+        NTSCFG_TEST_EQ(addressList[i].format(found, sizeof found - 1), 0);
+    }
+
+    // Benchmark the formatting against the reference.
+
+    if (NTSCFG_TEST_VERBOSITY > 0) {
+        const bsl::size_t k_NUM_ITERATIONS = 100;
+
+        bsls::Stopwatch referenceStopwatch;
+        bsls::Stopwatch stopwatch;
+
+        bsl::size_t checksum = 0;
+
+        referenceStopwatch.start();
+        for (bsl::size_t iteration = 0; iteration < k_NUM_ITERATIONS;
+             ++iteration)
+        {
+            for (bsl::size_t i = 0; i < addressList.size(); ++i) {
+                char buffer[ntsa::Ipv4Address::MAX_TEXT_LENGTH + 1];
+                checksum += test::formatReference(buffer, addressList[i]);
+            }
+        }
+        referenceStopwatch.stop();
+
+        stopwatch.start();
+        for (bsl::size_t iteration = 0; iteration < k_NUM_ITERATIONS;
+             ++iteration)
+        {
+            for (bsl::size_t i = 0; i < addressList.size(); ++i) {
+                char buffer[ntsa::Ipv4Address::MAX_TEXT_LENGTH + 1];
+                checksum += addressList[i].format(buffer, sizeof buffer);
+            }
+        }
+        stopwatch.stop();
+
+        const bsl::size_t numFormatted = k_NUM_ITERATIONS * addressList.size();
+
+        bsl::cout << "Formatted " << numFormatted
+                  << " IPv4 addresses (checksum " << checksum << ")"
+                  << bsl::endl;
+        bsl::cout << "    Reference: "
+                  << referenceStopwatch.accumulatedWallTime() << " seconds"
+                  << bsl::endl;
+        bsl::cout << "    Current:   " << stopwatch.accumulatedWallTime()
+                  << " seconds" << bsl::endl;
+    }
+}
+
 NTSCFG_TEST_DRIVER
 {
     NTSCFG_TEST_REGISTER(1);
     NTSCFG_TEST_REGISTER(2);
     NTSCFG_TEST_REGISTER(3);
+    NTSCFG_TEST_REGISTER(4);
 }
 NTSCFG_TEST_DRIVER_END;
@@ -55,6 +55,50 @@ bool checkIpv6BufferOverflow(bsl::size_t size)
     return true;
 }
 
+// The hexadecimal digits, in lowercase.
+const char k_HEX_DIGITS[] = "0123456789abcdef";
+
+// Write the hexadecimal representation of the specified 'value', without
+// leading zeros, to the specified 'destination'. Return the position after
+// the last character written.
+char* formatGroup(char* destination, bsl::uint16_t value)
+{
+    if (value >= 0x1000) {
+        *destination++ = k_HEX_DIGITS[(value >> 12) & 0x0F];
+    }
+
+    if (value >= 0x0100) {
+        *destination++ = k_HEX_DIGITS[(value >> 8) & 0x0F];
+    }
+
+    if (value >= 0x0010) {
+        *destination++ = k_HEX_DIGITS[(value >> 4) & 0x0F];
+    }
+
+    *destination++ = k_HEX_DIGITS[value & 0x0F];
+
+    return destination;
+}
+
+// Write the groups in the specified range ['begin', 'end') of the
+// specified 'group' array, separated by colons, to the specified
+// 'destination'. Return the position after the last character written.
+char* formatGroups(char*                destination,
+                   const bsl::uint16_t* group,
+                   bsl::size_t          begin,
+                   bsl::size_t          end)
+{
+    for (bsl::size_t i = begin; i < end; ++i) {
+        if (i != begin) {
+            *destination++ = ':';
+        }
+
+        destination = formatGroup(destination, group[i]);
+    }
+
+    return destination;
+}
+
 }  // close unnamed namespace
 
 Ipv6Address::Ipv6Address(const bslstl::StringRef& text)
@@ -225,114 +269,94 @@ bsl::size_t Ipv6Address::format(char*       buffer,
         return 0;
     }
 
-    char* target = buffer;
+    bsl::uint16_t group[8];
+    for (bsl::size_t i = 0; i < 8; ++i) {
+        group[i] = static_cast<bsl::uint16_t>(
+            (static_cast<bsl::uint16_t>(d_value.d_asBytes[2 * i]) << 8) |
+            d_value.d_asBytes[2 * i + 1]);
+    }
 
-    for (bsl::size_t i = 0; i < 16; i += 2) {
-        const bsl::uint8_t v1 = d_value.d_asBytes[i];
-        const bsl::uint8_t v2 = d_value.d_asBytes[i + 1];
+    // Find the run of zero groups to collapse into "::", if any. Each run is
+    // weighed by the number of characters it occupies in the uncollapsed
+    // text, including the colon before it, if any, and the colon after it,
+    // if any. The first heaviest run is collapsed, but only if it occupies
+    // more than two characters.
 
-        const bsl::uint8_t v1a = v1 >> 4;
-        const bsl::uint8_t v1b = v1 & 0x0F;
+    bsl::size_t collapseBegin = 8;
+    bsl::size_t collapseEnd   = 8;
 
-        const bsl::uint8_t v2a = v2 >> 4;
-        const bsl::uint8_t v2b = v2 & 0x0F;
+    if (collapse) {
+        bsl::size_t maximum = 2;
 
-        if (v1a != 0) {
-            if (v1a < 10) {
-                *target++ = static_cast<char>('0' + v1a);
-            }
-            else {
-                *target++ = static_cast<char>('a' + (v1a - 10));
+        bsl::size_t i = 0;
+        while (i < 8) {
+            if (group[i] != 0) {
+                ++i;
+                continue;
             }
-        }
 
-        if (v1a != 0 || v1b != 0) {
-            if (v1b < 10) {
-                *target++ = static_cast<char>('0' + v1b);
-            }
-            else {
-                *target++ = static_cast<char>('a' + (v1b - 10));
+            bsl::size_t j = i + 1;
+            while (j < 8 && group[j] == 0) {
+                ++j;
             }
-        }
 
-        if (v1a != 0 || v1b != 0 || v2a != 0) {
-            if (v2a < 10) {
-                *target++ = static_cast<char>('0' + v2a);
-            }
-            else {
-                *target++ = static_cast<char>('a' + (v2a - 10));
-            }
-        }
+            const bsl::size_t weight =
+                (2 * (j - i)) - (i == 0 ? 1 : 0) + (j != 8 ? 1 : 0);
 
-        {
-            if (v2b < 10) {
-                *target++ = static_cast<char>('0' + v2b);
-            }
-            else {
-                *target++ = static_cast<char>('a' + (v2b - 10));
+            if (weight > maximum) {
+                maximum       = weight;
+                collapseBegin = i;
+                collapseEnd   = j;
             }
-        }
 
-        if (i != 14) {
-            *target++ = ':';
+            i = j;
         }
     }
 
+    char* target = buffer;
+
+    if (collapseBegin < 8) {
+        target    = formatGroups(target, group, 0, collapseBegin);
+        *target++ = ':';
+        *target++ = ':';
+        target    = formatGroups(target, group, collapseEnd, 8);
+    }
+    else {
+        target = formatGroups(target, group, 0, 8);
+    }
+
     if (d_scopeId > 0) {
-        *target++ = '%';
+        char        digits[10];
+        char* const digitsEnd   = digits + sizeof digits;
+        char*       digitsBegin = digitsEnd;
 
         bsl::uint32_t value = d_scopeId;
+        do {
+            *--digitsBegin = static_cast<char>('0' + (value % 10));
+            value /= 10;
+        } while (value != 0);
 
-        char* head = target;
-
-        while (true) {
-            const bsl::uint32_t digit = static_cast<bsl::uint32_t>(value % 10);
+        const bsl::size_t numDigits =
+            static_cast<bsl::size_t>(digitsEnd - digitsBegin);
 
-            *target++ = static_cast<char>('0' + digit);
+        const bsl::size_t size = static_cast<bsl::size_t>(target - buffer);
 
-            value /= 10;
-            if (value == 0) {
-                break;
-            }
+        if (size + 1 + numDigits + 1 > capacity) {
+            buffer[0] = 0;
+            return 0;
         }
 
-        char* tail = target - 1;
+        *target++ = '%';
 
-        for (; head < tail; ++head, --tail) {
-            const char temp = *head;
-            *head           = *tail;
-            *tail           = temp;
-        }
+        bsl::memcpy(target, digitsBegin, numDigits);
+        target += numDigits;
     }
 
-    *target++ = 0;
+    const bsl::size_t count = static_cast<bsl::size_t>(target - buffer);
 
-    if (collapse) {
-        bsl::size_t i       = 0;
-        bsl::size_t best    = 0;
-        bsl::size_t maximum = 2;
-
-        for (; buffer[i] != 0; ++i) {
-            if (i > 0 && buffer[i] != ':') {
-                continue;
-            }
-
-            bsl::size_t j = bsl::strspn(buffer + i, ":0");
-            if (j > maximum) {
-                best    = i;
-                maximum = j;
-            }
-        }
-
-        if (maximum > 2) {
-            buffer[best] = buffer[best + 1] = ':';
-            bsl::memmove(buffer + best + 2,
-                         buffer + best + maximum,
-                         i - best - maximum + 1);
-        }
-    }
+    *target = 0;
 
-    return bsl::strlen(buffer);
+    return count;
 }
 
 Ipv6Address Ipv6Address::any()
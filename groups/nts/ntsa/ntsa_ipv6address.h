@@ -121,7 +121,8 @@ class Ipv6Address
     /// collapse longesta successive runs of result matching the regular
     /// expression '/(^0|:)[:0]{2,}/' with "::", turning the result into the
     /// canonical textual representation of the address. Return the number
-    /// of bytes written.
+    /// of bytes written, or 0 if the 'capacity' is less than
+    /// 'MAX_TEXT_LENGTH + 1' or is insufficient for the scope ID.
     bsl::size_t format(char*       buffer,
                        bsl::size_t capacity,
                        bool        collapse = true) const;
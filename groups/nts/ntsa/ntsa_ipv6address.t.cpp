@@ -17,9 +17,14 @@
 #include <ntscfg_test.h>
 #include <bslma_testallocator.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
 #include <bsl_unordered_set.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace ntsa;
@@ -37,6 +42,112 @@ using namespace ntsa;
 // [ 1]
 //-----------------------------------------------------------------------------
 
+namespace test {
+
+/// Format the specified 'address' to the specified 'buffer', collapsing the
+/// longest run of zero groups according to the specified 'collapse' flag,
+/// by first formatting every group then collapsing the text in place. This
+/// is the reference against which the formatting of 'ntsa::Ipv6Address' is
+/// verified and benchmarked. The behavior is undefined unless 'buffer' has
+/// room for at least 'ntsa::Ipv6Address::MAX_TEXT_LENGTH + 1' characters.
+/// Return the number of characters written, not including the null
+/// terminator.
+bsl::size_t formatReference(char*                    buffer,
+                            const ntsa::Ipv6Address& address,
+                            bool                     collapse)
+{
+    bsl::uint8_t bytes[16];
+    address.copyTo(bytes, sizeof bytes);
+
+    char* target = buffer;
+
+    for (bsl::size_t i = 0; i < 16; i += 2) {
+        const unsigned int value = (static_cast<unsigned int>(bytes[i]) << 8) |
+                                   static_cast<unsigned int>(bytes[i + 1]);
+
+        char group[5];
+        bsl::sprintf(group, "%x", value);
+
+        const bsl::size_t groupLength = bsl::strlen(group);
+        bsl::memcpy(target, group, groupLength);
+        target += groupLength;
+
+        if (i != 14) {
+            *target++ = ':';
+        }
+    }
+
+    if (address.scopeId() > 0) {
+        target += bsl::sprintf(target,
+                               "%%%u",
+                               static_cast<unsigned int>(address.scopeId()));
+    }
+
+    *target = 0;
+
+    if (collapse) {
+        bsl::size_t i       = 0;
+        bsl::size_t best    = 0;
+        bsl::size_t maximum = 2;
+
+        for (; buffer[i] != 0; ++i) {
+            if (i > 0 && buffer[i] != ':') {
+                continue;
+            }
+
+            bsl::size_t j = bsl::strspn(buffer + i, ":0");
+            if (j > maximum) {
+                best    = i;
+                maximum = j;
+            }
+        }
+
+        if (maximum > 2) {
+            buffer[best] = buffer[best + 1] = ':';
+            bsl::memmove(buffer + best + 2,
+                         buffer + best + maximum,
+                         i - best - maximum + 1);
+        }
+    }
+
+    return bsl::strlen(buffer);
+}
+
+/// Load into the specified 'result' a set of addresses having every
+/// combination of zero and non-zero groups, with and without a scope ID.
+void generate(bsl::vector<ntsa::Ipv6Address>* result)
+{
+    const bsl::uint16_t VALUES[] = {0x0001, 0x000a, 0x00ab, 0x0100, 0xabcd};
+
+    enum { NUM_VALUES = sizeof(VALUES) / sizeof(VALUES[0]) };
+
+    for (bsl::size_t mask = 0; mask < 256; ++mask) {
+        for (bsl::size_t variation = 0; variation < NUM_VALUES; ++variation) {
+            bsl::uint8_t bytes[16];
+
+            for (bsl::size_t group = 0; group < 8; ++group) {
+                bsl::uint16_t value = 0;
+                if ((mask & (static_cast<bsl::size_t>(1) << group)) != 0) {
+                    value = VALUES[(variation + group) % NUM_VALUES];
+                }
+
+                bytes[2 * group + 0] = static_cast<bsl::uint8_t>(value >> 8);
+                bytes[2 * group + 1] = static_cast<bsl::uint8_t>(value);
+            }
+
+            ntsa::Ipv6Address address;
+            address.copyFrom(bytes, sizeof bytes);
+
+            result->push_back(address);
+
+            address.setScopeId(static_cast<ntsa::Ipv6ScopeId>(mask + 1));
+            result->push_back(address);
+        }
+    }
+}
+
+}  // close namespace test
+
 NTSCFG_TEST_CASE(1)
 {
     // Concern:
@@ -1207,6 +1318,79 @@ NTSCFG_TEST_CASE(5)
     }
 }
 
+NTSCFG_TEST_CASE(6)
+{
+    // Concern: Formatting writes each group directly, collapsing the same
+    // run of zero groups as the reference, which formats every group then
+    // collapses the text.
+    // Plan:
+
+    bsl::vector<ntsa::Ipv6Address> addressList;
+    test::generate(&addressList);
+
+    for (bsl::size_t i = 0; i < addressList.size(); ++i) {
+        for (bsl::size_t variation = 0; variation < 2; ++variation) {
+            const bool collapse = variation != 0;
+
+            char              expected[ntsa::Ipv6Address::MAX_TEXT_LENGTH + 1];
+            const bsl::size_t expectedLength =
+                test::formatReference(expected, addressList[i], collapse);
+
+            char              found[ntsa::Ipv6Address::MAX_TEXT_LENGTH + 1];
+            const bsl::size_t foundLength =
+                addressList[i].format(found, sizeof found, collapse);
+
+            NTSCFG_TEST_EQ(foundLength, expectedLength);
+            NTSCFG_TEST_EQ(bsl::strcmp(found, expected), 0);
+        }
+    }
+
+    // Benchmark the formatting against the reference.
+
+    if (NTSCFG_TEST_VERBOSITY > 0) {
+        const bsl::size_t k_NUM_ITERATIONS = 100;
+
+        bsls::Stopwatch referenceStopwatch;
+        bsls::Stopwatch stopwatch;
+
+        bsl::size_t checksum = 0;
+
+        referenceStopwatch.start();
+        for (bsl::size_t iteration = 0; iteration < k_NUM_ITERATIONS;
+             ++iteration)
+        {
+            for (bsl::size_t i = 0; i < addressList.size(); ++i) {
+                char buffer[ntsa::Ipv6Address::MAX_TEXT_LENGTH + 1];
+                checksum +=
+                    test::formatReference(buffer, addressList[i], true);
+            }
+        }
+        referenceStopwatch.stop();
+
+        stopwatch.start();
+        for (bsl::size_t iteration = 0; iteration < k_NUM_ITERATIONS;
+             ++iteration)
+        {
+            for (bsl::size_t i = 0; i < addressList.size(); ++i) {
+                char buffer[ntsa::Ipv6Address::MAX_TEXT_LENGTH + 1];
+                checksum += addressList[i].format(buffer, sizeof buffer);
+            }
+        }
+        stopwatch.stop();
+
+        const bsl::size_t numFormatted = k_NUM_ITERATIONS * addressList.size();
+
+        bsl::cout << "Formatted " << numFormatted
+                  << " IPv6 addresses (checksum " << checksum << ")"
+                  << bsl::endl;
+        bsl::cout << "    Reference: "
+                  << referenceStopwatch.accumulatedWallTime() << " seconds"
+                  << bsl::endl;
+        bsl::cout << "    Current:   " << stopwatch.accumulatedWallTime()
+                  << " seconds" << bsl::endl;
+    }
+}
+
 NTSCFG_TEST_DRIVER
 {
     NTSCFG_TEST_REGISTER(1);
@@ -1214,5 +1398,6 @@ NTSCFG_TEST_DRIVER
     NTSCFG_TEST_REGISTER(3);
     NTSCFG_TEST_REGISTER(4);
     NTSCFG_TEST_REGISTER(5);
+    NTSCFG_TEST_REGISTER(6);
 }
 NTSCFG_TEST_DRIVER_END;
@@ -18,6 +18,7 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(ntsa_port_cpp, "$Id$ $CSID$")
 
+#include <ntsa_decimalutil.h>
 #include <bdlb_chartype.h>
 
 #include <bsl_climits.h>
@@ -31,82 +32,65 @@ bsl::size_t PortUtil::format(char*       destination,
                              bsl::size_t capacity,
                              ntsa::Port  port)
 {
-    bsl::uint16_t value = port;
-    bsl::size_t   size  = 0;
+    char digits[ntsa::DecimalUtil::MAX_LENGTH_UINT16];
 
-    char        c;
-    bsl::size_t i;
-    bsl::size_t j;
+    const bsl::size_t size = static_cast<bsl::size_t>(
+        ntsa::DecimalUtil::formatUint16(digits, port) - digits);
 
-    do {
-        if (size == capacity) {
-            return size;
+    if (size > capacity) {
+        if (capacity > 0) {
+            destination[0] = 0;
         }
 
-        int remainder = value % 10;
-        if (remainder > 9) {
-            destination[size] = (char)((remainder - 10) + 'a');
-        }
-        else {
-            destination[size] = (char)(remainder + '0');
-        }
+        return 0;
+    }
 
-        size  = size + 1;
-        value = value / 10;
-    } while (value != 0);
+    bsl::memcpy(destination, digits, size);
 
     if (size < capacity) {
         destination[size] = 0;
     }
 
-    for (i = 0, j = size - 1; i < j; ++i, --j) {
-        c              = destination[i];
-        destination[i] = destination[j];
-        destination[j] = (char)(c);
-    }
-
     return size;
 }
 
 bool PortUtil::parse(ntsa::Port* result, const char* source, bsl::size_t size)
 {
-    const char* p = source;
-    const char* e = source + size + 1;
+    const char*       current = source;
+    const char* const end     = source + size;
 
-    char c;
-
-    if (*p == 0) {
-        return false;
+    while (current != end && bdlb::CharType::isSpace(*current)) {
+        ++current;
     }
 
-    c = *p++;
-    while (bdlb::CharType::isSpace(c)) {
-        c = *p++;
+    if (current != end && *current == '+') {
+        ++current;
     }
 
-    if (c == '-') {
+    if (current == end) {
         return false;
     }
 
-    if (c == '+') {
-        c = *p++;
-    }
+    bsl::uint32_t value = 0;
+
+    do {
+        const bsl::uint32_t digit =
+            static_cast<bsl::uint32_t>(static_cast<unsigned char>(*current)) -
+            static_cast<bsl::uint32_t>('0');
 
-    bsl::uint64_t value = 0;
-    while (p != e) {
-        if (!bdlb::CharType::isDigit(c)) {
+        if (digit > 9) {
             return false;
         }
 
-        value = value * 10 + (c - '0');
-        c     = *p++;
-    }
+        value = (value * 10) + digit;
+        if (value > USHRT_MAX) {
+            return false;
+        }
 
-    if (value > USHRT_MAX) {
-        return false;
-    }
+        ++current;
+    } while (current != end);
 
-    *result = static_cast<bsl::uint16_t>(value);
+    *result = static_cast<ntsa::Port>(value);
     return true;
 }
 
@@ -45,7 +45,9 @@ struct PortUtil {
     /// Encode the specified 'port' to the specified 'destination' having
     /// the specified 'capacity'. If 'destination' has sufficient capacity,
     /// null-terminate 'destination'. Return the number of bytes written,
-    /// not including the null terminator.
+    /// not including the null terminator. If 'destination' does not have
+    /// the capacity for every digit of 'port', write no digits and return
+    /// 0.
     static bsl::size_t format(char*       destination,
                               bsl::size_t capacity,
                               ntsa::Port  port);
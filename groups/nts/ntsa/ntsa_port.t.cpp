@@ -16,7 +16,10 @@
 #include <ntsa_port.h>
 #include <ntscfg_test.h>
 #include <bslma_testallocator.h>
+#include <bsls_stopwatch.h>
+#include <bsl_cstdio.h>
 #include <bsl_cstring.h>
+#include <bsl_iostream.h>
 
 using namespace BloombergLP;
 using namespace ntsa;
@@ -52,8 +55,12 @@ NTSCFG_TEST_CASE(1)
             {  "123",   123,  true},
             {"28588", 28588,  true},
             {"65535", 65535,  true},
+            {  "+80",    80,  true},
             {   "-1",     0, false},
-            {"65536",     0, false}
+            {"65536",     0, false},
+            {    "+",     0, false},
+            {     "",     0, false},
+            {   "8a",     0, false}
         };
 
         enum { NUM_DATA = sizeof(DATA) / sizeof(DATA[0]) };
@@ -107,9 +114,118 @@ NTSCFG_TEST_CASE(2)
     NTSCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+NTSCFG_TEST_CASE(3)
+{
+    // Concern: Formatting a port into a buffer too small for its digits
+    // writes no digits and returns 0, and formatting into a buffer with room
+    // for its digits but not the null terminator does not write the null
+    // terminator.
+    // Plan:
+
+    {
+        char buffer[4];
+        bsl::memset(buffer, 'x', sizeof buffer);
+
+        bsl::size_t size = ntsa::PortUtil::format(buffer, 4, 28588);
+        NTSCFG_TEST_EQ(size, 0);
+        NTSCFG_TEST_EQ(buffer[0], 0);
+        NTSCFG_TEST_EQ(buffer[1], 'x');
+    }
+
+    {
+        char buffer[4];
+        bsl::memset(buffer, 'x', sizeof buffer);
+
+        bsl::size_t size = ntsa::PortUtil::format(buffer, 0, 80);
+        NTSCFG_TEST_EQ(size, 0);
+        NTSCFG_TEST_EQ(buffer[0], 'x');
+    }
+
+    {
+        char buffer[4];
+        bsl::memset(buffer, 'x', sizeof buffer);
+
+        bsl::size_t size = ntsa::PortUtil::format(buffer, 3, 443);
+        NTSCFG_TEST_EQ(size, 3);
+        NTSCFG_TEST_EQ(bsl::memcmp(buffer, "443", 3), 0);
+        NTSCFG_TEST_EQ(buffer[3], 'x');
+    }
+}
+
+NTSCFG_TEST_CASE(4)
+{
+    // Concern: Every port is formatted the same as by 'sprintf'.
+    // Plan: Format every port, compare the result to the text formatted by
+    // 'sprintf', then, if verbose, benchmark the formatting against
+    // 'sprintf'.
+
+    for (unsigned int value = 0; value <= 0xFFFF; ++value) {
+        char expected[16];
+        bsl::sprintf(expected, "%u", value);
+
+        char              found[ntsa::PortUtil::MAX_LENGTH + 1];
+        const bsl::size_t foundLength =
+            ntsa::PortUtil::format(found,
+                                   sizeof found,
+                                   static_cast<ntsa::Port>(value));
+
+        NTSCFG_TEST_EQ(foundLength, bsl::strlen(expected));
+        NTSCFG_TEST_EQ(bsl::strcmp(found, expected), 0);
+    }
+
+    // Benchmark the formatting against the reference.
+
+    if (NTSCFG_TEST_VERBOSITY > 0) {
+        const bsl::size_t k_NUM_ITERATIONS = 100;
+
+        bsls::Stopwatch referenceStopwatch;
+        bsls::Stopwatch stopwatch;
+
+        bsl::size_t checksum = 0;
+
+        referenceStopwatch.start();
+        for (bsl::size_t iteration = 0; iteration < k_NUM_ITERATIONS;
+             ++iteration)
+        {
+            for (unsigned int value = 0; value <= 0xFFFF; ++value) {
+                char buffer[ntsa::PortUtil::MAX_LENGTH + 1];
+                checksum += static_cast<bsl::size_t>(
+                    bsl::sprintf(buffer, "%u", value));
+            }
+        }
+        referenceStopwatch.stop();
+
+        stopwatch.start();
+        for (bsl::size_t iteration = 0; iteration < k_NUM_ITERATIONS;
+             ++iteration)
+        {
+            for (unsigned int value = 0; value <= 0xFFFF; ++value) {
+                char buffer[ntsa::PortUtil::MAX_LENGTH + 1];
+                checksum += ntsa::PortUtil::format(
+                    buffer,
+                    sizeof buffer,
+                    static_cast<ntsa::Port>(value));
+            }
+        }
+        stopwatch.stop();
+
+        const bsl::size_t numFormatted = k_NUM_ITERATIONS * 0x10000;
+
+        bsl::cout << "Formatted " << numFormatted << " ports (checksum "
+                  << checksum << ")" << bsl::endl;
+        bsl::cout << "    Reference: "
+                  << referenceStopwatch.accumulatedWallTime() << " seconds"
+                  << bsl::endl;
+        bsl::cout << "    Current:   " << stopwatch.accumulatedWallTime()
+                  << " seconds" << bsl::endl;
+    }
+}
+
 NTSCFG_TEST_DRIVER
 {
     NTSCFG_TEST_REGISTER(1);
     NTSCFG_TEST_REGISTER(2);
+    NTSCFG_TEST_REGISTER(3);
+    NTSCFG_TEST_REGISTER(4);
 }
 NTSCFG_TEST_DRIVER_END;
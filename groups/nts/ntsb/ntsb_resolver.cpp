@@ -60,7 +60,7 @@ ntsa::Error ResolverOverrides::setIpAddress(
          ++it)
     {
         const ntsa::IpAddress& ipAddress = *it;
-        d_domainNameByIpAddress.erase(ipAddress);
+        d_domainNameByIpAddress.remove(ipAddress);
     }
 
     target.clear();
@@ -328,15 +328,14 @@ ntsa::Error ResolverOverrides::getDomainName(
 {
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
-    DomainNameByIpAddress::const_iterator it =
-        d_domainNameByIpAddress.find(ipAddress);
+    const bsl::string* domainName = d_domainNameByIpAddress.find(ipAddress);
 
-    if (it == d_domainNameByIpAddress.end()) {
+    if (domainName == 0) {
         return ntsa::Error(ntsa::Error::e_EOF);
     }
 
-    if (!it->second.empty()) {
-        *result = it->second;
+    if (!domainName->empty()) {
+        *result = *domainName;
     }
     else {
         return ntsa::Error(ntsa::Error::e_EOF);
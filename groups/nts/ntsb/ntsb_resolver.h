@@ -19,6 +19,7 @@
 #include <bsls_ident.h>
 BSLS_IDENT("$Id: $")
 
+#include <ntsa_addressmap.h>
 #include <ntsa_error.h>
 #include <ntsa_ipaddress.h>
 #include <ntsa_port.h>
@@ -55,7 +56,7 @@ class ResolverOverrides
 
     /// Define a type alias for a map of IP addresses to
     /// domain names.
-    typedef bsl::unordered_map<ntsa::IpAddress, bsl::string>
+    typedef ntsa::AddressMap<ntsa::IpAddress, bsl::string>
         DomainNameByIpAddress;
 
     /// Define a type alias for a vector of port numbers.
@@ -581,6 +581,41 @@ ntsa::Error SocketOptionUtil::setTimestampOutgoingData(ntsa::Handle socket,
 #endif
 }
 
+ntsa::Error SocketOptionUtil::setBusyPoll(ntsa::Handle socket,
+                                          bsl::size_t  microseconds)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(SO_BUSY_POLL)
+
+    int rc;
+
+    if (microseconds > static_cast<bsl::size_t>(INT_MAX)) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    int optionValue = static_cast<int>(microseconds);
+
+    rc = setsockopt(socket,
+                    SOL_SOCKET,
+                    SO_BUSY_POLL,
+                    &optionValue,
+                    sizeof(optionValue));
+
+    if (rc != 0) {
+        return ntsa::Error(errno);
+    }
+
+    return ntsa::Error();
+
+#else
+
+    NTSCFG_WARNING_UNUSED(socket);
+    NTSCFG_WARNING_UNUSED(microseconds);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+
+#endif
+}
+
 ntsa::Error SocketOptionUtil::setLinger(ntsa::Handle              socket,
                                         bool                      linger,
                                         const bsls::TimeInterval& duration)
@@ -1229,6 +1264,47 @@ ntsa::Error SocketOptionUtil::getZeroCopy(bool*        zeroCopyFlag,
 #endif
 }
 
+ntsa::Error SocketOptionUtil::getBusyPoll(bsl::size_t* microseconds,
+                                          ntsa::Handle socket)
+{
+    *microseconds = 0;
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(SO_BUSY_POLL)
+
+    int rc;
+
+    int       optionValue  = 0;
+    socklen_t optionLength = static_cast<socklen_t>(sizeof(optionValue));
+
+    rc = getsockopt(socket,
+                    SOL_SOCKET,
+                    SO_BUSY_POLL,
+                    &optionValue,
+                    &optionLength);
+
+    if (rc != 0) {
+        return ntsa::Error(errno);
+    }
+
+    if (optionLength != static_cast<socklen_t>(sizeof(optionValue))) {
+        return ntsa::Error(ntsa::Error::e_INVALID);
+    }
+
+    if (optionValue > 0) {
+        *microseconds = static_cast<bsl::size_t>(optionValue);
+    }
+
+    return ntsa::Error();
+
+#else
+
+    NTSCFG_WARNING_UNUSED(socket);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+
+#endif
+}
+
 ntsa::Error SocketOptionUtil::getSendBufferRemaining(bsl::size_t* size,
                                                      ntsa::Handle socket)
 {
@@ -2076,6 +2152,15 @@ ntsa::Error SocketOptionUtil::setZeroCopy(ntsa::Handle socket, bool zeroCopy)
     return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
 }
 
+ntsa::Error SocketOptionUtil::setBusyPoll(ntsa::Handle socket,
+                                          bsl::size_t  microseconds)
+{
+    NTSCFG_WARNING_UNUSED(socket);
+    NTSCFG_WARNING_UNUSED(microseconds);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
 ntsa::Error SocketOptionUtil::setLinger(ntsa::Handle              socket,
                                         bool                      linger,
                                         const bsls::TimeInterval& duration)
@@ -2569,6 +2654,16 @@ ntsa::Error SocketOptionUtil::getZeroCopy(bool*        zeroCopyFlag,
     return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
 }
 
+ntsa::Error SocketOptionUtil::getBusyPoll(bsl::size_t* microseconds,
+                                          ntsa::Handle socket)
+{
+    NTSCFG_WARNING_UNUSED(socket);
+
+    *microseconds = 0;
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
 ntsa::Error SocketOptionUtil::getSendBufferRemaining(bsl::size_t* size,
                                                      ntsa::Handle socket)
 {
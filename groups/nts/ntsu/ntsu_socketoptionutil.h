@@ -142,6 +142,15 @@ struct SocketOptionUtil {
     /// flag. Return the error.
     static ntsa::Error setZeroCopy(ntsa::Handle socket, bool zeroCopy);
 
+    /// Set the option for the specified 'socket' that enables the kernel to
+    /// busy poll the device queue for incoming data for at most the
+    /// specified 'microseconds' when the socket would otherwise block, or
+    /// disables busy polling if 'microseconds' is zero. Return the error.
+    /// Note that this option is only supported on Linux, and that increasing
+    /// the value may require elevated privileges.
+    static ntsa::Error setBusyPoll(ntsa::Handle socket,
+                                   bsl::size_t  microseconds);
+
     /// Load into the specified 'option' the socket option of the specified
     /// 'type' for the specified 'socket'. Return the error.
     static ntsa::Error getOption(ntsa::SocketOption*           option,
@@ -236,6 +245,12 @@ struct SocketOptionUtil {
     static ntsa::Error getZeroCopy(bool*        zeroCopyFlag,
                                    ntsa::Handle socket);
 
+    /// Load into the specified 'microseconds' the maximum duration the kernel
+    /// busy polls the device queue for incoming data for the specified
+    /// 'socket', or zero if busy polling is disabled. Return the error.
+    static ntsa::Error getBusyPoll(bsl::size_t* microseconds,
+                                   ntsa::Handle socket);
+
     /// Load into the specified 'size' the option for the specified 'socket'
     /// that indicates the amount of space left in the send buffer. Return
     /// the error.
@@ -2466,8 +2466,14 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*       context,
         return ntsa::Error(ntsa::Error::e_INVALID);
     }
 
-    bsl::size_t size   = NTSCFG_WARNING_NARROW(bsl::size_t, file.size());
-    off_t       offset = static_cast<off_t>(file.position());
+    bsl::size_t size =
+        NTSCFG_WARNING_NARROW(bsl::size_t, file.bytesRemaining());
+
+    if (options.maxBytes() > 0 && size > options.maxBytes()) {
+        size = options.maxBytes();
+    }
+
+    off_t offset = static_cast<off_t>(file.position());
 
     context->setBytesSendable(size);
 
@@ -3669,6 +3675,75 @@ ntsa::Error SocketUtil::shutdown(ntsa::ShutdownType::Value direction,
     return ntsa::Error();
 }
 
+ntsa::Error SocketUtil::pipe(ntsa::Handle* reader, ntsa::Handle* writer)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+    *reader = ntsa::k_INVALID_HANDLE;
+    *writer = ntsa::k_INVALID_HANDLE;
+
+    int descriptors[2];
+    int rc = ::pipe2(descriptors, O_NONBLOCK | O_CLOEXEC);
+    if (rc != 0) {
+        return ntsa::Error(errno);
+    }
+
+    *reader = descriptors[0];
+    *writer = descriptors[1];
+
+    return ntsa::Error();
+
+#else
+
+    *reader = ntsa::k_INVALID_HANDLE;
+    *writer = ntsa::k_INVALID_HANDLE;
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+
+#endif
+}
+
+ntsa::Error SocketUtil::splice(bsl::size_t* result,
+                               ntsa::Handle source,
+                               ntsa::Handle destination,
+                               bsl::size_t  size)
+{
+    *result = 0;
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+    BSLS_ASSERT(size > 0);
+
+    ssize_t spliceResult = ::splice(source,
+                                    0,
+                                    destination,
+                                    0,
+                                    size,
+                                    SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+
+    if (spliceResult < 0) {
+        return ntsa::Error(errno);
+    }
+
+    if (spliceResult == 0) {
+        return ntsa::Error(ntsa::Error::e_EOF);
+    }
+
+    *result = static_cast<bsl::size_t>(spliceResult);
+
+    return ntsa::Error();
+
+#else
+
+    NTSCFG_WARNING_UNUSED(source);
+    NTSCFG_WARNING_UNUSED(destination);
+    NTSCFG_WARNING_UNUSED(size);
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+
+#endif
+}
+
 ntsa::Error SocketUtil::unlink(ntsa::Handle socket)
 {
     int rc;
@@ -6712,9 +6787,19 @@ ntsa::Error SocketUtil::send(ntsa::SendContext*       context,
         return ntsa::Error(ntsa::Error::e_INVALID);
     }
 
+    bdls::FilesystemUtil::Offset bytesRemaining = file.bytesRemaining();
+
+    if (options.maxBytes() > 0 &&
+        bytesRemaining >
+            static_cast<bdls::FilesystemUtil::Offset>(options.maxBytes()))
+    {
+        bytesRemaining =
+            static_cast<bdls::FilesystemUtil::Offset>(options.maxBytes());
+    }
+
     DWORD size;
-    if (file.size() <= bsl::numeric_limits<DWORD>::max()) {
-        size = NTSCFG_WARNING_NARROW(DWORD, file.size());
+    if (bytesRemaining <= bsl::numeric_limits<DWORD>::max()) {
+        size = NTSCFG_WARNING_NARROW(DWORD, bytesRemaining);
     }
     else {
         size = bsl::numeric_limits<DWORD>::max();
@@ -7656,6 +7741,27 @@ ntsa::Error SocketUtil::shutdown(ntsa::ShutdownType::Value direction,
     return ntsa::Error();
 }
 
+ntsa::Error SocketUtil::pipe(ntsa::Handle* reader, ntsa::Handle* writer)
+{
+    *reader = ntsa::k_INVALID_HANDLE;
+    *writer = ntsa::k_INVALID_HANDLE;
+
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
+ntsa::Error SocketUtil::splice(bsl::size_t* result,
+                               ntsa::Handle source,
+                               ntsa::Handle destination,
+                               bsl::size_t  size)
+{
+    NTSCFG_WARNING_UNUSED(source);
+    NTSCFG_WARNING_UNUSED(destination);
+    NTSCFG_WARNING_UNUSED(size);
+
+    *result = 0;
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+}
+
 ntsa::Error SocketUtil::unlink(ntsa::Handle socket)
 {
 #if NTSCFG_BUILD_WITH_TRANSPORT_PROTOCOL_LOCAL
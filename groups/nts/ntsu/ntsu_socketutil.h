@@ -698,6 +698,31 @@ struct SocketUtil {
                             ntsa::Handle*          server,
                             ntsa::Transport::Value type);
 
+    /// Load into the specified 'reader' and 'writer' the read end and the
+    /// write end of a new kernel pipe, each non-blocking and closed on
+    /// 'exec', through which data may be spliced between two sockets. Each
+    /// end must be closed by calling 'close'. Return the error, notably
+    /// 'ntsa::Error::e_NOT_IMPLEMENTED' if splicing is not supported on
+    /// the current platform.
+    static ntsa::Error pipe(ntsa::Handle* reader, ntsa::Handle* writer);
+
+    /// Move at most the specified 'size' bytes from the specified 'source'
+    /// to the specified 'destination' within the kernel, without copying
+    /// them into user space, and load into the specified 'result' the
+    /// number of bytes moved. Return the error, notably
+    /// 'ntsa::Error::e_WOULD_BLOCK' if either 'source' has no data or
+    /// 'destination' has no capacity, 'ntsa::Error::e_EOF' if 'source' is
+    /// shut down for reading, and 'ntsa::Error::e_NOT_IMPLEMENTED' if
+    /// splicing is not supported on the current platform. The behavior is
+    /// undefined unless 'size' is greater than zero and either 'source' or
+    /// 'destination' is an end of a pipe created by 'pipe'. Note that,
+    /// unlike 'send', splicing into a socket whose peer has closed the
+    /// connection raises 'SIGPIPE' unless that signal is ignored.
+    static ntsa::Error splice(bsl::size_t* result,
+                              ntsa::Handle source,
+                              ntsa::Handle destination,
+                              bsl::size_t  size);
+
     /// Load into the specified 'endpoint' the conversion of the specified
     /// 'socketAddress' having the specified 'socketAddressSize'. Return the
     /// error.
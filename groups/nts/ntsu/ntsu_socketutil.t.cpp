@@ -27,6 +27,7 @@
 #include <bslma_testallocator.h>
 #include <bslmt_threadgroup.h>
 #include <bsls_platform.h>
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_list.h>
 #include <bsl_set.h>
@@ -1138,6 +1139,269 @@ void testStreamSocketTransmissionFile(ntsa::Transport::Value transport,
 #endif
 }
 
+void testStreamSocketTransmissionFileChunked(ntsa::Transport::Value transport,
+                                             ntsa::Handle           server,
+                                             ntsa::Handle           client,
+                                             bslma::Allocator*      allocator)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+    NTSCFG_TEST_LOG_DEBUG << "Testing " << transport << ": sendfile chunked"
+                          << NTSCFG_TEST_LOG_END;
+
+    ntsa::Error error;
+    int         rc;
+
+    char DATA[] = "123456789";
+
+    const bsl::size_t k_MAX_BYTES = 4;
+
+    bsl::string filePathPrefix;
+    {
+        const char* variable = bsl::getenv("TMPDIR");
+        if (variable) {
+            filePathPrefix = variable;
+        }
+        else {
+            filePathPrefix = "/tmp";
+        }
+
+        filePathPrefix += "/ntsu_socketutil.t.";
+    }
+
+    bsl::string                          filePath;
+    bdls::FilesystemUtil::FileDescriptor fileDescriptor =
+        bdls::FilesystemUtil::createTemporaryFile(&filePath,
+                                                  filePathPrefix.c_str());
+    if (fileDescriptor == bdls::FilesystemUtil::k_INVALID_FD) {
+        // Temporary files cannot always be created on build machines during
+        // continuous integration, so skip the test rather than fail it.
+
+        NTSCFG_TEST_LOG_WARN << "Failed to create temporary file prefix '"
+                             << filePathPrefix << "': skipping"
+                             << NTSCFG_TEST_LOG_END;
+        return;
+    }
+
+    rc = bdls::FilesystemUtil::write(fileDescriptor, DATA, sizeof DATA - 1);
+    NTSCFG_TEST_ASSERT(rc == sizeof DATA - 1);
+
+    bdlbb::SimpleBlobBufferFactory blobBufferFactory(3, allocator);
+
+    bdlbb::Blob clientBlob(&blobBufferFactory, allocator);
+    bdlbb::BlobUtil::append(&clientBlob, DATA, sizeof DATA - 1);
+
+    bdlbb::Blob serverBlob(&blobBufferFactory, allocator);
+    serverBlob.setLength(sizeof DATA - 1);
+    serverBlob.setLength(0);
+
+    // Transmit the file in chunks limited by the send options, advancing
+    // the file after each chunk by the number of bytes sent.
+
+    {
+        ntsa::SendOptions options;
+        options.setMaxBytes(k_MAX_BYTES);
+
+        ntsa::Data data(ntsa::File(fileDescriptor, 0, sizeof DATA - 1));
+
+        bsl::size_t numChunks = 0;
+
+        while (data.file().bytesRemaining() > 0) {
+            const bsl::size_t bytesRemaining =
+                static_cast<bsl::size_t>(data.file().bytesRemaining());
+
+            const bsl::size_t bytesExpected =
+                bsl::min(bytesRemaining, k_MAX_BYTES);
+
+            ntsa::SendContext context;
+            error = ntsu::SocketUtil::send(&context, data, options, client);
+            if (error) {
+                BSLS_LOG_ERROR("Transport %s error: %s",
+                               ntsa::Transport::toString(transport),
+                               error.text().c_str());
+            }
+            NTSCFG_TEST_ASSERT(!error);
+
+            NTSCFG_TEST_ASSERT(context.bytesSendable() == bytesExpected);
+            NTSCFG_TEST_ASSERT(context.bytesSent() == bytesExpected);
+
+            ntsa::DataUtil::pop(&data, context.bytesSent());
+
+            NTSCFG_TEST_ASSERT(
+                data.file().position() ==
+                static_cast<bdls::FilesystemUtil::Offset>(
+                    (sizeof DATA - 1) - bytesRemaining + bytesExpected));
+
+            NTSCFG_TEST_ASSERT(
+                data.file().bytesRemaining() ==
+                static_cast<bdls::FilesystemUtil::Offset>(bytesRemaining -
+                                                          bytesExpected));
+
+            ++numChunks;
+        }
+
+        NTSCFG_TEST_ASSERT(numChunks == 3);
+    }
+
+    // Dequeue incoming data received by the server socket.
+
+    {
+        ntsa::ReceiveContext context;
+        ntsa::ReceiveOptions options;
+
+        error =
+            ntsu::SocketUtil::receive(&context, &serverBlob, options, server);
+        NTSCFG_TEST_ASSERT(!error);
+
+        NTSCFG_TEST_ASSERT(context.bytesReceivable() == 9);
+        NTSCFG_TEST_ASSERT(context.bytesReceived() == 9);
+
+        NTSCFG_TEST_ASSERT(serverBlob.length() == 9);
+        NTSCFG_TEST_ASSERT(bdlbb::BlobUtil::compare(serverBlob, clientBlob) ==
+                           0);
+    }
+
+    rc = bdls::FilesystemUtil::remove(filePath);
+    NTSCFG_TEST_ASSERT(rc == 0);
+
+    rc = bdls::FilesystemUtil::close(fileDescriptor);
+    NTSCFG_TEST_ASSERT(rc == 0);
+
+#else
+
+    NTSCFG_WARNING_UNUSED(transport);
+    NTSCFG_WARNING_UNUSED(server);
+    NTSCFG_WARNING_UNUSED(client);
+    NTSCFG_WARNING_UNUSED(allocator);
+
+#endif
+}
+
+void testStreamSocketSplice(ntsa::Transport::Value transport,
+                            ntsa::Handle           server,
+                            ntsa::Handle           client,
+                            bslma::Allocator*      allocator)
+{
+    NTSCFG_TEST_LOG_DEBUG << "Testing " << transport << ": splice"
+                          << NTSCFG_TEST_LOG_END;
+
+    ntsa::Error error;
+
+    ntsa::Handle reader;
+    ntsa::Handle writer;
+    error = ntsu::SocketUtil::pipe(&reader, &writer);
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+    NTSCFG_TEST_ASSERT(!error);
+
+    char DATA[] = "123456789";
+
+    bdlbb::SimpleBlobBufferFactory blobBufferFactory(3, allocator);
+
+    bdlbb::Blob clientBlob(&blobBufferFactory, allocator);
+    bdlbb::BlobUtil::append(&clientBlob, DATA, sizeof DATA - 1);
+
+    bsl::size_t numBytesSpliced = 0;
+
+    // Ensure splicing from an empty pipe would block.
+
+    error = ntsu::SocketUtil::splice(&numBytesSpliced, reader, server, 4);
+    NTSCFG_TEST_ASSERT(error.code() == ntsa::Error::e_WOULD_BLOCK);
+    NTSCFG_TEST_ASSERT(numBytesSpliced == 0);
+
+    // Enqueue outgoing data to transmit by the client socket.
+
+    {
+        ntsa::SendContext context;
+        ntsa::SendOptions options;
+
+        error = ntsu::SocketUtil::send(&context, clientBlob, options, client);
+        NTSCFG_TEST_ASSERT(!error);
+        NTSCFG_TEST_ASSERT(context.bytesSent() == sizeof DATA - 1);
+    }
+
+    // Splice the data received by the server socket into the pipe.
+
+    {
+        bsl::size_t total = 0;
+        while (total < sizeof DATA - 1) {
+            error = ntsu::SocketUtil::waitUntilReadable(server);
+            NTSCFG_TEST_ASSERT(!error);
+
+            error = ntsu::SocketUtil::splice(&numBytesSpliced,
+                                             server,
+                                             writer,
+                                             sizeof DATA - 1 - total);
+            NTSCFG_TEST_ASSERT(!error);
+            NTSCFG_TEST_ASSERT(numBytesSpliced > 0);
+
+            total += numBytesSpliced;
+        }
+
+        NTSCFG_TEST_ASSERT(total == sizeof DATA - 1);
+    }
+
+    // Splice the data from the pipe back out through the server socket.
+
+    error = ntsu::SocketUtil::splice(&numBytesSpliced,
+                                     reader,
+                                     server,
+                                     sizeof DATA - 1);
+    NTSCFG_TEST_ASSERT(!error);
+    NTSCFG_TEST_ASSERT(numBytesSpliced == sizeof DATA - 1);
+
+    // Dequeue the data echoed back to the client socket.
+
+    {
+        bdlbb::Blob echoBlob(&blobBufferFactory, allocator);
+
+        while (echoBlob.length() < static_cast<int>(sizeof DATA - 1)) {
+            ntsa::ReceiveContext context;
+            ntsa::ReceiveOptions options;
+
+            error = ntsu::SocketUtil::receive(&context,
+                                              &echoBlob,
+                                              options,
+                                              client);
+            NTSCFG_TEST_ASSERT(!error);
+        }
+
+        NTSCFG_TEST_ASSERT(echoBlob.length() == sizeof DATA - 1);
+        NTSCFG_TEST_ASSERT(bdlbb::BlobUtil::compare(echoBlob, clientBlob) ==
+                           0);
+    }
+
+    // Shut down the client socket for sending and ensure splicing from the
+    // server socket detects the end of the stream.
+
+    error = ntsu::SocketUtil::shutdown(ntsa::ShutdownType::e_SEND, client);
+    NTSCFG_TEST_ASSERT(!error);
+
+    error = ntsu::SocketUtil::waitUntilReadable(server);
+    NTSCFG_TEST_ASSERT(!error);
+
+    error = ntsu::SocketUtil::splice(&numBytesSpliced, server, writer, 4);
+    NTSCFG_TEST_ASSERT(error.code() == ntsa::Error::e_EOF);
+    NTSCFG_TEST_ASSERT(numBytesSpliced == 0);
+
+    error = ntsu::SocketUtil::close(reader);
+    NTSCFG_TEST_ASSERT(!error);
+
+    error = ntsu::SocketUtil::close(writer);
+    NTSCFG_TEST_ASSERT(!error);
+
+#else
+
+    NTSCFG_WARNING_UNUSED(server);
+    NTSCFG_WARNING_UNUSED(client);
+    NTSCFG_WARNING_UNUSED(allocator);
+
+    NTSCFG_TEST_ASSERT(error.code() == ntsa::Error::e_NOT_IMPLEMENTED);
+
+#endif
+}
+
 void testDatagramSocketTransmissionSingleBuffer(
     ntsa::Transport::Value transport,
     ntsa::Handle           server,
@@ -8139,6 +8403,34 @@ NTSCFG_TEST_CASE(34)
     NTSCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
 }
 
+NTSCFG_TEST_CASE(35)
+{
+    // Concern: Stream socket transmission: splice through a pipe.
+    // Plan: Splice data received by a socket into a pipe, then from the
+    // pipe back out through the socket, then ensure the end of the stream
+    // is detected.
+
+    ntscfg::TestAllocator ta;
+    {
+        test::executeStreamSocketTest(&test::testStreamSocketSplice);
+    }
+    NTSCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
+NTSCFG_TEST_CASE(36)
+{
+    // Concern: Stream socket transmission: file, in chunks limited by the
+    // maximum number of bytes to send.
+    // Plan:
+
+    ntscfg::TestAllocator ta;
+    {
+        test::executeStreamSocketTest(
+            &test::testStreamSocketTransmissionFileChunked);
+    }
+    NTSCFG_TEST_ASSERT(ta.numBlocksInUse() == 0);
+}
+
 NTSCFG_TEST_DRIVER
 {
     NTSCFG_TEST_REGISTER(1);
@@ -8175,5 +8467,7 @@ NTSCFG_TEST_DRIVER
     NTSCFG_TEST_REGISTER(32);
     NTSCFG_TEST_REGISTER(33);
     NTSCFG_TEST_REGISTER(34);
+    NTSCFG_TEST_REGISTER(35);
+    NTSCFG_TEST_REGISTER(36);
 }
 NTSCFG_TEST_DRIVER_END;
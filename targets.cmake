@@ -104,9 +104,11 @@ if (${NTF_BUILD_WITH_NTS})
     )
 
     ntf_component(NAME ntsa_adapter)
+    ntf_component(NAME ntsa_addressmap)
     ntf_component(NAME ntsa_buffer)
     ntf_component(NAME ntsa_data)
     ntf_component(NAME ntsa_datatype)
+    ntf_component(NAME ntsa_decimalutil)
     ntf_component(NAME ntsa_distinguishedname)
     ntf_component(NAME ntsa_domainname)
     ntf_component(NAME ntsa_endpoint)
@@ -424,6 +426,10 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntca_getendpointoptions)
     ntf_component(NAME ntca_getendpointevent)
     ntf_component(NAME ntca_getendpointeventtype)
+    ntf_component(NAME ntca_getserviceendpointscontext)
+    ntf_component(NAME ntca_getserviceendpointsoptions)
+    ntf_component(NAME ntca_getserviceendpointsevent)
+    ntf_component(NAME ntca_getserviceendpointseventtype)
     ntf_component(NAME ntca_listenersocketevent)
     ntf_component(NAME ntca_listenersocketeventtype)
     ntf_component(NAME ntca_listenersocketoptions)
@@ -538,6 +544,8 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntci_getservicenamecallbackfactory)
     ntf_component(NAME ntci_getendpointcallback)
     ntf_component(NAME ntci_getendpointcallbackfactory)
+    ntf_component(NAME ntci_getserviceendpointscallback)
+    ntf_component(NAME ntci_getserviceendpointscallbackfactory)
     ntf_component(NAME ntci_identifiable)
     ntf_component(NAME ntci_invoker)
     ntf_component(NAME ntci_interface)
@@ -579,6 +587,7 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntci_streamsocket)
     ntf_component(NAME ntci_streamsocketfactory)
     ntf_component(NAME ntci_streamsocketmanager)
+    ntf_component(NAME ntci_streamsocketrelay)
     ntf_component(NAME ntci_streamsocketsession)
     ntf_component(NAME ntci_scheduler)
     ntf_component(NAME ntci_timer)
@@ -614,6 +623,7 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntcm_logpublisher)
     ntf_component(NAME ntcm_monitorableregistry)
     ntf_component(NAME ntcm_monitorableutil)
+    ntf_component(NAME ntcm_openmetricspublisher)
     ntf_component(NAME ntcm_periodiccollector)
 
     ntf_package_end(NAME ntcm)
@@ -635,6 +645,7 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntcs_blobbufferfactory)
     ntf_component(NAME ntcs_blobbufferutil)
     ntf_component(NAME ntcs_blobutil)
+    ntf_component(NAME ntcs_busypoll)
     ntf_component(NAME ntcs_callbackstate)
     ntf_component(NAME ntcs_chronology)
     ntf_component(NAME ntcs_compat)
@@ -671,6 +682,8 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntcs_skiplist)
     ntf_component(NAME ntcs_strand)
     ntf_component(NAME ntcs_threadutil)
+    ntf_component(NAME ntcs_trace)
+    ntf_component(NAME ntcs_watchdog)
     ntf_component(NAME ntcs_watermarks)
     ntf_component(NAME ntcs_watermarkutil)
     ntf_component(NAME ntcs_user)
@@ -778,6 +791,9 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_component(NAME ntcu_streamsocketsession)
     ntf_component(NAME ntcu_streamsocketeventqueue)
     ntf_component(NAME ntcu_streamsocketutil)
+    ntf_component(NAME ntcu_streamsocketracer)
+    ntf_component(NAME ntcu_streamsocketrelay)
+    ntf_component(NAME ntcu_streamdescriptorrelay)
     ntf_component(NAME ntcu_timestampcorrelator)
 
     ntf_package_end(NAME ntcu)
@@ -891,6 +907,18 @@ if (${NTF_BUILD_WITH_NTC})
     ntf_group_end(NAME ntc)
 endif()
 
+if (${NTF_BUILD_WITH_NTC})
+    ntf_executable(
+        NAME
+            ntctrace
+        PATH
+            tools/m_ntctrace
+        REQUIRES
+            ntc nts)
+
+    ntf_executable_end(NAME ntctrace)
+endif()
+
 if (${NTF_BUILD_WITH_USAGE_EXAMPLES})
     if (${NTF_BUILD_WITH_NTS})
         foreach (suffix 01;02;03;04;05;06;07;08)
@@ -0,0 +1,60 @@
+// Copyright 2020-2023 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Decode a trace saved by 'ntcs::Trace::save' and print its events, one per
+// line, ordered by time.
+
+#include <ntcs_trace.h>
+#include <ntsa_error.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+
+void help()
+{
+    bsl::cout << "usage: <program> <path>" << bsl::endl;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 2) {
+        help();
+        return 1;
+    }
+
+    if ((0 == std::strcmp(argv[1], "-?")) ||
+        (0 == std::strcmp(argv[1], "--help")))
+    {
+        help();
+        return 0;
+    }
+
+    bsl::filebuf file;
+    if (!file.open(argv[1], bsl::ios_base::in | bsl::ios_base::binary)) {
+        bsl::cerr << "Failed to open " << argv[1] << bsl::endl;
+        return 1;
+    }
+
+    ntsa::Error error = ntcs::Trace::print(bsl::cout, &file);
+    if (error) {
+        bsl::cerr << "Failed to decode " << argv[1] << ": " << error
+                  << bsl::endl;
+        return 1;
+    }
+
+    return 0;
+}